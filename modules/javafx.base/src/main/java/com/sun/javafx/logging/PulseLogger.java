@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,9 +35,20 @@ import java.util.List;
 public class PulseLogger {
     public static final boolean PULSE_LOGGING_ENABLED;
 
+    /**
+     * Categories of native code whose cost is reported with
+     * {@link #addNativeEvent}.
+     */
+    public static final int NATIVE_RENDERING = 1;
+    public static final int NATIVE_MEDIA = 2;
+    public static final int NATIVE_WEB = 4;
+
     private static final String [] DEFAULT_LOGGERS = {"com.sun.javafx.logging.PrintLogger", "com.sun.javafx.logging.jfr.JFRPulseLogger"};
     private static final Logger[] loggers;
 
+    // Native categories recorded by any logger, updated at each pulse
+    private static volatile int nativeCategories;
+
     static {
         List<Logger> list = new ArrayList<>();
         for (String loggerClass : DEFAULT_LOGGERS) {
@@ -51,9 +62,12 @@ public class PulseLogger {
     }
 
     public static void pulseStart() {
+        int categories = 0;
         for (Logger logger: loggers) {
             logger.pulseStart();
+            categories |= logger.getNativeCategories();
         }
+        nativeCategories = categories;
     }
 
     public static void pulseEnd() {
@@ -102,6 +116,46 @@ public class PulseLogger {
      * @return true if the user requested pulse logging by setting the system
      *         property javafx.pulseLogger to true, false otherwise.
      */
+    /**
+     * Returns whether the cost of native code in the given category is being
+     * recorded. Callers check this before measuring anything, so that native
+     * events cost nothing while they are not recorded.
+     */
+    public static boolean isNativeEnabled(int category) {
+        return PULSE_LOGGING_ENABLED && (nativeCategories & category) != 0;
+    }
+
+    /**
+     * Returns the start time of a call into native code in the given
+     * category, to pass to {@link #nativeEnd}, or 0 if the category is not
+     * being recorded.
+     */
+    public static long nativeStart(int category) {
+        return isNativeEnabled(category) ? System.nanoTime() : 0L;
+    }
+
+    /**
+     * Reports a call into native code that started at the time returned by
+     * {@link #nativeStart}.
+     */
+    public static void nativeEnd(int category, String name, long start, long bytes) {
+        if (start != 0L) {
+            addNativeEvent(category, name, System.nanoTime() - start, bytes);
+        }
+    }
+
+    /**
+     * Reports the time spent in and the data passed to native code. The
+     * reports with the same name on the event or render thread are added up
+     * and recorded once per pulse; those from other threads are recorded
+     * right away.
+     */
+    public static void addNativeEvent(int category, String name, long nanos, long bytes) {
+        for (Logger logger: loggers) {
+            logger.addNativeEvent(category, name, nanos, bytes);
+        }
+    }
+
     @SuppressWarnings("removal")
     public static boolean isPulseLoggingRequested() {
         return AccessController.doPrivileged((PrivilegedAction<Boolean>) () -> Boolean.getBoolean("javafx.pulseLogger"));
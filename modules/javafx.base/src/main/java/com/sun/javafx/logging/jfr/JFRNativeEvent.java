@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.logging.jfr;
+
+import jdk.jfr.DataAmount;
+import jdk.jfr.Event;
+import jdk.jfr.Label;
+import jdk.jfr.Timespan;
+
+/**
+ * The time and data of calls into native code with the same name, added up
+ * over one pulse. Each category of native code has its own event type, so
+ * the categories can be enabled separately.
+ */
+public abstract class JFRNativeEvent extends Event {
+    @PulseId
+    @Label("Pulse Id")
+    private int pulseId;
+
+    @Label("Name")
+    private String name;
+
+    @Label("Calls")
+    private int calls;
+
+    @Timespan(Timespan.NANOSECONDS)
+    @Label("Native Time")
+    private long nativeTime;
+
+    @DataAmount
+    @Label("Data")
+    private long bytes;
+
+    public void setPulseId(int pulseId) {
+        this.pulseId = pulseId;
+    }
+
+    public void setName(String name) {
+        this.name = name;
+    }
+
+    public void add(long nanos, long bytes) {
+        this.calls++;
+        this.nativeTime += nanos;
+        this.bytes += bytes;
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,16 +27,21 @@ package com.sun.javafx.logging.jfr;
 import com.sun.javafx.logging.Logger;
 import com.sun.javafx.logging.PulseLogger;
 
+import java.util.HashMap;
+import java.util.Map;
+
 import jdk.jfr.FlightRecorder;
 
 public final class JFRPulseLogger extends Logger {
     private final ThreadLocal<JFRPulsePhaseEvent> currentPulsePhaseEvent;
     private final ThreadLocal<JFRInputEvent> currentInputEvent;
+    private final ThreadLocal<Map<String, JFRNativeEvent>> nativeEvents;
 
     private int pulseNumber;
     private int fxPulseNumber;
     private int renderPulseNumber;
     private Thread fxThread;
+    private Thread renderThread;
 
     public static Logger createInstance() {
         if (FlightRecorder.isInitialized() || PulseLogger.isPulseLoggingRequested()) {
@@ -48,6 +53,9 @@ public final class JFRPulseLogger extends Logger {
     private JFRPulseLogger() {
         FlightRecorder.register(JFRInputEvent.class);
         FlightRecorder.register(JFRPulsePhaseEvent.class);
+        FlightRecorder.register(JFRNativeRenderingEvent.class);
+        FlightRecorder.register(JFRNativeMediaEvent.class);
+        FlightRecorder.register(JFRNativeWebEvent.class);
         currentPulsePhaseEvent = new ThreadLocal<>() {
             @Override
             public JFRPulsePhaseEvent initialValue() {
@@ -60,6 +68,7 @@ public final class JFRPulseLogger extends Logger {
                 return new JFRInputEvent();
             }
         };
+        nativeEvents = ThreadLocal.withInitial(HashMap::new);
     }
 
     @Override
@@ -75,6 +84,7 @@ public final class JFRPulseLogger extends Logger {
     @Override
     public void pulseEnd() {
         newPhase(null);
+        commitNativeEvents(fxPulseNumber);
         fxPulseNumber = 0;
     }
 
@@ -86,9 +96,73 @@ public final class JFRPulseLogger extends Logger {
     @Override
     public void renderEnd() {
         newPhase(null);
+        if (renderThread == null) {
+            renderThread = Thread.currentThread();
+        }
+        commitNativeEvents(renderPulseNumber);
         renderPulseNumber = 0;
     }
 
+    @Override
+    public int getNativeCategories() {
+        int categories = 0;
+        if (new JFRNativeRenderingEvent().isEnabled()) {
+            categories |= PulseLogger.NATIVE_RENDERING;
+        }
+        if (new JFRNativeMediaEvent().isEnabled()) {
+            categories |= PulseLogger.NATIVE_MEDIA;
+        }
+        if (new JFRNativeWebEvent().isEnabled()) {
+            categories |= PulseLogger.NATIVE_WEB;
+        }
+        return categories;
+    }
+
+    private static JFRNativeEvent newNativeEvent(int category) {
+        switch (category) {
+            case PulseLogger.NATIVE_MEDIA:
+                return new JFRNativeMediaEvent();
+            case PulseLogger.NATIVE_WEB:
+                return new JFRNativeWebEvent();
+            default:
+                return new JFRNativeRenderingEvent();
+        }
+    }
+
+    @Override
+    public void addNativeEvent(int category, String name, long nanos, long bytes) {
+        Thread thread = Thread.currentThread();
+        if (thread != fxThread && thread != renderThread) {
+            JFRNativeEvent event = newNativeEvent(category);
+            event.setName(name);
+            event.add(nanos, bytes);
+            event.commit();
+            return;
+        }
+
+        /* Add up the calls until the end of the pulse on this thread */
+        Map<String, JFRNativeEvent> events = nativeEvents.get();
+        JFRNativeEvent event = events.get(name);
+        if (event == null) {
+            event = newNativeEvent(category);
+            event.begin();
+            event.setName(name);
+            events.put(name, event);
+        }
+        event.add(nanos, bytes);
+    }
+
+    private void commitNativeEvents(int pulseId) {
+        Map<String, JFRNativeEvent> events = nativeEvents.get();
+        if (!events.isEmpty()) {
+            for (JFRNativeEvent event : events.values()) {
+                event.setPulseId(pulseId);
+                event.commit();
+            }
+            events.clear();
+        }
+    }
+
     /**
      * Finishes the current phase and starts a new one if phaseName is not null.
      *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -752,6 +752,22 @@ public abstract class View {
     }
 
 
+    protected int[] _getCoalescedMouseLocations(long ptr) {
+        return null;
+    }
+    /**
+     * Returns the locations of the mouse moves that the platform merged into
+     * the MOVE or DRAG event being handled, as x, y pairs in view coordinates
+     * with the oldest first, or null if there are none.
+     *
+     * Only valid while that event is being handled.
+     */
+    public int[] getCoalescedMouseLocations() {
+        Application.checkEventThread();
+        checkNotClosed();
+        return _getCoalescedMouseLocations(this.ptr);
+    }
+
     protected abstract void _uploadPixels(long ptr, Pixels pixels);
     /**
      * This method dumps the pixels on to the view.
@@ -770,6 +786,28 @@ public abstract class View {
         }
     }
 
+    /**
+     * Platforms that can update part of the view override this, the others
+     * upload the whole pixels.
+     */
+    protected void _uploadPixels(long ptr, Pixels pixels, int x, int y, int width, int height) {
+        _uploadPixels(ptr, pixels);
+    }
+    /**
+     * This method dumps the pixels on to the view. Only the given area has
+     * changed since the previous upload, the rest of the view may be kept.
+     */
+    public void uploadPixels(Pixels pixels, int x, int y, int width, int height) {
+        Application.checkEventThread();
+        checkNotClosed();
+        lock();
+        try {
+            _uploadPixels(this.ptr, pixels, x, y, width, height);
+        } finally {
+            unlock();
+        }
+    }
+
 
     //-------- FULLSCREEN --------//
 
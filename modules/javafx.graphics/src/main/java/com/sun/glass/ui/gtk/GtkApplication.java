@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -236,7 +236,13 @@ final class GtkApplication extends Application implements
         final boolean disableGrab = AccessController.doPrivileged((PrivilegedAction<Boolean>) () -> Boolean.getBoolean("sun.awt.disablegrab") ||
                Boolean.getBoolean("glass.disableGrab"));
 
-        _init(eventProc, disableGrab);
+        // Merge mouse moves and scrolls that are already queued behind one
+        // another instead of delivering each of them
+        @SuppressWarnings("removal")
+        final boolean coalesceEvents = AccessController.doPrivileged((PrivilegedAction<Boolean>) () ->
+               Boolean.getBoolean("glass.gtk.coalesceEvents"));
+
+        _init(eventProc, disableGrab, coalesceEvents);
     }
 
     @Override
@@ -283,7 +289,7 @@ final class GtkApplication extends Application implements
 
     private native void _terminateLoop();
 
-    private native void _init(long eventProc, boolean disableGrab);
+    private native void _init(long eventProc, boolean disableGrab, boolean coalesceEvents);
 
     private native void _runLoop(Runnable launchable, boolean noErrorTrap);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -70,6 +70,9 @@ final class GtkView extends View {
     @Override
     protected native void _scheduleRepaint(long ptr);
 
+    @Override
+    protected native int[] _getCoalescedMouseLocations(long ptr);
+
     @Override
     protected void _begin(long ptr) {}
 
@@ -78,25 +81,33 @@ final class GtkView extends View {
 
     @Override
     protected void _uploadPixels(long ptr, Pixels pixels) {
+        _uploadPixels(ptr, pixels, 0, 0, pixels.getWidth(), pixels.getHeight());
+    }
+
+    @Override
+    protected void _uploadPixels(long ptr, Pixels pixels, int x, int y, int w, int h) {
         Buffer data = pixels.getPixels();
         if (data.isDirect() == true) {
-            _uploadPixelsDirect(ptr, data, pixels.getWidth(), pixels.getHeight());
+            _uploadPixelsDirect(ptr, data, pixels.getWidth(), pixels.getHeight(), x, y, w, h);
         } else if (data.hasArray() == true) {
             if (pixels.getBytesPerComponent() == 1) {
                 ByteBuffer bytes = (ByteBuffer)data;
-                _uploadPixelsByteArray(ptr, bytes.array(), bytes.arrayOffset(), pixels.getWidth(), pixels.getHeight());
+                _uploadPixelsByteArray(ptr, bytes.array(), bytes.arrayOffset(), pixels.getWidth(), pixels.getHeight(), x, y, w, h);
             } else {
                 IntBuffer ints = (IntBuffer)data;
-                _uploadPixelsIntArray(ptr, ints.array(), ints.arrayOffset(), pixels.getWidth(), pixels.getHeight());
+                _uploadPixelsIntArray(ptr, ints.array(), ints.arrayOffset(), pixels.getWidth(), pixels.getHeight(), x, y, w, h);
             }
         } else {
             // gznote: what are the circumstances under which this can happen?
-            _uploadPixelsDirect(ptr, pixels.asByteBuffer(), pixels.getWidth(), pixels.getHeight());
+            _uploadPixelsDirect(ptr, pixels.asByteBuffer(), pixels.getWidth(), pixels.getHeight(), x, y, w, h);
         }
     }
-    private native void _uploadPixelsDirect(long viewPtr, Buffer pixels, int width, int height);
-    private native void _uploadPixelsByteArray(long viewPtr, byte[] pixels, int offset, int width, int height);
-    private native void _uploadPixelsIntArray(long viewPtr, int[] pixels, int offset, int width, int height);
+    private native void _uploadPixelsDirect(long viewPtr, Buffer pixels, int width, int height,
+                                            int dirtyX, int dirtyY, int dirtyWidth, int dirtyHeight);
+    private native void _uploadPixelsByteArray(long viewPtr, byte[] pixels, int offset, int width, int height,
+                                               int dirtyX, int dirtyY, int dirtyWidth, int dirtyHeight);
+    private native void _uploadPixelsIntArray(long viewPtr, int[] pixels, int offset, int width, int height,
+                                              int dirtyX, int dirtyY, int dirtyWidth, int dirtyHeight);
 
     @Override
     protected native boolean _enterFullscreen(long ptr, boolean animate, boolean keepRatio, boolean hideCursor);
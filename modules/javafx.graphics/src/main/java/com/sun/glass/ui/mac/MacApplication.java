@@ -43,7 +43,8 @@ import java.util.concurrent.TimeUnit;
 
 final class MacApplication extends Application implements InvokeLaterDispatcher.InvokeLaterSubmitter {
 
-    private native static void _initIDs(boolean disableSyncRendering);
+    private native static void _initIDs(boolean disableSyncRendering,
+                                        boolean enableMetalLayer, boolean enableDisplaySync);
     static {
         @SuppressWarnings("removal")
         var dummy = AccessController.doPrivileged((PrivilegedAction<Void>) () -> {
@@ -54,7 +55,17 @@ final class MacApplication extends Application implements InvokeLaterDispatcher.
         boolean disableSyncRendering = AccessController
                 .doPrivileged((PrivilegedAction<Boolean>) () ->
                         Boolean.getBoolean("glass.disableSyncRendering"));
-        _initIDs(disableSyncRendering);
+        // Present the views through a CAMetalLayer instead of a CAOpenGLLayer
+        @SuppressWarnings("removal")
+        boolean enableMetalLayer = AccessController
+                .doPrivileged((PrivilegedAction<Boolean>) () ->
+                        Boolean.getBoolean("glass.mac.metalLayer"));
+        // With the CAMetalLayer, whether presenting waits for the display refresh
+        @SuppressWarnings("removal")
+        boolean enableDisplaySync = AccessController
+                .doPrivileged((PrivilegedAction<Boolean>) () ->
+                        Boolean.parseBoolean(System.getProperty("glass.mac.displaySync", "true")));
+        _initIDs(disableSyncRendering, enableMetalLayer, enableDisplaySync);
     }
 
     native static int _getMacKey(int code);
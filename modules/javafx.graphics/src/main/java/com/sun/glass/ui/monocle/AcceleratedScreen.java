@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -148,6 +148,18 @@ public class AcceleratedScreen {
         }
     }
 
+    /** Set the minimum number of vertical refreshes between buffer swaps of
+     * the current EGL drawing surface. Screens that do not render through
+     * this class's EGL context ignore it.
+     *
+     * @param interval 0 to swap without waiting for vsync
+     */
+    public void setSwapInterval(int interval) {
+        if (egl != null) {
+            egl.eglSwapInterval(eglDisplay, interval);
+        }
+    }
+
     /** Load any native libraries needed to instantiate and initialize the
      * native drawing surface and rendering context
      * @return success or failure
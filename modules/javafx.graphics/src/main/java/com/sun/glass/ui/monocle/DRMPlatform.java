@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.glass.ui.monocle;
+
+import com.sun.glass.utils.NativeLibLoader;
+import java.security.AccessController;
+import java.security.PrivilegedAction;
+
+/**
+ * An {@code EGLPlatform} that drives the display directly with DRM/KMS and
+ * renders into GBM buffers, so it needs neither a vendor library nor a
+ * framebuffer device. Frames are shown with page flips on the primary plane.
+ * The overlay planes of the display can show buffers that were decoded
+ * elsewhere, such as video frames, without a copy.
+ */
+public class DRMPlatform extends EGLPlatform {
+
+    /**
+     * The DRM device used when {@code egl.displayid} is not set.
+     */
+    static final String DEFAULT_CARD = "/dev/dri/card0";
+
+    /**
+     * Creates a new {@code DRMPlatform} and opens the DRM device.
+     */
+    DRMPlatform() {
+        @SuppressWarnings("removal")
+        String card = AccessController.doPrivileged((PrivilegedAction<String>) () -> {
+            NativeLibLoader.loadLibrary("glass_monocle_drm");
+            return System.getProperty("egl.displayid", DEFAULT_CARD);
+        });
+        if (!nOpen(card)) {
+            throw new UnsupportedOperationException("Cannot use the display of " + card);
+        }
+    }
+
+    /**
+     * Gets the number of overlay planes that can be given buffers with
+     * {@link #setOverlayPlane setOverlayPlane}.
+     *
+     * @return the number of overlay planes, possibly zero
+     */
+    public int getOverlayPlaneCount() {
+        return nGetOverlayPlaneCount();
+    }
+
+    /**
+     * Shows a dma-buf on an overlay plane from the next frame on. The plane
+     * keeps its own reference to the buffer, so the caller can close the
+     * file descriptor once this method returns.
+     *
+     * @param plane the index of the overlay plane
+     * @param dmabufFd the file descriptor of the dma-buf
+     * @param fourcc the DRM format of the buffer
+     * @param width the width of the buffer in pixels
+     * @param height the height of the buffer in pixels
+     * @param stride the length of a row of the buffer in bytes
+     * @param x the x coordinate of the plane on the screen
+     * @param y the y coordinate of the plane on the screen
+     * @param w the width of the plane on the screen
+     * @param h the height of the plane on the screen
+     * @return {@code true} if the buffer could be imported
+     */
+    public boolean setOverlayPlane(int plane, int dmabufFd, int fourcc,
+                                   int width, int height, int stride,
+                                   int x, int y, int w, int h) {
+        return nSetOverlayPlane(plane, dmabufFd, fourcc, width, height, stride, x, y, w, h);
+    }
+
+    /**
+     * Hides an overlay plane from the next frame on.
+     *
+     * @param plane the index of the overlay plane
+     */
+    public void clearOverlayPlane(int plane) {
+        nClearOverlayPlane(plane);
+    }
+
+    private native boolean nOpen(String card);
+    private native int nGetOverlayPlaneCount();
+    private native boolean nSetOverlayPlane(int plane, int dmabufFd, int fourcc,
+                                            int width, int height, int stride,
+                                            int x, int y, int w, int h);
+    private native void nClearOverlayPlane(int plane);
+
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -236,6 +236,8 @@ class EGL {
 
     native boolean eglSwapBuffers(long eglDisplay, long eglSurface);
 
+    native boolean eglSwapInterval(long eglDisplay, int interval);
+
     /** Convert an EGL error code such as EGL_BAD_CONTEXT to a string
      * representation.
      * @param errorCode the EGL error code
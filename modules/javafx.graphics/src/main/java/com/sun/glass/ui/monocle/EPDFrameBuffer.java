@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,6 +34,8 @@ import com.sun.javafx.util.Logging;
 import java.io.IOException;
 import java.nio.ByteBuffer;
 import java.text.MessageFormat;
+import java.util.ArrayDeque;
+import java.util.Iterator;
 
 /**
  * Represents the standard Linux frame buffer device interface plus the custom
@@ -74,6 +76,38 @@ class EPDFrameBuffer {
      */
     private static final int ENOTTY = 25;
 
+    /**
+     * The maximum number of updates sent to the EPDC driver without waiting
+     * for any of them to complete. The device controller allows either 16 or
+     * 64 concurrent non-colliding updates, depending on the model.
+     */
+    private static final int MAX_PENDING_UPDATES = 16;
+
+    /**
+     * An update sent to the EPDC driver that may not have completed yet.
+     */
+    private static final class PendingUpdate {
+
+        final int marker;
+        final int x;
+        final int y;
+        final int width;
+        final int height;
+
+        PendingUpdate(int marker, int x, int y, int width, int height) {
+            this.marker = marker;
+            this.x = x;
+            this.y = y;
+            this.width = width;
+            this.height = height;
+        }
+
+        boolean intersects(int x, int y, int width, int height) {
+            return x < this.x + this.width && this.x < x + width
+                    && y < this.y + this.height && this.y < y + height;
+        }
+    }
+
     private final PlatformLogger logger = Logging.getJavaFXLogger();
     private final EPDSettings settings;
     private final LinuxSystem system;
@@ -92,6 +126,8 @@ class EPDFrameBuffer {
     private final MxcfbUpdateData updateData;
     private final MxcfbUpdateData syncUpdate;
 
+    private final ArrayDeque<PendingUpdate> pendingUpdates = new ArrayDeque<>();
+
     private int updateMarker;
     private int lastMarker;
 
@@ -550,18 +586,88 @@ class EPDFrameBuffer {
     }
 
     /**
-     * Sends the updated contents of the Linux frame buffer to the EPDC driver,
-     * optionally synchronizing with the driver by first waiting for the
-     * previous update to complete.
+     * Selects the waveform mode for an update. When the waveform mode setting
+     * is {@link EPDSystem#WAVEFORM_MODE_AUTO}, changes to and from pure black
+     * and white use the fast {@link EPDSystem#WAVEFORM_MODE_A2} mode, changes
+     * only to black and white use {@link EPDSystem#WAVEFORM_MODE_DU}, and the
+     * driver selects the mode for any other change, such as images with levels
+     * of gray. Otherwise, the waveform mode setting is used for all updates.
+     *
+     * @implNote A partial update drives only the pixels that change, so the
+     * A2 mode is safe whenever both the old and new values of the changed
+     * pixels are black or white.
+     *
+     * @param monochrome {@code true} if all changed pixels are now black or
+     * white; otherwise {@code false}
+     * @param wasMonochrome {@code true} if all changed pixels were black or
+     * white before the change; otherwise {@code false}
+     * @return the waveform mode for the update
+     */
+    private int selectWaveformMode(boolean monochrome, boolean wasMonochrome) {
+        if (settings.waveformMode != EPDSystem.WAVEFORM_MODE_AUTO || !monochrome) {
+            return settings.waveformMode;
+        }
+        return wasMonochrome ? EPDSystem.WAVEFORM_MODE_A2 : EPDSystem.WAVEFORM_MODE_DU;
+    }
+
+    /**
+     * Waits for the pending updates that collide with the given region to
+     * complete, and for the oldest pending updates while there are too many
+     * of them. Updates that do not collide run concurrently in the driver.
+     *
+     * @param x the x-coordinate of the region
+     * @param y the y-coordinate of the region
+     * @param width the width of the region
+     * @param height the height of the region
+     */
+    private void waitForCollidingUpdates(int x, int y, int width, int height) {
+        while (pendingUpdates.size() >= MAX_PENDING_UPDATES) {
+            waitForUpdateComplete(pendingUpdates.removeFirst().marker);
+        }
+        Iterator<PendingUpdate> iterator = pendingUpdates.iterator();
+        while (iterator.hasNext()) {
+            PendingUpdate pending = iterator.next();
+            if (pending.intersects(x, y, width, height)) {
+                waitForUpdateComplete(pending.marker);
+                iterator.remove();
+            }
+        }
+    }
+
+    /**
+     * Sends the updated contents of a region of the Linux frame buffer to the
+     * EPDC driver as a partial update, optionally synchronizing with the driver
+     * by first waiting for the previous updates to the same region to
+     * complete.
      * <p>
      * <strong>This method is not thread safe</strong>, but it is invoked only
      * from the JavaFX Application Thread.</p>
+     *
+     * @param x the x-coordinate of the changed region
+     * @param y the y-coordinate of the changed region
+     * @param width the width of the changed region
+     * @param height the height of the changed region
+     * @param monochrome {@code true} if all changed pixels are now black or
+     * white; otherwise {@code false}
+     * @param wasMonochrome {@code true} if all changed pixels were black or
+     * white before the change; otherwise {@code false}
      */
-    void sync() {
+    void sync(int x, int y, int width, int height, boolean monochrome, boolean wasMonochrome) {
+        int left = Math.max(x, 0);
+        int top = Math.max(y, 0);
+        int right = Math.min(x + width, xres);
+        int bottom = Math.min(y + height, yres);
+        if (left >= right || top >= bottom) {
+            return;
+        }
+        if (!settings.noWait) {
+            waitForCollidingUpdates(left, top, right - left, bottom - top);
+        }
+        syncUpdate.setUpdateRegion(syncUpdate.p, top, left, right - left, bottom - top);
+        lastMarker = sendUpdate(syncUpdate, selectWaveformMode(monochrome, wasMonochrome));
         if (!settings.noWait) {
-            waitForUpdateComplete(lastMarker);
+            pendingUpdates.addLast(new PendingUpdate(lastMarker, left, top, right - left, bottom - top));
         }
-        lastMarker = sendUpdate(syncUpdate, settings.waveformMode);
     }
 
     /**
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@ import java.io.IOException;
 import java.nio.Buffer;
 import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
+import java.nio.IntBuffer;
 import java.nio.channels.FileChannel;
 import java.nio.file.FileSystems;
 import java.nio.file.Path;
@@ -84,6 +85,18 @@ class EPDScreen implements NativeScreen {
 
     private boolean isShutdown;
 
+    /*
+     * The bounds of the pixels changed since the last update, empty when
+     * changeRight is less than changeLeft, and whether all changed pixels
+     * are black or white after and before the change.
+     */
+    private int changeLeft;
+    private int changeTop;
+    private int changeRight;
+    private int changeBottom;
+    private boolean changeMonochrome;
+    private boolean changeWasMonochrome;
+
     /**
      * Creates a native screen for the electrophoretic display.
      *
@@ -142,6 +155,7 @@ class EPDScreen implements NativeScreen {
         buffer.order(ByteOrder.nativeOrder());
         pixels = new FramebufferY8(buffer, width, height, bitDepth, true);
         clearScreen();
+        resetChanges();
     }
 
     /**
@@ -179,6 +193,101 @@ class EPDScreen implements NativeScreen {
         }
     }
 
+    /**
+     * Empties the region of changed pixels.
+     */
+    private void resetChanges() {
+        changeLeft = width;
+        changeTop = height;
+        changeRight = -1;
+        changeBottom = -1;
+        changeMonochrome = true;
+        changeWasMonochrome = true;
+    }
+
+    /**
+     * Adds a rectangle of changed pixels to the region of the next update.
+     *
+     * @param left the x-coordinate of the first changed column
+     * @param top the y-coordinate of the first changed row
+     * @param right the x-coordinate of the last changed column
+     * @param bottom the y-coordinate of the last changed row
+     */
+    private void addChange(int left, int top, int right, int bottom) {
+        changeLeft = Math.min(changeLeft, left);
+        changeTop = Math.min(changeTop, top);
+        changeRight = Math.max(changeRight, right);
+        changeBottom = Math.max(changeBottom, bottom);
+    }
+
+    /**
+     * Checks whether a pixel is opaque black or white.
+     *
+     * @param pixel the pixel in the native 32-bit format
+     * @return {@code true} if the pixel is black or white; otherwise
+     * {@code false}
+     */
+    private static boolean isMonochrome(int pixel) {
+        return pixel == 0xFF000000 || pixel == 0xFFFFFFFF;
+    }
+
+    /**
+     * Adds the pixels changed by an upload to the region of the next update.
+     * The first upload of a frame that covers the whole screen replaces the
+     * pixels without blending, so its changes are found by comparing the new
+     * pixels with the ones they replace. Any other upload blends with the
+     * frame or clears the pixels around it, so its whole area is taken as
+     * changed, with pixels of any color.
+     *
+     * @param b the buffer of pixels being uploaded
+     * @param x the x-coordinate of the upload
+     * @param y the y-coordinate of the upload
+     * @param width the width of the upload
+     * @param height the height of the upload
+     * @param alpha the alpha value of the upload
+     */
+    private void accumulateChanges(Buffer b, int x, int y, int width, int height, float alpha) {
+        if (pixels.hasReceivedData() || x != 0 || y != 0
+                || width != this.width || height != this.height || alpha < 1.0f) {
+            if (pixels.hasReceivedData()) {
+                addChange(Math.max(x, 0), Math.max(y, 0),
+                        Math.min(x + width, this.width) - 1, Math.min(y + height, this.height) - 1);
+            } else {
+                addChange(0, 0, this.width - 1, this.height - 1);
+            }
+            changeMonochrome = false;
+            changeWasMonochrome = false;
+            return;
+        }
+        IntBuffer src = b instanceof IntBuffer
+                ? (IntBuffer) b
+                : ((ByteBuffer) b).duplicate().clear().order(ByteOrder.nativeOrder()).asIntBuffer();
+        IntBuffer dst = pixels.getBuffer().asIntBuffer();
+        for (int row = 0; row < height; row++) {
+            int offset = row * width;
+            int left = 0;
+            while (left < width && src.get(offset + left) == dst.get(offset + left)) {
+                left++;
+            }
+            if (left == width) {
+                continue;
+            }
+            int right = width - 1;
+            while (src.get(offset + right) == dst.get(offset + right)) {
+                right--;
+            }
+            addChange(left, row, right, row);
+            for (int col = left; col <= right && (changeMonochrome || changeWasMonochrome); col++) {
+                int newPixel = src.get(offset + col);
+                int oldPixel = dst.get(offset + col);
+                if (newPixel != oldPixel) {
+                    changeMonochrome &= isMonochrome(newPixel);
+                    changeWasMonochrome &= isMonochrome(oldPixel);
+                }
+            }
+        }
+    }
+
     /**
      * Clears the screen.
      */
@@ -233,15 +342,23 @@ class EPDScreen implements NativeScreen {
 
     @Override
     public synchronized void uploadPixels(Buffer b, int x, int y, int width, int height, float alpha) {
+        if (!isShutdown) {
+            accumulateChanges(b, x, y, width, height, alpha);
+        }
         pixels.composePixels(b, x, y, width, height, alpha);
     }
 
     @Override
     public synchronized void swapBuffers() {
         if (!isShutdown && pixels.hasReceivedData()) {
-            writeBuffer();
-            fbDevice.sync();
+            if (changeRight >= changeLeft) {
+                writeBuffer();
+                fbDevice.sync(changeLeft, changeTop,
+                        changeRight - changeLeft + 1, changeBottom - changeTop + 1,
+                        changeMonochrome, changeWasMonochrome);
+            }
             pixels.reset();
+            resetChanges();
         }
     }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -79,8 +79,8 @@ class EPDSettings {
     private static final String Y8_INVERTED = "monocle.epd.Y8Inverted";
 
     /**
-     * Indicates whether to wait for the previous update to complete before
-     * sending the next update: {@code true} to avoid waiting and send updates
+     * Indicates whether to wait for the previous updates to the same region to
+     * complete before sending the next update: {@code true} to avoid waiting and send updates
      * as quickly as possible; otherwise {@code false}. The default is
      * {@code false}.
      * <p>
@@ -101,9 +101,11 @@ class EPDSettings {
      * automatic selection of waveform mode based on the number of gray levels
      * in the update (AUTO). The default is 257.
      * <p>
-     * Automatic selection chooses one of 1 (DU), 2 (GC16), or 3 (GC4). If the
-     * waveform mode is set to 2 (GC16), it may be upgraded to a compatible but
-     * optimized mode internal to the driver, if available.</p>
+     * Automatic selection uses 4 (A2) for changes between black and white and
+     * 1 (DU) for changes to black and white. For any other change, the driver
+     * chooses one of 1 (DU), 2 (GC16), or 3 (GC4). If the waveform mode is set
+     * to 2 (GC16), it may be upgraded to a compatible but optimized mode
+     * internal to the driver, if available.</p>
      *
      * @implNote Corresponds to the {@code waveform_mode} field of
      * {@code mxcfb_update_data} in <i>linux/mxcfb.h</i>.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -157,7 +157,11 @@ class FBDevScreen implements NativeScreen {
             }
             bb.order(ByteOrder.nativeOrder());
             fb = new Framebuffer(bb, getWidth(), getHeight(), getDepth(), true);
-            fb.setStartAddress(linuxFB.getNextAddress());
+            if (mappedFB != null) {
+                // An off-screen buffer holds a single frame; the address in
+                // the device applies only when writing it out
+                fb.setStartAddress(linuxFB.getNextAddress());
+            }
         }
         return fb;
     }
@@ -233,9 +237,19 @@ class FBDevScreen implements NativeScreen {
             }
             fbdev.position(linuxFB.getNextAddress());
             getFramebuffer().write(fbdev);
+            if (linuxFB.isDoubleBuffer()) {
+                linuxFB.next();
+                if (!linuxFB.isTripleBuffer()) {
+                    linuxFB.vSync();
+                }
+            }
         } else if (linuxFB.isDoubleBuffer()) {
             linuxFB.next();
-            linuxFB.vSync();
+            // With a third buffer, the next frame is drawn into a buffer
+            // that is not being scanned out, so there is no need to wait
+            if (!linuxFB.isTripleBuffer()) {
+                linuxFB.vSync();
+            }
             getFramebuffer().setStartAddress(linuxFB.getNextAddress());
         }
     }
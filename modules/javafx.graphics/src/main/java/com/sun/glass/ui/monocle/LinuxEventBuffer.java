@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -124,6 +124,43 @@ class LinuxEventBuffer {
         return isSync;
     }
 
+    /**
+     * Adds a batch of raw Linux events to the buffer. Blocks if there is not
+     * enough space for all of them.
+     *
+     * @param events A ByteBuffer containing the events to be added, from its
+     *               position to its limit.
+     * @param lastSync The index in events after the last "SYN SYN_REPORT",
+     *                 or -1 if the batch does not contain one
+     * @return true if the batch contained "SYN SYN_REPORT", false otherwise
+     * @throws InterruptedException if our thread was interrupted while waiting
+     *                              for the buffer to empty.
+     */
+    synchronized boolean putFrames(ByteBuffer events, int lastSync) throws
+            InterruptedException {
+        while (bb.limit() - bb.position() < events.remaining()) {
+            if (MonocleSettings.settings.traceEventsVerbose) {
+                MonocleTrace.traceEvent(
+                        "Event buffer %s is full, waiting for some space to become available",
+                        bb);
+            }
+            wait();
+        }
+        int start = bb.position();
+        if (lastSync >= 0) {
+            positionOfLastSync = start + lastSync - events.position()
+                    - eventStruct.getSize();
+        }
+        bb.put(events);
+        if (MonocleSettings.settings.traceEventsVerbose) {
+            for (int index = start; index < bb.position(); index += eventStruct.getSize()) {
+                MonocleTrace.traceEvent("Read %s [index=%d]",
+                                        getEventDescription(index), index);
+            }
+        }
+        return lastSync >= 0;
+    }
+
     synchronized void startIteration() {
         currentPosition = 0;
         mark = 0;
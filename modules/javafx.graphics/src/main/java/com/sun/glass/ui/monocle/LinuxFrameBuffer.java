@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,9 +38,10 @@ class LinuxFrameBuffer {
     private int bitDepth;
     private int byteDepth;
     private int offsetX, offsetY;
-    private int offsetY1, offsetY2;
+    private int offsetY1, offsetY2, offsetY3;
     private int offsetX1, offsetX2;
-    private int state; // 0 = single buffer, 1 = showing buf 1, 2 = showing buf 2
+    private int state; // 0 = single buffer, 1 = showing buf 1, 2 = showing buf 2, 3 = showing buf 3
+    private int bufferCount;
     private int FBIO_WAITFORVSYNC;
 
 
@@ -64,7 +65,17 @@ class LinuxFrameBuffer {
         int virtualHeight = screenInfo.getYResVirtual(screenInfo.p);
         offsetX = screenInfo.getOffsetX(screenInfo.p);
         offsetY = screenInfo.getOffsetY(screenInfo.p);
-        if (virtualHeight >= height * 2) {
+        bufferCount = 1;
+        if (virtualHeight >= height * 3 && offsetY == 0) {
+            // A third buffer lets us draw the next frame while the previous
+            // one waits for the vertical blank to be shown
+            offsetY1 = 0;
+            offsetY2 = height;
+            offsetY3 = height * 2;
+            offsetX1 = offsetX2 = offsetX;
+            state = 1;
+            bufferCount = 3;
+        } else if (virtualHeight >= height * 2) {
             if (offsetY >= height) {
                 offsetY1 = offsetY;
                 offsetY2 = 0;
@@ -77,6 +88,7 @@ class LinuxFrameBuffer {
             }
             offsetX1 = offsetX2 = offsetX;
             state = 1;
+            bufferCount = 2;
         } else if (virtualWidth >= width * 2) {
             if (offsetX >= width) {
                 offsetX1 = offsetX;
@@ -90,6 +102,7 @@ class LinuxFrameBuffer {
             }
             offsetY1 = offsetY2 = offsetY;
             state = 1;
+            bufferCount = 2;
         }
     }
 
@@ -107,12 +120,18 @@ class LinuxFrameBuffer {
         return (nativeOffsetY * width) * byteDepth;
     }
 
+    private int getNextBuffer() {
+        return state == 0 ? 0 : state % bufferCount + 1;
+    }
+
     int getNextAddress() {
-        switch (state) {
+        switch (getNextBuffer()) {
             case 1:
-                return (offsetX2 + offsetY2 * width) * byteDepth;
-            case 2:
                 return (offsetX1 + offsetY1 * width) * byteDepth;
+            case 2:
+                return (offsetX2 + offsetY2 * width) * byteDepth;
+            case 3:
+                return (offsetX1 + offsetY3 * width) * byteDepth;
             default:
                 return (offsetX + offsetY * width) * byteDepth;
         }
@@ -121,9 +140,13 @@ class LinuxFrameBuffer {
     void next() throws IOException {
         if (state != 0) {
             int newOffsetX, newOffsetY;
-            if (state == 1) {
+            int nextBuffer = getNextBuffer();
+            if (nextBuffer == 2) {
                 newOffsetX = offsetX2;
                 newOffsetY = offsetY2;
+            } else if (nextBuffer == 3) {
+                newOffsetX = offsetX1;
+                newOffsetY = offsetY3;
             } else {
                 newOffsetX = offsetX1;
                 newOffsetY = offsetY1;
@@ -137,7 +160,7 @@ class LinuxFrameBuffer {
             } else {
                 offsetX = newOffsetX;
                 offsetY = newOffsetY;
-                state = 3 - state;
+                state = nextBuffer;
             }
         }
     }
@@ -171,6 +194,15 @@ class LinuxFrameBuffer {
         return state > 0;
     }
 
+    /**
+     * Returns whether there is a buffer other than the one being shown and
+     * the one just panned to, so the next frame can be drawn without waiting
+     * for the vertical blank.
+     */
+    boolean isTripleBuffer() {
+        return state > 0 && bufferCount == 3;
+    }
+
     int getWidth() {
         return width;
     }
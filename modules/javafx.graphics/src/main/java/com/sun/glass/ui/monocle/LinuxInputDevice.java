@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -50,6 +50,12 @@ import java.util.Map;
  */
 class LinuxInputDevice implements Runnable, InputDevice {
 
+    /**
+     * The maximum number of event lines read from a device node at a time.
+     * A frame of a ten finger multitouch panel fits.
+     */
+    private static final int EVENT_BATCH_SIZE = 128;
+
     private LinuxInputProcessor inputProcessor;
     private ReadableByteChannel in;
     private long fd = -1;
@@ -59,6 +65,8 @@ class LinuxInputDevice implements Runnable, InputDevice {
     private Map<Integer, LinuxAbsoluteInputCapabilities> absCaps;
     private Map<String, String> udevManifest;
     private final ByteBuffer event;
+    private ByteBuffer events;
+    private final int[] lastSync = new int[1];
     private RunnableProcessor runnableProcessor;
     private EventProcessor processor = new EventProcessor();
     private final LinuxEventBuffer buffer;
@@ -92,6 +100,7 @@ class LinuxInputDevice implements Runnable, InputDevice {
         // attempt to grab the device. If the grab fails, keep going.
         int EVIOCGRAB = system.IOW('E', 0x90, 4);
         system.ioctl(fd, EVIOCGRAB, 1);
+        this.events = ByteBuffer.allocateDirect(buffer.getEventSize() * EVENT_BATCH_SIZE);
         this.runnableProcessor = NativePlatformFactory.getNativePlatform()
                 .getRunnableProcessor();
         this.uevent = SysFS.readUEvent(sysPath);
@@ -126,6 +135,25 @@ class LinuxInputDevice implements Runnable, InputDevice {
         this.inputProcessor = inputProcessor;
     }
 
+    /**
+     * Reads whole frames of events from the device node into the event
+     * buffer, with one native call for all of them.
+     */
+    private void readFramesToEventBuffer() throws IOException, InterruptedException {
+        int position = (int) system.readInputFrames(fd, events, 0, events.capacity(), lastSync);
+        if (position == -1) {
+            throw new IOException(system.getErrorMessage() + " on " + devNode);
+        }
+        events.limit(position);
+        synchronized (buffer) {
+            if (buffer.putFrames(events, lastSync[0]) && !processor.scheduled) {
+                runnableProcessor.invokeLater(processor);
+                processor.scheduled = true;
+            }
+        }
+        events.clear();
+    }
+
     private void readToEventBuffer() throws IOException {
         if (in != null) {
             in.read(event);
@@ -148,6 +176,11 @@ class LinuxInputDevice implements Runnable, InputDevice {
         }
         while (true) {
             try {
+                if (events != null) {
+                    readFramesToEventBuffer();
+                    continue;
+                }
+                // simulated devices write one event line at a time
                 readToEventBuffer();
                 if (event.position() == event.limit()) {
                     event.flip();
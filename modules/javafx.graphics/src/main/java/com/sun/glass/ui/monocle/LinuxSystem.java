@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -121,6 +121,25 @@ class LinuxSystem {
      */
     native long read(long fd, ByteBuffer buf, int position, int limit);
 
+    /**
+     * Reads Linux input events from an input device node. Events are read
+     * in batches until at least one complete event, terminated by
+     * "EV_SYN SYN_REPORT 0", is in the buffer or the buffer is full, so that
+     * every call delivers whole frames of events. The position and limit
+     * set on the ByteBuffer are ignored; the position and limit provided as
+     * method parameters are used instead.
+     * @param fd The file descriptor of the input device
+     * @param buf The buffer to which to write events
+     * @param position The index in buf to which to being reading events
+     * @param limit The index in buf up to which to read events
+     * @param lastSync Receives the index in buf after the last
+     *                 "EV_SYN SYN_REPORT 0" that was read, or -1 if there
+     *                 was none
+     * @return The new position in buf, or -1 on failure
+     */
+    native long readInputFrames(long fd, ByteBuffer buf, int position, int limit,
+                                int[] lastSync);
+
     static final int SEEK_SET = 0;
 
     /**
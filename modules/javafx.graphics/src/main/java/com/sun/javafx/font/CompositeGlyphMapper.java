@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,7 +25,8 @@
 
 package com.sun.javafx.font;
 
-import java.util.HashMap;
+import java.util.Arrays;
+import java.util.concurrent.ConcurrentHashMap;
 
 public class CompositeGlyphMapper extends CharToGlyphMapper {
 
@@ -41,39 +42,47 @@ public class CompositeGlyphMapper extends CharToGlyphMapper {
     private static final int ASCII_COUNT =
             SIMPLE_ASCII_MASK_END - SIMPLE_ASCII_MASK_START + 1;
 
-    private boolean asciiCacheOK;
-    private char charToGlyph[]; // Quick lookup
+    /* The mapper is also used by the TextLayoutPreparer threads. The
+     * arrays below are never modified once published, a thread that
+     * needs a change publishes a new array.
+     */
+    private volatile boolean asciiCacheOK;
+    private volatile char charToGlyph[]; // Quick lookup
 
     CompositeFontResource font;
-    CharToGlyphMapper slotMappers[];
+    volatile CharToGlyphMapper slotMappers[];
 
     /* For now, we'll use a Map to store the char->glyph lookup result.
      * Maybe later I could use arrays for "common" values and
      * perhaps for less common values, just not cache at all if
      * lookup is relatively inexpensive. Or let the slot fonts do
      * the caching ? So a variety of strategies are possible.
+     * The map is concurrent as text is also laid out on the
+     * TextLayoutPreparer threads.
      */
-    HashMap<Integer, Integer> glyphMap;
+    ConcurrentHashMap<Integer, Integer> glyphMap;
 
     public CompositeGlyphMapper(CompositeFontResource compFont) {
         font = compFont;
         missingGlyph = 0; // TrueType font standard, avoids lookup.
-        glyphMap = new HashMap<>();
+        glyphMap = new ConcurrentHashMap<>();
         slotMappers = new CharToGlyphMapper[compFont.getNumSlots()];
         asciiCacheOK = true;
     }
 
     private final CharToGlyphMapper getSlotMapper(int slot) {
-        if (slot >= slotMappers.length) {
-            CharToGlyphMapper[] tmp = new CharToGlyphMapper[font.getNumSlots()];
-            System.arraycopy(slotMappers, 0, tmp, 0, slotMappers.length);
-            slotMappers = tmp;
-        }
-        CharToGlyphMapper mapper = slotMappers[slot];
-        if (mapper == null) {
-            mapper = font.getSlotResource(slot).getGlyphMapper();
-            slotMappers[slot] = mapper;
+        CharToGlyphMapper[] mappers = slotMappers;
+        if (slot < mappers.length && mappers[slot] != null) {
+            return mappers[slot];
         }
+        /* Threads racing here both look the mapper up, and one of the
+         * copies may be lost. It is looked up again on the next call.
+         */
+        CharToGlyphMapper mapper = font.getSlotResource(slot).getGlyphMapper();
+        mappers = Arrays.copyOf(mappers,
+                Math.max(mappers.length, font.getNumSlots()));
+        mappers[slot] = mapper;
+        slotMappers = mappers;
         return mapper;
     }
 
@@ -117,8 +126,9 @@ public class CompositeGlyphMapper extends CharToGlyphMapper {
         }
 
         // Construct charToGlyph array of all ASCII characters
-        if (charToGlyph == null) {
-            char glyphCodes[] = new char[ASCII_COUNT];
+        char glyphCodes[] = charToGlyph;
+        if (glyphCodes == null) {
+            glyphCodes = new char[ASCII_COUNT];
             CharToGlyphMapper mapper = getSlotMapper(0);
             int missingGlyphCode = mapper.getMissingGlyphCode();
             for (int i = 0; i < ASCII_COUNT; i++) {
@@ -126,7 +136,6 @@ public class CompositeGlyphMapper extends CharToGlyphMapper {
                 if (glyphCode == missingGlyphCode) {
                     // If any glyphCode is missing, then do not use charToGlyph
                     // array.
-                    charToGlyph = null;
                     asciiCacheOK = false;
                     return -1;
                 }
@@ -137,7 +146,7 @@ public class CompositeGlyphMapper extends CharToGlyphMapper {
         }
 
         int index = charCode - SIMPLE_ASCII_MASK_START;
-        return charToGlyph[index];
+        return glyphCodes[index];
     }
 
     @Override
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -174,6 +174,45 @@ public class CompositeStrike implements FontStrike {
         return getStrikeSlot(slot).getGlyph(slotglyphCode);
     }
 
+    @Override
+    public void prepareGlyphs(int[] glyphCodes, int[] subPixels, int count) {
+        prepareGlyphs(glyphCodes, subPixels, count, false);
+    }
+
+    @Override
+    public void prefetchGlyphs(int[] glyphCodes, int[] subPixels, int count) {
+        /* The slot strikes are resolved here, on the calling thread */
+        prepareGlyphs(glyphCodes, subPixels, count, true);
+    }
+
+    private void prepareGlyphs(int[] glyphCodes, int[] subPixels, int count,
+                               boolean prefetch) {
+        int[] slotGlyphCodes = new int[count];
+        int[] slotSubPixels = new int[count];
+        boolean[] done = new boolean[count];
+        for (int i = 0; i < count; i++) {
+            if (done[i]) continue;
+            int slot = glyphCodes[i] >>> 24;
+            int slotCount = 0;
+            for (int j = i; j < count; j++) {
+                if (!done[j] && (glyphCodes[j] >>> 24) == slot) {
+                    done[j] = true;
+                    slotGlyphCodes[slotCount] = glyphCodes[j] & CompositeGlyphMapper.GLYPHMASK;
+                    slotSubPixels[slotCount++] = subPixels[j];
+                }
+            }
+            FontStrike strike = getStrikeSlot(slot);
+            if (strike == null) {
+                continue;
+            }
+            if (prefetch) {
+                strike.prefetchGlyphs(slotGlyphCodes, slotSubPixels, slotCount);
+            } else {
+                strike.prepareGlyphs(slotGlyphCodes, slotSubPixels, slotCount);
+            }
+        }
+    }
+
      /**
      * Access to individual character advances are frequently needed for layout
      * understand that advance may vary for single glyph if ligatures or kerning
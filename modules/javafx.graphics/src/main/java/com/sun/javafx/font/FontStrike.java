@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,6 +48,20 @@ public interface FontStrike {
     public Glyph getGlyph(char symbol);
     public Glyph getGlyph(int glyphCode);
     public void clearDesc(); // for cache management.
+
+    /**
+     * Hints that the glyphs will be rendered soon, so that a strike that
+     * can rasterize many glyphs at once does so. {@code subPixels} holds the
+     * position of each glyph as returned by getQuantizedPosition().
+     */
+    public default void prepareGlyphs(int[] glyphCodes, int[] subPixels, int count) {}
+
+    /**
+     * Hints that the glyphs will be rendered later, so that a strike that can
+     * rasterize glyphs off the render thread starts doing so with the
+     * {@link GlyphRasterizer}. The arguments are the same as prepareGlyphs().
+     */
+    public default void prefetchGlyphs(int[] glyphCodes, int[] subPixels, int count) {}
     public int getAAMode();
 
     /* These are all user space values */
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.font;
+
+import java.security.AccessController;
+import java.security.PrivilegedAction;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.ThreadFactory;
+import java.util.concurrent.atomic.AtomicInteger;
+
+/**
+ * Creates the pools of daemon threads that prepare text ahead of the FX and
+ * render threads, see GlyphRasterizer and TextLayoutPreparer.
+ */
+public final class FontThreadPool {
+
+    private FontThreadPool() {
+    }
+
+    /**
+     * Returns the number of threads set by the property, by default up to
+     * two threads but leaving one processor alone. Called by
+     * PrismFontFactory with the privileges to read the property.
+     */
+    static int getThreadCount(String property) {
+        int threads = Math.min(2, Runtime.getRuntime().availableProcessors() - 1);
+        String s = System.getProperty(property);
+        if (s != null) {
+            try {
+                threads = Integer.parseInt(s);
+            } catch (NumberFormatException nfe) {
+                System.err.println("Cannot parse " + property + " '" + s + "'");
+            }
+        }
+        return Math.max(0, threads);
+    }
+
+    /**
+     * Returns a pool of the given number of daemon threads, or null if
+     * the number is 0.
+     */
+    public static ExecutorService create(String name, int threads) {
+        if (threads <= 0) {
+            return null;
+        }
+        AtomicInteger threadCount = new AtomicInteger();
+        ThreadFactory factory = r -> {
+            @SuppressWarnings("removal")
+            Thread t = AccessController.doPrivileged((PrivilegedAction<Thread>) () -> {
+                Thread th = new Thread(r, name + " " + threadCount.getAndIncrement());
+                th.setContextClassLoader(null);
+                th.setDaemon(true);
+                return th;
+            });
+            return t;
+        };
+        return Executors.newFixedThreadPool(threads, factory);
+    }
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.font;
+
+import java.util.Arrays;
+import java.util.concurrent.ExecutorService;
+
+/**
+ * Rasterizes glyphs on background threads ahead of rendering, so that the
+ * glyph cache finds most of them ready instead of rasterizing them one by one
+ * on the render thread. The strikes synchronize their native rasterizers on
+ * the face they render, so the glyphs of different faces are rasterized
+ * concurrently. The number of threads is set by the
+ * "prism.glyphRasterizerThreads" property, 0 disables the rasterizer.
+ */
+public final class GlyphRasterizer {
+
+    private static final ExecutorService executor = FontThreadPool.create(
+            "Prism Glyph Rasterizer", PrismFontFactory.glyphRasterizerThreads);
+
+    private GlyphRasterizer() {
+    }
+
+    public static boolean isEnabled() {
+        return executor != null;
+    }
+
+    /**
+     * Queues the glyphs to be prepared by {@link FontStrike#prepareGlyphs}
+     * on a rasterizer thread. The arrays are copied.
+     */
+    public static void submit(FontStrike strike, int[] glyphCodes, int[] subPixels, int count) {
+        if (executor == null || count == 0) {
+            return;
+        }
+        int[] codes = Arrays.copyOf(glyphCodes, count);
+        int[] positions = Arrays.copyOf(subPixels, count);
+        executor.execute(() -> {
+            try {
+                strike.prepareGlyphs(codes, positions, count);
+            } catch (RuntimeException e) {
+                if (PrismFontFactory.debugFonts) {
+                    e.printStackTrace();
+                }
+            }
+        });
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -56,6 +56,8 @@ public abstract class PrismFontFactory implements FontFactory {
     public static final boolean isAndroid;
     public static final boolean isEmbedded;
     public static final int cacheLayoutSize;
+    public static final int glyphRasterizerThreads;
+    public static final int textLayoutThreads;
     private static int subPixelMode;
     public static final int SUB_PIXEL_ON = 1;
     public static final int SUB_PIXEL_Y = 2;
@@ -90,6 +92,8 @@ public abstract class PrismFontFactory implements FontFactory {
         isAndroid = PlatformUtil.isAndroid();
         isEmbedded = PlatformUtil.isEmbedded();
         int[] tempCacheLayoutSize = {0x10000};
+        int[] tempGlyphRasterizerThreads = {0};
+        int[] tempTextLayoutThreads = {0};
 
         @SuppressWarnings("removal")
         boolean tmp = AccessController.doPrivileged(
@@ -149,11 +153,18 @@ public abstract class PrismFontFactory implements FontFactory {
                         }
                     }
 
+                    tempGlyphRasterizerThreads[0] =
+                            FontThreadPool.getThreadCount("prism.glyphRasterizerThreads");
+                    tempTextLayoutThreads[0] =
+                            FontThreadPool.getThreadCount("prism.textLayoutThreads");
+
                     return debug;
                 }
         );
         debugFonts = tmp;
         cacheLayoutSize = tempCacheLayoutSize[0];
+        glyphRasterizerThreads = tempGlyphRasterizerThreads[0];
+        textLayoutThreads = tempTextLayoutThreads[0];
     }
 
     private static String getJDKFontDir() {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -176,16 +176,31 @@ public abstract class PrismFontStrike<T extends PrismFontFile> implements FontSt
 
     @Override
     public Glyph getGlyph(int glyphCode) {
-        Glyph glyph = glyphMap.get(glyphCode);
-        if (glyph == null) {
-            glyph = createGlyph(glyphCode);
-            glyphMap.put(glyphCode, glyph);
+        /* Glyphs are also looked up by the GlyphRasterizer threads */
+        synchronized (glyphMap) {
+            Glyph glyph = glyphMap.get(glyphCode);
+            if (glyph == null) {
+                glyph = createGlyph(glyphCode);
+                glyphMap.put(glyphCode, glyph);
+            }
+            return glyph;
         }
-        return glyph;
     }
 
     protected abstract Path2D createGlyphOutline(int glyphCode);
 
+    /**
+     * Creates the outlines of several glyphs. Strikes that can do it in bulk
+     * override this method.
+     */
+    protected Path2D[] createGlyphOutlines(int[] glyphCodes, int count) {
+        Path2D[] outlines = new Path2D[count];
+        for (int i = 0; i < count; i++) {
+            outlines[i] = createGlyphOutline(glyphCodes[i]);
+        }
+        return outlines;
+    }
+
     @Override
     public Shape getOutline(GlyphList gl, BaseTransform transform) {
         Path2D result = new Path2D();
@@ -201,11 +216,21 @@ public abstract class PrismFontStrike<T extends PrismFontFile> implements FontSt
         if (transform == null) {
             transform = BaseTransform.IDENTITY_TRANSFORM;
         }
+        int len = gl.getGlyphCount();
+        int[] glyphCodes = new int[len];
+        int count = 0;
+        for (int i = 0; i < len; i++) {
+            int glyphCode = gl.getGlyphCode(i);
+            if (glyphCode != CharToGlyphMapper.INVISIBLE_GLYPH_ID) {
+                glyphCodes[count++] = glyphCode;
+            }
+        }
+        Path2D[] outlines = createGlyphOutlines(glyphCodes, count);
         Affine2D t = new Affine2D();
-        for (int i = 0; i < gl.getGlyphCount(); i++) {
+        for (int i = 0, j = 0; i < len; i++) {
             int glyphCode = gl.getGlyphCode(i);
             if (glyphCode != CharToGlyphMapper.INVISIBLE_GLYPH_ID) {
-                Shape gp = createGlyphOutline(glyphCode);
+                Shape gp = outlines[j++];
                 if (gp != null) {
                     t.setTransform(transform);
                     t.translate(gl.getPosX(i), gl.getPosY(i));
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@ import com.sun.javafx.font.DisposerRecord;
 import com.sun.javafx.font.FontResource;
 import com.sun.javafx.font.FontStrikeDesc;
 import com.sun.javafx.font.Glyph;
+import com.sun.javafx.font.GlyphRasterizer;
 import com.sun.javafx.font.PrismFontFactory;
 import com.sun.javafx.font.PrismFontStrike;
 import com.sun.javafx.geom.Path2D;
@@ -130,6 +131,42 @@ class DWFontStrike extends PrismFontStrike<DWFontFile> {
         return fontResource.getGlyphOutline(glyphCode, getSize());
     }
 
+    /*
+     * Synchronized as it runs on the render thread and on the GlyphRasterizer
+     * threads, DWGlyph.getPixelData() uses the same lock.
+     */
+    @Override
+    public synchronized void prepareGlyphs(int[] glyphCodes, int[] subPixels, int count) {
+        if (drawShapes) return;
+        DWGlyph[] glyphs = new DWGlyph[count];
+        int[] glyphSubPixels = new int[count];
+        int pending = 0;
+        for (int i = 0; i < count; i++) {
+            DWGlyph glyph = (DWGlyph)getGlyph(glyphCodes[i]);
+            if (glyph.queueMask(subPixels[i])) {
+                glyphSubPixels[pending] = subPixels[i];
+                glyphs[pending++] = glyph;
+            }
+        }
+        for (int i = 0; i < pending; i++) {
+            glyphs[i].clearQueuedMasks();
+        }
+        if (pending > 1) {
+            DWGlyph.initMasks(this, glyphs, glyphSubPixels, pending);
+        }
+    }
+
+    /*
+     * Only LCD masks are created off the render thread, by the free threaded
+     * DirectWrite factory. Grayscale masks are drawn by D2D and WIC, whose
+     * single threaded factories belong to the render thread.
+     */
+    @Override
+    public void prefetchGlyphs(int[] glyphCodes, int[] subPixels, int count) {
+        if (drawShapes || getAAMode() != FontResource.AA_LCD) return;
+        GlyphRasterizer.submit(this, glyphCodes, subPixels, count);
+    }
+
     @Override protected Glyph createGlyph(int glyphCode) {
         return new DWGlyph(this, glyphCode, drawShapes);
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@ import com.sun.javafx.font.PrismFontFactory;
 import com.sun.javafx.geom.Point2D;
 import com.sun.javafx.geom.RectBounds;
 import com.sun.javafx.geom.Shape;
+import java.nio.ByteBuffer;
 
 public class DWGlyph implements Glyph {
     private DWFontStrike strike;
@@ -41,6 +42,7 @@ public class DWGlyph implements Glyph {
     private boolean drawShapes;
     private byte[][] pixelData;
     private RECT[] rects;
+    private int queuedMasks; /* used by DWFontStrike.prepareGlyphs() */
 
     private static final boolean CACHE_TARGET = true;
     private static IWICBitmap cachedBitmap;
@@ -52,6 +54,11 @@ public class DWGlyph implements Glyph {
     private static D2D1_COLOR_F WHITE = new D2D1_COLOR_F(1f, 1f, 1f, 1f);
     private static D2D1_MATRIX_3X2_F D2D2_MATRIX_IDENTITY = new D2D1_MATRIX_3X2_F(1,0, 0,1, 0,0);
 
+    /* Size of the buffer glyph masks are rendered to by initMasks() */
+    private static final int MASK_BUFFER_SIZE = 256 * 1024;
+    private static final ThreadLocal<ByteBuffer> threadMaskBuffer =
+        ThreadLocal.withInitial(() -> ByteBuffer.allocateDirect(MASK_BUFFER_SIZE));
+
     public static final int SHORTMASK = 0x0000ffff;
 
     DWGlyph(DWFontStrike strike, int glyphCode, boolean drawShapes) {
@@ -257,38 +264,141 @@ public class DWGlyph implements Glyph {
         return result;
     }
 
+    private static int getRenderingMode() {
+        return DWFontStrike.SUBPIXEL_Y ?
+               OS.DWRITE_RENDERING_MODE_NATURAL_SYMMETRIC :
+               OS.DWRITE_RENDERING_MODE_NATURAL;
+    }
+
     IDWriteGlyphRunAnalysis createAnalysis(float x, float y) {
         if (run.fontFace == 0) return null;
         IDWriteFactory factory = DWFactory.getDWriteFactory();
-        int renderingMode = DWFontStrike.SUBPIXEL_Y ?
-                            OS.DWRITE_RENDERING_MODE_NATURAL_SYMMETRIC :
-                            OS.DWRITE_RENDERING_MODE_NATURAL;
+        int renderingMode = getRenderingMode();
         int measuringMode = OS.DWRITE_MEASURING_MODE_NATURAL;
         DWRITE_MATRIX matrix = strike.matrix; /* can be null */
         float dpi = 1;  /* Assumes WICBitmap has 96 dpi */
         return factory.CreateGlyphRunAnalysis(run, dpi, matrix, renderingMode, measuringMode, x, y);
     }
 
-    IWICBitmap getCachedBitmap() {
+    /**
+     * Returns true and marks the mask as queued if the mask for the
+     * subpixel position is neither rendered nor queued yet.
+     */
+    boolean queueMask(int subPixel) {
+        int bit = 1 << subPixel;
+        if (pixelData[subPixel] != null || (queuedMasks & bit) != 0) {
+            return false;
+        }
+        queuedMasks |= bit;
+        return true;
+    }
+
+    void clearQueuedMasks() {
+        queuedMasks = 0;
+    }
+
+    /**
+     * Renders the masks of several glyphs of a strike with as few native
+     * calls as possible. LCD masks are created by DirectWrite and grayscale
+     * masks are drawn by D2D, all the glyphs of a call sharing one bitmap.
+     * Masks that fail to render are left for getPixelData().
+     */
+    static void initMasks(DWFontStrike strike, DWGlyph[] glyphs,
+                          int[] subPixels, int count) {
+        IDWriteFontFace face = strike.getFontFace();
+        if (face == null) return;
+        boolean lcd = strike.getAAMode() == FontResource.AA_LCD;
+        int[] glyphIndices = new int[count];
+        float[] origins = new float[count * 2];
+        for (int i = 0; i < count; i++) {
+            glyphIndices[i] = glyphs[i].getGlyphCode();
+            origins[i * 2] = getSubPixelOffset(subPixels[i] % 3);
+            origins[i * 2 + 1] = getSubPixelOffset(subPixels[i] / 3);
+        }
+        int[] info = new int[count * OS.GLYPH_MASK_SIZE];
+        ByteBuffer maskBuffer = threadMaskBuffer.get();
+        IDWriteFactory factory = DWFactory.getDWriteFactory();
+        int renderingMode = getRenderingMode();
+        int measuringMode = OS.DWRITE_MEASURING_MODE_NATURAL;
+        int start = 0;
+        while (start < count) {
+            int done;
+            if (lcd) {
+                done = factory.CreateAlphaTextures(face, strike.getSize(),
+                                                   glyphIndices, origins,
+                                                   count - start, strike.matrix,
+                                                   renderingMode, measuringMode,
+                                                   OS.DWRITE_TEXTURE_CLEARTYPE_3x1,
+                                                   maskBuffer, info);
+            } else {
+                IWICBitmap bitmap = getCachedBitmap();
+                ID2D1RenderTarget target = getCachedRenderingTarget();
+                if (bitmap == null || target == null) break;
+                done = target.DrawGlyphMasks(bitmap, BITMAP_WIDTH, BITMAP_HEIGHT,
+                                             factory, face, strike.getSize(),
+                                             glyphIndices, origins,
+                                             count - start, strike.matrix,
+                                             renderingMode, measuringMode,
+                                             maskBuffer, info);
+                if (done < 0) {
+                    /* handling errors such as D2DERR_RECREATE_TARGET */
+                    bitmap.Release();
+                    cachedBitmap = null;
+                    target.Release();
+                    cachedTarget = null;
+                    if (PrismFontFactory.debugFonts) {
+                        System.err.println("Rendering failed=" + done);
+                    }
+                    break;
+                }
+            }
+            if (done == 0) break;
+            for (int i = 0; i < done; i++) {
+                int m = i * OS.GLYPH_MASK_SIZE;
+                int offset = info[m + OS.GLYPH_MASK_OFFSET];
+                if (offset < 0) continue;
+                RECT rect = new RECT();
+                rect.left = info[m + OS.GLYPH_MASK_LEFT];
+                rect.top = info[m + OS.GLYPH_MASK_TOP];
+                rect.right = info[m + OS.GLYPH_MASK_RIGHT];
+                rect.bottom = info[m + OS.GLYPH_MASK_BOTTOM];
+                int size = (rect.right - rect.left) * (rect.bottom - rect.top);
+                byte[] data = new byte[lcd ? size * 3 : size];
+                maskBuffer.get(offset, data);
+                DWGlyph glyph = glyphs[start + i];
+                int subPixel = subPixels[start + i];
+                /* getPixelData() selects the rect of the mask */
+                glyph.rects[subPixel] = rect;
+                glyph.pixelData[subPixel] = data;
+            }
+            start += done;
+            if (start < count) {
+                System.arraycopy(glyphIndices, start, glyphIndices, 0, count - start);
+                System.arraycopy(origins, start * 2, origins, 0, (count - start) * 2);
+            }
+        }
+    }
+
+    static IWICBitmap getCachedBitmap() {
         if (cachedBitmap == null) {
             cachedBitmap = createBitmap(BITMAP_WIDTH, BITMAP_HEIGHT);
         }
         return cachedBitmap;
     }
 
-    ID2D1RenderTarget getCachedRenderingTarget() {
+    static ID2D1RenderTarget getCachedRenderingTarget() {
         if (cachedTarget == null) {
             cachedTarget = createRenderingTarget(getCachedBitmap());
         }
         return cachedTarget;
     }
 
-    IWICBitmap createBitmap(int width, int height) {
+    static IWICBitmap createBitmap(int width, int height) {
         IWICImagingFactory factory = DWFactory.getWICFactory();
         return  factory.CreateBitmap(width, height, BITMAP_PIXEL_FORMAT, OS.WICBitmapCacheOnDemand);
     }
 
-    ID2D1RenderTarget createRenderingTarget(IWICBitmap bitmap) {
+    static ID2D1RenderTarget createRenderingTarget(IWICBitmap bitmap) {
         D2D1_RENDER_TARGET_PROPERTIES prop = new D2D1_RENDER_TARGET_PROPERTIES();
         /* All values set to defaults */
         prop.type = OS.D2D1_RENDER_TARGET_TYPE_DEFAULT;
@@ -332,30 +442,33 @@ public class DWGlyph implements Glyph {
 
     @Override
     public byte[] getPixelData(int subPixel) {
-        byte[] data = pixelData[subPixel];
-        /* Caching all possible masks has an important performance impact on the
-         * software pipeline (as it doesn't have a glyph cache).
-         * Note: The same cache is not implemented on CTGlyph.
+        /* The masks can be created by a GlyphRasterizer thread, see
+         * DWFontStrike.prepareGlyphs().
          */
-        if (data == null) {
-            float x = 0, y = 0;
-            int index = subPixel;
-            if (index >= 6) {
-                index -= 6;
-                y = 0.66f;
-            } else if (index >= 3) {
-                index -= 3;
-                y = 0.33f;
+        synchronized (strike) {
+            byte[] data = pixelData[subPixel];
+            /* Caching all possible masks has an important performance impact on the
+             * software pipeline (as it doesn't have a glyph cache).
+             * Note: The same cache is not implemented on CTGlyph.
+             */
+            if (data == null) {
+                float x = getSubPixelOffset(subPixel % 3);
+                float y = getSubPixelOffset(subPixel / 3);
+                pixelData[subPixel] = data = isLCDGlyph() ? getLCDMask(x, y) :
+                                                            getD2DMask(x, y, false);
+                rects[subPixel] = rect;
+            } else {
+                rect = rects[subPixel];
             }
-            if (index == 1) x = 0.33f;
-            if (index == 2) x = 0.66f;
-            pixelData[subPixel] = data = isLCDGlyph() ? getLCDMask(x, y) :
-                                                        getD2DMask(x, y, false);
-            rects[subPixel] = rect;
-        } else {
-            rect = rects[subPixel];
+            return data;
         }
-        return data;
+    }
+
+    /* The offset of the glyph origin for a subpixel index on one axis */
+    private static float getSubPixelOffset(int index) {
+        if (index == 2) return 0.66f;
+        if (index == 1) return 0.33f;
+        return 0;
     }
 
     @Override
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,8 @@
 
 package com.sun.javafx.font.directwrite;
 
+import java.nio.ByteBuffer;
+
 class ID2D1RenderTarget extends IUnknown {
     ID2D1RenderTarget(long ptr) {
         super(ptr);
@@ -58,4 +60,24 @@ class ID2D1RenderTarget extends IUnknown {
         long result = OS.CreateSolidColorBrush(ptr, color);
         return result != 0 ? new ID2D1Brush(result) : null;
     }
+
+    int DrawGlyphMasks(IWICBitmap bitmap,
+                       int bitmapWidth,
+                       int bitmapHeight,
+                       IDWriteFactory factory,
+                       IDWriteFontFace fontFace,
+                       float fontEmSize,
+                       int[] glyphIndices,
+                       float[] origins,
+                       int count,
+                       DWRITE_MATRIX transform,
+                       int renderingMode,
+                       int measuringMode,
+                       ByteBuffer buffer,
+                       int[] info) {
+        return OS.DrawGlyphMasks(ptr, bitmap.ptr, bitmapWidth, bitmapHeight,
+                                 factory.ptr, fontFace.ptr, fontEmSize,
+                                 glyphIndices, origins, count, transform,
+                                 renderingMode, measuringMode, buffer, info);
+    }
 }
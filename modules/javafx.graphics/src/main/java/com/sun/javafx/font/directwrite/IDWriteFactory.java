@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,8 @@
 
 package com.sun.javafx.font.directwrite;
 
+import java.nio.ByteBuffer;
+
 class IDWriteFactory extends IUnknown {
     IDWriteFactory(long ptr) {
         super(ptr);
@@ -92,6 +94,23 @@ class IDWriteFactory extends IUnknown {
         return result != 0 ? new IDWriteGlyphRunAnalysis(result) : null;
     }
 
+    int CreateAlphaTextures(IDWriteFontFace fontFace,
+                            float fontEmSize,
+                            int[] glyphIndices,
+                            float[] origins,
+                            int count,
+                            DWRITE_MATRIX transform,
+                            int renderingMode,
+                            int measuringMode,
+                            int textureType,
+                            ByteBuffer buffer,
+                            int[] info) {
+        return OS.CreateAlphaTextures(ptr, fontFace.ptr, fontEmSize,
+                                      glyphIndices, origins, count, transform,
+                                      renderingMode, measuringMode,
+                                      textureType, buffer, info);
+    }
+
     IDWriteFontFile CreateFontFileReference(String filePath) {
         long result = OS.CreateFontFileReference(ptr, (filePath+'\0').toCharArray());
         return result != 0 ? new IDWriteFontFile(result) : null;
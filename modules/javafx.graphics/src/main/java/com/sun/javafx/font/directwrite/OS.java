@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 
 package com.sun.javafx.font.directwrite;
 
+import java.nio.ByteBuffer;
 import java.security.AccessController;
 import java.security.PrivilegedAction;
 
@@ -161,6 +162,15 @@ class OS {
     static final int DWRITE_INFORMATIONAL_STRING_POSTSCRIPT_NAME = 17;
     static final int DWRITE_INFORMATIONAL_STRING_POSTSCRIPT_CID_NAME = 18;
 
+    /* The layout of the info written by CreateAlphaTextures() and
+     * DrawGlyphMasks(), per glyph */
+    static final int GLYPH_MASK_OFFSET = 0;
+    static final int GLYPH_MASK_LEFT = 1;
+    static final int GLYPH_MASK_TOP = 2;
+    static final int GLYPH_MASK_RIGHT = 3;
+    static final int GLYPH_MASK_BOTTOM = 4;
+    static final int GLYPH_MASK_SIZE = 5;
+
     /* Constructors */
     private static final native long _DWriteCreateFactory(int factoryType);
     static final IDWriteFactory DWriteCreateFactory(int factoryType) {
@@ -276,6 +286,29 @@ class OS {
                                                     int measuringMode,
                                                     float baselineOriginX,
                                                     float baselineOriginY);
+    /**
+     * Creates the alpha textures of many glyphs of a face with a single call,
+     * using one IDWriteGlyphRunAnalysis per glyph for both its bounds and its
+     * texture. Glyph i is placed at baseline origin {@code (origins[2*i],
+     * origins[2*i+1])}. Each texture is written to {@code buffer}, and its
+     * offset and bounds to {@code info} at {@code GLYPH_MASK_SIZE} ints per
+     * glyph. The offset of a glyph with no texture is -1.
+     *
+     * @return the number of glyphs done, less than {@code count} when
+     * {@code buffer} is full
+     */
+    static final native int CreateAlphaTextures(long ptr,
+                                                long fontFace,
+                                                float fontEmSize,
+                                                int[] glyphIndices,
+                                                float[] origins,
+                                                int count,
+                                                DWRITE_MATRIX transform,
+                                                int renderingMode,
+                                                int measuringMode,
+                                                int textureType,
+                                                ByteBuffer buffer,
+                                                int[] info);
     static final native long CreateTextAnalyzer(long ptr);
     static final native long CreateTextFormat(long ptr,
                                               char[] fontFamily,
@@ -369,4 +402,31 @@ class OS {
     static final native void SetTransform(long ptr, D2D1_MATRIX_3X2_F transform);
     static final native void DrawGlyphRun(long ptr, D2D1_POINT_2F baselineOrigin, DWRITE_GLYPH_RUN glyphRun, long foregroundBrush, int measuringMode);
     static final native long CreateSolidColorBrush(long ptr, D2D1_COLOR_F color);
+
+    /**
+     * Draws many glyphs of a face into a WIC bitmap with a single
+     * BeginDraw()/EndDraw() and reads back their grayscale masks. The bounds
+     * of every glyph are those computed by DWGlyph.checkBounds(), and glyph i
+     * is drawn shifted by {@code (origins[2*i], origins[2*i+1])}. The masks
+     * and {@code info} are written as by CreateAlphaTextures().
+     *
+     * @return the number of glyphs done, less than {@code count} when either
+     * the bitmap or {@code buffer} is full, or the failing HRESULT of
+     * EndDraw()
+     */
+    static final native int DrawGlyphMasks(long ptr,
+                                           long bitmap,
+                                           int bitmapWidth,
+                                           int bitmapHeight,
+                                           long factory,
+                                           long fontFace,
+                                           float fontEmSize,
+                                           int[] glyphIndices,
+                                           float[] origins,
+                                           int count,
+                                           DWRITE_MATRIX transform,
+                                           int renderingMode,
+                                           int measuringMode,
+                                           ByteBuffer buffer,
+                                           int[] info);
 }
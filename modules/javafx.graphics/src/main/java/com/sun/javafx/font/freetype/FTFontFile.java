@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,10 @@ import com.sun.javafx.font.PrismFontFile;
 import com.sun.javafx.font.PrismFontStrike;
 import com.sun.javafx.geom.Path2D;
 import com.sun.javafx.geom.transform.BaseTransform;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+import java.util.Arrays;
 
 class FTFontFile extends PrismFontFile {
     /*
@@ -47,6 +51,9 @@ class FTFontFile extends PrismFontFile {
      * This is enforced by converging all operation (from FTFontStrike and
      * FTGlyph) to this object and synchronizing the access to the native
      * resources using the same lock.
+     *
+     * Each thread has its own scratch buffer, so that the GlyphRasterizer
+     * threads render the glyphs of different faces concurrently.
      */
     private long library;
     private long face;
@@ -110,25 +117,75 @@ class FTFontFile extends PrismFontFile {
     }
 
     synchronized Path2D createGlyphOutline(int gc, float size) {
+        return createGlyphOutlines(new int[] {gc}, 1, size)[0];
+    }
+
+    /**
+     * Creates the outlines of several glyphs with one native call. The
+     * native code caches outlines, so a glyph is only decomposed once per
+     * size. A glyph that fails to load has a null outline.
+     */
+    synchronized Path2D[] createGlyphOutlines(int[] glyphCodes, int count, float size) {
+        Path2D[] outlines = new Path2D[count];
         int size26dot6 = (int)(size * 64);
-        OSFreetype.FT_Set_Char_Size(face, 0, size26dot6, 72, 72);
         int flags = OSFreetype.FT_LOAD_NO_HINTING | OSFreetype.FT_LOAD_NO_BITMAP | OSFreetype.FT_LOAD_IGNORE_TRANSFORM;
-        OSFreetype.FT_Load_Glyph(face, gc, flags);
-        return OSFreetype.FT_Outline_Decompose(face);
+        int[] codes = Arrays.copyOf(glyphCodes, count);
+        int[] info = new int[count * OSFreetype.OUTLINE_INFO_SIZE];
+        ByteBuffer paths = getScratchBuffer();
+        FloatBuffer coordsBuffer = paths.asFloatBuffer();
+        int start = 0;
+        while (start < count) {
+            int done = OSFreetype.decomposeOutlines(face, codes, count - start,
+                                                    size26dot6, flags, paths, info);
+            if (done == 0) {
+                /* The outline does not fit in the buffer, skip it */
+                done = 1;
+            }
+            for (int i = 0; i < done; i++) {
+                int m = i * OSFreetype.OUTLINE_INFO_SIZE;
+                int coordsOffset = info[m + OSFreetype.OUTLINE_INFO_COORDS_OFFSET];
+                if (coordsOffset < 0) continue;
+                int numCoords = info[m + OSFreetype.OUTLINE_INFO_NUM_COORDS];
+                int numTypes = info[m + OSFreetype.OUTLINE_INFO_NUM_TYPES];
+                float[] coords = new float[numCoords];
+                byte[] types = new byte[numTypes];
+                coordsBuffer.get(coordsOffset / Float.BYTES, coords);
+                paths.get(info[m + OSFreetype.OUTLINE_INFO_TYPES_OFFSET], types);
+                outlines[start + i] = new Path2D(0 /*winding rule*/,
+                                                 types, numTypes, coords, numCoords);
+            }
+            start += done;
+            if (start < count) {
+                System.arraycopy(codes, start, codes, 0, count - start);
+            }
+        }
+        return outlines;
     }
 
-    synchronized void initGlyph(FTGlyph glyph, FTFontStrike strike) {
-        float size = strike.getSize();
-        if (size == 0) {
-            glyph.buffer = new byte[0];
-            glyph.bitmap = new FT_Bitmap();
-            return;
-        }
-        int size26dot6 = (int)(size * 64);
-        OSFreetype.FT_Set_Char_Size(face, 0, size26dot6, 72, 72);
+    /*
+     * Size of the buffer glyphs are rendered to by initGlyphs() and outlines
+     * are written to by createGlyphOutlines(). It is shared by all faces used
+     * on a thread.
+     */
+    private static final int SCRATCH_BUFFER_SIZE = 256 * 1024;
+    private static final ThreadLocal<ByteBuffer> scratchBuffer =
+        ThreadLocal.withInitial(() -> {
+            ByteBuffer buffer = ByteBuffer.allocateDirect(SCRATCH_BUFFER_SIZE);
+            buffer.order(ByteOrder.nativeOrder());
+            return buffer;
+        });
 
-        boolean lcd = strike.getAAMode() == FontResource.AA_LCD &&
-                      FTFactory.LCD_SUPPORT;
+    private static ByteBuffer getScratchBuffer() {
+        return scratchBuffer.get();
+    }
+
+    /**
+     * Prepares the face for rendering glyphs of the strike and returns the
+     * load flags to use.
+     */
+    private int setupGlyphLoad(FTFontStrike strike) {
+        int size26dot6 = (int)(strike.getSize() * 64);
+        OSFreetype.FT_Set_Char_Size(face, 0, size26dot6, 72, 72);
 
         int flags = OSFreetype.FT_LOAD_RENDER | OSFreetype.FT_LOAD_NO_HINTING | OSFreetype.FT_LOAD_NO_BITMAP;
         FT_Matrix matrix = strike.matrix;
@@ -137,11 +194,30 @@ class FTFontFile extends PrismFontFile {
         } else {
             flags |= OSFreetype.FT_LOAD_IGNORE_TRANSFORM;
         }
-        if (lcd) {
+        if (isLCD(strike)) {
             flags |= OSFreetype.FT_LOAD_TARGET_LCD;
         } else {
             flags |= OSFreetype.FT_LOAD_TARGET_NORMAL;
         }
+        return flags;
+    }
+
+    private static boolean isLCD(FTFontStrike strike) {
+        return strike.getAAMode() == FontResource.AA_LCD &&
+               FTFactory.LCD_SUPPORT;
+    }
+
+    synchronized void initGlyph(FTGlyph glyph, FTFontStrike strike) {
+        /* A GlyphRasterizer thread may have rendered it meanwhile */
+        if (glyph.initialized) return;
+        float size = strike.getSize();
+        if (size == 0) {
+            glyph.buffer = new byte[0];
+            glyph.initialized = true;
+            return;
+        }
+        int flags = setupGlyphLoad(strike);
+        boolean lcd = isLCD(strike);
 
         int glyphCode = glyph.getGlyphCode();
         int error = OSFreetype.FT_Load_Glyph(face, glyphCode, flags);
@@ -198,12 +274,72 @@ class FTFontFile extends PrismFontFile {
         }
 
         glyph.buffer = buffer;
-        glyph.bitmap = bitmap;
+        glyph.width = width;
+        glyph.rows = height;
         glyph.bitmap_left = glyphRec.bitmap_left;
         glyph.bitmap_top = glyphRec.bitmap_top;
         glyph.advanceX = glyphRec.advance_x / 64f;    /* Fixed 26.6*/
         glyph.advanceY = glyphRec.advance_y / 64f;
         glyph.userAdvance = glyphRec.linearHoriAdvance / 65536.0f; /* Fixed 16.16 */
         glyph.lcd = lcd;
+        glyph.initialized = true;
+    }
+
+    /**
+     * Renders several glyphs of a strike with one native call, without the
+     * intermediate FT_GlyphSlotRec objects of initGlyph(). Glyphs that fail
+     * to render are left for initGlyph().
+     */
+    synchronized void initGlyphs(FTGlyph[] glyphs, int count, FTFontStrike strike) {
+        if (strike.getSize() == 0) return;
+        int pending = 0;
+        for (int i = 0; i < count; i++) {
+            if (!glyphs[i].initialized) {
+                glyphs[pending++] = glyphs[i];
+            }
+        }
+        count = pending;
+        if (count == 0) return;
+        int flags = setupGlyphLoad(strike);
+        boolean lcd = isLCD(strike);
+
+        int[] glyphCodes = new int[count];
+        for (int i = 0; i < count; i++) {
+            glyphCodes[i] = glyphs[i].getGlyphCode();
+        }
+        int[] metrics = new int[count * OSFreetype.GLYPH_METRICS_SIZE];
+        ByteBuffer rasterBuffer = getScratchBuffer();
+        int start = 0;
+        while (start < count) {
+            int done = OSFreetype.rasterizeGlyphs(face, glyphCodes, count - start,
+                                                  flags, rasterBuffer, metrics);
+            if (done == 0) break;
+            for (int i = 0; i < done; i++) {
+                int m = i * OSFreetype.GLYPH_METRICS_SIZE;
+                int offset = metrics[m + OSFreetype.GLYPH_METRICS_OFFSET];
+                if (offset < 0) continue;
+                FTGlyph glyph = glyphs[start + i];
+                int width = metrics[m + OSFreetype.GLYPH_METRICS_WIDTH];
+                int height = metrics[m + OSFreetype.GLYPH_METRICS_ROWS];
+                byte[] buffer = new byte[width * height];
+                if (buffer.length != 0) {
+                    rasterBuffer.get(offset, buffer);
+                }
+                glyph.buffer = buffer;
+                glyph.width = width;
+                glyph.rows = height;
+                glyph.bitmap_left = metrics[m + OSFreetype.GLYPH_METRICS_LEFT];
+                glyph.bitmap_top = metrics[m + OSFreetype.GLYPH_METRICS_TOP];
+                glyph.advanceX = metrics[m + OSFreetype.GLYPH_METRICS_ADVANCE_X] / 64f;
+                glyph.advanceY = metrics[m + OSFreetype.GLYPH_METRICS_ADVANCE_Y] / 64f;
+                glyph.userAdvance = metrics[m + OSFreetype.GLYPH_METRICS_LINEAR_ADVANCE] / 65536.0f;
+                glyph.lcd = lcd;
+                glyph.initialized = true;
+            }
+            start += done;
+            if (start < count) {
+                System.arraycopy(glyphCodes, start, glyphCodes, 0, count - start);
+            }
+        }
     }
 }
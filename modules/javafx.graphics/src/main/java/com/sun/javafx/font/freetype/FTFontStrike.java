@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@ package com.sun.javafx.font.freetype;
 import com.sun.javafx.font.DisposerRecord;
 import com.sun.javafx.font.FontStrikeDesc;
 import com.sun.javafx.font.Glyph;
+import com.sun.javafx.font.GlyphRasterizer;
 import com.sun.javafx.font.PrismFontFactory;
 import com.sun.javafx.font.PrismFontStrike;
 import com.sun.javafx.geom.Path2D;
@@ -78,6 +79,42 @@ class FTFontStrike extends PrismFontStrike<FTFontFile> {
         return fontResource.createGlyphOutline(glyphCode, getSize());
     }
 
+    @Override
+    protected Path2D[] createGlyphOutlines(int[] glyphCodes, int count) {
+        FTFontFile fontResource = getFontResource();
+        return fontResource.createGlyphOutlines(glyphCodes, count, getSize());
+    }
+
+    /*
+     * Synchronized as it runs on the render thread and on the GlyphRasterizer
+     * threads. The glyphs themselves are rendered under the font file lock.
+     */
+    @Override
+    public synchronized void prepareGlyphs(int[] glyphCodes, int[] subPixels, int count) {
+        if (drawShapes) return;
+        FTGlyph[] glyphs = new FTGlyph[count];
+        int pending = 0;
+        for (int i = 0; i < count; i++) {
+            FTGlyph glyph = (FTGlyph)getGlyph(glyphCodes[i]);
+            if (!glyph.initialized && !glyph.queued) {
+                glyph.queued = true;
+                glyphs[pending++] = glyph;
+            }
+        }
+        for (int i = 0; i < pending; i++) {
+            glyphs[i].queued = false;
+        }
+        if (pending > 1) {
+            getFontResource().initGlyphs(glyphs, pending, this);
+        }
+    }
+
+    @Override
+    public void prefetchGlyphs(int[] glyphCodes, int[] subPixels, int count) {
+        if (drawShapes) return;
+        GlyphRasterizer.submit(this, glyphCodes, subPixels, count);
+    }
+
     void initGlyph(FTGlyph glyph) {
         FTFontFile fontResource = getFontResource();
         fontResource.initGlyph(glyph, this);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,7 +33,11 @@ class FTGlyph implements Glyph {
     FTFontStrike strike;
     int glyphCode;
     byte[] buffer;
-    FT_Bitmap bitmap;
+    /* Set last, after the other fields, by a GlyphRasterizer thread */
+    volatile boolean initialized;
+    boolean queued; /* used by FTFontStrike.prepareGlyphs() */
+    int width;
+    int rows;
     int bitmap_left;
     int bitmap_top;
     float advanceX;
@@ -52,7 +56,7 @@ class FTGlyph implements Glyph {
     }
 
     private void init() {
-        if (bitmap != null) return;
+        if (initialized) return;
         strike.initGlyph(this);
     }
 
@@ -103,13 +107,13 @@ class FTGlyph implements Glyph {
     public int getWidth() {
         init();
         /* Note: In Freetype the width is byte based */
-        return bitmap != null ? bitmap.width : 0;
+        return width;
     }
 
     @Override
     public int getHeight() {
         init();
-        return bitmap != null ? bitmap.rows : 0;
+        return rows;
     }
 
     @Override
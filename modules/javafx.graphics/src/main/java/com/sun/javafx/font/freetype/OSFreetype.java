@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,10 +25,10 @@
 
 package com.sun.javafx.font.freetype;
 
+import java.nio.ByteBuffer;
 import java.security.AccessController;
 import java.security.PrivilegedAction;
 import com.sun.glass.utils.NativeLibLoader;
-import com.sun.javafx.geom.Path2D;
 
 class OSFreetype {
 
@@ -94,11 +94,28 @@ class OSFreetype {
     static final int FT_LCD_FILTER_LIGHT   = 2;
     static final int FT_LCD_FILTER_LEGACY  = 16;
 
+    /* The layout of the metrics written by rasterizeGlyphs(), per glyph */
+    static final int GLYPH_METRICS_OFFSET = 0;
+    static final int GLYPH_METRICS_WIDTH = 1;
+    static final int GLYPH_METRICS_ROWS = 2;
+    static final int GLYPH_METRICS_LEFT = 3;
+    static final int GLYPH_METRICS_TOP = 4;
+    static final int GLYPH_METRICS_ADVANCE_X = 5;
+    static final int GLYPH_METRICS_ADVANCE_Y = 6;
+    static final int GLYPH_METRICS_LINEAR_ADVANCE = 7;
+    static final int GLYPH_METRICS_SIZE = 8;
+
+    /* The layout of the info written by decomposeOutlines(), per glyph */
+    static final int OUTLINE_INFO_COORDS_OFFSET = 0;
+    static final int OUTLINE_INFO_NUM_COORDS = 1;
+    static final int OUTLINE_INFO_TYPES_OFFSET = 2;
+    static final int OUTLINE_INFO_NUM_TYPES = 3;
+    static final int OUTLINE_INFO_SIZE = 4;
+
     static final int FT_LOAD_TARGET_MODE(int x) {
         return (x >> 16 ) & 15;
     }
 
-    static final native Path2D FT_Outline_Decompose(long face);
     static final native int FT_Init_FreeType(long[] alibrary);
     static final native int FT_Done_FreeType(long library);
     static final native void FT_Library_Version(long library, int[] amajor, int[] aminor, int[] apatch);
@@ -111,6 +128,32 @@ class OSFreetype {
     static final native void FT_Set_Transform(long face, FT_Matrix matrix, long delta_x, long delta_y);
     static final native FT_GlyphSlotRec getGlyphSlot(long face);
     static final native byte[] getBitmapData(long face);
+
+    /**
+     * Renders many glyphs with a single call. The bitmap of each glyph is
+     * written to {@code pixels} without row padding, and its metrics to
+     * {@code metrics} at {@code GLYPH_METRICS_SIZE} ints per glyph. The
+     * offset of a glyph that failed to render is -1.
+     *
+     * @return the number of glyphs done, less than {@code count} when
+     * {@code pixels} is full
+     */
+    static final native int rasterizeGlyphs(long face, int[] glyphCodes, int count,
+                                            int load_flags, ByteBuffer pixels, int[] metrics);
+    /**
+     * Decomposes the outlines of many glyphs at the given size with a single
+     * call. Outlines are cached by the native code for the life of the face.
+     * For each glyph {@code paths} receives its coordinates as floats, then
+     * its segment types as bytes, and {@code info} receives their offsets in
+     * bytes and lengths at {@code OUTLINE_INFO_SIZE} ints per glyph. The
+     * coordinates offset of a glyph that failed to load is -1.
+     *
+     * @return the number of glyphs done, less than {@code count} when
+     * {@code paths} is full
+     */
+    static final native int decomposeOutlines(long face, int[] glyphCodes, int count,
+                                              long size, int load_flags,
+                                              ByteBuffer paths, int[] info);
     static final native boolean isPangoEnabled();
     static final native boolean isHarfbuzzEnabled();
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -81,6 +81,27 @@ class OSPango {
     static final native PangoGlyphString pango_shape(long text, long pangoItem);
     static final native void pango_item_free(long item);
 
+    /* Custom */
+
+    /**
+     * Itemizes and shapes a run of text with a font description made of the
+     * given attributes. Results for short runs are kept in a native LRU
+     * cache, repeated strings are not shaped again.
+     *
+     * @return a glyph string per PangoItem, null for items without glyphs,
+     * or null on failure
+     */
+    static final native PangoGlyphString[] shape_text(long fontmap, String family, float size,
+                                                      int style, int weight, boolean rtl,
+                                                      boolean fallback, char[] text,
+                                                      int start, int length);
+
+    /**
+     * Gets the counters of the shaping cache: hits, misses, evictions and
+     * the number of cached runs.
+     */
+    static final native void shape_cache_stats(long[] stats);
+
     /* Miscellaneous (glib, fontconfig) */
     static final native long g_utf8_offset_to_pointer(long str, long offset);
     static final native long g_utf8_pointer_to_offset(long str, long pos);
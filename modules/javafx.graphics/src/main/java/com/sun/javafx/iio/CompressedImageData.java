@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.iio;
+
+import java.nio.ByteBuffer;
+
+/**
+ * The block compressed pixels of an image, as stored in DDS and KTX2 files,
+ * with an optional chain of mipmap levels. A graphics pipeline that supports
+ * the format can upload the levels as they are, which takes a quarter or an
+ * eighth of the memory of the decoded image.
+ */
+public final class CompressedImageData {
+
+    public enum Format {
+        /** DXT1, 4x4 pixel blocks of 8 bytes with 1 bit alpha. */
+        BC1(8),
+        /** DXT3, 4x4 pixel blocks of 16 bytes with explicit 4 bit alpha. */
+        BC2(16),
+        /** DXT5, 4x4 pixel blocks of 16 bytes with interpolated alpha. */
+        BC3(16);
+
+        private final int blockSize;
+
+        private Format(int blockSize) {
+            this.blockSize = blockSize;
+        }
+
+        public int getBlockSize() {
+            return blockSize;
+        }
+
+        /**
+         * Returns the size in bytes of a level of the given dimensions.
+         */
+        public int getLevelSize(int width, int height) {
+            return ((width + 3) / 4) * ((height + 3) / 4) * blockSize;
+        }
+    }
+
+    private final Format format;
+    private final int width;
+    private final int height;
+    private final byte[][] levels;
+
+    /**
+     * @param levels the blocks of each level, the full size image first and
+     * each following level half the size of the previous one
+     */
+    public CompressedImageData(Format format, int width, int height, byte[][] levels) {
+        if (levels.length == 0) {
+            throw new IllegalArgumentException("No levels");
+        }
+        for (int i = 0; i < levels.length; i++) {
+            int w = Math.max(1, width >> i);
+            int h = Math.max(1, height >> i);
+            if (levels[i].length < format.getLevelSize(w, h)) {
+                throw new IllegalArgumentException("Level " + i + " is truncated");
+            }
+        }
+        this.format = format;
+        this.width = width;
+        this.height = height;
+        this.levels = levels;
+    }
+
+    public Format getFormat() {
+        return format;
+    }
+
+    public int getWidth() {
+        return width;
+    }
+
+    public int getHeight() {
+        return height;
+    }
+
+    public int getLevelCount() {
+        return levels.length;
+    }
+
+    public byte[] getLevel(int level) {
+        return levels[level];
+    }
+
+    /**
+     * Returns whether the levels go all the way down to 1x1, as needed to
+     * sample the texture with mipmapping.
+     */
+    public boolean hasAllMipmapLevels() {
+        return 32 - Integer.numberOfLeadingZeros(Math.max(width, height)) == levels.length;
+    }
+
+    /**
+     * Returns the total size in bytes of the given number of levels.
+     */
+    public long getSize(int levelCount) {
+        long size = 0;
+        for (int i = 0; i < levelCount; i++) {
+            size += format.getLevelSize(Math.max(1, width >> i), Math.max(1, height >> i));
+        }
+        return size;
+    }
+
+    /**
+     * Decodes the full size level to non premultiplied RGBA pixels.
+     */
+    public ByteBuffer decode() {
+        byte[] rgba = new byte[width * height * 4];
+        byte[] blocks = levels[0];
+        int[] colors = new int[4];
+        int[] alphas = new int[8];
+        int blocksWide = (width + 3) / 4;
+        int blocksHigh = (height + 3) / 4;
+        int offset = 0;
+        for (int by = 0; by < blocksHigh; by++) {
+            for (int bx = 0; bx < blocksWide; bx++) {
+                int colorOffset = format == Format.BC1 ? offset : offset + 8;
+                decodeColors(blocks, colorOffset, format == Format.BC1, colors);
+                if (format == Format.BC3) {
+                    decodeAlphas(blocks, offset, alphas);
+                }
+                for (int y = 0; y < 4; y++) {
+                    int py = by * 4 + y;
+                    if (py >= height) {
+                        break;
+                    }
+                    int indices = blocks[colorOffset + 4 + y] & 0xff;
+                    for (int x = 0; x < 4; x++) {
+                        int px = bx * 4 + x;
+                        if (px >= width) {
+                            break;
+                        }
+                        int argb = colors[(indices >> (x * 2)) & 3];
+                        int a = argb >>> 24;
+                        int pixel = y * 4 + x;
+                        if (format == Format.BC2) {
+                            int nibble = blocks[offset + pixel / 2] >> ((pixel & 1) * 4);
+                            a = (nibble & 0xf) * 0x11;
+                        } else if (format == Format.BC3) {
+                            a = alphas[alphaIndex(blocks, offset, pixel)];
+                        }
+                        int i = (py * width + px) * 4;
+                        rgba[i] = (byte) (argb >> 16);
+                        rgba[i + 1] = (byte) (argb >> 8);
+                        rgba[i + 2] = (byte) argb;
+                        rgba[i + 3] = (byte) a;
+                    }
+                }
+                offset += format.getBlockSize();
+            }
+        }
+        return ByteBuffer.wrap(rgba);
+    }
+
+    private static int rgb565(int c) {
+        int r = (c >> 11) & 0x1f;
+        int g = (c >> 5) & 0x3f;
+        int b = c & 0x1f;
+        return ((r << 3 | r >> 2) << 16) | ((g << 2 | g >> 4) << 8) | (b << 3 | b >> 2);
+    }
+
+    private static int mix(int c0, int c1, int w0, int w1) {
+        int d = w0 + w1;
+        int r = (((c0 >> 16) & 0xff) * w0 + ((c1 >> 16) & 0xff) * w1) / d;
+        int g = (((c0 >> 8) & 0xff) * w0 + ((c1 >> 8) & 0xff) * w1) / d;
+        int b = ((c0 & 0xff) * w0 + (c1 & 0xff) * w1) / d;
+        return (r << 16) | (g << 8) | b;
+    }
+
+    private static void decodeColors(byte[] b, int offset, boolean bc1, int[] colors) {
+        int c0 = (b[offset] & 0xff) | (b[offset + 1] & 0xff) << 8;
+        int c1 = (b[offset + 2] & 0xff) | (b[offset + 3] & 0xff) << 8;
+        int rgb0 = rgb565(c0);
+        int rgb1 = rgb565(c1);
+        colors[0] = 0xff000000 | rgb0;
+        colors[1] = 0xff000000 | rgb1;
+        if (c0 > c1 || !bc1) {
+            colors[2] = 0xff000000 | mix(rgb0, rgb1, 2, 1);
+            colors[3] = 0xff000000 | mix(rgb0, rgb1, 1, 2);
+        } else {
+            // BC1 three color mode with transparent black
+            colors[2] = 0xff000000 | mix(rgb0, rgb1, 1, 1);
+            colors[3] = 0;
+        }
+    }
+
+    private static void decodeAlphas(byte[] b, int offset, int[] alphas) {
+        int a0 = b[offset] & 0xff;
+        int a1 = b[offset + 1] & 0xff;
+        alphas[0] = a0;
+        alphas[1] = a1;
+        if (a0 > a1) {
+            for (int i = 1; i < 7; i++) {
+                alphas[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+            }
+        } else {
+            for (int i = 1; i < 5; i++) {
+                alphas[i + 1] = ((5 - i) * a0 + i * a1) / 5;
+            }
+            alphas[6] = 0;
+            alphas[7] = 255;
+        }
+    }
+
+    private static int alphaIndex(byte[] b, int offset, int pixel) {
+        // 16 3 bit indices packed little endian after the two endpoints
+        int bit = pixel * 3;
+        int i = offset + 2 + bit / 8;
+        int bits = (b[i] & 0xff) | (i + 1 < offset + 8 ? (b[i + 1] & 0xff) << 8 : 0);
+        return (bits >> (bit % 8)) & 7;
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,6 +41,7 @@ public class ImageFrame {
     private float pixelScale;
     private byte[][] palette;
     private ImageMetadata metadata;
+    private CompressedImageData compressedData;
 
     /**
      * Create an <code>ImageFrame</code> with a default 72DPI pixel scale.
@@ -130,4 +131,16 @@ public class ImageFrame {
     public ImageMetadata getMetadata() {
         return this.metadata;
     }
+
+    /**
+     * Sets the block compressed pixels the image data was decoded from. They
+     * must have the same width and height as this frame.
+     */
+    public void setCompressedData(CompressedImageData compressedData) {
+        this.compressedData = compressedData;
+    }
+
+    public CompressedImageData getCompressedData() {
+        return compressedData;
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -54,4 +54,14 @@ public interface ImageLoadListener {
      */
     public void imageLoadMetaData(ImageLoader loader, ImageMetadata metadata);
 
+    /**
+     * Invoked when a low quality version of the loading image is ready, for
+     * loaders which support it and have been asked to emit previews.
+     *
+     * @param loader the <code>ImageLoader</code> used to load the image.
+     * @param preview the preview, with the dimensions of the final image.
+     */
+    public default void imageLoadPreview(ImageLoader loader, ImageFrame preview) {
+    }
+
 }
@@ -29,9 +29,11 @@ import com.sun.javafx.PlatformUtil;
 import com.sun.javafx.iio.ImageFormatDescription.Signature;
 import com.sun.javafx.iio.bmp.BMPImageLoaderFactory;
 import com.sun.javafx.iio.common.ImageTools;
+import com.sun.javafx.iio.dds.DDSImageLoaderFactory;
 import com.sun.javafx.iio.gif.GIFImageLoaderFactory;
 import com.sun.javafx.iio.ios.IosImageLoaderFactory;
 import com.sun.javafx.iio.jpeg.JPEGImageLoaderFactory;
+import com.sun.javafx.iio.ktx.KTX2ImageLoaderFactory;
 import com.sun.javafx.iio.png.PNGImageLoaderFactory;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.util.DataURI;
@@ -43,8 +45,8 @@ import java.io.IOException;
 import java.io.InputStream;
 import java.io.SequenceInputStream;
 import java.util.ArrayList;
-import java.util.HashMap;
 import java.util.Map.Entry;
+import java.util.concurrent.ConcurrentHashMap;
 
 /**
  * A convenience class for simple image loading. Factories for creating loaders
@@ -119,14 +121,16 @@ public class ImageStorage {
 //    private static HashMap<String, ImageLoaderFactory> loaderFactoriesByExtension;
     /**
      * A mapping of format signature byte sequences to loader factories.
+     * The mappings are concurrent as images are loaded on several background
+     * threads, possibly while a factory is being registered.
      */
-    private final HashMap<Signature, ImageLoaderFactory> loaderFactoriesBySignature;
+    private final ConcurrentHashMap<Signature, ImageLoaderFactory> loaderFactoriesBySignature;
     /**
      * A mapping of lower case MIME subtypes to loader factories.
      */
-    private final HashMap<String, ImageLoaderFactory> loaderFactoriesByMimeSubtype;
+    private final ConcurrentHashMap<String, ImageLoaderFactory> loaderFactoriesByMimeSubtype;
     private final ImageLoaderFactory[] loaderFactories;
-    private int maxSignatureLength;
+    private volatile int maxSignatureLength;
 
     private static final boolean isIOS = PlatformUtil.isIOS();
 
@@ -150,14 +154,16 @@ public class ImageStorage {
                 GIFImageLoaderFactory.getInstance(),
                 JPEGImageLoaderFactory.getInstance(),
                 PNGImageLoaderFactory.getInstance(),
-                BMPImageLoaderFactory.getInstance()
+                BMPImageLoaderFactory.getInstance(),
+                DDSImageLoaderFactory.getInstance(),
+                KTX2ImageLoaderFactory.getInstance()
                 // Note: append ImageLoadFactory for any new format here.
             };
         }
 
 //        loaderFactoriesByExtension = new HashMap(numExtensions);
-        loaderFactoriesBySignature = new HashMap<>(loaderFactories.length);
-        loaderFactoriesByMimeSubtype = new HashMap<>(loaderFactories.length);
+        loaderFactoriesBySignature = new ConcurrentHashMap<>(loaderFactories.length);
+        loaderFactoriesByMimeSubtype = new ConcurrentHashMap<>(loaderFactories.length);
 
         for (int i = 0; i < loaderFactories.length; i++) {
             addImageLoaderFactory(loaderFactories[i]);
@@ -212,25 +218,25 @@ public class ImageStorage {
      *
      * @param factory the factory to register.
      */
-    public void addImageLoaderFactory(ImageLoaderFactory factory) {
+    public synchronized void addImageLoaderFactory(ImageLoaderFactory factory) {
         ImageFormatDescription desc = factory.getFormatDescription();
 //        String[] extensions = desc.getExtensions();
 //        for (int j = 0; j < extensions.length; j++) {
 //            loaderFactoriesByExtension.put(extensions[j].toLowerCase(), factory);
 //        }
 
+        int length = maxSignatureLength;
         for (final Signature signature: desc.getSignatures()) {
             loaderFactoriesBySignature.put(signature, factory);
+            length = Math.max(length, signature.getLength());
         }
 
         for (String subtype : desc.getMIMESubtypes()) {
             loaderFactoriesByMimeSubtype.put(subtype.toLowerCase(), factory);
         }
 
-        // invalidate max signature length
-        synchronized (ImageStorage.class) {
-            maxSignatureLength = -1;
-        }
+        // a replaced signature has the same length, so the maximum only grows
+        maxSignatureLength = length;
     }
 
     /**
@@ -413,18 +419,9 @@ public class ImageStorage {
         return images;
     }
 
-    private synchronized int getMaxSignatureLength() {
-        if (maxSignatureLength < 0) {
-            maxSignatureLength = 0;
-            for (final Signature signature:
-                    loaderFactoriesBySignature.keySet()) {
-                final int signatureLength = signature.getLength();
-                if (maxSignatureLength < signatureLength) {
-                    maxSignatureLength = signatureLength;
-                }
-            }
-        }
-
+    // Called for every image load; it does not lock, so that images are
+    // loaded concurrently.
+    private int getMaxSignatureLength() {
         return maxSignatureLength;
     }
 
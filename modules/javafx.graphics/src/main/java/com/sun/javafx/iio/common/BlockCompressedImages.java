@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.iio.common;
+
+import com.sun.javafx.iio.CompressedImageData;
+import com.sun.javafx.iio.ImageFrame;
+import com.sun.javafx.iio.ImageMetadata;
+import com.sun.javafx.iio.ImageStorage;
+import java.io.IOException;
+import java.io.InputStream;
+import java.nio.ByteBuffer;
+import java.util.function.Consumer;
+
+/**
+ * Helpers shared by the loaders of block compressed image files.
+ */
+public final class BlockCompressedImages {
+
+    private BlockCompressedImages() {
+    }
+
+    /**
+     * Checks the dimensions of an image and returns the number of its levels
+     * that can exist, at most the requested count and at least one.
+     */
+    public static int checkDimensions(int width, int height, int levelCount) throws IOException {
+        if (width <= 0 || height <= 0) {
+            throw new IOException("Bad image size: " + width + "x" + height);
+        }
+        if (width >= (Integer.MAX_VALUE / height / 4)) {
+            throw new IOException("Bad image size: " + width + "x" + height);
+        }
+        int maxLevels = 32 - Integer.numberOfLeadingZeros(Math.max(width, height));
+        return Math.max(1, Math.min(levelCount, maxLevels));
+    }
+
+    /**
+     * Reads consecutive levels, the full size image first.
+     */
+    public static byte[][] readLevels(InputStream in, CompressedImageData.Format format,
+            int width, int height, int levelCount) throws IOException
+    {
+        levelCount = checkDimensions(width, height, levelCount);
+        byte[][] levels = new byte[levelCount][];
+        for (int i = 0; i < levelCount; i++) {
+            levels[i] = new byte[format.getLevelSize(Math.max(1, width >> i),
+                                                     Math.max(1, height >> i))];
+            if (ImageTools.readFully(in, levels[i]) != levels[i].length) {
+                throw new IOException("Truncated image data");
+            }
+        }
+        return levels;
+    }
+
+    /**
+     * Decodes the image and returns it as a frame. The compressed pixels are
+     * attached to the frame when they can be drawn in place of the decoded
+     * pixels: the frame is not scaled, and transparent texels are stored
+     * premultiplied or are transparent black.
+     */
+    public static ImageFrame load(Consumer<ImageMetadata> metadataListener,
+            CompressedImageData data, boolean premultiplied,
+            int width, int height, boolean preserveAspectRatio, boolean smooth)
+    {
+        int imgWidth = data.getWidth();
+        int imgHeight = data.getHeight();
+        int[] outWH = ImageTools.computeDimensions(imgWidth, imgHeight,
+                width, height, preserveAspectRatio);
+        width = outWH[0];
+        height = outWH[1];
+
+        ImageMetadata imageMetadata = new ImageMetadata(null, Boolean.TRUE,
+            null, null, null, null, null, width, height,
+            null, null, null);
+        metadataListener.accept(imageMetadata);
+
+        ByteBuffer img = data.decode();
+        boolean drawable = premultiplied
+                || data.getFormat() == CompressedImageData.Format.BC1
+                || isOpaque(img);
+        if (imgWidth != width || imgHeight != height) {
+            img = ImageTools.scaleImage(img, imgWidth, imgHeight, 4,
+                    width, height, smooth);
+            drawable = false;
+        }
+
+        ImageFrame frame = new ImageFrame(premultiplied
+                ? ImageStorage.ImageType.RGBA_PRE : ImageStorage.ImageType.RGBA,
+                img, width, height, width * 4, null, imageMetadata);
+        if (drawable) {
+            frame.setCompressedData(data);
+        }
+        return frame;
+    }
+
+    private static boolean isOpaque(ByteBuffer rgba) {
+        byte[] pixels = rgba.array();
+        for (int i = 3; i < pixels.length; i += 4) {
+            if (pixels[i] != (byte) 0xff) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 package com.sun.javafx.iio.common;
 
 import com.sun.javafx.iio.ImageFormatDescription;
+import com.sun.javafx.iio.ImageFrame;
 import com.sun.javafx.iio.ImageLoadListener;
 import com.sun.javafx.iio.ImageLoader;
 import com.sun.javafx.iio.ImageMetadata;
@@ -91,6 +92,16 @@ public abstract class ImageLoaderImpl implements ImageLoader {
         }
     }
 
+    protected void updateImagePreview(ImageFrame preview) {
+        if(listeners != null && !listeners.isEmpty()) {
+            Iterator<ImageLoadListener> iter = listeners.iterator();
+            while(iter.hasNext()) {
+                ImageLoadListener l = iter.next();
+                l.imageLoadPreview(this, preview);
+            }
+        }
+    }
+
     protected void updateImageMetadata(ImageMetadata metadata) {
         if(listeners != null && !listeners.isEmpty()) {
             Iterator<ImageLoadListener> iter = listeners.iterator();
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.iio.dds;
+
+import com.sun.javafx.iio.CompressedImageData;
+import com.sun.javafx.iio.ImageFormatDescription;
+import com.sun.javafx.iio.ImageFrame;
+import com.sun.javafx.iio.ImageLoader;
+import com.sun.javafx.iio.ImageLoaderFactory;
+import com.sun.javafx.iio.common.BlockCompressedImages;
+import com.sun.javafx.iio.common.ImageDescriptor;
+import com.sun.javafx.iio.common.ImageLoaderImpl;
+import com.sun.javafx.iio.common.ImageTools;
+import java.io.DataInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+
+final class DDSDescriptor extends ImageDescriptor {
+
+    static final String formatName = "DDS";
+    static final String[] extensions = { "dds" };
+    static final Signature[] signatures = {
+        new Signature((byte)'D', (byte)'D', (byte)'S', (byte)' ')
+    };
+    static final String[] mimeSubtypes = { "vnd-ms.dds" };
+    static final ImageDescriptor theInstance = new DDSDescriptor();
+
+    private DDSDescriptor() {
+        super(formatName, extensions, signatures, mimeSubtypes);
+    }
+}
+
+/**
+ * Loads DirectDraw Surface files with BC1, BC2 or BC3 compressed pixels.
+ */
+final class DDSImageLoader extends ImageLoaderImpl {
+
+    private static final int HEADER_SIZE = 124;
+    private static final int DDSD_MIPMAPCOUNT = 0x20000;
+    private static final int DDPF_FOURCC = 0x4;
+
+    private static final int FOURCC_DXT1 = fourCC("DXT1");
+    private static final int FOURCC_DXT2 = fourCC("DXT2");
+    private static final int FOURCC_DXT3 = fourCC("DXT3");
+    private static final int FOURCC_DXT4 = fourCC("DXT4");
+    private static final int FOURCC_DXT5 = fourCC("DXT5");
+    private static final int FOURCC_DX10 = fourCC("DX10");
+
+    // DXGI_FORMAT values of the DX10 header extension
+    private static final int DXGI_FORMAT_BC1_UNORM = 71;
+    private static final int DXGI_FORMAT_BC1_UNORM_SRGB = 72;
+    private static final int DXGI_FORMAT_BC2_UNORM = 74;
+    private static final int DXGI_FORMAT_BC2_UNORM_SRGB = 75;
+    private static final int DXGI_FORMAT_BC3_UNORM = 77;
+    private static final int DXGI_FORMAT_BC3_UNORM_SRGB = 78;
+
+    private final CompressedImageData data;
+    private final boolean premultiplied;
+
+    private static int fourCC(String s) {
+        return s.charAt(0) | s.charAt(1) << 8 | s.charAt(2) << 16 | s.charAt(3) << 24;
+    }
+
+    DDSImageLoader(InputStream input) throws IOException {
+        super(DDSDescriptor.theInstance);
+        DataInputStream in = new DataInputStream(input);
+        if (readInt(in) != fourCC("DDS ")) {
+            throw new IOException("Invalid DDS file signature");
+        }
+        int[] header = new int[HEADER_SIZE / 4];
+        for (int i = 0; i < header.length; i++) {
+            header[i] = readInt(in);
+        }
+        if (header[0] != HEADER_SIZE) {
+            throw new IOException("Invalid DDS header size");
+        }
+        int flags = header[1];
+        int height = header[2];
+        int width = header[3];
+        int mipMapCount = (flags & DDSD_MIPMAPCOUNT) != 0 ? header[6] : 1;
+        // the pixel format starts at offset 72
+        int pfFlags = header[19];
+        int fourCC = header[20];
+        if ((pfFlags & DDPF_FOURCC) == 0) {
+            throw new IOException("Unsupported DDS image: uncompressed pixels");
+        }
+
+        CompressedImageData.Format format;
+        boolean pre = false;
+        if (fourCC == FOURCC_DXT1) {
+            format = CompressedImageData.Format.BC1;
+        } else if (fourCC == FOURCC_DXT2 || fourCC == FOURCC_DXT3) {
+            format = CompressedImageData.Format.BC2;
+            pre = fourCC == FOURCC_DXT2;
+        } else if (fourCC == FOURCC_DXT4 || fourCC == FOURCC_DXT5) {
+            format = CompressedImageData.Format.BC3;
+            pre = fourCC == FOURCC_DXT4;
+        } else if (fourCC == FOURCC_DX10) {
+            int dxgiFormat = readInt(in);
+            // resource dimension, misc flags, array size, misc flags 2
+            ImageTools.skipFully(in, 16);
+            switch (dxgiFormat) {
+                case DXGI_FORMAT_BC1_UNORM:
+                case DXGI_FORMAT_BC1_UNORM_SRGB:
+                    format = CompressedImageData.Format.BC1;
+                    break;
+                case DXGI_FORMAT_BC2_UNORM:
+                case DXGI_FORMAT_BC2_UNORM_SRGB:
+                    format = CompressedImageData.Format.BC2;
+                    break;
+                case DXGI_FORMAT_BC3_UNORM:
+                case DXGI_FORMAT_BC3_UNORM_SRGB:
+                    format = CompressedImageData.Format.BC3;
+                    break;
+                default:
+                    throw new IOException("Unsupported DDS image: DXGI format " + dxgiFormat);
+            }
+        } else {
+            throw new IOException("Unsupported DDS image: compression " + Integer.toHexString(fourCC));
+        }
+
+        byte[][] levels = BlockCompressedImages.readLevels(in, format, width, height, mipMapCount);
+        data = new CompressedImageData(format, width, height, levels);
+        premultiplied = pre;
+    }
+
+    private static int readInt(DataInputStream in) throws IOException {
+        return Integer.reverseBytes(in.readInt());
+    }
+
+    @Override
+    public void dispose() {
+    }
+
+    @Override
+    public ImageFrame load(int imageIndex, int width, int height,
+            boolean preserveAspectRatio, boolean smooth) throws IOException
+    {
+        if (0 != imageIndex) {
+            return null;
+        }
+        return BlockCompressedImages.load(this::updateImageMetadata, data, premultiplied,
+                width, height, preserveAspectRatio, smooth);
+    }
+}
+
+public final class DDSImageLoaderFactory implements ImageLoaderFactory {
+
+    private static final DDSImageLoaderFactory theInstance =
+            new DDSImageLoaderFactory();
+
+    public static ImageLoaderFactory getInstance() {
+        return theInstance;
+    }
+
+    @Override
+    public ImageFormatDescription getFormatDescription() {
+        return DDSDescriptor.theInstance;
+    }
+
+    @Override
+    public ImageLoader createImageLoader(InputStream input) throws IOException {
+        return new DDSImageLoader(input);
+    }
+}
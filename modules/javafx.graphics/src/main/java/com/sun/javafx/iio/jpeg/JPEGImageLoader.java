@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,6 +37,11 @@ import java.nio.ByteBuffer;
 import java.security.AccessController;
 import java.security.PrivilegedAction;
 
+/**
+ * A loader for JPEG images, decoded by the native IJG library. Each loader
+ * keeps its own native decoder state, so loaders can be used concurrently
+ * from different threads, while a single loader is used by one thread.
+ */
 public class JPEGImageLoader extends ImageLoaderImpl {
 
     // IJG Color codes.
@@ -83,6 +88,16 @@ public class JPEGImageLoader extends ImageLoaderImpl {
 
     private boolean isDisposed = false;
 
+    /** Whether progressive images emit a preview of their first scan. */
+    private boolean progressivePreview = false;
+    /** The buffer being decoded and the frame it becomes, for previews. */
+    private ByteBuffer previewBuffer;
+    private int previewNumComponents;
+    private int previewWidth;
+    private int previewHeight;
+    private boolean previewSmooth;
+    private ImageMetadata previewMetadata;
+
     private Lock accessLock = new Lock();
 
     /** Sets up static C structures. */
@@ -98,10 +113,18 @@ public class JPEGImageLoader extends ImageLoaderImpl {
      *  will produce for requested output color space.
      */
     private native int startDecompression(long structPointer,
-            int outColorSpaceCode, int scaleNum, int scaleDenom);
+            int outColorSpaceCode, int scaleNum, int scaleDenom,
+            boolean preview);
 
     private native boolean decompressIndirect(long structPointer, boolean reportProgress, byte[] array) throws IOException;
 
+    /** Decodes straight into a direct buffer, without copying the rows. */
+    private native boolean decompressDirect(long structPointer, boolean reportProgress, ByteBuffer buffer) throws IOException;
+
+    /** Decodes the w x h window at (x, y) into a direct buffer. */
+    private native boolean decompressRegion(long structPointer, boolean reportProgress,
+            int x, int y, int w, int h, ByteBuffer buffer) throws IOException;
+
     static {
         @SuppressWarnings("removal")
         var dummy = AccessController.doPrivileged((PrivilegedAction<Object>) () -> {
@@ -176,6 +199,37 @@ public class JPEGImageLoader extends ImageLoaderImpl {
         updateImageProgress(100.0F * outLinesDecoded / outHeight);
     }
 
+    /*
+     * Called by the native code when the first scan of a progressive image
+     * has been decoded into the output buffer.
+     */
+    private void updateImagePreview(int scan) {
+        if (previewBuffer == null) {
+            return;
+        }
+        // the buffer is overwritten by the next scans, keep a copy
+        ByteBuffer buffer = ByteBuffer.allocate(previewBuffer.capacity());
+        buffer.put(previewBuffer.duplicate().rewind());
+        buffer.rewind();
+        if (outWidth != previewWidth || outHeight != previewHeight) {
+            buffer = ImageTools.scaleImage(buffer, outWidth, outHeight,
+                    previewNumComponents, previewWidth, previewHeight, previewSmooth);
+        }
+        updateImagePreview(new ImageFrame(outImageType, buffer,
+                previewWidth, previewHeight, previewWidth * previewNumComponents,
+                null, previewMetadata));
+    }
+
+    /**
+     * Sets whether a progressive image is first decoded from its first scan
+     * only, which is reported to the listeners with
+     * {@link com.sun.javafx.iio.ImageLoadListener#imageLoadPreview} before the image is fully
+     * decoded. This costs an extra pass over the output rows.
+     */
+    public void setProgressivePreview(boolean progressivePreview) {
+        this.progressivePreview = progressivePreview;
+    }
+
     JPEGImageLoader(InputStream input) throws IOException {
         super(JPEGDescriptor.getInstance());
         if (input == null) {
@@ -226,8 +280,10 @@ public class JPEGImageLoader extends ImageLoaderImpl {
 
         int outNumComponents;
         try {
+            boolean reportProgress = listeners != null && !listeners.isEmpty();
             outNumComponents = startDecompression(structPointer,
-                    outColorSpaceCode, width, height);
+                    outColorSpaceCode, width, height,
+                    progressivePreview && reportProgress);
 
             if (outWidth < 0 || outHeight < 0 || outNumComponents < 0) {
                throw new IOException("negative dimension.");
@@ -240,14 +296,31 @@ public class JPEGImageLoader extends ImageLoaderImpl {
                throw new IOException("bad height.");
             }
 
-            byte[] array = new byte[scanlineStride*outHeight];
-            buffer = ByteBuffer.wrap(array);
-            decompressIndirect(structPointer, listeners != null && !listeners.isEmpty(), buffer.array());
+            try {
+                buffer = ByteBuffer.allocateDirect(scanlineStride*outHeight);
+            } catch (OutOfMemoryError e) {
+                // direct memory is exhausted, decode into the heap instead
+                buffer = null;
+            }
+            if (buffer != null) {
+                previewBuffer = buffer;
+                previewNumComponents = outNumComponents;
+                previewWidth = width;
+                previewHeight = height;
+                previewSmooth = smooth;
+                previewMetadata = md;
+                decompressDirect(structPointer, reportProgress, buffer);
+            } else {
+                byte[] array = new byte[scanlineStride*outHeight];
+                buffer = ByteBuffer.wrap(array);
+                decompressIndirect(structPointer, reportProgress, buffer.array());
+            }
         } catch (IOException e) {
             throw e;
         } catch (Throwable t) {
             throw new IOException(t);
         } finally {
+            previewBuffer = null;
             accessLock.unlock();
             dispose();
         }
@@ -270,6 +343,57 @@ public class JPEGImageLoader extends ImageLoaderImpl {
                 width, height, width * outNumComponents, null, md);
     }
 
+    /**
+     * Loads the {@code w x h} region at {@code (x, y)} of the image at full
+     * resolution. Only the rows down to the bottom of the region are
+     * decoded.
+     *
+     * @return the region, or null if it is not within the image.
+     */
+    public ImageFrame loadRegion(int x, int y, int w, int h) throws IOException {
+        if (x < 0 || y < 0 || w <= 0 || h <= 0 ||
+                x > inWidth - w || y > inHeight - h) {
+            return null;
+        }
+
+        accessLock.lock();
+
+        ImageMetadata md = new ImageMetadata(null, true,
+                null, null, null, null, null,
+                w, h, null, null, null);
+
+        updateImageMetadata(md);
+
+        ByteBuffer buffer = null;
+
+        int outNumComponents;
+        try {
+            outNumComponents = startDecompression(structPointer,
+                    outColorSpaceCode, inWidth, inHeight, false);
+
+            if (outWidth != inWidth || outHeight != inHeight || outNumComponents <= 0) {
+               throw new IOException("bad dimension.");
+            }
+            if (w > (Integer.MAX_VALUE / outNumComponents / h)) {
+               throw new IOException("bad region.");
+            }
+
+            buffer = ByteBuffer.allocateDirect(w * outNumComponents * h);
+            decompressRegion(structPointer, listeners != null && !listeners.isEmpty(),
+                    x, y, w, h, buffer);
+        } catch (IOException e) {
+            throw e;
+        } catch (Throwable t) {
+            throw new IOException(t);
+        } finally {
+            accessLock.unlock();
+            dispose();
+        }
+
+        return new ImageFrame(outImageType, buffer,
+                w, h, w * outNumComponents, null, md);
+    }
+
     private static class Lock {
         private boolean locked;
 
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.iio.ktx;
+
+import com.sun.javafx.iio.CompressedImageData;
+import com.sun.javafx.iio.ImageFormatDescription;
+import com.sun.javafx.iio.ImageFrame;
+import com.sun.javafx.iio.ImageLoader;
+import com.sun.javafx.iio.ImageLoaderFactory;
+import com.sun.javafx.iio.common.BlockCompressedImages;
+import com.sun.javafx.iio.common.ImageDescriptor;
+import com.sun.javafx.iio.common.ImageLoaderImpl;
+import java.io.IOException;
+import java.io.InputStream;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+final class KTX2Descriptor extends ImageDescriptor {
+
+    static final String formatName = "KTX2";
+    static final String[] extensions = { "ktx2" };
+    static final Signature[] signatures = {
+        new Signature((byte)0xAB, (byte)0x4B, (byte)0x54, (byte)0x58,
+                      (byte)0x20, (byte)0x32, (byte)0x30, (byte)0xBB,
+                      (byte)0x0D, (byte)0x0A, (byte)0x1A, (byte)0x0A)
+    };
+    static final String[] mimeSubtypes = { "ktx2" };
+    static final ImageDescriptor theInstance = new KTX2Descriptor();
+
+    private KTX2Descriptor() {
+        super(formatName, extensions, signatures, mimeSubtypes);
+    }
+}
+
+/**
+ * Loads KTX 2.0 files with BC1, BC2 or BC3 compressed pixels. Supercompressed
+ * files, arrays, cube maps and 3D textures are not supported.
+ */
+final class KTX2ImageLoader extends ImageLoaderImpl {
+
+    private static final int IDENTIFIER_SIZE = 12;
+    private static final int LEVEL_INDEX_OFFSET = 80;
+
+    // VkFormat values
+    private static final int VK_FORMAT_BC1_RGB_UNORM_BLOCK = 131;
+    private static final int VK_FORMAT_BC1_RGB_SRGB_BLOCK = 132;
+    private static final int VK_FORMAT_BC1_RGBA_UNORM_BLOCK = 133;
+    private static final int VK_FORMAT_BC1_RGBA_SRGB_BLOCK = 134;
+    private static final int VK_FORMAT_BC2_UNORM_BLOCK = 135;
+    private static final int VK_FORMAT_BC2_SRGB_BLOCK = 136;
+    private static final int VK_FORMAT_BC3_UNORM_BLOCK = 137;
+    private static final int VK_FORMAT_BC3_SRGB_BLOCK = 138;
+
+    // Offset of the flags in the data format descriptor, and the flag
+    // telling that colors are premultiplied by alpha
+    private static final int DFD_FLAGS_OFFSET = 15;
+    private static final int KHR_DF_FLAG_ALPHA_PREMULTIPLIED = 1;
+
+    private final CompressedImageData data;
+    private final boolean premultiplied;
+
+    KTX2ImageLoader(InputStream input) throws IOException {
+        super(KTX2Descriptor.theInstance);
+        ByteBuffer file = ByteBuffer.wrap(input.readAllBytes()).order(ByteOrder.LITTLE_ENDIAN);
+        if (file.limit() < LEVEL_INDEX_OFFSET) {
+            throw new IOException("Truncated KTX2 header");
+        }
+        file.position(IDENTIFIER_SIZE);
+        int vkFormat = file.getInt();
+        file.getInt(); // typeSize
+        int width = file.getInt();
+        int height = file.getInt();
+        int depth = file.getInt();
+        int layerCount = file.getInt();
+        int faceCount = file.getInt();
+        int levelCount = Math.max(1, file.getInt());
+        int supercompression = file.getInt();
+        int dfdOffset = file.getInt();
+        int dfdLength = file.getInt();
+
+        if (depth > 1 || layerCount > 1 || faceCount != 1) {
+            throw new IOException("Unsupported KTX2 image: not a 2D texture");
+        }
+        if (supercompression != 0) {
+            throw new IOException("Unsupported KTX2 image: supercompression " + supercompression);
+        }
+
+        CompressedImageData.Format format;
+        switch (vkFormat) {
+            case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+            case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+            case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+            case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+                format = CompressedImageData.Format.BC1;
+                break;
+            case VK_FORMAT_BC2_UNORM_BLOCK:
+            case VK_FORMAT_BC2_SRGB_BLOCK:
+                format = CompressedImageData.Format.BC2;
+                break;
+            case VK_FORMAT_BC3_UNORM_BLOCK:
+            case VK_FORMAT_BC3_SRGB_BLOCK:
+                format = CompressedImageData.Format.BC3;
+                break;
+            default:
+                throw new IOException("Unsupported KTX2 image: VkFormat " + vkFormat);
+        }
+
+        int count = BlockCompressedImages.checkDimensions(width, height, levelCount);
+        if (LEVEL_INDEX_OFFSET + 24L * levelCount > file.limit()) {
+            throw new IOException("Truncated KTX2 level index");
+        }
+        byte[][] levels = new byte[count][];
+        for (int i = 0; i < count; i++) {
+            long offset = file.getLong(LEVEL_INDEX_OFFSET + 24 * i);
+            long length = file.getLong(LEVEL_INDEX_OFFSET + 24 * i + 8);
+            if (offset < 0 || length < 0 || offset + length > file.limit()) {
+                throw new IOException("Truncated KTX2 image data");
+            }
+            levels[i] = new byte[(int) length];
+            file.get((int) offset, levels[i]);
+        }
+        data = new CompressedImageData(format, width, height, levels);
+
+        premultiplied = dfdLength > DFD_FLAGS_OFFSET && dfdOffset > 0
+                && dfdOffset + DFD_FLAGS_OFFSET < file.limit()
+                && (file.get(dfdOffset + DFD_FLAGS_OFFSET) & KHR_DF_FLAG_ALPHA_PREMULTIPLIED) != 0;
+    }
+
+    @Override
+    public void dispose() {
+    }
+
+    @Override
+    public ImageFrame load(int imageIndex, int width, int height,
+            boolean preserveAspectRatio, boolean smooth) throws IOException
+    {
+        if (0 != imageIndex) {
+            return null;
+        }
+        return BlockCompressedImages.load(this::updateImageMetadata, data, premultiplied,
+                width, height, preserveAspectRatio, smooth);
+    }
+}
+
+public final class KTX2ImageLoaderFactory implements ImageLoaderFactory {
+
+    private static final KTX2ImageLoaderFactory theInstance =
+            new KTX2ImageLoaderFactory();
+
+    public static ImageLoaderFactory getInstance() {
+        return theInstance;
+    }
+
+    @Override
+    public ImageFormatDescription getFormatDescription() {
+        return KTX2Descriptor.theInstance;
+    }
+
+    @Override
+    public ImageLoader createImageLoader(InputStream input) throws IOException {
+        return new KTX2ImageLoader(input);
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,4 +41,20 @@ public interface TextLayoutFactory {
      * Disposes the reusable TextLayout.
      */
     public void disposeLayout(TextLayout layout);
+
+    /**
+     * Queues a single line of text to be laid out ahead of the next layout
+     * pass, so that the layouts for the same text and font find the result
+     * ready. May be called on any thread.
+     */
+    public default void prepareLayout(String text, Object font) {
+    }
+
+    /**
+     * Lays out the text queued by prepareLayout(), in parallel where
+     * possible, and waits until it is done. Called on the FX thread just
+     * before the layout pass.
+     */
+    public default void prepareLayouts() {
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -258,6 +258,7 @@ public class NGGroup extends NGNode {
         if (blendMode == Blend.Mode.SRC_OVER ||
                 orderedChildren.size() < 2) {  // Blend modes only work "between" siblings
 
+            Shape3DCuller.cull(g, orderedChildren, startPos);
             for (int i = startPos; i < orderedChildren.size(); i++) {
                 NGNode child;
                 try {
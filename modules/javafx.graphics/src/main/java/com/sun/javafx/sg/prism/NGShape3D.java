@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,8 @@
 
 package com.sun.javafx.sg.prism;
 
+import com.sun.javafx.geom.BaseBounds;
+import com.sun.javafx.geom.BoxBounds;
 import com.sun.javafx.geom.Vec3d;
 import com.sun.javafx.geom.transform.Affine3D;
 import com.sun.javafx.util.Utils;
@@ -42,6 +44,16 @@ import javafx.scene.shape.DrawMode;
  * TODO: 3D - Need documentation
  */
 public abstract class NGShape3D extends NGNode {
+    // The shaders support this many lights besides the ambient ones
+    private static final int MAX_LIGHTS = 3;
+
+    // Scratch state for selecting the lights, only used on the render thread
+    private static final BoxBounds TEMP_BOUNDS = new BoxBounds();
+    private static final NGLightBase[] selectedLights = new NGLightBase[MAX_LIGHTS];
+    private static final float[] selectedWeights = new float[MAX_LIGHTS];
+    private static final int[] selectedOrder = new int[MAX_LIGHTS];
+    private static float centerX, centerY, centerZ, radius;
+
     private NGPhongMaterial material;
     private DrawMode drawMode;
     private CullFace cullFace;
@@ -49,6 +61,8 @@ public abstract class NGShape3D extends NGNode {
     private boolean drawModeDirty = false;
     NGTriangleMesh mesh;
     private MeshView meshView;
+    // Set by Shape3DCuller when the shape is outside the view volume
+    boolean outOfView;
 
     public void setMaterial(NGPhongMaterial material) {
         this.material = material;
@@ -132,7 +146,10 @@ public abstract class NGShape3D extends NGNode {
             float ambientBlue = 0.0f;
             float ambientGreen = 0.0f;
 
-            for (NGLightBase lightBase : lights) {
+            int count = 0;
+            boolean boundsComputed = false;
+            for (int i = 0; i < lights.length; i++) {
+                NGLightBase lightBase = lights[i];
                 if (lightBase == null) {
                     // The array of lights can have nulls
                     break;
@@ -153,25 +170,28 @@ public abstract class NGShape3D extends NGNode {
                     ambientRed   += rL;
                     ambientGreen += gL;
                     ambientBlue  += bL;
+                    continue;
+                }
+                if (!(lightBase instanceof NGPointLight) && !(lightBase instanceof NGDirectionalLight)) {
+                    continue;
                 }
-                /* TODO: 3D
-                 * There is a limit on the number of point lights that can affect
-                 * a 3D shape. (Currently we simply select the first 3)
-                 * Thus it is important to select the most relevant lights.
-                 *
-                 * One such way would be to sort lights according to
-                 * intensity, which becomes especially relevant when lights
-                 * are attenuated. Only the most intense set of lights
-                 * would be set.
-                 * The approximate intensity a light will have on a given
-                 * shape, could be defined by:
-                 *
-                 * Where d is distance from point light
-                 * float attenuationFactor = 1/(c + cL * d + cQ * d * d);
-                 * float intensity = rL * 0.299f + gL * 0.587f + bL * 0.114f;
-                 * intensity *= attenuationFactor;
-                */
-                else if (lightBase instanceof NGSpotLight light) {
+                if (!boundsComputed) {
+                    computeWorldBounds(g);
+                    boundsComputed = true;
+                }
+                float weight = lightWeight(lightBase, rL, gL, bL);
+                if (weight > 0) {
+                    count = selectLight(lightBase, weight, i, count);
+                }
+            }
+            sortSelectedLights(count);
+            for (int i = 0; i < count; i++) {
+                NGLightBase lightBase = selectedLights[i];
+                selectedLights[i] = null;
+                float rL = lightBase.getColor().getRed();
+                float gL = lightBase.getColor().getGreen();
+                float bL = lightBase.getColor().getBlue();
+                if (lightBase instanceof NGSpotLight light) {
                     addSpotLight(light, lightIndex++, rL, gL, bL);
                 } else if (lightBase instanceof NGPointLight light) {
                     addPointLight(light, lightIndex++, rL, gL, bL);
@@ -186,11 +206,97 @@ public abstract class NGShape3D extends NGNode {
         }
         // TODO: 3D Required for D3D implementation of lights, which is limited to 3
 
-        while (lightIndex < 3) { // Reset any previously set lights
+        while (lightIndex < MAX_LIGHTS) { // Reset any previously set lights
             resetLight(lightIndex++);
         }
     }
 
+    /*
+     * Computes the center and the radius of the bounds of this shape in
+     * world coordinates, which is where the lights are positioned.
+     */
+    private void computeWorldBounds(Graphics g) {
+        BaseBounds bounds = g.getTransformNoClone().transform(contentBounds, TEMP_BOUNDS);
+        // Undo the scaling for the display, as for the world matrix
+        float sx = g.getPixelScaleFactorX();
+        float sy = g.getPixelScaleFactorY();
+        float width = bounds.getWidth() / sx;
+        float height = bounds.getHeight() / sy;
+        float depth = bounds.getDepth();
+        centerX = (bounds.getMinX() + bounds.getMaxX()) / 2 / sx;
+        centerY = (bounds.getMinY() + bounds.getMaxY()) / 2 / sy;
+        centerZ = (bounds.getMinZ() + bounds.getMaxZ()) / 2;
+        radius = (float) Math.sqrt(width * width + height * height + depth * depth) / 2;
+    }
+
+    /*
+     * Estimates how much a light contributes to this shape, from its
+     * brightness and, for point and spot lights, its attenuation at the
+     * nearest point of the bounds. Returns 0 for lights out of range.
+     */
+    private static float lightWeight(NGLightBase lightBase, float r, float g, float b) {
+        float weight = Math.max(r * 0.299f + g * 0.587f + b * 0.114f, Float.MIN_VALUE);
+        if (lightBase instanceof NGPointLight light) {
+            Affine3D lightWT = light.getWorldTransform();
+            double dx = lightWT.getMxt() - centerX;
+            double dy = lightWT.getMyt() - centerY;
+            double dz = lightWT.getMzt() - centerZ;
+            float d = Math.max((float) Math.sqrt(dx * dx + dy * dy + dz * dz) - radius, 0);
+            if (d > light.getMaxRange()) {
+                return 0;
+            }
+            float attenuation = light.getCa() + light.getLa() * d + light.getQa() * d * d;
+            if (attenuation > 0) {
+                weight = Math.max(weight / attenuation, Float.MIN_VALUE);
+            }
+        }
+        return weight;
+    }
+
+    /*
+     * Keeps the MAX_LIGHTS lights with the largest weight.
+     */
+    private static int selectLight(NGLightBase light, float weight, int order, int count) {
+        int slot = count;
+        if (count == MAX_LIGHTS) {
+            slot = 0;
+            for (int i = 1; i < MAX_LIGHTS; i++) {
+                if (selectedWeights[i] < selectedWeights[slot]) {
+                    slot = i;
+                }
+            }
+            if (selectedWeights[slot] >= weight) {
+                return count;
+            }
+        } else {
+            count++;
+        }
+        selectedLights[slot] = light;
+        selectedWeights[slot] = weight;
+        selectedOrder[slot] = order;
+        return count;
+    }
+
+    /*
+     * Puts the selected lights back in scene order, so that a light keeps
+     * its slot while the selection does not change.
+     */
+    private static void sortSelectedLights(int count) {
+        for (int i = 1; i < count; i++) {
+            for (int j = i; j > 0 && selectedOrder[j - 1] > selectedOrder[j]; j--) {
+                NGLightBase light = selectedLights[j];
+                selectedLights[j] = selectedLights[j - 1];
+                selectedLights[j - 1] = light;
+                int order = selectedOrder[j];
+                selectedOrder[j] = selectedOrder[j - 1];
+                selectedOrder[j - 1] = order;
+                float weight = selectedWeights[j];
+                selectedWeights[j] = selectedWeights[j - 1];
+                selectedWeights[j - 1] = weight;
+            }
+        }
+    }
+
     private boolean noLights(NGLightBase[] lights) {
         return lights == null || lights.length == 0 || lights[0] == null;
     }
@@ -268,9 +374,12 @@ public abstract class NGShape3D extends NGNode {
 
     @Override
     protected void renderContent(Graphics g) {
+        boolean culled = outOfView;
+        outOfView = false;
         if (!Platform.isSupported(ConditionalFeature.SCENE3D) ||
              material == null ||
-             g instanceof com.sun.prism.PrinterGraphics)
+             g instanceof com.sun.prism.PrinterGraphics ||
+             culled)
         {
             return;
         }
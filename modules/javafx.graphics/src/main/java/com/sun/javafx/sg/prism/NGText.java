@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,8 +25,11 @@
 
 package com.sun.javafx.sg.prism;
 
+import com.sun.javafx.font.CharToGlyphMapper;
+import com.sun.javafx.font.CompositeGlyphMapper;
 import com.sun.javafx.font.FontResource;
 import com.sun.javafx.font.FontStrike;
+import com.sun.javafx.font.GlyphRasterizer;
 import com.sun.javafx.font.Metrics;
 import com.sun.javafx.font.PGFont;
 import com.sun.javafx.geom.BaseBounds;
@@ -52,6 +55,52 @@ public class NGText extends NGShape {
     public void setGlyphs(Object[] glyphs) {
         this.runs = (GlyphList[])glyphs;
         geometryChanged();
+        if (GlyphRasterizer.isEnabled()) {
+            prefetchGlyphs();
+        }
+    }
+
+    /*
+     * The transform of the strike last used to render text. It is used to
+     * guess the strike of a node that has not been rendered yet, such as
+     * the scale of a HiDPI screen.
+     */
+    private static BaseTransform lastStrikeTransform = IDENT;
+
+    /**
+     * Starts rasterizing the glyphs of the runs in the background with the
+     * strike this node is expected to be rendered with, so that they are
+     * ready when the node is rendered.
+     */
+    private void prefetchGlyphs() {
+        if (runs == null || font == null) return;
+        FontStrike strike = getStrike(strikeTransform != null ?
+                                      strikeTransform : lastStrikeTransform);
+        if (strike.drawAsShapes()) return;
+        int len = 0;
+        for (GlyphList run : runs) {
+            len += run.getGlyphCount();
+        }
+        int[] glyphCodes = new int[len];
+        int[] subPixels = new int[len];
+        BaseTransform tx = strike.getTransform();
+        Point2D pt = new Point2D();
+        int count = 0;
+        for (GlyphList run : runs) {
+            Point2D location = run.getLocation();
+            for (int gi = 0; gi < run.getGlyphCount(); gi++) {
+                int gc = run.getGlyphCode(gi);
+                if ((gc & CompositeGlyphMapper.GLYPHMASK) == CharToGlyphMapper.INVISIBLE_GLYPH_ID) {
+                    continue;
+                }
+                pt.setLocation(location.x - layoutX + run.getPosX(gi),
+                               location.y - layoutY + run.getPosY(gi));
+                tx.transform(pt, pt);
+                subPixels[count] = strike.getQuantizedPosition(pt);
+                glyphCodes[count++] = gc;
+            }
+        }
+        strike.prefetchGlyphs(glyphCodes, subPixels, count);
     }
 
     private float layoutX, layoutY;
@@ -119,6 +168,7 @@ public class NGText extends NGShape {
     private FontStrike fontStrike = null;
     private FontStrike identityStrike = null;
     private double[] strikeMat = new double[4];
+    private BaseTransform strikeTransform = null;
     private FontStrike getStrike(BaseTransform xform) {
         int smoothingType = fontSmoothingType;
         if (getMode() == Mode.STROKE_FILL) {
@@ -234,6 +284,7 @@ public class NGText extends NGShape {
 
         BaseTransform tx = g.getTransformNoClone();
         FontStrike strike = getStrike(tx);
+        strikeTransform = lastStrikeTransform = strike.getTransform();
 
         if (strike.getAAMode() == FontResource.AA_LCD ||
                 (fillPaint != null && fillPaint.isProportional()) ||
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.sg.prism;
+
+import com.sun.javafx.geom.BaseBounds;
+import com.sun.javafx.geom.transform.BaseTransform;
+import com.sun.javafx.geom.transform.GeneralTransform3D;
+import com.sun.prism.Graphics;
+import com.sun.prism.RenderTarget;
+import com.sun.prism.impl.PrismSettings;
+import java.util.List;
+import java.util.stream.IntStream;
+
+/**
+ * Marks the 3D shapes among the children of a group that lie completely
+ * outside the view volume of the camera, so that they are skipped when the
+ * group is rendered. The test only reads the scene graph, so in groups with
+ * many shapes it is split across threads; drawing itself stays on the
+ * render thread, as neither D3D9 nor OpenGL can record draws elsewhere.
+ */
+final class Shape3DCuller {
+
+    private static final GeneralTransform3D TEMP_PROJ_VIEW_TX = new GeneralTransform3D();
+    private static final double[] TEMP_MATRIX = new double[16];
+
+    private Shape3DCuller() {
+    }
+
+    /**
+     * Marks which of the children from startPos on are out of view, given
+     * the current transform of the graphics.
+     */
+    static void cull(Graphics g, List<NGNode> children, int startPos) {
+        int first = startPos;
+        while (first < children.size() && !(children.get(first) instanceof NGShape3D)) {
+            first++;
+        }
+        NGCamera camera = g.getCameraNoClone();
+        if (first == children.size() || camera == null) {
+            return;
+        }
+
+        // Same projection as the contexts use for the draws
+        GeneralTransform3D projViewTx = camera.getProjViewTx(TEMP_PROJ_VIEW_TX);
+        RenderTarget target = g.getRenderTarget();
+        if (!(camera instanceof NGDefaultCamera) && target != null) {
+            double vw = camera.getViewWidth();
+            double vh = camera.getViewHeight();
+            int w = target.getContentWidth();
+            int h = target.getContentHeight();
+            if (w != vw || h != vh) {
+                projViewTx.scale(vw / w, vh / h, 1.0);
+            }
+        }
+        double[] m = projViewTx.mul(g.getTransformNoClone()).get(TEMP_MATRIX);
+
+        int threshold = PrismSettings.parallel3DThreshold;
+        if (threshold > 0 && children.size() - first >= threshold) {
+            IntStream.range(first, children.size()).parallel().forEach(i -> cull(m, children.get(i)));
+        } else {
+            for (int i = first; i < children.size(); i++) {
+                cull(m, children.get(i));
+            }
+        }
+    }
+
+    private static void cull(double[] m, NGNode child) {
+        if (child instanceof NGShape3D shape) {
+            shape.outOfView = isOutOfView(m, shape.getTransform(), shape.contentBounds);
+        }
+    }
+
+    /*
+     * Returns true if all corners of the bounds are outside the same plane
+     * of the clip volume, -w <= x, y, z <= w.
+     */
+    private static boolean isOutOfView(double[] m, BaseTransform tx, BaseBounds bounds) {
+        if (bounds.isEmpty()) {
+            return false;
+        }
+        int outside = 0x3f;
+        for (int corner = 0; corner < 8 && outside != 0; corner++) {
+            double x = (corner & 1) == 0 ? bounds.getMinX() : bounds.getMaxX();
+            double y = (corner & 2) == 0 ? bounds.getMinY() : bounds.getMaxY();
+            double z = (corner & 4) == 0 ? bounds.getMinZ() : bounds.getMaxZ();
+            double px = tx.getMxx() * x + tx.getMxy() * y + tx.getMxz() * z + tx.getMxt();
+            double py = tx.getMyx() * x + tx.getMyy() * y + tx.getMyz() * z + tx.getMyt();
+            double pz = tx.getMzx() * x + tx.getMzy() * y + tx.getMzz() * z + tx.getMzt();
+            double cx = m[0] * px + m[1] * py + m[2] * pz + m[3];
+            double cy = m[4] * px + m[5] * py + m[6] * pz + m[7];
+            double cz = m[8] * px + m[9] * py + m[10] * pz + m[11];
+            double cw = m[12] * px + m[13] * py + m[14] * pz + m[15];
+            int code = 0;
+            if (cx < -cw) code |= 0x01;
+            if (cx > cw)  code |= 0x02;
+            if (cy < -cw) code |= 0x04;
+            if (cy > cw)  code |= 0x08;
+            if (cz < -cw) code |= 0x10;
+            if (cz > cw)  code |= 0x20;
+            outside &= code;
+        }
+        return outside != 0;
+    }
+}
@@ -61,8 +61,8 @@ public class PrismTextLayout implements TextLayout {
     private static final Hashtable<Integer, LayoutCache> stringCache = new Hashtable<>();
     private static final Object  CACHE_SIZE_LOCK = new Object();
     private static int cacheSize = 0;
-    private static final int MAX_STRING_SIZE = 256;
-    private static final int MAX_CACHE_SIZE = PrismFontFactory.cacheLayoutSize;
+    static final int MAX_STRING_SIZE = 256;
+    static final int MAX_CACHE_SIZE = PrismFontFactory.cacheLayoutSize;
 
     private char[] text;
     private TextSpan[] spans;   /* Rich text  (null for single font text) */
@@ -719,6 +719,39 @@ public class PrismTextLayout implements TextLayout {
         return index;
     }
 
+    /**
+     * Lays out the text so that the result is added to the layout cache,
+     * unless it is there already. Called on the TextLayoutPreparer threads,
+     * so text that is not simple is skipped as its shaping uses the native
+     * glyph layouts.
+     */
+    static void prepareCachedLayout(String text, Object font) {
+        PrismTextLayout layout = new PrismTextLayout();
+        layout.setContent(text, font);
+        if (layout.cacheKey == null) {
+            return;
+        }
+        /* Only layouts with centered bounds are cached, see copyCache() */
+        layout.setBoundsType(BOUNDS_CENTER);
+        layout.initCache();
+        if (layout.lines != null) {
+            return;
+        }
+        layout.buildRuns(layout.text);
+        if (layout.isSimpleLayout()) {
+            layout.layout();
+        }
+    }
+
+    /* For testing: whether the layout cache has the lines of the text */
+    static boolean test_isLayoutCached(String text, Object font) {
+        PrismTextLayout layout = new PrismTextLayout();
+        layout.setContent(text, font);
+        layout.setBoundsType(BOUNDS_CENTER);
+        layout.initCache();
+        return layout.layoutCache != null && layout.lines != null;
+    }
+
     private boolean copyCache() {
         int align = flags & ALIGN_MASK;
         int boundsType = flags & BOUNDS_MASK;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -68,6 +68,16 @@ public class PrismTextLayoutFactory implements TextLayoutFactory {
         }
     }
 
+    @Override
+    public void prepareLayout(String text, Object font) {
+        TextLayoutPreparer.add(text, font);
+    }
+
+    @Override
+    public void prepareLayouts() {
+        TextLayoutPreparer.run();
+    }
+
     private static final PrismTextLayoutFactory factory = new PrismTextLayoutFactory();
     public static PrismTextLayoutFactory getFactory() {
         return factory;
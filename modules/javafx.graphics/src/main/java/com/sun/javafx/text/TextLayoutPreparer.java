@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.text;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Future;
+import com.sun.javafx.font.FontThreadPool;
+import com.sun.javafx.font.PrismFontFactory;
+
+/**
+ * Lays out text on background threads ahead of the layout pass. The text
+ * and font of the nodes whose content changed are queued as the scene is
+ * updated. Just before the layout pass the FX thread splits the batch among
+ * the preparer threads and itself. Each thread lays out its share with its
+ * own PrismTextLayout, which adds the result to the shared layout cache.
+ * The layouts of the nodes then find it there.
+ * Only text the cache holds is prepared: simple text of up to
+ * MAX_STRING_SIZE characters. Complex text is shaped by the native glyph
+ * layouts and stays on the FX thread. The number of threads is set by the
+ * "prism.textLayoutThreads" property, 0 disables the preparer.
+ */
+final class TextLayoutPreparer {
+
+    /* Smaller batches are not worth handing to the preparer threads */
+    private static final int MIN_BATCH_SIZE = 32;
+
+    private static final int threads = PrismFontFactory.textLayoutThreads;
+    private static final ExecutorService executor =
+            PrismTextLayout.MAX_CACHE_SIZE > 0
+                ? FontThreadPool.create("Text Layout Preparer", threads)
+                : null;
+
+    private static ArrayList<String> texts = new ArrayList<>();
+    private static ArrayList<Object> fonts = new ArrayList<>();
+    private static int pendingChars;
+
+    private TextLayoutPreparer() {
+    }
+
+    static synchronized void add(String text, Object font) {
+        if (executor == null || text == null || font == null) {
+            return;
+        }
+        int length = text.length();
+        /* Keep the batch well within the cache so that it is not flushed
+         * before the layouts get to use it.
+         */
+        if (length == 0 || length > PrismTextLayout.MAX_STRING_SIZE ||
+            pendingChars + length > PrismTextLayout.MAX_CACHE_SIZE / 2) {
+            return;
+        }
+        texts.add(text);
+        fonts.add(font);
+        pendingChars += length;
+    }
+
+    static void run() {
+        String[] batchTexts;
+        Object[] batchFonts;
+        synchronized (TextLayoutPreparer.class) {
+            if (texts.isEmpty()) {
+                return;
+            }
+            if (texts.size() < MIN_BATCH_SIZE) {
+                texts.clear();
+                fonts.clear();
+                pendingChars = 0;
+                return;
+            }
+            batchTexts = texts.toArray(new String[texts.size()]);
+            batchFonts = fonts.toArray();
+            texts = new ArrayList<>();
+            fonts = new ArrayList<>();
+            pendingChars = 0;
+        }
+
+        int count = batchTexts.length;
+        int chunk = (count + threads) / (threads + 1);
+        List<Future<?>> futures = new ArrayList<>(threads);
+        int start = chunk;
+        while (start < count) {
+            int from = start;
+            int to = Math.min(count, start + chunk);
+            futures.add(executor.submit(() -> prepare(batchTexts, batchFonts, from, to)));
+            start = to;
+        }
+        prepare(batchTexts, batchFonts, 0, Math.min(count, chunk));
+        for (Future<?> future : futures) {
+            try {
+                future.get();
+            } catch (InterruptedException e) {
+                Thread.currentThread().interrupt();
+                return;
+            } catch (ExecutionException e) {
+                if (PrismFontFactory.debugFonts) {
+                    e.printStackTrace();
+                }
+            }
+        }
+    }
+
+    private static void prepare(String[] texts, Object[] fonts, int from, int to) {
+        for (int i = from; i < to; i++) {
+            try {
+                PrismTextLayout.prepareCachedLayout(texts[i], fonts[i]);
+            } catch (RuntimeException e) {
+                if (PrismFontFactory.debugFonts) {
+                    e.printStackTrace();
+                }
+            }
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -68,6 +68,14 @@ final class EmbeddedScene extends GlassScene implements EmbeddedSceneInterface {
     private volatile int        texLineStride; // pre-scaled
     private volatile float      texScaleFactorX = 1.0f;
     private volatile float      texScaleFactorY = 1.0f;
+    private volatile int        texFrame;
+
+    // The host array that last received a frame, and which frame it was.
+    // Accessed under renderLock.
+    private int[]               lastDestArray;
+    private int                 lastDestFrame;
+    private int                 lastDestWidth;
+    private int                 lastDestHeight;
 
     private volatile PixelFormat<?> pixelFormat;
 
@@ -108,6 +116,7 @@ final class EmbeddedScene extends GlassScene implements EmbeddedSceneInterface {
             painter = null;
             paintRenderJob = null;
             texBits = null;
+            lastDestArray = null;
             return null;
         });
         super.dispose();
@@ -181,6 +190,7 @@ final class EmbeddedScene extends GlassScene implements EmbeddedSceneInterface {
         texLineStride = pixels.getWidthUnsafe();
         texScaleFactorX = pixels.getScaleXUnsafe();
         texScaleFactorY = pixels.getScaleYUnsafe();
+        texFrame++;
         if (host != null) {
             host.repaint();
         }
@@ -240,6 +250,21 @@ final class EmbeddedScene extends GlassScene implements EmbeddedSceneInterface {
             scaledWidth = (int) Math.ceil(scaledWidth * texScaleFactorX);
             scaledHeight = (int) Math.ceil(scaledHeight * texScaleFactorY);
 
+            // Hosts repaint far more often than new frames arrive, skip
+            // copying the frame again into the array that already holds it
+            int frame = texFrame;
+            int[] destArray = dest.hasArray() ? dest.array() : null;
+            if (destArray != null && destArray == lastDestArray &&
+                lastDestFrame == frame &&
+                lastDestWidth == scaledWidth && lastDestHeight == scaledHeight)
+            {
+                return true;
+            }
+            lastDestArray = destArray;
+            lastDestFrame = frame;
+            lastDestWidth = scaledWidth;
+            lastDestHeight = scaledHeight;
+
             dest.rewind();
             texBits.rewind();
             if (dest.capacity() != texBits.capacity()) {
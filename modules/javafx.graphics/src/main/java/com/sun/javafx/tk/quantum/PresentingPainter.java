@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.javafx.tk.quantum;
 
 import com.sun.javafx.logging.PulseLogger;
 import static com.sun.javafx.logging.PulseLogger.PULSE_LOGGING_ENABLED;
+import com.sun.prism.GPUTimer;
 import com.sun.prism.Graphics;
 import com.sun.prism.GraphicsPipeline;
 import com.sun.prism.impl.Disposer;
@@ -86,17 +87,24 @@ final class PresentingPainter extends ViewPainter {
 
             if (presentable != null) {
                 Graphics g = presentable.createGraphics();
+                GPUTimer gpuTimer = g != null ? factory.getGPUTimer() : null;
 
                 ViewScene vs = (ViewScene) sceneState.getScene();
                 if (g != null) {
+                    if (gpuTimer != null) {
+                        gpuTimer.beginFrame();
+                    }
                     paintImpl(g);
                     freshBackBuffer = false;
+                    if (gpuTimer != null) {
+                        gpuTimer.endPaint();
+                    }
                 }
 
                 if (PULSE_LOGGING_ENABLED) {
                     PulseLogger.newPhase("Presenting");
                 }
-                if (!presentable.prepare(null)) {
+                if (!presentable.prepare(getPresentRegion())) {
                     disposePresentable();
                     sceneState.getScene().entireSceneNeedsRepaint();
                     return;
@@ -109,6 +117,9 @@ final class PresentingPainter extends ViewPainter {
                         sceneState.getScene().entireSceneNeedsRepaint();
                     }
                 }
+                if (gpuTimer != null) {
+                    gpuTimer.endFrame();
+                }
             }
         } catch (Throwable th) {
             errored = true;
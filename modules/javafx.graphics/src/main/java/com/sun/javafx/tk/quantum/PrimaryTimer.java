@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@ package com.sun.javafx.tk.quantum;
 import java.util.Map;
 import javafx.animation.Timeline;
 import com.sun.javafx.tk.Toolkit;
+import com.sun.prism.impl.PrismSettings;
 import com.sun.scenario.DelayedRunnable;
 import com.sun.scenario.Settings;
 import com.sun.scenario.animation.AbstractPrimaryTimer;
@@ -94,6 +95,10 @@ public final class PrimaryTimer extends AbstractPrimaryTimer {
             // If not explicitly set in Settings, try to set based on
             // refresh rate of display
             int rate = Toolkit.getToolkit().getRefreshRate();
+            // pulses come no faster than the prism.maxfps frame rate
+            if (PrismSettings.maxFrameRate > 0) {
+                rate = PrismSettings.maxFrameRate;
+            }
             if (rate > 0) {
                 retVal = precision / rate;
             }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -226,7 +226,7 @@ public final class QuantumToolkit extends Toolkit {
     private int                     inPulse = 0;
     private CountDownLatch          launchLatch = new CountDownLatch(1);
 
-    final int                       PULSE_INTERVAL = (int)(TimeUnit.SECONDS.toMillis(1L) / getRefreshRate());
+    final int                       PULSE_INTERVAL = getPulseInterval();
     final int                       FULLSPEED_INTERVAL = 1;     // ms
     boolean                         nativeSystemVsync = false;
     private long                    firstPauseRequestTime = 0;
@@ -390,6 +390,10 @@ public final class QuantumToolkit extends Toolkit {
                  * Application.invokeLater(pulseRunnable);
                  */
                 pulseTimer.start(FULLSPEED_INTERVAL);
+            } else if (PrismSettings.maxFrameRate > 0) {
+                // the capped rate is slower than the display, so neither
+                // the display link nor vsync hints may drive the pulses
+                pulseTimer.start(PULSE_INTERVAL);
             } else {
                 nativeSystemVsync = Screen.getVideoRefreshPeriod() != 0.0;
                 if (nativeSystemVsync) {
@@ -606,7 +610,7 @@ public final class QuantumToolkit extends Toolkit {
     }
 
     void vsyncHint() {
-        if (isVsyncEnabled()) {
+        if (isVsyncEnabled() && PrismSettings.maxFrameRate == 0) {
             if (debug) {
                 System.err.println("QT.vsyncHint: postPulse: " + System.nanoTime());
             }
@@ -900,6 +904,19 @@ public final class QuantumToolkit extends Toolkit {
         }
     }
 
+    /**
+     * Milliseconds between pulses. A prism.maxfps frame rate replaces the
+     * default rate, but not a lower javafx.animation.pulse rate.
+     */
+    private int getPulseInterval() {
+        int rate = getRefreshRate();
+        int maxRate = PrismSettings.maxFrameRate;
+        if (maxRate > 0 && (pulseHZ == null || maxRate < rate)) {
+            rate = maxRate;
+        }
+        return (int)(TimeUnit.SECONDS.toMillis(1L) / rate);
+    }
+
     private DelayedRunnable animationRunnable;
     @Override public void setAnimationRunnable(DelayedRunnable animationRunnable) {
         if (animationRunnable != null) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -99,6 +99,10 @@ abstract class ViewPainter implements Runnable {
     // and if dirty opts are turned off via a runtime flag, then these fields
     // are never initialized or used.
     private Rectangle dirtyRect;
+    // Union of the dirtyRects painted by the last paintImpl, valid only when
+    // nothing outside of them was touched
+    private Rectangle presentRegion;
+    private boolean presentRegionValid;
     private RectBounds clip;
     private RectBounds dirtyRegionTemp;
     private DirtyRegionPool dirtyRegionPool;
@@ -136,6 +140,7 @@ abstract class ViewPainter implements Runnable {
             scaleTx = new Affine3D();
             clip = new RectBounds();
             dirtyRect = new Rectangle();
+            presentRegion = new Rectangle();
             dirtyRegionTemp = new RectBounds();
             dirtyRegionPool = new DirtyRegionPool(PrismSettings.dirtyRegionCount);
             dirtyRegionContainer = dirtyRegionPool.checkOut();
@@ -162,7 +167,17 @@ abstract class ViewPainter implements Runnable {
         }
     }
 
+    /**
+     * Returns the part of the back buffer, in physical pixels, that was
+     * changed by the last call to paintImpl, or null if it may all have changed.
+     */
+    protected final Rectangle getPresentRegion() {
+        return presentRegionValid ? presentRegion : null;
+    }
+
     protected void paintImpl(final Graphics backBufferGraphics) {
+        presentRegionValid = false;
+
         // We should not be painting anything with a width / height
         // that is <= 0, so we might as well bail right off.
         if (width <= 0 || height <= 0 || backBufferGraphics == null) {
@@ -263,6 +278,7 @@ abstract class ViewPainter implements Runnable {
             // NGNode know whether they ought to be paying attention to dirty region
             // culling bits.
             g.setHasPreCullingBits(true);
+            presentRegion.setBounds(0, 0, 0, 0);
 
             // Find the render roots. There is a different render root for each dirty region
             if (PULSE_LOGGING_ENABLED) {
@@ -318,6 +334,11 @@ abstract class ViewPainter implements Runnable {
                     dirtyRect.height = (int) Math.ceil (dirtyRegion.getMaxY() * pixelScaleY) - y0;
                     g.setClipRect(dirtyRect);
                     g.setClipRectIndex(i);
+                    if (presentRegion.isEmpty()) {
+                        presentRegion.setBounds(dirtyRect);
+                    } else {
+                        presentRegion.add(dirtyRect);
+                    }
                     doPaint(g, getRootPath(i));
                     getRootPath(i).clear();
                 }
@@ -335,6 +356,9 @@ abstract class ViewPainter implements Runnable {
             overlayRoot.render(g);
         }
 
+        // The dirty opts debug drawing covers the whole back buffer
+        presentRegionValid = dirtyRegionSize > 0 && !showDirtyOpts && !presentRegion.isEmpty();
+
         // If we're showing dirty regions or overdraw, then we're going to need to draw
         // over-top the normal scene. If we have been drawing do the back buffer, then we
         // will just draw on top of it. If we have been drawing to the sceneBuffer, then
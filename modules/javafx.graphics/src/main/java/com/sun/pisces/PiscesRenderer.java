@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -441,6 +441,48 @@ public final class PiscesRenderer {
 
     private static native void disposeNative(long nativeHandle);
 
+    /**
+     * Names of the native blitter sets, indexed by level.
+     */
+    public static final String[] BLITTER_NAMES = { "scalar", "sse2", "avx2", "neon" };
+
+    /**
+     * Selects the SIMD blitters used by renderers created afterwards.
+     * The best set supported by the processor, but at most the given one,
+     * is used; a name that is not in {@code BLITTER_NAMES} selects the best
+     * supported set.
+     *
+     * @param name name of the blitter set
+     * @return the name of the selected blitter set
+     */
+    public static String selectBlitters(String name) {
+        int maxLevel = -1;
+        for (int i = 0; i < BLITTER_NAMES.length; i++) {
+            if (BLITTER_NAMES[i].equals(name)) {
+                maxLevel = i;
+            }
+        }
+        int level = selectBlittersImpl(maxLevel);
+        return (level >= 0 && level < BLITTER_NAMES.length) ? BLITTER_NAMES[level] : "scalar";
+    }
+
+    private static native int selectBlittersImpl(int maxLevel);
+
+    /**
+     * Sets the number of threads, including the calling one, that large
+     * fills of all renderers are split across. Each thread renders a
+     * horizontal band of the fill and the fill completes before the call
+     * returns.
+     *
+     * @param threads the number of threads, 1 to render on the caller only
+     * @return the number of threads actually used
+     */
+    public static int setThreads(int threads) {
+        return setThreadsImpl(threads);
+    }
+
+    private static native int setThreadsImpl(int threads);
+
     private static class PiscesRendererDisposerRecord implements Disposer.Record {
         private long nativeHandle;
 
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.prism;
+
+/**
+ * Measures how long the GPU spends painting and presenting each frame,
+ * using timestamp queries issued into the command stream. The times of a
+ * frame become available a few frames after it was issued, once the GPU
+ * has executed it.
+ */
+public interface GPUTimer {
+
+    /**
+     * The GPU times of a frame, in nanoseconds.
+     */
+    public record FrameTimes(long paintNanos, long presentNanos) {}
+
+    /**
+     * Marks the start of a frame. Must be called with the context current
+     * and before anything is rendered to the frame.
+     */
+    public void beginFrame();
+
+    /**
+     * Marks the end of painting and the start of presenting.
+     */
+    public void endPaint();
+
+    /**
+     * Marks the end of the frame, after it has been presented.
+     */
+    public void endFrame();
+
+    /**
+     * Returns the times of the most recent frame the GPU has finished, or
+     * null if none is available yet.
+     */
+    public FrameTimes getLastFrameTimes();
+}
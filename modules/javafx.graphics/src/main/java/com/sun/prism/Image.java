@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,7 @@ import java.nio.ByteBuffer;
 import java.nio.FloatBuffer;
 import java.nio.IntBuffer;
 import com.sun.javafx.geom.Rectangle;
+import com.sun.javafx.iio.CompressedImageData;
 import com.sun.javafx.iio.ImageFrame;
 import com.sun.javafx.iio.ImageStorage;
 import com.sun.javafx.image.BytePixelGetter;
@@ -74,6 +75,9 @@ public class Image implements PlatformImage {
     private final PixelFormat pixelFormat;
     private final float pixelScale;
     private Serial serial = new Serial();
+    // The block compressed pixels the image was decoded from, if any.
+    // Dropped once the pixels are modified.
+    private CompressedImageData compressedData;
 
     public static Image fromIntArgbPreData(int[] pixels, int width, int height) {
         return new Image(PixelFormat.INT_ARGB_PRE, pixels, width, height);
@@ -234,7 +238,9 @@ public class Image implements PlatformImage {
                 ByteRgba.ToByteBgraConverter().convert(buffer, 0, scanBytes,
                                                        buffer, 0, scanBytes,
                                                        w, h);
-                return Image.fromByteBgraPreData(buffer, w, h, scanBytes, ps);
+                Image image = Image.fromByteBgraPreData(buffer, w, h, scanBytes, ps);
+                image.compressedData = frame.getCompressedData();
+                return image;
 
             case GRAY_ALPHA:
                 // TODO: 3D - need a way to handle pre versus non-Pre
@@ -358,6 +364,15 @@ public class Image implements PlatformImage {
         return pixelScale;
     }
 
+    /**
+     * Returns the block compressed pixels this image was decoded from, or
+     * null. A texture may be created from them instead of the decoded
+     * pixels.
+     */
+    public CompressedImageData getCompressedData() {
+        return compressedData;
+    }
+
     public int getRowLength() {
         // Note that the constructor ensures that scanlineStride is a
         // multiple of pixelStride, so the following should be safe
@@ -587,6 +602,7 @@ public class Image implements PlatformImage {
     }
 
     private void updateSerial(Rectangle rect) {
+        compressedData = null;
         serial.update(rect);
     }
 
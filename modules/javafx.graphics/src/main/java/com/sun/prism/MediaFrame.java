@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,13 @@ public interface MediaFrame {
      */
     public PixelFormat getPixelFormat();
 
+    /**
+     * @return handle of the native surface holding this frame on the GPU
+     * (an {@code IOSurfaceRef} on macOS), or zero if there is none. It is
+     * only valid while the frame is held.
+     */
+    public long getNativeSurface();
+
     /**
      * @return width in pixels of the video image contained in this frame
      */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -198,8 +198,10 @@ public final class MultiTexture implements Texture {
 
     @Override
     public void update(MediaFrame frame, boolean skipFlush) {
-        if (frame.getPixelFormat() == PixelFormat.MULTI_YCbCr_420) {
+        PixelFormat frameFormat = frame.getPixelFormat();
+        if (frameFormat.isMultiTexture()) {
             // call update(..) on each texture
+            PixelFormat planeFormat = frameFormat.getPlaneFormat();
             Texture tex;
             int encWidth = frame.getEncodedWidth();
             int encHeight = frame.getEncodedHeight();
@@ -217,7 +219,7 @@ public final class MultiTexture implements Texture {
                     }
 
                     ByteBuffer pixels = frame.getBufferForPlane(index);
-                    tex.update(pixels, PixelFormat.BYTE_ALPHA,
+                    tex.update(pixels, planeFormat,
                             0, 0,
                             0, 0, texWidth, texHeight,
                             frame.strideForPlane(index), skipFlush);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,7 +48,20 @@ public enum PixelFormat {
     BYTE_APPLE_422 (DataType.BYTE, 2, false, true),
 
     // flating point types:
-    FLOAT_XYZW     (DataType.FLOAT, 4, false, true);
+    FLOAT_XYZW     (DataType.FLOAT, 4, false, true),
+
+    // L8A8 type, used for the planes of MULTI_YCbCr_420_10 with the low byte
+    // of each sample in luminance and the high byte in alpha
+    BYTE_GRAY_ALPHA(DataType.BYTE,  2, false, false),
+
+    // Planar YCbCr 4:2:0 with 10 bit samples in 16 bit little endian words,
+    // multitexture format, requires pixel shader support
+    MULTI_YCbCr_420_10(DataType.BYTE, 2, false, true);
+
+    /*
+     * NOTE: BYTE_GRAY_ALPHA and MULTI_YCbCr_420_10 are listed last so that
+     * the ordinals of the other formats do not change.
+     */
 
     /*
      * NOTE: BYTE_APPLE_422 is assumed to be '2vuy' component data, NOT 'yuvs'!
@@ -109,4 +122,19 @@ public enum PixelFormat {
     public boolean isOpaque() {
         return opaque;
     }
+
+    /**
+     * Returns true for the planar YCbCr formats, which are drawn from a
+     * {@code MultiTexture} holding a texture per plane.
+     */
+    public boolean isMultiTexture() {
+        return this == MULTI_YCbCr_420 || this == MULTI_YCbCr_420_10;
+    }
+
+    /**
+     * Returns the format of the per plane textures of a multitexture format.
+     */
+    public PixelFormat getPlaneFormat() {
+        return this == MULTI_YCbCr_420_10 ? BYTE_GRAY_ALPHA : BYTE_ALPHA;
+    }
 }
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.prism;
+
+import java.nio.Buffer;
+
+/**
+ * A read of render target pixels that was issued to the GPU and completes
+ * later, see {@link RTTexture#readPixelsAsync}. All methods must be called
+ * on the render thread.
+ */
+public interface PixelReadback {
+    /**
+     * Returns true once the pixels are available, so that {@link #complete}
+     * does not have to wait for the GPU.
+     */
+    public boolean isDone();
+
+    /**
+     * Waits for the read if needed, copies the pixels into the given buffer
+     * in the same layout as {@link RTTexture#readPixels(Buffer)} and
+     * releases the readback.
+     */
+    public boolean complete(Buffer pixels);
+
+    /**
+     * Releases the readback without copying its pixels.
+     */
+    public void dispose();
+}
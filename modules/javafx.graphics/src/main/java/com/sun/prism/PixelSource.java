@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 package com.sun.prism;
 
 import com.sun.glass.ui.Pixels;
+import com.sun.javafx.geom.Rectangle;
 
 /**
  * An interface to facilitate the asynchronous delivery of frames of pixels
@@ -59,6 +60,17 @@ public interface PixelSource {
      */
     public void doneWithPixels(Pixels used);
 
+    /**
+     * Returns the area of the {@code Pixels} last obtained from
+     * {@link #getLatestPixels()} that differs from the ones consumed before,
+     * or null if the whole frame has to be displayed.
+     *
+     * @return the changed area, or null for the whole frame
+     */
+    public default Rectangle getLatestDirtyRegion() {
+        return null;
+    }
+
     /**
      * A one step method for skipping a pixel delivery object in the case
      * where the consumer is not ready to process any pixels.
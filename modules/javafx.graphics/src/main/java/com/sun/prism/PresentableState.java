@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@ import com.sun.glass.ui.Pixels;
 import com.sun.glass.ui.Screen;
 import com.sun.glass.ui.View;
 import com.sun.glass.ui.Window;
+import com.sun.javafx.geom.Rectangle;
 
 /**
  * PresentableState is intended to provide for a shadow copy of View/Window
@@ -305,7 +306,12 @@ public abstract class PresentableState {
         Pixels pixels = source.getLatestPixels();
         if (pixels != null) {
             try {
-                view.uploadPixels(pixels);
+                Rectangle dirty = source.getLatestDirtyRegion();
+                if (dirty == null) {
+                    view.uploadPixels(pixels);
+                } else {
+                    view.uploadPixels(pixels, dirty.x, dirty.y, dirty.width, dirty.height);
+                }
             } finally {
                 source.doneWithPixels(pixels);
             }
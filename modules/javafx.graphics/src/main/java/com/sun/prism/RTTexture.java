@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,5 +31,14 @@ public interface RTTexture extends Texture, RenderTarget {
     public int[] getPixels();
     public boolean readPixels(Buffer pixels);
     public boolean readPixels(Buffer pixels, int x, int y, int width, int height);
+
+    /**
+     * Starts reading a region of this render target without waiting for
+     * the GPU. Returns null if the pipeline cannot read asynchronously, in
+     * which case the caller uses {@link #readPixels} instead.
+     */
+    default PixelReadback readPixelsAsync(int x, int y, int width, int height) {
+        return null;
+    }
     public boolean isVolatile();
 }
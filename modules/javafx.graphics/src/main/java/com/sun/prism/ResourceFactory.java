@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -266,6 +266,12 @@ public interface ResourceFactory extends GraphicsResource {
     public Texture getGlyphTexture();
     public boolean isSuperShaderAllowed();
 
+    /**
+     * Returns the timer of the GPU time of frames, or null if GPU timing is
+     * not enabled with the prism.gputiming property or not supported.
+     */
+    public GPUTimer getGPUTimer();
+
     /*
      * 3D stuff
      */
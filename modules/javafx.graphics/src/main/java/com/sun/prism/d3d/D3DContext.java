@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,6 +39,7 @@ import com.sun.prism.MeshView;
 import com.sun.prism.RTTexture;
 import com.sun.prism.RenderTarget;
 import com.sun.prism.Texture;
+import com.sun.prism.impl.BaseGPUTimer;
 import com.sun.prism.impl.PrismSettings;
 import com.sun.prism.impl.ps.BaseShaderContext;
 import com.sun.prism.ps.Shader;
@@ -66,6 +67,11 @@ class D3DContext extends BaseShaderContext {
     public static final int D3DTADDRESS_CLAMP           = 3;
     public static final int D3DTADDRESS_BORDER          = 4;
 
+    // Results of nGetTimerFrameResults
+    static final int TIMER_RESULT_NOT_READY = BaseGPUTimer.RESULT_NOT_READY;
+    static final int TIMER_RESULT_VALID = BaseGPUTimer.RESULT_VALID;
+    static final int TIMER_RESULT_INVALID = BaseGPUTimer.RESULT_INVALID;
+
     // Use by face culling for 3D implementation
     public final static int CULL_BACK                  = 110;
     public final static int CULL_FRONT                 = 111;
@@ -303,10 +309,12 @@ class D3DContext extends BaseShaderContext {
         long texHandle;
         boolean linear;
         int wrapMode;
+        int maxAnisotropy;
         if (tex != null) {
             D3DTexture d3dtex = (D3DTexture)tex;
             texHandle = d3dtex.getNativeSourceHandle();
             linear = tex.getLinearFiltering();
+            maxAnisotropy = tex.getUseMipmap() ? PrismSettings.maxAnisotropy : 1;
             switch (tex.getWrapMode()) {
                 case CLAMP_NOT_NEEDED:
                     wrapMode = D3DTADDRESS_NOP;
@@ -330,8 +338,9 @@ class D3DContext extends BaseShaderContext {
             texHandle = 0L;
             linear = false;
             wrapMode = D3DTADDRESS_CLAMP;
+            maxAnisotropy = 1;
         }
-        validate(nSetTexture(pContext, texHandle, texUnit, linear, wrapMode));
+        validate(nSetTexture(pContext, texHandle, texUnit, linear, wrapMode, maxAnisotropy));
     }
 
     @Override
@@ -428,7 +437,7 @@ class D3DContext extends BaseShaderContext {
      */
     private static native int nSetRenderTarget(long pContext, long pDest, boolean depthBuffer, boolean msaa);
     private static native int nSetTexture(long pContext, long pTex, int texUnit,
-        boolean linear, int wrapMode);
+        boolean linear, int wrapMode, int maxAnisotropy);
     private static native int nResetTransform(long pContext);
     private static native int nSetTransform(long pContext,
         double m00, double m01, double m02, double m03,
@@ -460,6 +469,8 @@ class D3DContext extends BaseShaderContext {
             float[] vertexBuffer, int vertexBufferLength, short[] indexBuffer, int indexBufferLength);
     private static native boolean nBuildNativeGeometryInt(long pContext, long nativeHandle,
             float[] vertexBuffer, int vertexBufferLength, int[] indexBuffer, int indexBufferLength);
+    private static native boolean nUpdateNativeVertices(long pContext, long nativeHandle,
+            float[] vertexBuffer, int vertexBufferLength, int dirtyFrom, int dirtyTo);
     private static native long nCreateD3DPhongMaterial(long pContext);
     private static native void nReleaseD3DPhongMaterial(long pContext, long nativeHandle);
     private static native void nSetDiffuseColor(long pContext, long nativePhongMaterial,
@@ -498,6 +509,13 @@ class D3DContext extends BaseShaderContext {
     private static native boolean nGetFrameStats(long pContext,
             D3DFrameStats returnValue, boolean bReset);
 
+    private static native long nCreateTimerFrame(long pContext, int numTimestamps);
+    private static native void nBeginTimerFrame(long nativeFrame);
+    private static native void nTimestamp(long nativeFrame, int index);
+    private static native void nEndTimerFrame(long nativeFrame);
+    private static native int nGetTimerFrameResults(long nativeFrame, long[] nanos);
+    private static native void nReleaseTimerFrame(long nativeFrame);
+
     public static String hResultToString(long hResult) {
         switch ((int)hResult) {
             case D3DERR_DEVICELOST:
@@ -531,6 +549,32 @@ class D3DContext extends BaseShaderContext {
         nSetDeviceParametersFor3D(pContext);
     }
 
+    long createTimerFrame(int numTimestamps) {
+        if (checkDisposed()) return 0;
+
+        return nCreateTimerFrame(pContext, numTimestamps);
+    }
+
+    void beginTimerFrame(long nativeFrame) {
+        nBeginTimerFrame(nativeFrame);
+    }
+
+    void timestamp(long nativeFrame, int index) {
+        nTimestamp(nativeFrame, index);
+    }
+
+    void endTimerFrame(long nativeFrame) {
+        nEndTimerFrame(nativeFrame);
+    }
+
+    int getTimerFrameResults(long nativeFrame, long[] nanos) {
+        return nGetTimerFrameResults(nativeFrame, nanos);
+    }
+
+    void releaseTimerFrame(long nativeFrame) {
+        nReleaseTimerFrame(nativeFrame);
+    }
+
     long createD3DMesh() {
         if (checkDisposed()) return 0;
 
@@ -554,6 +598,12 @@ class D3DContext extends BaseShaderContext {
                 vertexBufferLength, indexBuffer, indexBufferLength);
     }
 
+    boolean updateNativeVertices(long nativeHandle, float[] vertexBuffer,
+            int vertexBufferLength, int dirtyFrom, int dirtyTo) {
+        return nUpdateNativeVertices(pContext, nativeHandle, vertexBuffer,
+                vertexBufferLength, dirtyFrom, dirtyTo);
+    }
+
     long createD3DPhongMaterial() {
         return nCreateD3DPhongMaterial(pContext);
     }
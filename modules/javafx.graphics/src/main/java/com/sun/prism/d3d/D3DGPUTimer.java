@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.prism.d3d;
+
+import com.sun.prism.impl.BaseGPUTimer;
+
+/**
+ * Times frames with D3DQUERYTYPE_TIMESTAMP queries. A timestamp disjoint
+ * query around each frame discards frames during which the GPU clock
+ * changed.
+ */
+final class D3DGPUTimer extends BaseGPUTimer {
+
+    private final D3DContext context;
+
+    D3DGPUTimer(D3DContext context) {
+        super(context);
+        this.context = context;
+    }
+
+    @Override
+    protected long createFrame(int numTimestamps) {
+        return context.createTimerFrame(numTimestamps);
+    }
+
+    @Override
+    protected void beginFrame(long frame) {
+        context.beginTimerFrame(frame);
+    }
+
+    @Override
+    protected void timestamp(long frame, int index) {
+        context.timestamp(frame, index);
+    }
+
+    @Override
+    protected void endFrame(long frame) {
+        context.endTimerFrame(frame);
+    }
+
+    @Override
+    protected int getResults(long frame, long[] nanos) {
+        return context.getTimerFrameResults(frame, nanos);
+    }
+
+    @Override
+    protected void disposeFrame(long frame) {
+        context.releaseTimerFrame(frame);
+    }
+}
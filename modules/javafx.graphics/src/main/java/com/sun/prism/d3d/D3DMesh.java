@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,11 +36,13 @@ class D3DMesh extends BaseMesh {
 
     private final D3DContext context;
     private final long nativeHandle;
+    private final D3DMeshDisposerRecord meshRecord;
 
-    private D3DMesh(D3DContext context, long nativeHandle, Disposer.Record disposerRecord) {
+    private D3DMesh(D3DContext context, long nativeHandle, D3DMeshDisposerRecord disposerRecord) {
         super(disposerRecord);
         this.context = context;
         this.nativeHandle = nativeHandle;
+        this.meshRecord = disposerRecord;
         count++;
     }
 
@@ -72,27 +74,51 @@ class D3DMesh extends BaseMesh {
     @Override
     public boolean buildNativeGeometry(float[] vertexBuffer, int vertexBufferLength,
             int[] indexBufferInt, int indexBufferLength) {
-        return context.buildNativeGeometry(nativeHandle, vertexBuffer,
+        boolean result = context.buildNativeGeometry(nativeHandle, vertexBuffer,
                 vertexBufferLength, indexBufferInt, indexBufferLength);
+        if (result) {
+            meshRecord.setBufferSize(4L * vertexBufferLength + 4L * indexBufferLength);
+        }
+        return result;
     }
 
     @Override
     public boolean buildNativeGeometry(float[] vertexBuffer, int vertexBufferLength,
             short[] indexBufferShort, int indexBufferLength) {
-        return context.buildNativeGeometry(nativeHandle, vertexBuffer,
+        boolean result = context.buildNativeGeometry(nativeHandle, vertexBuffer,
                 vertexBufferLength, indexBufferShort, indexBufferLength);
+        if (result) {
+            meshRecord.setBufferSize(4L * vertexBufferLength + 2L * indexBufferLength);
+        }
+        return result;
+    }
+
+    @Override
+    public boolean updateNativeVertices(float[] vertexBuffer, int vertexBufferLength,
+            int dirtyFrom, int dirtyTo) {
+        return context.updateNativeVertices(nativeHandle, vertexBuffer,
+                vertexBufferLength, dirtyFrom, dirtyTo);
     }
 
     static class D3DMeshDisposerRecord implements Disposer.Record {
 
         private final D3DContext context;
         private long nativeHandle;
+        // bytes held by the native vertex and index buffers, accounted
+        // as unmanaged memory of the vram pool
+        private long bufferSize;
 
         D3DMeshDisposerRecord(D3DContext context, long nativeHandle) {
             this.context = context;
             this.nativeHandle = nativeHandle;
         }
 
+        void setBufferSize(long size) {
+            D3DVramPool.instance.recordUnmanagedFree(bufferSize);
+            D3DVramPool.instance.recordUnmanagedAllocated(size);
+            bufferSize = size;
+        }
+
         void traceDispose() {}
 
         @Override
@@ -101,6 +127,8 @@ class D3DMesh extends BaseMesh {
                 traceDispose();
                 context.releaseD3DMesh(nativeHandle);
                 nativeHandle = 0L;
+                D3DVramPool.instance.recordUnmanagedFree(bufferSize);
+                bufferSize = 0L;
             }
         }
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -61,7 +61,9 @@ class D3DMeshView extends BaseMeshView {
 
     @Override
     public void setCullingMode(int cullingMode) {
-        context.setCullingMode(nativeHandle, cullingMode);
+        if (updateCullingMode(cullingMode)) {
+            context.setCullingMode(nativeHandle, cullingMode);
+        }
     }
 
     @Override
@@ -78,7 +80,9 @@ class D3DMeshView extends BaseMeshView {
 
     @Override
     public void setAmbientLight(float r, float g, float b) {
-        context.setAmbientLight(nativeHandle, r, g, b);
+        if (updateAmbientLight(r, g, b)) {
+            context.setAmbientLight(nativeHandle, r, g, b);
+        }
     }
 
     @Override
@@ -86,7 +90,8 @@ class D3DMeshView extends BaseMeshView {
             float ca, float la, float qa, float isAttenuated, float maxRange, float dirX, float dirY, float dirZ,
             float innerAngle, float outerAngle, float falloff) {
         // NOTE: We only support up to 3 point lights at the present
-        if (index >= 0 && index <= 2) {
+        if (updateLight(index, x, y, z, r, g, b, w, ca, la, qa, isAttenuated, maxRange,
+                dirX, dirY, dirZ, innerAngle, outerAngle, falloff)) {
             context.setLight(nativeHandle, index, x, y, z, r, g, b, w, ca, la, qa, isAttenuated, maxRange,
                     dirX, dirY, dirZ, innerAngle, outerAngle, falloff);
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -149,6 +149,7 @@ public final class D3DPipeline extends GraphicsPipeline {
 
     private static native int nGetAdapterOrdinal(long hMonitor);
     private static native int nGetAdapterCount();
+    private static native int nGetPreferredAdapter();
 
     /*
      * This method fill object with data and return an argument
@@ -257,7 +258,14 @@ public final class D3DPipeline extends GraphicsPipeline {
             }
         }
 
-        for (int adapter = 0, n = nGetAdapterCount(); adapter != n; ++adapter) {
+        // Try the preferred adapter first, then the others in order. All
+        // windows render with this factory, whichever monitor they are on.
+        int preferred = nGetPreferredAdapter();
+        for (int i = -1, n = nGetAdapterCount(); i != n; ++i) {
+            int adapter = i < 0 ? preferred : i;
+            if (i == preferred || adapter >= n) {
+                continue;
+            }
             D3DResourceFactory rf =
                     getD3DResourceFactory(adapter, getScreenForAdapter(screens, adapter));
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -87,16 +87,12 @@ class D3DRTTexture extends D3DTexture
 
     @Override
     public boolean readPixels(Buffer pixels, int x, int y, int width, int height) {
-        if (x != getContentX() || y != getContentY()
-                || width != getContentWidth() || height != getContentHeight())
+        if (x < getContentX() || y < getContentY() || width <= 0 || height <= 0
+                || x - getContentX() > getContentWidth() - width
+                || y - getContentY() > getContentHeight() - height)
         {
-            throw new IllegalArgumentException("reading subtexture not yet supported!");
+            throw new IllegalArgumentException("region is outside of the content");
         }
-        return readPixels(pixels);
-    }
-
-    @Override
-    public boolean readPixels(Buffer pixels) {
         final D3DContext context = getContext();
         if (context.isDisposed()) {
             return false;
@@ -111,14 +107,14 @@ class D3DRTTexture extends D3DTexture
             long length = buf.capacity();
             res = D3DResourceFactory.nReadPixelsB(ctx, getNativeSourceHandle(),
                                                   length, pixels, arr,
-                                                  getContentWidth(), getContentHeight());
+                                                  x, y, width, height);
         } else if (pixels instanceof IntBuffer) {
             IntBuffer buf = (IntBuffer) pixels;
             int[] arr = buf.hasArray() ? buf.array() : null;
             long length = buf.capacity()*4;
             res = D3DResourceFactory.nReadPixelsI(ctx, getNativeSourceHandle(),
                                                   length, pixels, arr,
-                                                  getContentWidth(), getContentHeight());
+                                                  x, y, width, height);
         } else {
             throw new IllegalArgumentException("Buffer of this type is " +
                                                "not supported: "+pixels);
@@ -126,6 +122,12 @@ class D3DRTTexture extends D3DTexture
         return context.validatePresent(res);
     }
 
+    @Override
+    public boolean readPixels(Buffer pixels) {
+        return readPixels(pixels, getContentX(), getContentY(),
+                          getContentWidth(), getContentHeight());
+    }
+
     @Override
     public Screen getAssociatedScreen() {
         return getContext().getAssociatedScreen();
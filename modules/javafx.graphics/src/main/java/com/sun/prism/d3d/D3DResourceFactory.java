@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,8 @@ import java.util.ListIterator;
 import java.util.Map;
 
 import com.sun.glass.ui.Screen;
+import com.sun.javafx.iio.CompressedImageData;
+import com.sun.prism.GPUTimer;
 import com.sun.prism.Image;
 import com.sun.prism.MediaFrame;
 import com.sun.prism.Mesh;
@@ -75,11 +77,16 @@ class D3DResourceFactory extends BaseShaderFactory {
     private final LinkedList<D3DResource.D3DRecord> records =
         new LinkedList<>();
 
+    private D3DGPUTimer gpuTimer;
+
     D3DResourceFactory(long pContext, Screen screen) {
         super(clampTexCache, repeatTexCache, mipmapTexCache);
         context = new D3DContext(pContext, screen, this);
         context.initState();
         maxTextureSize = computeMaxTextureSize();
+        if (PrismSettings.shaderWarmup) {
+            context.warmUpShaders();
+        }
 
         if (PrismSettings.noClampToZero && PrismSettings.verbose) {
             System.out.println("prism.noclamptozero not supported by D3D");
@@ -90,6 +97,14 @@ class D3DResourceFactory extends BaseShaderFactory {
         return context;
     }
 
+    @Override
+    public GPUTimer getGPUTimer() {
+        if (gpuTimer == null && PrismSettings.gpuTiming) {
+            gpuTimer = new D3DGPUTimer(context);
+        }
+        return gpuTimer;
+    }
+
     @Override
     public TextureResourcePool getTextureResourcePool() {
         return D3DVramPool.instance;
@@ -177,13 +192,12 @@ class D3DResourceFactory extends BaseShaderFactory {
         }
 
         D3DVramPool pool = D3DVramPool.instance;
-        long size = pool.estimateTextureSize(allocw, alloch, format);
+        long size = pool.estimateTextureSize(allocw, alloch, format, useMipmap);
         if (!pool.prepareForAllocation(size)) {
             return null;
         }
-        long pResource = nCreateTexture(context.getContextHandle(),
-                                        format.ordinal(), usagehint.ordinal(),
-                                        false /*isRTT*/, allocw, alloch, 0, useMipmap);
+        long pResource = createTexture(format, usagehint, false /*isRTT*/,
+                                       allocw, alloch, 0, useMipmap, size);
         if (pResource == 0L) {
             return null;
         }
@@ -193,7 +207,49 @@ class D3DResourceFactory extends BaseShaderFactory {
         if (wrapMode != WrapMode.CLAMP_NOT_NEEDED && (w < texw || h < texh)) {
             wrapMode = wrapMode.simulatedVersion();
         }
-        return new D3DTexture(context, format, wrapMode, pResource, texw, texh, w, h, useMipmap);
+        return new D3DTexture(context, format, wrapMode, pResource, texw, texh,
+                              0, 0, w, h, false /*isRTT*/, 0, useMipmap);
+    }
+
+    @Override
+    protected boolean isCompressedFormatSupported(CompressedImageData.Format format) {
+        // DXT1, DXT3 and DXT5 are available on all D3D9 hardware
+        return true;
+    }
+
+    @Override
+    protected Texture createCompressedTexture(CompressedImageData data,
+                                              WrapMode wrapMode, boolean useMipmap) {
+        if (checkDisposed()) return null;
+
+        int w = data.getWidth();
+        int h = data.getHeight();
+        if (w > getMaximumTextureSize() || h > getMaximumTextureSize()) {
+            return null;
+        }
+        int format;
+        switch (data.getFormat()) {
+            case BC1: format = COMPRESSED_FORMAT_BC1; break;
+            case BC2: format = COMPRESSED_FORMAT_BC2; break;
+            case BC3: format = COMPRESSED_FORMAT_BC3; break;
+            default: return null;
+        }
+        byte[][] levels = new byte[useMipmap ? data.getLevelCount() : 1][];
+        for (int i = 0; i < levels.length; i++) {
+            levels[i] = data.getLevel(i);
+        }
+
+        D3DVramPool pool = D3DVramPool.instance;
+        long size = data.getSize(levels.length);
+        if (!pool.prepareForAllocation(size)) {
+            return null;
+        }
+        long pResource = nCreateCompressedTexture(context.getContextHandle(),
+                                                  format, w, h, levels);
+        if (pResource == 0L) {
+            return null;
+        }
+        return new D3DTexture(context, pResource, w, h, size, useMipmap);
     }
 
     @Override
@@ -254,9 +310,8 @@ class D3DResourceFactory extends BaseShaderFactory {
             if (!pool.prepareForAllocation(size)) {
                 return null;
             }
-            long pResource = nCreateTexture(context.getContextHandle(),
-                    texFormat.ordinal(), Usage.DYNAMIC.ordinal(),
-                    false, texWidth, texHeight, 0, false);
+            long pResource = createTexture(texFormat, Usage.DYNAMIC,
+                    false, texWidth, texHeight, 0, false, size);
             if (0 == pResource) {
                 return null;
             }
@@ -338,16 +393,13 @@ class D3DResourceFactory extends BaseShaderFactory {
         } else {
             aaSamples = 0;
         }
-        // TODO: 3D - Improve estimate to include if multisample rtt
-        long size = pool.estimateRTTextureSize(width, height, false);
+        long size = pool.estimateRTTextureSize(createw, createh, aaSamples, false);
         if (!pool.prepareForAllocation(size)) {
             return null;
         }
 
-        long pResource = nCreateTexture(context.getContextHandle(),
-                                        format.ordinal(),
-                                        Usage.DEFAULT.ordinal(),
-                                        true /*isRTT*/, createw, createh, aaSamples, false);
+        long pResource = createTexture(format, Usage.DEFAULT, true /*isRTT*/,
+                                       createw, createh, aaSamples, false, size);
         if (pResource == 0L) {
             return null;
         }
@@ -363,6 +415,26 @@ class D3DResourceFactory extends BaseShaderFactory {
         return rtt;
     }
 
+    /**
+     * Creates a native texture of the indicated estimated size. Should the
+     * device run out of memory, the pool is asked to make room and the
+     * allocation is tried once more.
+     */
+    private long createTexture(PixelFormat format, Usage usagehint, boolean isRTT,
+                               int width, int height, int samples, boolean useMipmap,
+                               long size)
+    {
+        long pResource = nCreateTexture(context.getContextHandle(),
+                                        format.ordinal(), usagehint.ordinal(),
+                                        isRTT, width, height, samples, useMipmap);
+        if (pResource == 0L && D3DVramPool.instance.allocationFailed(size)) {
+            pResource = nCreateTexture(context.getContextHandle(),
+                                       format.ordinal(), usagehint.ordinal(),
+                                       isRTT, width, height, samples, useMipmap);
+        }
+        return pResource;
+    }
+
     @Override
     public Presentable createPresentable(PresentableState pState) {
         if (checkDisposed()) return null;
@@ -373,18 +445,22 @@ class D3DResourceFactory extends BaseShaderFactory {
 
         long pResource = nCreateSwapChain(context.getContextHandle(),
                                           pState.getNativeView(),
-                                          PrismSettings.isVsyncEnabled);
+                                          PrismSettings.isVsyncEnabled,
+                                          PrismSettings.flipModel,
+                                          PrismSettings.maxFrameLatency);
 
         if (pResource != 0L) {
             int width = pState.getRenderWidth();
             int height = pState.getRenderHeight();
             D3DRTTexture rtt = createRTTexture(width, height, WrapMode.CLAMP_NOT_NEEDED, pState.isMSAA());
-            if (PrismSettings.dirtyOptsEnabled) {
-                rtt.contentsUseful();
-            }
-
             if (rtt != null) {
-                return new D3DSwapChain(context, pResource, rtt, pState.getRenderScaleX(), pState.getRenderScaleY());
+                if (PrismSettings.dirtyOptsEnabled) {
+                    rtt.contentsUseful();
+                }
+                // The swap chain buffers live outside of the pool, a flip
+                // model swap chain keeps two of them
+                long size = 4L * width * height * (PrismSettings.flipModel ? 2 : 1);
+                return new D3DSwapChain(context, pResource, rtt, pState.getRenderScaleX(), pState.getRenderScaleY(), size);
             }
 
             D3DResourceFactory.nReleaseResource(context.getContextHandle(), pResource);
@@ -468,7 +544,14 @@ class D3DResourceFactory extends BaseShaderFactory {
 
     @Override
     public boolean isFormatSupported(PixelFormat format) {
-        return true;
+        switch (format) {
+            case BYTE_GRAY_ALPHA:
+            case MULTI_YCbCr_420_10:
+                // no L8A8 textures or shader for 10 bit video
+                return false;
+            default:
+                return true;
+        }
     }
 
     private int computeMaxTextureSize() {
@@ -492,6 +575,10 @@ class D3DResourceFactory extends BaseShaderFactory {
 
     @Override
     protected void notifyReset() {
+        if (gpuTimer != null) {
+            // Pending queries do not survive a reset
+            gpuTimer.dispose();
+        }
         for (ListIterator<D3DRecord> it = records.listIterator(); it.hasNext();) {
             D3DRecord r = it.next();
             if (r.isDefaultPool()) {
@@ -504,6 +591,10 @@ class D3DResourceFactory extends BaseShaderFactory {
 
     @Override
     public void dispose() {
+        if (gpuTimer != null) {
+            gpuTimer.dispose();
+            gpuTimer = null;
+        }
         context.dispose();
 
         for (ListIterator<D3DRecord> it = records.listIterator(); it.hasNext();) {
@@ -541,6 +632,11 @@ class D3DResourceFactory extends BaseShaderFactory {
         return D3DMesh.create(context);
     }
 
+    // Formats of nCreateCompressedTexture
+    static final int COMPRESSED_FORMAT_BC1 = 0;
+    static final int COMPRESSED_FORMAT_BC2 = 1;
+    static final int COMPRESSED_FORMAT_BC3 = 2;
+
     static native long nGetContext(int adapterOrdinal);
     static native boolean nIsDefaultPool(long pResource);
     static native int nTestCooperativeLevel(long pContext);
@@ -550,8 +646,13 @@ class D3DResourceFactory extends BaseShaderFactory {
                                       boolean isRTT,
                                       int width, int height, int samples,
                                       boolean useMipmap);
+    static native long nCreateCompressedTexture(long pContext, int format,
+                                                int width, int height,
+                                                byte[][] levels);
     static native long nCreateSwapChain(long pContext, long hwnd,
-                                        boolean isVsyncEnabled);
+                                        boolean isVsyncEnabled,
+                                        boolean isFlipModel,
+                                        int maxFrameLatency);
     static native int nReleaseResource(long pContext, long resource);
     static native int nGetMaximumTextureSize(long pContext);
     static native int nGetTextureWidth(long pResource);
@@ -559,10 +660,12 @@ class D3DResourceFactory extends BaseShaderFactory {
     static native int nReadPixelsI(long pContext, long pResource,
                                     long length,
                                     Buffer pixels, int[] arr,
+                                    int x, int y,
                                     int contentWidth, int contentHeight);
     static native int nReadPixelsB(long pContext, long pResource,
                                     long length,
                                     Buffer pixels, byte[] arr,
+                                    int x, int y,
                                     int contentWidth, int contentHeight);
     static native int nUpdateTextureI(long contextHandle, long pResource,
                                       IntBuffer buf, int[] pixels,
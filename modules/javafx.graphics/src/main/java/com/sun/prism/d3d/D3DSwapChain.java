@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,8 @@ package com.sun.prism.d3d;
 
 import com.sun.glass.ui.Screen;
 import com.sun.javafx.geom.Rectangle;
+import com.sun.javafx.logging.PulseLogger;
+import static com.sun.javafx.logging.PulseLogger.PULSE_LOGGING_ENABLED;
 import com.sun.prism.CompositeMode;
 import com.sun.prism.Graphics;
 import com.sun.prism.Presentable;
@@ -40,18 +42,29 @@ class D3DSwapChain
     private final D3DRTTexture texBackBuffer;
     private final float pixelScaleFactorX;
     private final float pixelScaleFactorY;
+    private long size;
 
-    D3DSwapChain(D3DContext context, long pResource, D3DRTTexture rtt, float pixelScaleX, float pixelScaleY) {
+    // PresentCount, PresentRefreshCount and SyncRefreshCount of the
+    // last statistics reported by a flip-model swap chain
+    private final long[] presentStats = new long[3];
+    private long lastPresentRefreshCount = -1;
+
+    D3DSwapChain(D3DContext context, long pResource, D3DRTTexture rtt,
+                 float pixelScaleX, float pixelScaleY, long size) {
         super(new D3DRecord(context, pResource));
         texBackBuffer = rtt;
         pixelScaleFactorX = pixelScaleX;
         pixelScaleFactorY = pixelScaleY;
+        this.size = size;
+        D3DVramPool.instance.recordUnmanagedAllocated(size);
     }
 
     @Override
     public void dispose() {
         texBackBuffer.dispose();
         super.dispose();
+        D3DVramPool.instance.recordUnmanagedFree(size);
+        size = 0L;
     }
 
     @Override
@@ -84,10 +97,35 @@ class D3DSwapChain
         if (context.isDisposed()) {
             return false;
         }
+        if (!PULSE_LOGGING_ENABLED) {
+            int res = nPresent(context.getContextHandle(), d3dResRecord.getResource());
+            return context.validatePresent(res);
+        }
+
+        long start = System.nanoTime();
         int res = nPresent(context.getContextHandle(), d3dResRecord.getResource());
+        long presentNanos = System.nanoTime() - start;
+        logPresent(presentNanos);
         return context.validatePresent(res);
     }
 
+    /**
+     * Reports how long the present call blocked and, for flip-model swap
+     * chains, how many display refreshes passed since the previous frame
+     * reached the screen. More than one means frames were missed.
+     */
+    private void logPresent(long presentNanos) {
+        String message = "Present: " + presentNanos / 1000 + " us";
+        if (nGetPresentStats(d3dResRecord.getResource(), presentStats)) {
+            long refreshCount = presentStats[1];
+            if (lastPresentRefreshCount >= 0 && refreshCount > lastPresentRefreshCount) {
+                message += ", " + (refreshCount - lastPresentRefreshCount) + " refreshes since last frame";
+            }
+            lastPresentRefreshCount = refreshCount;
+        }
+        PulseLogger.addMessage(message);
+    }
+
     @Override
     public long getResourceHandle() {
         return d3dResRecord.getResource();
@@ -124,6 +162,7 @@ class D3DSwapChain
     }
 
     private static native int nPresent(long context, long pSwapChain);
+    private static native boolean nGetPresentStats(long pSwapChain, long[] stats);
 
     @Override
     public D3DContext getContext() {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@ import com.sun.prism.MediaFrame;
 import com.sun.prism.PixelFormat;
 import com.sun.prism.Texture;
 import com.sun.prism.impl.BaseTexture;
+import com.sun.prism.impl.StagingBuffer;
 import java.nio.Buffer;
 import java.nio.ByteBuffer;
 import java.nio.FloatBuffer;
@@ -55,13 +56,25 @@ class D3DTexture extends BaseTexture<D3DTextureResource>
     {
         super(new D3DTextureResource(new D3DTextureData(context, pResource, isRTT,
                                                         physicalWidth, physicalHeight,
-                                                        format, samples)),
+                                                        format, samples, useMipmap)),
               format, wrapMode,
               physicalWidth, physicalHeight,
               contentX, contentY, contentWidth, contentHeight,
               physicalWidth, physicalHeight, useMipmap);
     }
 
+    // A REPEAT texture created from block compressed data, which the
+    // shaders sample like premultiplied BGRA pixels
+    D3DTexture(D3DContext context, long pResource, int width, int height,
+               long size, boolean useMipmap)
+    {
+        super(new D3DTextureResource(new D3DTextureData(context, pResource,
+                                                        width, height, size)),
+              PixelFormat.BYTE_BGRA_PRE, WrapMode.REPEAT,
+              width, height, 0, 0, width, height,
+              width, height, useMipmap);
+    }
+
     // TODO: We don't handle mipmap in shared texture yet.
     D3DTexture(D3DTexture sharedTex, WrapMode altMode) {
         super(sharedTex, altMode, false);
@@ -208,6 +221,33 @@ class D3DTexture extends BaseTexture<D3DTextureResource>
                        int srcscan)
     {
         D3DContext ctx = getContext();
+        int res;
+        if (StagingBuffer.isNeeded(pixels)) {
+            int bpp = format.getBytesPerPixelUnit();
+            int rowBytes = srcw * bpp;
+            int bandRows = StagingBuffer.getBandRows(rowBytes);
+            res = D3DContext.D3D_OK;
+            for (int y = 0; y < srch && res == D3DContext.D3D_OK; y += bandRows) {
+                int rows = Math.min(bandRows, srch - y);
+                Buffer staged = StagingBuffer.stage(pixels,
+                                                    (srcy + y) * srcscan + srcx * bpp,
+                                                    rowBytes, rows, srcscan);
+                res = updateTexture(ctx, staged, format, dstx, dsty + y,
+                                    0, 0, srcw, rows, rowBytes);
+            }
+        } else {
+            res = updateTexture(ctx, pixels, format, dstx, dsty,
+                                srcx, srcy, srcw, srch, srcscan);
+        }
+        D3DContext.validate(res);
+    }
+
+    private int updateTexture(D3DContext ctx, Buffer pixels, PixelFormat format,
+                              int dstx, int dsty,
+                              int srcx, int srcy,
+                              int srcw, int srch,
+                              int srcscan)
+    {
         int res;
         if (format.getDataType() == PixelFormat.DataType.INT) {
             IntBuffer buf = (IntBuffer)pixels;
@@ -233,6 +273,6 @@ class D3DTexture extends BaseTexture<D3DTextureResource>
                                                      dstx, dsty,
                                                      srcx, srcy, srcw, srch, srcscan);
         }
-        D3DContext.validate(res);
+        return res;
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,27 +33,17 @@ public class D3DTextureData extends D3DResource.D3DRecord {
     private final boolean isRTT;
     private final int samples;
 
-    static long estimateSize(int physicalWidth, int physicalHeight,
-                             PixelFormat format)
-    {
-        return (long) physicalWidth * physicalHeight * format.getBytesPerPixelUnit();
-    }
-
-    static long estimateRTSize(int physicalWidth, int physicalHeight,
-                               boolean hasDepth)
-    {
-        return 4L * physicalWidth * physicalHeight;
-    }
-
     D3DTextureData(D3DContext context,
                    long pResource, boolean isRTT,
                    int physicalWidth, int physicalHeight,
-                   PixelFormat format, int numberOfSamples)
+                   PixelFormat format, int numberOfSamples, boolean useMipmap)
     {
         super(context, pResource);
         this.size = isRTT
-               ? estimateRTSize(physicalWidth, physicalHeight, false)
-               : estimateSize(physicalWidth, physicalHeight, format);
+               ? D3DVramPool.instance.estimateRTTextureSize(physicalWidth, physicalHeight,
+                                                            numberOfSamples, false)
+               : D3DVramPool.instance.estimateTextureSize(physicalWidth, physicalHeight,
+                                                          format, useMipmap);
         this.isRTT = isRTT;
         this.samples = numberOfSamples;
         if (isRTT) {
@@ -63,6 +53,16 @@ public class D3DTextureData extends D3DResource.D3DRecord {
         }
     }
 
+    D3DTextureData(D3DContext context, long pResource,
+                   int physicalWidth, int physicalHeight, long size)
+    {
+        super(context, pResource);
+        this.size = size;
+        this.isRTT = false;
+        this.samples = 0;
+        PrismTrace.textureCreated(pResource, physicalWidth, physicalHeight, size);
+    }
+
     int getSamples() {
         return samples;
     }
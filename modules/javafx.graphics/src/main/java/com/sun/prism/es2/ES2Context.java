@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -68,6 +68,7 @@ class ES2Context extends BaseShaderContext {
     private GLDrawable currentDrawable = null;
     private int indexBuffer = 0;
     private int shaderProgram;
+    private final ES2ShaderCache shaderCache;
 
     public static final int NUM_QUADS = PrismSettings.superShader ? 4096 : 256;
 
@@ -88,11 +89,23 @@ class ES2Context extends BaseShaderContext {
         makeCurrent(dummyGLDrawable);
 
         glContext.enableVertexAttributes();
+        shaderCache = ES2ShaderCache.create(glContext, glF);
         quadIndices = genQuadsIndexBuffer(NUM_QUADS);
         setIndexBuffer(quadIndices);
         state = new State();
     }
 
+    @Override
+    public void warmUpShaders() {
+        super.warmUpShaders();
+        ES2PhongShader.warmUp(this);
+    }
+
+    // Null if linked programs are not cached
+    ES2ShaderCache getShaderCache() {
+        return shaderCache;
+    }
+
     static short [] getQuadIndices16bit(int numQuads) {
         short data[] = new short[numQuads * 6];
 
@@ -403,6 +416,12 @@ class ES2Context extends BaseShaderContext {
                 vertexBufferLength, indexBuffer, indexBufferLength);
     }
 
+    boolean updateNativeVertices(long nativeHandle, float[] vertexBuffer,
+            int vertexBufferLength, int dirtyFrom, int dirtyTo) {
+        return glContext.updateNativeVertices(nativeHandle, vertexBuffer,
+                vertexBufferLength, dirtyFrom, dirtyTo);
+    }
+
     long createES2PhongMaterial() {
         return glContext.createES2PhongMaterial();
     }
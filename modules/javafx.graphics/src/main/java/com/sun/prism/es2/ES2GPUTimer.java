@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.prism.es2;
+
+import com.sun.prism.impl.BaseGPUTimer;
+
+/**
+ * Times frames with GL_TIMESTAMP queries, from ARB_timer_query on desktop
+ * OpenGL or EXT_disjoint_timer_query on OpenGL ES.
+ */
+final class ES2GPUTimer extends BaseGPUTimer {
+
+    private final GLContext glContext;
+
+    ES2GPUTimer(ES2Context context) {
+        super(context);
+        this.glContext = context.getGLContext();
+    }
+
+    @Override
+    protected long createFrame(int numTimestamps) {
+        return glContext.createTimerFrame(numTimestamps);
+    }
+
+    @Override
+    protected void beginFrame(long frame) {
+        glContext.beginTimerFrame(frame);
+    }
+
+    @Override
+    protected void timestamp(long frame, int index) {
+        glContext.timestamp(frame, index);
+    }
+
+    @Override
+    protected void endFrame(long frame) {
+        // The last timestamp ends the frame
+    }
+
+    @Override
+    protected int getResults(long frame, long[] nanos) {
+        return glContext.getTimerFrameResults(frame, nanos);
+    }
+
+    @Override
+    protected void disposeFrame(long frame) {
+        glContext.deleteTimerFrame(frame);
+    }
+}
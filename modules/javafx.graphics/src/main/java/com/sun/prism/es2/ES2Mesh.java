@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,11 +36,13 @@ class ES2Mesh extends BaseMesh {
 
     private final ES2Context context;
     private final long nativeHandle;
+    private final ES2MeshDisposerRecord meshRecord;
 
-    private ES2Mesh(ES2Context context, long nativeHandle, Disposer.Record disposerRecord) {
+    private ES2Mesh(ES2Context context, long nativeHandle, ES2MeshDisposerRecord disposerRecord) {
         super(disposerRecord);
         this.context = context;
         this.nativeHandle = nativeHandle;
+        this.meshRecord = disposerRecord;
         count++;
     }
 
@@ -67,27 +69,51 @@ class ES2Mesh extends BaseMesh {
     @Override
     public boolean buildNativeGeometry(float[] vertexBuffer, int vertexBufferLength,
             int[] indexBufferInt, int indexBufferLength) {
-        return context.buildNativeGeometry(nativeHandle, vertexBuffer,
+        boolean result = context.buildNativeGeometry(nativeHandle, vertexBuffer,
                 vertexBufferLength, indexBufferInt, indexBufferLength);
+        if (result) {
+            meshRecord.setBufferSize(4L * vertexBufferLength + 4L * indexBufferLength);
+        }
+        return result;
     }
 
     @Override
     public boolean buildNativeGeometry(float[] vertexBuffer, int vertexBufferLength,
             short[] indexBufferShort, int indexBufferLength) {
-        return context.buildNativeGeometry(nativeHandle, vertexBuffer,
+        boolean result = context.buildNativeGeometry(nativeHandle, vertexBuffer,
                 vertexBufferLength, indexBufferShort, indexBufferLength);
+        if (result) {
+            meshRecord.setBufferSize(4L * vertexBufferLength + 2L * indexBufferLength);
+        }
+        return result;
+    }
+
+    @Override
+    public boolean updateNativeVertices(float[] vertexBuffer, int vertexBufferLength,
+            int dirtyFrom, int dirtyTo) {
+        return context.updateNativeVertices(nativeHandle, vertexBuffer,
+                vertexBufferLength, dirtyFrom, dirtyTo);
     }
 
     static class ES2MeshDisposerRecord implements Disposer.Record {
 
         private final ES2Context context;
         private long nativeHandle;
+        // bytes held by the native vertex and index buffers, accounted
+        // as unmanaged memory of the vram pool
+        private long bufferSize;
 
         ES2MeshDisposerRecord(ES2Context context, long nativeHandle) {
             this.context = context;
             this.nativeHandle = nativeHandle;
         }
 
+        void setBufferSize(long size) {
+            ES2VramPool.instance.recordUnmanagedFree(bufferSize);
+            ES2VramPool.instance.recordUnmanagedAllocated(size);
+            bufferSize = size;
+        }
+
         void traceDispose() {}
 
         @Override
@@ -96,6 +122,8 @@ class ES2Mesh extends BaseMesh {
                 traceDispose();
                 context.releaseES2Mesh(nativeHandle);
                 nativeHandle = 0L;
+                ES2VramPool.instance.recordUnmanagedFree(bufferSize);
+                bufferSize = 0L;
             }
         }
     }
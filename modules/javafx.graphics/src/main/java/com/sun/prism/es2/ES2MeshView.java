@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -66,7 +66,9 @@ class ES2MeshView extends BaseMeshView {
 
     @Override
     public void setCullingMode(int cullingMode) {
-        context.setCullingMode(nativeHandle, cullingMode);
+        if (updateCullingMode(cullingMode)) {
+            context.setCullingMode(nativeHandle, cullingMode);
+        }
     }
 
     @Override
@@ -82,6 +84,9 @@ class ES2MeshView extends BaseMeshView {
 
     @Override
     public void setAmbientLight(float r, float g, float b) {
+        if (!updateAmbientLight(r, g, b)) {
+            return;
+        }
         ambientLightRed = r;
         ambientLightGreen = g;
         ambientLightBlue = b;
@@ -105,7 +110,8 @@ class ES2MeshView extends BaseMeshView {
             float ca, float la, float qa, float isAttenuated, float maxRange, float dirX, float dirY, float dirZ,
             float innerAngle, float outerAngle, float falloff) {
         // NOTE: We only support up to 3 point lights at the present
-        if (index >= 0 && index <= 2) {
+        if (updateLight(index, x, y, z, r, g, b, w, ca, la, qa, isAttenuated, maxRange,
+                dirX, dirY, dirZ, innerAngle, outerAngle, falloff)) {
             lights[index] = new ES2Light(x, y, z, r, g, b, w, ca, la, qa, isAttenuated,
                     maxRange, dirX, dirY, dirZ, innerAngle, outerAngle, falloff);
             context.setLight(nativeHandle, index, x, y, z, r, g, b, w, ca, la, qa, isAttenuated,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,6 +38,26 @@ class ES2PhongShader {
     static String vertexShaderSource;
     static String mainFragShaderSource;
 
+    // Uniform names of the light fields, built once instead of for every
+    // light of every mesh view rendered
+    private static final int NUM_LIGHTS = 3;
+    private static final String[] LIGHT_POS = lightUniforms("pos");
+    private static final String[] LIGHT_COLOR = lightUniforms("color");
+    private static final String[] LIGHT_ATTN = lightUniforms("attn");
+    private static final String[] LIGHT_RANGE = lightUniforms("range");
+    private static final String[] LIGHT_DIR = lightUniforms("dir");
+    private static final String[] LIGHT_COS_OUTER = lightUniforms("cosOuter");
+    private static final String[] LIGHT_DENOM = lightUniforms("denom");
+    private static final String[] LIGHT_FALLOFF = lightUniforms("falloff");
+
+    private static String[] lightUniforms(String field) {
+        String[] names = new String[NUM_LIGHTS];
+        for (int i = 0; i < NUM_LIGHTS; i++) {
+            names[i] = "lights[" + i + "]." + field;
+        }
+        return names;
+    }
+
     enum DiffuseState {
 
         NONE,
@@ -150,6 +170,13 @@ class ES2PhongShader {
             if (light != null && light.w > 0) { numLights++; }
         }
 
+        return getShader(context, diffuseState, specularState, selfIllumState,
+                bumpState, numLights);
+    }
+
+    private static ES2Shader getShader(ES2Context context, DiffuseState diffuseState,
+            SpecularState specularState, SelfIllumState selfIllumState,
+            BumpMapState bumpState, int numLights) {
         ES2Shader shader = shaders[diffuseState.ordinal()][specularState.ordinal()]
                 [selfIllumState.ordinal()][bumpState.ordinal()][numLights];
         if (shader == null) {
@@ -183,6 +210,19 @@ class ES2PhongShader {
         return shader;
     }
 
+    /**
+     * Creates the shaders for plain and textured diffuse materials with up
+     * to the maximum number of lights, before any mesh is rendered.
+     */
+    static void warmUp(ES2Context context) {
+        for (int numLights = 0; numLights < lightStateCount; numLights++) {
+            getShader(context, DiffuseState.DIFFUSECOLOR, SpecularState.NONE,
+                    SelfIllumState.NONE, BumpMapState.NONE, numLights);
+            getShader(context, DiffuseState.TEXTURE, SpecularState.NONE,
+                    SelfIllumState.NONE, BumpMapState.NONE, numLights);
+        }
+    }
+
     static void setShaderParamaters(ES2Shader shader, ES2MeshView meshView, ES2Context context) {
 
         ES2PhongMaterial material = meshView.getMaterial();
@@ -212,30 +252,30 @@ class ES2PhongShader {
     }
 
     private static void setLightConstants(int i, ES2Shader shader, ES2Light light) {
-        shader.setConstant("lights[" + i + "].pos", light.x, light.y, light.z, light.w);
-        shader.setConstant("lights[" + i + "].color", light.r, light.g, light.b);
-        shader.setConstant("lights[" + i + "].attn", light.ca, light.la, light.qa, light.isAttenuated);
-        shader.setConstant("lights[" + i + "].range", light.maxRange);
+        shader.setConstant(LIGHT_POS[i], light.x, light.y, light.z, light.w);
+        shader.setConstant(LIGHT_COLOR[i], light.r, light.g, light.b);
+        shader.setConstant(LIGHT_ATTN[i], light.ca, light.la, light.qa, light.isAttenuated);
+        shader.setConstant(LIGHT_RANGE[i], light.maxRange);
         if (light.isPointLight()) {
-            shader.setConstant("lights[" + i + "].dir", 0f, 0f, 1f);
+            shader.setConstant(LIGHT_DIR[i], 0f, 0f, 1f);
         } else {
             float dirX = light.dirX;
             float dirY = light.dirY;
             float dirZ = light.dirZ;
             float length = (float) Math.sqrt(dirX * dirX + dirY * dirY + dirZ * dirZ);
-            shader.setConstant("lights[" + i + "].dir", dirX / length, dirY / length, dirZ / length);
+            shader.setConstant(LIGHT_DIR[i], dirX / length, dirY / length, dirZ / length);
         }
         if (light.isPointLight() || light.isDirectionalLight()) {
-            shader.setConstant("lights[" + i + "].cosOuter", -1f); // cos(180)
-            shader.setConstant("lights[" + i + "].denom", 2f);     // cos(0) - cos(180)
-            shader.setConstant("lights[" + i + "].falloff", 0f);
+            shader.setConstant(LIGHT_COS_OUTER[i], -1f); // cos(180)
+            shader.setConstant(LIGHT_DENOM[i], 2f);     // cos(0) - cos(180)
+            shader.setConstant(LIGHT_FALLOFF[i], 0f);
         } else {
             // preparing for: I = pow((cosAngle - cosOuter) / (cosInner - cosOuter), falloff);
             float cosOuter = (float) Math.cos(Math.toRadians(light.outerAngle));
             float cosInner = (float) Math.cos(Math.toRadians(light.innerAngle));
-            shader.setConstant("lights[" + i + "].cosOuter", cosOuter);
-            shader.setConstant("lights[" + i + "].denom", cosInner - cosOuter);
-            shader.setConstant("lights[" + i + "].falloff", light.falloff);
+            shader.setConstant(LIGHT_COS_OUTER[i], cosOuter);
+            shader.setConstant(LIGHT_DENOM[i], cosInner - cosOuter);
+            shader.setConstant(LIGHT_FALLOFF[i], light.falloff);
         }
     }
 }
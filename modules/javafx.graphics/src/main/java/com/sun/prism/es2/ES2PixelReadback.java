@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.prism.es2;
+
+import com.sun.prism.PixelReadback;
+import java.nio.Buffer;
+
+/**
+ * An asynchronous readback backed by a pixel buffer object and a fence.
+ */
+class ES2PixelReadback implements PixelReadback {
+
+    private final GLContext glContext;
+    private long handle;
+
+    ES2PixelReadback(GLContext glContext, long handle) {
+        this.glContext = glContext;
+        this.handle = handle;
+    }
+
+    @Override
+    public boolean isDone() {
+        return handle == 0 || glContext.isReadPixelsDone(handle);
+    }
+
+    @Override
+    public boolean complete(Buffer pixels) {
+        if (handle == 0) {
+            return false;
+        }
+        long h = handle;
+        handle = 0;
+        return glContext.completeReadPixels(h, pixels);
+    }
+
+    @Override
+    public void dispose() {
+        if (handle != 0) {
+            glContext.disposeReadPixels(handle);
+            handle = 0;
+        }
+    }
+}
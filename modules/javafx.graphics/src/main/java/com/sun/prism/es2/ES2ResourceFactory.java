@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,8 @@ import java.util.Map;
 
 import com.sun.glass.ui.Screen;
 import com.sun.javafx.PlatformUtil;
+import com.sun.javafx.iio.CompressedImageData;
+import com.sun.prism.GPUTimer;
 import com.sun.prism.Image;
 import com.sun.prism.MediaFrame;
 import com.sun.prism.Mesh;
@@ -57,6 +59,7 @@ public class ES2ResourceFactory extends BaseShaderFactory {
     private static final Map<Image,Texture> mipmapTexCache = new WeakHashMap<>();
 
     private ES2Context context;
+    private ES2GPUTimer gpuTimer;
     // Maximum size of the texture
     private final int maxTextureSize;
 
@@ -64,6 +67,9 @@ public class ES2ResourceFactory extends BaseShaderFactory {
         super(clampTexCache, repeatTexCache, mipmapTexCache);
         context = new ES2Context(screen, this);
         maxTextureSize = computeMaxTextureSize();
+        if (PrismSettings.shaderWarmup) {
+            context.warmUpShaders();
+        }
 
         if (PrismSettings.verbose) {
             System.out.println("Non power of two texture support = "
@@ -145,6 +151,22 @@ public class ES2ResourceFactory extends BaseShaderFactory {
         return ES2Texture.create(context, frame);
     }
 
+    @Override
+    protected boolean isCompressedFormatSupported(CompressedImageData.Format format) {
+        GLFactory glFactory = ES2Pipeline.glFactory;
+        if (glFactory.isGLExtensionSupported("GL_EXT_texture_compression_s3tc")) {
+            return true;
+        }
+        return format == CompressedImageData.Format.BC1
+                && glFactory.isGLExtensionSupported("GL_EXT_texture_compression_dxt1");
+    }
+
+    @Override
+    protected Texture createCompressedTexture(CompressedImageData data,
+                                              WrapMode wrapMode, boolean useMipmap) {
+        return ES2Texture.createCompressed(context, data, useMipmap);
+    }
+
     @Override
     public int getRTTWidth(int w, WrapMode wrapMode) {
         return ES2RTTexture.getCompatibleDimension(context, w, wrapMode);
@@ -172,7 +194,9 @@ public class ES2ResourceFactory extends BaseShaderFactory {
             case BYTE_RGB:
             case BYTE_GRAY:
             case BYTE_ALPHA:
+            case BYTE_GRAY_ALPHA:
             case MULTI_YCbCr_420:
+            case MULTI_YCbCr_420_10:
                 return true;
             case BYTE_BGRA_PRE:
             case INT_ARGB_PRE:
@@ -328,8 +352,20 @@ public class ES2ResourceFactory extends BaseShaderFactory {
         }
     }
 
+    @Override
+    public GPUTimer getGPUTimer() {
+        if (gpuTimer == null && PrismSettings.gpuTiming) {
+            gpuTimer = new ES2GPUTimer(context);
+        }
+        return gpuTimer;
+    }
+
     @Override
     public void dispose() {
+        if (gpuTimer != null) {
+            gpuTimer.dispose();
+            gpuTimer = null;
+        }
         context.clearContext();
     }
 
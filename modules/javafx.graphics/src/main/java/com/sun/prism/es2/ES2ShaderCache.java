@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.prism.es2;
+
+import com.sun.prism.impl.PrismSettings;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.security.AccessController;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.security.PrivilegedAction;
+import java.util.HexFormat;
+
+/**
+ * Keeps the binaries of linked shader programs in the directory set with
+ * the prism.shadercache property, so that later runs can skip compiling
+ * and linking the GLSL sources. Binaries are keyed by a hash of the
+ * sources, the attribute bindings and the driver, vendor and version
+ * strings. A binary the driver no longer accepts is compiled again and
+ * replaced.
+ */
+final class ES2ShaderCache {
+
+    private record ProgramBinary(int format, byte[] data) {}
+
+    private final GLContext glContext;
+    private final Path dir;
+    private final byte[] driverInformation;
+
+    private ES2ShaderCache(GLContext glContext, Path dir, String driverInformation) {
+        this.glContext = glContext;
+        this.dir = dir;
+        this.driverInformation = driverInformation.getBytes(StandardCharsets.UTF_8);
+    }
+
+    /**
+     * Returns the cache for the given context, or null if no directory is
+     * set or the driver cannot save program binaries.
+     */
+    static ES2ShaderCache create(GLContext glContext, GLFactory glFactory) {
+        if (PrismSettings.shaderCacheDir == null || !glContext.isProgramBinarySupported()) {
+            return null;
+        }
+        @SuppressWarnings("removal")
+        Path dir = AccessController.doPrivileged((PrivilegedAction<Path>) () -> {
+            try {
+                return Files.createDirectories(Path.of(PrismSettings.shaderCacheDir));
+            } catch (IOException | RuntimeException e) {
+                if (PrismSettings.verbose) {
+                    System.err.println("Shader cache disabled: " + e);
+                }
+                return null;
+            }
+        });
+        return dir == null ? null
+                : new ES2ShaderCache(glContext, dir, glFactory.getDriverInformation());
+    }
+
+    String getKey(String vert, String[] frag, String[] attrs, int[] indexs) {
+        MessageDigest digest;
+        try {
+            digest = MessageDigest.getInstance("SHA-256");
+        } catch (NoSuchAlgorithmException e) {
+            throw new InternalError(e);
+        }
+        digest.update(driverInformation);
+        update(digest, vert);
+        for (String f : frag) {
+            update(digest, f);
+        }
+        for (int i = 0; i < attrs.length; i++) {
+            update(digest, attrs[i] + "=" + indexs[i]);
+        }
+        return HexFormat.of().formatHex(digest.digest());
+    }
+
+    private static void update(MessageDigest digest, String s) {
+        digest.update((byte) 0);
+        digest.update(s.getBytes(StandardCharsets.UTF_8));
+    }
+
+    /**
+     * Creates the program saved for the key. Returns 0 if there is none or
+     * the driver rejects it.
+     */
+    int load(String key) {
+        Path file = dir.resolve(key);
+        @SuppressWarnings("removal")
+        ProgramBinary binary = AccessController.doPrivileged((PrivilegedAction<ProgramBinary>) () -> {
+            if (!Files.isRegularFile(file)) {
+                return null;
+            }
+            try (DataInputStream in = new DataInputStream(Files.newInputStream(file))) {
+                int format = in.readInt();
+                byte[] data = new byte[in.readInt()];
+                in.readFully(data);
+                return new ProgramBinary(format, data);
+            } catch (IOException | RuntimeException e) {
+                return null;
+            }
+        });
+        return binary == null ? 0
+                : glContext.createProgramFromBinary(binary.format(), binary.data());
+    }
+
+    /**
+     * Saves the binary of a linked program for the key.
+     */
+    void store(String key, int programID) {
+        int[] format = new int[1];
+        byte[] data = glContext.getProgramBinary(programID, format);
+        if (data == null) {
+            return;
+        }
+        Path file = dir.resolve(key);
+        @SuppressWarnings("removal")
+        var dummy = AccessController.doPrivileged((PrivilegedAction<Void>) () -> {
+            Path tmp = null;
+            try {
+                // Written aside and moved, so other processes never read
+                // a partial file
+                tmp = Files.createTempFile(dir, key, ".tmp");
+                try (DataOutputStream out = new DataOutputStream(Files.newOutputStream(tmp))) {
+                    out.writeInt(format[0]);
+                    out.writeInt(data.length);
+                    out.write(data);
+                }
+                Files.move(tmp, file, StandardCopyOption.REPLACE_EXISTING,
+                        StandardCopyOption.ATOMIC_MOVE);
+                tmp = null;
+            } catch (IOException | RuntimeException e) {
+                if (PrismSettings.verbose) {
+                    System.err.println("Could not save shader binary: " + e);
+                }
+            } finally {
+                if (tmp != null) {
+                    try {
+                        Files.deleteIfExists(tmp);
+                    } catch (IOException e) {
+                        // ignore
+                    }
+                }
+            }
+            return null;
+        });
+    }
+}
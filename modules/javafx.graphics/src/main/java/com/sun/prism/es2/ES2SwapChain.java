@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -68,6 +68,14 @@ class ES2SwapChain implements ES2RenderTarget, Presentable, GraphicsResource {
      */
     private RTTexture stableBackbuffer;
     private boolean copyFullBuffer;
+    /**
+     * The regions of the stableBackbuffer changed by the last frames, newest
+     * first. When the drawable reports the age of its back buffer, only what
+     * changed since that buffer was shown is copied into it.
+     */
+    private static final int DAMAGE_HISTORY = 4;
+    private final Rectangle[] damageHistory = new Rectangle[DAMAGE_HISTORY];
+    private int damageHistoryCount;
 
     @Override
     public boolean isOpaque() {
@@ -140,8 +148,21 @@ class ES2SwapChain implements ES2RenderTarget, Presentable, GraphicsResource {
                 int sh = h;
                 int dw = pState.getOutputWidth();
                 int dh = pState.getOutputHeight();
+                Rectangle copyRect = null;
+                if (!copyFullBuffer && sw == dw && sh == dh
+                        && !isMSAA() && pState.hasWindowManager()) {
+                    copyRect = getCopyRegion(clip);
+                } else {
+                    damageHistoryCount = 0;
+                }
                 copyFullBuffer = false;
-                if (isMSAA()) {
+                if (copyRect != null) {
+                    drawTexture(g, stableBackbuffer,
+                                copyRect.x, copyRect.y,
+                                copyRect.x + copyRect.width, copyRect.y + copyRect.height,
+                                copyRect.x, copyRect.y,
+                                copyRect.x + copyRect.width, copyRect.y + copyRect.height);
+                } else if (isMSAA()) {
                     context.flushVertexBuffer();
                     // Note must flip the image vertically during blit
                     g.blit(stableBackbuffer, null,
@@ -161,6 +182,36 @@ class ES2SwapChain implements ES2RenderTarget, Presentable, GraphicsResource {
         }
     }
 
+    /**
+     * Records the region changed by this frame and returns the part of the
+     * window's back buffer that is out of date, or null if all of it is.
+     */
+    private Rectangle getCopyRegion(Rectangle clip) {
+        int age = (clip == null) ? 0 : drawable.getBufferAge(context.getGLContext());
+        Rectangle copyRect = null;
+        // a buffer of age n misses the changes of this frame and of the
+        // n - 1 frames before it
+        if (age > 0 && age <= damageHistoryCount + 1) {
+            copyRect = new Rectangle(clip);
+            for (int i = 0; i < age - 1; i++) {
+                copyRect.add(damageHistory[i]);
+            }
+        }
+        if (clip == null) {
+            damageHistoryCount = 0;
+        } else {
+            Rectangle oldest = damageHistory[DAMAGE_HISTORY - 1];
+            System.arraycopy(damageHistory, 0, damageHistory, 1, DAMAGE_HISTORY - 1);
+            if (oldest == null) {
+                oldest = new Rectangle();
+            }
+            oldest.setBounds(clip);
+            damageHistory[0] = oldest;
+            damageHistoryCount = Math.min(damageHistoryCount + 1, DAMAGE_HISTORY);
+        }
+        return copyRect;
+    }
+
     private void drawTexture(ES2Graphics g, RTTexture src,
                              float dx1, float dy1, float dx2, float dy2,
                              float sx1, float sy1, float sx2, float sy2) {
@@ -184,6 +235,7 @@ class ES2SwapChain implements ES2RenderTarget, Presentable, GraphicsResource {
     @Override
     public boolean present() {
         boolean presented = drawable.swapBuffers(context.getGLContext());
+        context.getGLContext().updateUploadStats();
         context.makeCurrent(null);
         return presented;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 package com.sun.prism.es2;
 
 import com.sun.javafx.PlatformUtil;
+import com.sun.javafx.iio.CompressedImageData;
 import com.sun.prism.Image;
 import com.sun.prism.Texture;
 import com.sun.prism.MediaFrame;
@@ -33,6 +34,7 @@ import com.sun.prism.MultiTexture;
 import com.sun.prism.PixelFormat;
 import com.sun.prism.impl.BaseTexture;
 import com.sun.prism.impl.BufferUtil;
+import com.sun.prism.impl.StagingBuffer;
 import java.nio.Buffer;
 import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
@@ -103,7 +105,7 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
                     + " not supported on this device");
         }
 
-        if (format == PixelFormat.MULTI_YCbCr_420) {
+        if (format.isMultiTexture()) {
             throw new IllegalArgumentException("Format requires multitexturing: " + format);
         }
 
@@ -202,7 +204,7 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
         }
 
         ES2VramPool pool = ES2VramPool.instance;
-        long size = pool.estimateTextureSize(texWidth, texHeight, format);
+        long size = pool.estimateTextureSize(texWidth, texHeight, format, useMipmap);
         if (!pool.prepareForAllocation(size)) {
             return null;
         }
@@ -224,6 +226,10 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
         glCtx.setBoundTexture(savedTex);
 
         if (!result) {
+            // The driver could not allocate the texture, release it and
+            // let the pool evict older textures before the next attempt
+            texRes.dispose();
+            pool.allocationFailed(size);
             return null;
         }
         return new ES2Texture(context, texRes, format, wrapMode,
@@ -233,6 +239,70 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
 
     }
 
+    static int getCompressedInternalFormat(CompressedImageData.Format format) {
+        switch (format) {
+            case BC1: return GLContext.GL_COMPRESSED_RGBA_S3TC_DXT1;
+            case BC2: return GLContext.GL_COMPRESSED_RGBA_S3TC_DXT3;
+            case BC3: return GLContext.GL_COMPRESSED_RGBA_S3TC_DXT5;
+            default:
+                throw new IllegalArgumentException("Unsupported format: " + format);
+        }
+    }
+
+    /**
+     * Creates a REPEAT texture from block compressed data. Returns null if
+     * the texture would need padding or the driver rejects the data, so
+     * that the caller falls back to the decoded pixels.
+     */
+    static ES2Texture createCompressed(ES2Context context, CompressedImageData data,
+                                       boolean useMipmap) {
+        GLContext glCtx = context.getGLContext();
+        int w = data.getWidth();
+        int h = data.getHeight();
+        if (w > glCtx.getMaxTextureSize() || h > glCtx.getMaxTextureSize()) {
+            return null;
+        }
+        // Compressed textures cannot be padded to simulate REPEAT
+        if (!glCtx.canCreateNonPowTwoTextures() &&
+            ((w & (w-1)) != 0 || (h & (h-1)) != 0))
+        {
+            return null;
+        }
+
+        int levels = useMipmap ? data.getLevelCount() : 1;
+        ES2VramPool pool = ES2VramPool.instance;
+        long size = data.getSize(levels);
+        if (!pool.prepareForAllocation(size)) {
+            return null;
+        }
+
+        // save current texture object for this texture unit
+        int savedTex = glCtx.getBoundTexture();
+        ES2TextureData texData =
+            new ES2TextureData(context, glCtx.genAndBindTexture(), w, h, size);
+        ES2TextureResource texRes = new ES2TextureResource(texData);
+
+        int internalFormat = getCompressedInternalFormat(data.getFormat());
+        boolean result = true;
+        for (int i = 0; i < levels && result; i++) {
+            result = glCtx.compressedTexImage2D(i, internalFormat,
+                                                Math.max(1, w >> i), Math.max(1, h >> i),
+                                                data.getLevel(i));
+        }
+        glCtx.texParamsMinMax(GLContext.GL_LINEAR, useMipmap);
+
+        // restore previous texture objects
+        glCtx.setBoundTexture(savedTex);
+
+        if (!result) {
+            texRes.dispose();
+            return null;
+        }
+        // The shaders sample it like premultiplied BGRA pixels
+        return new ES2Texture(context, texRes, PixelFormat.BYTE_BGRA_PRE, WrapMode.REPEAT,
+                              w, h, 0, 0, w, h, useMipmap);
+    }
+
     public static Texture create(ES2Context context, MediaFrame frame) {
         frame.holdFrame();
 
@@ -240,7 +310,7 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
         int texHeight;
         PixelFormat format = frame.getPixelFormat();
 
-        if (frame.getPixelFormat() == PixelFormat.MULTI_YCbCr_420) {
+        if (format.isMultiTexture()) {
             // use encoded dimensions for texture sizes
             int width = frame.getEncodedWidth();
             int height = frame.getEncodedHeight();
@@ -264,7 +334,7 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
 
                 // Create using subWidth/subHeight then adjust content afterwards
                 ES2Texture subTex =
-                    create(context, PixelFormat.BYTE_ALPHA, WrapMode.CLAMP_TO_EDGE,
+                    create(context, format.getPlaneFormat(), WrapMode.CLAMP_TO_EDGE,
                            subWidth, subHeight, false);
                 if (subTex != null) {
                     tex.setTexture(subTex, index);
@@ -394,6 +464,12 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
                 pixelFormat = GLContext.GL_ALPHA;
                 pixelType = GLContext.GL_UNSIGNED_BYTE;
                 break;
+            case BYTE_GRAY_ALPHA:
+                alignment = 2;
+                internalFormat = GLContext.GL_LUMINANCE_ALPHA;
+                pixelFormat = GLContext.GL_LUMINANCE_ALPHA;
+                pixelType = GLContext.GL_UNSIGNED_BYTE;
+                break;
             case FLOAT_XYZW:
                 alignment = 4;
                 // Note: In OpenGL ES 2.0, GL_RGBA32F is not supported but
@@ -412,6 +488,7 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
                 pixelType = GLContext.GL_UNSIGNED_SHORT_8_8_APPLE;
                 break;
             case MULTI_YCbCr_420:
+            case MULTI_YCbCr_420_10:
             default:
                 throw new InternalError("Image format not supported: " + format);
         }
@@ -485,7 +562,25 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
                         initPixelFormat, initPixelType, initBuf, useMipmap);
             }
         }
-        if (pixels != null) {
+        if (pixels != null && StagingBuffer.isNeeded(pixels)) {
+            // Staged rows are tightly packed, which also covers ES 2.0
+            int bpp = format.getBytesPerPixelUnit();
+            int rowBytes = srcw * bpp;
+            int bandRows = StagingBuffer.getBandRows(rowBytes);
+            glCtx.pixelStorei(GLContext.GL_UNPACK_ALIGNMENT, 1);
+            if (isGL2) {
+                glCtx.pixelStorei(GLContext.GL_UNPACK_ROW_LENGTH, 0);
+            }
+            for (int y = 0; y < srch; y += bandRows) {
+                int rows = Math.min(bandRows, srch - y);
+                Buffer staged = StagingBuffer.stage(pixels,
+                        (srcy + y) * srcscan + srcx * bpp,
+                        rowBytes, rows, srcscan);
+                glCtx.texSubImage2D(target, 0,
+                        dstx, dsty + y, srcw, rows,
+                        pixelFormat, pixelType, staged);
+            }
+        } else if (pixels != null) {
             // Note: Due to the above restrictions (no ROW_LENGTH, etc) we
             // have to assume that the data in "pixels" is tightly packed, i.e.,
             // srcx==0, srcy==0, and no space between scanlines.  If this
@@ -561,6 +656,7 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
                 pixelType = GLContext.GL_UNSIGNED_SHORT_8_8_APPLE;
                 break;
             case MULTI_YCbCr_420: // this needs to go through MultiTexture
+            case MULTI_YCbCr_420_10:
             default:
                 frame.releaseFrame();
                 throw new InternalError("Invalid video image format "
@@ -592,6 +688,26 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
         return result;
     }
 
+    /*
+     * Frames that are held in a native surface on the GPU are copied there
+     * rather than uploaded from system memory.
+     */
+    private static boolean copyNativeSurface(GLContext glCtx, int texID, MediaFrame frame) {
+        PixelFormat format = frame.getPixelFormat();
+        if (format != PixelFormat.INT_ARGB_PRE && format != PixelFormat.BYTE_APPLE_422) {
+            return false;
+        }
+        frame.holdFrame();
+        try {
+            long surface = frame.getNativeSurface();
+            return surface != 0 && glCtx.copyNativeSurface(surface, texID,
+                    frame.getWidth(), frame.getHeight(),
+                    format == PixelFormat.BYTE_APPLE_422);
+        } finally {
+            frame.releaseFrame();
+        }
+    }
+
     public static int getBufferElementSizeLog(Buffer b) {
         if (b instanceof ByteBuffer) {
             return 0;
@@ -638,7 +754,7 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
             if (savedTex != texID) {
                 glCtx.setBoundTexture(texID);
             }
-            glCtx.updateFilterState(texID, cLFM);
+            glCtx.updateFilterState(texID, cLFM, getUseMipmap());
             if (savedTex != texID) {
                 glCtx.setBoundTexture(savedTex);
             }
@@ -798,10 +914,12 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
                 glCtx.setBoundTexture(texID);
             }
 
-            uploadPixels(glCtx, GLContext.GL_TEXTURE_2D,
-                    frame,
-                    getPhysicalWidth(), getPhysicalHeight(),
-                    false);
+            if (!copyNativeSurface(glCtx, texID, frame)) {
+                uploadPixels(glCtx, GLContext.GL_TEXTURE_2D,
+                        frame,
+                        getPhysicalWidth(), getPhysicalHeight(),
+                        false);
+            }
 
             // restore the previous texture/unit state if it was changed above
             if (savedUnit != glCtx.getActiveTextureUnit()) {
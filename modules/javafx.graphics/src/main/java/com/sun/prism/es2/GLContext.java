@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,7 @@ import com.sun.javafx.PlatformUtil;
 import com.sun.prism.MeshView;
 import com.sun.prism.PhongMaterial.MapType;
 import com.sun.prism.Texture.WrapMode;
+import com.sun.prism.impl.BaseGPUTimer;
 import com.sun.prism.impl.PrismSettings;
 import com.sun.prism.paint.Color;
 
@@ -69,6 +70,12 @@ abstract class GLContext {
     final static int GL_ALPHA                     = 44;
     final static int GL_RGBA32F                   = 45;
     final static int GL_YCBCR_422_APPLE           = 46;
+    final static int GL_LUMINANCE_ALPHA           = 47;
+
+    // Use by Texture: Compressed Pixel Format
+    final static int GL_COMPRESSED_RGBA_S3TC_DXT1 = 130;
+    final static int GL_COMPRESSED_RGBA_S3TC_DXT3 = 131;
+    final static int GL_COMPRESSED_RGBA_S3TC_DXT5 = 132;
 
     // Use by Texture
     final static int GL_TEXTURE_2D                = 50;
@@ -115,10 +122,16 @@ abstract class GLContext {
     // Use by Uniform Matrix
     final static int NUM_MATRIX_ELEMENTS          = 16;
 
+    // Results of nGetTimerFrameResults
+    final static int TIMER_RESULT_NOT_READY = BaseGPUTimer.RESULT_NOT_READY;
+    final static int TIMER_RESULT_VALID = BaseGPUTimer.RESULT_VALID;
+    final static int TIMER_RESULT_INVALID = BaseGPUTimer.RESULT_INVALID;
+
     long nativeCtxInfo;
     private int maxTextureSize = -1;
     private Boolean nonPowTwoExtAvailable;
     private Boolean clampToZeroAvailable;
+    private float maxAnisotropy = -1f;
 
     // TODO : Consider moving these cached values to ES2Context.
     // track some other state here to avoid redundant state changes
@@ -130,6 +143,16 @@ abstract class GLContext {
     private boolean msaa = false;
     private int maxSampleSize = -1;
 
+    // texture updates of at least this many bytes are staged through
+    // pixel buffer objects, see texSubImage2D
+    private static final int PBO_UPLOAD_THRESHOLD = PrismSettings.pboUploadThreshold;
+    private static final int STATS_FREQUENCY = PrismSettings.prismStatFrequency > 0
+            ? PrismSettings.prismStatFrequency : 600;
+    private long pboUploadBytes;
+    private long pboUploadNanos;
+    private int pboUploadCount;
+    private int statsFrame;
+
     private static final int FBO_ID_UNSET = -1;
     private static final int FBO_ID_NOCACHE = -2;
     private int nativeFBOID = PlatformUtil.isMac() || PlatformUtil.isIOS() ? FBO_ID_NOCACHE : FBO_ID_UNSET;
@@ -151,6 +174,8 @@ abstract class GLContext {
     private static native int nCreateProgram(long nativeCtxInfo,
             int vertexShaderID, int[] fragmentShaderID,
             int numAttrs, String[] attrs, int[] indexs);
+    private static native int nCreateProgramFromBinary(long nativeCtxInfo,
+            int format, byte[] binary);
     private static native int nCreateTexture(long nativeCtxInfo, int width,
             int height);
     private static native void nDeleteRenderBuffer(long nativeCtxInfo, int rbID);
@@ -164,18 +189,39 @@ abstract class GLContext {
     private static native int nGetFBO();
     private static native int nGetIntParam(int pname);
     private static native int nGetMaxSampleSize();
+    private static native byte[] nGetProgramBinary(long nativeCtxInfo,
+            int programID, int[] format);
     private static native int nGetUniformLocation(long nativeCtxInfo,
             int programID, String name);
+    private static native boolean nIsProgramBinarySupported(long nativeCtxInfo);
     private static native void nPixelStorei(int pname, int param);
     private static native boolean nReadPixelsByte(long nativeCtxInfo, int length,
             Buffer buffer, byte[] pixelArr, int x, int y, int w, int h);
     private static native boolean nReadPixelsInt(long nativeCtxInfo, int length,
             Buffer buffer, int[] pixelArr, int x, int y, int w, int h);
+    private static native long nReadPixelsAsync(long nativeCtxInfo,
+            int x, int y, int w, int h);
+    private static native boolean nIsReadPixelsDone(long nativeCtxInfo, long handle);
+    private static native boolean nCompleteReadPixelsByte(long nativeCtxInfo,
+            long handle, int length, Buffer buffer, byte[] pixelArr);
+    private static native boolean nCompleteReadPixelsInt(long nativeCtxInfo,
+            long handle, int length, Buffer buffer, int[] pixelArr);
+    private static native void nDisposeReadPixels(long nativeCtxInfo, long handle);
+    private static native boolean nCompressedTexImage2D(long nativeCtxInfo, int level,
+            int internalFormat, int width, int height, byte[] data);
+    private static native long nCreateTimerFrame(long nativeCtxInfo, int numTimestamps);
+    private static native void nBeginTimerFrame(long nativeCtxInfo, long nativeFrame);
+    private static native void nTimestamp(long nativeCtxInfo, long nativeFrame, int index);
+    private static native int nGetTimerFrameResults(long nativeCtxInfo, long nativeFrame,
+            long[] nanos);
+    private static native void nDeleteTimerFrame(long nativeCtxInfo, long nativeFrame);
     private static native void nScissorTest(long nativeCtxInfo, boolean enable,
             int x, int y, int w, int h);
     private static native void nSetDepthTest(long nativeCtxInfo, boolean depthTest);
     private static native void nSetMSAA(long nativeCtxInfo, boolean msaa);
     private static native void nTexParamsMinMax(int min, int max);
+    private static native float nGetMaxAnisotropy(long nativeCtxInfo);
+    private static native void nTexParamsAnisotropy(float anisotropy);
     private static native boolean nTexImage2D0(int target, int level, int internalFormat,
             int width, int height, int border, int format,
             int type, Object pixels, int pixelsByteOffset, boolean useMipmap);
@@ -188,6 +234,12 @@ abstract class GLContext {
     private static native void nTexSubImage2D1(int target, int level,
             int xoffset, int yoffset, int width, int height, int format,
             int type, Object pixels, int pixelsByteOffset);
+    private static native int nTexSubImage2DPBO0(long nativeCtxInfo, int target,
+            int level, int xoffset, int yoffset, int width, int height, int format,
+            int type, Object pixels, int pixelsByteOffset, int length, int minBytes);
+    private static native int nTexSubImage2DPBO1(long nativeCtxInfo, int target,
+            int level, int xoffset, int yoffset, int width, int height, int format,
+            int type, Object pixels, int pixelsByteOffset, int length, int minBytes);
     private static native void nUpdateViewport(long nativeCtxInfo, int x, int y,
             int w, int h);
     private static native void nUniform1f(long nativeCtxInfo, int location, float v0);
@@ -215,7 +267,7 @@ abstract class GLContext {
     private static native void nUniformMatrix4fv(long nativeCtxInfo, int location,
             boolean transpose, float values[]);
     private static native void nUpdateFilterState(long nativeCtxInfo, int texID,
-            boolean linearFilter);
+            boolean linearFilter, boolean useMipmap);
     private static native void nUpdateWrapState(long nativeCtxInfo, int texID,
             int wrapMode);
     private static native void nUseProgram(long nativeCtxInfo, int pID);
@@ -235,6 +287,8 @@ abstract class GLContext {
             float[] vertexBuffer, int vertexBufferLength, short[] indexBuffer, int indexBufferLength);
     private static native boolean nBuildNativeGeometryInt(long nativeCtxInfo, long nativeHandle,
             float[] vertexBuffer, int vertexBufferLength, int[] indexBuffer, int indexBufferLength);
+    private static native boolean nUpdateNativeVertices(long nativeCtxInfo, long nativeHandle,
+            float[] vertexBuffer, int vertexBufferLength, int dirtyFrom, int dirtyTo);
     private static native long nCreateES2PhongMaterial(long nativeCtxInfo);
     private static native void nReleaseES2PhongMaterial(long nativeCtxInfo, long nativeHandle);
     private static native void nSetSolidColor(long nativeCtxInfo, long nativePhongMaterial,
@@ -386,6 +440,30 @@ abstract class GLContext {
                 attrs.length, attrs, indexs);
     }
 
+    /**
+     * Returns whether linked programs can be saved with getProgramBinary()
+     * and restored with createProgramFromBinary().
+     */
+    boolean isProgramBinarySupported() {
+        return nIsProgramBinarySupported(nativeCtxInfo);
+    }
+
+    /**
+     * Returns the driver specific binary of a linked program, with its
+     * format stored in format[0], or null if the driver has none.
+     */
+    byte[] getProgramBinary(int programID, int[] format) {
+        return nGetProgramBinary(nativeCtxInfo, programID, format);
+    }
+
+    /**
+     * Creates a shader program from a binary returned by getProgramBinary().
+     * Returns 0 if the driver rejects the binary.
+     */
+    int createProgramFromBinary(int format, byte[] binary) {
+        return nCreateProgramFromBinary(nativeCtxInfo, format, binary);
+    }
+
     int createTexture(int width, int height) {
         return nCreateTexture(nativeCtxInfo, width, height);
     }
@@ -529,6 +607,15 @@ abstract class GLContext {
 
     abstract void makeCurrent(GLDrawable drawable);
 
+    /**
+     * Copies the image of a native video surface into the texture on the
+     * GPU. Returns false if the context cannot do this, in which case the
+     * pixels have to be uploaded.
+     */
+    boolean copyNativeSurface(long surface, int texID, int width, int height, boolean ycbcr) {
+        return false;
+    }
+
     void pixelStorei(int pname, int param) {
         nPixelStorei(pname, param);
     }
@@ -556,6 +643,71 @@ abstract class GLContext {
         return res;
     }
 
+    /**
+     * Issues a read of the bound framebuffer into a pixel buffer object.
+     * Returns a handle for {@link #completeReadPixels}, or 0 if the context
+     * cannot read asynchronously.
+     */
+    long readPixelsAsync(int x, int y, int w, int h) {
+        return nReadPixelsAsync(nativeCtxInfo, x, y, w, h);
+    }
+
+    boolean isReadPixelsDone(long handle) {
+        return nIsReadPixelsDone(nativeCtxInfo, handle);
+    }
+
+    /**
+     * Copies the pixels of an asynchronous read into the buffer and
+     * releases the handle, waiting for the GPU if needed.
+     */
+    boolean completeReadPixels(long handle, Buffer buffer) {
+        boolean res = false;
+        if (buffer instanceof ByteBuffer) {
+            ByteBuffer buf = (ByteBuffer) buffer;
+            byte[] arr = buf.hasArray() ? buf.array() : null;
+            int length = buf.capacity();
+            res = nCompleteReadPixelsByte(nativeCtxInfo, handle, length, buffer, arr);
+        } else if (buffer instanceof IntBuffer) {
+            IntBuffer buf = (IntBuffer) buffer;
+            int[] arr = buf.hasArray() ? buf.array() : null;
+            int length = buf.capacity() * 4;
+            res = nCompleteReadPixelsInt(nativeCtxInfo, handle, length, buffer, arr);
+        } else {
+            nDisposeReadPixels(nativeCtxInfo, handle);
+            throw new IllegalArgumentException("readPixel: pixel's buffer type is not supported: "
+                    + buffer);
+        }
+        return res;
+    }
+
+    void disposeReadPixels(long handle) {
+        nDisposeReadPixels(nativeCtxInfo, handle);
+    }
+
+    /**
+     * Creates the timestamp queries of one frame for ES2GPUTimer. Returns 0
+     * if timer queries are not supported.
+     */
+    long createTimerFrame(int numTimestamps) {
+        return nCreateTimerFrame(nativeCtxInfo, numTimestamps);
+    }
+
+    void beginTimerFrame(long nativeFrame) {
+        nBeginTimerFrame(nativeCtxInfo, nativeFrame);
+    }
+
+    void timestamp(long nativeFrame, int index) {
+        nTimestamp(nativeCtxInfo, nativeFrame, index);
+    }
+
+    int getTimerFrameResults(long nativeFrame, long[] nanos) {
+        return nGetTimerFrameResults(nativeCtxInfo, nativeFrame, nanos);
+    }
+
+    void deleteTimerFrame(long nativeFrame) {
+        nDeleteTimerFrame(nativeCtxInfo, nativeFrame);
+    }
+
     void scissorTest(boolean enable, int x, int y, int w, int h) {
         nScissorTest(nativeCtxInfo, enable, x, y, w, h);
     }
@@ -572,6 +724,30 @@ abstract class GLContext {
                     : GLContext.GL_NEAREST_MIPMAP_NEAREST;
         }
         nTexParamsMinMax(min, max);
+        if (useMipmap) {
+            texParamsAnisotropy(pname == GLContext.GL_LINEAR);
+        }
+    }
+
+    /**
+     * Returns the anisotropy used for filtering mipmapped textures, which is
+     * the prism.anisotropy setting clamped to what the driver supports.
+     */
+    float getMaxAnisotropy() {
+        if (maxAnisotropy < 0f) {
+            maxAnisotropy = PrismSettings.maxAnisotropy > 1
+                    ? Math.max(1f, Math.min(PrismSettings.maxAnisotropy,
+                                            nGetMaxAnisotropy(nativeCtxInfo)))
+                    : 1f;
+        }
+        return maxAnisotropy;
+    }
+
+    // Applies to the bound texture, which must be mipmapped
+    private void texParamsAnisotropy(boolean linearFilter) {
+        if (getMaxAnisotropy() > 1f) {
+            nTexParamsAnisotropy(linearFilter ? getMaxAnisotropy() : 1f);
+        }
     }
 
     boolean texImage2D(int target, int level, int internalFormat,
@@ -591,9 +767,21 @@ abstract class GLContext {
 
     }
 
+    boolean compressedTexImage2D(int level, int internalFormat,
+            int width, int height, byte[] data) {
+        return nCompressedTexImage2D(nativeCtxInfo, level, internalFormat, width, height, data);
+    }
+
     void texSubImage2D(int target, int level, int xoffset, int yoffset,
             int width, int height, int format, int type, java.nio.Buffer pixels) {
         boolean direct = BufferFactory.isDirect(pixels);
+        if (PBO_UPLOAD_THRESHOLD > 0) {
+            int length = pixels.remaining() << ES2Texture.getBufferElementSizeLog(pixels);
+            if (length >= PBO_UPLOAD_THRESHOLD && texSubImage2DPBO(target, level,
+                    xoffset, yoffset, width, height, format, type, pixels, direct, length)) {
+                return;
+            }
+        }
         if (direct) {
             nTexSubImage2D0(target, level, xoffset, yoffset, width, height,
                     format, type, pixels,
@@ -605,6 +793,59 @@ abstract class GLContext {
         }
     }
 
+    /*
+     * Try to stage the update through a pixel buffer object, so that the
+     * render thread does not wait on the driver copy. Returns false if the
+     * update is too small or the context has no mappable pixel buffers.
+     */
+    private boolean texSubImage2DPBO(int target, int level, int xoffset, int yoffset,
+            int width, int height, int format, int type, java.nio.Buffer pixels,
+            boolean direct, int length) {
+        long start = System.nanoTime();
+        int staged;
+        if (direct) {
+            staged = nTexSubImage2DPBO0(nativeCtxInfo, target, level, xoffset, yoffset,
+                    width, height, format, type, pixels,
+                    BufferFactory.getDirectBufferByteOffset(pixels),
+                    length, PBO_UPLOAD_THRESHOLD);
+        } else {
+            staged = nTexSubImage2DPBO1(nativeCtxInfo, target, level, xoffset, yoffset,
+                    width, height, format, type, BufferFactory.getArray(pixels),
+                    BufferFactory.getIndirectBufferByteOffset(pixels),
+                    length, PBO_UPLOAD_THRESHOLD);
+        }
+        if (staged == 0) {
+            return false;
+        }
+        pboUploadNanos += System.nanoTime() - start;
+        pboUploadBytes += staged;
+        pboUploadCount++;
+        return true;
+    }
+
+    /*
+     * Called once per presented frame; with -Dprism.verbose prints the
+     * throughput of the staged texture uploads every prism.printStats
+     * frames (600 if unset), if there were any.
+     */
+    void updateUploadStats() {
+        if (!PrismSettings.verbose || ++statsFrame < STATS_FREQUENCY) {
+            return;
+        }
+        if (pboUploadCount > 0) {
+            double ms = pboUploadNanos / 1e6;
+            double mb = pboUploadBytes / (1024.0 * 1024.0);
+            System.err.printf("ES2 PBO texture uploads: %d in %d frames, %.1f MB, "
+                    + "%.2f ms on the render thread (%.0f MB/s)%n",
+                    pboUploadCount, statsFrame, mb, ms,
+                    ms > 0 ? mb * 1000.0 / ms : 0.0);
+        }
+        statsFrame = 0;
+        pboUploadCount = 0;
+        pboUploadBytes = 0;
+        pboUploadNanos = 0;
+    }
+
     void updateViewportAndDepthTest(int x, int y, int w, int h,
             boolean depthTest) {
         if (viewportX != x || viewportY != y || viewportWidth != w || viewportHeight != h) {
@@ -627,8 +868,11 @@ abstract class GLContext {
         }
     }
 
-    void updateFilterState(int texID, boolean linearFilter) {
-        nUpdateFilterState(nativeCtxInfo, texID, linearFilter);
+    void updateFilterState(int texID, boolean linearFilter, boolean useMipmap) {
+        nUpdateFilterState(nativeCtxInfo, texID, linearFilter, useMipmap);
+        if (useMipmap) {
+            texParamsAnisotropy(linearFilter);
+        }
     }
 
     void updateWrapState(int texID, WrapMode wrapMode) {
@@ -760,6 +1004,12 @@ abstract class GLContext {
                 vertexBufferLength, indexBuffer, indexBufferLength);
     }
 
+    boolean updateNativeVertices(long nativeHandle, float[] vertexBuffer,
+            int vertexBufferLength, int dirtyFrom, int dirtyTo) {
+        return nUpdateNativeVertices(nativeCtxInfo, nativeHandle, vertexBuffer,
+                vertexBufferLength, dirtyFrom, dirtyTo);
+    }
+
     long createES2PhongMaterial() {
         return nCreateES2PhongMaterial(nativeCtxInfo);
     }
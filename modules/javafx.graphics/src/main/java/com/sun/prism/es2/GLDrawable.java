@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -52,4 +52,12 @@ abstract class GLDrawable {
         return nativeDrawableInfo;
     }
     abstract boolean swapBuffers(GLContext glCtx);
+
+    /**
+     * Returns how many swaps ago the current back buffer was last drawn to,
+     * or 0 if its contents are undefined. The drawable must be current.
+     */
+    int getBufferAge(GLContext glCtx) {
+        return 0;
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,8 @@ class MacGLContext extends GLContext {
             long nativeshareCtxHandle, boolean vSyncRequest);
     private static native long nGetNativeHandle(long nativeCtxInfo);
     private static native void nMakeCurrent(long nativeCtxInfo, long nativeDInfo);
+    private static native boolean nCopyIOSurface(long nativeCtxInfo, long surface,
+            int texID, int width, int height, boolean ycbcr);
 
     MacGLContext(long nativeCtxInfo) {
         this.nativeCtxInfo = nativeCtxInfo;
@@ -67,4 +69,9 @@ class MacGLContext extends GLContext {
     void makeCurrent(GLDrawable drawable) {
         nMakeCurrent(nativeCtxInfo, drawable.getNativeDrawableInfo());
     }
+
+    @Override
+    boolean copyNativeSurface(long surface, int texID, int width, int height, boolean ycbcr) {
+        return nCopyIOSurface(nativeCtxInfo, surface, texID, width, height, ycbcr);
+    }
 }
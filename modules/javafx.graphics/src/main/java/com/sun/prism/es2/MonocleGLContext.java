@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,8 @@ import com.sun.glass.ui.monocle.AcceleratedScreen;
 class MonocleGLContext extends GLContext {
 
     @Native private AcceleratedScreen accScreen;
+    private boolean vSyncRequest = true;
+    private boolean swapIntervalSet;
 
     MonocleGLContext(long nativeCtxInfo) {
         this.nativeCtxInfo = nativeCtxInfo;
@@ -41,6 +43,7 @@ class MonocleGLContext extends GLContext {
                           long nativeCtxInfo) {
         this.accScreen = accScreen;
         this.nativeCtxInfo = nativeCtxInfo;
+        this.vSyncRequest = vSyncRequest;
     }
 
     @Override
@@ -52,6 +55,11 @@ class MonocleGLContext extends GLContext {
     void makeCurrent(GLDrawable drawable) {
         if (drawable != null) {
             accScreen.enableRendering(true);
+            // EGL swaps at vsync by default, so only turning it off is needed
+            if (!vSyncRequest && !swapIntervalSet) {
+                accScreen.setSwapInterval(0);
+                swapIntervalSet = true;
+            }
         } else {
             accScreen.enableRendering(false);
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,12 +25,12 @@
 
 package com.sun.prism.es2;
 
-
+import com.sun.prism.impl.PrismSettings;
 
 class X11GLContext extends GLContext {
 
     private static native long nInitialize(long nativeDInfo, long nativePFInfo,
-            boolean vSyncRequest);
+            boolean vSyncRequest, boolean adaptiveVsyncRequest);
     private static native long nGetNativeHandle(long nativeCtxInfo);
     private static native void nMakeCurrent(long nativeCtxInfo, long nativeDInfo);
 
@@ -56,7 +56,8 @@ class X11GLContext extends GLContext {
 
         // return the context info object created on the default screen
         nativeCtxInfo = nInitialize(drawable.getNativeDrawableInfo(),
-                pixelFormat.getNativePFInfo(), vSyncRequest);
+                pixelFormat.getNativePFInfo(), vSyncRequest,
+                vSyncRequest && PrismSettings.adaptiveVsync);
     }
 
     @Override
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@ class X11GLDrawable extends GLDrawable {
     private static native long nCreateDrawable(long nativeWindow, long nativeCtxInfo);
     private static native long nGetDummyDrawable(long nativeCtxInfo);
     private static native boolean nSwapBuffers(long nativeDInfo);
+    private static native int nGetBufferAge(long nativeCtxInfo, long nativeDInfo);
 
     X11GLDrawable(GLPixelFormat pixelFormat) {
 
@@ -49,4 +50,9 @@ class X11GLDrawable extends GLDrawable {
     boolean swapBuffers(GLContext glCtx) {
         return nSwapBuffers(getNativeDrawableInfo());
     }
+
+    @Override
+    int getBufferAge(GLContext glCtx) {
+        return nGetBufferAge(glCtx.getNativeCtxInfo(), getNativeDrawableInfo());
+    }
 }
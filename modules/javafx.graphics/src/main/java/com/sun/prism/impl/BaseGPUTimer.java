@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.prism.impl;
+
+import com.sun.javafx.logging.PulseLogger;
+import com.sun.prism.GPUTimer;
+import static com.sun.javafx.logging.PulseLogger.PULSE_LOGGING_ENABLED;
+
+/**
+ * Keeps the timestamp queries of the last few frames in flight and reads
+ * them back without waiting on the GPU. Frames whose queries are still
+ * pending when their slot comes around again are not measured.
+ */
+public abstract class BaseGPUTimer implements GPUTimer {
+
+    public static final int RESULT_NOT_READY = 0;
+    public static final int RESULT_VALID = 1;
+    public static final int RESULT_INVALID = 2;
+
+    // Timestamps of a frame
+    private static final int BEGIN = 0;
+    private static final int PAINT = 1;
+    private static final int PRESENT = 2;
+    private static final int NUM_TIMESTAMPS = 3;
+
+    private static final int NUM_FRAMES = 4;
+
+    private final BaseContext context;
+    private final long[] frames = new long[NUM_FRAMES];
+    private final boolean[] pending = new boolean[NUM_FRAMES];
+    private final long[] timestamps = new long[NUM_TIMESTAMPS];
+    private int nextFrame;
+    private int currentFrame = -1;
+    private boolean unsupported;
+    private volatile FrameTimes lastFrameTimes;
+
+    protected BaseGPUTimer(BaseContext context) {
+        this.context = context;
+    }
+
+    /**
+     * Creates the queries for one frame. Returns 0 if the device does not
+     * support timestamp queries.
+     */
+    protected abstract long createFrame(int numTimestamps);
+
+    protected abstract void beginFrame(long frame);
+
+    protected abstract void timestamp(long frame, int index);
+
+    protected abstract void endFrame(long frame);
+
+    /**
+     * Stores the timestamps of the frame, in nanoseconds, if the GPU has
+     * executed it. Returns one of the RESULT constants.
+     */
+    protected abstract int getResults(long frame, long[] nanos);
+
+    protected abstract void disposeFrame(long frame);
+
+    @Override
+    public void beginFrame() {
+        collectResults();
+        if (unsupported || pending[nextFrame]) {
+            return;
+        }
+        if (frames[nextFrame] == 0) {
+            frames[nextFrame] = createFrame(NUM_TIMESTAMPS);
+            if (frames[nextFrame] == 0) {
+                unsupported = true;
+                return;
+            }
+        }
+        currentFrame = nextFrame;
+        context.flushVertexBuffer();
+        beginFrame(frames[currentFrame]);
+    }
+
+    @Override
+    public void endPaint() {
+        if (currentFrame >= 0) {
+            context.flushVertexBuffer();
+            timestamp(frames[currentFrame], PAINT);
+        }
+    }
+
+    @Override
+    public void endFrame() {
+        if (currentFrame >= 0) {
+            timestamp(frames[currentFrame], PRESENT);
+            endFrame(frames[currentFrame]);
+            pending[currentFrame] = true;
+            nextFrame = (currentFrame + 1) % NUM_FRAMES;
+            currentFrame = -1;
+        }
+    }
+
+    @Override
+    public FrameTimes getLastFrameTimes() {
+        return lastFrameTimes;
+    }
+
+    private void collectResults() {
+        // Oldest first; the GPU executes the frames in order
+        for (int n = 0; n < NUM_FRAMES; n++) {
+            int i = (nextFrame + n) % NUM_FRAMES;
+            if (!pending[i]) {
+                continue;
+            }
+            int result = getResults(frames[i], timestamps);
+            if (result == RESULT_NOT_READY) {
+                break;
+            }
+            pending[i] = false;
+            if (result == RESULT_VALID) {
+                FrameTimes times = new FrameTimes(timestamps[PAINT] - timestamps[BEGIN],
+                        timestamps[PRESENT] - timestamps[PAINT]);
+                lastFrameTimes = times;
+                if (PULSE_LOGGING_ENABLED) {
+                    PulseLogger.addMessage("GPU time: paint " + times.paintNanos() / 1000
+                            + " us, present " + times.presentNanos() / 1000 + " us");
+                }
+            }
+        }
+    }
+
+    public void dispose() {
+        for (int i = 0; i < NUM_FRAMES; i++) {
+            if (frames[i] != 0) {
+                disposeFrame(frames[i]);
+                frames[i] = 0;
+            }
+            pending[i] = false;
+        }
+        currentFrame = -1;
+    }
+}
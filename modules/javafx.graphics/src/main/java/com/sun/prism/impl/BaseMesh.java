@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -78,6 +78,15 @@ public abstract class BaseMesh extends BaseGraphicsResource implements Mesh {
     public abstract boolean buildNativeGeometry(float[] vertexBuffer,
             int vertexBufferLength, short[] indexBufferShort, int indexBufferLength);
 
+    /**
+     * Updates the vertices of geometry that was built before, without
+     * changing its faces. Only the floats from dirtyFrom (inclusive) to
+     * dirtyTo (exclusive) differ from the last upload. Returns false if the
+     * update cannot be done, in which case the geometry has to be built again.
+     */
+    public abstract boolean updateNativeVertices(float[] vertexBuffer,
+            int vertexBufferLength, int dirtyFrom, int dirtyTo);
+
     private boolean[] dirtyVertices;
     private float[] cachedNormals;
     private float[] cachedTangents;
@@ -490,6 +499,24 @@ public abstract class BaseMesh extends BaseGraphicsResource implements Mesh {
         convertNormalsToQuats(instance, numberOfVertices,
                 cachedNormals, cachedTangents, cachedBitangents, vertexBuffer, dirtyVertices);
 
+        // The faces are unchanged, so only the range of dirty vertices
+        // has to be sent; the index buffer stays as it is
+        int firstDirty = 0;
+        while (firstDirty < numberOfVertices && !dirtyVertices[firstDirty]) {
+            firstDirty++;
+        }
+        if (firstDirty == numberOfVertices) {
+            return true;
+        }
+        int lastDirty = numberOfVertices - 1;
+        while (!dirtyVertices[lastDirty]) {
+            lastDirty--;
+        }
+        if (updateNativeVertices(vertexBuffer, numberOfVertices * VERTEX_SIZE_VB,
+                firstDirty * VERTEX_SIZE_VB, (lastDirty + 1) * VERTEX_SIZE_VB)) {
+            return true;
+        }
+
         if (indexBuffer != null) {
             return buildNativeGeometry(vertexBuffer,
                     numberOfVertices * VERTEX_SIZE_VB, indexBuffer, indexBufferSize);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,10 +32,76 @@ import com.sun.prism.MeshView;
  */
 public abstract class BaseMeshView extends BaseGraphicsResource implements MeshView {
 
+    private static final int NUM_LIGHTS = 3;
+    private static final int LIGHT_VALUES = 18;
+
+    // The culling mode and lights of every mesh view are set on every
+    // frame, and for most scenes they stay the same. The last values are
+    // kept so that unchanged ones are not passed to the native side again.
+    private int cullingMode = -1;
+    private final float[] ambientLight = { Float.NaN, Float.NaN, Float.NaN };
+    private final float[][] lights = new float[NUM_LIGHTS][];
+
     protected BaseMeshView(Disposer.Record disposerRecord) {
         super(disposerRecord);
     }
 
+    protected boolean updateCullingMode(int mode) {
+        if (cullingMode == mode) {
+            return false;
+        }
+        cullingMode = mode;
+        return true;
+    }
+
+    protected boolean updateAmbientLight(float r, float g, float b) {
+        if (ambientLight[0] == r && ambientLight[1] == g && ambientLight[2] == b) {
+            return false;
+        }
+        ambientLight[0] = r;
+        ambientLight[1] = g;
+        ambientLight[2] = b;
+        return true;
+    }
+
+    protected boolean updateLight(int index, float x, float y, float z, float r, float g, float b, float w,
+            float ca, float la, float qa, float isAttenuated, float maxRange, float dirX, float dirY, float dirZ,
+            float innerAngle, float outerAngle, float falloff) {
+        if (index < 0 || index >= NUM_LIGHTS) {
+            return false;
+        }
+        float[] light = lights[index];
+        if (light == null) {
+            light = lights[index] = new float[LIGHT_VALUES];
+        } else if (light[0] == x && light[1] == y && light[2] == z
+                && light[3] == r && light[4] == g && light[5] == b && light[6] == w
+                && light[7] == ca && light[8] == la && light[9] == qa
+                && light[10] == isAttenuated && light[11] == maxRange
+                && light[12] == dirX && light[13] == dirY && light[14] == dirZ
+                && light[15] == innerAngle && light[16] == outerAngle && light[17] == falloff) {
+            return false;
+        }
+        light[0] = x;
+        light[1] = y;
+        light[2] = z;
+        light[3] = r;
+        light[4] = g;
+        light[5] = b;
+        light[6] = w;
+        light[7] = ca;
+        light[8] = la;
+        light[9] = qa;
+        light[10] = isAttenuated;
+        light[11] = maxRange;
+        light[12] = dirX;
+        light[13] = dirY;
+        light[14] = dirZ;
+        light[15] = innerAngle;
+        light[16] = outerAngle;
+        light[17] = falloff;
+        return true;
+    }
+
     @Override
     public boolean isValid() {
         return true;
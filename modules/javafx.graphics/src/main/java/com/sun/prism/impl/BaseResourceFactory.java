@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,8 @@
 package com.sun.prism.impl;
 
 import com.sun.javafx.geom.Rectangle;
+import com.sun.javafx.iio.CompressedImageData;
+import com.sun.prism.GPUTimer;
 import com.sun.prism.Image;
 import com.sun.prism.PixelFormat;
 import com.sun.prism.ResourceFactory;
@@ -34,7 +36,9 @@ import com.sun.prism.Texture;
 import com.sun.prism.Texture.Usage;
 import com.sun.prism.Texture.WrapMode;
 
+import java.util.Collections;
 import java.util.Map;
+import java.util.Set;
 import java.util.WeakHashMap;
 import java.util.Collection;
 
@@ -45,6 +49,10 @@ public abstract class BaseResourceFactory implements ResourceFactory {
     private final Map<Image,Texture> repeatTexCache;
     // Solely used by diffuse and selfillum maps in PhongMaterial for 3D rendering
     private final Map<Image,Texture> mipmapTexCache;
+    // Cached textures created from block compressed image data, which
+    // cannot be updated with pixels
+    private final Set<Texture> compressedTextures =
+            Collections.newSetFromMap(new WeakHashMap<>());
 
     // Use a WeakHashMap as it automatically removes dead objects when they're
     // collected
@@ -205,7 +213,7 @@ public abstract class BaseResourceFactory implements ResourceFactory {
             Texture othertex = (wrapMode == WrapMode.REPEAT
                    ? clampTexCache
                    : repeatTexCache).get(image);
-            if (othertex != null) {
+            if (othertex != null && !compressedTextures.contains(othertex)) {
                 othertex.lock();
                 if (!othertex.isSurfaceLost()) {
                     // This conversion operation will fail if the texture is
@@ -224,18 +232,43 @@ public abstract class BaseResourceFactory implements ResourceFactory {
         }
 
         Pair <Integer, Rectangle> idRect = image.getSerial().getIdRect();
+        if (tex != null && tex.getLastImageSerial() != idRect.getKey()
+                && compressedTextures.contains(tex)) {
+            // The pixels were modified, so the compressed data is stale
+            texCache.remove(image);
+            tex.unlock();
+            tex.dispose();
+            tex = null;
+        }
         if (tex == null) {
             int w = image.getWidth();
             int h = image.getHeight();
             TextureResourcePool pool = getTextureResourcePool();
-            // Mipmap will use more memory
-            long size = useMipmap ? sizeWithMipMap(w, h, image.getPixelFormat())
-                    : pool.estimateTextureSize(w, h, image.getPixelFormat());
-            if (!pool.prepareForAllocation(size)) {
-                return null;
+            CompressedImageData data = wrapMode == WrapMode.REPEAT
+                    ? image.getCompressedData() : null;
+            if (data != null && (!isCompressedFormatSupported(data.getFormat())
+                                 || (useMipmap && !data.hasAllMipmapLevels()))) {
+                data = null;
             }
+            if (data != null) {
+                if (!pool.prepareForAllocation(data.getSize(useMipmap ? data.getLevelCount() : 1))) {
+                    return null;
+                }
+                tex = createCompressedTexture(data, wrapMode, useMipmap);
+                if (tex != null) {
+                    compressedTextures.add(tex);
+                }
+            }
+            if (tex == null) {
+                // Mipmap will use more memory
+                long size = useMipmap ? sizeWithMipMap(w, h, image.getPixelFormat())
+                        : pool.estimateTextureSize(w, h, image.getPixelFormat());
+                if (!pool.prepareForAllocation(size)) {
+                    return null;
+                }
 
-            tex = createTexture(image, Usage.DEFAULT, wrapMode, useMipmap);
+                tex = createTexture(image, Usage.DEFAULT, wrapMode, useMipmap);
+            }
             if (tex != null) {
                 tex.setLastImageSerial(idRect.getKey());
                 texCache.put(image, tex);
@@ -334,6 +367,30 @@ public abstract class BaseResourceFactory implements ResourceFactory {
         return superShaderAllowed;
     }
 
+    @Override
+    public GPUTimer getGPUTimer() {
+        return null;
+    }
+
+    /**
+     * Returns whether textures can be created from block compressed data
+     * in the given format.
+     */
+    protected boolean isCompressedFormatSupported(CompressedImageData.Format format) {
+        return false;
+    }
+
+    /**
+     * Creates a texture from block compressed data, uploading all levels
+     * when useMipmap is true. The texture is returned locked, like those
+     * from the other create methods. Returns null if it cannot be created,
+     * in which case the decoded pixels are used.
+     */
+    protected Texture createCompressedTexture(CompressedImageData data,
+                                              WrapMode wrapMode, boolean useMipmap) {
+        return null;
+    }
+
     protected boolean canClampToZero() {
         return true;
     }
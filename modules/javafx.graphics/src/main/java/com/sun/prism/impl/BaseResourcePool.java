@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,13 @@
 package com.sun.prism.impl;
 
 import java.lang.ref.WeakReference;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.IdentityHashMap;
+import java.util.Set;
+
+import static com.sun.javafx.logging.PulseLogger.PULSE_LOGGING_ENABLED;
+import com.sun.javafx.logging.PulseLogger;
 
 /**
  * The base implementation of the {@link ResourcePool} interface, providing
@@ -67,6 +74,14 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
     }
 
     long managedSize;
+    // Device memory that is not held by managed resources, such as
+    // swap chains and mesh buffers, which can't be pruned but count
+    // against the budget.
+    long unmanagedSize;
+    // Statistics for monitoring, see printSummary()
+    private long evictedCount;
+    private long evictedSize;
+    private long failedAllocations;
     final long origTarget;
     long curTarget;
     final long maxSize;
@@ -167,11 +182,11 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
             }
 
             // Finally, look to the garbage collector to dislodge some unreferenced
-            // resources that we can free with a very aggressive age set of (0, 0)
-            // which will target all unlocked/non-permanent textures.
+            // resources and then free the unlocked/non-permanent resources that
+            // were used the longest time ago until the allocation fits.
             // Two tries, one with just a gc(), and a desperate one with a sleep...
             for (int i = 0; i < 2; i++) {
-                pruneLastChance(i > 0);
+                pruneLastChance(i > 0, needed);
                 if (used() + needed <= max()) {
                     if (used() + needed > target()) {
                         setTarget(used() + needed);
@@ -195,7 +210,7 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
         }
     }
 
-    private void pruneLastChance(boolean desperate) {
+    private void pruneLastChance(boolean desperate, long needed) {
         System.gc();
         if (desperate) {
             // Our alternative is to return false here and cause an allocation
@@ -214,7 +229,68 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
             }
             System.err.println(" in pool: "+this);
         }
-        cleanup((mr) -> { return true; });
+        pruneLeastRecentlyUsed(used() + needed - max());
+    }
+
+    /**
+     * Frees the unlocked and non-permanent resources in least recently used
+     * order, uninteresting ones first among those of the same age, until at
+     * least the indicated amount has been freed.
+     */
+    private void pruneLeastRecentlyUsed(long amount) {
+        if (amount <= 0) {
+            return;
+        }
+        ArrayList<WeakLinkedList<T>> candidates = new ArrayList<>();
+        for (WeakLinkedList<T> cur = resourceHead.next; cur != null; cur = cur.next) {
+            ManagedResource<T> mr = cur.getResource();
+            if (!ManagedResource._isgone(mr) && !mr.isPermanent() && !mr.isLocked()) {
+                candidates.add(cur);
+            }
+        }
+        candidates.sort((a, b) -> {
+            ManagedResource<T> ma = a.getResource();
+            ManagedResource<T> mb = b.getResource();
+            int ageA = ma == null ? Integer.MAX_VALUE : ma.getAge();
+            int ageB = mb == null ? Integer.MAX_VALUE : mb.getAge();
+            if (ageA != ageB) {
+                return ageA > ageB ? -1 : 1;
+            }
+            boolean intA = ma != null && ma.isInteresting();
+            boolean intB = mb != null && mb.isInteresting();
+            return Boolean.compare(intA, intB);
+        });
+        Set<ManagedResource<?>> victims =
+            Collections.newSetFromMap(new IdentityHashMap<>());
+        long freed = 0;
+        for (WeakLinkedList<T> link : candidates) {
+            if (freed >= amount) {
+                break;
+            }
+            ManagedResource<T> mr = link.getResource();
+            if (mr != null) {
+                victims.add(mr);
+                freed += link.size;
+            }
+        }
+        cleanup((mr) -> { return victims.contains(mr); });
+    }
+
+    @Override
+    public boolean allocationFailed(long size) {
+        failedAllocations++;
+        if (PULSE_LOGGING_ENABLED) {
+            PulseLogger.incrementCounter("Texture allocation failures");
+        }
+        if (PrismSettings.poolDebug || PrismSettings.verbose) {
+            System.err.printf("Device failed to allocate %,d with %,d used in pool: %s\n",
+                              size, used(), this);
+        }
+        long wasused = used();
+        Disposer.cleanUp();
+        cleanup((mr) -> { return false; });
+        pruneLeastRecentlyUsed(size - (wasused - used()));
+        return used() < wasused;
     }
 
     private void cleanup(Predicate predicate) {
@@ -235,6 +311,11 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
                 mr.free();
                 mr.resource = null;
                 recordFree(cur.size);
+                evictedCount++;
+                evictedSize += cur.size;
+                if (PULSE_LOGGING_ENABLED) {
+                    PulseLogger.incrementCounter("Textures evicted");
+                }
                 cur = cur.next;
                 prev.next = cur;
             } else {
@@ -331,6 +412,9 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
                           this, used(), percentUsed,
                           target(), percentTarget,
                           max());
+        System.err.printf("%,d managed, %,d unmanaged, %,d evicted (%,d resources), %,d failed allocations\n",
+                          managed(), unmanaged(), evictedSize(), evictedCount(),
+                          failedAllocations());
 
         for (WeakLinkedList<T> cur = resourceHead.next; cur != null; cur = cur.next) {
             ManagedResource<T> mr = cur.getResource();
@@ -394,7 +478,66 @@ public abstract class BaseResourcePool<T> implements ResourcePool<T> {
         if (sharedParent != null) {
             return sharedParent.used();
         }
-        return managedSize;
+        return managedSize + unmanagedSize;
+    }
+
+    /**
+     * The amount of this resource used by allocations that are not managed
+     * resources, as recorded by {@link #recordUnmanagedAllocated(long)}.
+     * @return the amount being used to hold unmanaged resources
+     */
+    public final long unmanaged() {
+        return unmanagedSize;
+    }
+
+    /**
+     * Records an allocation that is not held by a {@link ManagedResource}
+     * but uses the same memory, so that the managed resources are pruned to
+     * make room for it.
+     *
+     * @param size the amount of the resource that was allocated
+     */
+    public final void recordUnmanagedAllocated(long size) {
+        unmanagedSize += size;
+    }
+
+    /**
+     * Records that an allocation recorded by
+     * {@link #recordUnmanagedAllocated(long)} was freed.
+     *
+     * @param size the amount of the resource that was freed
+     */
+    public final void recordUnmanagedFree(long size) {
+        unmanagedSize -= size;
+        if (unmanagedSize < 0) {
+            throw new IllegalStateException("Negative unmanaged resource amount");
+        }
+    }
+
+    /**
+     * The number of resources freed to make room for other allocations.
+     * @return the number of evicted resources
+     */
+    public final long evictedCount() {
+        return evictedCount;
+    }
+
+    /**
+     * The total amount of the resource freed to make room for other
+     * allocations.
+     * @return the amount of the resource evicted
+     */
+    public final long evictedSize() {
+        return evictedSize;
+    }
+
+    /**
+     * The number of allocations the device failed, see
+     * {@link #allocationFailed(long)}.
+     * @return the number of failed allocations
+     */
+    public final long failedAllocations() {
+        return failedAllocations;
     }
 
     @Override
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 
 package com.sun.prism.impl;
 
+import com.sun.javafx.logging.PulseLogger;
 import com.sun.prism.Image;
 import com.sun.prism.PixelFormat;
 import com.sun.prism.Texture;
@@ -331,8 +332,8 @@ public abstract class BaseTexture<T extends ManagedResource> implements Texture
                                      int srcw, int srch,
                                      int srcscan)
     {
-        if (format == PixelFormat.MULTI_YCbCr_420) {
-            throw new IllegalArgumentException("MULTI_YCbCr_420 requires multitexturing");
+        if (format.isMultiTexture()) {
+            throw new IllegalArgumentException(format + " requires multitexturing");
         }
         if (buf == null) {
             throw new IllegalArgumentException("Pixel buffer must be non-null");
@@ -389,6 +390,10 @@ public abstract class BaseTexture<T extends ManagedResource> implements Texture
                 "Upload requires " + elemsNeeded + " elements, but only " +
                 buf.remaining() + " elements remain in the buffer");
         }
+        if (PulseLogger.isNativeEnabled(PulseLogger.NATIVE_RENDERING)) {
+            PulseLogger.addNativeEvent(PulseLogger.NATIVE_RENDERING, "Texture upload", 0L,
+                    (long) srcw * srch * bytesPerPixel);
+        }
     }
 
     @Override
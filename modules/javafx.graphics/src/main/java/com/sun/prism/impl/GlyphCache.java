@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -133,6 +133,7 @@ public class GlyphCache {
         int len = gl.getGlyphCount();
         Color currentColor = null;
         Point2D pt = new Point2D();
+        boolean prepared = false;
 
         for (int gi = 0; gi < len; gi++) {
             int gc = gl.getGlyphCode(gi);
@@ -146,7 +147,13 @@ public class GlyphCache {
             pt.setLocation(x + gl.getPosX(gi), y + gl.getPosY(gi));
             xform.transform(pt, pt);
             int subPixel = strike.getQuantizedPosition(pt);
-            GlyphData data = getCachedGlyph(gc, subPixel);
+            GlyphData data = getCachedGlyph(gc, subPixel, prepared);
+            if (data == null && !prepared) {
+                // let the strike rasterize all the missing glyphs at once
+                prepareGlyphs(gl, gi, len, x, y, xform);
+                prepared = true;
+                data = getCachedGlyph(gc, subPixel, true);
+            }
             if (data != null) {
                 if (clip != null) {
                     // Always check clipping using user space.
@@ -238,7 +245,29 @@ public class GlyphCache {
         packer.clear();
     }
 
-    private GlyphData getCachedGlyph(int glyphCode, int subPixel) {
+    private void prepareGlyphs(GlyphList gl, int start, int len,
+                               float x, float y, BaseTransform xform) {
+        int[] glyphCodes = new int[len - start];
+        int[] subPixels = new int[len - start];
+        Point2D pt = new Point2D();
+        int count = 0;
+        for (int gi = start; gi < len; gi++) {
+            int gc = gl.getGlyphCode(gi);
+            if ((gc & CompositeGlyphMapper.GLYPHMASK) != CharToGlyphMapper.INVISIBLE_GLYPH_ID) {
+                pt.setLocation(x + gl.getPosX(gi), y + gl.getPosY(gi));
+                xform.transform(pt, pt);
+                subPixels[count] = strike.getQuantizedPosition(pt);
+                glyphCodes[count++] = gc;
+            }
+        }
+        strike.prepareGlyphs(glyphCodes, subPixels, count);
+    }
+
+    /**
+     * Returns the cached data of a glyph. If it is not cached yet, it is
+     * rendered and inserted in the cache if render is true.
+     */
+    private GlyphData getCachedGlyph(int glyphCode, int subPixel, boolean render) {
         int segIndex = glyphCode >>> SEGSHIFT;
         int subIndex = glyphCode & SEGMASK;
         segIndex |= (subPixel << SUBPIXEL_SHIFT);
@@ -251,6 +280,9 @@ public class GlyphCache {
             segment = new GlyphData[SEGSIZE];
             glyphDataMap.put(segIndex, segment);
         }
+        if (!render) {
+            return null;
+        }
 
         // Render the glyph and insert it in the cache
         GlyphData data = null;
@@ -74,6 +74,10 @@ public final class PrismSettings {
     public static final boolean poolStats;
     public static final boolean poolDebug;
     public static final boolean disableEffects;
+    public static final int decoraThreads;
+    public static final int swThreads;
+    public static final int pboUploadThreshold;
+    public static final boolean uploadStaging;
     public static final int glyphCacheWidth;
     public static final int glyphCacheHeight;
     public static final String perfLog;
@@ -81,6 +85,16 @@ public final class PrismSettings {
     public static final boolean perfLogFirstPaintFlush;
     public static final boolean perfLogFirstPaintExit;
     public static final boolean superShader;
+    public static final String shaderCacheDir;
+    public static final boolean shaderWarmup;
+    public static final boolean gpuTiming;
+    public static final boolean flipModel;
+    public static final boolean highPerformanceGPU;
+    public static final boolean adaptiveVsync;
+    public static final int maxFrameRate;
+    public static final int maxFrameLatency;
+    public static final int maxAnisotropy;
+    public static final int parallel3DThreshold;
     public static final boolean forceUploadingPainter;
     public static final boolean forceAlphaTestShader;
     public static final boolean forceNonAntialiasedShape;
@@ -327,6 +341,39 @@ public final class PrismSettings {
 
         disableEffects = getBoolean(systemProperties, "prism.disableEffects", false);
 
+        /*
+         * Number of threads the native software effects split large images
+         * across, including the render thread. A value of 1 disables it, by
+         * default one thread per core is used, up to 4.
+         */
+        int threads = getInt(systemProperties, "prism.decora.threads", 0,
+                "Try -Dprism.decora.threads=<number>");
+        decoraThreads = (threads > 0) ? threads
+                : Math.min(Runtime.getRuntime().availableProcessors(), 4);
+
+        /*
+         * Number of threads the software pipeline splits large fills
+         * across, in horizontal bands, including the render thread. By
+         * default the render thread does all the rendering.
+         */
+        swThreads = getInt(systemProperties, "prism.sw.threads", 1,
+                "Try -Dprism.sw.threads=<number>");
+
+        /*
+         * Size in bytes from which the ES2 pipeline stages texture updates
+         * through pixel buffer objects instead of uploading them directly.
+         * A value of 0 disables it.
+         */
+        pboUploadThreshold = getInt(systemProperties, "prism.pboUploadThreshold",
+                1024 * 1024, "Try -Dprism.pboUploadThreshold=<number>");
+
+        /*
+         * Copy texture updates from Java arrays into a direct staging buffer
+         * before handing them to native code, instead of pinning the array
+         * for the whole upload.
+         */
+        uploadStaging = getBoolean(systemProperties, "prism.uploadstaging", true);
+
         glyphCacheWidth = getInt(systemProperties, "prism.glyphCacheWidth", 1024,
                 "Try -Dprism.glyphCacheWidth=<number>");
         glyphCacheHeight = getInt(systemProperties, "prism.glyphCacheHeight", 1024,
@@ -343,6 +390,51 @@ public final class PrismSettings {
 
         superShader = getBoolean(systemProperties, "prism.supershader", true);
 
+        // Directory for the linked shader programs of the es2 pipeline
+        shaderCacheDir = systemProperties.getProperty("prism.shadercache");
+
+        // Create the common shaders when the pipeline starts rather than on first use
+        shaderWarmup = getBoolean(systemProperties, "prism.shaderwarmup", false);
+
+        // Measure the GPU time of each frame with timestamp queries
+        gpuTiming = getBoolean(systemProperties, "prism.gputiming", false);
+
+        /*
+         * Present D3D windows with flip-model swap chains, and limit the
+         * number of frames queued ahead of the display. A latency of 0
+         * keeps the driver default.
+         */
+        flipModel = getBoolean(systemProperties, "prism.flipmodel", false);
+
+        // Render D3D windows on the adapter Windows prefers for high performance
+        highPerformanceGPU = getBoolean(systemProperties, "prism.highperformancegpu", false);
+
+        /*
+         * With vsync on, present frames that missed a vblank right away
+         * instead of waiting for the next one (GLX_EXT_swap_control_tear).
+         */
+        adaptiveVsync = getBoolean(systemProperties, "prism.adaptivevsync", false);
+
+        /*
+         * Highest number of frames rendered per second, whatever the refresh
+         * rate of the display. A value of 0 leaves it to vsync.
+         */
+        maxFrameRate = Math.max(0, getInt(systemProperties, "prism.maxfps", 0,
+                "Try -Dprism.maxfps=<number>"));
+        maxFrameLatency = Utils.clamp(0, getInt(systemProperties, "prism.maxframelatency", 0,
+                "Try -Dprism.maxframelatency=<number>"), 16);
+
+        // Maximum anisotropy used to filter mipmapped textures, 1 disables it
+        maxAnisotropy = Math.max(1, getInt(systemProperties, "prism.anisotropy", 1,
+                "Try -Dprism.anisotropy=<number>"));
+
+        /*
+         * Number of 3D shapes in a group from which the view volume test
+         * of the shapes is split across threads. A value of 0 disables it.
+         */
+        parallel3DThreshold = getInt(systemProperties, "prism.parallel3d", 512,
+                "Try -Dprism.parallel3d=<number>");
+
         // Force uploading painter (e.g., to avoid Linux live-resize jittering)
         forceUploadingPainter = getBoolean(systemProperties, "prism.forceUploadingPainter", false);
 
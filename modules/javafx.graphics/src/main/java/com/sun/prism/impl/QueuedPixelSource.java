@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.prism.impl;
 
 import com.sun.glass.ui.Application;
 import com.sun.glass.ui.Pixels;
+import com.sun.javafx.geom.Rectangle;
 import com.sun.prism.PixelSource;
 import java.lang.ref.WeakReference;
 import java.nio.IntBuffer;
@@ -61,6 +62,10 @@ import java.util.List;
 public class QueuedPixelSource implements PixelSource {
     private volatile Pixels beingConsumed;
     private volatile Pixels enqueued;
+    // What changed since the last consumed pixels, accumulated over the
+    // deliveries that were replaced in the queue. Null for everything.
+    private Rectangle enqueuedDirty;
+    private Rectangle consumedDirty;
     private final List<WeakReference<Pixels>> saved =
          new ArrayList<>(3);
     private final boolean useDirectBuffers;
@@ -77,10 +82,17 @@ public class QueuedPixelSource implements PixelSource {
         if (enqueued != null) {
             beingConsumed = enqueued;
             enqueued = null;
+            consumedDirty = enqueuedDirty;
+            enqueuedDirty = new Rectangle();
         }
         return beingConsumed;
     }
 
+    @Override
+    public synchronized Rectangle getLatestDirtyRegion() {
+        return consumedDirty;
+    }
+
     @Override
     public synchronized void doneWithPixels(Pixels used) {
         if (beingConsumed != used) {
@@ -95,6 +107,8 @@ public class QueuedPixelSource implements PixelSource {
             throw new IllegalStateException("cannot skip while processing: "+beingConsumed);
         }
         enqueued = null;
+        // The pixels after these have to replace the whole frame
+        enqueuedDirty = null;
     }
 
     private boolean usesSameBuffer(Pixels p1, Pixels p2) {
@@ -170,6 +184,26 @@ public class QueuedPixelSource implements PixelSource {
      * @param pixels the {@code Pixels} object to be enqueued
      */
     public synchronized void enqueuePixels(Pixels pixels) {
+        enqueuePixels(pixels, null);
+    }
+
+    /**
+     * Place the indicated {@code Pixels} object into the enqueued state,
+     * noting which part of it changed since the previously enqueued one.
+     *
+     * @param pixels the {@code Pixels} object to be enqueued
+     * @param dirty the changed area, or null if all of it changed
+     */
+    public synchronized void enqueuePixels(Pixels pixels, Rectangle dirty) {
         enqueued = pixels;
+        if (dirty == null) {
+            enqueuedDirty = null;
+        } else if (enqueuedDirty != null && !dirty.isEmpty()) {
+            if (enqueuedDirty.isEmpty()) {
+                enqueuedDirty.setBounds(dirty);
+            } else {
+                enqueuedDirty.add(dirty);
+            }
+        }
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -183,4 +183,15 @@ public interface ResourcePool<T> {
      * @return true if there is room for the indicated resource
      */
     public boolean prepareForAllocation(long size);
+
+    /**
+     * Frees the least recently used resources after the device failed to
+     * allocate a resource of the indicated size, which happens when the
+     * device has less memory than the pool expected, so that the
+     * allocation can be tried again.
+     *
+     * @param size the size of the resource that could not be allocated
+     * @return true if any resource was freed
+     */
+    public boolean allocationFailed(long size);
 }
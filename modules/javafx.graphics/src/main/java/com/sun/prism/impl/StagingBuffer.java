@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.prism.impl;
+
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.FloatBuffer;
+import java.nio.IntBuffer;
+
+/**
+ * A direct buffer that texture updates from Java arrays are copied into
+ * before they are passed to native code. The native side then reads native
+ * memory, and the array is never pinned with GetPrimitiveArrayCritical,
+ * which would hold off the garbage collector for the whole upload.
+ * Large updates are staged a band of rows at a time, so the buffer stays
+ * small. Only used on the render thread.
+ */
+public final class StagingBuffer {
+
+    // Size of a band, in bytes
+    private static final int BAND_SIZE = 4 * 1024 * 1024;
+
+    private static ByteBuffer staging;
+
+    private StagingBuffer() {
+    }
+
+    /**
+     * Returns true if an update from the given buffer should be staged.
+     */
+    public static boolean isNeeded(Buffer pixels) {
+        return PrismSettings.uploadStaging && !pixels.isDirect() && pixels.hasArray();
+    }
+
+    /**
+     * Returns the number of rows of the given size to stage at a time.
+     */
+    public static int getBandRows(int rowBytes) {
+        return Math.max(1, BAND_SIZE / Math.max(1, rowBytes));
+    }
+
+    /**
+     * Copies rows of a buffer backed by an array into the staging buffer,
+     * tightly packed. The offset is in bytes from the start of the buffer.
+     * Returns a direct buffer of the same type, from position 0 to the end
+     * of the copied rows. It is only valid until the next call.
+     */
+    public static Buffer stage(Buffer pixels, int byteOffset,
+                               int rowBytes, int rows, int scanBytes)
+    {
+        int size = rowBytes * rows;
+        if (staging == null || staging.capacity() < size) {
+            staging = BufferUtil.newByteBuffer(Math.max(size, BAND_SIZE));
+        }
+        staging.clear();
+        if (pixels instanceof ByteBuffer src) {
+            byte[] arr = src.array();
+            int off = src.arrayOffset() + byteOffset;
+            for (int i = 0; i < rows; i++) {
+                staging.put(arr, off + i * scanBytes, rowBytes);
+            }
+            return staging.flip();
+        } else if (pixels instanceof IntBuffer src) {
+            IntBuffer dst = staging.asIntBuffer();
+            int[] arr = src.array();
+            int off = src.arrayOffset() + byteOffset / 4;
+            for (int i = 0; i < rows; i++) {
+                dst.put(arr, off + i * (scanBytes / 4), rowBytes / 4);
+            }
+            return dst.flip();
+        } else if (pixels instanceof FloatBuffer src) {
+            FloatBuffer dst = staging.asFloatBuffer();
+            float[] arr = src.array();
+            int off = src.arrayOffset() + byteOffset / 4;
+            for (int i = 0; i < rows; i++) {
+                dst.put(arr, off + i * (scanBytes / 4), rowBytes / 4);
+            }
+            return dst.flip();
+        }
+        throw new IllegalArgumentException("Unsupported buffer " + pixels);
+    }
+}
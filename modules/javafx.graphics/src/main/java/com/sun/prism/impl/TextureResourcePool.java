@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,4 +35,31 @@ import com.sun.prism.PixelFormat;
 public interface TextureResourcePool<T> extends ResourcePool<T> {
     public long estimateTextureSize(int width, int height, PixelFormat format);
     public long estimateRTTextureSize(int width, int height, boolean hasDepth);
+
+    /**
+     * Estimates the size of a texture together with its full chain of
+     * mipmap levels when {@code useMipmap} is true.
+     */
+    public default long estimateTextureSize(int width, int height,
+                                            PixelFormat format, boolean useMipmap)
+    {
+        long size = estimateTextureSize(width, height, format);
+        while (useMipmap && (width > 1 || height > 1)) {
+            width = Math.max(1, width >> 1);
+            height = Math.max(1, height >> 1);
+            size += estimateTextureSize(width, height, format);
+        }
+        return size;
+    }
+
+    /**
+     * Estimates the size of a render target with the indicated number of
+     * samples per pixel. A multisampled render target stores every sample,
+     * a value of 0 means a plain render target texture.
+     */
+    public default long estimateRTTextureSize(int width, int height,
+                                              int samples, boolean hasDepth)
+    {
+        return estimateRTTextureSize(width, height, hasDepth) * Math.max(1, samples);
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -136,6 +136,7 @@ public abstract class BaseShaderContext extends BaseContext {
         TEXTURE_RGB          ("Solid_TextureRGB"),
         TEXTURE_MASK_RGB     ("Mask_TextureRGB"),
         TEXTURE_YV12         ("Solid_TextureYV12"),
+        TEXTURE_YV12_10      ("Solid_TextureYV12P10"),
         TEXTURE_First_LCD    ("Solid_TextureFirstPassLCD"),
         TEXTURE_SECOND_LCD   ("Solid_TextureSecondPassLCD"),
         SUPER                ("Mask_TextureSuper");
@@ -310,10 +311,13 @@ public abstract class BaseShaderContext extends BaseContext {
     }
 
     private Shader getSpecialShader(BaseGraphics g, SpecialShaderType sst) {
+        // We do alpha test if depth test is enabled
+        return getSpecialShader(g.isAlphaTestShader(), sst);
+    }
+
+    private Shader getSpecialShader(boolean alphaTest, SpecialShaderType sst) {
         if (checkDisposed()) return null;
 
-        // We do alpha test if depth test is enabled
-        boolean alphaTest = g.isAlphaTestShader();
         Shader shaders[] = alphaTest ? specialATShaders : specialShaders;
         Shader shader = shaders[sst.ordinal()];
         if (shader != null && !shader.isValid()) {
@@ -330,6 +334,22 @@ public abstract class BaseShaderContext extends BaseContext {
         return shader;
     }
 
+    /**
+     * Creates the shaders for solid color fills of every mask type and for
+     * plain texture rendering, so that the first frames do not stall on
+     * shader compilation. Enabled with the prism.shaderwarmup property.
+     */
+    public void warmUpShaders() {
+        for (MaskType maskType : MaskType.values()) {
+            getPaintShader(false, maskType, Color.WHITE);
+        }
+        getSpecialShader(false, SpecialShaderType.TEXTURE_RGB);
+        getSpecialShader(false, SpecialShaderType.TEXTURE_MASK_RGB);
+        if (factory.isSuperShaderAllowed()) {
+            getSpecialShader(false, SpecialShaderType.SUPER);
+        }
+    }
+
     @Override
     public boolean isSuperShaderEnabled() {
         if (checkDisposed()) return false;
@@ -558,6 +578,17 @@ public abstract class BaseShaderContext extends BaseContext {
             } else {
                 shader = externalShader;
             }
+        } else if (format == PixelFormat.MULTI_YCbCr_420_10) {
+            // no alpha plane, must have exactly three textures
+            if (textures.length < 3) {
+                return null;
+            }
+
+            if (externalShader == null) {
+                shader = getSpecialShader(g, SpecialShaderType.TEXTURE_YV12_10);
+            } else {
+                shader = externalShader;
+            }
         } else { // add more multitexture shaders here
             return null;
         }
@@ -602,6 +633,7 @@ public abstract class BaseShaderContext extends BaseContext {
                 }
                 break;
             case MULTI_YCbCr_420: // Must use multitexture method
+            case MULTI_YCbCr_420_10:
             case BYTE_ALPHA:
             default:
                 throw new InternalError("Pixel format not supported: " + format);
@@ -632,6 +664,7 @@ public abstract class BaseShaderContext extends BaseContext {
                 shader = getSpecialShader(g, SpecialShaderType.TEXTURE_MASK_RGB);
                 break;
             case MULTI_YCbCr_420: // Must use multitexture method
+            case MULTI_YCbCr_420_10:
             case BYTE_ALPHA:
             default:
                 throw new InternalError("Pixel format not supported: " + format);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -259,7 +259,7 @@ public abstract class BaseShaderGraphics
             return;
         }
 
-        if (tex.getPixelFormat() == PixelFormat.MULTI_YCbCr_420) {
+        if (tex.getPixelFormat().isMultiTexture()) {
             Texture lumaTex = textures[PixelFormat.YCBCR_PLANE_LUMA];
             Texture cbTex = textures[PixelFormat.YCBCR_PLANE_CHROMABLUE];
             Texture crTex = textures[PixelFormat.YCBCR_PLANE_CHROMARED];
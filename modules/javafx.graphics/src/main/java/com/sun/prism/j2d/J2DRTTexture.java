@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -61,27 +61,20 @@ class J2DRTTexture extends J2DTexture implements RTTexture {
 
     @Override
     public boolean readPixels(Buffer pixels, int x, int y, int width, int height) {
-        if (x != getContentX() || y != getContentY()
-                || width != getContentWidth() || height != getContentHeight())
+        if (x < getContentX() || y < getContentY() || width <= 0 || height <= 0
+                || x - getContentX() > getContentWidth() - width
+                || y - getContentY() > getContentHeight() - height)
         {
-            throw new IllegalArgumentException("reading subtexture not yet supported!");
+            throw new IllegalArgumentException("region is outside of the content");
         }
-        return readPixels(pixels);
-    }
-
-    @Override
-    public boolean readPixels(Buffer pixels) {
-//        int x = getContentX();
-//        int y = getContentY();
-        int w = getContentWidth();
-        int h = getContentHeight();
+        int scan = getContentWidth();
         int pixbuf[] = getPixels();
         // NOTE: Caller should clear this, not the callee...
         pixels.clear();
 
         // REMIND: This assumes that the caller wants BGRA PRE data...?
-        for (int i = 0; i < w * h; i++) {
-            int argb = pixbuf[i];
+        for (int i = 0; i < width * height; i++) {
+            int argb = pixbuf[(y + i / width) * scan + x + i % width];
             if (pixels instanceof IntBuffer) {
                 ((IntBuffer)pixels).put(argb);
             } else if (pixels instanceof ByteBuffer) {
@@ -99,6 +92,12 @@ class J2DRTTexture extends J2DTexture implements RTTexture {
         return true;
     }
 
+    @Override
+    public boolean readPixels(Buffer pixels) {
+        return readPixels(pixels, getContentX(), getContentY(),
+                          getContentWidth(), getContentHeight());
+    }
+
     @Override
     public Graphics createGraphics() {
         BufferedImage bimg = getBufferedImage();
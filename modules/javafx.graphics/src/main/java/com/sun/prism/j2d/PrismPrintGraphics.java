@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -123,9 +123,35 @@ public final class PrismPrintGraphics
         origTx2D = g2d.getTransform();
     }
 
+    // The part of the page that Java2D is printing now. Printers that band
+    // call the Printable once per band with the clip set to that band, so
+    // everything outside it can be culled instead of rendered and dropped.
+    private Rectangle bandRect;
+
     public PrismPrintGraphics(java.awt.Graphics2D g2d, int width, int height) {
         super(new PagePresentable(width, height), g2d);
-        setClipRect(new Rectangle(0,0,width,height));
+        Rectangle band = new Rectangle(0, 0, width, height);
+        java.awt.Rectangle clip = g2d.getClipBounds();
+        if (clip != null) {
+            band.intersectWith(new Rectangle(clip.x, clip.y,
+                                             clip.width, clip.height));
+        }
+        devClipRect.intersectWith(band);
+        bandRect = band;
+        setClipRect(band);
+    }
+
+    @Override
+    public void setClipRect(Rectangle clipRect) {
+        if (bandRect != null) {
+            if (clipRect == null) {
+                clipRect = bandRect;
+            } else {
+                clipRect = new Rectangle(clipRect);
+                clipRect.intersectWith(bandRect);
+            }
+        }
+        super.setClipRect(clipRect);
     }
 
     PrismPrintGraphics(J2DPresentable target, java.awt.Graphics2D g2d) {
@@ -43,6 +43,7 @@ import com.sun.javafx.geom.transform.Affine2D;
 import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.javafx.geom.transform.GeneralTransform3D;
 import com.sun.javafx.geom.transform.NoninvertibleTransformException;
+import com.sun.javafx.logging.PulseLogger;
 import com.sun.javafx.scene.text.GlyphList;
 import com.sun.javafx.sg.prism.NGCamera;
 import com.sun.javafx.sg.prism.NGLightBase;
@@ -563,7 +564,9 @@ final class SWGraphics implements ReadbackGraphics {
             System.out.println("Clip: " + finalClip);
             System.out.println("Composite rule: " + compositeMode);
         }
+        long start = PulseLogger.nativeStart(PulseLogger.NATIVE_RENDERING);
         context.renderShape(this.pr, shape, st, tr, this.finalClip, isAntialiasedShape());
+        PulseLogger.nativeEnd(PulseLogger.NATIVE_RENDERING, "Pisces shape", start, 0L);
     }
 
     private void paintRoundRect(float x, float y, float width, float height, float arcw, float arch, BasicStroke st) {
@@ -800,6 +803,7 @@ final class SWGraphics implements ReadbackGraphics {
         final int txMax = Math.min(tex.getContentWidth() - 1, SWUtils.fastCeil(Math.max(sx1, sx2)) - 1);
         final int tyMax = Math.min(tex.getContentHeight() - 1, SWUtils.fastCeil(Math.max(sy1, sy2)) - 1);
 
+        long start = PulseLogger.nativeStart(PulseLogger.NATIVE_RENDERING);
         this.pr.drawImage(RendererBase.TYPE_INT_ARGB_PRE, imageMode,
                 data, tex.getContentWidth(), tex.getContentHeight(),
                 swTex.getOffset(), tex.getPhysicalWidth(),
@@ -811,6 +815,7 @@ final class SWGraphics implements ReadbackGraphics {
                 lEdge, rEdge, tEdge, bEdge,
                 txMin, tyMin, txMax, tyMax,
                 swTex.hasAlpha());
+        PulseLogger.nativeEnd(PulseLogger.NATIVE_RENDERING, "Pisces image", start, 0L);
 
         if (PrismSettings.debug) {
             System.out.println("* drawTexture, DONE");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,8 +27,10 @@ package com.sun.prism.sw;
 
 import com.sun.glass.ui.Screen;
 import com.sun.glass.utils.NativeLibLoader;
+import com.sun.pisces.PiscesRenderer;
 import com.sun.prism.GraphicsPipeline;
 import com.sun.prism.ResourceFactory;
+import com.sun.prism.impl.PrismSettings;
 
 import java.security.AccessController;
 import java.security.PrivilegedAction;
@@ -39,10 +41,19 @@ public final class SWPipeline extends GraphicsPipeline {
 
     static {
         @SuppressWarnings("removal")
-        var dummy = AccessController.doPrivileged((PrivilegedAction<Object>) () -> {
+        String blitters = AccessController.doPrivileged((PrivilegedAction<String>) () -> {
             NativeLibLoader.loadLibrary("prism_sw");
-            return null;
+            return System.getProperty("prism.sw.simd");
         });
+        // The best SIMD blitters the processor supports, unless limited
+        blitters = PiscesRenderer.selectBlitters(blitters);
+        int threads = PiscesRenderer.setThreads(PrismSettings.swThreads);
+        if (PrismSettings.verbose) {
+            System.out.println("Pisces blitters: " + blitters);
+            if (threads > 1) {
+                System.out.println("Pisces rendering threads: " + threads);
+            }
+        }
     }
 
     @Override public boolean init() {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,7 @@ final class SWPresentable extends SWRTTexture implements Presentable {
 
     private final PresentableState pState;
     private Pixels pixels;
+    private Rectangle dirty;
     private QueuedPixelSource pixelSource = new QueuedPixelSource(false);
 
     public SWPresentable(PresentableState pState, SWResourceFactory factory) {
@@ -55,10 +56,17 @@ final class SWPresentable extends SWRTTexture implements Presentable {
             /*
              * RT-27374
              * TODO: make sure the imgrep matches the Pixels.getNativeFormat()
-             * TODO: dirty region support
              */
             int w = getPhysicalWidth();
             int h = getPhysicalHeight();
+            // The pixels buffers take turns, so each one still gets the whole
+            // frame. Only the window update is limited to the dirty region.
+            if (dirtyregion != null) {
+                dirty = new Rectangle(dirtyregion);
+                dirty.intersectWith(new Rectangle(w, h));
+            } else {
+                dirty = null;
+            }
             pixels = pixelSource.getUnusedPixels(w, h, 1.0f, 1.0f);
             IntBuffer pixBuf = (IntBuffer) pixels.getPixels();
             IntBuffer buf = getSurface().getDataIntBuffer();
@@ -72,7 +80,7 @@ final class SWPresentable extends SWRTTexture implements Presentable {
 
     @Override
     public boolean present() {
-        pixelSource.enqueuePixels(pixels);
+        pixelSource.enqueuePixels(pixels, dirty);
         pState.uploadPixels(pixelSource);
         return true;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -67,33 +67,25 @@ class SWRTTexture extends SWArgbPreTexture implements RTTexture {
 
     @Override
     public boolean readPixels(Buffer pixels, int x, int y, int width, int height) {
-        if (x != getContentX() || y != getContentY()
-                || width != getContentWidth() || height != getContentHeight())
+        if (x < getContentX() || y < getContentY() || width <= 0 || height <= 0
+                || x - getContentX() > getContentWidth() - width
+                || y - getContentY() > getContentHeight() - height)
         {
-            throw new IllegalArgumentException("reading subtexture not yet supported!");
+            throw new IllegalArgumentException("region is outside of the content");
         }
-        return readPixels(pixels);
-    }
-
-    @Override
-    public boolean readPixels(Buffer pixels) {
-        if (PrismSettings.debug) {
-            System.out.println("+ SWRTT.readPixels: this: " + this);
-        }
-
         final int pixbuf[] = getDataNoClone();
         pixels.clear();
         // REMIND: This assumes that the caller wants BGRA PRE data...?
         if (pixels instanceof IntBuffer) {
             final IntBuffer iPixels = (IntBuffer)pixels;
-            for (int i = 0; i < contentHeight; i++) {
-                iPixels.put(pixbuf, i*physicalWidth, contentWidth);
+            for (int i = 0; i < height; i++) {
+                iPixels.put(pixbuf, (y + i)*physicalWidth + x, width);
             }
         } else if (pixels instanceof ByteBuffer) {
             final ByteBuffer bPixels = (ByteBuffer)pixels;
-            for (int i = 0; i < contentHeight; i++) {
-                for (int j = 0; j < contentWidth; j++) {
-                    final int argb = pixbuf[i*physicalWidth + j];
+            for (int i = 0; i < height; i++) {
+                for (int j = 0; j < width; j++) {
+                    final int argb = pixbuf[(y + i)*physicalWidth + x + j];
                     final byte a = (byte) (argb >> 24);
                     final byte r = (byte) (argb >> 16);
                     final byte g = (byte) (argb >>  8);
@@ -108,6 +100,15 @@ class SWRTTexture extends SWArgbPreTexture implements RTTexture {
         return true;
     }
 
+    @Override
+    public boolean readPixels(Buffer pixels) {
+        if (PrismSettings.debug) {
+            System.out.println("+ SWRTT.readPixels: this: " + this);
+        }
+        return readPixels(pixels, getContentX(), getContentY(),
+                          contentWidth, contentHeight);
+    }
+
     @Override
     public Screen getAssociatedScreen() {
         return getResourceFactory().getScreen();
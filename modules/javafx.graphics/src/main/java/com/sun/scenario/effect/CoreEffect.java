@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 
 package com.sun.scenario.effect;
 
+import com.sun.javafx.logging.PulseLogger;
 import com.sun.scenario.effect.impl.EffectPeer;
 import com.sun.scenario.effect.impl.Renderer;
 import com.sun.javafx.geom.Rectangle;
@@ -103,7 +104,10 @@ abstract class CoreEffect<T extends RenderState> extends FilterEffect<T> {
                                       T rstate,
                                       ImageData... inputs)
     {
-        return getPeer(fctx, inputs).filter(this, rstate, transform, outputClip, inputs);
+        long start = PulseLogger.nativeStart(PulseLogger.NATIVE_RENDERING);
+        ImageData res = getPeer(fctx, inputs).filter(this, rstate, transform, outputClip, inputs);
+        PulseLogger.nativeEnd(PulseLogger.NATIVE_RENDERING, "Decora filter", start, 0L);
+        return res;
     }
 
     @Override
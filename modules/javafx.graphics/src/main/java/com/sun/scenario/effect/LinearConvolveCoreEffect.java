@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 package com.sun.scenario.effect;
 
 import com.sun.javafx.geom.Rectangle;
+import com.sun.javafx.logging.PulseLogger;
 import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.scenario.effect.impl.EffectPeer;
 import com.sun.scenario.effect.impl.Renderer;
@@ -82,7 +83,9 @@ public abstract class LinearConvolveCoreEffect
             EffectPeer peer = lcrstate.getPassPeer(r, fctx);
             if (peer != null) {
                 peer.setPass(pass);
+                long start = PulseLogger.nativeStart(PulseLogger.NATIVE_RENDERING);
                 ImageData res = peer.filter(this, lcrstate, transform, filterClip, src);
+                PulseLogger.nativeEnd(PulseLogger.NATIVE_RENDERING, "Decora filter", start, 0L);
                 src.unref();
                 src = res;
                 if (!src.validate(fctx)) {
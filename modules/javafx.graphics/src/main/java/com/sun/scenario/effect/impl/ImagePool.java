@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@ import java.security.PrivilegedAction;
 import java.util.ArrayList;
 import java.util.Iterator;
 import java.util.List;
+import com.sun.javafx.logging.PulseLogger;
 import com.sun.scenario.effect.Filterable;
 
 /**
@@ -77,6 +78,22 @@ public class ImagePool {
 
     static final int QUANT = 32;
 
+    /**
+     * Rounds an image dimension up to the size class it is allocated in.
+     * Small images use multiples of {@code QUANT}, larger ones multiples of
+     * an eighth of the next power of two (64 pixels up to 512, 128 up to
+     * 1024 and so on). A node whose bounds change a little every frame
+     * thus keeps getting the same image back, while no more than about a
+     * quarter of each dimension is wasted.
+     */
+    static int quantize(int dim) {
+        int quant = QUANT;
+        if (dim > QUANT * 8) {
+            quant = Integer.highestOneBit(dim - 1) >> 2;
+        }
+        return ((dim + quant - 1) / quant) * quant;
+    }
+
     private final List<SoftReference<PoolFilterable>> unlocked =
         new ArrayList<>();
     private final List<SoftReference<PoolFilterable>> locked =
@@ -112,9 +129,9 @@ public class ImagePool {
             // if image is empty in any way, return a small non-empty image.
             w = h = 1;
         }
-        // Allocate images rounded up to the nearest quantum size threshold.
-        w = ((w + QUANT - 1) / QUANT) * QUANT;
-        h = ((h + QUANT - 1) / QUANT) * QUANT;
+        // Allocate images rounded up to their size class.
+        w = quantize(w);
+        h = quantize(h);
 
         // Adjust allocation sizes for platform requirements (pow2 etc.)
         w = renderer.getCompatibleWidth(w);
@@ -196,6 +213,9 @@ public class ImagePool {
             locked.add(new SoftReference<>(img));
             numCreated++;
             pixelsCreated += ((long) w) * h;
+            if (PulseLogger.PULSE_LOGGING_ENABLED) {
+                PulseLogger.incrementCounter("Effect images created");
+            }
         }
         return img;
     }
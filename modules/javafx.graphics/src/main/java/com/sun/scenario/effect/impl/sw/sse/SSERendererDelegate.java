@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@ package com.sun.scenario.effect.impl.sw.sse;
 import java.security.AccessController;
 import java.security.PrivilegedAction;
 import com.sun.glass.utils.NativeLibLoader;
+import com.sun.prism.impl.PrismSettings;
 import com.sun.scenario.effect.Effect.AccelType;
 import com.sun.scenario.effect.impl.Renderer;
 import com.sun.scenario.effect.impl.sw.RendererDelegate;
@@ -36,12 +37,54 @@ public class SSERendererDelegate implements RendererDelegate {
 
     public static native boolean isSupported();
 
+    /*
+     * Names of the native kernel sets, indexed by level. The
+     * "decora.simd.kernels" property limits the selection to the given
+     * set, by default the best one the processor supports is used.
+     */
+    private static final String[] KERNEL_NAMES = { "scalar", "sse4.1", "avx2", "neon" };
+
+    private static final String kernels;
+
+    /*
+     * Number of threads the native peers split large images across, see
+     * the "prism.decora.threads" property.
+     */
+    private static final int threads;
+
     static {
         @SuppressWarnings("removal")
-        var dummy = AccessController.doPrivileged((PrivilegedAction) () -> {
+        String requested = AccessController.doPrivileged((PrivilegedAction<String>) () -> {
             NativeLibLoader.loadLibrary("decora_sse");
-            return null;
+            return System.getProperty("decora.simd.kernels");
         });
+        int maxLevel = -1;
+        for (int i = 0; i < KERNEL_NAMES.length; i++) {
+            if (KERNEL_NAMES[i].equals(requested)) {
+                maxLevel = i;
+            }
+        }
+        int level = selectKernels(maxLevel);
+        kernels = (level >= 0 && level < KERNEL_NAMES.length) ? KERNEL_NAMES[level] : "scalar";
+        threads = setThreads(PrismSettings.decoraThreads);
+    }
+
+    private static native int selectKernels(int maxLevel);
+
+    private static native int setThreads(int threads);
+
+    /**
+     * Returns the name of the native kernel set in use.
+     */
+    public static String getKernels() {
+        return kernels;
+    }
+
+    /**
+     * Returns the number of threads used to filter large images.
+     */
+    public static int getThreads() {
+        return threads;
     }
 
     public SSERendererDelegate() {
@@ -2597,6 +2597,10 @@ public class Scene implements EventTarget {
             }
             Scene.this.doCSSPass();
 
+            // lay out the text queued while updating the scene and CSS on
+            // the text layout threads, for the layout pass to pick up
+            Toolkit.getToolkit().getTextLayoutFactory().prepareLayouts();
+
             if (PULSE_LOGGING_ENABLED) {
                 PulseLogger.newPhase("Layout Pass");
             }
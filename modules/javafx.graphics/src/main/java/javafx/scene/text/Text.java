@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -259,6 +259,8 @@ public class Text extends Shape {
             String string = getTextInternal();
             Object font = getFontInternal();
             layout.setContent(string, font);
+            /* Lay the new content out ahead of the layout pass */
+            Toolkit.getToolkit().getTextLayoutFactory().prepareLayout(string, font);
         }
         needsTextLayout();
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -143,8 +143,12 @@ module javafx.graphics {
         javafx.web;
     exports com.sun.prism.image to
         javafx.web;
+    exports com.sun.prism.impl.packrect to
+        javafx.web;
     exports com.sun.prism.paint to
         javafx.web;
+    exports com.sun.prism.shape to
+        javafx.web;
     exports com.sun.scenario.effect to
         javafx.web;
     exports com.sun.scenario.effect.impl to
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -80,7 +80,7 @@ import static java.nio.charset.StandardCharsets.UTF_8;
  *     LinearGradient (3 cycle method variants)
  *     RadialGradient (3 cycle method variants)
  *     ImagePattern
- *     Texture{RGB,YV12,etc}
+ *     Texture{RGB,YV12,YV12P10,etc}
  */
 public class CompileJSL {
 
@@ -501,6 +501,7 @@ public class CompileJSL {
             compileMaskTexture(jslcinfo, "RGB", alphaTest);
             compileMaskTexture(jslcinfo, "Super", alphaTest);
             compileSolidTexture(jslcinfo, "YV12", alphaTest);
+            compileSolidTexture(jslcinfo, "YV12P10", alphaTest);
             compileSolidTexture(jslcinfo, "FirstPassLCD", alphaTest);
             compileLCDShader(jslcinfo, "SecondPassLCD", alphaTest);
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@
 
 #include <jni.h>
 #include "SSEUtils.h"
+#include "SSEParallel.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer.h"
 
 JNIEXPORT void JNICALL
@@ -53,38 +54,8 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterHorizontal
         return;
     }
 
-    jint hsize = dstw - srcw + 1;
-    jint kscale = 0x7fffffff / (hsize * 255);
-    jint srcoff = 0;
-    jint dstoff = 0;
-    for (jint y = 0; y < dsth; y++) {
-        jint suma = 0;
-        jint sumr = 0;
-        jint sumg = 0;
-        jint sumb = 0;
-        for (jint x = 0; x < dstw; x++) {
-            jint rgb;
-            // Un-accumulate the data for col-hsize location into the sums.
-            rgb = (x >= hsize) ? srcPixels[srcoff + x - hsize] : 0;
-            suma -= (rgb >> 24) & 0xff;
-            sumr -= (rgb >> 16) & 0xff;
-            sumg -= (rgb >>  8) & 0xff;
-            sumb -= (rgb      ) & 0xff;
-            // Accumulate the data for this col location into the sums.
-            rgb = (x < srcw) ? srcPixels[srcoff + x] : 0;
-            suma += (rgb >> 24) & 0xff;
-            sumr += (rgb >> 16) & 0xff;
-            sumg += (rgb >>  8) & 0xff;
-            sumb += (rgb      ) & 0xff;
-            dstPixels[dstoff + x] =
-                (((suma * kscale) >> 23) << 24) +
-                (((sumr * kscale) >> 23) << 16) +
-                (((sumg * kscale) >> 23) <<  8) +
-                (((sumb * kscale) >> 23)      );
-        }
-        srcoff += srcscan;
-        dstoff += dstscan;
-    }
+    parallelBoxBlurHorizontal(dstPixels, dstw, dsth, dstscan,
+                              srcPixels, srcw, srch, srcscan);
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
@@ -111,39 +82,8 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterVertical
         return;
     }
 
-    jint vsize = dsth - srch + 1;
-    jint kscale = 0x7fffffff / (vsize * 255);
-    jint voff = vsize * srcscan;
-    for (jint x = 0; x < dstw; x++) {
-        jint suma = 0;
-        jint sumr = 0;
-        jint sumg = 0;
-        jint sumb = 0;
-        jint srcoff = x;
-        jint dstoff = x;
-        for (jint y = 0; y < dsth; y++) {
-            jint rgb;
-            // Un-accumulate the data for row-vsize location into the sums.
-            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
-            suma -= (rgb >> 24) & 0xff;
-            sumr -= (rgb >> 16) & 0xff;
-            sumg -= (rgb >>  8) & 0xff;
-            sumb -= (rgb      ) & 0xff;
-            // Accumulate the data for this col location into the sums.
-            rgb = (y < srch) ? srcPixels[srcoff] : 0;
-            suma += (rgb >> 24) & 0xff;
-            sumr += (rgb >> 16) & 0xff;
-            sumg += (rgb >>  8) & 0xff;
-            sumb += (rgb      ) & 0xff;
-            dstPixels[dstoff] =
-                (((suma * kscale) >> 23) << 24) +
-                (((sumr * kscale) >> 23) << 16) +
-                (((sumg * kscale) >> 23) <<  8) +
-                (((sumb * kscale) >> 23)      );
-            srcoff += srcscan;
-            dstoff += dstscan;
-        }
-    }
+    parallelBoxBlurVertical(dstPixels, dstw, dsth, dstscan,
+                            srcPixels, srcw, srch, srcscan);
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
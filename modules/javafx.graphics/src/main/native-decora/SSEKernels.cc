@@ -0,0 +1,1381 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "SSEKernels.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define DECORA_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DECORA_NEON 1
+#include <arm_neon.h>
+#endif
+
+/*
+ * The library is built for the baseline instruction set, the SIMD
+ * variants are compiled for their own targets and only called after the
+ * processor was checked for them.
+ */
+#if defined(DECORA_X86) && (defined(__GNUC__) || defined(__clang__))
+#define DECORA_TARGET(isa) __attribute__((target(isa)))
+#else
+#define DECORA_TARGET(isa)
+#endif
+
+#define cmin 1.0f
+#define cmax (255.0f - 1.0f/32.0f)
+
+/*
+ * Scalar kernels, also used for the rows or columns left over by the
+ * SIMD variants. The horizontal passes take a range of rows, the
+ * vertical passes a range of columns.
+ */
+
+static void boxBlurHorizontalScalar(jint *dstPixels, jint dstw, jint dstscan,
+                                    jint *srcPixels, jint srcw, jint srcscan,
+                                    jint y0, jint y1)
+{
+    jint hsize = dstw - srcw + 1;
+    jint kscale = 0x7fffffff / (hsize * 255);
+    jint srcoff = y0 * srcscan;
+    jint dstoff = y0 * dstscan;
+    for (jint y = y0; y < y1; y++) {
+        jint suma = 0;
+        jint sumr = 0;
+        jint sumg = 0;
+        jint sumb = 0;
+        for (jint x = 0; x < dstw; x++) {
+            jint rgb;
+            // Un-accumulate the data for col-hsize location into the sums.
+            rgb = (x >= hsize) ? srcPixels[srcoff + x - hsize] : 0;
+            suma -= (rgb >> 24) & 0xff;
+            sumr -= (rgb >> 16) & 0xff;
+            sumg -= (rgb >>  8) & 0xff;
+            sumb -= (rgb      ) & 0xff;
+            // Accumulate the data for this col location into the sums.
+            rgb = (x < srcw) ? srcPixels[srcoff + x] : 0;
+            suma += (rgb >> 24) & 0xff;
+            sumr += (rgb >> 16) & 0xff;
+            sumg += (rgb >>  8) & 0xff;
+            sumb += (rgb      ) & 0xff;
+            dstPixels[dstoff + x] =
+                (((suma * kscale) >> 23) << 24) +
+                (((sumr * kscale) >> 23) << 16) +
+                (((sumg * kscale) >> 23) <<  8) +
+                (((sumb * kscale) >> 23)      );
+        }
+        srcoff += srcscan;
+        dstoff += dstscan;
+    }
+}
+
+static void boxBlurVerticalScalar(jint *dstPixels, jint dsth, jint dstscan,
+                                  jint *srcPixels, jint srch, jint srcscan,
+                                  jint x0, jint x1)
+{
+    jint vsize = dsth - srch + 1;
+    jint kscale = 0x7fffffff / (vsize * 255);
+    jint voff = vsize * srcscan;
+    for (jint x = x0; x < x1; x++) {
+        jint suma = 0;
+        jint sumr = 0;
+        jint sumg = 0;
+        jint sumb = 0;
+        jint srcoff = x;
+        jint dstoff = x;
+        for (jint y = 0; y < dsth; y++) {
+            jint rgb;
+            // Un-accumulate the data for row-vsize location into the sums.
+            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
+            suma -= (rgb >> 24) & 0xff;
+            sumr -= (rgb >> 16) & 0xff;
+            sumg -= (rgb >>  8) & 0xff;
+            sumb -= (rgb      ) & 0xff;
+            // Accumulate the data for this col location into the sums.
+            rgb = (y < srch) ? srcPixels[srcoff] : 0;
+            suma += (rgb >> 24) & 0xff;
+            sumr += (rgb >> 16) & 0xff;
+            sumg += (rgb >>  8) & 0xff;
+            sumb += (rgb      ) & 0xff;
+            dstPixels[dstoff] =
+                (((suma * kscale) >> 23) << 24) +
+                (((sumr * kscale) >> 23) << 16) +
+                (((sumg * kscale) >> 23) <<  8) +
+                (((sumb * kscale) >> 23)      );
+            srcoff += srcscan;
+            dstoff += dstscan;
+        }
+    }
+}
+
+/*
+ * Parameters of the box shadow passes, amax goes from size*255 to 255
+ * as spread goes from 0 to 1.
+ */
+typedef struct {
+    jint amax;
+    jint amin;
+    jint kscalea;
+    jint kscaler;
+    jint kscaleg;
+    jint kscaleb;
+    jint shadowRGB;
+} BoxShadowParams;
+
+static BoxShadowParams boxShadowParams(jint size, jfloat spread, jfloat *shadowColor)
+{
+    BoxShadowParams p;
+    p.amax = size * 255;
+    p.amax += (jint) ((255 - p.amax) * spread);
+    p.kscalea = 0x7fffffff / p.amax;
+    p.amin = (p.amax / 255);
+    if (shadowColor != NULL) {
+        p.kscaler = (jint) (p.kscalea * shadowColor[0]);
+        p.kscaleg = (jint) (p.kscalea * shadowColor[1]);
+        p.kscaleb = (jint) (p.kscalea * shadowColor[2]);
+        p.kscalea = (jint) (p.kscalea * shadowColor[3]);
+        p.shadowRGB =
+            (((jint) (shadowColor[0] * 255)) << 16) |
+            (((jint) (shadowColor[1] * 255)) <<  8) |
+            (((jint) (shadowColor[2] * 255))      ) |
+            (((jint) (shadowColor[3] * 255)) << 24);
+    } else {
+        p.kscaler = p.kscaleg = p.kscaleb = 0;
+        p.shadowRGB = 0xff000000;
+    }
+    return p;
+}
+
+static inline jint boxShadowBlackPixel(jint suma, const BoxShadowParams &p)
+{
+    // Clamp, scale and convert the sum into a color.
+    return ((suma < p.amin) ? 0
+            : ((suma >= p.amax) ? 0xff000000
+               : (((suma * p.kscalea) >> 23) << 24)));
+}
+
+static inline jint boxShadowPixel(jint suma, const BoxShadowParams &p)
+{
+    // Clamp, scale and convert the sum into a color.
+    return ((suma < p.amin) ? 0
+            : ((suma >= p.amax) ? p.shadowRGB
+               : ((((suma * p.kscalea) >> 23) << 24) |
+                  (((suma * p.kscaler) >> 23) << 16) |
+                  (((suma * p.kscaleg) >> 23) <<  8) |
+                  (((suma * p.kscaleb) >> 23)      ))));
+}
+
+static void boxShadowHorizontalBlackScalar(jint *dstPixels, jint dstw, jint dstscan,
+                                           jint *srcPixels, jint srcw, jint srcscan,
+                                           const BoxShadowParams &p,
+                                           jint y0, jint y1)
+{
+    jint hsize = dstw - srcw + 1;
+    jint srcoff = y0 * srcscan;
+    jint dstoff = y0 * dstscan;
+    for (jint y = y0; y < y1; y++) {
+        jint suma = 0;
+        for (jint x = 0; x < dstw; x++) {
+            jint rgb;
+            // Un-accumulate the data for col-hsize location into the sums.
+            rgb = (x >= hsize) ? srcPixels[srcoff + x - hsize] : 0;
+            suma -= (rgb >> 24) & 0xff;
+            // Accumulate the data for this col location into the sums.
+            rgb = (x < srcw) ? srcPixels[srcoff + x] : 0;
+            suma += (rgb >> 24) & 0xff;
+            dstPixels[dstoff + x] = boxShadowBlackPixel(suma, p);
+        }
+        srcoff += srcscan;
+        dstoff += dstscan;
+    }
+}
+
+static void boxShadowVerticalScalar(jint *dstPixels, jint dsth, jint dstscan,
+                                    jint *srcPixels, jint srch, jint srcscan,
+                                    const BoxShadowParams &p, bool black,
+                                    jint x0, jint x1)
+{
+    jint vsize = dsth - srch + 1;
+    jint voff = vsize * srcscan;
+    for (jint x = x0; x < x1; x++) {
+        jint suma = 0;
+        jint srcoff = x;
+        jint dstoff = x;
+        for (jint y = 0; y < dsth; y++) {
+            jint rgb;
+            // Un-accumulate the data for row-vsize location into the sums.
+            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
+            suma -= (rgb >> 24) & 0xff;
+            // Accumulate the data for this row location into the sums.
+            rgb = (y < srch) ? srcPixels[srcoff] : 0;
+            suma += (rgb >> 24) & 0xff;
+            dstPixels[dstoff] = black
+                ? boxShadowBlackPixel(suma, p)
+                : boxShadowPixel(suma, p);
+            srcoff += srcscan;
+            dstoff += dstscan;
+        }
+    }
+}
+
+static void convolveHVScalar(jint *dstPixels, jint dstcols, jint dcolinc, jint drowinc,
+                             jint *srcPixels, jint srccols, jint scolinc, jint srowinc,
+                             jfloat *kvals, jint kernelSize,
+                             jint r0, jint r1)
+{
+    // cvals stores the component values from the surrounding K pixels
+    // from x-r to x+r
+    jfloat cvals[128*4];
+    jint dstrow = r0 * drowinc;
+    jint srcrow = r0 * srowinc;
+    for (jint r = r0; r < r1; r++) {
+        jint dstoff = dstrow;
+        jint srcoff = srcrow;
+        // Must clear out the array at the start of every line
+        for (jint i = 0; i < kernelSize*4; i++) {
+            cvals[i] = 0.0f;
+        }
+        jint koff = kernelSize;
+        for (jint c = 0; c < dstcols; c++) {
+            // Load the data for this x location into the array.
+            jint i = (kernelSize - koff) * 4;
+            jint rgb = (c < srccols) ? srcPixels[srcoff] : 0;
+            cvals[i+0] = (jfloat) ((rgb >> 24) & 0xff);
+            cvals[i+1] = (jfloat) ((rgb >> 16) & 0xff);
+            cvals[i+2] = (jfloat) ((rgb >>  8) & 0xff);
+            cvals[i+3] = (jfloat) ((rgb      ) & 0xff);
+            // Bump the koff to the next spot to align the coefficients.
+            if (--koff <= 0) {
+                koff += kernelSize;
+            }
+            jfloat suma = 0.0f;
+            jfloat sumr = 0.0f;
+            jfloat sumg = 0.0f;
+            jfloat sumb = 0.0f;
+            for (i = 0; i < kernelSize*4; i += 4) {
+                jfloat factor = kvals[koff + (i>>2)];
+                suma += cvals[i+0] * factor;
+                sumr += cvals[i+1] * factor;
+                sumg += cvals[i+2] * factor;
+                sumb += cvals[i+3] * factor;
+            }
+            dstPixels[dstoff] =
+                (((suma < cmin) ? 0 : ((suma > cmax) ? 255 : ((jint) suma))) << 24) +
+                (((sumr < cmin) ? 0 : ((sumr > cmax) ? 255 : ((jint) sumr))) << 16) +
+                (((sumg < cmin) ? 0 : ((sumg > cmax) ? 255 : ((jint) sumg))) <<  8) +
+                (((sumb < cmin) ? 0 : ((sumb > cmax) ? 255 : ((jint) sumb)))      );
+            dstoff += dcolinc;
+            srcoff += scolinc;
+        }
+        dstrow += drowinc;
+        srcrow += srowinc;
+    }
+}
+
+static inline jint convolveShadowIndex(jfloat sum)
+{
+    // shadowRGBs[0] is transparent
+    return (sum < 0.0f) ? 0 : ((sum >= 254.0f) ? 255 : ((jint) sum) + 1);
+}
+
+static void convolveShadowHVScalar(jint *dstPixels, jint dstcols, jint dcolinc, jint drowinc,
+                                   jint *srcPixels, jint srccols, jint scolinc, jint srowinc,
+                                   jfloat *kvals, jint kernelSize, jint *shadowRGBs,
+                                   jint r0, jint r1)
+{
+    // avals stores the alpha values from the surrounding K pixels
+    // from x-r to x+r
+    jfloat avals[128];
+    jint dstrow = r0 * drowinc;
+    jint srcrow = r0 * srowinc;
+    for (jint r = r0; r < r1; r++) {
+        jint dstoff = dstrow;
+        jint srcoff = srcrow;
+        // Must clear out the array at the start of every line
+        for (jint i = 0; i < kernelSize; i++) {
+            avals[i] = 0.0f;
+        }
+        jint koff = kernelSize;
+        for (jint c = 0; c < dstcols; c++) {
+            // Load the data for this x location into the array.
+            jint rgb = (c < srccols) ? srcPixels[srcoff] : 0;
+            avals[kernelSize - koff] = (jfloat) ((rgb >> 24) & 0xff);
+            // Bump the koff to the next spot to align the coefficients.
+            if (--koff <= 0) {
+                koff += kernelSize;
+            }
+            jfloat sum = -0.5f;
+            for (jint i = 0; i < kernelSize; i++) {
+                sum += avals[i] * kvals[koff + i];
+            }
+            dstPixels[dstoff] = shadowRGBs[convolveShadowIndex(sum)];
+            dstoff += dcolinc;
+            srcoff += scolinc;
+        }
+        dstrow += drowinc;
+        srcrow += srowinc;
+    }
+}
+
+/*
+ * Full image entry points of the scalar kernels.
+ */
+
+static void boxBlurHorizontalScalarKernel(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                          jint *srcPixels, jint srcw, jint srch, jint srcscan)
+{
+    boxBlurHorizontalScalar(dstPixels, dstw, dstscan, srcPixels, srcw, srcscan, 0, dsth);
+}
+
+static void boxBlurVerticalScalarKernel(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                        jint *srcPixels, jint srcw, jint srch, jint srcscan)
+{
+    boxBlurVerticalScalar(dstPixels, dsth, dstscan, srcPixels, srch, srcscan, 0, dstw);
+}
+
+static void boxShadowHorizontalBlackScalarKernel(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                                 jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                                 jfloat spread)
+{
+    BoxShadowParams p = boxShadowParams(dstw - srcw + 1, spread, NULL);
+    boxShadowHorizontalBlackScalar(dstPixels, dstw, dstscan, srcPixels, srcw, srcscan, p, 0, dsth);
+}
+
+static void boxShadowVerticalBlackScalarKernel(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                               jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                               jfloat spread)
+{
+    BoxShadowParams p = boxShadowParams(dsth - srch + 1, spread, NULL);
+    boxShadowVerticalScalar(dstPixels, dsth, dstscan, srcPixels, srch, srcscan, p, true, 0, dstw);
+}
+
+static void boxShadowVerticalScalarKernel(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                          jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                          jfloat spread, jfloat *shadowColor)
+{
+    BoxShadowParams p = boxShadowParams(dsth - srch + 1, spread, shadowColor);
+    boxShadowVerticalScalar(dstPixels, dsth, dstscan, srcPixels, srch, srcscan, p, false, 0, dstw);
+}
+
+static void convolveHVScalarKernel(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                                   jint *srcPixels, jint srccols, jint srcrows, jint scolinc, jint srowinc,
+                                   jfloat *kvals, jint kernelSize)
+{
+    convolveHVScalar(dstPixels, dstcols, dcolinc, drowinc,
+                     srcPixels, srccols, scolinc, srowinc,
+                     kvals, kernelSize, 0, dstrows);
+}
+
+static void convolveShadowHVScalarKernel(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                                         jint *srcPixels, jint srccols, jint srcrows, jint scolinc, jint srowinc,
+                                         jfloat *kvals, jint kernelSize, jint *shadowRGBs)
+{
+    convolveShadowHVScalar(dstPixels, dstcols, dcolinc, drowinc,
+                           srcPixels, srccols, scolinc, srowinc,
+                           kvals, kernelSize, shadowRGBs, 0, dstrows);
+}
+
+static const DecoraKernels scalarKernels = {
+    DECORA_KERNELS_SCALAR, "scalar",
+    boxBlurHorizontalScalarKernel,
+    boxBlurVerticalScalarKernel,
+    boxShadowHorizontalBlackScalarKernel,
+    boxShadowVerticalBlackScalarKernel,
+    boxShadowVerticalScalarKernel,
+    convolveHVScalarKernel,
+    convolveShadowHVScalarKernel,
+};
+
+#ifdef DECORA_X86
+
+/*
+ * SSE4.1 kernels. A pixel is unpacked into one 32-bit lane per component
+ * in memory order (b, g, r, a), so packing the lanes back with unsigned
+ * saturation restores the ARGB int. The vertical passes keep the running
+ * sums of all columns and walk the images row by row.
+ */
+
+DECORA_TARGET("sse4.1")
+static inline __m128i unpackPixelSSE41(jint rgb)
+{
+    return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(rgb));
+}
+
+DECORA_TARGET("sse4.1")
+static inline jint packPixelSSE41(__m128i v)
+{
+    v = _mm_packus_epi32(v, v);
+    v = _mm_packus_epi16(v, v);
+    return _mm_cvtsi128_si32(v);
+}
+
+DECORA_TARGET("sse4.1")
+static void boxBlurHorizontalSSE41(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                   jint *srcPixels, jint srcw, jint srch, jint srcscan)
+{
+    jint hsize = dstw - srcw + 1;
+    __m128i kscale = _mm_set1_epi32(0x7fffffff / (hsize * 255));
+    for (jint y = 0; y < dsth; y++) {
+        jint *src = srcPixels + y * srcscan;
+        jint *dst = dstPixels + y * dstscan;
+        __m128i sum = _mm_setzero_si128();
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                sum = _mm_sub_epi32(sum, unpackPixelSSE41(src[x - hsize]));
+            }
+            if (x < srcw) {
+                sum = _mm_add_epi32(sum, unpackPixelSSE41(src[x]));
+            }
+            dst[x] = packPixelSSE41(_mm_srli_epi32(_mm_mullo_epi32(sum, kscale), 23));
+        }
+    }
+}
+
+DECORA_TARGET("sse4.1")
+static void boxBlurVerticalSSE41(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                 jint *srcPixels, jint srcw, jint srch, jint srcscan)
+{
+    __m128i *sums = (__m128i *) malloc(dstw * sizeof(__m128i));
+    if (sums == NULL) {
+        boxBlurVerticalScalar(dstPixels, dsth, dstscan, srcPixels, srch, srcscan, 0, dstw);
+        return;
+    }
+    memset(sums, 0, dstw * sizeof(__m128i));
+
+    jint vsize = dsth - srch + 1;
+    __m128i kscale = _mm_set1_epi32(0x7fffffff / (vsize * 255));
+    for (jint y = 0; y < dsth; y++) {
+        jint *sub = (y >= vsize) ? srcPixels + (y - vsize) * srcscan : NULL;
+        jint *add = (y < srch) ? srcPixels + y * srcscan : NULL;
+        jint *dst = dstPixels + y * dstscan;
+        for (jint x = 0; x < dstw; x++) {
+            __m128i sum = _mm_loadu_si128(&sums[x]);
+            if (sub != NULL) {
+                sum = _mm_sub_epi32(sum, unpackPixelSSE41(sub[x]));
+            }
+            if (add != NULL) {
+                sum = _mm_add_epi32(sum, unpackPixelSSE41(add[x]));
+            }
+            _mm_storeu_si128(&sums[x], sum);
+            dst[x] = packPixelSSE41(_mm_srli_epi32(_mm_mullo_epi32(sum, kscale), 23));
+        }
+    }
+    free(sums);
+}
+
+/*
+ * Converts 4 alpha sums into shadow pixels, see boxShadowPixel().
+ */
+DECORA_TARGET("sse4.1")
+static inline __m128i boxShadowPixelsSSE41(__m128i suma, const BoxShadowParams &p, bool black)
+{
+    __m128i color;
+    if (black) {
+        color = _mm_slli_epi32(_mm_srli_epi32(_mm_mullo_epi32(suma, _mm_set1_epi32(p.kscalea)), 23), 24);
+    } else {
+        __m128i a = _mm_srli_epi32(_mm_mullo_epi32(suma, _mm_set1_epi32(p.kscalea)), 23);
+        __m128i r = _mm_srli_epi32(_mm_mullo_epi32(suma, _mm_set1_epi32(p.kscaler)), 23);
+        __m128i g = _mm_srli_epi32(_mm_mullo_epi32(suma, _mm_set1_epi32(p.kscaleg)), 23);
+        __m128i b = _mm_srli_epi32(_mm_mullo_epi32(suma, _mm_set1_epi32(p.kscaleb)), 23);
+        color = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(a, 24), _mm_slli_epi32(r, 16)),
+                             _mm_or_si128(_mm_slli_epi32(g, 8), b));
+    }
+    __m128i full = _mm_cmpgt_epi32(suma, _mm_set1_epi32(p.amax - 1));
+    __m128i none = _mm_cmplt_epi32(suma, _mm_set1_epi32(p.amin));
+    color = _mm_blendv_epi8(color, _mm_set1_epi32(p.shadowRGB), full);
+    return _mm_andnot_si128(none, color);
+}
+
+DECORA_TARGET("sse4.1")
+static inline __m128i loadAlphasSSE41(jint *rows[4], jint x)
+{
+    __m128i v = _mm_setr_epi32(rows[0][x], rows[1][x], rows[2][x], rows[3][x]);
+    return _mm_srli_epi32(v, 24);
+}
+
+DECORA_TARGET("sse4.1")
+static void boxShadowHorizontalBlackSSE41(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                          jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                          jfloat spread)
+{
+    // The sums of a row depend on each other, 4 rows are done at a time.
+    BoxShadowParams p = boxShadowParams(dstw - srcw + 1, spread, NULL);
+    jint hsize = dstw - srcw + 1;
+    jint y = 0;
+    for (; y + 4 <= dsth; y += 4) {
+        jint *src[4];
+        jint *dst[4];
+        for (jint i = 0; i < 4; i++) {
+            src[i] = srcPixels + (y + i) * srcscan;
+            dst[i] = dstPixels + (y + i) * dstscan;
+        }
+        __m128i suma = _mm_setzero_si128();
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                suma = _mm_sub_epi32(suma, loadAlphasSSE41(src, x - hsize));
+            }
+            if (x < srcw) {
+                suma = _mm_add_epi32(suma, loadAlphasSSE41(src, x));
+            }
+            __m128i out = boxShadowPixelsSSE41(suma, p, true);
+            dst[0][x] = _mm_cvtsi128_si32(out);
+            dst[1][x] = _mm_extract_epi32(out, 1);
+            dst[2][x] = _mm_extract_epi32(out, 2);
+            dst[3][x] = _mm_extract_epi32(out, 3);
+        }
+    }
+    boxShadowHorizontalBlackScalar(dstPixels, dstw, dstscan, srcPixels, srcw, srcscan, p, y, dsth);
+}
+
+DECORA_TARGET("sse4.1")
+static void boxShadowVerticalSSE41(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                   jint *srcPixels, jint srch, jint srcscan,
+                                   const BoxShadowParams &p, bool black)
+{
+    // 4 columns are done at a time, the remaining ones by the scalar loop.
+    jint vecw = dstw & ~3;
+    __m128i *sums = (__m128i *) malloc((vecw / 4 + 1) * sizeof(__m128i));
+    if (sums == NULL) {
+        vecw = 0;
+    } else {
+        memset(sums, 0, (vecw / 4 + 1) * sizeof(__m128i));
+        jint vsize = dsth - srch + 1;
+        for (jint y = 0; y < dsth; y++) {
+            jint *sub = (y >= vsize) ? srcPixels + (y - vsize) * srcscan : NULL;
+            jint *add = (y < srch) ? srcPixels + y * srcscan : NULL;
+            jint *dst = dstPixels + y * dstscan;
+            for (jint x = 0; x < vecw; x += 4) {
+                __m128i suma = _mm_loadu_si128(&sums[x / 4]);
+                if (sub != NULL) {
+                    __m128i v = _mm_loadu_si128((__m128i *) (sub + x));
+                    suma = _mm_sub_epi32(suma, _mm_srli_epi32(v, 24));
+                }
+                if (add != NULL) {
+                    __m128i v = _mm_loadu_si128((__m128i *) (add + x));
+                    suma = _mm_add_epi32(suma, _mm_srli_epi32(v, 24));
+                }
+                _mm_storeu_si128(&sums[x / 4], suma);
+                _mm_storeu_si128((__m128i *) (dst + x), boxShadowPixelsSSE41(suma, p, black));
+            }
+        }
+        free(sums);
+    }
+    boxShadowVerticalScalar(dstPixels, dsth, dstscan, srcPixels, srch, srcscan, p, black, vecw, dstw);
+}
+
+DECORA_TARGET("sse4.1")
+static void boxShadowVerticalBlackSSE41(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                        jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                        jfloat spread)
+{
+    BoxShadowParams p = boxShadowParams(dsth - srch + 1, spread, NULL);
+    boxShadowVerticalSSE41(dstPixels, dstw, dsth, dstscan, srcPixels, srch, srcscan, p, true);
+}
+
+DECORA_TARGET("sse4.1")
+static void boxShadowVerticalColorSSE41(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                        jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                        jfloat spread, jfloat *shadowColor)
+{
+    BoxShadowParams p = boxShadowParams(dsth - srch + 1, spread, shadowColor);
+    boxShadowVerticalSSE41(dstPixels, dstw, dsth, dstscan, srcPixels, srch, srcscan, p, false);
+}
+
+/*
+ * Clamps 4 component sums like the scalar convolve loop and packs them
+ * back into a pixel.
+ */
+DECORA_TARGET("sse4.1")
+static inline jint convolvePixelSSE41(__m128 sum)
+{
+    __m128i v = _mm_cvttps_epi32(sum);
+    v = _mm_andnot_si128(_mm_castps_si128(_mm_cmplt_ps(sum, _mm_set1_ps(cmin))), v);
+    v = _mm_blendv_epi8(v, _mm_set1_epi32(255),
+                        _mm_castps_si128(_mm_cmpgt_ps(sum, _mm_set1_ps(cmax))));
+    return packPixelSSE41(v);
+}
+
+DECORA_TARGET("sse4.1")
+static void convolveHVSSE41(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                            jint *srcPixels, jint srccols, jint srcrows, jint scolinc, jint srowinc,
+                            jfloat *kvals, jint kernelSize)
+{
+    // The components of the surrounding K pixels, one vector per pixel.
+    __m128 cvals[128];
+    for (jint r = 0; r < dstrows; r++) {
+        jint dstoff = r * drowinc;
+        jint srcoff = r * srowinc;
+        for (jint i = 0; i < kernelSize; i++) {
+            cvals[i] = _mm_setzero_ps();
+        }
+        jint koff = kernelSize;
+        for (jint c = 0; c < dstcols; c++) {
+            jint rgb = (c < srccols) ? srcPixels[srcoff] : 0;
+            cvals[kernelSize - koff] = _mm_cvtepi32_ps(unpackPixelSSE41(rgb));
+            if (--koff <= 0) {
+                koff += kernelSize;
+            }
+            __m128 sum = _mm_setzero_ps();
+            for (jint i = 0; i < kernelSize; i++) {
+                sum = _mm_add_ps(sum, _mm_mul_ps(cvals[i], _mm_set1_ps(kvals[koff + i])));
+            }
+            dstPixels[dstoff] = convolvePixelSSE41(sum);
+            dstoff += dcolinc;
+            srcoff += scolinc;
+        }
+    }
+}
+
+DECORA_TARGET("sse4.1")
+static inline __m128i convolveShadowIndicesSSE41(__m128 sum)
+{
+    // See convolveShadowIndex()
+    __m128i v = _mm_add_epi32(_mm_cvttps_epi32(sum), _mm_set1_epi32(1));
+    v = _mm_blendv_epi8(v, _mm_set1_epi32(255),
+                        _mm_castps_si128(_mm_cmpge_ps(sum, _mm_set1_ps(254.0f))));
+    return _mm_andnot_si128(_mm_castps_si128(_mm_cmplt_ps(sum, _mm_setzero_ps())), v);
+}
+
+DECORA_TARGET("sse4.1")
+static void convolveShadowHVSSE41(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                                  jint *srcPixels, jint srccols, jint srcrows, jint scolinc, jint srowinc,
+                                  jfloat *kvals, jint kernelSize, jint *shadowRGBs)
+{
+    // Only alpha is convolved, 4 rows are done at a time with one lane each.
+    __m128 avals[128];
+    jint r = 0;
+    for (; r + 4 <= dstrows; r += 4) {
+        jint dstoff = r * drowinc;
+        jint srcoff = r * srowinc;
+        for (jint i = 0; i < kernelSize; i++) {
+            avals[i] = _mm_setzero_ps();
+        }
+        jint koff = kernelSize;
+        for (jint c = 0; c < dstcols; c++) {
+            __m128i rgb = (c < srccols)
+                ? _mm_setr_epi32(srcPixels[srcoff],
+                                 srcPixels[srcoff + srowinc],
+                                 srcPixels[srcoff + srowinc * 2],
+                                 srcPixels[srcoff + srowinc * 3])
+                : _mm_setzero_si128();
+            avals[kernelSize - koff] = _mm_cvtepi32_ps(_mm_srli_epi32(rgb, 24));
+            if (--koff <= 0) {
+                koff += kernelSize;
+            }
+            __m128 sum = _mm_set1_ps(-0.5f);
+            for (jint i = 0; i < kernelSize; i++) {
+                sum = _mm_add_ps(sum, _mm_mul_ps(avals[i], _mm_set1_ps(kvals[koff + i])));
+            }
+            __m128i idx = convolveShadowIndicesSSE41(sum);
+            dstPixels[dstoff] = shadowRGBs[_mm_cvtsi128_si32(idx)];
+            dstPixels[dstoff + drowinc] = shadowRGBs[_mm_extract_epi32(idx, 1)];
+            dstPixels[dstoff + drowinc * 2] = shadowRGBs[_mm_extract_epi32(idx, 2)];
+            dstPixels[dstoff + drowinc * 3] = shadowRGBs[_mm_extract_epi32(idx, 3)];
+            dstoff += dcolinc;
+            srcoff += scolinc;
+        }
+    }
+    convolveShadowHVScalar(dstPixels, dstcols, dcolinc, drowinc,
+                           srcPixels, srccols, scolinc, srowinc,
+                           kvals, kernelSize, shadowRGBs, r, dstrows);
+}
+
+static const DecoraKernels sse41Kernels = {
+    DECORA_KERNELS_SSE41, "sse4.1",
+    boxBlurHorizontalSSE41,
+    boxBlurVerticalSSE41,
+    boxShadowHorizontalBlackSSE41,
+    boxShadowVerticalBlackSSE41,
+    boxShadowVerticalColorSSE41,
+    convolveHVSSE41,
+    convolveShadowHVSSE41,
+};
+
+/*
+ * AVX2 kernels. Where the work along a row is sequential, two pixels,
+ * one in each 128-bit lane, or eight alpha values are processed at once.
+ */
+
+DECORA_TARGET("avx2")
+static inline __m256i unpackPixelPairAVX2(__m128i pixels)
+{
+    return _mm256_cvtepu8_epi32(pixels);
+}
+
+DECORA_TARGET("avx2")
+static inline __m128i packPixelPairAVX2(__m256i v)
+{
+    v = _mm256_packus_epi32(v, v);
+    v = _mm256_packus_epi16(v, v);
+    // The pixels end up in the first int of each 128-bit lane.
+    v = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 4, 0, 4, 0, 4, 0, 4));
+    return _mm256_castsi256_si128(v);
+}
+
+DECORA_TARGET("avx2")
+static void boxBlurHorizontalAVX2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                  jint *srcPixels, jint srcw, jint srch, jint srcscan)
+{
+    // Two rows are done at a time, one in each 128-bit lane.
+    jint hsize = dstw - srcw + 1;
+    __m256i kscale = _mm256_set1_epi32(0x7fffffff / (hsize * 255));
+    jint y = 0;
+    for (; y + 2 <= dsth; y += 2) {
+        jint *src0 = srcPixels + y * srcscan;
+        jint *src1 = src0 + srcscan;
+        jint *dst0 = dstPixels + y * dstscan;
+        jint *dst1 = dst0 + dstscan;
+        __m256i sum = _mm256_setzero_si256();
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                sum = _mm256_sub_epi32(sum, unpackPixelPairAVX2(
+                        _mm_setr_epi32(src0[x - hsize], src1[x - hsize], 0, 0)));
+            }
+            if (x < srcw) {
+                sum = _mm256_add_epi32(sum, unpackPixelPairAVX2(
+                        _mm_setr_epi32(src0[x], src1[x], 0, 0)));
+            }
+            __m128i out = packPixelPairAVX2(_mm256_srli_epi32(_mm256_mullo_epi32(sum, kscale), 23));
+            dst0[x] = _mm_cvtsi128_si32(out);
+            dst1[x] = _mm_extract_epi32(out, 1);
+        }
+    }
+    boxBlurHorizontalScalar(dstPixels, dstw, dstscan, srcPixels, srcw, srcscan, y, dsth);
+}
+
+DECORA_TARGET("avx2")
+static void boxBlurVerticalAVX2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                jint *srcPixels, jint srcw, jint srch, jint srcscan)
+{
+    // Two adjacent columns are done at a time.
+    jint vecw = dstw & ~1;
+    __m256i *sums = (__m256i *) malloc((vecw / 2 + 1) * sizeof(__m256i));
+    if (sums == NULL) {
+        vecw = 0;
+    } else {
+        memset(sums, 0, (vecw / 2 + 1) * sizeof(__m256i));
+        jint vsize = dsth - srch + 1;
+        __m256i kscale = _mm256_set1_epi32(0x7fffffff / (vsize * 255));
+        for (jint y = 0; y < dsth; y++) {
+            jint *sub = (y >= vsize) ? srcPixels + (y - vsize) * srcscan : NULL;
+            jint *add = (y < srch) ? srcPixels + y * srcscan : NULL;
+            jint *dst = dstPixels + y * dstscan;
+            for (jint x = 0; x < vecw; x += 2) {
+                __m256i sum = _mm256_loadu_si256(&sums[x / 2]);
+                if (sub != NULL) {
+                    sum = _mm256_sub_epi32(sum, unpackPixelPairAVX2(_mm_loadl_epi64((__m128i *) (sub + x))));
+                }
+                if (add != NULL) {
+                    sum = _mm256_add_epi32(sum, unpackPixelPairAVX2(_mm_loadl_epi64((__m128i *) (add + x))));
+                }
+                _mm256_storeu_si256(&sums[x / 2], sum);
+                _mm_storel_epi64((__m128i *) (dst + x),
+                                 packPixelPairAVX2(_mm256_srli_epi32(_mm256_mullo_epi32(sum, kscale), 23)));
+            }
+        }
+        free(sums);
+    }
+    boxBlurVerticalScalar(dstPixels, dsth, dstscan, srcPixels, srch, srcscan, vecw, dstw);
+}
+
+/*
+ * Converts 8 alpha sums into shadow pixels, see boxShadowPixel().
+ */
+DECORA_TARGET("avx2")
+static inline __m256i boxShadowPixelsAVX2(__m256i suma, const BoxShadowParams &p, bool black)
+{
+    __m256i color;
+    if (black) {
+        color = _mm256_slli_epi32(_mm256_srli_epi32(_mm256_mullo_epi32(suma, _mm256_set1_epi32(p.kscalea)), 23), 24);
+    } else {
+        __m256i a = _mm256_srli_epi32(_mm256_mullo_epi32(suma, _mm256_set1_epi32(p.kscalea)), 23);
+        __m256i r = _mm256_srli_epi32(_mm256_mullo_epi32(suma, _mm256_set1_epi32(p.kscaler)), 23);
+        __m256i g = _mm256_srli_epi32(_mm256_mullo_epi32(suma, _mm256_set1_epi32(p.kscaleg)), 23);
+        __m256i b = _mm256_srli_epi32(_mm256_mullo_epi32(suma, _mm256_set1_epi32(p.kscaleb)), 23);
+        color = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(a, 24), _mm256_slli_epi32(r, 16)),
+                                _mm256_or_si256(_mm256_slli_epi32(g, 8), b));
+    }
+    __m256i full = _mm256_cmpgt_epi32(suma, _mm256_set1_epi32(p.amax - 1));
+    __m256i none = _mm256_cmpgt_epi32(_mm256_set1_epi32(p.amin), suma);
+    color = _mm256_blendv_epi8(color, _mm256_set1_epi32(p.shadowRGB), full);
+    return _mm256_andnot_si256(none, color);
+}
+
+DECORA_TARGET("avx2")
+static inline __m256i loadAlphasAVX2(jint *rows[8], jint x)
+{
+    __m256i v = _mm256_setr_epi32(rows[0][x], rows[1][x], rows[2][x], rows[3][x],
+                                  rows[4][x], rows[5][x], rows[6][x], rows[7][x]);
+    return _mm256_srli_epi32(v, 24);
+}
+
+DECORA_TARGET("avx2")
+static void boxShadowHorizontalBlackAVX2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                         jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                         jfloat spread)
+{
+    // The sums of a row depend on each other, 8 rows are done at a time.
+    BoxShadowParams p = boxShadowParams(dstw - srcw + 1, spread, NULL);
+    jint hsize = dstw - srcw + 1;
+    jint y = 0;
+    for (; y + 8 <= dsth; y += 8) {
+        jint *src[8];
+        jint *dst[8];
+        for (jint i = 0; i < 8; i++) {
+            src[i] = srcPixels + (y + i) * srcscan;
+            dst[i] = dstPixels + (y + i) * dstscan;
+        }
+        __m256i suma = _mm256_setzero_si256();
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                suma = _mm256_sub_epi32(suma, loadAlphasAVX2(src, x - hsize));
+            }
+            if (x < srcw) {
+                suma = _mm256_add_epi32(suma, loadAlphasAVX2(src, x));
+            }
+            jint out[8];
+            _mm256_storeu_si256((__m256i *) out, boxShadowPixelsAVX2(suma, p, true));
+            for (jint i = 0; i < 8; i++) {
+                dst[i][x] = out[i];
+            }
+        }
+    }
+    boxShadowHorizontalBlackScalar(dstPixels, dstw, dstscan, srcPixels, srcw, srcscan, p, y, dsth);
+}
+
+DECORA_TARGET("avx2")
+static void boxShadowVerticalAVX2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                  jint *srcPixels, jint srch, jint srcscan,
+                                  const BoxShadowParams &p, bool black)
+{
+    // 8 columns are done at a time, the remaining ones by the scalar loop.
+    jint vecw = dstw & ~7;
+    __m256i *sums = (__m256i *) malloc((vecw / 8 + 1) * sizeof(__m256i));
+    if (sums == NULL) {
+        vecw = 0;
+    } else {
+        memset(sums, 0, (vecw / 8 + 1) * sizeof(__m256i));
+        jint vsize = dsth - srch + 1;
+        for (jint y = 0; y < dsth; y++) {
+            jint *sub = (y >= vsize) ? srcPixels + (y - vsize) * srcscan : NULL;
+            jint *add = (y < srch) ? srcPixels + y * srcscan : NULL;
+            jint *dst = dstPixels + y * dstscan;
+            for (jint x = 0; x < vecw; x += 8) {
+                __m256i suma = _mm256_loadu_si256(&sums[x / 8]);
+                if (sub != NULL) {
+                    __m256i v = _mm256_loadu_si256((__m256i *) (sub + x));
+                    suma = _mm256_sub_epi32(suma, _mm256_srli_epi32(v, 24));
+                }
+                if (add != NULL) {
+                    __m256i v = _mm256_loadu_si256((__m256i *) (add + x));
+                    suma = _mm256_add_epi32(suma, _mm256_srli_epi32(v, 24));
+                }
+                _mm256_storeu_si256(&sums[x / 8], suma);
+                _mm256_storeu_si256((__m256i *) (dst + x), boxShadowPixelsAVX2(suma, p, black));
+            }
+        }
+        free(sums);
+    }
+    boxShadowVerticalScalar(dstPixels, dsth, dstscan, srcPixels, srch, srcscan, p, black, vecw, dstw);
+}
+
+DECORA_TARGET("avx2")
+static void boxShadowVerticalBlackAVX2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                       jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                       jfloat spread)
+{
+    BoxShadowParams p = boxShadowParams(dsth - srch + 1, spread, NULL);
+    boxShadowVerticalAVX2(dstPixels, dstw, dsth, dstscan, srcPixels, srch, srcscan, p, true);
+}
+
+DECORA_TARGET("avx2")
+static void boxShadowVerticalColorAVX2(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                       jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                       jfloat spread, jfloat *shadowColor)
+{
+    BoxShadowParams p = boxShadowParams(dsth - srch + 1, spread, shadowColor);
+    boxShadowVerticalAVX2(dstPixels, dstw, dsth, dstscan, srcPixels, srch, srcscan, p, false);
+}
+
+DECORA_TARGET("avx2")
+static void convolveHVAVX2(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                           jint *srcPixels, jint srccols, jint srcrows, jint scolinc, jint srowinc,
+                           jfloat *kvals, jint kernelSize)
+{
+    // Two rows are done at a time, one in each 128-bit lane.
+    __m256 cvals[128];
+    jint r = 0;
+    for (; r + 2 <= dstrows; r += 2) {
+        jint dstoff = r * drowinc;
+        jint srcoff = r * srowinc;
+        for (jint i = 0; i < kernelSize; i++) {
+            cvals[i] = _mm256_setzero_ps();
+        }
+        jint koff = kernelSize;
+        for (jint c = 0; c < dstcols; c++) {
+            __m128i rgb = (c < srccols)
+                ? _mm_setr_epi32(srcPixels[srcoff], srcPixels[srcoff + srowinc], 0, 0)
+                : _mm_setzero_si128();
+            cvals[kernelSize - koff] = _mm256_cvtepi32_ps(unpackPixelPairAVX2(rgb));
+            if (--koff <= 0) {
+                koff += kernelSize;
+            }
+            __m256 sum = _mm256_setzero_ps();
+            for (jint i = 0; i < kernelSize; i++) {
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(cvals[i], _mm256_set1_ps(kvals[koff + i])));
+            }
+            __m256i v = _mm256_cvttps_epi32(sum);
+            v = _mm256_andnot_si256(_mm256_castps_si256(_mm256_cmp_ps(sum, _mm256_set1_ps(cmin), _CMP_LT_OQ)), v);
+            v = _mm256_blendv_epi8(v, _mm256_set1_epi32(255),
+                                   _mm256_castps_si256(_mm256_cmp_ps(sum, _mm256_set1_ps(cmax), _CMP_GT_OQ)));
+            __m128i out = packPixelPairAVX2(v);
+            dstPixels[dstoff] = _mm_cvtsi128_si32(out);
+            dstPixels[dstoff + drowinc] = _mm_extract_epi32(out, 1);
+            dstoff += dcolinc;
+            srcoff += scolinc;
+        }
+    }
+    convolveHVScalar(dstPixels, dstcols, dcolinc, drowinc,
+                     srcPixels, srccols, scolinc, srowinc,
+                     kvals, kernelSize, r, dstrows);
+}
+
+DECORA_TARGET("avx2")
+static void convolveShadowHVAVX2(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                                 jint *srcPixels, jint srccols, jint srcrows, jint scolinc, jint srowinc,
+                                 jfloat *kvals, jint kernelSize, jint *shadowRGBs)
+{
+    // Only alpha is convolved, 8 rows are done at a time with one lane each.
+    __m256 avals[128];
+    __m256i rowOffsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                            _mm256_set1_epi32(srowinc));
+    jint r = 0;
+    for (; r + 8 <= dstrows; r += 8) {
+        jint dstoff = r * drowinc;
+        jint srcoff = r * srowinc;
+        for (jint i = 0; i < kernelSize; i++) {
+            avals[i] = _mm256_setzero_ps();
+        }
+        jint koff = kernelSize;
+        for (jint c = 0; c < dstcols; c++) {
+            __m256i rgb = (c < srccols)
+                ? _mm256_i32gather_epi32((const int *) (srcPixels + srcoff), rowOffsets, 4)
+                : _mm256_setzero_si256();
+            avals[kernelSize - koff] = _mm256_cvtepi32_ps(_mm256_srli_epi32(rgb, 24));
+            if (--koff <= 0) {
+                koff += kernelSize;
+            }
+            __m256 sum = _mm256_set1_ps(-0.5f);
+            for (jint i = 0; i < kernelSize; i++) {
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(avals[i], _mm256_set1_ps(kvals[koff + i])));
+            }
+            // See convolveShadowIndex()
+            __m256i idx = _mm256_add_epi32(_mm256_cvttps_epi32(sum), _mm256_set1_epi32(1));
+            idx = _mm256_blendv_epi8(idx, _mm256_set1_epi32(255),
+                                     _mm256_castps_si256(_mm256_cmp_ps(sum, _mm256_set1_ps(254.0f), _CMP_GE_OQ)));
+            idx = _mm256_andnot_si256(_mm256_castps_si256(_mm256_cmp_ps(sum, _mm256_setzero_ps(), _CMP_LT_OQ)), idx);
+            jint out[8];
+            _mm256_storeu_si256((__m256i *) out, idx);
+            for (jint i = 0; i < 8; i++) {
+                dstPixels[dstoff + drowinc * i] = shadowRGBs[out[i]];
+            }
+            dstoff += dcolinc;
+            srcoff += scolinc;
+        }
+    }
+    convolveShadowHVScalar(dstPixels, dstcols, dcolinc, drowinc,
+                           srcPixels, srccols, scolinc, srowinc,
+                           kvals, kernelSize, shadowRGBs, r, dstrows);
+}
+
+static const DecoraKernels avx2Kernels = {
+    DECORA_KERNELS_AVX2, "avx2",
+    boxBlurHorizontalAVX2,
+    boxBlurVerticalAVX2,
+    boxShadowHorizontalBlackAVX2,
+    boxShadowVerticalBlackAVX2,
+    boxShadowVerticalColorAVX2,
+    convolveHVAVX2,
+    convolveShadowHVAVX2,
+};
+
+static bool cpuSupports(jint level)
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+    __cpuid(info, 1);
+    bool sse41 = (info[2] & (1 << 19)) != 0;
+    if (level == DECORA_KERNELS_SSE41) {
+        return sse41;
+    }
+    // AVX2 also needs the OS to save the YMM registers.
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (!sse41 || !osxsave || !avx || maxLeaf < 7 || (_xgetbv(0) & 6) != 6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    if (level == DECORA_KERNELS_SSE41) {
+        return __builtin_cpu_supports("sse4.1");
+    }
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif /* DECORA_X86 */
+
+#ifdef DECORA_NEON
+
+/*
+ * NEON kernels, laid out like the SSE4.1 ones: one lane per component
+ * for full pixels, one lane per row or column for alpha only passes.
+ */
+
+static inline int32x4_t unpackPixelNEON(jint rgb)
+{
+    uint8x8_t bytes = vreinterpret_u8_u32(vdup_n_u32((uint32_t) rgb));
+    return vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(vmovl_u8(bytes))));
+}
+
+static inline jint packPixelNEON(int32x4_t v)
+{
+    // The lanes are known to be in 0..255.
+    uint16x4_t half = vmovn_u32(vreinterpretq_u32_s32(v));
+    uint8x8_t bytes = vmovn_u16(vcombine_u16(half, half));
+    return (jint) vget_lane_u32(vreinterpret_u32_u8(bytes), 0);
+}
+
+static void boxBlurHorizontalNEON(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                  jint *srcPixels, jint srcw, jint srch, jint srcscan)
+{
+    jint hsize = dstw - srcw + 1;
+    int32x4_t kscale = vdupq_n_s32(0x7fffffff / (hsize * 255));
+    for (jint y = 0; y < dsth; y++) {
+        jint *src = srcPixels + y * srcscan;
+        jint *dst = dstPixels + y * dstscan;
+        int32x4_t sum = vdupq_n_s32(0);
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                sum = vsubq_s32(sum, unpackPixelNEON(src[x - hsize]));
+            }
+            if (x < srcw) {
+                sum = vaddq_s32(sum, unpackPixelNEON(src[x]));
+            }
+            dst[x] = packPixelNEON(vshrq_n_s32(vmulq_s32(sum, kscale), 23));
+        }
+    }
+}
+
+static void boxBlurVerticalNEON(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                jint *srcPixels, jint srcw, jint srch, jint srcscan)
+{
+    int32x4_t *sums = (int32x4_t *) malloc(dstw * sizeof(int32x4_t));
+    if (sums == NULL) {
+        boxBlurVerticalScalar(dstPixels, dsth, dstscan, srcPixels, srch, srcscan, 0, dstw);
+        return;
+    }
+    memset(sums, 0, dstw * sizeof(int32x4_t));
+
+    jint vsize = dsth - srch + 1;
+    int32x4_t kscale = vdupq_n_s32(0x7fffffff / (vsize * 255));
+    for (jint y = 0; y < dsth; y++) {
+        jint *sub = (y >= vsize) ? srcPixels + (y - vsize) * srcscan : NULL;
+        jint *add = (y < srch) ? srcPixels + y * srcscan : NULL;
+        jint *dst = dstPixels + y * dstscan;
+        for (jint x = 0; x < dstw; x++) {
+            int32x4_t sum = sums[x];
+            if (sub != NULL) {
+                sum = vsubq_s32(sum, unpackPixelNEON(sub[x]));
+            }
+            if (add != NULL) {
+                sum = vaddq_s32(sum, unpackPixelNEON(add[x]));
+            }
+            sums[x] = sum;
+            dst[x] = packPixelNEON(vshrq_n_s32(vmulq_s32(sum, kscale), 23));
+        }
+    }
+    free(sums);
+}
+
+/*
+ * Converts 4 alpha sums into shadow pixels, see boxShadowPixel().
+ */
+static inline int32x4_t boxShadowPixelsNEON(int32x4_t suma, const BoxShadowParams &p, bool black)
+{
+    int32x4_t color;
+    if (black) {
+        color = vshlq_n_s32(vshrq_n_s32(vmulq_s32(suma, vdupq_n_s32(p.kscalea)), 23), 24);
+    } else {
+        int32x4_t a = vshrq_n_s32(vmulq_s32(suma, vdupq_n_s32(p.kscalea)), 23);
+        int32x4_t r = vshrq_n_s32(vmulq_s32(suma, vdupq_n_s32(p.kscaler)), 23);
+        int32x4_t g = vshrq_n_s32(vmulq_s32(suma, vdupq_n_s32(p.kscaleg)), 23);
+        int32x4_t b = vshrq_n_s32(vmulq_s32(suma, vdupq_n_s32(p.kscaleb)), 23);
+        color = vorrq_s32(vorrq_s32(vshlq_n_s32(a, 24), vshlq_n_s32(r, 16)),
+                          vorrq_s32(vshlq_n_s32(g, 8), b));
+    }
+    color = vbslq_s32(vcgeq_s32(suma, vdupq_n_s32(p.amax)), vdupq_n_s32(p.shadowRGB), color);
+    return vbslq_s32(vcltq_s32(suma, vdupq_n_s32(p.amin)), vdupq_n_s32(0), color);
+}
+
+static inline int32x4_t loadAlphasNEON(jint *rows[4], jint x)
+{
+    int32x4_t v = vdupq_n_s32(0);
+    v = vsetq_lane_s32(rows[0][x], v, 0);
+    v = vsetq_lane_s32(rows[1][x], v, 1);
+    v = vsetq_lane_s32(rows[2][x], v, 2);
+    v = vsetq_lane_s32(rows[3][x], v, 3);
+    return vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(v), 24));
+}
+
+static void boxShadowHorizontalBlackNEON(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                         jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                         jfloat spread)
+{
+    // The sums of a row depend on each other, 4 rows are done at a time.
+    BoxShadowParams p = boxShadowParams(dstw - srcw + 1, spread, NULL);
+    jint hsize = dstw - srcw + 1;
+    jint y = 0;
+    for (; y + 4 <= dsth; y += 4) {
+        jint *src[4];
+        jint *dst[4];
+        for (jint i = 0; i < 4; i++) {
+            src[i] = srcPixels + (y + i) * srcscan;
+            dst[i] = dstPixels + (y + i) * dstscan;
+        }
+        int32x4_t suma = vdupq_n_s32(0);
+        for (jint x = 0; x < dstw; x++) {
+            if (x >= hsize) {
+                suma = vsubq_s32(suma, loadAlphasNEON(src, x - hsize));
+            }
+            if (x < srcw) {
+                suma = vaddq_s32(suma, loadAlphasNEON(src, x));
+            }
+            int32x4_t out = boxShadowPixelsNEON(suma, p, true);
+            dst[0][x] = vgetq_lane_s32(out, 0);
+            dst[1][x] = vgetq_lane_s32(out, 1);
+            dst[2][x] = vgetq_lane_s32(out, 2);
+            dst[3][x] = vgetq_lane_s32(out, 3);
+        }
+    }
+    boxShadowHorizontalBlackScalar(dstPixels, dstw, dstscan, srcPixels, srcw, srcscan, p, y, dsth);
+}
+
+static void boxShadowVerticalNEON(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                  jint *srcPixels, jint srch, jint srcscan,
+                                  const BoxShadowParams &p, bool black)
+{
+    // 4 columns are done at a time, the remaining ones by the scalar loop.
+    jint vecw = dstw & ~3;
+    int32x4_t *sums = (int32x4_t *) malloc((vecw / 4 + 1) * sizeof(int32x4_t));
+    if (sums == NULL) {
+        vecw = 0;
+    } else {
+        memset(sums, 0, (vecw / 4 + 1) * sizeof(int32x4_t));
+        jint vsize = dsth - srch + 1;
+        for (jint y = 0; y < dsth; y++) {
+            jint *sub = (y >= vsize) ? srcPixels + (y - vsize) * srcscan : NULL;
+            jint *add = (y < srch) ? srcPixels + y * srcscan : NULL;
+            jint *dst = dstPixels + y * dstscan;
+            for (jint x = 0; x < vecw; x += 4) {
+                int32x4_t suma = sums[x / 4];
+                if (sub != NULL) {
+                    uint32x4_t v = vld1q_u32((const uint32_t *) (sub + x));
+                    suma = vsubq_s32(suma, vreinterpretq_s32_u32(vshrq_n_u32(v, 24)));
+                }
+                if (add != NULL) {
+                    uint32x4_t v = vld1q_u32((const uint32_t *) (add + x));
+                    suma = vaddq_s32(suma, vreinterpretq_s32_u32(vshrq_n_u32(v, 24)));
+                }
+                sums[x / 4] = suma;
+                vst1q_s32(dst + x, boxShadowPixelsNEON(suma, p, black));
+            }
+        }
+        free(sums);
+    }
+    boxShadowVerticalScalar(dstPixels, dsth, dstscan, srcPixels, srch, srcscan, p, black, vecw, dstw);
+}
+
+static void boxShadowVerticalBlackNEON(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                       jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                       jfloat spread)
+{
+    BoxShadowParams p = boxShadowParams(dsth - srch + 1, spread, NULL);
+    boxShadowVerticalNEON(dstPixels, dstw, dsth, dstscan, srcPixels, srch, srcscan, p, true);
+}
+
+static void boxShadowVerticalColorNEON(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                       jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                       jfloat spread, jfloat *shadowColor)
+{
+    BoxShadowParams p = boxShadowParams(dsth - srch + 1, spread, shadowColor);
+    boxShadowVerticalNEON(dstPixels, dstw, dsth, dstscan, srcPixels, srch, srcscan, p, false);
+}
+
+static void convolveHVNEON(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                           jint *srcPixels, jint srccols, jint srcrows, jint scolinc, jint srowinc,
+                           jfloat *kvals, jint kernelSize)
+{
+    // The components of the surrounding K pixels, one vector per pixel.
+    float32x4_t cvals[128];
+    for (jint r = 0; r < dstrows; r++) {
+        jint dstoff = r * drowinc;
+        jint srcoff = r * srowinc;
+        for (jint i = 0; i < kernelSize; i++) {
+            cvals[i] = vdupq_n_f32(0.0f);
+        }
+        jint koff = kernelSize;
+        for (jint c = 0; c < dstcols; c++) {
+            jint rgb = (c < srccols) ? srcPixels[srcoff] : 0;
+            cvals[kernelSize - koff] = vcvtq_f32_s32(unpackPixelNEON(rgb));
+            if (--koff <= 0) {
+                koff += kernelSize;
+            }
+            float32x4_t sum = vdupq_n_f32(0.0f);
+            for (jint i = 0; i < kernelSize; i++) {
+                sum = vaddq_f32(sum, vmulq_n_f32(cvals[i], kvals[koff + i]));
+            }
+            int32x4_t v = vcvtq_s32_f32(sum);
+            v = vbslq_s32(vcltq_f32(sum, vdupq_n_f32(cmin)), vdupq_n_s32(0), v);
+            v = vbslq_s32(vcgtq_f32(sum, vdupq_n_f32(cmax)), vdupq_n_s32(255), v);
+            dstPixels[dstoff] = packPixelNEON(v);
+            dstoff += dcolinc;
+            srcoff += scolinc;
+        }
+    }
+}
+
+static void convolveShadowHVNEON(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                                 jint *srcPixels, jint srccols, jint srcrows, jint scolinc, jint srowinc,
+                                 jfloat *kvals, jint kernelSize, jint *shadowRGBs)
+{
+    // Only alpha is convolved, 4 rows are done at a time with one lane each.
+    float32x4_t avals[128];
+    jint r = 0;
+    for (; r + 4 <= dstrows; r += 4) {
+        jint dstoff = r * drowinc;
+        jint srcoff = r * srowinc;
+        for (jint i = 0; i < kernelSize; i++) {
+            avals[i] = vdupq_n_f32(0.0f);
+        }
+        jint koff = kernelSize;
+        for (jint c = 0; c < dstcols; c++) {
+            uint32x4_t rgb = vdupq_n_u32(0);
+            if (c < srccols) {
+                rgb = vsetq_lane_u32((uint32_t) srcPixels[srcoff], rgb, 0);
+                rgb = vsetq_lane_u32((uint32_t) srcPixels[srcoff + srowinc], rgb, 1);
+                rgb = vsetq_lane_u32((uint32_t) srcPixels[srcoff + srowinc * 2], rgb, 2);
+                rgb = vsetq_lane_u32((uint32_t) srcPixels[srcoff + srowinc * 3], rgb, 3);
+            }
+            avals[kernelSize - koff] = vcvtq_f32_u32(vshrq_n_u32(rgb, 24));
+            if (--koff <= 0) {
+                koff += kernelSize;
+            }
+            float32x4_t sum = vdupq_n_f32(-0.5f);
+            for (jint i = 0; i < kernelSize; i++) {
+                sum = vaddq_f32(sum, vmulq_n_f32(avals[i], kvals[koff + i]));
+            }
+            // See convolveShadowIndex()
+            int32x4_t idx = vaddq_s32(vcvtq_s32_f32(sum), vdupq_n_s32(1));
+            idx = vbslq_s32(vcgeq_f32(sum, vdupq_n_f32(254.0f)), vdupq_n_s32(255), idx);
+            idx = vbslq_s32(vcltq_f32(sum, vdupq_n_f32(0.0f)), vdupq_n_s32(0), idx);
+            dstPixels[dstoff] = shadowRGBs[vgetq_lane_s32(idx, 0)];
+            dstPixels[dstoff + drowinc] = shadowRGBs[vgetq_lane_s32(idx, 1)];
+            dstPixels[dstoff + drowinc * 2] = shadowRGBs[vgetq_lane_s32(idx, 2)];
+            dstPixels[dstoff + drowinc * 3] = shadowRGBs[vgetq_lane_s32(idx, 3)];
+            dstoff += dcolinc;
+            srcoff += scolinc;
+        }
+    }
+    convolveShadowHVScalar(dstPixels, dstcols, dcolinc, drowinc,
+                           srcPixels, srccols, scolinc, srowinc,
+                           kvals, kernelSize, shadowRGBs, r, dstrows);
+}
+
+static const DecoraKernels neonKernels = {
+    DECORA_KERNELS_NEON, "neon",
+    boxBlurHorizontalNEON,
+    boxBlurVerticalNEON,
+    boxShadowHorizontalBlackNEON,
+    boxShadowVerticalBlackNEON,
+    boxShadowVerticalColorNEON,
+    convolveHVNEON,
+    convolveShadowHVNEON,
+};
+
+#endif /* DECORA_NEON */
+
+static const DecoraKernels *getDecoraKernels(jint level)
+{
+    switch (level) {
+    case DECORA_KERNELS_SCALAR:
+        return &scalarKernels;
+#ifdef DECORA_X86
+    case DECORA_KERNELS_SSE41:
+        return cpuSupports(level) ? &sse41Kernels : NULL;
+    case DECORA_KERNELS_AVX2:
+        return cpuSupports(level) ? &avx2Kernels : NULL;
+#endif
+#ifdef DECORA_NEON
+    case DECORA_KERNELS_NEON:
+        // NEON is part of the target of NEON builds
+        return &neonKernels;
+#endif
+    default:
+        return NULL;
+    }
+}
+
+static const DecoraKernels *selectedKernels = NULL;
+
+jint selectDecoraKernels(jint maxLevel)
+{
+    const DecoraKernels *kernels = NULL;
+    if (maxLevel < 0 || maxLevel > DECORA_KERNELS_NEON) {
+        maxLevel = DECORA_KERNELS_NEON;
+    }
+    for (jint level = maxLevel; kernels == NULL && level > DECORA_KERNELS_SCALAR; level--) {
+        kernels = getDecoraKernels(level);
+    }
+    selectedKernels = (kernels != NULL) ? kernels : &scalarKernels;
+    return selectedKernels->level;
+}
+
+const DecoraKernels *decoraKernels()
+{
+    if (selectedKernels == NULL) {
+        selectDecoraKernels(DECORA_KERNELS_AUTO);
+    }
+    return selectedKernels;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef _Included_SSEKernels
+#define _Included_SSEKernels
+
+#include <jni.h>
+
+/*
+ * Pixel loops shared by the SSE peers, with SIMD variants selected once
+ * by CPU capability. All variants produce the same pixels as the scalar
+ * versions; the peers only deal with the JNI arrays.
+ */
+
+#define DECORA_KERNELS_AUTO     -1
+#define DECORA_KERNELS_SCALAR    0
+#define DECORA_KERNELS_SSE41     1
+#define DECORA_KERNELS_AVX2      2
+#define DECORA_KERNELS_NEON      3
+
+typedef struct {
+    jint level;
+    const char *name;
+
+    // SSEBoxBlurPeer
+    void (*boxBlurHorizontal)(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                              jint *srcPixels, jint srcw, jint srch, jint srcscan);
+    void (*boxBlurVertical)(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                            jint *srcPixels, jint srcw, jint srch, jint srcscan);
+
+    // SSEBoxShadowPeer
+    void (*boxShadowHorizontalBlack)(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                     jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                     jfloat spread);
+    void (*boxShadowVerticalBlack)(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                   jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                   jfloat spread);
+    void (*boxShadowVertical)(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                              jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                              jfloat spread, jfloat *shadowColor);
+
+    // SSELinearConvolvePeer, kvals holds the kernel twice in a row
+    void (*convolveHV)(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                       jint *srcPixels, jint srccols, jint srcrows, jint scolinc, jint srowinc,
+                       jfloat *kvals, jint kernelSize);
+
+    // SSELinearConvolveShadowPeer, shadowRGBs maps alpha to the shadow color
+    void (*convolveShadowHV)(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                             jint *srcPixels, jint srccols, jint srcrows, jint scolinc, jint srowinc,
+                             jfloat *kvals, jint kernelSize, jint *shadowRGBs);
+} DecoraKernels;
+
+/*
+ * Selects the kernels to use, at most the given level, or the best
+ * supported ones for DECORA_KERNELS_AUTO. Returns the selected level.
+ */
+jint selectDecoraKernels(jint maxLevel);
+
+/*
+ * Returns the selected kernels, the best supported ones if none were
+ * selected yet.
+ */
+const DecoraKernels *decoraKernels();
+
+#endif /* _Included_SSEKernels */
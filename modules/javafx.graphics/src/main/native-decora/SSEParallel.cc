@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "SSEParallel.h"
+#include "SSEKernels.h"
+
+#ifdef WIN32 /* WIN32 */
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#ifdef WIN32 /* WIN32 */
+typedef SRWLOCK DecoraLock;
+typedef CONDITION_VARIABLE DecoraCondition;
+#define DECORA_LOCK_INIT SRWLOCK_INIT
+#define DECORA_CONDITION_INIT CONDITION_VARIABLE_INIT
+#define lockDecora(l) AcquireSRWLockExclusive(l)
+#define unlockDecora(l) ReleaseSRWLockExclusive(l)
+#define waitDecora(c, l) SleepConditionVariableSRW(c, l, INFINITE, 0)
+#define signalDecora(c) WakeConditionVariable(c)
+#define broadcastDecora(c) WakeAllConditionVariable(c)
+#else
+typedef pthread_mutex_t DecoraLock;
+typedef pthread_cond_t DecoraCondition;
+#define DECORA_LOCK_INIT PTHREAD_MUTEX_INITIALIZER
+#define DECORA_CONDITION_INIT PTHREAD_COND_INITIALIZER
+#define lockDecora(l) pthread_mutex_lock(l)
+#define unlockDecora(l) pthread_mutex_unlock(l)
+#define waitDecora(c, l) pthread_cond_wait(c, l)
+#define signalDecora(c) pthread_cond_signal(c)
+#define broadcastDecora(c) pthread_cond_broadcast(c)
+#endif
+
+// Upper bound of the pool, setDecoraThreads() clamps to it
+#define DECORA_MAX_THREADS 16
+
+// Bands are kept a multiple of the rows or columns the widest SIMD
+// kernels process at once
+#define DECORA_BAND_ALIGN 8
+
+struct DecoraTask;
+typedef void (*DecoraBandFunc)(const DecoraTask *task, jint start, jint end);
+
+/*
+ * One filter call split into bands [i * bandSize, (i + 1) * bandSize)
+ * of count rows or columns.
+ */
+struct DecoraTask {
+    DecoraBandFunc run;
+    jint count;
+    jint bandSize;
+
+    jint *dstPixels;
+    jint dstw, dsth, dstscan, dcolinc;
+    jint *srcPixels;
+    jint srcw, srch, srcscan, scolinc;
+
+    jfloat spread;
+    jfloat *shadowColor;
+    jfloat *kvals;
+    jint kernelSize;
+    jint *shadowRGBs;
+};
+
+/*
+ * The pool state, all guarded by poolLock. Workers are started lazily
+ * and live for the rest of the process, idle ones block on workCond.
+ */
+static DecoraLock poolLock = DECORA_LOCK_INIT;
+static DecoraCondition workCond = DECORA_CONDITION_INIT;
+static DecoraCondition doneCond = DECORA_CONDITION_INIT;
+static jint poolThreads = 1;
+static jint poolStarted = 0;
+static const DecoraTask *poolTask = NULL;
+static jint poolBands = 0;
+static jint poolNextBand = 0;
+static jint poolPending = 0;
+
+// Serializes the callers, the pool runs one task at a time
+static DecoraLock taskLock = DECORA_LOCK_INIT;
+
+static void runBand(const DecoraTask *task, jint band)
+{
+    jint start = band * task->bandSize;
+    jint end = start + task->bandSize;
+    if (end > task->count) {
+        end = task->count;
+    }
+    task->run(task, start, end);
+}
+
+/*
+ * Claims and runs bands of the current task until none are left, called
+ * with poolLock held.
+ */
+static void runBandsLocked()
+{
+    while (poolNextBand < poolBands) {
+        const DecoraTask *task = poolTask;
+        jint band = poolNextBand++;
+        unlockDecora(&poolLock);
+        runBand(task, band);
+        lockDecora(&poolLock);
+        if (--poolPending == 0) {
+            signalDecora(&doneCond);
+        }
+    }
+}
+
+#ifdef WIN32 /* WIN32 */
+static DWORD WINAPI decoraWorker(LPVOID unused)
+#else
+static void *decoraWorker(void *unused)
+#endif
+{
+    lockDecora(&poolLock);
+    for (;;) {
+        while (poolNextBand >= poolBands) {
+            waitDecora(&workCond, &poolLock);
+        }
+        runBandsLocked();
+    }
+    // not reached
+    return 0;
+}
+
+/*
+ * Starts workers up to poolThreads - 1, called with poolLock held.
+ * Returns the number of threads, including the caller, available.
+ */
+static jint startWorkersLocked()
+{
+    while (poolStarted < poolThreads - 1) {
+#ifdef WIN32 /* WIN32 */
+        HANDLE thread = CreateThread(NULL, 0, decoraWorker, NULL, 0, NULL);
+        if (thread == NULL) {
+            break;
+        }
+        CloseHandle(thread);
+#else
+        pthread_t thread;
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        int err = pthread_create(&thread, &attr, decoraWorker, NULL);
+        pthread_attr_destroy(&attr);
+        if (err != 0) {
+            break;
+        }
+#endif
+        poolStarted++;
+    }
+    return (poolStarted + 1 < poolThreads) ? poolStarted + 1 : poolThreads;
+}
+
+jint setDecoraThreads(jint threads)
+{
+    if (threads < 1) {
+        threads = 1;
+    } else if (threads > DECORA_MAX_THREADS) {
+        threads = DECORA_MAX_THREADS;
+    }
+    lockDecora(&poolLock);
+    poolThreads = threads;
+    unlockDecora(&poolLock);
+    return threads;
+}
+
+/*
+ * Runs the task over count rows or columns of an image of the given
+ * number of destination pixels, on the pool if it is large enough.
+ */
+static void runDecoraTask(DecoraTask *task, jint count, jlong pixels)
+{
+    jint threads;
+    lockDecora(&poolLock);
+    threads = poolThreads;
+    unlockDecora(&poolLock);
+    if (threads <= 1 || pixels < DECORA_PARALLEL_MIN_PIXELS || count < 2 * DECORA_BAND_ALIGN) {
+        task->count = count;
+        task->bandSize = count;
+        runBand(task, 0);
+        return;
+    }
+
+    lockDecora(&taskLock);
+    lockDecora(&poolLock);
+    threads = startWorkersLocked();
+    jint bandSize = (count + threads - 1) / threads;
+    bandSize = (bandSize + DECORA_BAND_ALIGN - 1) / DECORA_BAND_ALIGN * DECORA_BAND_ALIGN;
+    task->count = count;
+    task->bandSize = bandSize;
+    poolTask = task;
+    poolBands = (count + bandSize - 1) / bandSize;
+    poolNextBand = 0;
+    poolPending = poolBands;
+    broadcastDecora(&workCond);
+    runBandsLocked();
+    while (poolPending > 0) {
+        waitDecora(&doneCond, &poolLock);
+    }
+    poolTask = NULL;
+    unlockDecora(&poolLock);
+    unlockDecora(&taskLock);
+}
+
+/*
+ * Band functions, the horizontal passes are split into bands of rows,
+ * the vertical passes into bands of columns.
+ */
+
+static void boxBlurHorizontalBand(const DecoraTask *t, jint r0, jint r1)
+{
+    decoraKernels()->boxBlurHorizontal(t->dstPixels + r0 * t->dstscan, t->dstw, r1 - r0, t->dstscan,
+                                       t->srcPixels + r0 * t->srcscan, t->srcw, r1 - r0, t->srcscan);
+}
+
+static void boxBlurVerticalBand(const DecoraTask *t, jint c0, jint c1)
+{
+    decoraKernels()->boxBlurVertical(t->dstPixels + c0, c1 - c0, t->dsth, t->dstscan,
+                                     t->srcPixels + c0, c1 - c0, t->srch, t->srcscan);
+}
+
+static void boxShadowHorizontalBlackBand(const DecoraTask *t, jint r0, jint r1)
+{
+    decoraKernels()->boxShadowHorizontalBlack(t->dstPixels + r0 * t->dstscan, t->dstw, r1 - r0, t->dstscan,
+                                              t->srcPixels + r0 * t->srcscan, t->srcw, r1 - r0, t->srcscan,
+                                              t->spread);
+}
+
+static void boxShadowVerticalBlackBand(const DecoraTask *t, jint c0, jint c1)
+{
+    decoraKernels()->boxShadowVerticalBlack(t->dstPixels + c0, c1 - c0, t->dsth, t->dstscan,
+                                            t->srcPixels + c0, c1 - c0, t->srch, t->srcscan,
+                                            t->spread);
+}
+
+static void boxShadowVerticalBand(const DecoraTask *t, jint c0, jint c1)
+{
+    decoraKernels()->boxShadowVertical(t->dstPixels + c0, c1 - c0, t->dsth, t->dstscan,
+                                       t->srcPixels + c0, c1 - c0, t->srch, t->srcscan,
+                                       t->spread, t->shadowColor);
+}
+
+static void convolveHVBand(const DecoraTask *t, jint r0, jint r1)
+{
+    decoraKernels()->convolveHV(t->dstPixels + r0 * t->dstscan, t->dstw, r1 - r0, t->dcolinc, t->dstscan,
+                                t->srcPixels + r0 * t->srcscan, t->srcw, r1 - r0, t->scolinc, t->srcscan,
+                                t->kvals, t->kernelSize);
+}
+
+static void convolveShadowHVBand(const DecoraTask *t, jint r0, jint r1)
+{
+    decoraKernels()->convolveShadowHV(t->dstPixels + r0 * t->dstscan, t->dstw, r1 - r0, t->dcolinc, t->dstscan,
+                                      t->srcPixels + r0 * t->srcscan, t->srcw, r1 - r0, t->scolinc, t->srcscan,
+                                      t->kvals, t->kernelSize, t->shadowRGBs);
+}
+
+static void initTask(DecoraTask *t, DecoraBandFunc run,
+                     jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                     jint *srcPixels, jint srcw, jint srch, jint srcscan)
+{
+    t->run = run;
+    t->count = 0;
+    t->bandSize = 0;
+    t->dstPixels = dstPixels;
+    t->dstw = dstw;
+    t->dsth = dsth;
+    t->dstscan = dstscan;
+    t->dcolinc = 1;
+    t->srcPixels = srcPixels;
+    t->srcw = srcw;
+    t->srch = srch;
+    t->srcscan = srcscan;
+    t->scolinc = 1;
+    t->spread = 0.0f;
+    t->shadowColor = NULL;
+    t->kvals = NULL;
+    t->kernelSize = 0;
+    t->shadowRGBs = NULL;
+}
+
+void parallelBoxBlurHorizontal(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                               jint *srcPixels, jint srcw, jint srch, jint srcscan)
+{
+    DecoraTask t;
+    initTask(&t, boxBlurHorizontalBand,
+             dstPixels, dstw, dsth, dstscan, srcPixels, srcw, srch, srcscan);
+    runDecoraTask(&t, dsth, (jlong) dstw * dsth);
+}
+
+void parallelBoxBlurVertical(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                             jint *srcPixels, jint srcw, jint srch, jint srcscan)
+{
+    DecoraTask t;
+    initTask(&t, boxBlurVerticalBand,
+             dstPixels, dstw, dsth, dstscan, srcPixels, srcw, srch, srcscan);
+    runDecoraTask(&t, dstw, (jlong) dstw * dsth);
+}
+
+void parallelBoxShadowHorizontalBlack(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                      jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                      jfloat spread)
+{
+    DecoraTask t;
+    initTask(&t, boxShadowHorizontalBlackBand,
+             dstPixels, dstw, dsth, dstscan, srcPixels, srcw, srch, srcscan);
+    t.spread = spread;
+    runDecoraTask(&t, dsth, (jlong) dstw * dsth);
+}
+
+void parallelBoxShadowVerticalBlack(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                    jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                    jfloat spread)
+{
+    DecoraTask t;
+    initTask(&t, boxShadowVerticalBlackBand,
+             dstPixels, dstw, dsth, dstscan, srcPixels, srcw, srch, srcscan);
+    t.spread = spread;
+    runDecoraTask(&t, dstw, (jlong) dstw * dsth);
+}
+
+void parallelBoxShadowVertical(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                               jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                               jfloat spread, jfloat *shadowColor)
+{
+    DecoraTask t;
+    initTask(&t, boxShadowVerticalBand,
+             dstPixels, dstw, dsth, dstscan, srcPixels, srcw, srch, srcscan);
+    t.spread = spread;
+    t.shadowColor = shadowColor;
+    runDecoraTask(&t, dstw, (jlong) dstw * dsth);
+}
+
+/*
+ * The convolve passes are generic over the direction through the column
+ * and row increments, so they are always split by rows of the pass.
+ */
+
+void parallelConvolveHV(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                        jint *srcPixels, jint srccols, jint srcrows, jint scolinc, jint srowinc,
+                        jfloat *kvals, jint kernelSize)
+{
+    DecoraTask t;
+    initTask(&t, convolveHVBand,
+             dstPixels, dstcols, dstrows, drowinc, srcPixels, srccols, srcrows, srowinc);
+    t.dcolinc = dcolinc;
+    t.scolinc = scolinc;
+    t.kvals = kvals;
+    t.kernelSize = kernelSize;
+    runDecoraTask(&t, dstrows, (jlong) dstcols * dstrows);
+}
+
+void parallelConvolveShadowHV(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                              jint *srcPixels, jint srccols, jint srcrows, jint scolinc, jint srowinc,
+                              jfloat *kvals, jint kernelSize, jint *shadowRGBs)
+{
+    DecoraTask t;
+    initTask(&t, convolveShadowHVBand,
+             dstPixels, dstcols, dstrows, drowinc, srcPixels, srccols, srcrows, srowinc);
+    t.dcolinc = dcolinc;
+    t.scolinc = scolinc;
+    t.kvals = kvals;
+    t.kernelSize = kernelSize;
+    t.shadowRGBs = shadowRGBs;
+    runDecoraTask(&t, dstrows, (jlong) dstcols * dstrows);
+}
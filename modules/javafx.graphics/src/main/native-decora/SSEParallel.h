@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef _Included_SSEParallel
+#define _Included_SSEParallel
+
+#include <jni.h>
+
+/*
+ * Tiled execution of the SSEKernels. Images with at least
+ * DECORA_PARALLEL_MIN_PIXELS destination pixels are split into bands of
+ * rows (horizontal passes) or columns (vertical passes) which are
+ * filtered concurrently by a small pool of native worker threads, the
+ * calling thread filters the first band itself. Smaller images, or a
+ * pool of a single thread, run the kernels directly on the caller.
+ *
+ * The workers only ever touch the pixel memory handed to them, they
+ * never call into the JVM, so the peers can keep holding the arrays
+ * with GetPrimitiveArrayCritical for the duration of the call.
+ */
+
+#define DECORA_PARALLEL_MIN_PIXELS (256 * 512)
+
+/*
+ * Sets the number of threads, including the calling one, used for a
+ * large image. Returns the number actually used, at least 1.
+ */
+jint setDecoraThreads(jint threads);
+
+void parallelBoxBlurHorizontal(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                               jint *srcPixels, jint srcw, jint srch, jint srcscan);
+void parallelBoxBlurVertical(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                             jint *srcPixels, jint srcw, jint srch, jint srcscan);
+
+void parallelBoxShadowHorizontalBlack(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                      jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                      jfloat spread);
+void parallelBoxShadowVerticalBlack(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                                    jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                                    jfloat spread);
+void parallelBoxShadowVertical(jint *dstPixels, jint dstw, jint dsth, jint dstscan,
+                               jint *srcPixels, jint srcw, jint srch, jint srcscan,
+                               jfloat spread, jfloat *shadowColor);
+
+void parallelConvolveHV(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                        jint *srcPixels, jint srccols, jint srcrows, jint scolinc, jint srowinc,
+                        jfloat *kvals, jint kernelSize);
+void parallelConvolveShadowHV(jint *dstPixels, jint dstcols, jint dstrows, jint dcolinc, jint drowinc,
+                              jint *srcPixels, jint srccols, jint srcrows, jint scolinc, jint srowinc,
+                              jfloat *kvals, jint kernelSize, jint *shadowRGBs);
+
+#endif /* _Included_SSEParallel */
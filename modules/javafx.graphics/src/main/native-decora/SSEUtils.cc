@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -24,6 +24,8 @@
  */
 
 #include "SSEUtils.h"
+#include "SSEKernels.h"
+#include "SSEParallel.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSERendererDelegate.h"
 
 #ifdef WIN32 /* WIN32 */
@@ -43,6 +45,20 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSERendererDelegate_isSupported
 #endif
 }
 
+JNIEXPORT jint JNICALL
+Java_com_sun_scenario_effect_impl_sw_sse_SSERendererDelegate_selectKernels
+    (JNIEnv *env, jclass klass, jint maxLevel)
+{
+    return selectDecoraKernels(maxLevel);
+}
+
+JNIEXPORT jint JNICALL
+Java_com_sun_scenario_effect_impl_sw_sse_SSERendererDelegate_setThreads
+    (JNIEnv *env, jclass klass, jint threads)
+{
+    return setDecoraThreads(threads);
+}
+
 static void laccum(jint pixel, jfloat mul, jfloat *fvals) {
     mul /= 255.f;
     fvals[FVAL_R] += ((pixel >> 16) & 0xff) * mul;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1954,6 +1954,129 @@ fail:
     return SUCCEEDED(hr) ? (jlong)result : NULL;
 }
 
+/* Composite operations, rendering the glyph masks of many glyphs per call */
+#define GLYPH_MASK_OFFSET com_sun_javafx_font_directwrite_OS_GLYPH_MASK_OFFSET
+#define GLYPH_MASK_LEFT com_sun_javafx_font_directwrite_OS_GLYPH_MASK_LEFT
+#define GLYPH_MASK_TOP com_sun_javafx_font_directwrite_OS_GLYPH_MASK_TOP
+#define GLYPH_MASK_RIGHT com_sun_javafx_font_directwrite_OS_GLYPH_MASK_RIGHT
+#define GLYPH_MASK_BOTTOM com_sun_javafx_font_directwrite_OS_GLYPH_MASK_BOTTOM
+#define GLYPH_MASK_SIZE com_sun_javafx_font_directwrite_OS_GLYPH_MASK_SIZE
+
+/* The space left between the glyphs drawn by DrawGlyphMasks() */
+#define GLYPH_MASK_GAP 2
+
+static void initGlyphMaskRun(DWRITE_GLYPH_RUN *run, IDWriteFontFace *fontFace, FLOAT fontEmSize,
+                             UINT16 *glyphIndex, FLOAT *glyphAdvance, DWRITE_GLYPH_OFFSET *glyphOffset)
+{
+    *glyphAdvance = 0;
+    glyphOffset->advanceOffset = 0;
+    glyphOffset->ascenderOffset = 0;
+    run->fontFace = fontFace;
+    run->fontEmSize = fontEmSize;
+    run->glyphCount = 1;
+    run->glyphIndices = glyphIndex;
+    run->glyphAdvances = glyphAdvance;
+    run->glyphOffsets = glyphOffset;
+    run->isSideways = FALSE;
+    run->bidiLevel = 0;
+}
+
+static BOOL checkGlyphMaskArgs(JNIEnv *env, jintArray glyphIndices, jfloatArray origins,
+                               jint count, jobject buffer, jintArray info)
+{
+    if (!glyphIndices || !origins || !buffer || !info || count <= 0) return FALSE;
+    if (env->GetArrayLength(glyphIndices) < count) return FALSE;
+    if (env->GetArrayLength(origins) / 2 < count) return FALSE;
+    if (env->GetArrayLength(info) / GLYPH_MASK_SIZE < count) return FALSE;
+    return TRUE;
+}
+
+static void setGlyphMaskInfo(jint *info, jint offset, RECT *rect)
+{
+    info[GLYPH_MASK_OFFSET] = offset;
+    info[GLYPH_MASK_LEFT] = rect->left;
+    info[GLYPH_MASK_TOP] = rect->top;
+    info[GLYPH_MASK_RIGHT] = rect->right;
+    info[GLYPH_MASK_BOTTOM] = rect->bottom;
+}
+
+JNIEXPORT jint JNICALL OS_NATIVE(CreateAlphaTextures)
+    (JNIEnv *env, jclass that, jlong arg0, jlong arg1, jfloat arg2, jintArray arg3, jfloatArray arg4,
+     jint arg5, jobject arg6, jint arg7, jint arg8, jint arg9, jobject arg10, jintArray arg11)
+{
+    jint done = 0;
+    jint *lparg3 = NULL, *lparg11 = NULL;
+    jfloat *lparg4 = NULL;
+    DWRITE_MATRIX _arg6, *lparg6 = NULL;
+    BYTE *buffer = NULL;
+    jlong capacity = 0, used = 0;
+    UINT16 glyphIndex;
+    FLOAT glyphAdvance;
+    DWRITE_GLYPH_OFFSET glyphOffset;
+    DWRITE_GLYPH_RUN run;
+    DWRITE_TEXTURE_TYPE textureType = (DWRITE_TEXTURE_TYPE)arg9;
+    UINT32 bpp = textureType == DWRITE_TEXTURE_CLEARTYPE_3x1 ? 3 : 1;
+
+    if (!arg0 || !arg1) return 0;
+    if (!checkGlyphMaskArgs(env, arg3, arg4, arg5, arg10, arg11)) return 0;
+    buffer = (BYTE *)env->GetDirectBufferAddress(arg10);
+    capacity = env->GetDirectBufferCapacity(arg10);
+    if (!buffer || capacity <= 0) return 0;
+    if (arg6) if ((lparg6 = getDWRITE_MATRIXFields(env, arg6, &_arg6)) == NULL) goto fail;
+    if ((lparg3 = env->GetIntArrayElements(arg3, NULL)) == NULL) goto fail;
+    if ((lparg4 = env->GetFloatArrayElements(arg4, NULL)) == NULL) goto fail;
+    if ((lparg11 = env->GetIntArrayElements(arg11, NULL)) == NULL) goto fail;
+
+    initGlyphMaskRun(&run, (IDWriteFontFace *)arg1, (FLOAT)arg2, &glyphIndex, &glyphAdvance, &glyphOffset);
+    for (; done < arg5; done++) {
+        jint *info = lparg11 + done * GLYPH_MASK_SIZE;
+        IDWriteGlyphRunAnalysis *analysis = NULL;
+        RECT rect = {0, 0, 0, 0};
+        setGlyphMaskInfo(info, -1, &rect);
+
+        /* The analysis gives both the bounds and the texture of the glyph */
+        glyphIndex = (UINT16)lparg3[done];
+        HRESULT hr = ((IDWriteFactory *)arg0)->CreateGlyphRunAnalysis(&run,
+                                                                      1,
+                                                                      lparg6,
+                                                                      (DWRITE_RENDERING_MODE)arg7,
+                                                                      (DWRITE_MEASURING_MODE)arg8,
+                                                                      lparg4[done * 2],
+                                                                      lparg4[done * 2 + 1],
+                                                                      &analysis);
+        if (SUCCEEDED(hr)) {
+            hr = analysis->GetAlphaTextureBounds(textureType, &rect);
+        }
+        if (SUCCEEDED(hr) && rect.right > rect.left && rect.bottom > rect.top) {
+            UINT32 width = rect.right - rect.left;
+            UINT32 height = rect.bottom - rect.top;
+            if (height <= UINT32_MAX / bpp && width <= UINT32_MAX / (height * bpp)) {
+                UINT32 size = width * height * bpp;
+                if (size > capacity - used) {
+                    if (used > 0) {
+                        /* Full, the caller calls again for the rest */
+                        analysis->Release();
+                        break;
+                    }
+                } else {
+                    hr = analysis->CreateAlphaTexture(textureType, &rect, buffer + used, size);
+                    if (SUCCEEDED(hr)) {
+                        setGlyphMaskInfo(info, (jint)used, &rect);
+                        used += size;
+                    }
+                }
+            }
+        }
+        if (analysis) analysis->Release();
+    }
+
+fail:
+    if (lparg11) env->ReleaseIntArrayElements(arg11, lparg11, 0);
+    if (lparg4) env->ReleaseFloatArrayElements(arg4, lparg4, JNI_ABORT);
+    if (lparg3) env->ReleaseIntArrayElements(arg3, lparg3, JNI_ABORT);
+    return done;
+}
+
 /* IDWriteFontFile */
 JNIEXPORT jint JNICALL OS_NATIVE(Analyze)
     (JNIEnv *env, jclass that, jlong arg0, jbooleanArray arg1, jintArray arg2, jintArray arg3, jintArray arg4)
@@ -2501,4 +2624,153 @@ fail:
     return SUCCEEDED(hr) ? (jlong)result : NULL;
 }
 
+JNIEXPORT jint JNICALL OS_NATIVE(DrawGlyphMasks)
+    (JNIEnv *env, jclass that, jlong arg0, jlong arg1, jint arg2, jint arg3, jlong arg4, jlong arg5,
+     jfloat arg6, jintArray arg7, jfloatArray arg8, jint arg9, jobject arg10, jint arg11, jint arg12,
+     jobject arg13, jintArray arg14)
+{
+    HRESULT hr = S_OK;
+    jint done = 0, placed = 0;
+    jint *lparg7 = NULL, *lparg14 = NULL;
+    jfloat *lparg8 = NULL;
+    DWRITE_MATRIX _arg10, *lparg10 = NULL;
+    BYTE *buffer = NULL;
+    jlong capacity = 0, used = 0;
+    jint *cells = NULL;
+    jint cellX = 0, cellY = 0, shelfHeight = 0, bottom = 0;
+    UINT16 glyphIndex;
+    FLOAT glyphAdvance;
+    DWRITE_GLYPH_OFFSET glyphOffset;
+    DWRITE_GLYPH_RUN run;
+    ID2D1RenderTarget *target = (ID2D1RenderTarget *)arg0;
+    ID2D1SolidColorBrush *brush = NULL;
+    IWICBitmapLock *lock = NULL;
+
+    if (!arg0 || !arg1 || !arg4 || !arg5 || arg2 <= 0 || arg3 <= 0) return 0;
+    if (!checkGlyphMaskArgs(env, arg7, arg8, arg9, arg13, arg14)) return 0;
+    buffer = (BYTE *)env->GetDirectBufferAddress(arg13);
+    capacity = env->GetDirectBufferCapacity(arg13);
+    if (!buffer || capacity <= 0) return 0;
+    if (arg10) if ((lparg10 = getDWRITE_MATRIXFields(env, arg10, &_arg10)) == NULL) goto fail;
+    if ((cells = new (std::nothrow) jint[arg9 * 2]) == NULL) goto fail;
+    if ((lparg7 = env->GetIntArrayElements(arg7, NULL)) == NULL) goto fail;
+    if ((lparg8 = env->GetFloatArrayElements(arg8, NULL)) == NULL) goto fail;
+    if ((lparg14 = env->GetIntArrayElements(arg14, NULL)) == NULL) goto fail;
+
+    /* Compute the bounds the same way as DWGlyph.checkBounds() and place
+     * the glyphs in rows in the bitmap. */
+    initGlyphMaskRun(&run, (IDWriteFontFace *)arg5, (FLOAT)arg6, &glyphIndex, &glyphAdvance, &glyphOffset);
+    for (; done < arg9; done++) {
+        jint *info = lparg14 + done * GLYPH_MASK_SIZE;
+        IDWriteGlyphRunAnalysis *analysis = NULL;
+        RECT rect = {0, 0, 0, 0};
+        setGlyphMaskInfo(info, -1, &rect);
+
+        glyphIndex = (UINT16)lparg7[done];
+        hr = ((IDWriteFactory *)arg4)->CreateGlyphRunAnalysis(&run,
+                                                              1,
+                                                              lparg10,
+                                                              (DWRITE_RENDERING_MODE)arg11,
+                                                              (DWRITE_MEASURING_MODE)arg12,
+                                                              0, 0,
+                                                              &analysis);
+        if (SUCCEEDED(hr)) {
+            hr = analysis->GetAlphaTextureBounds(DWRITE_TEXTURE_CLEARTYPE_3x1, &rect);
+            if (SUCCEEDED(hr) && (rect.right - rect.left == 0 || rect.bottom - rect.top == 0)) {
+                hr = analysis->GetAlphaTextureBounds(DWRITE_TEXTURE_ALIASED_1x1, &rect);
+            }
+            analysis->Release();
+        }
+        if (FAILED(hr)) continue;
+        rect.left--;
+        rect.top--;
+        rect.right++;
+        rect.bottom++;
+        jint width = rect.right - rect.left;
+        jint height = rect.bottom - rect.top;
+        if (width <= 0 || height <= 0 || width > arg2 || height > arg3) continue;
+        if (cellX + width > arg2) {
+            cellX = 0;
+            cellY += shelfHeight + GLYPH_MASK_GAP;
+            shelfHeight = 0;
+        }
+        if (cellY + height > arg3 || width * height > capacity - used) {
+            if (placed > 0) break;
+            continue;
+        }
+        cells[done * 2] = cellX;
+        cells[done * 2 + 1] = cellY;
+        setGlyphMaskInfo(info, (jint)used, &rect);
+        used += width * height;
+        cellX += width + GLYPH_MASK_GAP;
+        if (height > shelfHeight) shelfHeight = height;
+        if (cellY + height > bottom) bottom = cellY + height;
+        placed++;
+    }
+    hr = S_OK;
+    if (placed == 0) goto fail;
+
+    {
+        D2D1_COLOR_F white = {1, 1, 1, 1};
+        D2D1_COLOR_F black = {0, 0, 0, 1};
+        hr = target->CreateSolidColorBrush(black, &brush);
+        if (FAILED(hr)) goto fail;
+        target->BeginDraw();
+        target->SetTextAntialiasMode(D2D1_TEXT_ANTIALIAS_MODE_GRAYSCALE);
+        target->SetTransform(D2D1::Matrix3x2F::Identity());
+        target->Clear(&white);
+        for (jint i = 0; i < done; i++) {
+            jint *info = lparg14 + i * GLYPH_MASK_SIZE;
+            if (info[GLYPH_MASK_OFFSET] < 0) continue;
+            /* Same as DWGlyph.getD2DMask(), moved to the cell of the glyph */
+            FLOAT dx = cells[i * 2] - info[GLYPH_MASK_LEFT] + lparg8[i * 2];
+            FLOAT dy = cells[i * 2 + 1] - info[GLYPH_MASK_TOP] + lparg8[i * 2 + 1];
+            D2D1_POINT_2F pt = {dx, dy};
+            if (lparg10) {
+                D2D1_MATRIX_3X2_F transform = D2D1::Matrix3x2F(lparg10->m11, lparg10->m12,
+                                                               lparg10->m21, lparg10->m22,
+                                                               dx, dy);
+                target->SetTransform(&transform);
+                pt.x = pt.y = 0;
+            }
+            glyphIndex = (UINT16)lparg7[i];
+            target->DrawGlyphRun(pt, &run, brush, (DWRITE_MEASURING_MODE)arg12);
+        }
+        hr = target->EndDraw();
+        if (FAILED(hr)) goto fail;
+    }
+
+    {
+        const WICRect rcLock = {0, 0, arg2, bottom};
+        UINT cbBufferSize = 0, stride = 0;
+        BYTE *pv = NULL;
+        hr = ((IWICBitmap *)arg1)->Lock(&rcLock, WICBitmapLockRead, &lock);
+        if (SUCCEEDED(hr)) hr = lock->GetStride(&stride);
+        if (SUCCEEDED(hr)) hr = lock->GetDataPointer(&cbBufferSize, &pv);
+        if (FAILED(hr)) goto fail;
+        for (jint i = 0; i < done; i++) {
+            jint *info = lparg14 + i * GLYPH_MASK_SIZE;
+            if (info[GLYPH_MASK_OFFSET] < 0) continue;
+            jint width = info[GLYPH_MASK_RIGHT] - info[GLYPH_MASK_LEFT];
+            jint height = info[GLYPH_MASK_BOTTOM] - info[GLYPH_MASK_TOP];
+            BYTE *dst = buffer + info[GLYPH_MASK_OFFSET];
+            for (jint y = 0; y < height; y++) {
+                BYTE *row = pv + (cells[i * 2 + 1] + y) * stride + cells[i * 2] * 4;
+                for (jint x = 0; x < width; x++) {
+                    *dst++ = 0xFF - row[x * 4];
+                }
+            }
+        }
+    }
+
+fail:
+    if (lock) lock->Release();
+    if (brush) brush->Release();
+    if (lparg14) env->ReleaseIntArrayElements(arg14, lparg14, 0);
+    if (lparg8) env->ReleaseFloatArrayElements(arg8, lparg8, JNI_ABORT);
+    if (lparg7) env->ReleaseIntArrayElements(arg7, lparg7, JNI_ABORT);
+    delete [] cells;
+    return FAILED(hr) ? (jint)hr : done;
+}
+
 #endif /* WIN32 */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -397,6 +397,68 @@ JNIEXPORT jbyteArray JNICALL OS_NATIVE(getBitmapData)(JNIEnv *env, jclass that,
     return result;
 }
 
+#define GM(field) com_sun_javafx_font_freetype_OSFreetype_GLYPH_METRICS_##field
+
+/*
+ * Loads and renders glyphs one after the other, writing their bitmaps,
+ * without row padding, to pixels and their metrics to metrics. Stops when
+ * pixels is full and returns the number of glyphs done.
+ */
+JNIEXPORT jint JNICALL OS_NATIVE(rasterizeGlyphs)
+    (JNIEnv *env, jclass that, jlong facePtr, jintArray glyphCodes, jint count,
+     jint loadFlags, jobject pixels, jintArray metrics)
+{
+    jint *lpCodes = NULL;
+    jint *lpMetrics = NULL;
+    jint done = 0;
+    if (!facePtr || !glyphCodes || !metrics || count <= 0) return 0;
+    unsigned char* dst = (*env)->GetDirectBufferAddress(env, pixels);
+    jlong capacity = (*env)->GetDirectBufferCapacity(env, pixels);
+    if (!dst || capacity <= 0) return 0;
+    if ((*env)->GetArrayLength(env, glyphCodes) < count) return 0;
+    if ((*env)->GetArrayLength(env, metrics) < count * GM(SIZE)) return 0;
+    if ((lpCodes = (*env)->GetIntArrayElements(env, glyphCodes, NULL)) == NULL) goto fail;
+    if ((lpMetrics = (*env)->GetIntArrayElements(env, metrics, NULL)) == NULL) goto fail;
+
+    FT_Face face = (FT_Face)facePtr;
+    jlong offset = 0;
+    for (; done < count; done++) {
+        jint* m = lpMetrics + done * GM(SIZE);
+        m[GM(OFFSET)] = -1;
+        if (FT_Load_Glyph(face, (FT_UInt)lpCodes[done], (FT_Int32)loadFlags) != 0) continue;
+        FT_GlyphSlot slot = face->glyph;
+        FT_Bitmap* bitmap = &slot->bitmap;
+        /* Only FT_RENDER_MODE_NORMAL and FT_RENDER_MODE_LCD are requested */
+        if (bitmap->pixel_mode != FT_PIXEL_MODE_GRAY &&
+            bitmap->pixel_mode != FT_PIXEL_MODE_LCD) continue;
+        int width = bitmap->width;
+        int rows = bitmap->rows;
+        jlong size = (jlong)width * rows;
+        if (size > 0) {
+            if (!bitmap->buffer || bitmap->pitch < width) continue;
+            if (offset + size > capacity) break;
+            unsigned char* src = bitmap->buffer;
+            for (int y = 0; y < rows; y++) {
+                memcpy(dst + offset + (jlong)y * width, src, width);
+                src += bitmap->pitch;
+            }
+        }
+        m[GM(OFFSET)] = (jint)offset;
+        m[GM(WIDTH)] = width;
+        m[GM(ROWS)] = rows;
+        m[GM(LEFT)] = slot->bitmap_left;
+        m[GM(TOP)] = slot->bitmap_top;
+        m[GM(ADVANCE_X)] = (jint)slot->advance.x;
+        m[GM(ADVANCE_Y)] = (jint)slot->advance.y;
+        m[GM(LINEAR_ADVANCE)] = (jint)slot->linearHoriAdvance;
+        offset += size;
+    }
+fail:
+    if (lpMetrics) (*env)->ReleaseIntArrayElements(env, metrics, lpMetrics, 0);
+    if (lpCodes) (*env)->ReleaseIntArrayElements(env, glyphCodes, lpCodes, JNI_ABORT);
+    return done;
+}
+
 JNIEXPORT void JNICALL OS_NATIVE(FT_1Set_1Transform)
     (JNIEnv *env, jclass that, jlong arg0, jobject arg1, jlong arg2, jlong arg3)
 {
@@ -492,8 +554,8 @@ JNIEXPORT jint JNICALL OS_NATIVE(FT_1Set_1Char_1Size)
 /***********************************************/
 
 #define F26DOT6TOFLOAT(n) (float)n/64.0;
-static const size_t DEFAULT_LEN_TYPES = 10;
-static const size_t DEFAULT_LEN_COORDS = 50;
+static const size_t DEFAULT_LEN_TYPES = 16;
+static const size_t DEFAULT_LEN_COORDS = 64;
 typedef struct _PathData {
     jbyte* pointTypes;
     size_t numTypes;
@@ -503,13 +565,14 @@ typedef struct _PathData {
     size_t lenCoords;
 } PathData;
 
+/* The arrays grow geometrically, they are reused from glyph to glyph */
 static PathData* checkSize(void* user, int coordCount)
 {
     PathData* info = (PathData *)user;
 
     if (info->numTypes == info->lenTypes) {
-        if (info->lenTypes > SIZE_MAX - DEFAULT_LEN_TYPES) goto fail;
-        info->lenTypes += DEFAULT_LEN_TYPES;
+        if (info->lenTypes > SIZE_MAX / 2) goto fail;
+        info->lenTypes *= 2;
 
         jbyte* newPointTypes = (jbyte*)realloc(info->pointTypes, info->lenTypes * sizeof(jbyte));
         if (newPointTypes == NULL) goto fail;
@@ -517,10 +580,10 @@ static PathData* checkSize(void* user, int coordCount)
     }
 
     if (info->numCoords + (coordCount * 2) > info->lenCoords) {
-        if (info->lenCoords > SIZE_MAX - DEFAULT_LEN_COORDS) goto fail;
-        info->lenCoords += DEFAULT_LEN_COORDS;
+        if (info->lenCoords > SIZE_MAX / (2 * sizeof(jfloat))) goto fail;
+        info->lenCoords *= 2;
 
-        jbyte* newPointCoords = (jfloat*)realloc(info->pointCoords, info->lenCoords * sizeof(jfloat));
+        jfloat* newPointCoords = (jfloat*)realloc(info->pointCoords, info->lenCoords * sizeof(jfloat));
         if (newPointCoords == NULL) goto fail;
         info->pointCoords = newPointCoords;
     }
@@ -530,6 +593,7 @@ static PathData* checkSize(void* user, int coordCount)
 fail:
     SAFE_FREE(info->pointTypes);
     SAFE_FREE(info->pointCoords);
+    info->lenTypes = info->lenCoords = 0;
     return NULL;
 }
 
@@ -603,75 +667,157 @@ static const  FT_Outline_Funcs JFX_Outline_Funcs =
     0, 0
 };
 
-JNIEXPORT jobject JNICALL OS_NATIVE(FT_1Outline_1Decompose)
-    (JNIEnv *env, jclass that, jlong arg0)
+/*
+ * Decomposed outlines are cached per face, keyed by glyph code and size.
+ * The cache is direct mapped, a new outline replaces the one in its entry,
+ * and it is freed with the face through its generic finalizer.
+ */
+#define OUTLINE_CACHE_SIZE 512
+
+typedef struct _OutlineEntry {
+    FT_UInt glyph;
+    FT_F26Dot6 size;
+    jbyte* pointTypes;      /* NULL if the entry is empty */
+    size_t numTypes;
+    jfloat* pointCoords;
+    size_t numCoords;
+} OutlineEntry;
+
+typedef struct _OutlineCache {
+    OutlineEntry entries[OUTLINE_CACHE_SIZE];
+    PathData data;
+} OutlineCache;
+
+static void freeOutlineCache(void* object)
 {
-    FT_Face face = (FT_Face)arg0;
-    if (face == NULL) return NULL;
+    FT_Face face = (FT_Face)object;
+    OutlineCache* cache = (OutlineCache*)face->generic.data;
+    if (cache == NULL) return;
+    for (int i = 0; i < OUTLINE_CACHE_SIZE; i++) {
+        SAFE_FREE(cache->entries[i].pointTypes);
+        SAFE_FREE(cache->entries[i].pointCoords);
+    }
+    SAFE_FREE(cache->data.pointTypes);
+    SAFE_FREE(cache->data.pointCoords);
+    free(cache);
+    face->generic.data = NULL;
+}
+
+static OutlineCache* getOutlineCache(FT_Face face)
+{
+    OutlineCache* cache = (OutlineCache*)face->generic.data;
+    if (cache == NULL && face->generic.finalizer == NULL) {
+        cache = (OutlineCache*)calloc(1, sizeof(OutlineCache));
+        if (cache == NULL) return NULL;
+        face->generic.data = cache;
+        face->generic.finalizer = freeOutlineCache;
+    }
+    return cache;
+}
+
+static OutlineEntry* getOutline(FT_Face face, OutlineCache* cache, FT_UInt glyph,
+                                FT_F26Dot6 size, FT_Int32 loadFlags, FT_F26Dot6* faceSize)
+{
+    OutlineEntry* entry = &cache->entries[((size_t)glyph * 31 + (size_t)size) % OUTLINE_CACHE_SIZE];
+    if (entry->pointTypes != NULL && entry->glyph == glyph && entry->size == size) {
+        return entry;
+    }
+
+    if (*faceSize != size) {
+        if (FT_Set_Char_Size(face, 0, size, 72, 72) != FT_Err_Ok) return NULL;
+        *faceSize = size;
+    }
+    if (FT_Load_Glyph(face, glyph, loadFlags) != FT_Err_Ok) return NULL;
     FT_GlyphSlot slot = face->glyph;
     if (slot == NULL) return NULL;
-    FT_Outline* outline = &slot->outline;
-    if (outline == NULL) return NULL;
 
-    jobject path2D = NULL;
-    PathData data;
-    data.pointTypes = (jbyte*)malloc(sizeof(jbyte) * DEFAULT_LEN_TYPES);
-    data.numTypes = 0;
-    data.lenTypes = DEFAULT_LEN_TYPES;
-    if (data.pointTypes == NULL) goto fail;
-
-    data.pointCoords = (jfloat*)malloc(sizeof(jfloat) * DEFAULT_LEN_COORDS);
-    data.numCoords = 0;
-    data.lenCoords = DEFAULT_LEN_COORDS;
-    if (data.pointCoords == NULL) goto fail;
-
-    /* Decompose outline */
-    FT_Error ftError = FT_Outline_Decompose(outline, &JFX_Outline_Funcs, &data);
-    if (ftError != FT_Err_Ok) goto fail;
-
-    static jclass path2DClass = NULL;
-    static jmethodID path2DCtr = NULL;
-    if (path2DClass == NULL) {
-        jclass tmpClass = (*env)->FindClass(env, "com/sun/javafx/geom/Path2D");
-        if ((*env)->ExceptionOccurred(env) || !tmpClass) {
-            fprintf(stderr, "OS_NATIVE error: JNI exception or tmpClass == NULL");
-            goto fail;
-        }
-        path2DClass = (jclass)(*env)->NewGlobalRef(env, tmpClass);
-        path2DCtr = (*env)->GetMethodID(env, path2DClass, "<init>", "(I[BI[FI)V");
-        if ((*env)->ExceptionOccurred(env) || !path2DCtr) {
-            fprintf(stderr, "OS_NATIVE error: JNI exception or path2DCtr == NULL");
-            goto fail;
+    PathData* data = &cache->data;
+    if (data->pointTypes == NULL) {
+        data->pointTypes = (jbyte*)malloc(sizeof(jbyte) * DEFAULT_LEN_TYPES);
+        data->lenTypes = DEFAULT_LEN_TYPES;
+        data->pointCoords = (jfloat*)malloc(sizeof(jfloat) * DEFAULT_LEN_COORDS);
+        data->lenCoords = DEFAULT_LEN_COORDS;
+        if (data->pointTypes == NULL || data->pointCoords == NULL) {
+            SAFE_FREE(data->pointTypes);
+            SAFE_FREE(data->pointCoords);
+            return NULL;
         }
     }
+    data->numTypes = 0;
+    data->numCoords = 0;
+    if (FT_Outline_Decompose(&slot->outline, &JFX_Outline_Funcs, data) != FT_Err_Ok) return NULL;
+
+    /* Keep exact copies, an empty outline still gets one type byte */
+    jbyte* types = (jbyte*)malloc(data->numTypes + 1);
+    jfloat* coords = (jfloat*)malloc(data->numCoords * sizeof(jfloat) + 1);
+    if (types == NULL || coords == NULL) {
+        SAFE_FREE(types);
+        SAFE_FREE(coords);
+        return NULL;
+    }
+    memcpy(types, data->pointTypes, data->numTypes);
+    memcpy(coords, data->pointCoords, data->numCoords * sizeof(jfloat));
+    SAFE_FREE(entry->pointTypes);
+    SAFE_FREE(entry->pointCoords);
+    entry->glyph = glyph;
+    entry->size = size;
+    entry->pointTypes = types;
+    entry->numTypes = data->numTypes;
+    entry->pointCoords = coords;
+    entry->numCoords = data->numCoords;
+    return entry;
+}
 
-    jbyteArray types = (*env)->NewByteArray(env, data.numTypes);
-    jfloatArray coords = (*env)->NewFloatArray(env, data.numCoords);
-    if (types && coords) {
-        (*env)->SetByteArrayRegion(env, types, 0, data.numTypes, data.pointTypes);
-        if ((*env)->ExceptionOccurred(env)) {
-            fprintf(stderr, "OS_NATIVE error: JNI exception");
-            goto fail;
-        }
-        (*env)->SetFloatArrayRegion(env, coords, 0, data.numCoords, data.pointCoords);
-        if ((*env)->ExceptionOccurred(env)) {
-            fprintf(stderr, "OS_NATIVE error: JNI exception");
-            goto fail;
-        }
-        path2D = (*env)->NewObject(env, path2DClass, path2DCtr,
-                                   0 /*winding rule*/,
-                                   types, data.numTypes,
-                                   coords, data.numCoords);
-        if ((*env)->ExceptionOccurred(env) || !path2D) {
-            fprintf(stderr, "OS_NATIVE error: JNI exception or path2D == NULL");
-            goto fail;
-        }
-    }
+#define OI(field) com_sun_javafx_font_freetype_OSFreetype_OUTLINE_INFO_##field
 
+/*
+ * Writes the outlines of glyphs one after the other to paths: for each
+ * glyph its coordinates as floats, then its segment types as bytes padded
+ * to a multiple of four. The positions and lengths go to info. Stops when
+ * paths is full and returns the number of glyphs done.
+ */
+JNIEXPORT jint JNICALL OS_NATIVE(decomposeOutlines)
+    (JNIEnv *env, jclass that, jlong facePtr, jintArray glyphCodes, jint count,
+     jlong size, jint loadFlags, jobject paths, jintArray info)
+{
+    jint *lpCodes = NULL;
+    jint *lpInfo = NULL;
+    jint done = 0;
+    if (!facePtr || !glyphCodes || !info || count <= 0) return 0;
+    unsigned char* dst = (*env)->GetDirectBufferAddress(env, paths);
+    jlong capacity = (*env)->GetDirectBufferCapacity(env, paths);
+    if (!dst || capacity <= 0) return 0;
+    if ((*env)->GetArrayLength(env, glyphCodes) < count) return 0;
+    if ((*env)->GetArrayLength(env, info) < count * OI(SIZE)) return 0;
+    if ((lpCodes = (*env)->GetIntArrayElements(env, glyphCodes, NULL)) == NULL) goto fail;
+    if ((lpInfo = (*env)->GetIntArrayElements(env, info, NULL)) == NULL) goto fail;
+
+    FT_Face face = (FT_Face)facePtr;
+    OutlineCache* cache = getOutlineCache(face);
+    if (cache == NULL) goto fail;
+    FT_F26Dot6 faceSize = -1;
+    jlong offset = 0;
+    for (; done < count; done++) {
+        jint* m = lpInfo + done * OI(SIZE);
+        m[OI(COORDS_OFFSET)] = -1;
+        OutlineEntry* entry = getOutline(face, cache, (FT_UInt)lpCodes[done],
+                                         (FT_F26Dot6)size, (FT_Int32)loadFlags, &faceSize);
+        if (entry == NULL) continue;
+        jlong coordsSize = entry->numCoords * sizeof(jfloat);
+        jlong typesSize = (entry->numTypes + 3) & ~3;
+        if (offset + coordsSize + typesSize > capacity) break;
+        memcpy(dst + offset, entry->pointCoords, coordsSize);
+        memcpy(dst + offset + coordsSize, entry->pointTypes, entry->numTypes);
+        m[OI(COORDS_OFFSET)] = (jint)offset;
+        m[OI(NUM_COORDS)] = (jint)entry->numCoords;
+        m[OI(TYPES_OFFSET)] = (jint)(offset + coordsSize);
+        m[OI(NUM_TYPES)] = (jint)entry->numTypes;
+        offset += coordsSize + typesSize;
+    }
 fail:
-    SAFE_FREE(data.pointTypes);
-    SAFE_FREE(data.pointCoords);
-    return path2D;
+    if (lpInfo) (*env)->ReleaseIntArrayElements(env, info, lpInfo, 0);
+    if (lpCodes) (*env)->ReleaseIntArrayElements(env, glyphCodes, lpCodes, JNI_ABORT);
+    return done;
 }
 
 JNIEXPORT jboolean JNICALL JNICALL OS_NATIVE(isPangoEnabled)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@
 #include <pango/pango.h>
 #include <pango/pangoft2.h>
 #include <dlfcn.h>
+#include <string.h>
 
 #ifdef STATIC_BUILD
 JNIEXPORT jint JNICALL
@@ -150,64 +151,31 @@ void cachePangoGlyphStringFields(JNIEnv *env)
 
 /** Custom **/
 
-JNIEXPORT jobject JNICALL OS_NATIVE(pango_1shape)
-    (JNIEnv *env, jclass that, jlong str, jlong pangoItem)
+/* Creates a PangoGlyphString Java object, returns NULL on failure */
+static jobject newPangoGlyphString(JNIEnv *env, int count, const jint *glyphs,
+                                   const jint *widths, const jint *cluster,
+                                   jint offset, jint length, jint num_chars,
+                                   PangoFont *font)
 {
-    if (!str) return NULL;
-    if (!pangoItem) return NULL;
-    PangoItem *item = (PangoItem *)pangoItem;
-    PangoAnalysis analysis = item->analysis;
-    if (!pangoItem) return NULL;
-    const gchar *text= (const gchar *)(str + item->offset);
-    PangoGlyphString *glyphString = pango_glyph_string_new();
-    if (!glyphString) return NULL;
-
     jobject result = NULL;
-    pango_shape(text, item->length, &analysis, glyphString);
-    int count = glyphString->num_glyphs;
-    jint *glyphs = NULL;
-    jint *widths = NULL;
-    jint *cluster = NULL;
-    if (count <= 0) goto fail;
-    if ((size_t)count >= INT_MAX / sizeof(jint)) {
-        fprintf(stderr, "OS_NATIVE error: large glyph count value in pango_1shape\n");
-        goto fail;
-    }
-
     jintArray glyphsArray = (*env)->NewIntArray(env, count);
     jintArray widthsArray = (*env)->NewIntArray(env, count);
     jintArray clusterArray = (*env)->NewIntArray(env, count);
     if (glyphsArray && widthsArray && clusterArray) {
-        glyphs = (jint*) malloc(count * sizeof(jint));
-        widths = (jint*) malloc(count * sizeof(jint));
-        cluster = (jint*) malloc(count * sizeof(jint));
-        if (glyphs == NULL ||
-            widths == NULL ||
-            cluster == NULL) {
-            fprintf(stderr, "OS_NATIVE error: Unable to allocate memory in pango_1shape\n");
-            goto fail;
-        }
-        int i;
-        for (i = 0; i < count; i++) {
-            glyphs[i] = glyphString->glyphs[i].glyph;
-            widths[i] = glyphString->glyphs[i].geometry.width;
-            /* translate byte index to char index */
-            cluster[i] = (jint)g_utf8_pointer_to_offset(text, text + glyphString->log_clusters[i]);
-        }
         (*env)->SetIntArrayRegion(env, glyphsArray, 0, count, glyphs);
         if ((*env)->ExceptionOccurred(env)) {
             fprintf(stderr, "OS_NATIVE error: JNI exception");
-            goto fail;
+            return NULL;
         }
         (*env)->SetIntArrayRegion(env, widthsArray, 0, count, widths);
         if ((*env)->ExceptionOccurred(env)) {
             fprintf(stderr, "OS_NATIVE error: JNI exception");
-            goto fail;
+            return NULL;
         }
         (*env)->SetIntArrayRegion(env, clusterArray, 0, count, cluster);
         if ((*env)->ExceptionOccurred(env)) {
             fprintf(stderr, "OS_NATIVE error: JNI exception");
-            goto fail;
+            return NULL;
         }
         if (!PangoGlyphStringFc.cached) cachePangoGlyphStringFields(env);
         result = (*env)->NewObject(env, PangoGlyphStringFc.clazz, PangoGlyphStringFc.init);
@@ -216,12 +184,58 @@ JNIEXPORT jobject JNICALL OS_NATIVE(pango_1shape)
             (*env)->SetObjectField(env, result, PangoGlyphStringFc.glyphs, glyphsArray);
             (*env)->SetObjectField(env, result, PangoGlyphStringFc.widths, widthsArray);
             (*env)->SetObjectField(env, result, PangoGlyphStringFc.log_clusters, clusterArray);
-            (*env)->SetIntField(env, result, PangoGlyphStringFc.offset, item->offset);
-            (*env)->SetIntField(env, result, PangoGlyphStringFc.length, item->length);
-            (*env)->SetIntField(env, result, PangoGlyphStringFc.num_chars, item->num_chars);
-            (*env)->SetLongField(env, result, PangoGlyphStringFc.font, (jlong)analysis.font);
+            (*env)->SetIntField(env, result, PangoGlyphStringFc.offset, offset);
+            (*env)->SetIntField(env, result, PangoGlyphStringFc.length, length);
+            (*env)->SetIntField(env, result, PangoGlyphStringFc.num_chars, num_chars);
+            (*env)->SetLongField(env, result, PangoGlyphStringFc.font, (jlong)font);
         }
     }
+    return result;
+}
+
+JNIEXPORT jobject JNICALL OS_NATIVE(pango_1shape)
+    (JNIEnv *env, jclass that, jlong str, jlong pangoItem)
+{
+    if (!str) return NULL;
+    if (!pangoItem) return NULL;
+    PangoItem *item = (PangoItem *)pangoItem;
+    PangoAnalysis analysis = item->analysis;
+    if (!pangoItem) return NULL;
+    const gchar *text= (const gchar *)(str + item->offset);
+    PangoGlyphString *glyphString = pango_glyph_string_new();
+    if (!glyphString) return NULL;
+
+    jobject result = NULL;
+    pango_shape(text, item->length, &analysis, glyphString);
+    int count = glyphString->num_glyphs;
+    jint *glyphs = NULL;
+    jint *widths = NULL;
+    jint *cluster = NULL;
+    if (count <= 0) goto fail;
+    if ((size_t)count >= INT_MAX / sizeof(jint)) {
+        fprintf(stderr, "OS_NATIVE error: large glyph count value in pango_1shape\n");
+        goto fail;
+    }
+
+    glyphs = (jint*) malloc(count * sizeof(jint));
+    widths = (jint*) malloc(count * sizeof(jint));
+    cluster = (jint*) malloc(count * sizeof(jint));
+    if (glyphs == NULL ||
+        widths == NULL ||
+        cluster == NULL) {
+        fprintf(stderr, "OS_NATIVE error: Unable to allocate memory in pango_1shape\n");
+        goto fail;
+    }
+    int i;
+    for (i = 0; i < count; i++) {
+        glyphs[i] = glyphString->glyphs[i].glyph;
+        widths[i] = glyphString->glyphs[i].geometry.width;
+        /* translate byte index to char index */
+        cluster[i] = (jint)g_utf8_pointer_to_offset(text, text + glyphString->log_clusters[i]);
+    }
+    result = newPangoGlyphString(env, count, glyphs, widths, cluster,
+                                 item->offset, item->length, item->num_chars,
+                                 analysis.font);
 
 fail:
     pango_glyph_string_free(glyphString);
@@ -231,6 +245,293 @@ fail:
     return result;
 }
 
+/*
+ * Shaping cache. Shaping a run means itemizing and shaping it with Pango,
+ * and virtualized controls show the same short strings with the same font
+ * over and over, so the results are kept in a LRU cache keyed by the font
+ * attributes and the text. Long runs are shaped but not cached.
+ */
+#define SHAPE_CACHE_MAX_ENTRIES 2048
+#define SHAPE_CACHE_MAX_GLYPHS (256 * 1024)
+#define SHAPE_CACHE_MAX_TEXT 256
+
+typedef struct ShapedItem {
+    int num_glyphs;
+    jint *glyphs;           /* glyphs, widths and log_clusters, one block */
+    jint *widths;
+    jint *log_clusters;
+    jint offset, length, num_chars;
+    PangoFont *font;        /* referenced */
+} ShapedItem;
+
+typedef struct ShapedRun {
+    guint hash;
+    gchar *family;
+    jfloat size;
+    jint style, weight;
+    jboolean rtl, fallback;
+    jchar *text;
+    jint length;
+    int item_count;
+    int glyph_count;
+    ShapedItem *items;
+    GList *link;            /* in shapeCacheLru, most recent first */
+} ShapedRun;
+
+static GMutex shapeCacheLock;
+static GHashTable *shapeCache;
+static GQueue shapeCacheLru = G_QUEUE_INIT;
+static int shapeCacheGlyphs;
+static jlong shapeCacheHits, shapeCacheMisses, shapeCacheEvictions;
+
+static guint shapedRunHash(gconstpointer key)
+{
+    return ((const ShapedRun *)key)->hash;
+}
+
+static gboolean shapedRunEqual(gconstpointer a, gconstpointer b)
+{
+    const ShapedRun *r1 = (const ShapedRun *)a;
+    const ShapedRun *r2 = (const ShapedRun *)b;
+    return r1->hash == r2->hash &&
+           r1->length == r2->length &&
+           r1->size == r2->size &&
+           r1->style == r2->style &&
+           r1->weight == r2->weight &&
+           r1->rtl == r2->rtl &&
+           r1->fallback == r2->fallback &&
+           memcmp(r1->text, r2->text, r1->length * sizeof(jchar)) == 0 &&
+           strcmp(r1->family, r2->family) == 0;
+}
+
+static guint computeShapedRunHash(const ShapedRun *run)
+{
+    guint hash = g_str_hash(run->family);
+    hash = hash * 31 + (guint)(run->size * 64);
+    hash = hash * 31 + (guint)run->style;
+    hash = hash * 31 + (guint)run->weight;
+    hash = hash * 31 + (run->rtl ? 1 : 0) + (run->fallback ? 2 : 0);
+    for (jint i = 0; i < run->length; i++) {
+        hash = hash * 31 + run->text[i];
+    }
+    return hash;
+}
+
+static void freeShapedRun(ShapedRun *run)
+{
+    if (run->items) {
+        for (int i = 0; i < run->item_count; i++) {
+            SAFE_FREE(run->items[i].glyphs);
+            if (run->items[i].font) g_object_unref(run->items[i].font);
+        }
+        free(run->items);
+    }
+    g_free(run->family);
+    SAFE_FREE(run->text);
+    free(run);
+}
+
+/* Itemizes and shapes the text of run, as PangoGlyphLayout used to do */
+static gboolean shapeRun(PangoFontMap *fontmap, ShapedRun *run)
+{
+    gboolean result = FALSE;
+    PangoContext *context = pango_font_map_create_context(fontmap);
+    PangoFontDescription *desc = pango_font_description_new();
+    PangoAttrList *attrList = pango_attr_list_new();
+    gchar *str = NULL;
+    GList *items = NULL;
+    if (!context || !desc || !attrList) goto fail;
+    if (run->rtl) {
+        pango_context_set_base_dir(context, PANGO_DIRECTION_RTL);
+    }
+    pango_font_description_set_family(desc, run->family);
+    pango_font_description_set_absolute_size(desc, run->size * PANGO_SCALE);
+    pango_font_description_set_stretch(desc, PANGO_STRETCH_NORMAL);
+    pango_font_description_set_style(desc, (PangoStyle)run->style);
+    pango_font_description_set_weight(desc, (PangoWeight)run->weight);
+    /* pango_attr_list_unref() also frees the attributes it contains */
+    pango_attr_list_insert(attrList, pango_attr_font_desc_new(desc));
+    if (!run->fallback) {
+        pango_attr_list_insert(attrList, pango_attr_fallback_new(FALSE));
+    }
+
+    glong utf8Length = 0;
+    str = g_utf16_to_utf8((const gunichar2 *)run->text, run->length, NULL, &utf8Length, NULL);
+    if (!str) goto fail;
+    items = pango_itemize(context, str, 0, (int)utf8Length, attrList, NULL);
+
+    run->item_count = g_list_length(items);
+    run->items = (ShapedItem *)calloc(run->item_count > 0 ? run->item_count : 1, sizeof(ShapedItem));
+    if (!run->items) goto fail;
+    int i = 0;
+    for (GList *l = items; l != NULL; l = l->next, i++) {
+        PangoItem *item = (PangoItem *)l->data;
+        const gchar *text = str + item->offset;
+        PangoGlyphString *glyphString = pango_glyph_string_new();
+        if (!glyphString) goto fail;
+        pango_shape(text, item->length, &item->analysis, glyphString);
+        int count = glyphString->num_glyphs;
+        ShapedItem *shaped = &run->items[i];
+        if (count > 0 && (size_t)count < INT_MAX / (3 * sizeof(jint))) {
+            shaped->glyphs = (jint *)malloc(3 * count * sizeof(jint));
+            if (!shaped->glyphs) {
+                pango_glyph_string_free(glyphString);
+                goto fail;
+            }
+            shaped->widths = shaped->glyphs + count;
+            shaped->log_clusters = shaped->widths + count;
+            for (int j = 0; j < count; j++) {
+                shaped->glyphs[j] = glyphString->glyphs[j].glyph;
+                shaped->widths[j] = glyphString->glyphs[j].geometry.width;
+                /* translate byte index to char index */
+                shaped->log_clusters[j] = (jint)g_utf8_pointer_to_offset(text, text + glyphString->log_clusters[j]);
+            }
+            shaped->num_glyphs = count;
+            run->glyph_count += count;
+        }
+        shaped->offset = item->offset;
+        shaped->length = item->length;
+        shaped->num_chars = item->num_chars;
+        shaped->font = item->analysis.font ? g_object_ref(item->analysis.font) : NULL;
+        pango_glyph_string_free(glyphString);
+    }
+    result = TRUE;
+
+fail:
+    if (items) {
+        g_list_free_full(items, (GDestroyNotify)pango_item_free);
+    }
+    g_free(str);
+    if (attrList) pango_attr_list_unref(attrList);
+    if (desc) pango_font_description_free(desc);
+    if (context) g_object_unref(context);
+    return result;
+}
+
+/* Makes room for a run of count glyphs, called with shapeCacheLock held */
+static void trimShapeCache(int count)
+{
+    while (!g_queue_is_empty(&shapeCacheLru) &&
+           (g_hash_table_size(shapeCache) >= SHAPE_CACHE_MAX_ENTRIES ||
+            shapeCacheGlyphs + count > SHAPE_CACHE_MAX_GLYPHS)) {
+        ShapedRun *oldest = (ShapedRun *)g_queue_pop_tail(&shapeCacheLru);
+        g_hash_table_remove(shapeCache, oldest);
+        shapeCacheGlyphs -= oldest->glyph_count;
+        shapeCacheEvictions++;
+        freeShapedRun(oldest);
+    }
+}
+
+static jobjectArray newPangoGlyphStrings(JNIEnv *env, ShapedRun *run)
+{
+    if (!PangoGlyphStringFc.cached) cachePangoGlyphStringFields(env);
+    if (!PangoGlyphStringFc.cached) return NULL;
+    jobjectArray result = (*env)->NewObjectArray(env, run->item_count, PangoGlyphStringFc.clazz, NULL);
+    if (!result) return NULL;
+    for (int i = 0; i < run->item_count; i++) {
+        ShapedItem *item = &run->items[i];
+        if (item->num_glyphs <= 0) continue;
+        jobject glyphString = newPangoGlyphString(env, item->num_glyphs, item->glyphs,
+                                                  item->widths, item->log_clusters,
+                                                  item->offset, item->length,
+                                                  item->num_chars, item->font);
+        if (!glyphString) return NULL;
+        (*env)->SetObjectArrayElement(env, result, i, glyphString);
+        (*env)->DeleteLocalRef(env, glyphString);
+    }
+    return result;
+}
+
+JNIEXPORT jobjectArray JNICALL OS_NATIVE(shape_1text)
+    (JNIEnv *env, jclass that, jlong fontmap, jstring family, jfloat size,
+     jint style, jint weight, jboolean rtl, jboolean fallback,
+     jcharArray text, jint start, jint length)
+{
+    if (!fontmap || !family || !text || length <= 0) return NULL;
+    ShapedRun *run = (ShapedRun *)calloc(1, sizeof(ShapedRun));
+    if (!run) return NULL;
+    const char *familyChars = (*env)->GetStringUTFChars(env, family, NULL);
+    if (!familyChars) {
+        free(run);
+        return NULL;
+    }
+    run->family = g_strdup(familyChars);
+    (*env)->ReleaseStringUTFChars(env, family, familyChars);
+    run->size = size;
+    run->style = style;
+    run->weight = weight;
+    run->rtl = rtl;
+    run->fallback = fallback;
+    run->length = length;
+    run->text = (jchar *)malloc(length * sizeof(jchar));
+    if (!run->text) {
+        freeShapedRun(run);
+        return NULL;
+    }
+    (*env)->GetCharArrayRegion(env, text, start, length, run->text);
+    if (checkAndClearException(env)) {
+        freeShapedRun(run);
+        return NULL;
+    }
+    run->hash = computeShapedRunHash(run);
+
+    jobjectArray result = NULL;
+    gboolean cacheable = length <= SHAPE_CACHE_MAX_TEXT;
+    if (cacheable) {
+        g_mutex_lock(&shapeCacheLock);
+        if (!shapeCache) {
+            shapeCache = g_hash_table_new(shapedRunHash, shapedRunEqual);
+        }
+        ShapedRun *cached = (ShapedRun *)g_hash_table_lookup(shapeCache, run);
+        if (cached) {
+            shapeCacheHits++;
+            g_queue_unlink(&shapeCacheLru, cached->link);
+            g_queue_push_head_link(&shapeCacheLru, cached->link);
+            result = newPangoGlyphStrings(env, cached);
+            g_mutex_unlock(&shapeCacheLock);
+            freeShapedRun(run);
+            return result;
+        }
+        shapeCacheMisses++;
+        g_mutex_unlock(&shapeCacheLock);
+    }
+
+    if (!shapeRun((PangoFontMap *)fontmap, run)) {
+        freeShapedRun(run);
+        return NULL;
+    }
+    result = newPangoGlyphStrings(env, run);
+
+    if (cacheable && run->glyph_count <= SHAPE_CACHE_MAX_GLYPHS) {
+        g_mutex_lock(&shapeCacheLock);
+        if (!g_hash_table_contains(shapeCache, run)) {
+            trimShapeCache(run->glyph_count);
+            g_queue_push_head(&shapeCacheLru, run);
+            run->link = shapeCacheLru.head;
+            g_hash_table_add(shapeCache, run);
+            shapeCacheGlyphs += run->glyph_count;
+            run = NULL;
+        }
+        g_mutex_unlock(&shapeCacheLock);
+    }
+    if (run) freeShapedRun(run);
+    return result;
+}
+
+JNIEXPORT void JNICALL OS_NATIVE(shape_1cache_1stats)
+    (JNIEnv *env, jclass that, jlongArray stats)
+{
+    if (!stats || (*env)->GetArrayLength(env, stats) < 4) return;
+    jlong values[4];
+    g_mutex_lock(&shapeCacheLock);
+    values[0] = shapeCacheHits;
+    values[1] = shapeCacheMisses;
+    values[2] = shapeCacheEvictions;
+    values[3] = shapeCache ? g_hash_table_size(shapeCache) : 0;
+    g_mutex_unlock(&shapeCacheLock);
+    (*env)->SetLongArrayRegion(env, stats, 0, 4, values);
+}
+
 JNIEXPORT jstring JNICALL OS_NATIVE(pango_1font_1description_1get_1family)
     (JNIEnv *env, jclass that, jlong arg0)
 {
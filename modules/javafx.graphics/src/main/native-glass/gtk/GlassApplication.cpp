@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,7 +29,9 @@
 #include <gtk/gtk.h>
 #include <glib.h>
 
+#include <atomic>
 #include <cstdlib>
+#include <new>
 #include <com_sun_glass_ui_gtk_GtkApplication.h>
 #include <com_sun_glass_events_WindowEvent.h>
 #include <com_sun_glass_events_MouseEvent.h>
@@ -51,27 +53,115 @@ JNIEnv* mainEnv; // Use only with main loop thread!!!
 PlatformSupport* platformSupport = NULL;
 
 extern gboolean disableGrab;
-
-static gboolean call_runnable (gpointer data)
+extern gboolean coalesceEvents;
+
+// Runnables submitted by invokeLater are queued here and run by a single idle
+// source, instead of adding one idle source per runnable to the main loop.
+// This is a multiple producers / single consumer intrusive queue: any thread
+// pushes at the head, the main loop thread pops at the tail.
+struct LaterInvocation {
+    jobject runnable;
+    std::atomic<LaterInvocation*> next;
+};
+
+static LaterInvocation later_stub = { NULL, { NULL } };
+static std::atomic<LaterInvocation*> later_head(&later_stub);
+static LaterInvocation* later_tail = &later_stub;
+// Set while an idle source is going to drain the queue
+static std::atomic<bool> later_scheduled(false);
+
+// How long one drain may run before yielding to the event sources
+#define LATER_INVOCATION_BUDGET_US 8000
+
+static void push_later_invocation(LaterInvocation* node)
 {
-    RunnableContext* context = reinterpret_cast<RunnableContext*>(data);
+    node->next.store(NULL, std::memory_order_relaxed);
+    LaterInvocation* prev = later_head.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+}
 
-    JNIEnv *env;
-    int envStatus = javaVM->GetEnv((void **)&env, JNI_VERSION_1_6);
-    if (envStatus == JNI_EDETACHED) {
-        javaVM->AttachCurrentThread((void **)&env, NULL);
+// Returns the next runnable node, or NULL if the queue is empty or a push is
+// in progress; in the latter case the pusher schedules another drain.
+static LaterInvocation* pop_later_invocation()
+{
+    LaterInvocation* tail = later_tail;
+    LaterInvocation* next = tail->next.load(std::memory_order_acquire);
+    if (tail == &later_stub) {
+        if (next == NULL) {
+            return NULL;
+        }
+        later_tail = next;
+        tail = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+    if (next != NULL) {
+        later_tail = next;
+        return tail;
     }
+    if (tail != later_head.load(std::memory_order_acquire)) {
+        return NULL;
+    }
+    push_later_invocation(&later_stub);
+    next = tail->next.load(std::memory_order_acquire);
+    if (next != NULL) {
+        later_tail = next;
+        return tail;
+    }
+    return NULL;
+}
 
-    env->CallVoidMethod(context->runnable, jRunnableRun, NULL);
-    LOG_EXCEPTION(env);
-    env->DeleteGlobalRef(context->runnable);
-    free(context);
+static gboolean call_runnables(gpointer data);
 
-    if (envStatus == JNI_EDETACHED) {
-        javaVM->DetachCurrentThread();
+static void schedule_runnables()
+{
+    guint id = gdk_threads_add_idle_full(G_PRIORITY_HIGH_IDLE + 30, call_runnables, NULL, NULL);
+    // A runnable may enter a nested event loop, which has to keep running
+    // the runnables submitted meanwhile
+    GSource* source = g_main_context_find_source_by_id(NULL, id);
+    if (source != NULL) {
+        g_source_set_can_recurse(source, TRUE);
     }
+}
 
-    return FALSE;
+static gboolean call_runnables(gpointer data)
+{
+    (void)data;
+
+    gint64 deadline = g_get_monotonic_time() + LATER_INVOCATION_BUDGET_US;
+    for (;;) {
+        LaterInvocation* node = pop_later_invocation();
+        if (node == NULL) {
+            // Let the next submission schedule a drain. A push that was
+            // linked before the flag is cleared is seen by the check below.
+            later_scheduled.exchange(false, std::memory_order_acq_rel);
+            if (later_tail->next.load(std::memory_order_acquire) == NULL
+                    && later_tail == later_head.load(std::memory_order_acquire)) {
+                return FALSE;
+            }
+            if (later_scheduled.exchange(true, std::memory_order_acq_rel)) {
+                // Somebody else already scheduled the drain
+                return FALSE;
+            }
+            node = pop_later_invocation();
+            if (node == NULL) {
+                // A push is still linking its node, try again shortly
+                schedule_runnables();
+                return FALSE;
+            }
+        }
+
+        mainEnv->CallVoidMethod(node->runnable, jRunnableRun, NULL);
+        LOG_EXCEPTION(mainEnv);
+        mainEnv->DeleteGlobalRef(node->runnable);
+        delete node;
+
+        if (g_get_monotonic_time() >= deadline) {
+            // Keep the flag set, this drain continues from a new source
+            // once the pending events have been dispatched
+            schedule_runnables();
+            return FALSE;
+        }
+    }
 }
 
 static void call_update_preferences()
@@ -171,16 +261,17 @@ JNIEXPORT jint JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1queryLibrary
 /*
  * Class:     com_sun_glass_ui_gtk_GtkApplication
  * Method:    _init
- * Signature: ()V
+ * Signature: (JZZ)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1init
-  (JNIEnv * env, jobject obj, jlong handler, jboolean _disableGrab)
+  (JNIEnv * env, jobject obj, jlong handler, jboolean _disableGrab, jboolean _coalesceEvents)
 {
     (void)obj;
 
     mainEnv = env;
     process_events_prev = (GdkEventFunc) handler;
     disableGrab = (gboolean) _disableGrab;
+    coalesceEvents = (gboolean) _coalesceEvents;
 
     glass_gdk_x11_display_set_window_scale(gdk_display_get_default(), 1);
     gdk_event_handler_set(process_events, NULL, NULL);
@@ -283,13 +374,16 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkApplication__1submitForLater
 {
     (void)obj;
 
-    RunnableContext* context = (RunnableContext*)malloc(sizeof(RunnableContext));
-    if (context != NULL) {
-        context->runnable = env->NewGlobalRef(runnable);
-        gdk_threads_add_idle_full(G_PRIORITY_HIGH_IDLE + 30, call_runnable, context, NULL);
-        // we release this context in call_runnable
+    LaterInvocation* node = new (std::nothrow) LaterInvocation;
+    if (node != NULL) {
+        node->runnable = env->NewGlobalRef(runnable);
+        // we release this node in call_runnables
+        push_later_invocation(node);
+        if (!later_scheduled.exchange(true, std::memory_order_acq_rel)) {
+            schedule_runnables();
+        }
     } else {
-        fprintf(stderr, "malloc failed in GtkApplication__1submitForLaterInvocation\n");
+        fprintf(stderr, "new failed in GtkApplication__1submitForLaterInvocation\n");
     }
 }
 
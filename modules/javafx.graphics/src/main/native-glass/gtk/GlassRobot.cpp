@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,9 @@
 #include <X11/Xlib.h>
 #include <X11/Xutil.h>
 #include <X11/extensions/XTest.h>
+#include <X11/extensions/XShm.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
 #include <assert.h>
 #include <stdlib.h>
 #include <math.h>
@@ -249,6 +252,115 @@ JNIEXPORT jint JNICALL Java_com_sun_glass_ui_gtk_GtkRobot__1getMouseY
     return y;
 }
 
+// Shared memory image of the last capture size, kept for the next capture
+static XImage *shmImage = NULL;
+static XShmSegmentInfo shmInfo;
+static gboolean shmUnavailable = FALSE;
+
+static void releaseShmImage(Display *display)
+{
+    if (shmImage) {
+        XShmDetach(display, &shmInfo);
+        XDestroyImage(shmImage);
+        shmdt(shmInfo.shmaddr);
+        shmImage = NULL;
+    }
+}
+
+static XImage *getShmImage(Display *display, Visual *visual, int depth, int width, int height)
+{
+    if (shmImage && shmImage->width == width && shmImage->height == height) {
+        return shmImage;
+    }
+    releaseShmImage(display);
+
+    XImage *image = XShmCreateImage(display, visual, depth, ZPixmap, NULL, &shmInfo, width, height);
+    if (!image) {
+        return NULL;
+    }
+    shmInfo.shmid = shmget(IPC_PRIVATE, image->bytes_per_line * image->height, IPC_CREAT | 0600);
+    if (shmInfo.shmid < 0) {
+        XDestroyImage(image);
+        return NULL;
+    }
+    shmInfo.shmaddr = image->data = (char *) shmat(shmInfo.shmid, NULL, 0);
+    // removed once both sides have detached, even if we exit without doing so
+    shmctl(shmInfo.shmid, IPC_RMID, NULL);
+    if (shmInfo.shmaddr == (char *) -1) {
+        image->data = NULL;
+        XDestroyImage(image);
+        return NULL;
+    }
+    shmInfo.readOnly = False;
+
+    // attaching fails on remote displays, which only shows as an X error
+    gdk_error_trap_push();
+    XShmAttach(display, &shmInfo);
+    if (gdk_error_trap_pop()) {
+        XDestroyImage(image);
+        shmdt(shmInfo.shmaddr);
+        return NULL;
+    }
+    shmImage = image;
+    return shmImage;
+}
+
+/*
+ * Captures the root window straight into data through the MIT-SHM
+ * extension, skipping the pixbufs and copies of the generic path.
+ * Returns FALSE if the display cannot be read this way.
+ */
+static gboolean getScreenCaptureShm(JNIEnv *env, jint x, jint y, jint width, jint height, jintArray data)
+{
+    if (shmUnavailable) {
+        return FALSE;
+    }
+    GdkWindow *root_window = gdk_get_default_root_window();
+    Display *display = gdk_x11_get_default_xdisplay();
+#ifdef GLASS_GTK3
+    if (gdk_window_get_scale_factor(root_window) != 1) {
+        return FALSE;
+    }
+#endif
+    int screen = DefaultScreen(display);
+    Visual *visual = DefaultVisual(display, screen);
+    int depth = DefaultDepth(display, screen);
+    if (!XShmQueryExtension(display) || visual->c_class != TrueColor
+            || visual->red_mask != 0xff0000 || visual->green_mask != 0xff00
+            || visual->blue_mask != 0xff || depth < 24) {
+        shmUnavailable = TRUE;
+        return FALSE;
+    }
+
+    XImage *image = getShmImage(display, visual, depth, width, height);
+    if (!image || image->bits_per_pixel != 32 || image->byte_order != LSBFirst) {
+        releaseShmImage(display);
+        shmUnavailable = TRUE;
+        return FALSE;
+    }
+
+    // a region that is partly off screen fails, leave it to the generic path
+    gdk_error_trap_push();
+    Bool ok = XShmGetImage(display, GDK_WINDOW_XID(root_window), image, x, y, AllPlanes);
+    if (gdk_error_trap_pop() || !ok) {
+        return FALSE;
+    }
+
+    jint *pixels = (jint *) env->GetPrimitiveArrayCritical(data, NULL);
+    if (!pixels) {
+        return FALSE;
+    }
+    for (int row = 0; row < height; row++) {
+        const guint32 *src = (const guint32 *) (image->data + row * image->bytes_per_line);
+        jint *dst = pixels + row * width;
+        for (int col = 0; col < width; col++) {
+            dst[col] = (jint) (src[col] | 0xff000000);
+        }
+    }
+    env->ReleasePrimitiveArrayCritical(data, pixels, 0);
+    return TRUE;
+}
+
 /*
  * Class:     com_sun_glass_ui_gtk_GtkRobot
  * Method:    _getScreenCapture
@@ -275,6 +387,10 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkRobot__1getScreenCapture
         return;
     }
 
+    if (getScreenCaptureShm(env, x, y, width, height, data)) {
+        return;
+    }
+
     GdkPixbuf *screenshot, *tmp;
     GdkWindow *root_window = gdk_get_default_root_window();
 
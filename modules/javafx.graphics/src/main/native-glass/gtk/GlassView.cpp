@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -175,13 +175,41 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1scheduleRepaint
     (void)ptr;
 }
 
+/*
+ * Class:     com_sun_glass_ui_gtk_GtkView
+ * Method:    _getCoalescedMouseLocations
+ * Signature: (J)[I
+ */
+JNIEXPORT jintArray JNICALL Java_com_sun_glass_ui_gtk_GtkView__1getCoalescedMouseLocations
+  (JNIEnv * env, jobject obj, jlong ptr)
+{
+    (void)obj;
+
+    GlassView* view = JLONG_TO_GLASSVIEW(ptr);
+    if (!view->current_window) {
+        return NULL;
+    }
+
+    const std::vector<jint>& locations = view->current_window->get_coalesced_motion();
+    if (locations.empty()) {
+        return NULL;
+    }
+
+    jsize size = (jsize) locations.size();
+    jintArray result = env->NewIntArray(size);
+    if (EXCEPTION_OCCURED(env)) return NULL;
+    env->SetIntArrayRegion(result, 0, size, locations.data());
+    return result;
+}
+
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsDirect
- * Signature: (JLjava/nio/Buffer;II)V
+ * Signature: (JLjava/nio/Buffer;IIIIII)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsDirect
-(JNIEnv *env, jobject jView, jlong ptr, jobject buffer, jint width, jint height)
+(JNIEnv *env, jobject jView, jlong ptr, jobject buffer, jint width, jint height,
+        jint dirtyX, jint dirtyY, jint dirtyWidth, jint dirtyHeight)
 {
     (void)jView;
 
@@ -192,17 +220,19 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsDirect
     if (view->current_window) {
         void *data = env->GetDirectBufferAddress(buffer);
 
-        view->current_window->paint(data, width, height);
+        view->current_window->paint(data, width, height,
+                dirtyX, dirtyY, dirtyWidth, dirtyHeight);
     }
 }
 
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsIntArray
- * Signature:  (J[IIII)V
+ * Signature:  (J[IIIIIII)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
-  (JNIEnv * env, jobject obj, jlong ptr, jintArray array, jint offset, jint width, jint height)
+  (JNIEnv * env, jobject obj, jlong ptr, jintArray array, jint offset, jint width, jint height,
+        jint dirtyX, jint dirtyY, jint dirtyWidth, jint dirtyHeight)
 {
     (void)obj;
 
@@ -226,7 +256,8 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
         int *data = NULL;
         data = (int*)env->GetPrimitiveArrayCritical(array, 0);
 
-        view->current_window->paint(data + offset, width, height);
+        view->current_window->paint(data + offset, width, height,
+                dirtyX, dirtyY, dirtyWidth, dirtyHeight);
 
         env->ReleasePrimitiveArrayCritical(array, data, JNI_ABORT);
     }
@@ -235,10 +266,11 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsIntArray
 /*
  * Class:     com_sun_glass_ui_gtk_GtkView
  * Method:    _uploadPixelsByteArray
- * Signature:  (J[BIII)V
+ * Signature:  (J[BIIIIIII)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsByteArray
-  (JNIEnv * env, jobject obj, jlong ptr, jbyteArray array, jint offset, jint width, jint height)
+  (JNIEnv * env, jobject obj, jlong ptr, jbyteArray array, jint offset, jint width, jint height,
+        jint dirtyX, jint dirtyY, jint dirtyWidth, jint dirtyHeight)
 {
     (void)obj;
 
@@ -263,7 +295,8 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkView__1uploadPixelsByteArray
 
         data = (unsigned char*)env->GetPrimitiveArrayCritical(array, 0);
 
-        view->current_window->paint(data + offset, width, height);
+        view->current_window->paint(data + offset, width, height,
+                dirtyX, dirtyY, dirtyWidth, dirtyHeight);
 
         env->ReleasePrimitiveArrayCritical(array, data, JNI_ABORT);
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -434,51 +434,8 @@ static jobject dnd_target_get_image(JNIEnv *env)
                     (GDestroyNotify)g_free);
             buf = gdk_pixbuf_new_from_stream(stream, NULL, NULL);
             if (buf) {
-                int w;
-                int h;
-                int stride;
-                guchar *data;
-                jbyteArray data_array;
-                jobject buffer;
-
-                if (!gdk_pixbuf_get_has_alpha(buf)) {
-                    GdkPixbuf *tmp_buf = gdk_pixbuf_add_alpha(buf, FALSE, 0, 0, 0);
-                    g_object_unref(buf);
-                    buf = tmp_buf;
-                }
-
-                w = gdk_pixbuf_get_width(buf);
-                h = gdk_pixbuf_get_height(buf);
-                stride = gdk_pixbuf_get_rowstride(buf);
-
-                if (h <= 0 || stride <= 0 || h >= INT_MAX / stride) {
-                    g_object_unref(buf);
-                    g_object_unref(stream);
-                    continue;
-                }
-
-                data = gdk_pixbuf_get_pixels(buf);
-
-                //Actually, we are converting RGBA to BGRA, but that's the same operation
-                data = (guchar*) convert_BGRA_to_RGBA((int*) data, stride, h);
-                if (!data) {
-                    g_object_unref(buf);
-                    g_object_unref(stream);
-                    continue;
-                }
-
-                data_array = env->NewByteArray(stride * h);
-                EXCEPTION_OCCURED(env);
-                env->SetByteArrayRegion(data_array, 0, stride*h, (jbyte*) data);
-                EXCEPTION_OCCURED(env);
-
-                buffer = env->CallStaticObjectMethod(jByteBufferCls, jByteBufferWrap, data_array);
-                EXCEPTION_OCCURED(env);
-                result = env->NewObject(jGtkPixelsCls, jGtkPixelsInit, w, h, buffer);
-                EXCEPTION_OCCURED(env);
-
+                result = pixbuf_to_java_pixels(env, buf);
                 g_object_unref(buf);
-                g_free(data); // data from convert_BGRA_to_RGBA
             }
             g_object_unref(stream);
         }
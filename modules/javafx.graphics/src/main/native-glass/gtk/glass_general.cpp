@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,12 @@
 #include <jni.h>
 #include <gtk/gtk.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 char const * const GDK_WINDOW_DATA_CONTEXT = "glass_window_context";
 
 jclass jStringCls;
@@ -404,6 +410,40 @@ glass_throw_oom(JNIEnv * env, const char * message) {
 }
 
 
+static void swap_red_blue(guint8* dst, const int* pixels, int size) {
+  int i = 0;
+
+  // Only red and blue change places, so whole vectors can be shuffled
+#if defined(__SSE2__)
+  const __m128i ga = _mm_set1_epi32(0xff00ff00);
+  const __m128i b = _mm_set1_epi32(0x000000ff);
+  for (; i + 16 <= size; i += 16) {
+      __m128i p = _mm_loadu_si128((const __m128i*)pixels);
+      __m128i rb = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(p, 16), b),
+                                _mm_slli_epi32(_mm_and_si128(p, b), 16));
+      _mm_storeu_si128((__m128i*)(dst + i), _mm_or_si128(_mm_and_si128(p, ga), rb));
+      pixels += 4;
+  }
+#elif defined(__ARM_NEON)
+  for (; i + 64 <= size; i += 64) {
+      uint8x16x4_t p = vld4q_u8((const uint8_t*)pixels);
+      uint8x16_t t = p.val[0];
+      p.val[0] = p.val[2];
+      p.val[2] = t;
+      vst4q_u8(dst + i, p);
+      pixels += 16;
+  }
+#endif
+
+  for (; i < size; i += 4) {
+      dst[i] = (guint8)(*pixels >> 16);
+      dst[i + 1] = (guint8)(*pixels >> 8);
+      dst[i + 2] = (guint8)(*pixels);
+      dst[i + 3] = (guint8)(*pixels >> 24);
+      pixels++;
+  }
+}
+
 guint8* convert_BGRA_to_RGBA(const int* pixels, int stride, int height) {
   if (stride <= 0 || height <= 0 || (height > INT_MAX / stride)) {
     return NULL;
@@ -414,17 +454,67 @@ guint8* convert_BGRA_to_RGBA(const int* pixels, int stride, int height) {
     return NULL;
   }
 
-  int i = 0;
+  swap_red_blue(new_pixels, pixels, height * stride);
 
-  for (i = 0; i < height * stride; i += 4) {
-      new_pixels[i] = (guint8)(*pixels >> 16);
-      new_pixels[i + 1] = (guint8)(*pixels >> 8);
-      new_pixels[i + 2] = (guint8)(*pixels);
-      new_pixels[i + 3] = (guint8)(*pixels >> 24);
-      pixels++;
+  return new_pixels;
+}
+
+/*
+ * Converts a pixbuf straight into the byte array of a new GtkPixels,
+ * without intermediate copies. Pixbufs without alpha are expanded to
+ * opaque pixels in the same pass.
+ */
+jobject pixbuf_to_java_pixels(JNIEnv* env, GdkPixbuf* pixbuf) {
+  int w = gdk_pixbuf_get_width(pixbuf);
+  int h = gdk_pixbuf_get_height(pixbuf);
+  int stride = gdk_pixbuf_get_rowstride(pixbuf);
+  int channels = gdk_pixbuf_get_n_channels(pixbuf);
+
+  if (gdk_pixbuf_get_bits_per_sample(pixbuf) != 8 || (channels != 3 && channels != 4)) {
+    return NULL;
+  }
+  if (w <= 0 || h <= 0 || stride <= 0 || w > INT_MAX / 4 / h) {
+    return NULL;
   }
 
-  return new_pixels;
+  jbyteArray data_array = env->NewByteArray(w * 4 * h);
+  if (EXCEPTION_OCCURED(env) || data_array == NULL) {
+    return NULL;
+  }
+
+  guint8* dst = (guint8*) env->GetPrimitiveArrayCritical(data_array, NULL);
+  if (dst == NULL) {
+    return NULL;
+  }
+  const guchar* src = gdk_pixbuf_get_pixels(pixbuf);
+  for (int y = 0; y < h; y++) {
+      const guchar* row = src + (gsize) y * stride;
+      guint8* out = dst + (gsize) y * w * 4;
+      if (channels == 4) {
+          // Actually, we are converting RGBA to BGRA, but that's the same operation
+          swap_red_blue(out, (const int*) row, w * 4);
+      } else {
+          for (int x = 0; x < w; x++) {
+              out[0] = row[2];
+              out[1] = row[1];
+              out[2] = row[0];
+              out[3] = 0xff;
+              row += 3;
+              out += 4;
+          }
+      }
+  }
+  env->ReleasePrimitiveArrayCritical(data_array, dst, 0);
+
+  jobject buffer = env->CallStaticObjectMethod(jByteBufferCls, jByteBufferWrap, data_array);
+  if (EXCEPTION_OCCURED(env)) {
+    return NULL;
+  }
+  jobject result = env->NewObject(jGtkPixelsCls, jGtkPixelsInit, w, h, buffer);
+  if (EXCEPTION_OCCURED(env)) {
+    return NULL;
+  }
+  return result;
 }
 
 
@@ -570,6 +660,7 @@ typedef struct _DeviceGrabContext {
 } DeviceGrabContext;
 
 gboolean disableGrab = FALSE;
+gboolean coalesceEvents = FALSE;
 static gboolean configure_transparent_window(GtkWidget *window);
 static void configure_opaque_window(GtkWidget *window);
 
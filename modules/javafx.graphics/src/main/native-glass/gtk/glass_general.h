@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -285,6 +285,8 @@ private:
 
     guint8* convert_BGRA_to_RGBA(const int* pixels, int stride, int height);
 
+    jobject pixbuf_to_java_pixels(JNIEnv* env, GdkPixbuf* pixbuf);
+
     gboolean check_and_clear_exception(JNIEnv *env);
 
     jboolean is_display_valid();
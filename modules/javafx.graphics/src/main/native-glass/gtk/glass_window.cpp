@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -51,6 +51,27 @@
 #define MOUSE_BACK_BTN 8
 #define MOUSE_FORWARD_BTN 9
 
+extern gboolean coalesceEvents;
+
+// Whether the next queued event is a motion or a scroll that supersedes the
+// given one, so that the given one can be merged into it
+static bool next_event_continues(GdkEvent* current) {
+    GdkEvent* next = gdk_event_peek();
+    if (next == NULL) {
+        return false;
+    }
+    bool result = next->type == current->type
+            && next->any.window == current->any.window;
+    if (result && current->type == GDK_MOTION_NOTIFY) {
+        result = next->motion.state == current->motion.state;
+    } else if (result && current->type == GDK_SCROLL) {
+        result = next->scroll.state == current->scroll.state
+                && next->scroll.direction == current->scroll.direction;
+    }
+    gdk_event_free(next);
+    return result;
+}
+
 WindowContext * WindowContextBase::sm_grab_window = NULL;
 WindowContext * WindowContextBase::sm_mouse_drag_window = NULL;
 
@@ -62,6 +83,10 @@ jobject WindowContextBase::get_jview() {
     return jview;
 }
 
+const std::vector<jint>& WindowContextBase::get_coalesced_motion() {
+    return coalesced_motion;
+}
+
 jobject WindowContextBase::get_jwindow() {
     return jwindow;
 }
@@ -367,6 +392,14 @@ void WindowContextBase::process_mouse_motion(GdkEventMotion* event) {
         button = com_sun_glass_events_MouseEvent_BUTTON_FORWARD;
     }
 
+    if (coalesceEvents && next_event_continues((GdkEvent*) event)) {
+        // Only the last of the queued motions is delivered, the view can
+        // still ask for the ones before it
+        coalesced_motion.push_back((jint) event->x);
+        coalesced_motion.push_back((jint) event->y);
+        return;
+    }
+
     if (jview) {
         mainEnv->CallVoidMethod(jview, jViewNotifyMouse,
                 isDrag ? com_sun_glass_events_MouseEvent_DRAG : com_sun_glass_events_MouseEvent_MOVE,
@@ -376,8 +409,10 @@ void WindowContextBase::process_mouse_motion(GdkEventMotion* event) {
                 glass_modifier,
                 JNI_FALSE,
                 JNI_FALSE);
+        coalesced_motion.clear();
         CHECK_JNI_EXCEPTION(mainEnv)
     }
+    coalesced_motion.clear();
 }
 
 void WindowContextBase::process_mouse_scroll(GdkEventScroll* event) {
@@ -409,6 +444,15 @@ void WindowContextBase::process_mouse_scroll(GdkEventScroll* event) {
         dy = dx;
         dx = t;
     }
+    if (coalesceEvents && next_event_continues((GdkEvent*) event)) {
+        coalesced_scroll_dx += dx;
+        coalesced_scroll_dy += dy;
+        return;
+    }
+    dx += coalesced_scroll_dx;
+    dy += coalesced_scroll_dy;
+    coalesced_scroll_dx = 0;
+    coalesced_scroll_dy = 0;
     if (jview) {
         mainEnv->CallVoidMethod(jview, jViewNotifyScroll,
                 (jint) event->x, (jint) event->y,
@@ -494,13 +538,22 @@ void WindowContextBase::process_key(GdkEventKey* event) {
     }
 }
 
-void WindowContextBase::paint(void* data, jint width, jint height) {
+void WindowContextBase::paint(void* data, jint width, jint height,
+        jint dirtyX, jint dirtyY, jint dirtyWidth, jint dirtyHeight) {
+    // Only the dirty part of the frame is sent to the X server, the
+    // window keeps the rest of the previous one
+    GdkRectangle rect = {0, 0, width, height};
+    GdkRectangle dirty = {dirtyX, dirtyY, dirtyWidth, dirtyHeight};
+    if (!gdk_rectangle_intersect(&rect, &dirty, &rect)) {
+        return;
+    }
 #ifdef GLASS_GTK3
-    cairo_rectangle_int_t rect = {0, 0, width, height};
     cairo_region_t *region = cairo_region_create_rectangle(&rect);
     gdk_window_begin_paint_region(gdk_window, region);
 #endif
     cairo_t* context = gdk_cairo_create(gdk_window);
+    cairo_rectangle(context, rect.x, rect.y, rect.width, rect.height);
+    cairo_clip(context);
 
     cairo_surface_t* cairo_surface =
         cairo_image_surface_create_for_data(
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -105,8 +105,10 @@ public:
     virtual void setOnPreEdit(bool) = 0;
     virtual void commitIME(gchar *) = 0;
 
-    virtual void paint(void* data, jint width, jint height) = 0;
+    virtual void paint(void* data, jint width, jint height,
+            jint dirtyX, jint dirtyY, jint dirtyWidth, jint dirtyHeight) = 0;
     virtual WindowFrameExtents get_frame_extents() = 0;
+    virtual const std::vector<jint>& get_coalesced_motion() = 0;
 
     virtual void enter_fullscreen() = 0;
     virtual void exit_fullscreen() = 0;
@@ -194,6 +196,12 @@ protected:
     bool is_mouse_entered;
     bool is_disabled;
 
+    // x, y of the motions merged into the one being delivered
+    std::vector<jint> coalesced_motion;
+    // scroll merged into the next one being delivered
+    jdouble coalesced_scroll_dx = 0;
+    jdouble coalesced_scroll_dy = 0;
+
     /*
      * sm_grab_window points to WindowContext holding a mouse grab.
      * It is mostly used for popup windows.
@@ -221,7 +229,8 @@ public:
     void commitIME(gchar *);
     void updateCaretPos();
     void disableIME();
-    void paint(void*, jint, jint);
+    void paint(void*, jint, jint, jint, jint, jint, jint);
+    const std::vector<jint>& get_coalesced_motion();
     GdkWindow *get_gdk_window();
     jobject get_jwindow();
     jobject get_jview();
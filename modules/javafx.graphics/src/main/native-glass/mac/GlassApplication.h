@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -72,5 +72,7 @@
 + (jint)getKeyCodeForChar:(jchar)c;
 
 + (BOOL)syncRenderingDisabled;
++ (BOOL)metalLayerEnabled;
++ (BOOL)displaySyncEnabled;
 
 @end
@@ -60,6 +60,8 @@ static BOOL isEmbedded = NO;
 static BOOL requiresActivation = NO;
 static BOOL triggerReactivation = NO;
 static BOOL disableSyncRendering = NO;
+static BOOL enableMetalLayer = NO;
+static BOOL enableDisplaySync = YES;
 static BOOL firstActivation = YES;
 static BOOL shouldReactivate = NO;
 
@@ -893,6 +895,14 @@ static void inputDidChangeCallback(CFNotificationCenterRef center, void *observe
     return disableSyncRendering;
 }
 
++ (BOOL)metalLayerEnabled {
+    return enableMetalLayer;
+}
+
++ (BOOL)displaySyncEnabled {
+    return enableDisplaySync;
+}
+
 @end
 
 #pragma mark --- JNI
@@ -900,10 +910,11 @@ static void inputDidChangeCallback(CFNotificationCenterRef center, void *observe
 /*
  * Class:     com_sun_glass_ui_mac_MacApplication
  * Method:    _initIDs
- * Signature: ()V
+ * Signature: (ZZZ)V
  */
 JNIEXPORT void JNICALL Java_com_sun_glass_ui_mac_MacApplication__1initIDs
-(JNIEnv *env, jclass jClass, jboolean jDisableSyncRendering)
+(JNIEnv *env, jclass jClass, jboolean jDisableSyncRendering,
+ jboolean jEnableMetalLayer, jboolean jEnableDisplaySync)
 {
     LOG("Java_com_sun_glass_ui_mac_MacApplication__1initIDs");
 
@@ -936,6 +947,8 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_mac_MacApplication__1initIDs
     }
 
     disableSyncRendering = jDisableSyncRendering ? YES : NO;
+    enableMetalLayer = jEnableMetalLayer ? YES : NO;
+    enableDisplaySync = jEnableDisplaySync ? YES : NO;
 
     jApplicationClass = (*env)->NewGlobalRef(env, jClass);
 
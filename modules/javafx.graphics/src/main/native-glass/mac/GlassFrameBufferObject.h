@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@
 
 #import <OpenGL/gl.h>
 #import <OpenGL/OpenGL.h>
+#import <IOSurface/IOSurface.h>
 
 #import "GlassOffscreen.h"
 
@@ -39,6 +40,9 @@
     GLuint _fbo;
     GLuint _fboToRestore;
     BOOL   _isSwPipe;
+
+    BOOL         _isIOSurfaceBacked;
+    IOSurfaceRef _surface;
 }
 
 - (void)blitFromFBO:(GlassFrameBufferObject*)other_fbo;
@@ -46,4 +50,8 @@
 - (GLuint)fbo;
 - (void)setIsSwPipe:(BOOL)isSwPipe;
 
+// the texture storage is an IOSurface that other APIs can read without a copy
+- (void)setIsIOSurfaceBacked:(BOOL)isIOSurfaceBacked;
+- (IOSurfaceRef)surface;
+
 @end
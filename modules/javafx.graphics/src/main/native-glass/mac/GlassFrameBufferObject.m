@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@
 #import "GlassApplication.h"
 
 #import <OpenGL/glu.h>
+#import <OpenGL/CGLIOSurface.h>
 
 #define TARGET GL_TEXTURE_RECTANGLE_EXT
 #define FORMAT GL_BGRA
@@ -104,6 +105,28 @@
         glDeleteFramebuffersEXT(1, &self->_fbo);
         self->_fbo = 0;
     }
+    if (self->_surface != NULL)
+    {
+        CFRelease(self->_surface);
+        self->_surface = NULL;
+    }
+}
+
+- (IOSurfaceRef)_createSurfaceForWidth:(GLuint)width andHeight:(GLuint)height
+{
+    unsigned pixelFormat = 'BGRA';
+    unsigned bytesPerElement = 4;
+    size_t bytesPerRow = IOSurfaceAlignProperty(kIOSurfaceBytesPerRow, width * bytesPerElement);
+    size_t allocSize = IOSurfaceAlignProperty(kIOSurfaceAllocSize, height * bytesPerRow);
+    NSDictionary *properties = [NSDictionary dictionaryWithObjectsAndKeys:
+        [NSNumber numberWithUnsignedInt:width], (id)kIOSurfaceWidth,
+        [NSNumber numberWithUnsignedInt:height], (id)kIOSurfaceHeight,
+        [NSNumber numberWithUnsignedInt:pixelFormat], (id)kIOSurfacePixelFormat,
+        [NSNumber numberWithUnsignedInt:bytesPerElement], (id)kIOSurfaceBytesPerElement,
+        [NSNumber numberWithUnsignedLong:bytesPerRow], (id)kIOSurfaceBytesPerRow,
+        [NSNumber numberWithUnsignedLong:allocSize], (id)kIOSurfaceAllocSize,
+        nil];
+    return IOSurfaceCreate((CFDictionaryRef)properties);
 }
 
 - (void)_createFboIfNeededForWidth:(GLuint)width andHeight:(GLuint)height
@@ -126,6 +149,23 @@
             glTexParameteri(TARGET, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
             glTexParameteri(TARGET, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
             glTexParameteri(TARGET, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            if (self->_isIOSurfaceBacked)
+            {
+                self->_surface = [self _createSurfaceForWidth:width andHeight:height];
+                if (self->_surface != NULL)
+                {
+                    CGLError err = CGLTexImageIOSurface2D([self _assertContext], TARGET, GL_RGBA,
+                                                          (GLsizei)width, (GLsizei)height,
+                                                          FORMAT, TYPE, self->_surface, 0);
+                    if (err != kCGLNoError)
+                    {
+                        NSLog(@"CGLTexImageIOSurface2D error: %d", err);
+                        CFRelease(self->_surface);
+                        self->_surface = NULL;
+                    }
+                }
+            }
+            if (self->_surface == NULL)
             {
                 GLenum target = TARGET;
                 GLint level = 0;
@@ -191,6 +231,8 @@
         self->_texture = 0;
         self->_fbo = 0;
         self->_isSwPipe = NO;
+        self->_isIOSurfaceBacked = NO;
+        self->_surface = NULL;
 
         [self _assertContext];
         if ([self _supportsFbo] == NO)
@@ -340,4 +382,14 @@
     self->_isSwPipe = isSwPipe;
 }
 
+- (void)setIsIOSurfaceBacked:(BOOL)isIOSurfaceBacked
+{
+    self->_isIOSurfaceBacked = isIOSurfaceBacked;
+}
+
+- (IOSurfaceRef)surface
+{
+    return self->_surface;
+}
+
 @end
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,7 +28,17 @@
 
 #import "GlassOffscreen.h"
 
-@interface GlassLayer3D : CAOpenGLLayer
+// what GlassView3D needs from the layer presenting its rendering
+@protocol GlassLayer3DProtocol
+
+- (GlassOffscreen*)getPainterOffscreen;
+- (void)flush;
+
+- (void)notifyScaleFactorChanged:(CGFloat)scale;
+
+@end
+
+@interface GlassLayer3D : CAOpenGLLayer <GlassLayer3DProtocol>
 {
     GlassOffscreen *_glassOffscreen;
     GlassOffscreen *_painterOffscreen;
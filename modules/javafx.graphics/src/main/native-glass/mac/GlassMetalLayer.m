@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#import "GlassMetalLayer.h"
+
+#import "GlassMacros.h"
+#import "GlassScreen.h"
+
+//#define VERBOSE
+#ifndef VERBOSE
+    #define LOG(MSG, ...)
+#else
+    #define LOG(MSG, ...) GLASS_LOG(MSG, ## __VA_ARGS__);
+#endif
+
+// Draws the texture over the whole drawable. GL rows go bottom up, so the
+// texture is flipped on the way.
+static NSString *shaderSource =
+    @"#include <metal_stdlib>\n"
+    @"using namespace metal;\n"
+    @"struct VertexOut { float4 position [[position]]; float2 texCoord; };\n"
+    @"vertex VertexOut glassVertex(uint vid [[vertex_id]]) {\n"
+    @"    float2 uv = float2((vid << 1) & 2, vid & 2);\n"
+    @"    VertexOut out;\n"
+    @"    out.position = float4(uv * 2.0 - 1.0, 0.0, 1.0);\n"
+    @"    out.texCoord = uv;\n"
+    @"    return out;\n"
+    @"}\n"
+    @"fragment half4 glassFragment(VertexOut in [[stage_in]],\n"
+    @"                             texture2d<half> tex [[texture(0)]]) {\n"
+    @"    constexpr sampler s(coord::normalized, filter::nearest);\n"
+    @"    return tex.sample(s, in.texCoord);\n"
+    @"}\n";
+
+@implementation GlassMetalLayer
+
+- (id)initWithClientContext:(CGLContextObj)clCtx
+             withHiDPIAware:(BOOL)HiDPIAware
+               withIsSwPipe:(BOOL)isSwPipe
+            withDisplaySync:(BOOL)displaySync
+{
+    LOG("GlassMetalLayer initWithClientContext]");
+    self = [super init];
+    if (self != nil)
+    {
+        id<MTLDevice> device = MTLCreateSystemDefaultDevice();
+        if (device == nil)
+        {
+            [self release];
+            return nil;
+        }
+        [self setDevice:device];
+        [device release];
+
+        NSError *error = nil;
+        id<MTLLibrary> library = [device newLibraryWithSource:shaderSource options:nil error:&error];
+        if (library == nil)
+        {
+            NSLog(@"GlassMetalLayer: cannot compile the shaders: %@", error);
+            [self release];
+            return nil;
+        }
+        MTLRenderPipelineDescriptor *descriptor = [[MTLRenderPipelineDescriptor alloc] init];
+        id<MTLFunction> vertexFunction = [library newFunctionWithName:@"glassVertex"];
+        id<MTLFunction> fragmentFunction = [library newFunctionWithName:@"glassFragment"];
+        [descriptor setVertexFunction:vertexFunction];
+        [descriptor setFragmentFunction:fragmentFunction];
+        [[descriptor colorAttachments][0] setPixelFormat:MTLPixelFormatBGRA8Unorm];
+        self->_pipelineState = [device newRenderPipelineStateWithDescriptor:descriptor error:&error];
+        [vertexFunction release];
+        [fragmentFunction release];
+        [descriptor release];
+        [library release];
+        if (self->_pipelineState == nil)
+        {
+            NSLog(@"GlassMetalLayer: cannot create the pipeline: %@", error);
+            [self release];
+            return nil;
+        }
+        self->_commandQueue = [device newCommandQueue];
+
+        self->_painterOffscreen = [[GlassOffscreen alloc] initWithContext:clCtx
+                                                              andIsSwPipe:isSwPipe
+                                                     andIsIOSurfaceBacked:YES];
+        self->isHiDPIAware = HiDPIAware;
+
+        [self setPixelFormat:MTLPixelFormatBGRA8Unorm];
+        [self setFramebufferOnly:YES];
+        if ([self respondsToSelector:@selector(setDisplaySyncEnabled:)]) {
+            [self setDisplaySyncEnabled:displaySync];
+        }
+
+        [self setAutoresizingMask:(kCALayerWidthSizable|kCALayerHeightSizable)];
+        [self setContentsGravity:kCAGravityTopLeft];
+
+        // see GlassLayer3D
+        [self notifyScaleFactorChanged:GetScreenScaleFactor([[NSScreen screens] objectAtIndex:0])];
+
+        [self setMasksToBounds:YES];
+        [self setAnchorPoint:CGPointMake(0.0f, 0.0f)];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    [self->_texture release];
+    self->_texture = nil;
+    if (self->_surface != NULL)
+    {
+        CFRelease(self->_surface);
+        self->_surface = NULL;
+    }
+
+    [self->_pipelineState release];
+    self->_pipelineState = nil;
+
+    [self->_commandQueue release];
+    self->_commandQueue = nil;
+
+    [self->_painterOffscreen release];
+    self->_painterOffscreen = nil;
+
+    [super dealloc];
+}
+
+- (void)notifyScaleFactorChanged:(CGFloat)scale
+{
+    if (self->isHiDPIAware) {
+        [self setContentsScale: scale];
+    }
+}
+
+- (id<MTLTexture>)_textureForSurface:(IOSurfaceRef)surface
+{
+    if (surface != self->_surface)
+    {
+        // the painter offscreen was resized
+        [self->_texture release];
+        self->_texture = nil;
+        if (self->_surface != NULL)
+        {
+            CFRelease(self->_surface);
+        }
+        self->_surface = (IOSurfaceRef)CFRetain(surface);
+
+        MTLTextureDescriptor *descriptor =
+            [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatBGRA8Unorm
+                                                               width:IOSurfaceGetWidth(surface)
+                                                              height:IOSurfaceGetHeight(surface)
+                                                           mipmapped:NO];
+        [descriptor setUsage:MTLTextureUsageShaderRead];
+        [descriptor setStorageMode:MTLStorageModeManaged];
+        self->_texture = [[self device] newTextureWithDescriptor:descriptor iosurface:surface plane:0];
+    }
+    return self->_texture;
+}
+
+- (void)flush
+{
+    IOSurfaceRef surface = [self->_painterOffscreen surface];
+    if (surface == NULL)
+    {
+        return;
+    }
+
+    @autoreleasepool
+    {
+        // Metal only sees the pixels once GL is done with them
+        [self->_painterOffscreen finish];
+
+        id<MTLTexture> texture = [self _textureForSurface:surface];
+        if (texture == nil)
+        {
+            return;
+        }
+        [self setDrawableSize:CGSizeMake([texture width], [texture height])];
+
+        id<CAMetalDrawable> drawable = [self nextDrawable];
+        if (drawable == nil)
+        {
+            return;
+        }
+
+        MTLRenderPassDescriptor *pass = [MTLRenderPassDescriptor renderPassDescriptor];
+        [[pass colorAttachments][0] setTexture:[drawable texture]];
+        [[pass colorAttachments][0] setLoadAction:MTLLoadActionDontCare];
+        [[pass colorAttachments][0] setStoreAction:MTLStoreActionStore];
+
+        id<MTLCommandBuffer> commandBuffer = [self->_commandQueue commandBuffer];
+        id<MTLRenderCommandEncoder> encoder = [commandBuffer renderCommandEncoderWithDescriptor:pass];
+        [encoder setRenderPipelineState:self->_pipelineState];
+        [encoder setFragmentTexture:texture atIndex:0];
+        [encoder drawPrimitives:MTLPrimitiveTypeTriangle vertexStart:0 vertexCount:3];
+        [encoder endEncoding];
+        [commandBuffer presentDrawable:drawable];
+        [commandBuffer commit];
+
+        // the next frame is rendered into the same IOSurface
+        [commandBuffer waitUntilCompleted];
+    }
+    LOG("GlassMetalLayer flush]");
+}
+
+- (GlassOffscreen*)getPainterOffscreen
+{
+    return self->_painterOffscreen;
+}
+
+@end
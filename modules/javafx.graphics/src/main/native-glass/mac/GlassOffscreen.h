@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@
 
 #import <OpenGL/gl.h>
 #import <OpenGL/OpenGL.h>
+#import <IOSurface/IOSurface.h>
 
 @protocol GlassOffscreenProtocol
 
@@ -63,6 +64,9 @@
 
 - (id)initWithContext:(CGLContextObj)ctx
             andIsSwPipe:(BOOL)isSwPipe;
+- (id)initWithContext:(CGLContextObj)ctx
+            andIsSwPipe:(BOOL)isSwPipe
+    andIsIOSurfaceBacked:(BOOL)isIOSurfaceBacked;
 - (CGLContextObj)getContext;
 
 - (void)setBackgroundColor:(NSColor*)color;
@@ -77,4 +81,9 @@
 
 - (void)blitFromOffscreen:(GlassOffscreen*) other_offscreen;
 
+// the IOSurface holding the rendered pixels, if IOSurface backed
+- (IOSurfaceRef)surface;
+// waits until the rendering into the offscreen is completed
+- (void)finish;
+
 @end
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -44,6 +44,13 @@
 
 - (id)initWithContext:(CGLContextObj)ctx
             andIsSwPipe:(BOOL)isSwPipe;
+{
+    return [self initWithContext:ctx andIsSwPipe:isSwPipe andIsIOSurfaceBacked:NO];
+}
+
+- (id)initWithContext:(CGLContextObj)ctx
+            andIsSwPipe:(BOOL)isSwPipe
+    andIsIOSurfaceBacked:(BOOL)isIOSurfaceBacked
 {
     self = [super init];
     if (self != nil)
@@ -64,6 +71,7 @@
                 //self->_offscreen = [[GlassPBuffer alloc] init];
             }
             [(GlassFrameBufferObject*)self->_offscreen setIsSwPipe:(BOOL)isSwPipe];
+            [(GlassFrameBufferObject*)self->_offscreen setIsIOSurfaceBacked:isIOSurfaceBacked];
         }
         [self unsetContext];
     }
@@ -209,4 +217,18 @@
     [self unsetContext];
 }
 
+- (IOSurfaceRef)surface
+{
+    return [(GlassFrameBufferObject*)self->_offscreen surface];
+}
+
+- (void)finish
+{
+    [self setContext];
+    {
+        glFinish();
+    }
+    [self unsetContext];
+}
+
 @end
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,7 @@
 #import "GlassMacros.h"
 #import "GlassView3D.h"
 #import "GlassLayer3D.h"
+#import "GlassMetalLayer.h"
 #import "GlassApplication.h"
 
 #pragma clang diagnostic ignored "-Wdeprecated-declarations"
@@ -207,7 +208,16 @@
         }
     }
 
-    GlassLayer3D *layer = [[GlassLayer3D alloc] initWithSharedContext:sharedCGL andClientContext:clientCGL withHiDPIAware:self->isHiDPIAware withIsSwPipe:isSwPipe];
+    CALayer<GlassLayer3DProtocol> *layer = nil;
+    if ([GlassApplication metalLayerEnabled])
+    {
+        layer = [[GlassMetalLayer alloc] initWithClientContext:clientCGL withHiDPIAware:self->isHiDPIAware
+                                                  withIsSwPipe:isSwPipe withDisplaySync:[GlassApplication displaySyncEnabled]];
+    }
+    if (layer == nil)
+    {
+        layer = [[GlassLayer3D alloc] initWithSharedContext:sharedCGL andClientContext:clientCGL withHiDPIAware:self->isHiDPIAware withIsSwPipe:isSwPipe];
+    }
 
     // https://developer.apple.com/library/mac/documentation/Cocoa/Reference/ApplicationKit/Classes/nsview_Class/Reference/NSView.html#//apple_ref/occ/instm/NSView/setWantsLayer:
     // the order of the following 2 calls is important: here we indicate we want a layer-hosting view
@@ -257,7 +267,7 @@
 {
     if (self->_texture != 0)
     {
-        GlassLayer3D *layer = (GlassLayer3D*)[self layer];
+        CALayer<GlassLayer3DProtocol> *layer = (CALayer<GlassLayer3DProtocol>*)[self layer];
         [[layer getPainterOffscreen] bindForWidth:(GLuint)[self bounds].size.width andHeight:(GLuint)[self bounds].size.height];
         {
             glDeleteTextures(1, &self->_texture);
@@ -329,7 +339,7 @@
 {
     if ([self window] != nil)
     {
-        GlassLayer3D *layer = (GlassLayer3D*)[self layer];
+        CALayer<GlassLayer3DProtocol> *layer = (CALayer<GlassLayer3DProtocol>*)[self layer];
         [[layer getPainterOffscreen] setBackgroundColor:[[[self window] backgroundColor] colorUsingColorSpaceName:NSDeviceRGBColorSpace]];
     }
 
@@ -611,7 +621,7 @@
 
     if (self->_drawCounter == 0)
     {
-        GlassLayer3D *layer = (GlassLayer3D*)[self layer];
+        CALayer<GlassLayer3DProtocol> *layer = (CALayer<GlassLayer3DProtocol>*)[self layer];
         NSRect bounds = (self->isHiDPIAware && [self respondsToSelector:@selector(convertRectToBacking:)]) ?
             [self convertRectToBacking:[self bounds]] : [self bounds];
         [[layer getPainterOffscreen] bindForWidth:(GLuint)bounds.size.width andHeight:(GLuint)bounds.size.height];
@@ -626,7 +636,7 @@
     self->_drawCounter--;
     if (self->_drawCounter == 0)
     {
-        GlassLayer3D *layer = (GlassLayer3D*)[self layer];
+        CALayer<GlassLayer3DProtocol> *layer = (CALayer<GlassLayer3DProtocol>*)[self layer];
         [[layer getPainterOffscreen] unbind];
         [layer flush];
     }
@@ -873,7 +883,7 @@
 
 - (void)notifyScaleFactorChanged:(CGFloat)scale
 {
-    GlassLayer3D *layer = (GlassLayer3D*)[self layer];
+    CALayer<GlassLayer3DProtocol> *layer = (CALayer<GlassLayer3DProtocol>*)[self layer];
     [layer notifyScaleFactorChanged:scale];
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -838,10 +838,10 @@ JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_mac_MacWindow__1setView
         if (window->view != nil)
         {
             CALayer *layer = [window->view layer];
-            if (([layer isKindOfClass:[CAOpenGLLayer class]] == YES) &&
+            if (([layer conformsToProtocol:@protocol(GlassLayer3DProtocol)] == YES) &&
                 (([window->nsWindow styleMask] & NSWindowStyleMaskTexturedBackground) == NO))
             {
-                [((CAOpenGLLayer*)layer) setOpaque:[window->nsWindow isOpaque]];
+                [layer setOpaque:[window->nsWindow isOpaque]];
             }
 
             window->suppressWindowMoveEvent = YES; // RT-11215
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -202,6 +202,15 @@ JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_EGL_eglSwapBuffers
     }
 }
 
+JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_EGL_eglSwapInterval
+    (JNIEnv *UNUSED(env), jclass UNUSED(clazz), jlong eglDisplay, jint interval) {
+    if (eglSwapInterval(asPtr(eglDisplay), interval)) {
+        return JNI_TRUE;
+    } else {
+        return JNI_FALSE;
+    }
+}
+
 JNIEXPORT jint  JNICALL Java_com_sun_glass_ui_monocle_EGL_eglGetError
     (JNIEnv *UNUSED(env), jclass UNUSED(clazz)) {
     return (jint)eglGetError();
@@ -0,0 +1,685 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+// A generic DRM/KMS implementation of the functions declared in egl_ext.h,
+// for EGLPlatform. Rendering goes to a GBM surface whose buffers are put on
+// the primary plane with page flips, atomic when the driver supports it, so
+// that no compositor or copy is involved. The overlay planes of the CRTC can
+// be given other buffers, e.g. video frames, through DRMPlatform.
+
+#include "com_sun_glass_ui_monocle_DRMPlatform.h"
+#include "com_sun_glass_ui_Pixels_Format.h"
+#include "egl/egl_ext.h"
+#include "Monocle.h"
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <gbm.h>
+#include <xf86drm.h>
+#include <xf86drmMode.h>
+
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_OVERLAY_PLANES 4
+#define CURSOR_SIZE 64
+
+// property ids of a plane
+typedef struct {
+    uint32_t id;
+    uint32_t fbId;
+    uint32_t crtcId;
+    uint32_t srcX, srcY, srcW, srcH;
+    uint32_t crtcX, crtcY, crtcW, crtcH;
+} PlaneProps;
+
+typedef struct {
+    PlaneProps props;
+    uint32_t fb;            // framebuffer to show, 0 to disable the plane
+    uint32_t handle;        // GEM handle of the imported buffer
+    int x, y, w, h;         // destination on the screen
+    uint32_t srcW, srcH;
+    int changed;            // not committed yet
+} Overlay;
+
+static struct {
+    int fd;
+    int atomic;
+    drmModeModeInfo mode;
+    uint32_t mmWidth;
+    uint32_t connectorId;
+    uint32_t crtcId;
+    uint32_t connectorCrtcIdProp;
+    uint32_t crtcModeIdProp;
+    uint32_t crtcActiveProp;
+    PlaneProps primary;
+
+    pthread_mutex_t overlayLock;
+    Overlay overlays[MAX_OVERLAY_PLANES];
+    int overlayCount;
+
+    struct gbm_device *gbm;
+    struct gbm_surface *surface;
+    // at most three buffers are in use: one scanned out, one waiting for
+    // its flip and one being rendered
+    struct gbm_bo *scanoutBo;
+    struct gbm_bo *pendingBo;
+    int flipPending;
+    int modeSet;
+
+    struct gbm_bo *cursorBo;
+    int cursorVisible;
+} drm = { .fd = -1, .overlayLock = PTHREAD_MUTEX_INITIALIZER };
+
+static uint32_t getPropertyId(uint32_t objectId, uint32_t objectType,
+                              const char *name, uint64_t *value) {
+    uint32_t result = 0;
+    drmModeObjectProperties *props = drmModeObjectGetProperties(drm.fd, objectId, objectType);
+    if (props == NULL) {
+        return 0;
+    }
+    for (uint32_t i = 0; i < props->count_props && result == 0; i++) {
+        drmModePropertyRes *prop = drmModeGetProperty(drm.fd, props->props[i]);
+        if (prop != NULL) {
+            if (strcmp(prop->name, name) == 0) {
+                result = prop->prop_id;
+                if (value != NULL) {
+                    *value = props->prop_values[i];
+                }
+            }
+            drmModeFreeProperty(prop);
+        }
+    }
+    drmModeFreeObjectProperties(props);
+    return result;
+}
+
+static void initPlaneProps(PlaneProps *props, uint32_t planeId) {
+    props->id = planeId;
+    props->fbId = getPropertyId(planeId, DRM_MODE_OBJECT_PLANE, "FB_ID", NULL);
+    props->crtcId = getPropertyId(planeId, DRM_MODE_OBJECT_PLANE, "CRTC_ID", NULL);
+    props->srcX = getPropertyId(planeId, DRM_MODE_OBJECT_PLANE, "SRC_X", NULL);
+    props->srcY = getPropertyId(planeId, DRM_MODE_OBJECT_PLANE, "SRC_Y", NULL);
+    props->srcW = getPropertyId(planeId, DRM_MODE_OBJECT_PLANE, "SRC_W", NULL);
+    props->srcH = getPropertyId(planeId, DRM_MODE_OBJECT_PLANE, "SRC_H", NULL);
+    props->crtcX = getPropertyId(planeId, DRM_MODE_OBJECT_PLANE, "CRTC_X", NULL);
+    props->crtcY = getPropertyId(planeId, DRM_MODE_OBJECT_PLANE, "CRTC_Y", NULL);
+    props->crtcW = getPropertyId(planeId, DRM_MODE_OBJECT_PLANE, "CRTC_W", NULL);
+    props->crtcH = getPropertyId(planeId, DRM_MODE_OBJECT_PLANE, "CRTC_H", NULL);
+}
+
+static void findPlanes(int crtcIndex) {
+    drmModePlaneRes *planes = drmModeGetPlaneResources(drm.fd);
+    if (planes == NULL) {
+        return;
+    }
+    for (uint32_t i = 0; i < planes->count_planes; i++) {
+        drmModePlane *plane = drmModeGetPlane(drm.fd, planes->planes[i]);
+        if (plane == NULL) {
+            continue;
+        }
+        if (plane->possible_crtcs & (1u << crtcIndex)) {
+            uint64_t type = 0;
+            getPropertyId(plane->plane_id, DRM_MODE_OBJECT_PLANE, "type", &type);
+            if (type == DRM_PLANE_TYPE_PRIMARY && drm.primary.id == 0) {
+                initPlaneProps(&drm.primary, plane->plane_id);
+            } else if (type == DRM_PLANE_TYPE_OVERLAY
+                    && drm.overlayCount < MAX_OVERLAY_PLANES) {
+                initPlaneProps(&drm.overlays[drm.overlayCount++].props, plane->plane_id);
+            }
+        }
+        drmModeFreePlane(plane);
+    }
+    drmModeFreePlaneResources(planes);
+}
+
+static int findCrtc(drmModeRes *resources, drmModeConnector *connector) {
+    if (connector->encoder_id != 0) {
+        drmModeEncoder *encoder = drmModeGetEncoder(drm.fd, connector->encoder_id);
+        if (encoder != NULL) {
+            drm.crtcId = encoder->crtc_id;
+            drmModeFreeEncoder(encoder);
+        }
+    }
+    for (int i = 0; i < connector->count_encoders && drm.crtcId == 0; i++) {
+        drmModeEncoder *encoder = drmModeGetEncoder(drm.fd, connector->encoders[i]);
+        if (encoder == NULL) {
+            continue;
+        }
+        for (int j = 0; j < resources->count_crtcs; j++) {
+            if (encoder->possible_crtcs & (1u << j)) {
+                drm.crtcId = resources->crtcs[j];
+                break;
+            }
+        }
+        drmModeFreeEncoder(encoder);
+    }
+    for (int i = 0; i < resources->count_crtcs; i++) {
+        if (resources->crtcs[i] == drm.crtcId) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int initDrm(const char *card) {
+    drm.fd = open(card, O_RDWR | O_CLOEXEC);
+    if (drm.fd < 0) {
+        fprintf(stderr, "DRM: cannot open %s: %s\n", card, strerror(errno));
+        return 0;
+    }
+    drmSetClientCap(drm.fd, DRM_CLIENT_CAP_UNIVERSAL_PLANES, 1);
+    drm.atomic = getenv("MONOCLE_DRM_NO_ATOMIC") == NULL
+            && drmSetClientCap(drm.fd, DRM_CLIENT_CAP_ATOMIC, 1) == 0;
+
+    drmModeRes *resources = drmModeGetResources(drm.fd);
+    if (resources == NULL) {
+        fprintf(stderr, "DRM: %s has no mode setting resources\n", card);
+        return 0;
+    }
+    drmModeConnector *connector = NULL;
+    for (int i = 0; i < resources->count_connectors && connector == NULL; i++) {
+        connector = drmModeGetConnector(drm.fd, resources->connectors[i]);
+        if (connector != NULL
+                && (connector->connection != DRM_MODE_CONNECTED || connector->count_modes == 0)) {
+            drmModeFreeConnector(connector);
+            connector = NULL;
+        }
+    }
+    if (connector == NULL) {
+        fprintf(stderr, "DRM: no connected display on %s\n", card);
+        drmModeFreeResources(resources);
+        return 0;
+    }
+
+    drm.mode = connector->modes[0];
+    for (int i = 0; i < connector->count_modes; i++) {
+        if (connector->modes[i].type & DRM_MODE_TYPE_PREFERRED) {
+            drm.mode = connector->modes[i];
+            break;
+        }
+    }
+    drm.mmWidth = connector->mmWidth;
+    drm.connectorId = connector->connector_id;
+    int crtcIndex = findCrtc(resources, connector);
+    drmModeFreeConnector(connector);
+    drmModeFreeResources(resources);
+    if (crtcIndex < 0) {
+        fprintf(stderr, "DRM: no CRTC for the display on %s\n", card);
+        return 0;
+    }
+
+    findPlanes(crtcIndex);
+    if (drm.atomic) {
+        drm.connectorCrtcIdProp = getPropertyId(drm.connectorId, DRM_MODE_OBJECT_CONNECTOR, "CRTC_ID", NULL);
+        drm.crtcModeIdProp = getPropertyId(drm.crtcId, DRM_MODE_OBJECT_CRTC, "MODE_ID", NULL);
+        drm.crtcActiveProp = getPropertyId(drm.crtcId, DRM_MODE_OBJECT_CRTC, "ACTIVE", NULL);
+        if (drm.primary.id == 0 || drm.connectorCrtcIdProp == 0
+                || drm.crtcModeIdProp == 0 || drm.crtcActiveProp == 0) {
+            drm.atomic = 0;
+        }
+    }
+    return 1;
+}
+
+static void destroyBoFb(struct gbm_bo *bo, void *data) {
+    uint32_t fb = (uint32_t) (unsigned long) data;
+    if (fb != 0) {
+        drmModeRmFB(gbm_device_get_fd(gbm_bo_get_device(bo)), fb);
+    }
+}
+
+// the framebuffer of a GBM buffer is created once and kept with the buffer
+static uint32_t getFbForBo(struct gbm_bo *bo) {
+    uint32_t fb = (uint32_t) (unsigned long) gbm_bo_get_user_data(bo);
+    if (fb != 0) {
+        return fb;
+    }
+    uint32_t handles[4] = { gbm_bo_get_handle(bo).u32 };
+    uint32_t pitches[4] = { gbm_bo_get_stride(bo) };
+    uint32_t offsets[4] = { 0 };
+    if (drmModeAddFB2(drm.fd, gbm_bo_get_width(bo), gbm_bo_get_height(bo),
+                      gbm_bo_get_format(bo), handles, pitches, offsets, &fb, 0) != 0) {
+        fprintf(stderr, "DRM: cannot create a framebuffer: %s\n", strerror(errno));
+        return 0;
+    }
+    gbm_bo_set_user_data(bo, (void *) (unsigned long) fb, destroyBoFb);
+    return fb;
+}
+
+static void pageFlipHandler(int UNUSED(fd), unsigned int UNUSED(frame),
+                            unsigned int UNUSED(sec), unsigned int UNUSED(usec),
+                            void *UNUSED(data)) {
+    drm.flipPending = 0;
+}
+
+static void waitForFlip() {
+    drmEventContext context = {
+        .version = 2,
+        .page_flip_handler = pageFlipHandler
+    };
+    while (drm.flipPending) {
+        struct pollfd pfd = { .fd = drm.fd, .events = POLLIN };
+        if (poll(&pfd, 1, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            drm.flipPending = 0;
+            break;
+        }
+        drmHandleEvent(drm.fd, &context);
+    }
+}
+
+static void addPlane(drmModeAtomicReq *req, PlaneProps *props, uint32_t fb,
+                     int x, int y, int w, int h, uint32_t srcW, uint32_t srcH) {
+    drmModeAtomicAddProperty(req, props->id, props->fbId, fb);
+    drmModeAtomicAddProperty(req, props->id, props->crtcId, fb != 0 ? drm.crtcId : 0);
+    drmModeAtomicAddProperty(req, props->id, props->srcX, 0);
+    drmModeAtomicAddProperty(req, props->id, props->srcY, 0);
+    drmModeAtomicAddProperty(req, props->id, props->srcW, ((uint64_t) srcW) << 16);
+    drmModeAtomicAddProperty(req, props->id, props->srcH, ((uint64_t) srcH) << 16);
+    drmModeAtomicAddProperty(req, props->id, props->crtcX, x);
+    drmModeAtomicAddProperty(req, props->id, props->crtcY, y);
+    drmModeAtomicAddProperty(req, props->id, props->crtcW, w);
+    drmModeAtomicAddProperty(req, props->id, props->crtcH, h);
+}
+
+// puts fb on the primary plane together with the pending overlay changes;
+// after the first, blocking, mode set a page flip event reports completion
+static int commitFrame(uint32_t fb) {
+    int w = drm.mode.hdisplay;
+    int h = drm.mode.vdisplay;
+    int result;
+
+    pthread_mutex_lock(&drm.overlayLock);
+    if (drm.atomic) {
+        drmModeAtomicReq *req = drmModeAtomicAlloc();
+        uint32_t flags;
+        uint32_t modeBlob = 0;
+        if (!drm.modeSet) {
+            drmModeCreatePropertyBlob(drm.fd, &drm.mode, sizeof(drm.mode), &modeBlob);
+            drmModeAtomicAddProperty(req, drm.connectorId, drm.connectorCrtcIdProp, drm.crtcId);
+            drmModeAtomicAddProperty(req, drm.crtcId, drm.crtcModeIdProp, modeBlob);
+            drmModeAtomicAddProperty(req, drm.crtcId, drm.crtcActiveProp, 1);
+            flags = DRM_MODE_ATOMIC_ALLOW_MODESET;
+        } else {
+            flags = DRM_MODE_PAGE_FLIP_EVENT | DRM_MODE_ATOMIC_NONBLOCK;
+        }
+        addPlane(req, &drm.primary, fb, 0, 0, w, h, w, h);
+        for (int i = 0; i < drm.overlayCount; i++) {
+            Overlay *o = &drm.overlays[i];
+            if (o->changed) {
+                addPlane(req, &o->props, o->fb, o->x, o->y, o->w, o->h, o->srcW, o->srcH);
+            }
+        }
+        result = drmModeAtomicCommit(drm.fd, req, flags, NULL);
+        drmModeAtomicFree(req);
+        if (modeBlob != 0) {
+            drmModeDestroyPropertyBlob(drm.fd, modeBlob);
+        }
+    } else {
+        if (!drm.modeSet) {
+            result = drmModeSetCrtc(drm.fd, drm.crtcId, fb, 0, 0,
+                                    &drm.connectorId, 1, &drm.mode);
+        } else {
+            result = drmModePageFlip(drm.fd, drm.crtcId, fb, DRM_MODE_PAGE_FLIP_EVENT, NULL);
+        }
+        for (int i = 0; i < drm.overlayCount && result == 0; i++) {
+            Overlay *o = &drm.overlays[i];
+            if (o->changed) {
+                drmModeSetPlane(drm.fd, o->props.id, o->fb != 0 ? drm.crtcId : 0, o->fb, 0,
+                                o->x, o->y, o->w, o->h,
+                                0, 0, o->srcW << 16, o->srcH << 16);
+            }
+        }
+    }
+    if (result == 0) {
+        for (int i = 0; i < drm.overlayCount; i++) {
+            drm.overlays[i].changed = 0;
+        }
+    }
+    pthread_mutex_unlock(&drm.overlayLock);
+
+    if (result != 0) {
+        fprintf(stderr, "DRM: cannot show the frame: %s\n", strerror(errno));
+        return 0;
+    }
+    if (!drm.modeSet) {
+        drm.modeSet = 1;
+    } else {
+        drm.flipPending = 1;
+    }
+    return 1;
+}
+
+jlong getNativeWindowHandle(const char *v) {
+    if (drm.surface != NULL) {
+        return asJLong(drm.surface);
+    }
+    if (drm.fd < 0 && !initDrm(v)) {
+        return 0;
+    }
+    drm.gbm = gbm_create_device(drm.fd);
+    if (drm.gbm == NULL) {
+        fprintf(stderr, "DRM: cannot create the GBM device\n");
+        return 0;
+    }
+    drm.surface = gbm_surface_create(drm.gbm, drm.mode.hdisplay, drm.mode.vdisplay,
+                                     GBM_FORMAT_XRGB8888,
+                                     GBM_BO_USE_SCANOUT | GBM_BO_USE_RENDERING);
+    if (drm.surface == NULL) {
+        fprintf(stderr, "DRM: cannot create the GBM surface\n");
+    }
+    return asJLong(drm.surface);
+}
+
+jlong getEglDisplayHandle() {
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+        (PFNEGLGETPLATFORMDISPLAYEXTPROC) eglGetProcAddress("eglGetPlatformDisplayEXT");
+    EGLDisplay display = EGL_NO_DISPLAY;
+    if (getPlatformDisplay != NULL) {
+        display = getPlatformDisplay(EGL_PLATFORM_GBM_KHR, drm.gbm, NULL);
+    }
+    if (display == EGL_NO_DISPLAY) {
+        display = eglGetDisplay((EGLNativeDisplayType) drm.gbm);
+    }
+    return asJLong(display);
+}
+
+jboolean doEglInitialize(void *handle) {
+    return eglInitialize(handle, NULL, NULL) ? JNI_TRUE : JNI_FALSE;
+}
+
+jboolean doEglBindApi(int api) {
+    return eglBindAPI(api) ? JNI_TRUE : JNI_FALSE;
+}
+
+// the configuration has to match the format of the GBM surface
+jlong doEglChooseConfig(jlong eglDisplay, int *attribs) {
+    EGLint count = 0;
+    if (!eglChooseConfig(asPtr(eglDisplay), attribs, NULL, 0, &count) || count == 0) {
+        return -1;
+    }
+    EGLConfig *configs = malloc(count * sizeof(EGLConfig));
+    if (configs == NULL) {
+        return -1;
+    }
+    jlong result = -1;
+    if (eglChooseConfig(asPtr(eglDisplay), attribs, configs, count, &count) && count > 0) {
+        result = asJLong(configs[0]);
+        for (int i = 0; i < count; i++) {
+            EGLint visual = 0;
+            if (eglGetConfigAttrib(asPtr(eglDisplay), configs[i], EGL_NATIVE_VISUAL_ID, &visual)
+                    && visual == GBM_FORMAT_XRGB8888) {
+                result = asJLong(configs[i]);
+                break;
+            }
+        }
+    }
+    free(configs);
+    return result;
+}
+
+jlong doEglCreateWindowSurface(jlong eglDisplay, jlong config, jlong nativeWindow) {
+    EGLSurface surface = eglCreateWindowSurface(asPtr(eglDisplay), asPtr(config),
+                                                (EGLNativeWindowType) asPtr(nativeWindow), NULL);
+    return asJLong(surface);
+}
+
+jlong doEglCreateContext(jlong eglDisplay, jlong config) {
+    EGLint contextAttribs[] = { EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE };
+    EGLContext context = eglCreateContext(asPtr(eglDisplay), asPtr(config),
+                                          EGL_NO_CONTEXT, contextAttribs);
+    return asJLong(context);
+}
+
+jboolean doEglMakeCurrent(jlong eglDisplay, jlong drawSurface,
+                          jlong readSurface, jlong eglContext) {
+    return eglMakeCurrent(asPtr(eglDisplay), asPtr(drawSurface), asPtr(readSurface),
+                          asPtr(eglContext)) ? JNI_TRUE : JNI_FALSE;
+}
+
+jboolean doEglSwapBuffers(jlong eglDisplay, jlong eglSurface) {
+    if (!eglSwapBuffers(asPtr(eglDisplay), asPtr(eglSurface))) {
+        return JNI_FALSE;
+    }
+    struct gbm_bo *bo = gbm_surface_lock_front_buffer(drm.surface);
+    if (bo == NULL) {
+        return JNI_FALSE;
+    }
+    uint32_t fb = getFbForBo(bo);
+
+    // the previous frame is on screen once its flip is done, and the one
+    // before it can be rendered into again
+    waitForFlip();
+    if (drm.pendingBo != NULL) {
+        if (drm.scanoutBo != NULL) {
+            gbm_surface_release_buffer(drm.surface, drm.scanoutBo);
+        }
+        drm.scanoutBo = drm.pendingBo;
+        drm.pendingBo = NULL;
+    }
+
+    if (fb == 0 || !commitFrame(fb)) {
+        gbm_surface_release_buffer(drm.surface, bo);
+        return JNI_FALSE;
+    }
+    if (drm.flipPending) {
+        drm.pendingBo = bo;
+    } else {
+        drm.scanoutBo = bo;
+    }
+    return JNI_TRUE;
+}
+
+jint doGetNumberOfScreens() {
+    return 1;
+}
+
+jlong doGetHandle(jint UNUSED(idx)) {
+    return drm.connectorId;
+}
+
+jint doGetDepth(jint UNUSED(idx)) {
+    return 32;
+}
+
+jint doGetWidth(jint UNUSED(idx)) {
+    return drm.mode.hdisplay;
+}
+
+jint doGetHeight(jint UNUSED(idx)) {
+    return drm.mode.vdisplay;
+}
+
+jint doGetOffsetX(jint UNUSED(idx)) {
+    return 0;
+}
+
+jint doGetOffsetY(jint UNUSED(idx)) {
+    return 0;
+}
+
+jint doGetDpi(jint UNUSED(idx)) {
+    if (drm.mmWidth == 0) {
+        return 96;
+    }
+    return (jint) (drm.mode.hdisplay * 254 / (drm.mmWidth * 10));
+}
+
+jint doGetNativeFormat(jint UNUSED(idx)) {
+    return com_sun_glass_ui_Pixels_Format_BYTE_BGRA_PRE;
+}
+
+jfloat doGetScale(jint UNUSED(idx)) {
+    return 1.0f;
+}
+
+// The cursor uses the cursor plane of the CRTC, as a 64x64 buffer
+void doInitCursor(jint UNUSED(width), jint UNUSED(height)) {
+    if (drm.gbm == NULL || drm.cursorBo != NULL) {
+        return;
+    }
+    drm.cursorBo = gbm_bo_create(drm.gbm, CURSOR_SIZE, CURSOR_SIZE, GBM_FORMAT_ARGB8888,
+                                 GBM_BO_USE_CURSOR | GBM_BO_USE_WRITE);
+}
+
+void doSetCursorVisibility(jboolean val) {
+    if (drm.cursorBo == NULL) {
+        return;
+    }
+    drm.cursorVisible = val;
+    if (val) {
+        drmModeSetCursor(drm.fd, drm.crtcId, gbm_bo_get_handle(drm.cursorBo).u32,
+                         CURSOR_SIZE, CURSOR_SIZE);
+    } else {
+        drmModeSetCursor(drm.fd, drm.crtcId, 0, 0, 0);
+    }
+}
+
+void doSetLocation(jint x, jint y) {
+    if (drm.cursorBo != NULL) {
+        drmModeMoveCursor(drm.fd, drm.crtcId, x, y);
+    }
+}
+
+// img holds width * height 32 bit pixels of a square cursor
+void doSetCursorImage(jbyte *img, int length) {
+    if (drm.cursorBo == NULL) {
+        return;
+    }
+    uint32_t pixels[CURSOR_SIZE * CURSOR_SIZE];
+    int size = 1;
+    while ((size + 1) * (size + 1) * 4 <= length && size < CURSOR_SIZE) {
+        size++;
+    }
+    memset(pixels, 0, sizeof(pixels));
+    for (int y = 0; y < size; y++) {
+        memcpy(&pixels[y * CURSOR_SIZE], img + y * size * 4, size * 4);
+    }
+    gbm_bo_write(drm.cursorBo, pixels, sizeof(pixels));
+}
+
+// the screens are queried before the window handle, so the device is
+// opened when the platform is created
+JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_DRMPlatform_nOpen
+    (JNIEnv *env, jobject UNUSED(obj), jstring card) {
+    if (drm.fd >= 0) {
+        return JNI_TRUE;
+    }
+    const char *path = (*env)->GetStringUTFChars(env, card, NULL);
+    if (path == NULL) {
+        return JNI_FALSE;
+    }
+    int result = initDrm(path);
+    (*env)->ReleaseStringUTFChars(env, card, path);
+    if (!result && drm.fd >= 0) {
+        close(drm.fd);
+        drm.fd = -1;
+    }
+    return result ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_glass_ui_monocle_DRMPlatform_nGetOverlayPlaneCount
+    (JNIEnv *UNUSED(env), jobject UNUSED(obj)) {
+    return drm.overlayCount;
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_DRMPlatform_nSetOverlayPlane
+    (JNIEnv *UNUSED(env), jobject UNUSED(obj), jint plane, jint dmabufFd, jint fourcc,
+     jint width, jint height, jint stride, jint x, jint y, jint w, jint h) {
+    if (plane < 0 || plane >= drm.overlayCount) {
+        return JNI_FALSE;
+    }
+    uint32_t handle = 0;
+    if (drmPrimeFDToHandle(drm.fd, dmabufFd, &handle) != 0) {
+        fprintf(stderr, "DRM: cannot import the buffer: %s\n", strerror(errno));
+        return JNI_FALSE;
+    }
+    uint32_t handles[4] = { handle };
+    uint32_t pitches[4] = { (uint32_t) stride };
+    uint32_t offsets[4] = { 0 };
+    uint32_t fb = 0;
+    if (drmModeAddFB2(drm.fd, width, height, fourcc, handles, pitches, offsets, &fb, 0) != 0) {
+        fprintf(stderr, "DRM: cannot create an overlay framebuffer: %s\n", strerror(errno));
+        return JNI_FALSE;
+    }
+
+    pthread_mutex_lock(&drm.overlayLock);
+    Overlay *o = &drm.overlays[plane];
+    uint32_t oldFb = o->fb;
+    o->fb = fb;
+    o->handle = handle;
+    o->x = x;
+    o->y = y;
+    o->w = w;
+    o->h = h;
+    o->srcW = width;
+    o->srcH = height;
+    o->changed = 1;
+    pthread_mutex_unlock(&drm.overlayLock);
+
+    // the kernel keeps the framebuffer that is on screen alive
+    if (oldFb != 0) {
+        drmModeRmFB(drm.fd, oldFb);
+    }
+    return JNI_TRUE;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_monocle_DRMPlatform_nClearOverlayPlane
+    (JNIEnv *UNUSED(env), jobject UNUSED(obj), jint plane) {
+    if (plane < 0 || plane >= drm.overlayCount) {
+        return;
+    }
+    pthread_mutex_lock(&drm.overlayLock);
+    Overlay *o = &drm.overlays[plane];
+    uint32_t oldFb = o->fb;
+    o->fb = 0;
+    o->changed = 1;
+    pthread_mutex_unlock(&drm.overlayLock);
+    if (oldFb != 0) {
+        drmModeRmFB(drm.fd, oldFb);
+    }
+}
+
+// EGLPlatform's bridge finds the egl_ext.h functions in the global symbol
+// scope, while the JVM loads this library with local scope: promote it.
+JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM *UNUSED(vm), void *UNUSED(reserved)) {
+    Dl_info info;
+    if (dladdr((void *) &getNativeWindowHandle, &info) != 0 && info.dli_fname != NULL) {
+        if (dlopen(info.dli_fname, RTLD_LAZY | RTLD_GLOBAL | RTLD_NOLOAD) == NULL) {
+            fprintf(stderr, "DRM: cannot export the EGL functions: %s\n", dlerror());
+        }
+    }
+    return JNI_VERSION_1_6;
+}
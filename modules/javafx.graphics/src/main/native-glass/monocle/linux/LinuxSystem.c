@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -79,6 +79,35 @@ JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_LinuxSystem_read
     return (jlong) read((int) fdL, data + position, limit - position);
 }
 
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_LinuxSystem_readInputFrames
+  (JNIEnv *env, jobject UNUSED(obj), jlong fdL, jobject buf, jint position, jint limit,
+   jintArray lastSyncA) {
+    char *data = (*env)->GetDirectBufferAddress(env, buf);
+    jint lastSync = -1;
+    // evdev only returns whole events, and wakes readers up at the end of
+    // a frame, so this is normally a single read
+    while (lastSync < 0 && limit - position >= (jint) sizeof(struct input_event)) {
+        ssize_t bytesRead = read((int) fdL, data + position, limit - position);
+        if (bytesRead < 0 && errno == EINTR) {
+            continue;
+        } else if (bytesRead <= 0) {
+            return -1;
+        }
+        jint end = position + (jint) bytesRead;
+        for (; position + (jint) sizeof(struct input_event) <= end;
+             position += sizeof(struct input_event)) {
+            struct input_event *event = (struct input_event *) (data + position);
+            // the same test as LinuxEventBuffer.put()
+            if (event->type == EV_SYN && event->value == 0) {
+                lastSync = position + sizeof(struct input_event);
+            }
+        }
+        position = end;
+    }
+    monocle_returnInt(env, lastSyncA, lastSync);
+    return (jlong) position;
+}
+
 JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_LinuxSystem_sysconf
   (JNIEnv *UNUSED(env), jobject UNUSED(obj), jint name) {
     return (jlong) sysconf((int) name);
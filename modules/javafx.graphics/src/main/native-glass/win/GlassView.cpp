@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,7 +43,8 @@
 
 GlassView::GlassView(jobject jrefThis) :
     m_fullScreenWindow(NULL),
-    m_hostHwnd(NULL)
+    m_hostHwnd(NULL),
+    m_layeredBitmap(NULL)
 {
     m_grefThis = GetEnv()->NewGlobalRef(jrefThis);
 }
@@ -53,6 +54,15 @@ GlassView::~GlassView()
     if (m_grefThis) {
         GetEnv()->DeleteGlobalRef(m_grefThis);
     }
+    delete m_layeredBitmap;
+}
+
+CachedDIBitmap* GlassView::GetLayeredBitmap()
+{
+    if (!m_layeredBitmap) {
+        m_layeredBitmap = new CachedDIBitmap();
+    }
+    return m_layeredBitmap;
 }
 
 BOOL GlassView::Close()
@@ -471,11 +481,16 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinView__1uploadPixels
             bf.BlendOp = AC_SRC_OVER;
             bf.BlendFlags = 0;
 
-            DIBitmap bitmap(pixels);
+            // Transparent windows are updated on every frame, so their
+            // DIB section is kept rather than created for each upload
+            CachedDIBitmap *bitmap = view->GetLayeredBitmap();
+            if (!bitmap->Update(pixels)) {
+                return;
+            }
 
             HDC hdcDst = ::GetDC(NULL);
             HDC hdcSrc = ::CreateCompatibleDC(NULL);
-            HBITMAP oldBitmap = (HBITMAP)::SelectObject(hdcSrc, bitmap);
+            HBITMAP oldBitmap = (HBITMAP)::SelectObject(hdcSrc, *bitmap);
 
             ::UpdateLayeredWindow(hWnd, hdcDst, &ptDst, &size, hdcSrc, &ptSrc,
                     RGB(0, 0, 0), &bf, ULW_ALPHA);
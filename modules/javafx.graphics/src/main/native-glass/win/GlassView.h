@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@
 
 
 class BaseWnd;
+class CachedDIBitmap;
 class FullScreenWindow;
 
 class GlassView {
@@ -49,6 +50,8 @@ public:
     void EnableInputMethodEvents(BOOL enable);
     void FinishInputMethodComposition();
 
+    CachedDIBitmap* GetLayeredBitmap();
+
 private:
     jobject m_grefThis;
 
@@ -62,6 +65,9 @@ private:
     // InputMethod
     BOOL m_InputMethodEventsEnabled;
 
+    // Pixels last uploaded to a transparent (layered) window
+    CachedDIBitmap* m_layeredBitmap;
+
     void NotifyFullscreen(bool entered);
 };
 
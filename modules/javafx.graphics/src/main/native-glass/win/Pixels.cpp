@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -128,12 +128,66 @@ DIBitmap::DIBitmap(Pixels & pixels)
     ASSERT((HBITMAP)*this);
 }
 
+bool CachedDIBitmap::Update(Pixels & pixels)
+{
+    int const w = pixels.GetWidth();
+    int const h = pixels.GetHeight();
+    void * const src = pixels.GetBits();
+    if (w <= 0 || h <= 0 || w > (INT_MAX / 4) / h || !src) {
+        return false;
+    }
+
+    if (!bits || w != width || h != height) {
+        BITMAPINFOHEADER bmi = {0};
+        bmi.biSize = sizeof(bmi);
+        bmi.biWidth = w;
+        bmi.biHeight = -h;
+        bmi.biPlanes = 1;
+        bmi.biBitCount = 32;
+        bmi.biCompression = BI_RGB;
+        bmi.biSizeImage = w * h * 4;
+
+        bits = NULL;
+        HBITMAP hBitmap = ::CreateDIBSection(NULL, (BITMAPINFO *)&bmi, DIB_RGB_COLORS, &bits, NULL, 0);
+        if (!hBitmap || !bits) {
+            if (hBitmap) {
+                ::DeleteObject(hBitmap);
+            }
+            Attach(NULL);
+            bits = NULL;
+            width = height = 0;
+            return false;
+        }
+        Attach(hBitmap);
+        width = w;
+        height = h;
+    }
+
+    // GDI may still be reading the previous pixels
+    ::GdiFlush();
+    memcpy(bits, src, w * h * 4);
+    return true;
+}
+
 HICON Pixels::CreateIcon(JNIEnv *env, jobject jPixels, BOOL fIcon, jint x, jint y)
 {
+    // CreateIconIndirect copies the bitmaps, so the same ones serve every
+    // icon and cursor of a size, such as the frames of an animated cursor
+    static CachedDIBitmap bitmap;
+    static BaseBitmap mask;
+    static int maskWidth = 0, maskHeight = 0;
+
     Pixels pixels(env, jPixels);
 
-    Bitmap mask(pixels.GetWidth(), pixels.GetHeight());
-    DIBitmap bitmap(pixels);
+    if (!bitmap.Update(pixels)) {
+        return NULL;
+    }
+    if (!mask || maskWidth != pixels.GetWidth() || maskHeight != pixels.GetHeight()) {
+        Bitmap newMask(pixels.GetWidth(), pixels.GetHeight());
+        mask.Attach(newMask.Detach());
+        maskWidth = pixels.GetWidth();
+        maskHeight = pixels.GetHeight();
+    }
 
     ICONINFO iconInfo;
     memset(&iconInfo, 0, sizeof(ICONINFO));
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -66,6 +66,20 @@ class DIBitmap : public BaseBitmap {
         DIBitmap(Pixels & pixels);
 };
 
+// A 32-bit top-down DIB section that is kept between updates of the same
+// size, so that repeated uploads only copy their pixels into it
+class CachedDIBitmap : public BaseBitmap {
+    public:
+        CachedDIBitmap() : bits(NULL), width(0), height(0) {}
+
+        // Returns false if the DIB section could not be created
+        bool Update(Pixels & pixels);
+
+    private:
+        void *bits;
+        int width, height;
+};
+
 class Pixels {
     public:
         static HICON CreateIcon(JNIEnv *env, jobject jPixels, BOOL fIcon = TRUE, jint x = 0, jint y = 0);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -245,6 +245,8 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinRobot__1mouseWheel
 }
 
 void GetScreenCapture(jint x, jint y, jint width, jint height, jint *pixelData);
+static const jint *CaptureScreen(jint x, jint y, jint width, jint height);
+static void ConvertPixels(const jint *src, jint *dst, jint numPixels);
 
 /*
  * Class:     com_sun_glass_ui_win_WinRobot
@@ -295,92 +297,97 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinRobot__1getScreenCapture
         return;
     }
 
-    jint * pixelData = (jint *)(new BYTE[pixelDataSize]);
+    const jint *bits = CaptureScreen(x, y, width, height);
+    if (!bits) {
+        return;
+    }
 
+    // convert straight into the Java array
+    jint *pixelData = (jint *)env->GetPrimitiveArrayCritical(pixelArray, NULL);
     if (pixelData) {
-        GetScreenCapture(x, y, width, height, pixelData);
-
-        // copy pixels into Java array
-        env->SetIntArrayRegion(pixelArray, 0, numPixels, pixelData);
-        delete[] pixelData;
+        ConvertPixels(bits, pixelData, numPixels);
+        env->ReleasePrimitiveArrayCritical(pixelArray, pixelData, 0);
     }
 }
 
-void GetScreenCapture(jint x, jint y, jint width, jint height, jint *pixelData)
+// DIB section of the last capture size, kept for the next capture
+static HBITMAP hCaptureBitmap = NULL;
+static jint *pCaptureBits = NULL;
+static jint captureWidth = 0;
+static jint captureHeight = 0;
+
+/*
+ * Copies a region of the screen into a 32-bit top-down DIB section and
+ * returns its BGRX pixels, or NULL on failure. The pixels are valid until
+ * the next capture.
+ */
+static const jint *CaptureScreen(jint x, jint y, jint width, jint height)
 {
     HDC hdcScreen = ::CreateDC(TEXT("DISPLAY"), NULL, NULL, NULL);
-    HDC hdcMem = ::CreateCompatibleDC(hdcScreen);
-    HBITMAP hbitmap;
-    HBITMAP hOldBitmap;
-    HPALETTE hOldPalette = NULL;
-
-    // create an offscreen bitmap
-    hbitmap = ::CreateCompatibleBitmap(hdcScreen, width, height);
-    if (hbitmap == NULL) {
-        //TODO: OOM might be better?
-        //throw std::bad_alloc();
+    if (hdcScreen == NULL) {
+        return NULL;
     }
-    hOldBitmap = (HBITMAP)::SelectObject(hdcMem, hbitmap);
 
-    /* TODO: check this out
-    // REMIND: not multimon-friendly...
-    int primaryIndex = AwtWin32GraphicsDevice::GetDefaultDeviceIndex();
-    hOldPalette =
-        AwtWin32GraphicsDevice::SelectPalette(hdcMem, primaryIndex);
-    AwtWin32GraphicsDevice::RealizePalette(hdcMem, primaryIndex);
-    */
+    if (hCaptureBitmap == NULL || width != captureWidth || height != captureHeight) {
+        if (hCaptureBitmap != NULL) {
+            ::DeleteObject(hCaptureBitmap);
+            hCaptureBitmap = NULL;
+            pCaptureBits = NULL;
+        }
+
+        BITMAPINFO bmi;
+        ::memset(&bmi, 0, sizeof(bmi));
+        bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+        bmi.bmiHeader.biWidth = width;
+        bmi.bmiHeader.biHeight = -height; // negative height means a top-down DIB
+        bmi.bmiHeader.biPlanes = 1;
+        bmi.bmiHeader.biBitCount = 32;
+        bmi.bmiHeader.biCompression = BI_RGB;
+
+        void *pBits = NULL;
+        hCaptureBitmap = ::CreateDIBSection(hdcScreen, &bmi, DIB_RGB_COLORS, &pBits, NULL, 0);
+        if (hCaptureBitmap == NULL) {
+            ::DeleteDC(hdcScreen);
+            return NULL;
+        }
+        pCaptureBits = (jint *)pBits;
+        captureWidth = width;
+        captureHeight = height;
+    }
 
-    // copy screen image to offscreen bitmap
+    HDC hdcMem = ::CreateCompatibleDC(hdcScreen);
+    HBITMAP hOldBitmap = (HBITMAP)::SelectObject(hdcMem, hCaptureBitmap);
+
+    // copy screen image to the DIB section
     // CAPTUREBLT flag is required to capture WS_EX_LAYERED windows' contents
     // correctly on Win2K/XP
     static const DWORD dwRop = SRCCOPY|CAPTUREBLT;
-    ::BitBlt(hdcMem, 0, 0, width, height, hdcScreen, x, y, dwRop);
-
-    static const int BITS_PER_PIXEL = 32;
+    BOOL ok = ::BitBlt(hdcMem, 0, 0, width, height, hdcScreen, x, y, dwRop);
+    ::GdiFlush();
 
-    struct {
-        BITMAPINFOHEADER bmiHeader;
-        RGBQUAD          bmiColors[3];
-    } BitmapInfo;
-
-    // prepare BITMAPINFO for a 32-bit RGB bitmap
-    ::memset(&BitmapInfo, 0, sizeof(BitmapInfo));
-    BitmapInfo.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
-    BitmapInfo.bmiHeader.biWidth = width;
-    BitmapInfo.bmiHeader.biHeight = -height; // negative height means a top-down DIB
-    BitmapInfo.bmiHeader.biPlanes = 1;
-    BitmapInfo.bmiHeader.biBitCount = BITS_PER_PIXEL;
-    BitmapInfo.bmiHeader.biCompression = BI_BITFIELDS;
-
-    // Setup up color masks
-    static const RGBQUAD redMask =   {0, 0, 0xFF, 0};
-    static const RGBQUAD greenMask = {0, 0xFF, 0, 0};
-    static const RGBQUAD blueMask =  {0xFF, 0, 0, 0};
-
-    BitmapInfo.bmiColors[0] = redMask;
-    BitmapInfo.bmiColors[1] = greenMask;
-    BitmapInfo.bmiColors[2] = blueMask;
+    ::SelectObject(hdcMem, hOldBitmap);
+    ::DeleteDC(hdcMem);
+    ::DeleteDC(hdcScreen);
 
-    // Get the bitmap data in device-independent, 32-bit packed pixel format
-    ::GetDIBits(hdcMem, hbitmap, 0, height, pixelData, (BITMAPINFO *)&BitmapInfo, DIB_RGB_COLORS);
+    return ok ? pCaptureBits : NULL;
+}
 
-    // convert Win32 pixel format (BGRX) to Java format (ARGB)
+// convert Win32 pixel format (BGRX) to Java format (ARGB)
+static void ConvertPixels(const jint *src, jint *dst, jint numPixels)
+{
     ASSERT(sizeof(jint) == sizeof(RGBQUAD));
-    jint numPixels = width * height;
-    jint *pPixel = pixelData;
-    for(int nPixel = 0; nPixel < numPixels; nPixel++) {
-        RGBQUAD * prgbq = (RGBQUAD *) pPixel;
-        *pPixel++ = WinToJavaPixel(prgbq->rgbRed, prgbq->rgbGreen, prgbq->rgbBlue);
+    for (int nPixel = 0; nPixel < numPixels; nPixel++) {
+        const RGBQUAD *prgbq = (const RGBQUAD *)&src[nPixel];
+        dst[nPixel] = WinToJavaPixel(prgbq->rgbRed, prgbq->rgbGreen, prgbq->rgbBlue);
     }
+}
 
-    // free all the GDI objects we made
-    ::SelectObject(hdcMem, hOldBitmap);
-    if (hOldPalette != NULL) {
-        ::SelectPalette(hdcMem, hOldPalette, FALSE);
+void GetScreenCapture(jint x, jint y, jint width, jint height, jint *pixelData)
+{
+    const jint *bits = CaptureScreen(x, y, width, height);
+    if (bits) {
+        ConvertPixels(bits, pixelData, width * height);
     }
-    ::DeleteObject(hbitmap);
-    ::DeleteDC(hdcMem);
-    ::DeleteDC(hdcScreen);
 }
 
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -88,12 +88,22 @@ GetEnv(JavaVM *vm, jint version) {
 #undef MAX
 #define MAX(a,b)        ((a) > (b) ? (a) : (b))
 
+/*
+ * Thread safety: the statics below are written once, when the library is
+ * loaded and the JPEGImageLoader class is initialized, and only read after
+ * that. All the decoding state lives in the imageIOData of each loader
+ * (reached through cinfo->client_data), so separate loaders can decode
+ * on separate threads at the same time. A single loader is not meant to
+ * be used from several threads at once.
+ */
+
 /* Cached Java method IDs */
 static jmethodID InputStream_readID;
 static jmethodID InputStream_skipID;
 static jmethodID JPEGImageLoader_setInputAttributesID;
 static jmethodID JPEGImageLoader_setOutputAttributesID;
 static jmethodID JPEGImageLoader_updateImageProgressID;
+static jmethodID JPEGImageLoader_updateImagePreviewID;
 static jmethodID JPEGImageLoader_emitWarningID;
 
 /* Initialize the Java VM instance variable when the library is
@@ -1259,6 +1269,14 @@ JNIEXPORT void JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_initJPEGMeth
         return;
     }
 
+    JPEGImageLoader_updateImagePreviewID = (*env)->GetMethodID(env,
+            cls,
+            "updateImagePreview",
+            "(I)V");
+    if ((*env)->ExceptionCheck(env)) {
+        return;
+    }
+
     JPEGImageLoader_emitWarningID = (*env)->GetMethodID(env,
             cls,
             "emitWarning",
@@ -1526,7 +1544,8 @@ JNIEXPORT jlong JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_initDecompr
 }
 
 JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompression
-(JNIEnv *env, jobject this, jlong ptr, jint outCS, jint dest_width, jint dest_height) {
+(JNIEnv *env, jobject this, jlong ptr, jint outCS, jint dest_width, jint dest_height,
+ jboolean preview) {
     imageIODataPtr data = (imageIODataPtr) jlong_to_ptr(ptr);
     j_decompress_ptr cinfo = (j_decompress_ptr) data->jpegObj;
     struct jpeg_source_mgr *src = cinfo->src;
@@ -1592,6 +1611,11 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
         cinfo->scale_denom = 8;
     }
 
+    /* A progressive image is decoded in buffered-image mode when a preview
+     * is wanted, so that its first scan can be output before the others
+     * are read. */
+    cinfo->buffered_image = (preview == JNI_TRUE) && jpeg_has_multiple_scans(cinfo);
+
     jpeg_start_decompress(cinfo);
 
     RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
@@ -1604,12 +1628,114 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
 }
 
 #define SAFE_TO_MULT(a, b) (((a) > 0) && ((b) >= 0) && ((0x7fffffff / (a)) > (b)))
+
+/*
+ * Maximum number of scanlines decoded before they are copied to the Java
+ * array. Decoding bands of rows lets libjpeg process several rows per call
+ * (a whole iMCU row with libjpeg-turbo) and pins the array once per band
+ * instead of once per row.
+ */
+#define SCANLINE_BAND_HEIGHT 16
+
+/*
+ * Percentage of the output rows decoded between two progress updates.
+ */
+#define PROGRESS_PERCENT_STEP 5
+
 #define SAFE_FREE(PTR)  \
     if ((PTR) != NULL) {  \
         free(PTR);     \
         (PTR) = NULL;     \
     }
 
+/*
+ * Returns the number of output rows to decode between two progress updates.
+ */
+static int progressStep(j_decompress_ptr cinfo) {
+    int step = cinfo->output_height / (100 / PROGRESS_PERCENT_STEP);
+    return step > 0 ? step : 1;
+}
+
+/*
+ * Calls back the loader with the arrays released around the call.
+ * Returns NOT_OK with a pending exception if the call or the pinning fails.
+ */
+static int callLoader(JNIEnv *env, jobject this, imageIODataPtr data,
+                      j_decompress_ptr cinfo, jmethodID method, int arg) {
+    RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
+    (*env)->CallVoidMethod(env, this, method, arg);
+    if ((*env)->ExceptionCheck(env)) {
+        return NOT_OK;
+    }
+    if (GET_ARRAYS(env, data, &cinfo->src->next_input_byte) == NOT_OK) {
+        ThrowByName(env,
+                  "java/io/IOException",
+                  "Array pin failed");
+        return NOT_OK;
+    }
+    return OK;
+}
+
+static int updateProgress(JNIEnv *env, jobject this, imageIODataPtr data,
+                          j_decompress_ptr cinfo, int lines) {
+    return callLoader(env, this, data, cinfo,
+                      JPEGImageLoader_updateImageProgressID, lines);
+}
+
+/*
+ * In buffered-image mode, reads the rest of the stream and starts the output
+ * pass of the final scan. Does nothing for the other images.
+ */
+static void startFinalOutput(j_decompress_ptr cinfo) {
+    int ret;
+    if (cinfo->buffered_image) {
+        do {
+            ret = jpeg_consume_input(cinfo);
+        } while (ret != JPEG_REACHED_EOI && ret != JPEG_SUSPENDED);
+        jpeg_start_output(cinfo, cinfo->input_scan_number);
+    }
+}
+
+static void finishFinalOutput(j_decompress_ptr cinfo) {
+    if (cinfo->buffered_image) {
+        jpeg_finish_output(cinfo);
+    }
+}
+
+/*
+ * Decodes the remaining rows of the current output pass into body, a band
+ * of rows per call. Progress is reported every PROGRESS_PERCENT_STEP.
+ */
+static int readRowsDirect(JNIEnv *env, jobject this, imageIODataPtr data,
+                          j_decompress_ptr cinfo, JSAMPLE *body,
+                          int bytes_per_row, jboolean report_progress) {
+    JSAMPROW band_rows[SCANLINE_BAND_HEIGHT];
+    int next_progress = 0;
+
+    while (cinfo->output_scanline < cinfo->output_height) {
+        int max_lines = cinfo->output_height - cinfo->output_scanline;
+        int i;
+        if (report_progress == JNI_TRUE &&
+                (int) cinfo->output_scanline >= next_progress) {
+            if (updateProgress(env, this, data, cinfo,
+                               cinfo->output_scanline) == NOT_OK) {
+                return NOT_OK;
+            }
+            next_progress = cinfo->output_scanline + progressStep(cinfo);
+        }
+
+        if (max_lines > SCANLINE_BAND_HEIGHT) {
+            max_lines = SCANLINE_BAND_HEIGHT;
+        }
+        for (i = 0; i < max_lines; i++) {
+            band_rows[i] = body +
+                    (size_t) (cinfo->output_scanline + i) * bytes_per_row;
+        }
+        jpeg_read_scanlines(cinfo, band_rows, max_lines);
+    }
+    return OK;
+}
+
 JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompressIndirect
 (JNIEnv *env, jobject this, jlong ptr, jboolean report_progress, jbyteArray barray) {
     imageIODataPtr data = (imageIODataPtr) jlong_to_ptr(ptr);
@@ -1619,6 +1745,10 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
     int bytes_per_row = cinfo->output_width * cinfo->output_components;
     int offset = 0;
     JSAMPROW scanline_ptr = NULL;
+    JSAMPROW band_rows[SCANLINE_BAND_HEIGHT];
+    int band_height;
+    int next_progress = 0;
+    int i;
 
     if (!SAFE_TO_MULT(cinfo->output_width, cinfo->output_components) ||
         !SAFE_TO_MULT(bytes_per_row, cinfo->output_height) ||
@@ -1655,7 +1785,9 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
         return JNI_FALSE;
     }
 
-    scanline_ptr = (JSAMPROW) malloc(bytes_per_row * sizeof(JSAMPLE));
+    band_height = cinfo->output_height < SCANLINE_BAND_HEIGHT ?
+            cinfo->output_height : SCANLINE_BAND_HEIGHT;
+    scanline_ptr = (JSAMPROW) malloc(bytes_per_row * band_height * sizeof(JSAMPLE));
     if (scanline_ptr == NULL) {
         RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
         ThrowByName(env,
@@ -1663,29 +1795,38 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
                 "Reading JPEG Stream");
         return JNI_FALSE;
     }
+    for (i = 0; i < band_height; i++) {
+        band_rows[i] = scanline_ptr + i * bytes_per_row;
+    }
+
+    startFinalOutput(cinfo);
 
     while (cinfo->output_scanline < cinfo->output_height) {
-        int num_scanlines;
-        if (report_progress == JNI_TRUE) {
-            RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
-            (*env)->CallVoidMethod(env, this,
-                    JPEGImageLoader_updateImageProgressID,
-                    cinfo->output_scanline);
-            if ((*env)->ExceptionCheck(env)) {
+        int num_scanlines = 0;
+        int max_lines = cinfo->output_height - cinfo->output_scanline;
+        if (report_progress == JNI_TRUE &&
+                (int) cinfo->output_scanline >= next_progress) {
+            if (updateProgress(env, this, data, cinfo,
+                               cinfo->output_scanline) == NOT_OK) {
                 SAFE_FREE(scanline_ptr);
                 return JNI_FALSE;
             }
-            if (GET_ARRAYS(env, data, &cinfo->src->next_input_byte) == NOT_OK) {
-                SAFE_FREE(scanline_ptr);
-                ThrowByName(env,
-                          "java/io/IOException",
-                          "Array pin failed");
-                return JNI_FALSE;
-            }
+            next_progress = cinfo->output_scanline + progressStep(cinfo);
         }
 
-        num_scanlines = jpeg_read_scanlines(cinfo, &scanline_ptr, 1);
-        if (num_scanlines == 1) {
+        if (max_lines > band_height) {
+            max_lines = band_height;
+        }
+        /* libjpeg may return fewer lines than asked for, fill the band */
+        while (num_scanlines < max_lines) {
+            int lines = jpeg_read_scanlines(cinfo, band_rows + num_scanlines,
+                                            max_lines - num_scanlines);
+            if (lines <= 0) {
+                break;
+            }
+            num_scanlines += lines;
+        }
+        if (num_scanlines > 0) {
             jbyte *body = (*env)->GetPrimitiveArrayCritical(env, barray, NULL);
             if (body == NULL) {
                 RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
@@ -1693,31 +1834,249 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
                 SAFE_FREE(scanline_ptr);
                 return JNI_FALSE;
             }
-            memcpy(body+offset,scanline_ptr, bytes_per_row);
+            memcpy(body+offset, scanline_ptr, bytes_per_row * num_scanlines);
             (*env)->ReleasePrimitiveArrayCritical(env, barray, body, JNI_ABORT);
-            offset += bytes_per_row;
+            offset += bytes_per_row * num_scanlines;
         }
     }
     SAFE_FREE(scanline_ptr);
+    finishFinalOutput(cinfo);
+
+    if (report_progress == JNI_TRUE &&
+            updateProgress(env, this, data, cinfo,
+                           cinfo->output_height) == NOT_OK) {
+        return JNI_FALSE;
+    }
+
+    jpeg_finish_decompress(cinfo);
 
-    if (report_progress == JNI_TRUE) {
+    RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
+    return JNI_TRUE;
+}
+
+/*
+ * Decodes the rows straight into a direct buffer. Unlike a Java array, the
+ * buffer does not move while the stream is read, so libjpeg can write each
+ * band of rows to its final place without an intermediate copy.
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompressDirect
+(JNIEnv *env, jobject this, jlong ptr, jboolean report_progress, jobject jbuffer) {
+    imageIODataPtr data = (imageIODataPtr) jlong_to_ptr(ptr);
+    j_decompress_ptr cinfo = (j_decompress_ptr) data->jpegObj;
+    sun_jpeg_error_ptr jerr;
+    int bytes_per_row = cinfo->output_width * cinfo->output_components;
+    JSAMPLE *body = (JSAMPLE *) (*env)->GetDirectBufferAddress(env, jbuffer);
+
+    if (!SAFE_TO_MULT(cinfo->output_width, cinfo->output_components) ||
+        !SAFE_TO_MULT(bytes_per_row, cinfo->output_height) ||
+        body == NULL ||
+        ((*env)->GetDirectBufferCapacity(env, jbuffer) <
+         (jlong) bytes_per_row * cinfo->output_height))
+     {
+        ThrowByName(env,
+                "java/lang/OutOfMemoryError",
+                "Reading JPEG Stream");
+        return JNI_FALSE;
+    }
+
+    if (GET_ARRAYS(env, data, &cinfo->src->next_input_byte) == NOT_OK) {
+        ThrowByName(env,
+                "java/io/IOException",
+                "Array pin failed");
+        return JNI_FALSE;
+    }
+
+    /* Establish the setjmp return context for sun_jpeg_error_exit to use. */
+    jerr = (sun_jpeg_error_ptr) cinfo->err;
+
+    if (setjmp(jerr->setjmp_buffer)) {
+        /* If we get here, the JPEG code has signaled an error
+           while reading. */
+        if (!(*env)->ExceptionOccurred(env)) {
+            char buffer[JMSG_LENGTH_MAX];
+            (*cinfo->err->format_message) ((struct jpeg_common_struct *) cinfo,
+                    buffer);
+            ThrowByName(env, "java/io/IOException", buffer);
+        }
         RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
-        (*env)->CallVoidMethod(env, this,
-                JPEGImageLoader_updateImageProgressID,
-                cinfo->output_height);
-        if ((*env)->ExceptionCheck(env)) {
+        return JNI_FALSE;
+    }
+
+    if (cinfo->buffered_image) {
+        /* Output the first scan, usually the DC coefficients only, as a
+         * preview of the image. */
+        int ret;
+        do {
+            ret = jpeg_consume_input(cinfo);
+        } while (ret != JPEG_SCAN_COMPLETED &&
+                 ret != JPEG_REACHED_EOI && ret != JPEG_SUSPENDED);
+        jpeg_start_output(cinfo, 1);
+        if (readRowsDirect(env, this, data, cinfo, body, bytes_per_row,
+                           JNI_FALSE) == NOT_OK) {
             return JNI_FALSE;
         }
-        if (GET_ARRAYS(env, data, &cinfo->src->next_input_byte) == NOT_OK) {
-            ThrowByName(env,
-                "java/io/IOException",
-                "Array pin failed");
+        jpeg_finish_output(cinfo);
+        if (callLoader(env, this, data, cinfo,
+                       JPEGImageLoader_updateImagePreviewID, 1) == NOT_OK) {
             return JNI_FALSE;
         }
     }
 
+    startFinalOutput(cinfo);
+    if (readRowsDirect(env, this, data, cinfo, body, bytes_per_row,
+                       report_progress) == NOT_OK) {
+        return JNI_FALSE;
+    }
+    finishFinalOutput(cinfo);
+
+    if (report_progress == JNI_TRUE &&
+            updateProgress(env, this, data, cinfo,
+                           cinfo->output_height) == NOT_OK) {
+        return JNI_FALSE;
+    }
+
     jpeg_finish_decompress(cinfo);
 
     RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
     return JNI_TRUE;
 }
+
+/*
+ * Decodes only the w x h window at (x, y) of the output image into a direct
+ * buffer holding rows of w pixels. With libjpeg-turbo the columns are
+ * cropped and the rows above the window skipped without being decoded;
+ * the bundled libjpeg decodes and drops them. The rows below the window are
+ * never decoded.
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompressRegion
+(JNIEnv *env, jobject this, jlong ptr, jboolean report_progress,
+ jint x, jint y, jint w, jint h, jobject jbuffer) {
+    imageIODataPtr data = (imageIODataPtr) jlong_to_ptr(ptr);
+    j_decompress_ptr cinfo = (j_decompress_ptr) data->jpegObj;
+    sun_jpeg_error_ptr jerr;
+    JSAMPLE *body = (JSAMPLE *) (*env)->GetDirectBufferAddress(env, jbuffer);
+    JSAMPROW scanline_ptr = NULL;
+    JSAMPROW band_rows[SCANLINE_BAND_HEIGHT];
+    JDIMENSION x_offset = (JDIMENSION) x;
+    JDIMENSION width;
+    int bytes_per_row;
+    int region_bytes_per_row = w * cinfo->output_components;
+    int row_offset;
+    int band_height;
+    int last_line = y + h;
+    int next_progress = 0;
+    int i;
+
+    if (x < 0 || y < 0 || w <= 0 || h <= 0 ||
+        x > (int) cinfo->output_width - w ||
+        y > (int) cinfo->output_height - h ||
+        !SAFE_TO_MULT(w, cinfo->output_components) ||
+        !SAFE_TO_MULT(region_bytes_per_row, h) ||
+        body == NULL ||
+        ((*env)->GetDirectBufferCapacity(env, jbuffer) <
+         (jlong) region_bytes_per_row * h))
+     {
+        ThrowByName(env,
+                "java/lang/IllegalArgumentException",
+                "Invalid JPEG region");
+        return JNI_FALSE;
+    }
+
+    if (GET_ARRAYS(env, data, &cinfo->src->next_input_byte) == NOT_OK) {
+        ThrowByName(env,
+                "java/io/IOException",
+                "Array pin failed");
+        return JNI_FALSE;
+    }
+
+    /* Establish the setjmp return context for sun_jpeg_error_exit to use. */
+    jerr = (sun_jpeg_error_ptr) cinfo->err;
+
+    if (setjmp(jerr->setjmp_buffer)) {
+        /* If we get here, the JPEG code has signaled an error
+           while reading. */
+        if (!(*env)->ExceptionOccurred(env)) {
+            char buffer[JMSG_LENGTH_MAX];
+            (*cinfo->err->format_message) ((struct jpeg_common_struct *) cinfo,
+                    buffer);
+            ThrowByName(env, "java/io/IOException", buffer);
+        }
+        SAFE_FREE(scanline_ptr);
+        RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
+        return JNI_FALSE;
+    }
+
+    startFinalOutput(cinfo);
+
+#ifdef LIBJPEG_TURBO_VERSION
+    /* The crop is widened to iMCU boundaries, which moves x_offset left. */
+    width = (JDIMENSION) w;
+    jpeg_crop_scanline(cinfo, &x_offset, &width);
+    if (y > 0) {
+        jpeg_skip_scanlines(cinfo, (JDIMENSION) y);
+    }
+#else
+    x_offset = 0;
+    width = cinfo->output_width;
+#endif
+    bytes_per_row = width * cinfo->output_components;
+    row_offset = (x - (int) x_offset) * cinfo->output_components;
+
+    band_height = h < SCANLINE_BAND_HEIGHT ? h : SCANLINE_BAND_HEIGHT;
+    scanline_ptr = (JSAMPROW) malloc((size_t) bytes_per_row * band_height * sizeof(JSAMPLE));
+    if (scanline_ptr == NULL) {
+        RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
+        ThrowByName(env,
+                "java/lang/OutOfMemoryError",
+                "Reading JPEG Stream");
+        return JNI_FALSE;
+    }
+    for (i = 0; i < band_height; i++) {
+        band_rows[i] = scanline_ptr + i * bytes_per_row;
+    }
+
+    while ((int) cinfo->output_scanline < last_line) {
+        int first = cinfo->output_scanline;
+        int max_lines = last_line - first;
+        int num_scanlines;
+        if (report_progress == JNI_TRUE && first >= next_progress) {
+            if (updateProgress(env, this, data, cinfo, first) == NOT_OK) {
+                SAFE_FREE(scanline_ptr);
+                return JNI_FALSE;
+            }
+            next_progress = first + progressStep(cinfo);
+        }
+
+        if (max_lines > band_height) {
+            max_lines = band_height;
+        }
+        if (first < y && max_lines > y - first) {
+            /* stop the band at the top of the window */
+            max_lines = y - first;
+        }
+        num_scanlines = jpeg_read_scanlines(cinfo, band_rows, max_lines);
+        for (i = 0; i < num_scanlines; i++) {
+            int line = first + i;
+            if (line >= y) {
+                memcpy(body + (size_t) (line - y) * region_bytes_per_row,
+                       band_rows[i] + row_offset, region_bytes_per_row);
+            }
+        }
+        if (num_scanlines <= 0) {
+            break;
+        }
+    }
+    SAFE_FREE(scanline_ptr);
+
+    if (report_progress == JNI_TRUE &&
+            updateProgress(env, this, data, cinfo,
+                           cinfo->output_height) == NOT_OK) {
+        return JNI_FALSE;
+    }
+
+    /* the rows below the window are not needed */
+    jpeg_abort_decompress(cinfo);
+
+    RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
+    return JNI_TRUE;
+}
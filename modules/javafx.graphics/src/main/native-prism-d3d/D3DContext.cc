@@ -157,8 +157,7 @@ int D3DContext::release() {
                 pd3dDevice, pd3dObject);
     ReleaseContextResources(RELEASE_ALL);
     for (int i = 0; i < NUM_TEXTURE_CACHE; i++) {
-        SAFE_RELEASE(textureCache[i].surface);
-        SAFE_RELEASE(textureCache[i].texture);
+        textureCache[i].release();
     }
     SAFE_RELEASE(pd3dDevice);
 
@@ -287,6 +286,35 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_d3d_D3DContext_nBuildNativeGeometr
     return result;
 }
 
+/*
+ * Class:     com_sun_prism_d3d_D3DContext
+ * Method:    nUpdateNativeVertices
+ * Signature: (JJ[FIII)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_d3d_D3DContext_nUpdateNativeVertices
+  (JNIEnv *env, jclass, jlong ctx, jlong nativeMesh, jfloatArray vb, jint vbSize,
+   jint dirtyFrom, jint dirtyTo)
+{
+    TraceLn(NWT_TRACE_INFO, "D3DContext_nUpdateNativeVertices");
+    D3DMesh *mesh = (D3DMesh *) jlong_to_ptr(nativeMesh);
+    RETURN_STATUS_IF_NULL(mesh, JNI_FALSE);
+
+    if (vbSize < 0 || (UINT) vbSize > (UINT) env->GetArrayLength(vb)) {
+        return JNI_FALSE;
+    }
+
+    float *vertexBuffer = (float *) (env->GetPrimitiveArrayCritical(vb, NULL));
+    if (vertexBuffer == NULL) {
+        return JNI_FALSE;
+    }
+
+    // The whole buffer is written with a discarding lock, see D3DMesh
+    boolean result = mesh->updateVertices(vertexBuffer, (UINT) vbSize);
+    env->ReleasePrimitiveArrayCritical(vb, vertexBuffer, JNI_ABORT);
+
+    return result;
+}
+
 /*
  * Class:     com_sun_prism_d3d_D3DContext
  * Method:    nCreateD3DPhongMaterial
@@ -626,6 +654,162 @@ HRESULT D3DContext::setDeviceParametersFor3D() {
     return res;
 }
 
+/*
+ * The timestamp queries of one frame measured by D3DGPUTimer. The
+ * frequency and disjoint queries tell how to convert the timestamps and
+ * whether they can be compared at all.
+ */
+struct D3DTimerFrame {
+    IDirect3DQuery9 *disjoint;
+    IDirect3DQuery9 *frequency;
+    IDirect3DQuery9 **timestamps;
+    int numTimestamps;
+
+    D3DTimerFrame(int num) : disjoint(NULL), frequency(NULL), numTimestamps(num) {
+        timestamps = new IDirect3DQuery9*[num];
+        ZeroMemory(timestamps, num * sizeof(IDirect3DQuery9*));
+    }
+
+    ~D3DTimerFrame() {
+        for (int i = 0; i < numTimestamps; i++) {
+            SAFE_RELEASE(timestamps[i]);
+        }
+        delete[] timestamps;
+        SAFE_RELEASE(frequency);
+        SAFE_RELEASE(disjoint);
+    }
+};
+
+/*
+ * Class:     com_sun_prism_d3d_D3DContext
+ * Method:    nCreateTimerFrame
+ * Signature: (JI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_sun_prism_d3d_D3DContext_nCreateTimerFrame
+  (JNIEnv *, jclass, jlong ctx, jint numTimestamps)
+{
+    TraceLn(NWT_TRACE_INFO, "D3DContext_nCreateTimerFrame");
+    D3DContext *pCtx = (D3DContext*)jlong_to_ptr(ctx);
+    RETURN_STATUS_IF_NULL(pCtx, 0L);
+    IDirect3DDevice9Ex *pd3dDevice = pCtx->Get3DDevice();
+    RETURN_STATUS_IF_NULL(pd3dDevice, 0L);
+
+    D3DTimerFrame *frame = new D3DTimerFrame(numTimestamps);
+    bool created =
+        SUCCEEDED(pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMPDISJOINT, &frame->disjoint)) &&
+        SUCCEEDED(pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMPFREQ, &frame->frequency));
+    for (int i = 0; created && i < numTimestamps; i++) {
+        created = SUCCEEDED(pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMP, &frame->timestamps[i]));
+    }
+    if (!created) {
+        delete frame;
+        return 0L;
+    }
+    return ptr_to_jlong(frame);
+}
+
+/*
+ * Class:     com_sun_prism_d3d_D3DContext
+ * Method:    nBeginTimerFrame
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_d3d_D3DContext_nBeginTimerFrame
+  (JNIEnv *, jclass, jlong nativeFrame)
+{
+    D3DTimerFrame *frame = (D3DTimerFrame*)jlong_to_ptr(nativeFrame);
+    RETURN_IF_NULL(frame);
+
+    frame->disjoint->Issue(D3DISSUE_BEGIN);
+    frame->frequency->Issue(D3DISSUE_END);
+    frame->timestamps[0]->Issue(D3DISSUE_END);
+}
+
+/*
+ * Class:     com_sun_prism_d3d_D3DContext
+ * Method:    nTimestamp
+ * Signature: (JI)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_d3d_D3DContext_nTimestamp
+  (JNIEnv *, jclass, jlong nativeFrame, jint index)
+{
+    D3DTimerFrame *frame = (D3DTimerFrame*)jlong_to_ptr(nativeFrame);
+    RETURN_IF_NULL(frame);
+
+    if (index >= 0 && index < frame->numTimestamps) {
+        frame->timestamps[index]->Issue(D3DISSUE_END);
+    }
+}
+
+/*
+ * Class:     com_sun_prism_d3d_D3DContext
+ * Method:    nEndTimerFrame
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_d3d_D3DContext_nEndTimerFrame
+  (JNIEnv *, jclass, jlong nativeFrame)
+{
+    D3DTimerFrame *frame = (D3DTimerFrame*)jlong_to_ptr(nativeFrame);
+    RETURN_IF_NULL(frame);
+
+    frame->disjoint->Issue(D3DISSUE_END);
+}
+
+/*
+ * Class:     com_sun_prism_d3d_D3DContext
+ * Method:    nGetTimerFrameResults
+ * Signature: (J[J)I
+ */
+JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DContext_nGetTimerFrameResults
+  (JNIEnv *env, jclass, jlong nativeFrame, jlongArray nanos)
+{
+    D3DTimerFrame *frame = (D3DTimerFrame*)jlong_to_ptr(nativeFrame);
+    RETURN_STATUS_IF_NULL(frame, com_sun_prism_d3d_D3DContext_TIMER_RESULT_INVALID);
+
+    // The disjoint query completes last, after all timestamps of the frame
+    BOOL disjoint;
+    HRESULT res = frame->disjoint->GetData(&disjoint, sizeof(disjoint), 0);
+    if (res == S_FALSE) {
+        return com_sun_prism_d3d_D3DContext_TIMER_RESULT_NOT_READY;
+    }
+    UINT64 frequency;
+    if (FAILED(res) || disjoint ||
+        frame->frequency->GetData(&frequency, sizeof(frequency), 0) != S_OK ||
+        frequency == 0)
+    {
+        return com_sun_prism_d3d_D3DContext_TIMER_RESULT_INVALID;
+    }
+
+    int count = env->GetArrayLength(nanos);
+    if (count > frame->numTimestamps) {
+        count = frame->numTimestamps;
+    }
+    for (int i = 0; i < count; i++) {
+        UINT64 ticks;
+        if (frame->timestamps[i]->GetData(&ticks, sizeof(ticks), 0) != S_OK) {
+            return com_sun_prism_d3d_D3DContext_TIMER_RESULT_INVALID;
+        }
+        // Split to keep the conversion from overflowing
+        jlong value = (jlong)((ticks / frequency) * 1000000000ULL
+                + (ticks % frequency) * 1000000000ULL / frequency);
+        env->SetLongArrayRegion(nanos, i, 1, &value);
+    }
+    return com_sun_prism_d3d_D3DContext_TIMER_RESULT_VALID;
+}
+
+/*
+ * Class:     com_sun_prism_d3d_D3DContext
+ * Method:    nReleaseTimerFrame
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_d3d_D3DContext_nReleaseTimerFrame
+  (JNIEnv *, jclass, jlong nativeFrame)
+{
+    D3DTimerFrame *frame = (D3DTimerFrame*)jlong_to_ptr(nativeFrame);
+    if (frame) {
+        delete frame;
+    }
+}
+
 HRESULT D3DContext::createIndexBuffer() {
     RETURN_STATUS_IF_NULL(pd3dDevice, S_FALSE);
     HRESULT hr = pd3dDevice->CreateIndexBuffer(sizeof(short) * 6 * MAX_BATCH_QUADS,
@@ -1294,33 +1478,96 @@ IDirect3DTexture9 *createTexture(D3DFORMAT format, int w, int h, IDirect3DSurfac
     return texture;
 }
 
-IDirect3DTexture9 *D3DContext::TextureUpdateCache::getTexture(
-    D3DFORMAT format, int w, int h, IDirect3DSurface9 **pSurface, IDirect3DDevice9Ex *dev)
+/*
+ * Move on to the next staging texture of the ring and make sure it holds at
+ * least width x height pixels, growing it to the next STAGING_SIZE_BUCKET
+ * multiple if needed.
+ */
+D3DContext::StagingTexture *D3DContext::TextureUpdateCache::nextSlot(
+    D3DFORMAT format, int w, int h, IDirect3DDevice9Ex *dev)
 {
-    if (w <= width && h <= height && texture != NULL) {
-        if (pSurface) *pSurface = surface;
-        return texture;
+    current = (current + 1) % NUM_STAGING_TEXTURES;
+    shelfX = shelfY = shelfHeight = 0;
+
+    StagingTexture &slot = slots[current];
+    if (w <= slot.width && h <= slot.height && slot.texture != NULL) {
+        return &slot;
     }
-    // grow the cache texture so that the new texture is
+    // grow the staging texture so that the new texture is
     // at least as large as the previous one
-    if (w < width)  w = width;
-    if (h < height) h = height;
-    SAFE_RELEASE(surface);
-    SAFE_RELEASE(texture);
-    texture = createTexture(format, w, h, &surface, dev);
-    if (texture == NULL) {
+    w = (w + STAGING_SIZE_BUCKET - 1) / STAGING_SIZE_BUCKET * STAGING_SIZE_BUCKET;
+    h = (h + STAGING_SIZE_BUCKET - 1) / STAGING_SIZE_BUCKET * STAGING_SIZE_BUCKET;
+    if (w < slot.width)  w = slot.width;
+    if (h < slot.height) h = slot.height;
+    SAFE_RELEASE(slot.surface);
+    SAFE_RELEASE(slot.texture);
+    slot.width = slot.height = 0;
+    slot.texture = createTexture(format, w, h, &slot.surface, dev);
+    if (slot.texture == NULL) {
         return NULL;
     }
-    width = w;
-    height = h;
-    if (pSurface) *pSurface = surface;
-    return texture;
+    slot.width = w;
+    slot.height = h;
+    return &slot;
+}
+
+/*
+ * Return a staging texture with room for a width x height update at
+ * *pOrigin. Small updates share the current texture, packed in rows
+ * ("shelves"), until it is full; every other update moves on to the next
+ * texture of the ring.
+ */
+IDirect3DTexture9 *D3DContext::TextureUpdateCache::getTexture(
+    D3DFORMAT format, int w, int h, IDirect3DSurface9 **pSurface, POINT *pOrigin,
+    IDirect3DDevice9Ex *dev)
+{
+    StagingTexture *slot = &slots[current];
+
+    if (w <= STAGING_SMALL_UPDATE && h <= STAGING_SMALL_UPDATE) {
+        if (shelfX + w > STAGING_SHELF_SIZE) {
+            shelfY += shelfHeight;
+            shelfX = shelfHeight = 0;
+        }
+        if (shelfY + h > STAGING_SHELF_SIZE || slot->texture == NULL ||
+            slot->width < STAGING_SHELF_SIZE || slot->height < STAGING_SHELF_SIZE)
+        {
+            slot = nextSlot(format, STAGING_SHELF_SIZE, STAGING_SHELF_SIZE, dev);
+            if (slot == NULL) {
+                return NULL;
+            }
+        }
+        pOrigin->x = shelfX;
+        pOrigin->y = shelfY;
+        shelfX += w;
+        if (h > shelfHeight) shelfHeight = h;
+    } else {
+        slot = nextSlot(format, w, h, dev);
+        if (slot == NULL) {
+            return NULL;
+        }
+        // the whole texture belongs to this update, small ones move on
+        shelfY = STAGING_SHELF_SIZE;
+        pOrigin->x = 0;
+        pOrigin->y = 0;
+    }
+    if (pSurface) *pSurface = slot->surface;
+    return slot->texture;
+}
+
+void D3DContext::TextureUpdateCache::release() {
+    for (int i = 0; i < NUM_STAGING_TEXTURES; i++) {
+        SAFE_RELEASE(slots[i].surface);
+        SAFE_RELEASE(slots[i].texture);
+        slots[i].width = slots[i].height = 0;
+    }
+    current = shelfX = shelfY = shelfHeight = 0;
 }
 
-IDirect3DTexture9 *D3DContext::getTextureCache(int formatIndex, D3DFORMAT format, int width, int height, IDirect3DSurface9 **pSurface) {
+IDirect3DTexture9 *D3DContext::getTextureCache(int formatIndex, D3DFORMAT format, int width, int height, IDirect3DSurface9 **pSurface, POINT *pOrigin) {
     if (formatIndex < 0 || formatIndex >= NUM_TEXTURE_CACHE) {
+        pOrigin->x = pOrigin->y = 0;
         return createTexture(format, width, height, pSurface, pd3dDevice);
     }
     TextureUpdateCache &cache = textureCache[formatIndex];
-    return cache.getTexture(format, width, height, pSurface, pd3dDevice);
+    return cache.getTexture(format, width, height, pSurface, pOrigin, pd3dDevice);
 }
@@ -36,6 +36,16 @@
 //see com.sun.prism.PixelFormat enum
 #define NUM_TEXTURE_CACHE 8
 
+// staging textures per pixel format that updates rotate through, so that a
+// texture which is still the source of a pending UpdateSurface is not locked
+#define NUM_STAGING_TEXTURES 3
+// updates up to this size are packed side by side into a shared staging
+// texture of STAGING_SHELF_SIZE squared, larger ones get a whole texture
+#define STAGING_SMALL_UPDATE 128
+#define STAGING_SHELF_SIZE 512
+// larger staging textures are rounded up to this multiple
+#define STAGING_SIZE_BUCKET 256
+
 // allow for 256 quads to match the size of the D3DVertexBuffer's nio buffer
 
 #define MAX_BATCH_QUADS 256
@@ -287,15 +297,25 @@ private:
      */
     D3DPhongShader *phongShader;
 
-    struct TextureUpdateCache {
+    struct StagingTexture {
         IDirect3DTexture9 *texture;
         IDirect3DSurface9 *surface;
         int width, height;
-        IDirect3DTexture9 *getTexture(D3DFORMAT format, int width, int height, IDirect3DSurface9 **pSurface, IDirect3DDevice9Ex *dev);
+    };
+
+    struct TextureUpdateCache {
+        StagingTexture slots[NUM_STAGING_TEXTURES];
+        int current;
+        // shelf packing of small updates into the current slot
+        int shelfX, shelfY, shelfHeight;
+        IDirect3DTexture9 *getTexture(D3DFORMAT format, int width, int height, IDirect3DSurface9 **pSurface, POINT *pOrigin, IDirect3DDevice9Ex *dev);
+        void release();
+    private:
+        StagingTexture *nextSlot(D3DFORMAT format, int width, int height, IDirect3DDevice9Ex *dev);
     } textureCache[NUM_TEXTURE_CACHE];
 
 public:
-    IDirect3DTexture9 *getTextureCache(int formatIndex, D3DFORMAT format, int width, int height, IDirect3DSurface9 **pSurface);
+    IDirect3DTexture9 *getTextureCache(int formatIndex, D3DFORMAT format, int width, int height, IDirect3DSurface9 **pSurface, POINT *pOrigin);
 };
 
 #define DEVICE_RESET           0
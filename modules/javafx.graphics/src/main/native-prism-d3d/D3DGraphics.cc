@@ -51,8 +51,58 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DSwapChain_nPresent
 
     pCtx->EndScene();
 
+    IDirect3DSwapChain9 *pSwapChain = pSwapChainRes->GetSwapChain();
+    D3DPRESENT_PARAMETERS params;
+    if (SUCCEEDED(pSwapChain->GetPresentParameters(&params)) &&
+        params.SwapEffect == D3DSWAPEFFECT_FLIPEX)
+    {
+        // flip-model swap chains always present the whole back buffer
+        return pSwapChain->Present(0, 0, 0, 0, 0);
+    }
+
     RECT r = { 0, 0, pSwapChainRes->GetDesc()->Width, pSwapChainRes->GetDesc()->Height };
-    return pSwapChainRes->GetSwapChain()->Present(0, &r, 0, 0, 0);
+    return pSwapChain->Present(0, &r, 0, 0, 0);
+}
+
+/*
+ * Class:     com_sun_prism_d3d_D3DSwapChain
+ * Method:    nGetPresentStats
+ * Signature: (J[J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_d3d_D3DSwapChain_nGetPresentStats
+  (JNIEnv *env, jclass, jlong swapChain, jlongArray stats)
+{
+    D3DResource *pSwapChainRes = (D3DResource*)jlong_to_ptr(swapChain);
+
+    RETURN_STATUS_IF_NULL(pSwapChainRes, JNI_FALSE);
+    RETURN_STATUS_IF_NULL(stats, JNI_FALSE);
+
+    if (env->GetArrayLength(stats) < 3) {
+        return JNI_FALSE;
+    }
+
+    IDirect3DSwapChain9Ex *pSwapChainEx = NULL;
+    if (FAILED(pSwapChainRes->GetSwapChain()->QueryInterface(
+            IID_IDirect3DSwapChain9Ex, (void**)&pSwapChainEx)))
+    {
+        return JNI_FALSE;
+    }
+
+    // Only flip-model swap chains keep statistics, others fail here
+    D3DPRESENTSTATS ps = {};
+    HRESULT res = pSwapChainEx->GetPresentStats(&ps);
+    pSwapChainEx->Release();
+    if (FAILED(res)) {
+        return JNI_FALSE;
+    }
+
+    jlong values[3] = {
+        (jlong)ps.PresentCount,
+        (jlong)ps.PresentRefreshCount,
+        (jlong)ps.SyncRefreshCount
+    };
+    env->SetLongArrayRegion(stats, 0, 3, values);
+    return JNI_TRUE;
 }
 
 void setIntField(JNIEnv *env, jobject object, jclass clazz, const char *name, int value);
@@ -331,7 +381,7 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DContext_nSetRenderTarget
  */
 JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DContext_nSetTexture
   (JNIEnv *, jclass, jlong ctx, jlong textureRes, jint texUnit,
-   jboolean linear, jint wrapMode)
+   jboolean linear, jint wrapMode, jint maxAnisotropy)
 {
     D3DContext *pCtx = (D3DContext*)jlong_to_ptr(ctx);
     RETURN_STATUS_IF_NULL(pCtx, E_FAIL);
@@ -354,8 +404,18 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DContext_nSetTexture
 
     if (pTex != NULL) {
         D3DTEXTUREFILTERTYPE fhint = linear ? D3DTEXF_LINEAR : D3DTEXF_POINT;
+        D3DTEXTUREFILTERTYPE minhint = fhint;
+        D3DCAPS9 *pCaps = pCtx->GetDeviceCaps();
+        if (linear && maxAnisotropy > 1 &&
+            (pCaps->TextureFilterCaps & D3DPTFILTERCAPS_MINFANISOTROPIC))
+        {
+            // mipmapped textures, sampled at oblique angles in 3D
+            DWORD anisotropy = min((DWORD) maxAnisotropy, pCaps->MaxAnisotropy);
+            pd3dDevice->SetSamplerState(texUnit, D3DSAMP_MAXANISOTROPY, anisotropy);
+            minhint = D3DTEXF_ANISOTROPIC;
+        }
         pd3dDevice->SetSamplerState(texUnit, D3DSAMP_MAGFILTER, fhint);
-        pd3dDevice->SetSamplerState(texUnit, D3DSAMP_MINFILTER, fhint);
+        pd3dDevice->SetSamplerState(texUnit, D3DSAMP_MINFILTER, minhint);
         pd3dDevice->SetSamplerState(texUnit, D3DSAMP_MIPFILTER, fhint);
         if (wrapMode != 0) {
             pd3dDevice->SetSamplerState(texUnit, D3DSAMP_ADDRESSU, wrapMode);
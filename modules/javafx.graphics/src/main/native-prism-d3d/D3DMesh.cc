@@ -47,6 +47,12 @@ D3DMesh::D3DMesh(D3DContext *ctx) {
     fvf = D3DFVF_XYZ | (2 << D3DFVF_TEXCOUNT_SHIFT) | D3DFVF_TEXCOORDSIZE4(1);
     numVertices = 0;
     numIndices = 0;
+    dynamic = FALSE;
+    vbDynamic = FALSE;
+    ibDynamic = FALSE;
+    vbCapacity = 0;
+    ibCapacity = 0;
+    ibFormat = D3DFMT_UNKNOWN;
 }
 
 void printResult(const char *str, HRESULT result) {
@@ -100,100 +106,110 @@ void D3DMesh::releaseVertexBuffer() {
     numVertices = 0;
 }
 
-boolean D3DMesh::buildBuffers(float *vb, UINT vbSize, USHORT *ib, UINT ibSize) {
-//    cout << "D3DMesh::buildBuffers: vertexBufferSize = " << vbSize
-//            << ", indexBufferSize = " << ibSize << endl;
-
+// Meshes rebuilt after their first build are treated as animated. Their
+// buffers are created dynamic and only grow, and each upload discards the
+// previous contents, so the driver renames the buffer instead of waiting
+// for the GPU to finish drawing from it.
+HRESULT D3DMesh::uploadVertexBuffer(float *vb, UINT size) {
     IDirect3DDevice9Ex *device = context->Get3DDevice();
-    D3DPOOL pool = context->getResourcePool();
-    UINT size = vbSize * sizeof (float); // in bytes
-    UINT vbCount = size / PRIMITIVE_VERTEX_SIZE; // in vertices
     HRESULT result = D3D_OK;
 
-    if (numVertices != vbCount) {
+    if (vertexBuffer == NULL || size > vbCapacity || (dynamic && !vbDynamic)) {
         releaseVertexBuffer();
-        result = device->CreateVertexBuffer(size, D3DUSAGE_WRITEONLY, fvf,
-                pool, &vertexBuffer, NULL);
-        numVertices = vbCount;
+        vertexBuffer = NULL;
+        vbCapacity = 0;
+        DWORD usage = dynamic ? (D3DUSAGE_DYNAMIC | D3DUSAGE_WRITEONLY) : D3DUSAGE_WRITEONLY;
+        D3DPOOL pool = dynamic ? D3DPOOL_DEFAULT : context->getResourcePool();
+        result = device->CreateVertexBuffer(size, usage, fvf, pool, &vertexBuffer, NULL);
+        if (SUCCEEDED(result)) {
+            vbCapacity = size;
+            vbDynamic = dynamic;
+        }
     }
 
     if (SUCCEEDED(result) && (vertexBuffer != NULL)) {
         float *data;
-        result = vertexBuffer->Lock(0, size, (void **) &data, 0);
+        result = vertexBuffer->Lock(0, size, (void **) &data,
+                vbDynamic ? D3DLOCK_DISCARD : 0);
         if (SUCCEEDED(result)) {
             memcpy_s(data, size, vb, size);
             result = vertexBuffer->Unlock();
         }
     }
-//    printResult("D3DMesh.buildBuffers: VertexBuffer's result = ", result);
-    size = ibSize * sizeof (USHORT);
+    return result;
+}
 
-    if (SUCCEEDED(result) && (numIndices != ibSize)) {
+HRESULT D3DMesh::uploadIndexBuffer(void *ib, UINT size, D3DFORMAT format) {
+    IDirect3DDevice9Ex *device = context->Get3DDevice();
+    HRESULT result = D3D_OK;
+
+    if (indexBuffer == NULL || size > ibCapacity || format != ibFormat
+            || (dynamic && !ibDynamic)) {
         releaseIndexBuffer();
-        result = device->CreateIndexBuffer(size, D3DUSAGE_WRITEONLY,
-                D3DFMT_INDEX16, pool, &indexBuffer, NULL);
-        numIndices = ibSize;
+        indexBuffer = NULL;
+        ibCapacity = 0;
+        DWORD usage = dynamic ? (D3DUSAGE_DYNAMIC | D3DUSAGE_WRITEONLY) : D3DUSAGE_WRITEONLY;
+        D3DPOOL pool = dynamic ? D3DPOOL_DEFAULT : context->getResourcePool();
+        result = device->CreateIndexBuffer(size, usage, format, pool, &indexBuffer, NULL);
+        if (SUCCEEDED(result)) {
+            ibCapacity = size;
+            ibFormat = format;
+            ibDynamic = dynamic;
+        }
     }
 
     if (SUCCEEDED(result) && (indexBuffer != NULL)) {
-        USHORT *data;
-                result = indexBuffer->Lock(0, size, (void **) &data, 0);
+        void *data;
+        result = indexBuffer->Lock(0, size, &data, ibDynamic ? D3DLOCK_DISCARD : 0);
         if (SUCCEEDED(result)) {
             memcpy_s(data, size, ib, size);
             result = indexBuffer->Unlock();
         }
     }
-//    printResult("D3DMesh.buildBuffers: IndexBuffer's result = ", result);
-    return SUCCEEDED(result);
-
+    return result;
 }
 
-boolean D3DMesh::buildBuffers(float *vb, UINT vbSize, UINT *ib, UINT ibSize) {
-//    cout << "D3DMesh::buildBuffers: vertexBufferSize = " << vbSize
-//            << ", indexBufferSize = " << ibSize << endl;
-
-    IDirect3DDevice9Ex *device = context->Get3DDevice();
-    D3DPOOL pool = context->getResourcePool();
-    UINT size = vbSize * sizeof (float); // in bytes
-    UINT vbCount = size / PRIMITIVE_VERTEX_SIZE; // in vertices
-    HRESULT result = D3D_OK;
-
-    if (numVertices != vbCount) {
-        releaseVertexBuffer();
-        result = device->CreateVertexBuffer(size, D3DUSAGE_WRITEONLY, fvf,
-                pool, &vertexBuffer, NULL);
-        numVertices = vbCount;
+boolean D3DMesh::buildBuffers(float *vb, UINT vbSize, USHORT *ib, UINT ibSize) {
+    if (numVertices > 0) {
+        dynamic = TRUE;
     }
+    HRESULT result = uploadVertexBuffer(vb, vbSize * sizeof (float));
+    numVertices = SUCCEEDED(result) ? vbSize * sizeof (float) / PRIMITIVE_VERTEX_SIZE : 0;
 
-    if (SUCCEEDED(result) && (vertexBuffer != NULL)) {
-        float *data;
-        result = vertexBuffer->Lock(0, size, (void **) &data, 0);
-        if (SUCCEEDED(result)) {
-            memcpy_s(data, size, vb, size);
-            result = vertexBuffer->Unlock();
-        }
+    if (SUCCEEDED(result)) {
+        result = uploadIndexBuffer(ib, ibSize * sizeof (USHORT), D3DFMT_INDEX16);
     }
-//    printResult("D3DMesh.buildBuffers: VertexBuffer's result = ", result);
-    size = ibSize * sizeof (UINT);
+    numIndices = SUCCEEDED(result) ? ibSize : 0;
+//    printResult("D3DMesh.buildBuffers: result = ", result);
+    return SUCCEEDED(result);
+}
 
-    if (SUCCEEDED(result) && (numIndices != ibSize)) {
-        releaseIndexBuffer();
-        result = device->CreateIndexBuffer(size, D3DUSAGE_WRITEONLY,
-                D3DFMT_INDEX32, pool, &indexBuffer, NULL);
-        numIndices = ibSize;
+boolean D3DMesh::buildBuffers(float *vb, UINT vbSize, UINT *ib, UINT ibSize) {
+    if (numVertices > 0) {
+        dynamic = TRUE;
     }
+    HRESULT result = uploadVertexBuffer(vb, vbSize * sizeof (float));
+    numVertices = SUCCEEDED(result) ? vbSize * sizeof (float) / PRIMITIVE_VERTEX_SIZE : 0;
 
-    if (SUCCEEDED(result) && (indexBuffer != NULL)) {
-        UINT *data;
-                result = indexBuffer->Lock(0, size, (void **) &data, 0);
-        if (SUCCEEDED(result)) {
-            memcpy_s(data, size, ib, size);
-            result = indexBuffer->Unlock();
-        }
+    if (SUCCEEDED(result)) {
+        result = uploadIndexBuffer(ib, ibSize * sizeof (UINT), D3DFMT_INDEX32);
     }
-//    printResult("D3DMesh.buildBuffers: IndexBuffer's result = ", result);
+    numIndices = SUCCEEDED(result) ? ibSize : 0;
+//    printResult("D3DMesh.buildBuffers: result = ", result);
     return SUCCEEDED(result);
+}
 
+boolean D3DMesh::updateVertices(float *vb, UINT vbSize) {
+    if (vertexBuffer == NULL || vbSize * sizeof (float) / PRIMITIVE_VERTEX_SIZE != numVertices) {
+        return false;
+    }
+    // A discarding lock must write the whole buffer, so there is no
+    // partial upload here
+    dynamic = TRUE;
+    UINT vbCount = numVertices;
+    HRESULT result = uploadVertexBuffer(vb, vbSize * sizeof (float));
+    numVertices = SUCCEEDED(result) ? vbCount : 0;
+    return SUCCEEDED(result);
 }
 
 DWORD D3DMesh::getVertexFVF() {
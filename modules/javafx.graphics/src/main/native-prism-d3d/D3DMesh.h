@@ -40,6 +40,7 @@ public:
             USHORT *indexBuffer, UINT indexBufferSize);
     boolean buildBuffers(float *vertexBuffer, UINT vertexBufferSize,
             UINT *indexBuffer, UINT indexBufferSize);
+    boolean updateVertices(float *vertexBuffer, UINT vertexBufferSize);
     DWORD getVertexFVF();
     IDirect3DIndexBuffer9 *getIndexBuffer();
     IDirect3DVertexBuffer9 *getVertexBuffer();
@@ -53,7 +54,16 @@ private:
     DWORD fvf;
     UINT numVertices;
     UINT numIndices;
+    // set once the mesh is rebuilt or updated after its first build
+    BOOL dynamic;
+    BOOL vbDynamic;
+    BOOL ibDynamic;
+    UINT vbCapacity; // in bytes
+    UINT ibCapacity; // in bytes
+    D3DFORMAT ibFormat;
 
+    HRESULT uploadVertexBuffer(float *vb, UINT size);
+    HRESULT uploadIndexBuffer(void *ib, UINT size, D3DFORMAT format);
     void releaseIndexBuffer();
     void releaseVertexBuffer();
 };
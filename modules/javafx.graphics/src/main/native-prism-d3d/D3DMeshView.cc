@@ -103,48 +103,9 @@ void D3DMeshView::computeNumLights() {
     }
 
     numLights = n;
-}
-
-inline void matrixTransposed(D3DMATRIX& r, const D3DMATRIX& a) {
-    for (int i = 0; i < 4; i++) {
-        for (int j = 0; j < 4; j++) {
-            r.m[j][i] = a.m[i][j];
-        }
-    }
-}
-
-void D3DMeshView::render() {
-    RETURN_IF_NULL(context);
-    RETURN_IF_NULL(material);
-    RETURN_IF_NULL(mesh);
-
-    IDirect3DDevice9Ex *device = context->Get3DDevice();
-    RETURN_IF_NULL(device);
-
-    HRESULT status = SUCCEEDED(device->SetFVF(mesh->getVertexFVF()));
-    if (!status) {
-        cout << "D3DMeshView.render() - SetFVF failed !!!" << endl;
-        return;
-    }
-
-    D3DPhongShader *pShader = context->getPhongShader();
-    RETURN_IF_NULL(pShader);
-
-    status = SUCCEEDED(device->SetVertexShader(pShader->getVertexShader()));
-    if (!status) {
-        cout << "D3DMeshView.render() - SetVertexShader failed !!!" << endl;
-        return;
-    }
-
-    computeNumLights();
 
-    // Prepare lights data
-    float lightsPosition[MAX_NUM_LIGHTS * 4];      // 3 coords + 1 padding
-    float lightsNormDirection[MAX_NUM_LIGHTS * 4]; // 3 coords + 1 padding
-    float lightsColor[MAX_NUM_LIGHTS * 4];         // 3 color + 1 padding
-    float lightsAttenuation[MAX_NUM_LIGHTS * 4];   // 3 attenuation factors + 1 isAttenuated
-    float lightsRange[MAX_NUM_LIGHTS * 4];         // 1 maxRange + 3 padding
-    float spotLightsFactors[MAX_NUM_LIGHTS * 4];   // 2 angles + 1 falloff + 1 padding
+    // The shader constants only change with the lights, so they are
+    // prepared here rather than for every render
     for (int i = 0, d = 0, p = 0, c = 0, a = 0, r = 0, s = 0; i < MAX_NUM_LIGHTS; i++) {
         D3DLight& light = lights[i];
 
@@ -188,6 +149,40 @@ void D3DMeshView::render() {
             spotLightsFactors[s++] = 0;
         }
     }
+}
+
+inline void matrixTransposed(D3DMATRIX& r, const D3DMATRIX& a) {
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            r.m[j][i] = a.m[i][j];
+        }
+    }
+}
+
+void D3DMeshView::render() {
+    RETURN_IF_NULL(context);
+    RETURN_IF_NULL(material);
+    RETURN_IF_NULL(mesh);
+
+    IDirect3DDevice9Ex *device = context->Get3DDevice();
+    RETURN_IF_NULL(device);
+
+    HRESULT status = SUCCEEDED(device->SetFVF(mesh->getVertexFVF()));
+    if (!status) {
+        cout << "D3DMeshView.render() - SetFVF failed !!!" << endl;
+        return;
+    }
+
+    D3DPhongShader *pShader = context->getPhongShader();
+    RETURN_IF_NULL(pShader);
+
+    status = SUCCEEDED(device->SetVertexShader(pShader->getVertexShader()));
+    if (!status) {
+        cout << "D3DMeshView.render() - SetVertexShader failed !!!" << endl;
+        return;
+    }
+
+    computeNumLights();
 
     // Set Vertex Shader constants //
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -57,6 +57,12 @@ private:
     float ambientLightColor[3] = {0};
     int numLights = 0;
     bool lightsDirty = true;
+    float lightsPosition[MAX_NUM_LIGHTS * 4];      // 3 coords + 1 padding
+    float lightsNormDirection[MAX_NUM_LIGHTS * 4]; // 3 coords + 1 padding
+    float lightsColor[MAX_NUM_LIGHTS * 4];         // 3 color + 1 padding
+    float lightsAttenuation[MAX_NUM_LIGHTS * 4];   // 3 attenuation factors + 1 isAttenuated
+    float lightsRange[MAX_NUM_LIGHTS * 4];         // 1 maxRange + 3 padding
+    float spotLightsFactors[MAX_NUM_LIGHTS * 4];   // 2 angles + 1 falloff + 1 padding
     int cullMode = D3DCULL_NONE;
     bool wireframe = false;
 };
@@ -178,6 +178,14 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DPipeline_nGetAdapterCount(JNIEn
     return pMgr->GetAdapterCount();
 }
 
+JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DPipeline_nGetPreferredAdapter(JNIEnv *, jclass) {
+    D3DPipelineManager *pMgr = D3DPipelineManager::GetInstance();
+    if (!pMgr) {
+        return 0;
+    }
+    return pMgr->GetPreferredAdapter();
+}
+
 static const char jStringField[]  = "Ljava/lang/String;";
 
 void setStringField(JNIEnv *env, jobject object, jclass clazz, const char *name, const char * string) {
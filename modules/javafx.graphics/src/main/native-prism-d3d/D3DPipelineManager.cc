@@ -24,6 +24,7 @@
  */
 
 #include <stdio.h>
+#include <dxgi1_6.h>
 #include "D3DBadHardware.h"
 #include "D3DPipelineManager.h"
 
@@ -48,6 +49,43 @@ bool OS::isWinverAtleast(int maj, int min) {
 
 inline bool isForcedGPU(IConfig &cfg) { return cfg.getBool("forceGPU"); }
 
+typedef HRESULT (WINAPI *CreateDXGIFactory1Function)(REFIID riid, void **ppFactory);
+
+// Gets the LUID of the adapter that DXGI ranks first for high performance,
+// the discrete GPU on hybrid graphics systems. Requires Windows 10 1803 or
+// newer, where IDXGIFactory6 is available.
+static bool GetHighPerformanceAdapterLuid(LUID *pLuid)
+{
+    HMODULE hDXGI = ::LoadLibrary(TEXT("dxgi.dll"));
+    if (hDXGI == NULL) {
+        return false;
+    }
+
+    bool found = false;
+    CreateDXGIFactory1Function createFactory =
+        (CreateDXGIFactory1Function)::GetProcAddress(hDXGI, "CreateDXGIFactory1");
+    IDXGIFactory6 *pFactory = NULL;
+    if (createFactory != NULL &&
+        SUCCEEDED(createFactory(__uuidof(IDXGIFactory6), (void **)&pFactory)))
+    {
+        IDXGIAdapter1 *pAdapter = NULL;
+        if (SUCCEEDED(pFactory->EnumAdapterByGpuPreference(0,
+                DXGI_GPU_PREFERENCE_HIGH_PERFORMANCE,
+                __uuidof(IDXGIAdapter1), (void **)&pAdapter)))
+        {
+            DXGI_ADAPTER_DESC1 desc;
+            if (SUCCEEDED(pAdapter->GetDesc1(&desc))) {
+                *pLuid = desc.AdapterLuid;
+                found = true;
+            }
+            pAdapter->Release();
+        }
+        pFactory->Release();
+    }
+    ::FreeLibrary(hDXGI);
+    return found;
+}
+
 D3DPipelineManager * D3DPipelineManager::CreateInstance(IConfig &cfg) {
     pMgr = new D3DPipelineManager(cfg);
     if (FAILED(pMgr->InitD3D(cfg))) {
@@ -69,6 +107,7 @@ D3DPipelineManager::D3DPipelineManager(IConfig &cfg)
     pd3d9 = NULL;
     pAdapters = NULL;
     adapterCount = 0;
+    preferredAdapter = D3DADAPTER_DEFAULT;
     isVsyncEnabled = cfg.getBool("isVsyncEnabled");
 
     devType = SelectDeviceType();
@@ -156,11 +195,41 @@ HRESULT D3DPipelineManager::InitAdapters(IConfig &cfg)
 
     if (FAILED(res)) {
         SetErrorMessage("Adapter validation failed for all adapters");
+    } else if (cfg.getBool("highPerformanceGPU")) {
+        preferredAdapter = FindHighPerformanceAdapter();
     }
 
     return res;
 }
 
+UINT D3DPipelineManager::FindHighPerformanceAdapter()
+{
+    LUID luid;
+    if (!GetHighPerformanceAdapterLuid(&luid)) {
+        RlsTraceLn(NWT_TRACE_WARNING,
+                   "D3DPPLM::FindHighPerformanceAdapter: no GPU preference available");
+        return D3DADAPTER_DEFAULT;
+    }
+
+    // D3D9 only enumerates adapters with a display attached, so a discrete
+    // GPU that renders for the integrated one on a laptop is not found here
+    for (UINT adapter = 0; adapter < adapterCount; adapter++) {
+        LUID adapterLuid;
+        if (pAdapters[adapter].state != CONTEXT_INIT_FAILED &&
+            SUCCEEDED(pd3d9->GetAdapterLUID(adapter, &adapterLuid)) &&
+            adapterLuid.LowPart == luid.LowPart &&
+            adapterLuid.HighPart == luid.HighPart)
+        {
+            RlsTraceLn1(NWT_TRACE_INFO,
+                        "D3DPPLM::FindHighPerformanceAdapter: adapter %d", adapter);
+            return adapter;
+        }
+    }
+    RlsTraceLn(NWT_TRACE_WARNING,
+               "D3DPPLM::FindHighPerformanceAdapter: adapter not usable, using default");
+    return D3DADAPTER_DEFAULT;
+}
+
 // static
 HRESULT
 D3DPipelineManager::CheckOSVersion()
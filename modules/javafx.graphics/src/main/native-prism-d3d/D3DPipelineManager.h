@@ -87,6 +87,10 @@ public:
 
     UINT GetAdapterCount() const { return adapterCount; }
 
+    // returns the adapter to try first for rendering, the high performance
+    // one if requested and usable, otherwise the default adapter
+    UINT GetPreferredAdapter() const { return preferredAdapter; }
+
     // returns warning message if warning is true during driver check.
     static char const * GetErrorMessage();
     static void SetErrorMessage(char const *msg);
@@ -114,6 +118,8 @@ private:
     HRESULT D3DEnabledOnAdapter(UINT Adapter);
     HRESULT CheckAdaptersInfo(IConfig &);
     HRESULT CheckDeviceCaps(UINT Adapter);
+    // returns the ordinal of the adapter DXGI prefers for high performance
+    UINT FindHighPerformanceAdapter();
 
 public:
     // Check the OS, succeeds if the OS is XP or newer client-class OS
@@ -133,6 +139,8 @@ private:
 
     // current adapter count
     UINT adapterCount;
+    // adapter tried first for the default resource factory
+    UINT preferredAdapter;
     // Pointer to Direct3D9 Object mainained by the pipeline manager
     IDirect3D9Ex * pd3d9;
 
@@ -131,13 +131,136 @@ Java_com_sun_prism_d3d_D3DResourceFactory_nCreateTexture
     return 0L;
 }
 
+// Copies the block compressed levels into a lockable texture
+static HRESULT FillCompressedTexture(JNIEnv *env, IDirect3DTexture9 *pTexture,
+                                     jobjectArray levels, jint levelCount)
+{
+    for (jint i = 0; i < levelCount; i++) {
+        jbyteArray level = (jbyteArray) env->GetObjectArrayElement(levels, i);
+        if (level == NULL) {
+            return E_FAIL;
+        }
+        jsize length = env->GetArrayLength(level);
+        D3DLOCKED_RECT lockedRect;
+        HRESULT res = pTexture->LockRect(i, &lockedRect, NULL, 0);
+        if (SUCCEEDED(res)) {
+            // Rows of blocks are tightly packed in the level data
+            D3DSURFACE_DESC desc;
+            pTexture->GetLevelDesc(i, &desc);
+            UINT blockRows = (desc.Height + 3) / 4;
+            UINT rowBytes = blockRows > 0 ? length / blockRows : 0;
+            jbyte *pData = (jbyte *) env->GetPrimitiveArrayCritical(level, NULL);
+            if (pData != NULL) {
+                for (UINT row = 0; row < blockRows; row++) {
+                    memcpy((BYTE *) lockedRect.pBits + row * lockedRect.Pitch,
+                           pData + row * rowBytes, rowBytes);
+                }
+                env->ReleasePrimitiveArrayCritical(level, pData, JNI_ABORT);
+            } else {
+                res = E_OUTOFMEMORY;
+            }
+            pTexture->UnlockRect(i);
+        }
+        env->DeleteLocalRef(level);
+        if (FAILED(res)) {
+            return res;
+        }
+    }
+    return S_OK;
+}
+
+/*
+ * Class:     com_sun_prism_d3d_D3DResourceFactory
+ * Method:    nCreateCompressedTexture
+ * Signature: (JIII[[B)J
+ */
+JNIEXPORT jlong JNICALL
+Java_com_sun_prism_d3d_D3DResourceFactory_nCreateCompressedTexture
+  (JNIEnv *env, jclass klass,
+        jlong ctx, jint formatHint, jint width, jint height, jobjectArray levels)
+{
+    TraceLn3(NWT_TRACE_INFO,
+             "nCreateCompressedTexture format=%d w=%d h=%d",
+             formatHint, width, height);
+
+    D3DContext *pCtx = (D3DContext *)jlong_to_ptr(ctx);
+    RETURN_STATUS_IF_NULL(pCtx, 0L);
+
+    D3DResourceManager *pMgr = pCtx->GetResourceManager();
+    RETURN_STATUS_IF_NULL(pMgr, 0L);
+
+    IDirect3DDevice9Ex *pd3dDevice = pCtx->Get3DDevice();
+    RETURN_STATUS_IF_NULL(pd3dDevice, 0L);
+    RETURN_STATUS_IF_NULL(levels, 0L);
+
+    D3DFORMAT format;
+    switch (formatHint) {
+        case com_sun_prism_d3d_D3DResourceFactory_COMPRESSED_FORMAT_BC1:
+            format = D3DFMT_DXT1;
+            break;
+        case com_sun_prism_d3d_D3DResourceFactory_COMPRESSED_FORMAT_BC2:
+            format = D3DFMT_DXT3;
+            break;
+        case com_sun_prism_d3d_D3DResourceFactory_COMPRESSED_FORMAT_BC3:
+            format = D3DFMT_DXT5;
+            break;
+        default:
+            return 0L;
+    }
+
+    // The block data cannot be padded to a power of two or a square
+    if ((pCtx->IsPow2TexturesOnly() &&
+         ((width & (width - 1)) != 0 || (height & (height - 1)) != 0)) ||
+        (pCtx->IsSquareTexturesOnly() && width != height))
+    {
+        return 0L;
+    }
+
+    jint levelCount = env->GetArrayLength(levels);
+    D3DPOOL pool = pCtx->getResourcePool();
+    IDirect3DTexture9 *pTexture = NULL;
+    HRESULT res = pd3dDevice->CreateTexture(width, height, levelCount, 0,
+                                            format, pool, &pTexture, 0);
+    if (FAILED(res)) {
+        DebugPrintD3DError(res, "nCreateCompressedTexture: CreateTexture failed");
+        return 0L;
+    }
+
+    if (pool == D3DPOOL_DEFAULT) {
+        // Default pool textures cannot be locked, so the levels are
+        // uploaded through a system memory copy
+        IDirect3DTexture9 *pStaging = NULL;
+        res = pd3dDevice->CreateTexture(width, height, levelCount, 0,
+                                        format, D3DPOOL_SYSTEMMEM, &pStaging, 0);
+        if (SUCCEEDED(res)) {
+            res = FillCompressedTexture(env, pStaging, levels, levelCount);
+            if (SUCCEEDED(res)) {
+                res = pd3dDevice->UpdateTexture(pStaging, pTexture);
+            }
+            pStaging->Release();
+        }
+    } else {
+        res = FillCompressedTexture(env, pTexture, levels, levelCount);
+    }
+    if (FAILED(res)) {
+        DebugPrintD3DError(res, "nCreateCompressedTexture: upload failed");
+        pTexture->Release();
+        return 0L;
+    }
+
+    D3DResource *pTexResource = new D3DResource((IDirect3DResource9*)pTexture);
+    pMgr->AddResource(pTexResource);
+    return ptr_to_jlong(pTexResource);
+}
+
 /*
  * Class:     com_sun_prism_d3d_D3DResourceFactory
  * Method:    nCreateSwapChain
- * Signature: (JJ)J
+ * Signature: (JJZZI)J
  */
 JNIEXPORT jlong JNICALL Java_com_sun_prism_d3d_D3DResourceFactory_nCreateSwapChain
-  (JNIEnv *jEnv, jclass, jlong ctx, jlong hwnd, jboolean isVsyncEnabled)
+  (JNIEnv *jEnv, jclass, jlong ctx, jlong hwnd, jboolean isVsyncEnabled,
+   jboolean isFlipModel, jint maxFrameLatency)
 {
     D3DContext *pCtx = (D3DContext*)jlong_to_ptr(ctx);
     RETURN_STATUS_IF_NULL(pCtx, 0L);
@@ -148,19 +271,40 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_d3d_D3DResourceFactory_nCreateSwapCha
         return 0L;
     }
 
-    D3DResource *pSwapChainRes = NULL;
-    HRESULT res = pCtx->GetResourceManager()->
-            CreateSwapChain(hWnd, 1,
-            0, 0,
-            // have to use COPY since we don't re-render the scene
-            // if it didn't change
-            D3DSWAPEFFECT_COPY,
-            isVsyncEnabled ?
+    UINT presentationInterval = isVsyncEnabled ?
             D3DPRESENT_INTERVAL_ONE :
-            D3DPRESENT_INTERVAL_IMMEDIATE,
-            &pSwapChainRes);
+            D3DPRESENT_INTERVAL_IMMEDIATE;
+
+    D3DResource *pSwapChainRes = NULL;
+    HRESULT res = E_FAIL;
+    if (isFlipModel) {
+        // D3DSwapChain.prepare() draws the whole scene into the back buffer
+        // before each present, so it does not matter that flipping leaves
+        // its contents undefined. Needs Windows 7 and at least two buffers.
+        res = pCtx->GetResourceManager()->
+                CreateSwapChain(hWnd, 2, 0, 0,
+                D3DSWAPEFFECT_FLIPEX, presentationInterval,
+                &pSwapChainRes);
+        if (FAILED(res)) {
+            RlsTraceLn(NWT_TRACE_WARNING,
+                "nCreateSwapChain: flip model not available, using copy");
+        }
+    }
+    if (FAILED(res)) {
+        res = pCtx->GetResourceManager()->
+                CreateSwapChain(hWnd, 1,
+                0, 0,
+                // have to use COPY since we don't re-render the scene
+                // if it didn't change
+                D3DSWAPEFFECT_COPY,
+                presentationInterval,
+                &pSwapChainRes);
+    }
 
     if (SUCCEEDED(res)) {
+        if (maxFrameLatency > 0) {
+            pCtx->Get3DDevice()->SetMaximumFrameLatency(maxFrameLatency);
+        }
         return ptr_to_jlong(pSwapChainRes);
     }
 
@@ -394,7 +538,8 @@ static void copy_X8R8G8B8(DWORD *pDstPixels, DWORD const *pSrcPixels, int n) {
 /*
  * Note: this method assumes that pCtx, pResource and pixels are not null
  */
-static HRESULT D3DResourceFactory_nReadPixels(D3DContext *pCtx, D3DResource *pResource, BYTE *pixels, int cntW, int cntH)
+static HRESULT D3DResourceFactory_nReadPixels(D3DContext *pCtx, D3DResource *pResource, BYTE *pixels,
+                                              int srcX, int srcY, int cntW, int cntH)
 {
 
     TraceLn(NWT_TRACE_INFO, "D3DResourceFactory_nReadPixels");
@@ -415,6 +560,14 @@ static HRESULT D3DResourceFactory_nReadPixels(D3DContext *pCtx, D3DResource *pRe
         return E_FAIL;
     }
 
+    if (srcX < 0 || srcY < 0 || UINT(cntW) > srcw || UINT(cntH) > srch ||
+        UINT(srcX) > srcw - cntW || UINT(srcY) > srch - cntH)
+    {
+        RlsTraceLn(NWT_TRACE_ERROR,
+            "D3DResourceFactory_nReadPixels region is outside of the surface");
+        return E_FAIL;
+    }
+
     // the dest surface must have the same dimensions and format as
     // the source, GetBlitOSPSurface ensures that
     D3DResource *pLockableRes = 0;
@@ -429,14 +582,15 @@ static HRESULT D3DResourceFactory_nReadPixels(D3DContext *pCtx, D3DResource *pRe
         res = pd3dDevice->GetRenderTargetData(pSrc, pTmpSurface);
         if (SUCCEEDED(res)) {
             D3DLOCKED_RECT lockedRect;
-            if (FAILED(res = pTmpSurface->LockRect(&lockedRect, NULL,
+            RECT lockRect = { srcX, srcY, srcX + cntW, srcY + cntH };
+            if (FAILED(res = pTmpSurface->LockRect(&lockedRect, &lockRect,
                                                     D3DLOCK_NOSYSLOCK)))
             {
                 RlsTraceLn1(NWT_TRACE_ERROR,
                     "D3DResourceFactory_nReadPixels lock failed res=%x", res);
                 return res;
             }
-            // assuming int (a|x)rgb type, and 0,0 source coordinates
+            // assuming int (a|x)rgb type, the locked rect starts at srcX, srcY
 
             BYTE const *pSrcPixels = PBYTE(lockedRect.pBits);
             BYTE *pDstPixels = pixels;
@@ -468,7 +622,7 @@ static HRESULT D3DResourceFactory_nReadPixels(D3DContext *pCtx, D3DResource *pRe
 
 static HRESULT nReadPixelsHelper(
     JNIEnv *env, jlong context, jlong resource, jlong length,
-    jobject buf, jarray pixelArray, jint cntW, jint cntH)
+    jobject buf, jarray pixelArray, jint srcX, jint srcY, jint cntW, jint cntH)
 {
     D3DContext *pCtx = (D3DContext*)jlong_to_ptr(context);
     RETURN_STATUS_IF_NULL(pCtx, E_FAIL);
@@ -491,7 +645,7 @@ static HRESULT nReadPixelsHelper(
 
     RETURN_STATUS_IF_NULL(pixels, E_OUTOFMEMORY);
 
-    HRESULT res = D3DResourceFactory_nReadPixels(pCtx, pResource, pixels, cntW, cntH);
+    HRESULT res = D3DResourceFactory_nReadPixels(pCtx, pResource, pixels, srcX, srcY, cntW, cntH);
 
     if (pixelArray) {
         env->ReleasePrimitiveArrayCritical(pixelArray, pixels, 0);
@@ -507,18 +661,18 @@ static HRESULT nReadPixelsHelper(
  */
 JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DResourceFactory_nReadPixelsI
 (JNIEnv *env, jclass, jlong context, jlong resource, jlong length,
- jobject buf, jintArray pixelArray, jint cntW, jint cntH)
+ jobject buf, jintArray pixelArray, jint srcX, jint srcY, jint cntW, jint cntH)
 {
     TraceLn(NWT_TRACE_INFO, "D3DResourceFactory_nReadPixelsI");
-    return nReadPixelsHelper(env, context, resource, length, buf, pixelArray, cntW, cntH);
+    return nReadPixelsHelper(env, context, resource, length, buf, pixelArray, srcX, srcY, cntW, cntH);
 }
 
 JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DResourceFactory_nReadPixelsB
 (JNIEnv *env, jclass clazz, jlong context, jlong resource, jlong length,
- jobject buf, jbyteArray pixelArray, jint cntW, jint cntH)
+ jobject buf, jbyteArray pixelArray, jint srcX, jint srcY, jint cntW, jint cntH)
 {
     TraceLn(NWT_TRACE_INFO, "D3DResourceFactory_nReadPixelsB");
-    return nReadPixelsHelper(env, context, resource, length, buf, pixelArray, cntW, cntH);
+    return nReadPixelsHelper(env, context, resource, length, buf, pixelArray, srcX, srcY, cntW, cntH);
 }
 
 
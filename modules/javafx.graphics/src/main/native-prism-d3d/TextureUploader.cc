@@ -151,18 +151,22 @@ int TextureUpdater::updateLockableTexture() {
 
 int TextureUpdater::updateD3D9ExTexture(D3DContext *pCtx) {
     IDirect3DSurface9 *tempSurface = NULL;
-    IDirect3DTexture9 *tempTexture = pCtx->getTextureCache(format, pDesc->Format, srcW, srcH, &tempSurface);
+    POINT origin = { 0, 0 };
+    IDirect3DTexture9 *tempTexture = pCtx->getTextureCache(format, pDesc->Format, srcW, srcH, &tempSurface, &origin);
     int size = 0;
 
     if (tempTexture && tempSurface && pSurface) {
-        // need to upload data into the system texture
+        // need to upload data into the system texture, staging textures are
+        // dynamic so an update that starts at their origin locks with discard
+        D3DSURFACE_DESC stagingDesc = *pDesc;
+        stagingDesc.Usage = D3DUSAGE_DYNAMIC;
 
         TextureUpdater updater;
-        updater.setTarget(tempTexture, tempSurface, pDesc, 0, 0);
+        updater.setTarget(tempTexture, tempSurface, &stagingDesc, origin.x, origin.y);
         updater.setSource(data, srcSize, format, 0, 0, srcW, srcH, srcStride);
         size = updater.updateLockableTexture();
 
-        RECT sRect = { 0, 0, srcW, srcH };
+        RECT sRect = { origin.x, origin.y, origin.x + (LONG) srcW, origin.y + (LONG) srcH };
         POINT dPos = { dstX, dstY };
         HRESULT hr = pCtx->Get3DDevice()->UpdateSurface(tempSurface, &sRect, pSurface, &dPos);
         if (FAILED(hr)) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,8 @@ enum PFormat {
     PFORMAT_MULTI_YV_12   = 5, // used only at java level
     PFORMAT_BYTE_APPL_422 = 6, // unused in D3D
     PFORMAT_FLOAT_XYZW    = 7,
+    PFORMAT_BYTE_GRAY_ALPHA = 8, // unused in D3D
+    PFORMAT_MULTI_YV_12_10  = 9, // unused in D3D
 };
 
 inline UINT getPixelSize(PFormat f) {
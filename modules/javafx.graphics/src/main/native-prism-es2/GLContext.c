@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -24,6 +24,7 @@
  */
 
 #include <jni.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <assert.h>
 #include <stdio.h>
@@ -116,6 +117,58 @@ void deleteCtxInfo(ContextInfo *ctxInfo) {
     memset(ctxInfo, 0, sizeof (ContextInfo));
 }
 
+/*
+ * Select how nDrawIndexedQuads streams its vertices to the GPU. Persistent
+ * mapping needs buffer storage and fences, the plain mapped mode only
+ * needs glMapBufferRange; anything older keeps using client vertex arrays.
+ * The buffer itself is created on the first draw. Asynchronous readback
+ * and staged texture uploads need mapping and fences as well, pixel buffer
+ * objects are required by every supported context.
+ */
+static void initBufferMapping(ContextInfo *ctxInfo) {
+    int major = ctxInfo->versionNumbers[0];
+    int minor = ctxInfo->versionNumbers[1];
+    jboolean mapRange, sync, bufferStorage;
+
+#ifdef IS_EGL
+    /* the version string reads "OpenGL ES <major>.<minor> ..." */
+    if ((ctxInfo->versionStr == NULL) ||
+            (sscanf(ctxInfo->versionStr, "OpenGL ES %d.%d", &major, &minor) != 2)) {
+        major = minor = 0;
+    }
+    mapRange = sync = (major >= 3);
+    /* GL_EXT_buffer_storage only exports glBufferStorageEXT */
+    bufferStorage = JNI_FALSE;
+#else
+    const char *ext = ctxInfo->glExtensionStr;
+    mapRange = (major >= 3) || isExtensionSupported(ext, "GL_ARB_map_buffer_range");
+    sync = (major > 3) || (major == 3 && minor >= 2)
+            || isExtensionSupported(ext, "GL_ARB_sync");
+    bufferStorage = (major > 4) || (major == 4 && minor >= 4)
+            || isExtensionSupported(ext, "GL_ARB_buffer_storage");
+#endif
+
+    ctxInfo->pixelBufferMapping = mapRange && sync
+            && (ctxInfo->glMapBufferRange != NULL) && (ctxInfo->glUnmapBuffer != NULL)
+            && (ctxInfo->glFenceSync != NULL) && (ctxInfo->glClientWaitSync != NULL)
+            && (ctxInfo->glDeleteSync != NULL) && (ctxInfo->glGenBuffers != NULL)
+            && (ctxInfo->glBindBuffer != NULL) && (ctxInfo->glBufferData != NULL)
+            && (ctxInfo->glDeleteBuffers != NULL);
+
+    ctxInfo->vertexStreamMode = VERTEX_STREAM_NONE;
+    if (!mapRange || (ctxInfo->glMapBufferRange == NULL)
+            || (ctxInfo->glUnmapBuffer == NULL) || (ctxInfo->glGenBuffers == NULL)
+            || (ctxInfo->glBindBuffer == NULL) || (ctxInfo->glBufferData == NULL)) {
+        return;
+    }
+    ctxInfo->vertexStreamMode = VERTEX_STREAM_MAP;
+    if (bufferStorage && sync && (ctxInfo->glBufferStorage != NULL)
+            && (ctxInfo->glFenceSync != NULL) && (ctxInfo->glClientWaitSync != NULL)
+            && (ctxInfo->glDeleteSync != NULL)) {
+        ctxInfo->vertexStreamMode = VERTEX_STREAM_PERSISTENT;
+    }
+}
+
 void initState(ContextInfo *ctxInfo) {
     if (ctxInfo == NULL) {
         return;
@@ -151,6 +204,8 @@ void initState(ContextInfo *ctxInfo) {
     ctxInfo->state.cullEnable = JNI_FALSE;
     ctxInfo->state.cullMode = GL_BACK;
     ctxInfo->state.fbo = 0;
+
+    initBufferMapping(ctxInfo);
 }
 
 void clearBuffers(ContextInfo *ctxInfo,
@@ -607,6 +662,262 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateProgram
     return shaderProgram;
 }
 
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nIsProgramBinarySupported
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nIsProgramBinarySupported
+(JNIEnv *env, jclass class, jlong nativeCtxInfo) {
+    GLint numFormats = 0;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->glGetProgramBinary == NULL)
+            || (ctxInfo->glProgramBinary == NULL)) {
+        return JNI_FALSE;
+    }
+
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+    return numFormats > 0 ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nGetProgramBinary
+ * Signature: (JI[I)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_com_sun_prism_es2_GLContext_nGetProgramBinary
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint shaderProgram, jintArray formatArr) {
+    GLint length = 0;
+    GLsizei written = 0;
+    GLenum format = 0;
+    jint jformat;
+    void *data;
+    jbyteArray binary = NULL;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (formatArr == NULL)
+            || (ctxInfo->glGetProgramiv == NULL)
+            || (ctxInfo->glGetProgramBinary == NULL)) {
+        return NULL;
+    }
+
+    ctxInfo->glGetProgramiv(shaderProgram, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return NULL;
+    }
+    data = malloc(length);
+    if (data == NULL) {
+        return NULL;
+    }
+
+    // Reset Error
+    glGetError();
+    ctxInfo->glGetProgramBinary(shaderProgram, length, &written, &format, data);
+    if ((glGetError() == GL_NO_ERROR) && (written > 0)) {
+        binary = (*env)->NewByteArray(env, written);
+        if (binary != NULL) {
+            (*env)->SetByteArrayRegion(env, binary, 0, written, (jbyte *) data);
+            jformat = (jint) format;
+            (*env)->SetIntArrayRegion(env, formatArr, 0, 1, &jformat);
+        }
+    }
+    free(data);
+    return binary;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nCreateProgramFromBinary
+ * Signature: (JI[B)I
+ */
+JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateProgramFromBinary
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint format, jbyteArray binary) {
+    GLuint shaderProgram;
+    GLint success = GL_FALSE;
+    jsize length;
+    jbyte *data;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (binary == NULL)
+            || (ctxInfo->glCreateProgram == NULL)
+            || (ctxInfo->glGetProgramiv == NULL)
+            || (ctxInfo->glDeleteProgram == NULL)
+            || (ctxInfo->glProgramBinary == NULL)) {
+        return 0;
+    }
+
+    length = (*env)->GetArrayLength(env, binary);
+    data = (*env)->GetByteArrayElements(env, binary, NULL);
+    if (data == NULL) {
+        return 0;
+    }
+
+    // Reset Error
+    glGetError();
+    shaderProgram = ctxInfo->glCreateProgram();
+    ctxInfo->glProgramBinary(shaderProgram, (GLenum) format, data, length);
+    (*env)->ReleaseByteArrayElements(env, binary, data, JNI_ABORT);
+
+    // A driver update makes old binaries fail to load; the caller then
+    // compiles the program from source
+    if (glGetError() == GL_NO_ERROR) {
+        ctxInfo->glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
+    }
+    if (success == GL_FALSE) {
+        ctxInfo->glDeleteProgram(shaderProgram);
+        return 0;
+    }
+
+    return shaderProgram;
+}
+
+#ifndef GL_GPU_DISJOINT_EXT
+#define GL_GPU_DISJOINT_EXT 0x8FBB
+#endif
+
+/*
+ * The timestamp queries of one frame measured by ES2GPUTimer
+ */
+typedef struct {
+    GLboolean checkDisjoint;
+    GLsizei numQueries;
+    GLuint *queries;
+} TimerFrame;
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nCreateTimerFrame
+ * Signature: (JI)J
+ */
+JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_GLContext_nCreateTimerFrame
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint numTimestamps) {
+    TimerFrame *frame;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (numTimestamps <= 0)
+            || (ctxInfo->glGenQueries == NULL)
+            || (ctxInfo->glDeleteQueries == NULL)
+            || (ctxInfo->glQueryCounter == NULL)
+            || (ctxInfo->glGetQueryObjectiv == NULL)
+            || (ctxInfo->glGetQueryObjectui64v == NULL)) {
+        return 0;
+    }
+
+    frame = (TimerFrame *) calloc(1, sizeof(TimerFrame));
+    if (frame == NULL) {
+        return 0;
+    }
+    frame->queries = (GLuint *) calloc(numTimestamps, sizeof(GLuint));
+    if (frame->queries == NULL) {
+        free(frame);
+        return 0;
+    }
+    frame->numQueries = numTimestamps;
+    // Only OpenGL ES reports whether the GPU clock was disturbed
+    frame->checkDisjoint = (GLboolean) isExtensionSupported(ctxInfo->glExtensionStr,
+            "GL_EXT_disjoint_timer_query");
+    ctxInfo->glGenQueries(numTimestamps, frame->queries);
+    return ptr_to_jlong(frame);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nBeginTimerFrame
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nBeginTimerFrame
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeFrame) {
+    GLint disjoint;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    TimerFrame *frame = (TimerFrame *) jlong_to_ptr(nativeFrame);
+    if ((ctxInfo == NULL) || (frame == NULL)) {
+        return;
+    }
+
+    if (frame->checkDisjoint) {
+        // Reading the flag clears it
+        glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+    }
+    ctxInfo->glQueryCounter(frame->queries[0], GL_TIMESTAMP);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nTimestamp
+ * Signature: (JJI)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nTimestamp
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeFrame, jint index) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    TimerFrame *frame = (TimerFrame *) jlong_to_ptr(nativeFrame);
+    if ((ctxInfo == NULL) || (frame == NULL)
+            || (index < 0) || (index >= frame->numQueries)) {
+        return;
+    }
+
+    ctxInfo->glQueryCounter(frame->queries[index], GL_TIMESTAMP);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nGetTimerFrameResults
+ * Signature: (JJ[J)I
+ */
+JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nGetTimerFrameResults
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeFrame, jlongArray nanosArr) {
+    GLint available = 0;
+    GLint disjoint = 0;
+    GLuint64 value;
+    jlong nanos;
+    int i, count;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    TimerFrame *frame = (TimerFrame *) jlong_to_ptr(nativeFrame);
+    if ((ctxInfo == NULL) || (frame == NULL) || (nanosArr == NULL)) {
+        return com_sun_prism_es2_GLContext_TIMER_RESULT_INVALID;
+    }
+
+    // The queries complete in order, so the last one tells for all
+    ctxInfo->glGetQueryObjectiv(frame->queries[frame->numQueries - 1],
+            GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+        return com_sun_prism_es2_GLContext_TIMER_RESULT_NOT_READY;
+    }
+    if (frame->checkDisjoint) {
+        glGetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+        if (disjoint) {
+            return com_sun_prism_es2_GLContext_TIMER_RESULT_INVALID;
+        }
+    }
+
+    count = (*env)->GetArrayLength(env, nanosArr);
+    if (count > frame->numQueries) {
+        count = frame->numQueries;
+    }
+    for (i = 0; i < count; i++) {
+        ctxInfo->glGetQueryObjectui64v(frame->queries[i], GL_QUERY_RESULT, &value);
+        nanos = (jlong) value;
+        (*env)->SetLongArrayRegion(env, nanosArr, i, 1, &nanos);
+    }
+    return com_sun_prism_es2_GLContext_TIMER_RESULT_VALID;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nDeleteTimerFrame
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nDeleteTimerFrame
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeFrame) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    TimerFrame *frame = (TimerFrame *) jlong_to_ptr(nativeFrame);
+    if (frame == NULL) {
+        return;
+    }
+
+    if ((ctxInfo != NULL) && (ctxInfo->glDeleteQueries != NULL)) {
+        ctxInfo->glDeleteQueries(frame->numQueries, frame->queries);
+    }
+    free(frame->queries);
+    free(frame);
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nCompileShader
@@ -907,12 +1218,21 @@ int translatePrismToGL(int value) {
             return GL_LUMINANCE;
         case com_sun_prism_es2_GLContext_GL_ALPHA:
             return GL_ALPHA;
+        case com_sun_prism_es2_GLContext_GL_LUMINANCE_ALPHA:
+            return GL_LUMINANCE_ALPHA;
         case com_sun_prism_es2_GLContext_GL_RGBA32F:
             return GL_RGBA32F;
         case com_sun_prism_es2_GLContext_GL_YCBCR_422_APPLE:
             /* not using symbolic name may not be available on all platform - DrD*/
             return 0x85B9;
 
+        case com_sun_prism_es2_GLContext_GL_COMPRESSED_RGBA_S3TC_DXT1:
+            return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+        case com_sun_prism_es2_GLContext_GL_COMPRESSED_RGBA_S3TC_DXT3:
+            return GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+        case com_sun_prism_es2_GLContext_GL_COMPRESSED_RGBA_S3TC_DXT5:
+            return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+
         case com_sun_prism_es2_GLContext_GL_TEXTURE_2D:
             return GL_TEXTURE_2D;
         case com_sun_prism_es2_GLContext_GL_TEXTURE_BINDING_2D:
@@ -1079,6 +1399,191 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nReadPixelsInt
     return doReadPixels(env, nativeCtxInfo, length, buffer, pixelArr, x, y, w, h);
 }
 
+static void disposeReadPixels(ContextInfo *ctxInfo, PixelReadbackInfo *rbInfo) {
+    if (rbInfo->fence != NULL) {
+        ctxInfo->glDeleteSync(rbInfo->fence);
+    }
+    if (rbInfo->pbo != 0) {
+        ctxInfo->glDeleteBuffers(1, &rbInfo->pbo);
+    }
+    free(rbInfo);
+}
+
+/*
+ * Wait for an asynchronous read, copy its pixels into the Java buffer or
+ * array and release it. The checks mirror the ones of doReadPixels.
+ */
+static jboolean doCompleteReadPixels(JNIEnv *env, jlong nativeCtxInfo,
+        jlong nativeRbInfo, jint length, jobject buffer, jarray pixelArr) {
+    GLvoid *ptr = NULL;
+    GLvoid *src;
+    GLenum status;
+    jint size;
+    jboolean result = JNI_FALSE;
+
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    PixelReadbackInfo *rbInfo = (PixelReadbackInfo *) jlong_to_ptr(nativeRbInfo);
+    if ((ctxInfo == NULL) || (rbInfo == NULL)) {
+        fprintf(stderr, "doCompleteReadPixels: ctxInfo or rbInfo is NULL\n");
+        return JNI_FALSE;
+    }
+
+    size = rbInfo->width * rbInfo->height * 4;
+    if ((length / 4 / rbInfo->width) < rbInfo->height) {
+        fprintf(stderr, "doCompleteReadPixels: pixel buffer too small - length = %d\n",
+                (int) length);
+        disposeReadPixels(ctxInfo, rbInfo);
+        return JNI_FALSE;
+    }
+
+    do {
+        status = ctxInfo->glClientWaitSync(rbInfo->fence,
+                GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+    } while (status == GL_TIMEOUT_EXPIRED);
+
+    ctxInfo->glBindBuffer(GL_PIXEL_PACK_BUFFER, rbInfo->pbo);
+    src = ctxInfo->glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+    if (src == NULL) {
+        fprintf(stderr, "doCompleteReadPixels: failed to map pixel buffer\n");
+    } else {
+        ptr = (GLvoid *) (pixelArr ?
+                ((char *) (*env)->GetPrimitiveArrayCritical(env, pixelArr, NULL)) :
+                ((char *) (*env)->GetDirectBufferAddress(env, buffer)));
+        if (ptr == NULL) {
+            fprintf(stderr, "doCompleteReadPixels: pixel buffer is NULL\n");
+        } else {
+            memcpy(ptr, src, size);
+            if (!ctxInfo->gl2) {
+                jint i;
+                GLubyte* c = (GLubyte*) ptr;
+                GLubyte temp;
+                for (i = 0; i < rbInfo->width * rbInfo->height; i++) {
+                    temp = c[0];
+                    c[0] = c[2];
+                    c[2] = temp;
+                    c += 4;
+                }
+            }
+            if (pixelArr != NULL) {
+                (*env)->ReleasePrimitiveArrayCritical(env, pixelArr, ptr, 0);
+            }
+            result = JNI_TRUE;
+        }
+        ctxInfo->glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    ctxInfo->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    disposeReadPixels(ctxInfo, rbInfo);
+    return result;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nReadPixelsAsync
+ * Signature: (JIIII)J
+ */
+JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_GLContext_nReadPixelsAsync
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint x, jint y, jint w, jint h) {
+    PixelReadbackInfo *rbInfo;
+
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || !ctxInfo->pixelBufferMapping) {
+        return 0;
+    }
+    // fall back to a synchronous read if the size overflows
+    if (w <= 0 || h <= 0 || (INT_MAX / 4 / w) < h) {
+        return 0;
+    }
+
+    rbInfo = (PixelReadbackInfo *) calloc(1, sizeof (PixelReadbackInfo));
+    if (rbInfo == NULL) {
+        return 0;
+    }
+    rbInfo->width = w;
+    rbInfo->height = h;
+
+    ctxInfo->glGenBuffers(1, &rbInfo->pbo);
+    if (rbInfo->pbo == 0) {
+        free(rbInfo);
+        return 0;
+    }
+    ctxInfo->glBindBuffer(GL_PIXEL_PACK_BUFFER, rbInfo->pbo);
+    ctxInfo->glBufferData(GL_PIXEL_PACK_BUFFER, w * h * 4, NULL, GL_STREAM_READ);
+    if (ctxInfo->gl2) {
+        glReadPixels((GLint) x, (GLint) y, (GLsizei) w, (GLsizei) h,
+                GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, (GLvoid *) 0);
+    } else {
+        glReadPixels((GLint) x, (GLint) y, (GLsizei) w, (GLsizei) h,
+                GL_RGBA, GL_UNSIGNED_BYTE, (GLvoid *) 0);
+    }
+    ctxInfo->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    rbInfo->fence = ctxInfo->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (rbInfo->fence == NULL) {
+        disposeReadPixels(ctxInfo, rbInfo);
+        return 0;
+    }
+    // make sure the fence is submitted so that polling it can succeed
+    glFlush();
+    return ptr_to_jlong(rbInfo);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nIsReadPixelsDone
+ * Signature: (JJ)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nIsReadPixelsDone
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeRbInfo) {
+    GLenum status;
+
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    PixelReadbackInfo *rbInfo = (PixelReadbackInfo *) jlong_to_ptr(nativeRbInfo);
+    if ((ctxInfo == NULL) || (rbInfo == NULL)) {
+        return JNI_TRUE;
+    }
+
+    status = ctxInfo->glClientWaitSync(rbInfo->fence, 0, 0);
+    return (status != GL_TIMEOUT_EXPIRED) ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nCompleteReadPixelsByte
+ * Signature: (JJILjava/nio/Buffer;[B)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nCompleteReadPixelsByte
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeRbInfo,
+        jint length, jobject buffer, jbyteArray pixelArr) {
+    return doCompleteReadPixels(env, nativeCtxInfo, nativeRbInfo, length, buffer, pixelArr);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nCompleteReadPixelsInt
+ * Signature: (JJILjava/nio/Buffer;[I)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nCompleteReadPixelsInt
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeRbInfo,
+        jint length, jobject buffer, jintArray pixelArr) {
+    return doCompleteReadPixels(env, nativeCtxInfo, nativeRbInfo, length, buffer, pixelArr);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nDisposeReadPixels
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nDisposeReadPixels
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeRbInfo) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    PixelReadbackInfo *rbInfo = (PixelReadbackInfo *) jlong_to_ptr(nativeRbInfo);
+    if ((ctxInfo == NULL) || (rbInfo == NULL)) {
+        return;
+    }
+    disposeReadPixels(ctxInfo, rbInfo);
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nScissorTest
@@ -1117,6 +1622,34 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nTexParamsMinMax
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, param);
 }
 
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nGetMaxAnisotropy
+ * Signature: (J)F
+ */
+JNIEXPORT jfloat JNICALL Java_com_sun_prism_es2_GLContext_nGetMaxAnisotropy
+(JNIEnv *env, jclass class, jlong nativeCtxInfo) {
+    GLfloat maxAnisotropy = 1.0f;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || !isExtensionSupported(ctxInfo->glExtensionStr,
+            "GL_EXT_texture_filter_anisotropic")) {
+        return 1.0f;
+    }
+
+    glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &maxAnisotropy);
+    return (jfloat) maxAnisotropy;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nTexParamsAnisotropy
+ * Signature: (F)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nTexParamsAnisotropy
+(JNIEnv *env, jclass class, jfloat anisotropy) {
+    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, (GLfloat) anisotropy);
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nTexImage2D0
@@ -1195,6 +1728,41 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nTexImage2D1
     return err == GL_NO_ERROR ? JNI_TRUE : JNI_FALSE;
 }
 
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nCompressedTexImage2D
+ * Signature: (JIIII[B)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nCompressedTexImage2D
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint level, jint internalFormat,
+        jint width, jint height, jbyteArray data) {
+    char *ptr;
+    jsize length;
+    GLenum err;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (ctxInfo->glCompressedTexImage2D == NULL)
+            || (data == NULL)) {
+        return JNI_FALSE;
+    }
+
+    length = (*env)->GetArrayLength(env, data);
+    ptr = (char *) (*env)->GetPrimitiveArrayCritical(env, data, NULL);
+    if (ptr == NULL) {
+        fprintf(stderr, "nCompressedTexImage2D: GetPrimitiveArrayCritical returns NULL: out of memory\n");
+        return JNI_FALSE;
+    }
+
+    glGetError();
+    ctxInfo->glCompressedTexImage2D(GL_TEXTURE_2D, (GLint) level,
+            (GLenum) translatePrismToGL(internalFormat),
+            (GLsizei) width, (GLsizei) height, 0, (GLsizei) length, (GLvoid *) ptr);
+    err  = glGetError();
+
+    (*env)->ReleasePrimitiveArrayCritical(env, data, ptr, JNI_ABORT);
+
+    return err == GL_NO_ERROR ? JNI_TRUE : JNI_FALSE;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nTexSubImage2D0
@@ -1243,6 +1811,171 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nTexSubImage2D1
     }
 }
 
+/*
+ * Bytes per pixel of a client pixel format and type, or 0 if unknown.
+ */
+static int bytesPerPixel(GLenum format, GLenum type) {
+    int components;
+
+    switch (format) {
+        case GL_RGBA:
+        case GL_BGRA:
+            components = 4;
+            break;
+        case GL_RGB:
+            components = 3;
+            break;
+        case GL_LUMINANCE_ALPHA:
+        case 0x85B9: /* GL_YCBCR_422_APPLE */
+            components = 2;
+            break;
+        case GL_LUMINANCE:
+        case GL_ALPHA:
+            components = 1;
+            break;
+        default:
+            return 0;
+    }
+    switch (type) {
+        case GL_UNSIGNED_BYTE:
+            return components;
+        case GL_UNSIGNED_INT_8_8_8_8:
+        case GL_UNSIGNED_INT_8_8_8_8_REV:
+            return 4;
+        case 0x85BA: /* GL_UNSIGNED_SHORT_8_8_APPLE */
+            return 2;
+        case GL_FLOAT:
+            return components * 4;
+        default:
+            return 0;
+    }
+}
+
+/*
+ * Upload through the next of the TEX_UPLOAD_SLOTS pixel buffer objects.
+ * The pixels are copied into the mapped buffer, so glTexSubImage2D returns
+ * without waiting for the driver to read client memory; each slot is fenced
+ * and only rewritten once the GPU is done with it. Returns the number of
+ * bytes staged, or 0 without uploading anything if the update is smaller
+ * than minBytes, reads past the length bytes the caller has, or can't be
+ * staged.
+ */
+static jint doTexSubImage2DPBO(JNIEnv *env, ContextInfo *ctxInfo,
+        jint target, jint level, jint xoffset, jint yoffset,
+        jint width, jint height, jint format, jint type,
+        jobject pixels, jint pixelsByteOffset, jint length, jint minBytes,
+        jboolean direct) {
+    GLenum glFormat = (GLenum) translatePrismToGL(format);
+    GLenum glType = (GLenum) translatePrismToGL(type);
+    int bpp = bytesPerPixel(glFormat, glType);
+    GLint rowLength = 0;
+    GLint alignment = 4;
+    jlong rowBytes, size;
+    int slot;
+    GLsync fence;
+    char *src;
+    void *dst;
+
+    if ((ctxInfo == NULL) || !ctxInfo->pixelBufferMapping || (pixels == NULL)
+            || (bpp == 0) || (width <= 0) || (height <= 0)) {
+        return 0;
+    }
+
+    // the extent glTexSubImage2D reads under the current unpack state
+    glGetIntegerv(GL_UNPACK_ROW_LENGTH, &rowLength);
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+    rowBytes = (jlong) (rowLength > 0 ? rowLength : width) * bpp;
+    rowBytes = (rowBytes + alignment - 1) / alignment * alignment;
+    size = rowBytes * (height - 1) + (jlong) width * bpp;
+    if ((size < minBytes) || (size > length)) {
+        return 0;
+    }
+
+    slot = (ctxInfo->texUploadSlot + 1) % TEX_UPLOAD_SLOTS;
+    ctxInfo->texUploadSlot = slot;
+    fence = ctxInfo->texUploadFences[slot];
+    if (fence != NULL) {
+        GLenum status;
+        do {
+            status = ctxInfo->glClientWaitSync(fence,
+                    GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+        } while (status == GL_TIMEOUT_EXPIRED);
+        ctxInfo->glDeleteSync(fence);
+        ctxInfo->texUploadFences[slot] = NULL;
+    }
+    if (ctxInfo->texUploadBuffers[slot] == 0) {
+        ctxInfo->glGenBuffers(1, &ctxInfo->texUploadBuffers[slot]);
+        if (ctxInfo->texUploadBuffers[slot] == 0) {
+            return 0;
+        }
+    }
+    ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ctxInfo->texUploadBuffers[slot]);
+    if (ctxInfo->texUploadSizes[slot] < size) {
+        ctxInfo->glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr) size, NULL,
+                GL_STREAM_DRAW);
+        ctxInfo->texUploadSizes[slot] = (GLsizeiptr) size;
+    }
+    dst = ctxInfo->glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (GLsizeiptr) size,
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (dst == NULL) {
+        ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        return 0;
+    }
+
+    src = direct ? (char *) (*env)->GetDirectBufferAddress(env, pixels)
+            : (char *) (*env)->GetPrimitiveArrayCritical(env, pixels, NULL);
+    if (src != NULL) {
+        memcpy(dst, src + pixelsByteOffset, (size_t) size);
+        if (!direct) {
+            (*env)->ReleasePrimitiveArrayCritical(env, pixels, src, JNI_ABORT);
+        }
+    }
+    ctxInfo->glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    if (src == NULL) {
+        fprintf(stderr, "nTexSubImage2DPBO: pixel buffer is NULL\n");
+        ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        return 0;
+    }
+
+    glTexSubImage2D((GLenum) translatePrismToGL(target), (GLint) level,
+            (GLint) xoffset, (GLint) yoffset,
+            (GLsizei) width, (GLsizei) height, glFormat, glType, (GLvoid *) 0);
+    ctxInfo->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    ctxInfo->texUploadFences[slot] =
+            ctxInfo->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    return (jint) size;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nTexSubImage2DPBO0
+ * Signature: (JIIIIIIIILjava/lang/Object;III)I
+ */
+JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nTexSubImage2DPBO0
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint target, jint level,
+        jint xoffset, jint yoffset, jint width, jint height, jint format,
+        jint type, jobject pixels, jint pixelsByteOffset, jint length, jint minBytes) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    return doTexSubImage2DPBO(env, ctxInfo, target, level, xoffset, yoffset,
+            width, height, format, type, pixels, pixelsByteOffset, length,
+            minBytes, JNI_TRUE);
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nTexSubImage2DPBO1
+ * Signature: (JIIIIIIIILjava/lang/Object;III)I
+ */
+JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nTexSubImage2DPBO1
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint target, jint level,
+        jint xoffset, jint yoffset, jint width, jint height, jint format,
+        jint type, jobject pixels, jint pixelsByteOffset, jint length, jint minBytes) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    return doTexSubImage2DPBO(env, ctxInfo, target, level, xoffset, yoffset,
+            width, height, format, type, pixels, pixelsByteOffset, length,
+            minBytes, JNI_FALSE);
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nUpdateViewport
@@ -1549,14 +2282,22 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUniformMatrix4fv
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nUpdateFilterState
- * Signature: (JIZ)V
+ * Signature: (JIZZ)V
  */
 JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nUpdateFilterState
-(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint texID, jboolean linearFiler) {
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint texID, jboolean linearFiler,
+        jboolean useMipmap) {
     int glFilter;
+    int glMinFilter;
 
     glFilter = linearFiler ? GL_LINEAR : GL_NEAREST;
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, glFilter);
+    // keep sampling the mipmaps of textures that have them
+    if (useMipmap) {
+        glMinFilter = linearFiler ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_NEAREST;
+    } else {
+        glMinFilter = glFilter;
+    }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, glMinFilter);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, glFilter);
 }
 
@@ -1650,6 +2391,141 @@ static void setVertexAttributePointers(ContextInfo *ctx, float *pFloat, char *pB
         ctx->vbByteData = pByte;
     }
 }
+/*
+ * Create the ring buffer of the vertex stream. Called with the context
+ * current; on failure the context falls back to client vertex arrays.
+ */
+static jboolean createVertexStream(ContextInfo *ctx) {
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    ctx->glGenBuffers(1, &ctx->vertexStreamBuffer);
+    if (ctx->vertexStreamBuffer == 0) {
+        ctx->vertexStreamMode = VERTEX_STREAM_NONE;
+        return JNI_FALSE;
+    }
+    ctx->glBindBuffer(GL_ARRAY_BUFFER, ctx->vertexStreamBuffer);
+    if (ctx->vertexStreamMode == VERTEX_STREAM_PERSISTENT) {
+        ctx->glBufferStorage(GL_ARRAY_BUFFER, VERTEX_STREAM_SIZE, NULL, flags);
+        ctx->vertexStreamData = (char *) ctx->glMapBufferRange(GL_ARRAY_BUFFER,
+                0, VERTEX_STREAM_SIZE, flags);
+        if (ctx->vertexStreamData == NULL) {
+            // Buffer storage is immutable, start over with a mappable buffer
+            ctx->glBindBuffer(GL_ARRAY_BUFFER, 0);
+            ctx->glDeleteBuffers(1, &ctx->vertexStreamBuffer);
+            ctx->vertexStreamBuffer = 0;
+            ctx->vertexStreamMode = VERTEX_STREAM_MAP;
+            return createVertexStream(ctx);
+        }
+    } else {
+        ctx->glBufferData(GL_ARRAY_BUFFER, VERTEX_STREAM_SIZE, NULL, GL_STREAM_DRAW);
+    }
+    ctx->vertexStreamOffset = 0;
+    ctx->vertexStreamSegment = 0;
+    return JNI_TRUE;
+}
+
+/*
+ * Reserve size bytes of the vertex stream and return their offset in the
+ * buffer, which must be bound to GL_ARRAY_BUFFER. A persistent stream hands
+ * out its segments in turn, fencing each one as it is left and waiting for
+ * that fence before the segment comes around again. Otherwise the buffer is
+ * orphaned when it wraps, so later ranges can be mapped unsynchronized.
+ */
+static GLintptr reserveVertexStream(ContextInfo *ctx, GLsizeiptr size) {
+    GLintptr offset = ctx->vertexStreamOffset;
+
+    if (ctx->vertexStreamMode == VERTEX_STREAM_PERSISTENT) {
+        int segment = ctx->vertexStreamSegment;
+        if (offset + size > (GLintptr) (segment + 1) * VERTEX_STREAM_SEGMENT_SIZE) {
+            GLsync fence;
+            ctx->vertexStreamFences[segment] =
+                    ctx->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            segment = (segment + 1) % VERTEX_STREAM_SEGMENTS;
+            offset = (GLintptr) segment * VERTEX_STREAM_SEGMENT_SIZE;
+            fence = ctx->vertexStreamFences[segment];
+            if (fence != NULL) {
+                GLenum status;
+                do {
+                    status = ctx->glClientWaitSync(fence,
+                            GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+                } while (status == GL_TIMEOUT_EXPIRED);
+                ctx->glDeleteSync(fence);
+                ctx->vertexStreamFences[segment] = NULL;
+            }
+            ctx->vertexStreamSegment = segment;
+        }
+    } else if (offset + size > VERTEX_STREAM_SIZE) {
+        ctx->glBufferData(GL_ARRAY_BUFFER, VERTEX_STREAM_SIZE, NULL, GL_STREAM_DRAW);
+        offset = 0;
+    }
+    // keep every batch 16-byte aligned
+    ctx->vertexStreamOffset = (offset + size + 15) & ~((GLintptr) 15);
+    return offset;
+}
+
+/*
+ * Copy the vertices straight from the Java arrays into the vertex stream
+ * and draw them from there. Returns JNI_FALSE if the stream can't take
+ * the batch, in which case the caller draws from client arrays instead.
+ */
+static jboolean drawStreamedQuads(JNIEnv *env, ContextInfo *ctx, jint numVertices,
+        jfloatArray dataf, jbyteArray datab) {
+    GLsizeiptr floatSize = (GLsizeiptr) numVertices * coordStride;
+    GLsizeiptr size = floatSize + (GLsizeiptr) numVertices * colorStride;
+    GLintptr offset;
+    char *pData;
+    int numQuads = numVertices / 4;
+
+    if ((ctx->vertexStreamMode == VERTEX_STREAM_NONE)
+            || (size > VERTEX_STREAM_SEGMENT_SIZE)) {
+        return JNI_FALSE;
+    }
+    if ((ctx->vertexStreamBuffer == 0) && !createVertexStream(ctx)) {
+        return JNI_FALSE;
+    }
+
+    ctx->glBindBuffer(GL_ARRAY_BUFFER, ctx->vertexStreamBuffer);
+    offset = reserveVertexStream(ctx, size);
+    if (ctx->vertexStreamMode == VERTEX_STREAM_PERSISTENT) {
+        pData = ctx->vertexStreamData + offset;
+    } else {
+        pData = (char *) ctx->glMapBufferRange(GL_ARRAY_BUFFER, offset, size,
+                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT
+                | GL_MAP_UNSYNCHRONIZED_BIT);
+        if (pData == NULL) {
+            ctx->glBindBuffer(GL_ARRAY_BUFFER, 0);
+            return JNI_FALSE;
+        }
+    }
+
+    (*env)->GetFloatArrayRegion(env, dataf, 0, numVertices * FLOATS_PER_VERT,
+            (jfloat *) pData);
+    (*env)->GetByteArrayRegion(env, datab, 0, numVertices * colorStride,
+            (jbyte *) (pData + floatSize));
+    if (ctx->vertexStreamMode != VERTEX_STREAM_PERSISTENT) {
+        ctx->glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+
+    if (!(*env)->ExceptionCheck(env)) {
+        // With a buffer bound the attribute pointers are offsets into it
+        char *base = (char *) (size_t) offset;
+        ctx->glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, coordStride, base);
+        ctx->glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, coordStride,
+            base + sizeof(float) * FLOATS_PER_VC);
+        ctx->glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, coordStride,
+            base + sizeof(float) * (FLOATS_PER_VC + FLOATS_PER_TC));
+        ctx->glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, colorStride,
+            base + floatSize);
+        glDrawElements(GL_TRIANGLES, numQuads * 2 * 3, GL_UNSIGNED_SHORT, 0);
+    }
+    ctx->glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // The cached pointers are only meaningful for client arrays
+    ctx->vbFloatData = NULL;
+    ctx->vbByteData = NULL;
+    return JNI_TRUE;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nDrawIndexedQuads
@@ -1668,6 +2544,10 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nDrawIndexedQuads
         return;
     }
 
+    if (drawStreamedQuads(env, ctxInfo, numVertices, dataf, datab)) {
+        return;
+    }
+
     pFloat = (float *)(*env)->GetPrimitiveArrayCritical(env, dataf, NULL);
     pByte = (char *)(*env)->GetPrimitiveArrayCritical(env, datab, NULL);
 
@@ -1824,6 +2704,10 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_GLContext_nCreateES2Mesh
     meshInfo->vboIDArray[MESH_INDEXBUFFER] = 0;
     meshInfo->indexBufferSize = 0;
     meshInfo->indexBufferType = 0;
+    meshInfo->vertexBufferCapacity = 0;
+    meshInfo->indexBufferCapacity = 0;
+    meshInfo->vertexBufferLength = 0;
+    meshInfo->dynamic = GL_FALSE;
 
     /* create vbo ids */
     ctxInfo->glGenBuffers(MESH_MAX_BUFFERS, (meshInfo->vboIDArray));
@@ -1852,6 +2736,28 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nReleaseES2Mesh
     free(meshInfo);
 }
 
+/*
+ * Uploads the data of a mesh buffer that is bound to target. A mesh that
+ * is built once keeps a static store. Once it is rebuilt its buffers are
+ * marked dynamic: the store is orphaned before each upload, so the driver
+ * can hand out fresh memory instead of waiting for draws that still read
+ * the previous contents, and it is only reallocated when it has to grow.
+ */
+static void uploadMeshBuffer(ContextInfo *ctxInfo, GLenum target,
+        GLuint *capacity, GLboolean dynamic, GLsizeiptr size, const GLvoid *data)
+{
+    if (!dynamic) {
+        ctxInfo->glBufferData(target, size, data, GL_STATIC_DRAW);
+        *capacity = (GLuint) size;
+    } else if (ctxInfo->glBufferSubData != NULL && (GLuint) size <= *capacity) {
+        ctxInfo->glBufferData(target, *capacity, NULL, GL_DYNAMIC_DRAW);
+        ctxInfo->glBufferSubData(target, 0, size, data);
+    } else {
+        ctxInfo->glBufferData(target, size, data, GL_DYNAMIC_DRAW);
+        *capacity = (GLuint) size;
+    }
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nBuildNativeGeometryShort
@@ -1894,15 +2800,21 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
     }
 
     if (status) {
+        // A mesh that is built again is being updated, see uploadMeshBuffer
+        if (meshInfo->vertexBufferCapacity > 0) {
+            meshInfo->dynamic = GL_TRUE;
+        }
+
         // Initialize vertex buffer
         ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_VERTEXBUFFER]);
-        ctxInfo->glBufferData(GL_ARRAY_BUFFER, uvbSize * sizeof (GLfloat),
-                vertexBuffer, GL_STATIC_DRAW);
+        uploadMeshBuffer(ctxInfo, GL_ARRAY_BUFFER, &meshInfo->vertexBufferCapacity,
+                meshInfo->dynamic, uvbSize * sizeof (GLfloat), vertexBuffer);
+        meshInfo->vertexBufferLength = uvbSize;
 
         // Initialize index buffer
         ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_INDEXBUFFER]);
-        ctxInfo->glBufferData(GL_ELEMENT_ARRAY_BUFFER, uibSize * sizeof (GLushort),
-                indexBuffer, GL_STATIC_DRAW);
+        uploadMeshBuffer(ctxInfo, GL_ELEMENT_ARRAY_BUFFER, &meshInfo->indexBufferCapacity,
+                meshInfo->dynamic, uibSize * sizeof (GLushort), indexBuffer);
         meshInfo->indexBufferSize = uibSize;
         meshInfo->indexBufferType = GL_UNSIGNED_SHORT;
 
@@ -1963,15 +2875,21 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
     }
 
     if (status) {
+        // A mesh that is built again is being updated, see uploadMeshBuffer
+        if (meshInfo->vertexBufferCapacity > 0) {
+            meshInfo->dynamic = GL_TRUE;
+        }
+
         // Initialize vertex buffer
         ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_VERTEXBUFFER]);
-        ctxInfo->glBufferData(GL_ARRAY_BUFFER, uvbSize * sizeof (GLfloat),
-                vertexBuffer, GL_STATIC_DRAW);
+        uploadMeshBuffer(ctxInfo, GL_ARRAY_BUFFER, &meshInfo->vertexBufferCapacity,
+                meshInfo->dynamic, uvbSize * sizeof (GLfloat), vertexBuffer);
+        meshInfo->vertexBufferLength = uvbSize;
 
         // Initialize index buffer
         ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_INDEXBUFFER]);
-        ctxInfo->glBufferData(GL_ELEMENT_ARRAY_BUFFER, uibSize * sizeof (GLuint),
-                indexBuffer, GL_STATIC_DRAW);
+        uploadMeshBuffer(ctxInfo, GL_ELEMENT_ARRAY_BUFFER, &meshInfo->indexBufferCapacity,
+                meshInfo->dynamic, uibSize * sizeof (GLuint), indexBuffer);
         meshInfo->indexBufferSize = uibSize;
         meshInfo->indexBufferType = GL_UNSIGNED_INT;
 
@@ -1990,6 +2908,57 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
     return status;
 }
 
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nUpdateNativeVertices
+ * Signature: (JJ[FIII)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nUpdateNativeVertices
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeMeshInfo,
+        jfloatArray vbArray, jint vbSize, jint dirtyFrom, jint dirtyTo)
+{
+    GLfloat *vertexBuffer;
+    GLuint uvbSize;
+
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    MeshInfo *meshInfo = (MeshInfo *) jlong_to_ptr(nativeMeshInfo);
+    if ((ctxInfo == NULL) || (meshInfo == NULL) || (vbArray == NULL) ||
+            (ctxInfo->glBindBuffer == NULL) ||
+            (ctxInfo->glBufferData == NULL) ||
+            (ctxInfo->glBufferSubData == NULL) ||
+            (meshInfo->vboIDArray[MESH_VERTEXBUFFER] == 0) ||
+            vbSize < 0 || dirtyFrom < 0 || dirtyTo < dirtyFrom) {
+        return JNI_FALSE;
+    }
+
+    // Only the vertices may change here, the layout of the mesh stays the same
+    uvbSize = (GLuint) vbSize;
+    if (uvbSize != meshInfo->vertexBufferLength || (GLuint) dirtyTo > uvbSize
+            || uvbSize > (GLuint) (*env)->GetArrayLength(env, vbArray)) {
+        return JNI_FALSE;
+    }
+
+    vertexBuffer = (GLfloat *) ((*env)->GetPrimitiveArrayCritical(env, vbArray, NULL));
+    if (vertexBuffer == NULL) {
+        return JNI_FALSE;
+    }
+
+    meshInfo->dynamic = GL_TRUE;
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_VERTEXBUFFER]);
+    if ((GLuint) (dirtyTo - dirtyFrom) < uvbSize / 2) {
+        // A small change is written in place
+        ctxInfo->glBufferSubData(GL_ARRAY_BUFFER, dirtyFrom * sizeof (GLfloat),
+                (dirtyTo - dirtyFrom) * sizeof (GLfloat), vertexBuffer + dirtyFrom);
+    } else {
+        uploadMeshBuffer(ctxInfo, GL_ARRAY_BUFFER, &meshInfo->vertexBufferCapacity,
+                meshInfo->dynamic, uvbSize * sizeof (GLfloat), vertexBuffer);
+    }
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    (*env)->ReleasePrimitiveArrayCritical(env, vbArray, vertexBuffer, JNI_ABORT);
+    return JNI_TRUE;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nCreateES2PhongMaterial
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -134,6 +134,7 @@ typedef EGLNativeWindowType  Window;
 typedef EGLConfig            GLXFBConfig;
 typedef unsigned long        Colormap;
 typedef unsigned long        PFNGLXSWAPINTERVALSGIPROC;
+typedef unsigned long        PFNGLXSWAPINTERVALEXTPROC;
 
 #include <android/log.h>
 #include <string.h>
@@ -214,6 +215,29 @@ struct StateInfoRec {
     GLuint fbo;
 };
 
+/* Modes of the streaming vertex buffer */
+#define VERTEX_STREAM_NONE 0       /* client vertex arrays */
+#define VERTEX_STREAM_MAP 1        /* unsynchronized glMapBufferRange */
+#define VERTEX_STREAM_PERSISTENT 2 /* persistently mapped buffer storage */
+
+#define VERTEX_STREAM_SEGMENTS 4
+#define VERTEX_STREAM_SEGMENT_SIZE (1024 * 1024)
+#define VERTEX_STREAM_SIZE (VERTEX_STREAM_SEGMENTS * VERTEX_STREAM_SEGMENT_SIZE)
+
+/* Number of pixel buffer objects texture uploads rotate through */
+#define TEX_UPLOAD_SLOTS 3
+
+/* Typedef for asynchronous readback struct */
+typedef struct PixelReadbackInfoRec PixelReadbackInfo;
+
+/* define the structure to hold a pending read into a pixel buffer object */
+struct PixelReadbackInfoRec {
+    GLuint pbo;
+    GLsync fence;
+    jint width;
+    jint height;
+};
+
 /* Typedef for context properties struct */
 typedef struct ContextInfoRec ContextInfo;
 
@@ -263,6 +287,10 @@ struct ContextInfoRec {
 #ifdef UNIX /* LINUX || SOLARIS */
     char *glxExtensionStr;
     PFNGLXSWAPINTERVALSGIPROC glXSwapIntervalSGI;
+    /* set only when adaptive vsync was requested and is supported */
+    PFNGLXSWAPINTERVALEXTPROC glXSwapIntervalEXT;
+    Window swapIntervalWindow;
+    jboolean bufferAgeSupported;
 #endif /* LINUX || SOLARIS */
 
     /* gl function pointers */
@@ -318,6 +346,28 @@ struct ContextInfoRec {
     PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glRenderbufferStorageMultisample;
     PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer;
 
+    /* optional, used by the streaming vertex buffer if available */
+    PFNGLMAPBUFFERRANGEPROC glMapBufferRange;
+    PFNGLUNMAPBUFFERPROC glUnmapBuffer;
+    PFNGLBUFFERSTORAGEPROC glBufferStorage;
+    PFNGLFENCESYNCPROC glFenceSync;
+    PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
+    PFNGLDELETESYNCPROC glDeleteSync;
+
+    /* optional, used by the shader program binary cache if available */
+    PFNGLGETPROGRAMBINARYPROC glGetProgramBinary;
+    PFNGLPROGRAMBINARYPROC glProgramBinary;
+
+    /* optional, used by the GPU frame timer if available */
+    PFNGLGENQUERIESPROC glGenQueries;
+    PFNGLDELETEQUERIESPROC glDeleteQueries;
+    PFNGLQUERYCOUNTERPROC glQueryCounter;
+    PFNGLGETQUERYOBJECTIVPROC glGetQueryObjectiv;
+    PFNGLGETQUERYOBJECTUI64VPROC glGetQueryObjectui64v;
+
+    /* optional, used by textures created from block compressed images */
+    PFNGLCOMPRESSEDTEXIMAGE2DPROC glCompressedTexImage2D;
+
     /* For state caching */
     StateInfo state;
 
@@ -328,6 +378,23 @@ struct ContextInfoRec {
     char  *vbByteData;
     jboolean gl2;
 
+    /* streaming vertex buffer used by nDrawIndexedQuads, see initVertexStream */
+    jint vertexStreamMode;
+    GLuint vertexStreamBuffer;
+    GLintptr vertexStreamOffset;
+    jint vertexStreamSegment;
+    char *vertexStreamData;
+    GLsync vertexStreamFences[VERTEX_STREAM_SEGMENTS];
+
+    /* pixel buffer objects can be mapped and fenced, see initBufferMapping */
+    jboolean pixelBufferMapping;
+
+    /* staging buffers of large texture uploads, see nTexSubImage2DPBO */
+    GLuint texUploadBuffers[TEX_UPLOAD_SLOTS];
+    GLsizeiptr texUploadSizes[TEX_UPLOAD_SLOTS];
+    GLsync texUploadFences[TEX_UPLOAD_SLOTS];
+    jint texUploadSlot;
+
     /* Caching properties passed down from Java */
     jboolean vSyncRequested;
 };
@@ -363,6 +430,12 @@ struct MeshInfoRec {
     GLuint vboIDArray[MESH_MAX_BUFFERS];
     GLuint indexBufferSize;
     GLenum indexBufferType;
+    // Allocated sizes in bytes of the buffer stores, kept for meshes
+    // that are rebuilt so their stores can be reused
+    GLuint vertexBufferCapacity;
+    GLuint indexBufferCapacity;
+    GLuint vertexBufferLength; // number of floats in the vertex buffer
+    GLboolean dynamic;
 };
 
 typedef struct PhongMaterialInfoRec PhongMaterialInfo;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -256,6 +256,54 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_IOSGLContext_nInitialize
             getProcAddress("glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
             getProcAddress("glBlitFramebuffer");
+    ctxInfo->glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)
+            getProcAddress("glMapBufferRange");
+    ctxInfo->glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)
+            getProcAddress("glUnmapBuffer");
+    ctxInfo->glBufferStorage = (PFNGLBUFFERSTORAGEPROC)
+            getProcAddress("glBufferStorage");
+    ctxInfo->glFenceSync = (PFNGLFENCESYNCPROC)
+            getProcAddress("glFenceSync");
+    ctxInfo->glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)
+            getProcAddress("glClientWaitSync");
+    ctxInfo->glDeleteSync = (PFNGLDELETESYNCPROC)
+            getProcAddress("glDeleteSync");
+    ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+            getProcAddress("glGetProgramBinary");
+    ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+            getProcAddress("glProgramBinary");
+    if (ctxInfo->glGetProgramBinary == NULL || ctxInfo->glProgramBinary == NULL) {
+        // OpenGL ES 2.0 has them with GL_OES_get_program_binary
+        ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+                getProcAddress("glGetProgramBinaryOES");
+        ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+                getProcAddress("glProgramBinaryOES");
+    }
+    ctxInfo->glGenQueries = (PFNGLGENQUERIESPROC)
+            getProcAddress("glGenQueries");
+    ctxInfo->glDeleteQueries = (PFNGLDELETEQUERIESPROC)
+            getProcAddress("glDeleteQueries");
+    ctxInfo->glQueryCounter = (PFNGLQUERYCOUNTERPROC)
+            getProcAddress("glQueryCounter");
+    ctxInfo->glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)
+            getProcAddress("glGetQueryObjectiv");
+    ctxInfo->glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)
+            getProcAddress("glGetQueryObjectui64v");
+    if (ctxInfo->glQueryCounter == NULL) {
+        // OpenGL ES has them with GL_EXT_disjoint_timer_query
+        ctxInfo->glGenQueries = (PFNGLGENQUERIESPROC)
+                getProcAddress("glGenQueriesEXT");
+        ctxInfo->glDeleteQueries = (PFNGLDELETEQUERIESPROC)
+                getProcAddress("glDeleteQueriesEXT");
+        ctxInfo->glQueryCounter = (PFNGLQUERYCOUNTERPROC)
+                getProcAddress("glQueryCounterEXT");
+        ctxInfo->glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)
+                getProcAddress("glGetQueryObjectivEXT");
+        ctxInfo->glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)
+                getProcAddress("glGetQueryObjectui64vEXT");
+    }
+    ctxInfo->glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)
+            getProcAddress("glCompressedTexImage2D");
 
     // initialize platform states and properties to match
     // cached states and properties
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,6 +34,9 @@
 #include "../PrismES2Defs.h"
 #include "com_sun_prism_es2_MacGLContext.h"
 
+#include <IOSurface/IOSurface.h>
+#include <OpenGL/CGLIOSurface.h>
+
 extern void printAndReleaseResources(jlong pf, jlong ctx, const char *message);
 
 /*
@@ -255,6 +258,34 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_MacGLContext_nInitialize
             dlsym(RTLD_DEFAULT, "glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
             dlsym(RTLD_DEFAULT, "glBlitFramebuffer");
+    ctxInfo->glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)
+            dlsym(RTLD_DEFAULT, "glMapBufferRange");
+    ctxInfo->glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)
+            dlsym(RTLD_DEFAULT, "glUnmapBuffer");
+    ctxInfo->glBufferStorage = (PFNGLBUFFERSTORAGEPROC)
+            dlsym(RTLD_DEFAULT, "glBufferStorage");
+    ctxInfo->glFenceSync = (PFNGLFENCESYNCPROC)
+            dlsym(RTLD_DEFAULT, "glFenceSync");
+    ctxInfo->glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)
+            dlsym(RTLD_DEFAULT, "glClientWaitSync");
+    ctxInfo->glDeleteSync = (PFNGLDELETESYNCPROC)
+            dlsym(RTLD_DEFAULT, "glDeleteSync");
+    ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+            dlsym(RTLD_DEFAULT, "glGetProgramBinary");
+    ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+            dlsym(RTLD_DEFAULT, "glProgramBinary");
+    ctxInfo->glGenQueries = (PFNGLGENQUERIESPROC)
+            dlsym(RTLD_DEFAULT, "glGenQueries");
+    ctxInfo->glDeleteQueries = (PFNGLDELETEQUERIESPROC)
+            dlsym(RTLD_DEFAULT, "glDeleteQueries");
+    ctxInfo->glQueryCounter = (PFNGLQUERYCOUNTERPROC)
+            dlsym(RTLD_DEFAULT, "glQueryCounter");
+    ctxInfo->glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)
+            dlsym(RTLD_DEFAULT, "glGetQueryObjectiv");
+    ctxInfo->glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)
+            dlsym(RTLD_DEFAULT, "glGetQueryObjectui64v");
+    ctxInfo->glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)
+            dlsym(RTLD_DEFAULT, "glCompressedTexImage2D");
 
     // initialize platform states and properties to match
     // cached states and properties
@@ -311,3 +342,58 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_MacGLContext_nMakeCurrent
     ctxInfo->state.vSyncEnabled = vSyncNeeded;
     setSwapInterval((void *) jlong_to_ptr(ctxInfo->context), interval);
 }
+
+/*
+ * Class:     com_sun_prism_es2_MacGLContext
+ * Method:    nCopyIOSurface
+ * Signature: (JJIIIZ)Z
+ *
+ * Copies an IOSurface into the texture on the GPU: the surface is bound to
+ * a rectangle texture, attached to a framebuffer and read back into the
+ * texture with glCopyTexSubImage2D.
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_MacGLContext_nCopyIOSurface
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeSurface,
+        jint texID, jint width, jint height, jboolean ycbcr) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    IOSurfaceRef surface = (IOSurfaceRef) jlong_to_ptr(nativeSurface);
+    GLint savedFBO = 0;
+    GLuint rectTexID = 0;
+    GLuint fboID = 0;
+    jboolean status = JNI_FALSE;
+
+    if ((ctxInfo == NULL) || (surface == NULL) || (texID == 0) ||
+            (ctxInfo->glGenFramebuffers == NULL) ||
+            (ctxInfo->glBindFramebuffer == NULL) ||
+            (ctxInfo->glFramebufferTexture2D == NULL) ||
+            (ctxInfo->glCheckFramebufferStatus == NULL) ||
+            (ctxInfo->glDeleteFramebuffers == NULL)) {
+        return JNI_FALSE;
+    }
+
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &savedFBO);
+    glGenTextures(1, &rectTexID);
+    glBindTexture(GL_TEXTURE_RECTANGLE_ARB, rectTexID);
+    if (CGLTexImageIOSurface2D(CGLGetCurrentContext(), GL_TEXTURE_RECTANGLE_ARB,
+            ycbcr ? GL_RGB : GL_RGBA, (GLsizei) width, (GLsizei) height,
+            ycbcr ? GL_YCBCR_422_APPLE : GL_BGRA,
+            ycbcr ? GL_UNSIGNED_SHORT_8_8_APPLE : GL_UNSIGNED_INT_8_8_8_8_REV,
+            surface, 0) == kCGLNoError) {
+        ctxInfo->glGenFramebuffers(1, &fboID);
+        ctxInfo->glBindFramebuffer(GL_FRAMEBUFFER, fboID);
+        ctxInfo->glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                GL_TEXTURE_RECTANGLE_ARB, rectTexID, 0);
+        if (ctxInfo->glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE) {
+            glBindTexture(GL_TEXTURE_2D, (GLuint) texID);
+            glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, 0,
+                    (GLsizei) width, (GLsizei) height);
+            status = glGetError() == GL_NO_ERROR;
+        }
+        ctxInfo->glBindFramebuffer(GL_FRAMEBUFFER, (GLuint) savedFBO);
+        ctxInfo->glDeleteFramebuffers(1, &fboID);
+    }
+    glBindTexture(GL_TEXTURE_RECTANGLE_ARB, 0);
+    glDeleteTextures(1, &rectTexID);
+
+    return status;
+}
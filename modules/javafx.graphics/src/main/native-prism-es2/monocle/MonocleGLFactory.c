@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -217,6 +217,54 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_MonocleGLFactory_nPopulateNativeC
                             GET_DLSYM(handle, "glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
                             GET_DLSYM(handle, "glBlitFramebuffer");
+    ctxInfo->glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)
+                            GET_DLSYM(handle, "glMapBufferRange");
+    ctxInfo->glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)
+                            GET_DLSYM(handle, "glUnmapBuffer");
+    ctxInfo->glBufferStorage = (PFNGLBUFFERSTORAGEPROC)
+                            GET_DLSYM(handle, "glBufferStorage");
+    ctxInfo->glFenceSync = (PFNGLFENCESYNCPROC)
+                            GET_DLSYM(handle, "glFenceSync");
+    ctxInfo->glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)
+                            GET_DLSYM(handle, "glClientWaitSync");
+    ctxInfo->glDeleteSync = (PFNGLDELETESYNCPROC)
+                            GET_DLSYM(handle, "glDeleteSync");
+    ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+                            GET_DLSYM(handle, "glGetProgramBinary");
+    ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+                            GET_DLSYM(handle, "glProgramBinary");
+    if (ctxInfo->glGetProgramBinary == NULL || ctxInfo->glProgramBinary == NULL) {
+        // OpenGL ES 2.0 has them with GL_OES_get_program_binary
+        ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+                                GET_DLSYM(handle, "glGetProgramBinaryOES");
+        ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+                                GET_DLSYM(handle, "glProgramBinaryOES");
+    }
+    ctxInfo->glGenQueries = (PFNGLGENQUERIESPROC)
+                            GET_DLSYM(handle, "glGenQueries");
+    ctxInfo->glDeleteQueries = (PFNGLDELETEQUERIESPROC)
+                            GET_DLSYM(handle, "glDeleteQueries");
+    ctxInfo->glQueryCounter = (PFNGLQUERYCOUNTERPROC)
+                            GET_DLSYM(handle, "glQueryCounter");
+    ctxInfo->glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)
+                            GET_DLSYM(handle, "glGetQueryObjectiv");
+    ctxInfo->glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)
+                            GET_DLSYM(handle, "glGetQueryObjectui64v");
+    if (ctxInfo->glQueryCounter == NULL) {
+        // OpenGL ES has them with GL_EXT_disjoint_timer_query
+        ctxInfo->glGenQueries = (PFNGLGENQUERIESPROC)
+                                GET_DLSYM(handle, "glGenQueriesEXT");
+        ctxInfo->glDeleteQueries = (PFNGLDELETEQUERIESPROC)
+                                GET_DLSYM(handle, "glDeleteQueriesEXT");
+        ctxInfo->glQueryCounter = (PFNGLQUERYCOUNTERPROC)
+                                GET_DLSYM(handle, "glQueryCounterEXT");
+        ctxInfo->glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)
+                                GET_DLSYM(handle, "glGetQueryObjectivEXT");
+        ctxInfo->glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)
+                                GET_DLSYM(handle, "glGetQueryObjectui64vEXT");
+    }
+    ctxInfo->glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)
+                            GET_DLSYM(handle, "glCompressedTexImage2D");
 
     initState(ctxInfo);
     return ctxInfo;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,11 +36,11 @@
 /*
  * Class:     com_sun_prism_es2_X11GLContext
  * Method:    nInitialize
- * Signature: (JJZ)J
+ * Signature: (JJZZ)J
  */
 JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_X11GLContext_nInitialize
 (JNIEnv *env, jclass class, jlong nativeDInfo, jlong nativePFInfo,
-        jboolean vSyncRequested) {
+        jboolean vSyncRequested, jboolean adaptiveVsyncRequested) {
     const char *glVersion;
     const char *glVendor;
     const char *glRenderer;
@@ -268,6 +268,34 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_X11GLContext_nInitialize
             dlsym(RTLD_DEFAULT,"glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
             dlsym(RTLD_DEFAULT,"glBlitFramebuffer");
+    ctxInfo->glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)
+            dlsym(RTLD_DEFAULT,"glMapBufferRange");
+    ctxInfo->glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)
+            dlsym(RTLD_DEFAULT,"glUnmapBuffer");
+    ctxInfo->glBufferStorage = (PFNGLBUFFERSTORAGEPROC)
+            dlsym(RTLD_DEFAULT,"glBufferStorage");
+    ctxInfo->glFenceSync = (PFNGLFENCESYNCPROC)
+            dlsym(RTLD_DEFAULT,"glFenceSync");
+    ctxInfo->glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)
+            dlsym(RTLD_DEFAULT,"glClientWaitSync");
+    ctxInfo->glDeleteSync = (PFNGLDELETESYNCPROC)
+            dlsym(RTLD_DEFAULT,"glDeleteSync");
+    ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+            dlsym(RTLD_DEFAULT,"glGetProgramBinary");
+    ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+            dlsym(RTLD_DEFAULT,"glProgramBinary");
+    ctxInfo->glGenQueries = (PFNGLGENQUERIESPROC)
+            dlsym(RTLD_DEFAULT,"glGenQueries");
+    ctxInfo->glDeleteQueries = (PFNGLDELETEQUERIESPROC)
+            dlsym(RTLD_DEFAULT,"glDeleteQueries");
+    ctxInfo->glQueryCounter = (PFNGLQUERYCOUNTERPROC)
+            dlsym(RTLD_DEFAULT,"glQueryCounter");
+    ctxInfo->glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)
+            dlsym(RTLD_DEFAULT,"glGetQueryObjectiv");
+    ctxInfo->glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)
+            dlsym(RTLD_DEFAULT,"glGetQueryObjectui64v");
+    ctxInfo->glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)
+            dlsym(RTLD_DEFAULT,"glCompressedTexImage2D");
 
     if (isExtensionSupported(ctxInfo->glxExtensionStr,
             "GLX_SGI_swap_control")) {
@@ -281,6 +309,20 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_X11GLContext_nInitialize
 
     }
 
+    ctxInfo->bufferAgeSupported = isExtensionSupported(
+            ctxInfo->glxExtensionStr, "GLX_EXT_buffer_age") ? JNI_TRUE : JNI_FALSE;
+
+    // A negative interval swaps late frames immediately instead of waiting
+    // for the next vblank. Unlike the SGI call, it applies to a drawable.
+    if (adaptiveVsyncRequested
+            && isExtensionSupported(ctxInfo->glxExtensionStr,
+                    "GLX_EXT_swap_control")
+            && isExtensionSupported(ctxInfo->glxExtensionStr,
+                    "GLX_EXT_swap_control_tear")) {
+        ctxInfo->glXSwapIntervalEXT = (PFNGLXSWAPINTERVALEXTPROC)
+                glXGetProcAddress((const GLubyte *)"glXSwapIntervalEXT");
+    }
+
     // initialize platform states and properties to match
     // cached states and properties
     if (ctxInfo->glXSwapIntervalSGI != NULL) {
@@ -328,6 +370,14 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_X11GLContext_nMakeCurrent
     }
 
     vSyncNeeded = ctxInfo->vSyncRequested && dInfo->onScreen;
+    if (ctxInfo->glXSwapIntervalEXT != NULL) {
+        if (vSyncNeeded && dInfo->win != ctxInfo->swapIntervalWindow) {
+            ctxInfo->glXSwapIntervalEXT(ctxInfo->display, dInfo->win, -1);
+            ctxInfo->swapIntervalWindow = dInfo->win;
+        }
+        ctxInfo->state.vSyncEnabled = vSyncNeeded;
+        return;
+    }
     if (vSyncNeeded == ctxInfo->state.vSyncEnabled) {
         return;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -113,3 +113,21 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_X11GLDrawable_nSwapBuffers
     glXSwapBuffers(dInfo->display, dInfo->win);
     return JNI_TRUE;
 }
+
+/*
+ * Class:     com_sun_prism_es2_X11GLDrawable
+ * Method:    nGetBufferAge
+ * Signature: (JJ)I
+ */
+JNIEXPORT jint JNICALL Java_com_sun_prism_es2_X11GLDrawable_nGetBufferAge
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeDInfo) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    DrawableInfo *dInfo = (DrawableInfo *) jlong_to_ptr(nativeDInfo);
+    unsigned int age = 0;
+    if (ctxInfo == NULL || dInfo == NULL || !dInfo->onScreen
+            || !ctxInfo->bufferAgeSupported) {
+        return 0;
+    }
+    glXQueryDrawable(dInfo->display, dInfo->win, GLX_BACK_BUFFER_AGE_EXT, &age);
+    return (jint) age;
+}
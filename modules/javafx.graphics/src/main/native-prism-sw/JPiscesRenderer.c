@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@
 #include <JTransform.h>
 
 #include <PiscesBlit.h>
+#include <PiscesParallel.h>
 #include <PiscesSysutils.h>
 
 #include <PiscesRenderer.inl>
@@ -50,7 +51,23 @@ static jfieldID fieldIds[RENDERER_LAST + 1];
 static jboolean fieldIdsInitialized = JNI_FALSE;
 static jboolean initializeRendererFieldIds(JNIEnv *env, jobject objectHandle);
 
+/*
+ * Position of the rows of a fill split by renderBands(), rows after the
+ * first one start at x.
+ */
+typedef struct {
+    jint firstX;
+    jint x;
+    jint y;
+    jint rowNum;
+    jint scanlineStride;
+    jint maskOffset;
+    jint maskWidth;
+} FillRows;
+
 static int toPiscesCoords(unsigned int ff);
+static void emitFullRows(Renderer* rdr, const void* arg, jint start, jint end);
+static void emitMaskRows(Renderer* rdr, const void* arg, jint start, jint end);
 static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint maxY,
     JNIEnv *env, jobject this, jint maskType, jbyteArray jmask, jint x, jint y,
     jint maskWidth, jint maskHeight, jint offset, jint stride);
@@ -91,6 +108,18 @@ Java_com_sun_pisces_PiscesRenderer_disposeNative(JNIEnv *env, jclass cls, jlong
     }
 }
 
+JNIEXPORT jint JNICALL
+Java_com_sun_pisces_PiscesRenderer_selectBlittersImpl(JNIEnv *env, jclass cls, jint maxLevel)
+{
+    return selectBlitters(maxLevel);
+}
+
+JNIEXPORT jint JNICALL
+Java_com_sun_pisces_PiscesRenderer_setThreadsImpl(JNIEnv *env, jclass cls, jint threads)
+{
+    return setPiscesThreads(threads);
+}
+
 JNIEXPORT void JNICALL
 Java_com_sun_pisces_PiscesRenderer_setClipImpl(JNIEnv* env, jobject objectHandle,
         jint minX, jint minY, jint width, jint height) {
@@ -377,7 +406,7 @@ fillRect(JNIEnv *env, jobject this, Renderer* rdr,
     jobject surfaceHandle;
     jint x_from, x_to, y_from, y_to;
     jint lfrac, rfrac, tfrac, bfrac;
-    jint rows_to_render_by_loop, rows_being_rendered;
+    jint rows_to_render_by_loop;
 
     lfrac = (0x10000 - (x & 0xFFFF)) & 0xFFFF;
     rfrac = (x + w) & 0xFFFF;
@@ -507,21 +536,22 @@ fillRect(JNIEnv *env, jobject this, Renderer* rdr,
         }
 
         // emit "full" lines that are in the middle
-        while (rows_to_render_by_loop > 0) {
-            rows_being_rendered = MIN(rows_to_render_by_loop, NUM_ALPHA_ROWS);
+        if (rows_to_render_by_loop > 0) {
+            FillRows rows;
+            rows.firstX = x_from;
+            rows.x = x_from;
+            rows.y = rdr->_currY;
+            rows.rowNum = rdr->_rowNum;
+            rows.scanlineStride = surface->width;
+            rows.maskOffset = 0;
+            rows.maskWidth = 0;
+            renderBands(rdr, emitFullRows, &rows, rows_to_render_by_loop,
+                x_to - x_from + 1);
 
-            if (rdr->_genPaint) {
-                size_t l = (x_to - x_from + 1) * rows_being_rendered;
-                ALLOC3(rdr->_paint, jint, l);
-                rdr->_genPaint(rdr, rows_being_rendered);
-            }
-            rdr->_emitLine(rdr, rows_being_rendered, 0x10000);
-
-            rows_to_render_by_loop -= rows_being_rendered;
             rdr->_currX = x_from;
-            rdr->_currY += rows_being_rendered;
+            rdr->_currY = rows.y + rows_to_render_by_loop;
             rdr->_currImageOffset = rdr->_currY * surface->width;
-            rdr->_rowNum += rows_being_rendered;
+            rdr->_rowNum = rows.rowNum + rows_to_render_by_loop;
         }
 
         // emit fractional bottom line
@@ -785,12 +815,75 @@ JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_fillLCDAlphaMaskImpl
         x, y, maskWidth, maskHeight, maskOffset, stride);
 }
 
+/*
+ * Emits the "full" rows [start, end) of a rectangle fill.
+ */
+static void emitFullRows(Renderer* rdr, const void* arg, jint start, jint end)
+{
+    const FillRows* rows = (const FillRows*)arg;
+    jint rows_to_render = end - start;
+    jint rows_being_rendered;
+
+    rdr->_currX = rows->x;
+    rdr->_currY = rows->y + start;
+    rdr->_currImageOffset = rdr->_currY * rows->scanlineStride;
+    rdr->_rowNum = rows->rowNum + start;
+
+    while (rows_to_render > 0) {
+        rows_being_rendered = MIN(rows_to_render, NUM_ALPHA_ROWS);
+
+        if (rdr->_genPaint) {
+            size_t l = rdr->_alphaWidth * rows_being_rendered;
+            ALLOC3(rdr->_paint, jint, l);
+            rdr->_genPaint(rdr, rows_being_rendered);
+        }
+        rdr->_emitLine(rdr, rows_being_rendered, 0x10000);
+
+        rows_to_render -= rows_being_rendered;
+        rdr->_currX = rows->x;
+        rdr->_currY += rows_being_rendered;
+        rdr->_currImageOffset = rdr->_currY * rows->scanlineStride;
+        rdr->_rowNum += rows_being_rendered;
+    }
+}
+
+/*
+ * Emits the rows [start, end) of a mask fill.
+ */
+static void emitMaskRows(Renderer* rdr, const void* arg, jint start, jint end)
+{
+    const FillRows* rows = (const FillRows*)arg;
+    jint rowsToBeRendered = end - start;
+    jint rowsBeingRendered;
+
+    rdr->_currX = (start == 0) ? rows->firstX : rows->x;
+    rdr->_currY = rows->y + start;
+    rdr->_rowNum = start;
+    rdr->_maskOffset = rows->maskOffset + start * rows->maskWidth;
+
+    while (rowsToBeRendered > 0) {
+        rowsBeingRendered = 1; //MIN(rowsToBeRendered, NUM_ALPHA_ROWS);
+
+        rdr->_currImageOffset = rdr->_currY * rows->scanlineStride;
+        if (rdr->_genPaint) {
+            size_t l = (rdr->_alphaWidth * rowsBeingRendered);
+            ALLOC3(rdr->_paint, jint, l);
+            rdr->_genPaint(rdr, rowsBeingRendered);
+        }
+        rdr->_emitRows(rdr, rowsBeingRendered);
+
+        rdr->_maskOffset += rows->maskWidth;
+        rdr->_rowNum += rowsBeingRendered;
+        rowsToBeRendered -= rowsBeingRendered;
+        rdr->_currX = rows->x;
+        rdr->_currY += rowsBeingRendered;
+    }
+}
+
 static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint maxY,
     JNIEnv *env, jobject this, jint maskType, jbyteArray jmask,
     jint x, jint y, jint maskWidth, jint maskHeight, jint offset, jint stride)
 {
-    jint rowsToBeRendered, rowsBeingRendered;
-
     Surface* surface;
     jobject surfaceHandle;
 
@@ -805,6 +898,7 @@ static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint m
         if (mask != NULL) {
             jint width = maxX - minX + 1;
             jint height = maxY - minY + 1;
+            FillRows rows;
 
             renderer_setMask(rdr, maskType, mask, maskWidth, maskHeight, JNI_FALSE);
 
@@ -823,25 +917,14 @@ static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint m
             rdr->_rowNum = 0;
             rdr->_maskOffset = offset;
 
-            rowsToBeRendered = height;
-
-            while (rowsToBeRendered > 0) {
-                rowsBeingRendered = 1; //MIN(rowsToBeRendered, NUM_ALPHA_ROWS);
-
-                rdr->_currImageOffset = rdr->_currY * surface->width;
-                if (rdr->_genPaint) {
-                    size_t l = (width * rowsBeingRendered);
-                    ALLOC3(rdr->_paint, jint, l);
-                    rdr->_genPaint(rdr, rowsBeingRendered);
-                }
-                rdr->_emitRows(rdr, rowsBeingRendered);
-
-                rdr->_maskOffset += maskWidth;
-                rdr->_rowNum += rowsBeingRendered;
-                rowsToBeRendered -= rowsBeingRendered;
-                rdr->_currX = x;
-                rdr->_currY += rowsBeingRendered;
-            }
+            rows.firstX = minX;
+            rows.x = x;
+            rows.y = minY;
+            rows.rowNum = 0;
+            rows.scanlineStride = surface->width;
+            rows.maskOffset = offset;
+            rows.maskWidth = maskWidth;
+            renderBands(rdr, emitMaskRows, &rows, height, width);
 
             renderer_removeMask(rdr);
             (*env)->ReleasePrimitiveArrayCritical(env, jmask, mask, 0);
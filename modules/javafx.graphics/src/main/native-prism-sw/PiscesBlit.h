@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -65,4 +65,37 @@ void emitLinePTSource8888_pre(Renderer *rdr, jint height, jint frac);
 void emitLineSourceOver8888_pre(Renderer *rdr, jint height, jint frac);
 void emitLinePTSourceOver8888_pre(Renderer *rdr, jint height, jint frac);
 
+/*
+ * SIMD variants of the blitters above (PiscesBlitSIMD.c), they fall back
+ * to the scalar ones when no SIMD blitters are selected.
+ */
+
+#define PISCES_BLIT_AUTO   -1
+#define PISCES_BLIT_SCALAR  0
+#define PISCES_BLIT_SSE2    1
+#define PISCES_BLIT_AVX2    2
+#define PISCES_BLIT_NEON    3
+
+/*
+ * Selects the SIMD blitters to use, at most the given level, or the best
+ * supported ones for PISCES_BLIT_AUTO. Returns the selected level.
+ */
+jint selectBlitters(jint maxLevel);
+
+/*
+ * Returns the level of the selected blitters, selecting the best
+ * supported ones if none were selected yet.
+ */
+jint getBlitLevel();
+
+void blitSrc8888_pre_simd(Renderer *rdr, jint height);
+void blitSrcMask8888_pre_simd(Renderer *rdr, jint height);
+void blitSrcOver8888_pre_simd(Renderer *rdr, jint height);
+void blitSrcOverMask8888_pre_simd(Renderer *rdr, jint height);
+void blitPTSrcOver8888_pre_simd(Renderer *rdr, jint height);
+void blitPTSrcOverMask8888_pre_simd(Renderer *rdr, jint height);
+
+void emitLineSourceOver8888_pre_simd(Renderer *rdr, jint height, jint frac);
+void emitLinePTSourceOver8888_pre_simd(Renderer *rdr, jint height, jint frac);
+
 #endif
@@ -0,0 +1,1074 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * SIMD variants of the 8888 pre-multiplied SrcOver and Src blitters.
+ *
+ * The blitters below share the loop structure of the scalar ones in
+ * PiscesBlit.c: the coverage of a row is resolved with scalar code into
+ * a small chunk of per pixel alpha values, which then are blended into
+ * the destination by one of the span routines of the selected instruction
+ * set. All span routines compute exactly the same pixels as the scalar
+ * blend functions.
+ */
+
+#include <string.h>
+
+#include <PiscesBlit.h>
+#include <PiscesRenderer.h>
+#include <PiscesSysutils.h>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define PISCES_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define PISCES_NEON 1
+#include <arm_neon.h>
+#endif
+
+/*
+ * The library is built for the baseline instruction set, the SIMD
+ * variants are compiled for their own targets and only called after the
+ * processor was checked for them.
+ */
+#if defined(PISCES_X86) && (defined(__GNUC__) || defined(__clang__))
+#define PISCES_TARGET(isa) __attribute__((target(isa)))
+#else
+#define PISCES_TARGET(isa)
+#endif
+
+// Number of pixels resolved at a time by the blitters
+#define SPAN_CHUNK 64
+
+typedef struct {
+    jint level;
+    const char *name;
+
+    /*
+     * dst = div255(src * aval + (255 - aval) * dst), src being an opaque
+     * non pre-multiplied color (see blendSrcOver8888_pre).
+     */
+    void (*srcOver)(jint *dst, const jint *avals, jint n, jint src);
+
+    /*
+     * Src of a non pre-multiplied color with alpha calpha at the given
+     * coverages (see blitSrc8888_pre and blendSrc8888_pre).
+     */
+    void (*src)(jint *dst, const jint *covs, jint n, jint calpha, jint src);
+
+    /*
+     * dst = (paint * frac) >> 8 + div255((255 - alpha) * dst), paint being
+     * pre-multiplied (see blendSrcOver8888_pre_pre). When keepTransparent
+     * is set the destination is left untouched where the scaled paint
+     * alpha is 0.
+     */
+    void (*ptSrcOver)(jint *dst, const jint *paint, const jint *fracs, jint n,
+                      jboolean keepTransparent);
+} SpanBlitters;
+
+#ifdef PISCES_X86
+
+/*
+ * SSE2 spans, 4 pixels at a time. Each pixel is widened to 4 16-bit
+ * lanes, where every product fits, and div255 is done as
+ * ((x + 1) * 257) >> 16 with an unsigned high multiply.
+ */
+
+PISCES_TARGET("sse2")
+static INLINE __m128i div255SSE2(__m128i x) {
+    return _mm_mulhi_epu16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_set1_epi16(257));
+}
+
+// Spreads 4 32-bit values over the 16-bit lanes of pixels 0, 1 and 2, 3
+PISCES_TARGET("sse2")
+static INLINE void spreadSSE2(__m128i v, __m128i *lo, __m128i *hi) {
+    __m128i p = _mm_packs_epi32(v, v);
+    p = _mm_unpacklo_epi16(p, p);
+    *lo = _mm_unpacklo_epi32(p, p);
+    *hi = _mm_unpackhi_epi32(p, p);
+}
+
+// Copies the alpha lane of each widened pixel to its other lanes
+PISCES_TARGET("sse2")
+static INLINE __m128i alphaLanesSSE2(__m128i v) {
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xFF), 0xFF);
+}
+
+PISCES_TARGET("sse2")
+static INLINE __m128i selectSSE2(__m128i mask, __m128i a, __m128i b) {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+PISCES_TARGET("sse2")
+static INLINE __m128i srcOver4SSE2(__m128i d, __m128i av, __m128i s16) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i m255 = _mm_set1_epi16(255);
+    __m128i alo, ahi;
+    spreadSSE2(av, &alo, &ahi);
+    __m128i dlo = _mm_unpacklo_epi8(d, zero);
+    __m128i dhi = _mm_unpackhi_epi8(d, zero);
+    __m128i xlo = _mm_add_epi16(_mm_mullo_epi16(s16, alo),
+                                _mm_mullo_epi16(_mm_sub_epi16(m255, alo), dlo));
+    __m128i xhi = _mm_add_epi16(_mm_mullo_epi16(s16, ahi),
+                                _mm_mullo_epi16(_mm_sub_epi16(m255, ahi), dhi));
+    return _mm_packus_epi16(div255SSE2(xlo), div255SSE2(xhi));
+}
+
+PISCES_TARGET("sse2")
+static void srcOverSSE2(jint *dst, const jint *avals, jint n, jint src) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i s16 = _mm_unpacklo_epi8(_mm_set1_epi32(src), zero);
+    __m128i d, av;
+    jint i = 0;
+    for (; i + 4 <= n; i += 4) {
+        av = _mm_loadu_si128((const __m128i *) (avals + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(av, zero)) == 0xFFFF) {
+            continue;
+        }
+        d = _mm_loadu_si128((const __m128i *) (dst + i));
+        _mm_storeu_si128((__m128i *) (dst + i), srcOver4SSE2(d, av, s16));
+    }
+    if (i < n) {
+        jint tdst[4] = { 0, 0, 0, 0 };
+        jint tav[4] = { 0, 0, 0, 0 };
+        memcpy(tdst, dst + i, (n - i) * sizeof(jint));
+        memcpy(tav, avals + i, (n - i) * sizeof(jint));
+        d = _mm_loadu_si128((const __m128i *) tdst);
+        av = _mm_loadu_si128((const __m128i *) tav);
+        _mm_storeu_si128((__m128i *) tdst, srcOver4SSE2(d, av, s16));
+        memcpy(dst + i, tdst, (n - i) * sizeof(jint));
+    }
+}
+
+PISCES_TARGET("sse2")
+static INLINE __m128i src4SSE2(__m128i d, __m128i cov, __m128i ca16,
+                               __m128i s16, __m128i solid) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i one = _mm_set1_epi16(1);
+    __m128i m255 = _mm_set1_epi16(255);
+    __m128i clo, chi;
+    spreadSSE2(cov, &clo, &chi);
+    // aval = ((cov + 1) * calpha) >> 8, raaval = 255 - cov
+    __m128i alo = _mm_srli_epi16(_mm_mullo_epi16(_mm_add_epi16(clo, one), ca16), 8);
+    __m128i ahi = _mm_srli_epi16(_mm_mullo_epi16(_mm_add_epi16(chi, one), ca16), 8);
+    __m128i dlo = _mm_unpacklo_epi8(d, zero);
+    __m128i dhi = _mm_unpackhi_epi8(d, zero);
+    __m128i xlo = _mm_add_epi16(_mm_mullo_epi16(alo, s16),
+                                _mm_mullo_epi16(_mm_sub_epi16(m255, clo), dlo));
+    __m128i xhi = _mm_add_epi16(_mm_mullo_epi16(ahi, s16),
+                                _mm_mullo_epi16(_mm_sub_epi16(m255, chi), dhi));
+    // a zero alpha denominator gives transparent black
+    __m128i olo = _mm_andnot_si128(alphaLanesSSE2(_mm_cmpeq_epi16(xlo, zero)), div255SSE2(xlo));
+    __m128i ohi = _mm_andnot_si128(alphaLanesSSE2(_mm_cmpeq_epi16(xhi, zero)), div255SSE2(xhi));
+    __m128i o = _mm_packus_epi16(olo, ohi);
+    o = selectSSE2(_mm_cmpeq_epi32(cov, _mm_set1_epi32(MAX_ALPHA)), solid, o);
+    return selectSSE2(_mm_cmpeq_epi32(cov, zero), d, o);
+}
+
+PISCES_TARGET("sse2")
+static void srcSSE2(jint *dst, const jint *covs, jint n, jint calpha, jint src) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i s16 = _mm_unpacklo_epi8(_mm_set1_epi32(0xFF000000 | src), zero);
+    __m128i ca16 = _mm_set1_epi16((short) calpha);
+    __m128i solid = _mm_set1_epi32((calpha << 24) | (src & 0xFFFFFF));
+    __m128i d, cov;
+    jint i = 0;
+    for (; i + 4 <= n; i += 4) {
+        cov = _mm_loadu_si128((const __m128i *) (covs + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(cov, zero)) == 0xFFFF) {
+            continue;
+        }
+        d = _mm_loadu_si128((const __m128i *) (dst + i));
+        _mm_storeu_si128((__m128i *) (dst + i), src4SSE2(d, cov, ca16, s16, solid));
+    }
+    if (i < n) {
+        jint tdst[4] = { 0, 0, 0, 0 };
+        jint tcov[4] = { 0, 0, 0, 0 };
+        memcpy(tdst, dst + i, (n - i) * sizeof(jint));
+        memcpy(tcov, covs + i, (n - i) * sizeof(jint));
+        d = _mm_loadu_si128((const __m128i *) tdst);
+        cov = _mm_loadu_si128((const __m128i *) tcov);
+        _mm_storeu_si128((__m128i *) tdst, src4SSE2(d, cov, ca16, s16, solid));
+        memcpy(dst + i, tdst, (n - i) * sizeof(jint));
+    }
+}
+
+PISCES_TARGET("sse2")
+static INLINE __m128i ptSrcOver4SSE2(__m128i d, __m128i p, __m128i f,
+                                     jboolean keepTransparent) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i m255 = _mm_set1_epi16(255);
+    __m128i flo, fhi;
+    spreadSSE2(f, &flo, &fhi);
+    // the paint scaled by frac, and the remaining destination weight
+    __m128i tlo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(p, zero), flo), 8);
+    __m128i thi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(p, zero), fhi), 8);
+    __m128i xlo = _mm_mullo_epi16(_mm_sub_epi16(m255, alphaLanesSSE2(tlo)),
+                                  _mm_unpacklo_epi8(d, zero));
+    __m128i xhi = _mm_mullo_epi16(_mm_sub_epi16(m255, alphaLanesSSE2(thi)),
+                                  _mm_unpackhi_epi8(d, zero));
+    __m128i o = _mm_packus_epi16(_mm_add_epi16(tlo, div255SSE2(xlo)),
+                                 _mm_add_epi16(thi, div255SSE2(xhi)));
+    if (keepTransparent) {
+        __m128i t = _mm_packus_epi16(tlo, thi);
+        o = selectSSE2(_mm_cmpeq_epi32(_mm_srli_epi32(t, 24), zero), d, o);
+    }
+    return o;
+}
+
+PISCES_TARGET("sse2")
+static void ptSrcOverSSE2(jint *dst, const jint *paint, const jint *fracs, jint n,
+                          jboolean keepTransparent) {
+    __m128i d, p, f;
+    jint i = 0;
+    for (; i + 4 <= n; i += 4) {
+        d = _mm_loadu_si128((const __m128i *) (dst + i));
+        p = _mm_loadu_si128((const __m128i *) (paint + i));
+        f = _mm_loadu_si128((const __m128i *) (fracs + i));
+        _mm_storeu_si128((__m128i *) (dst + i), ptSrcOver4SSE2(d, p, f, keepTransparent));
+    }
+    if (i < n) {
+        jint tdst[4] = { 0, 0, 0, 0 };
+        jint tpaint[4] = { 0, 0, 0, 0 };
+        jint tfrac[4] = { 0, 0, 0, 0 };
+        memcpy(tdst, dst + i, (n - i) * sizeof(jint));
+        memcpy(tpaint, paint + i, (n - i) * sizeof(jint));
+        memcpy(tfrac, fracs + i, (n - i) * sizeof(jint));
+        d = _mm_loadu_si128((const __m128i *) tdst);
+        p = _mm_loadu_si128((const __m128i *) tpaint);
+        f = _mm_loadu_si128((const __m128i *) tfrac);
+        _mm_storeu_si128((__m128i *) tdst, ptSrcOver4SSE2(d, p, f, keepTransparent));
+        memcpy(dst + i, tdst, (n - i) * sizeof(jint));
+    }
+}
+
+static const SpanBlitters sse2Blitters = {
+    PISCES_BLIT_SSE2, "sse2",
+    srcOverSSE2,
+    srcSSE2,
+    ptSrcOverSSE2,
+};
+
+/*
+ * AVX2 spans, 8 pixels at a time. The 8-bit unpack and pack work on
+ * each 128-bit half, so pixels 0, 1, 4, 5 end up in the low and 2, 3,
+ * 6, 7 in the high widened registers, which spreadAVX2 matches. The
+ * leftover pixels are done by the SSE2 spans.
+ */
+
+PISCES_TARGET("avx2")
+static INLINE __m256i div255AVX2(__m256i x) {
+    return _mm256_mulhi_epu16(_mm256_add_epi16(x, _mm256_set1_epi16(1)), _mm256_set1_epi16(257));
+}
+
+PISCES_TARGET("avx2")
+static INLINE void spreadAVX2(__m256i v, __m256i *lo, __m256i *hi) {
+    __m256i p = _mm256_packs_epi32(v, v);
+    p = _mm256_unpacklo_epi16(p, p);
+    *lo = _mm256_unpacklo_epi32(p, p);
+    *hi = _mm256_unpackhi_epi32(p, p);
+}
+
+PISCES_TARGET("avx2")
+static INLINE __m256i alphaLanesAVX2(__m256i v) {
+    return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(v, 0xFF), 0xFF);
+}
+
+PISCES_TARGET("avx2")
+static INLINE __m256i selectAVX2(__m256i mask, __m256i a, __m256i b) {
+    return _mm256_blendv_epi8(b, a, mask);
+}
+
+PISCES_TARGET("avx2")
+static void srcOverAVX2(jint *dst, const jint *avals, jint n, jint src) {
+    __m256i zero = _mm256_setzero_si256();
+    __m256i m255 = _mm256_set1_epi16(255);
+    __m256i s16 = _mm256_unpacklo_epi8(_mm256_set1_epi32(src), zero);
+    jint i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i av = _mm256_loadu_si256((const __m256i *) (avals + i));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(av, zero)) == -1) {
+            continue;
+        }
+        __m256i d = _mm256_loadu_si256((const __m256i *) (dst + i));
+        __m256i alo, ahi;
+        spreadAVX2(av, &alo, &ahi);
+        __m256i dlo = _mm256_unpacklo_epi8(d, zero);
+        __m256i dhi = _mm256_unpackhi_epi8(d, zero);
+        __m256i xlo = _mm256_add_epi16(_mm256_mullo_epi16(s16, alo),
+                                       _mm256_mullo_epi16(_mm256_sub_epi16(m255, alo), dlo));
+        __m256i xhi = _mm256_add_epi16(_mm256_mullo_epi16(s16, ahi),
+                                       _mm256_mullo_epi16(_mm256_sub_epi16(m255, ahi), dhi));
+        _mm256_storeu_si256((__m256i *) (dst + i),
+                            _mm256_packus_epi16(div255AVX2(xlo), div255AVX2(xhi)));
+    }
+    if (i < n) {
+        srcOverSSE2(dst + i, avals + i, n - i, src);
+    }
+}
+
+PISCES_TARGET("avx2")
+static void srcAVX2(jint *dst, const jint *covs, jint n, jint calpha, jint src) {
+    __m256i zero = _mm256_setzero_si256();
+    __m256i one = _mm256_set1_epi16(1);
+    __m256i m255 = _mm256_set1_epi16(255);
+    __m256i s16 = _mm256_unpacklo_epi8(_mm256_set1_epi32(0xFF000000 | src), zero);
+    __m256i ca16 = _mm256_set1_epi16((short) calpha);
+    __m256i solid = _mm256_set1_epi32((calpha << 24) | (src & 0xFFFFFF));
+    __m256i full = _mm256_set1_epi32(MAX_ALPHA);
+    jint i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i cov = _mm256_loadu_si256((const __m256i *) (covs + i));
+        __m256i none = _mm256_cmpeq_epi32(cov, zero);
+        if (_mm256_movemask_epi8(none) == -1) {
+            continue;
+        }
+        __m256i d = _mm256_loadu_si256((const __m256i *) (dst + i));
+        __m256i clo, chi;
+        spreadAVX2(cov, &clo, &chi);
+        __m256i alo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_add_epi16(clo, one), ca16), 8);
+        __m256i ahi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_add_epi16(chi, one), ca16), 8);
+        __m256i dlo = _mm256_unpacklo_epi8(d, zero);
+        __m256i dhi = _mm256_unpackhi_epi8(d, zero);
+        __m256i xlo = _mm256_add_epi16(_mm256_mullo_epi16(alo, s16),
+                                       _mm256_mullo_epi16(_mm256_sub_epi16(m255, clo), dlo));
+        __m256i xhi = _mm256_add_epi16(_mm256_mullo_epi16(ahi, s16),
+                                       _mm256_mullo_epi16(_mm256_sub_epi16(m255, chi), dhi));
+        __m256i olo = _mm256_andnot_si256(alphaLanesAVX2(_mm256_cmpeq_epi16(xlo, zero)), div255AVX2(xlo));
+        __m256i ohi = _mm256_andnot_si256(alphaLanesAVX2(_mm256_cmpeq_epi16(xhi, zero)), div255AVX2(xhi));
+        __m256i o = _mm256_packus_epi16(olo, ohi);
+        o = selectAVX2(_mm256_cmpeq_epi32(cov, full), solid, o);
+        _mm256_storeu_si256((__m256i *) (dst + i), selectAVX2(none, d, o));
+    }
+    if (i < n) {
+        srcSSE2(dst + i, covs + i, n - i, calpha, src);
+    }
+}
+
+PISCES_TARGET("avx2")
+static void ptSrcOverAVX2(jint *dst, const jint *paint, const jint *fracs, jint n,
+                          jboolean keepTransparent) {
+    __m256i zero = _mm256_setzero_si256();
+    __m256i m255 = _mm256_set1_epi16(255);
+    jint i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i d = _mm256_loadu_si256((const __m256i *) (dst + i));
+        __m256i p = _mm256_loadu_si256((const __m256i *) (paint + i));
+        __m256i f = _mm256_loadu_si256((const __m256i *) (fracs + i));
+        __m256i flo, fhi;
+        spreadAVX2(f, &flo, &fhi);
+        __m256i tlo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(p, zero), flo), 8);
+        __m256i thi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(p, zero), fhi), 8);
+        __m256i xlo = _mm256_mullo_epi16(_mm256_sub_epi16(m255, alphaLanesAVX2(tlo)),
+                                         _mm256_unpacklo_epi8(d, zero));
+        __m256i xhi = _mm256_mullo_epi16(_mm256_sub_epi16(m255, alphaLanesAVX2(thi)),
+                                         _mm256_unpackhi_epi8(d, zero));
+        __m256i o = _mm256_packus_epi16(_mm256_add_epi16(tlo, div255AVX2(xlo)),
+                                        _mm256_add_epi16(thi, div255AVX2(xhi)));
+        if (keepTransparent) {
+            __m256i t = _mm256_packus_epi16(tlo, thi);
+            o = selectAVX2(_mm256_cmpeq_epi32(_mm256_srli_epi32(t, 24), zero), d, o);
+        }
+        _mm256_storeu_si256((__m256i *) (dst + i), o);
+    }
+    if (i < n) {
+        ptSrcOverSSE2(dst + i, paint + i, fracs + i, n - i, keepTransparent);
+    }
+}
+
+static const SpanBlitters avx2Blitters = {
+    PISCES_BLIT_AVX2, "avx2",
+    srcOverAVX2,
+    srcAVX2,
+    ptSrcOverAVX2,
+};
+
+static jboolean cpuSupports(jint level) {
+#if defined(_MSC_VER)
+    int info[4];
+    int maxLeaf;
+    __cpuid(info, 0);
+    maxLeaf = info[0];
+    __cpuid(info, 1);
+    if ((info[3] & (1 << 26)) == 0) {
+        return JNI_FALSE;
+    }
+    if (level == PISCES_BLIT_SSE2) {
+        return JNI_TRUE;
+    }
+    // AVX2 also needs the OS to save the YMM registers.
+    if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 ||
+        maxLeaf < 7 || (_xgetbv(0) & 6) != 6)
+    {
+        return JNI_FALSE;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) ? JNI_TRUE : JNI_FALSE;
+#else
+    __builtin_cpu_init();
+    if (level == PISCES_BLIT_SSE2) {
+        return __builtin_cpu_supports("sse2") ? JNI_TRUE : JNI_FALSE;
+    }
+    return __builtin_cpu_supports("avx2") ? JNI_TRUE : JNI_FALSE;
+#endif
+}
+
+#endif /* PISCES_X86 */
+
+#ifdef PISCES_NEON
+
+/*
+ * NEON spans, laid out like the SSE2 ones: 4 pixels at a time, widened
+ * to 16-bit lanes 2 pixels per register. div255 is done as
+ * (y + (y >> 8)) >> 8 with y = x + 1, which is the same value.
+ */
+
+static INLINE uint16x8_t div255NEON(uint16x8_t x) {
+    uint16x8_t y = vaddq_u16(x, vdupq_n_u16(1));
+    return vshrq_n_u16(vaddq_u16(y, vshrq_n_u16(y, 8)), 8);
+}
+
+static INLINE uint16x8_t spreadNEON(const jint *v) {
+    return vcombine_u16(vdup_n_u16((uint16_t) v[0]), vdup_n_u16((uint16_t) v[1]));
+}
+
+static INLINE uint16x8_t alphaLanesNEON(uint16x8_t v) {
+    return vcombine_u16(vdup_lane_u16(vget_low_u16(v), 3), vdup_lane_u16(vget_high_u16(v), 3));
+}
+
+static INLINE uint8x16_t packNEON(uint16x8_t lo, uint16x8_t hi) {
+    return vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi));
+}
+
+static INLINE uint32x4_t srcOver4NEON(uint32x4_t d, const jint *av, uint16x8_t s16) {
+    uint16x8_t m255 = vdupq_n_u16(255);
+    uint8x16_t d8 = vreinterpretq_u8_u32(d);
+    uint16x8_t alo = spreadNEON(av);
+    uint16x8_t ahi = spreadNEON(av + 2);
+    uint16x8_t xlo = vmlaq_u16(vmulq_u16(s16, alo), vsubq_u16(m255, alo), vmovl_u8(vget_low_u8(d8)));
+    uint16x8_t xhi = vmlaq_u16(vmulq_u16(s16, ahi), vsubq_u16(m255, ahi), vmovl_u8(vget_high_u8(d8)));
+    return vreinterpretq_u32_u8(packNEON(div255NEON(xlo), div255NEON(xhi)));
+}
+
+static void srcOverNEON(jint *dst, const jint *avals, jint n, jint src) {
+    uint16x8_t s16 = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32((uint32_t) src)));
+    jint i = 0;
+    for (; i + 4 <= n; i += 4) {
+        if ((avals[i] | avals[i + 1] | avals[i + 2] | avals[i + 3]) == 0) {
+            continue;
+        }
+        uint32x4_t d = vld1q_u32((const uint32_t *) (dst + i));
+        vst1q_u32((uint32_t *) (dst + i), srcOver4NEON(d, avals + i, s16));
+    }
+    if (i < n) {
+        jint tdst[4] = { 0, 0, 0, 0 };
+        jint tav[4] = { 0, 0, 0, 0 };
+        memcpy(tdst, dst + i, (n - i) * sizeof(jint));
+        memcpy(tav, avals + i, (n - i) * sizeof(jint));
+        vst1q_u32((uint32_t *) tdst, srcOver4NEON(vld1q_u32((const uint32_t *) tdst), tav, s16));
+        memcpy(dst + i, tdst, (n - i) * sizeof(jint));
+    }
+}
+
+static INLINE uint32x4_t src4NEON(uint32x4_t d, const jint *cov, uint16x8_t ca16,
+                                  uint16x8_t s16, uint32x4_t solid) {
+    uint16x8_t one = vdupq_n_u16(1);
+    uint16x8_t m255 = vdupq_n_u16(255);
+    uint8x16_t d8 = vreinterpretq_u8_u32(d);
+    uint16x8_t clo = spreadNEON(cov);
+    uint16x8_t chi = spreadNEON(cov + 2);
+    // aval = ((cov + 1) * calpha) >> 8, raaval = 255 - cov
+    uint16x8_t alo = vshrq_n_u16(vmulq_u16(vaddq_u16(clo, one), ca16), 8);
+    uint16x8_t ahi = vshrq_n_u16(vmulq_u16(vaddq_u16(chi, one), ca16), 8);
+    uint16x8_t xlo = vmlaq_u16(vmulq_u16(alo, s16), vsubq_u16(m255, clo), vmovl_u8(vget_low_u8(d8)));
+    uint16x8_t xhi = vmlaq_u16(vmulq_u16(ahi, s16), vsubq_u16(m255, chi), vmovl_u8(vget_high_u8(d8)));
+    // a zero alpha denominator gives transparent black
+    uint16x8_t olo = vbicq_u16(div255NEON(xlo), alphaLanesNEON(vceqq_u16(xlo, vdupq_n_u16(0))));
+    uint16x8_t ohi = vbicq_u16(div255NEON(xhi), alphaLanesNEON(vceqq_u16(xhi, vdupq_n_u16(0))));
+    uint32x4_t o = vreinterpretq_u32_u8(packNEON(olo, ohi));
+    uint32x4_t c = vld1q_u32((const uint32_t *) cov);
+    o = vbslq_u32(vceqq_u32(c, vdupq_n_u32(MAX_ALPHA)), solid, o);
+    return vbslq_u32(vceqq_u32(c, vdupq_n_u32(0)), d, o);
+}
+
+static void srcNEON(jint *dst, const jint *covs, jint n, jint calpha, jint src) {
+    uint16x8_t s16 = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32((uint32_t) (0xFF000000 | src))));
+    uint16x8_t ca16 = vdupq_n_u16((uint16_t) calpha);
+    uint32x4_t solid = vdupq_n_u32((uint32_t) ((calpha << 24) | (src & 0xFFFFFF)));
+    jint i = 0;
+    for (; i + 4 <= n; i += 4) {
+        if ((covs[i] | covs[i + 1] | covs[i + 2] | covs[i + 3]) == 0) {
+            continue;
+        }
+        uint32x4_t d = vld1q_u32((const uint32_t *) (dst + i));
+        vst1q_u32((uint32_t *) (dst + i), src4NEON(d, covs + i, ca16, s16, solid));
+    }
+    if (i < n) {
+        jint tdst[4] = { 0, 0, 0, 0 };
+        jint tcov[4] = { 0, 0, 0, 0 };
+        memcpy(tdst, dst + i, (n - i) * sizeof(jint));
+        memcpy(tcov, covs + i, (n - i) * sizeof(jint));
+        vst1q_u32((uint32_t *) tdst, src4NEON(vld1q_u32((const uint32_t *) tdst), tcov, ca16, s16, solid));
+        memcpy(dst + i, tdst, (n - i) * sizeof(jint));
+    }
+}
+
+static INLINE uint32x4_t ptSrcOver4NEON(uint32x4_t d, uint32x4_t p, const jint *f,
+                                        jboolean keepTransparent) {
+    uint16x8_t m255 = vdupq_n_u16(255);
+    uint8x16_t d8 = vreinterpretq_u8_u32(d);
+    uint8x16_t p8 = vreinterpretq_u8_u32(p);
+    // the paint scaled by frac, and the remaining destination weight
+    uint16x8_t tlo = vshrq_n_u16(vmulq_u16(vmovl_u8(vget_low_u8(p8)), spreadNEON(f)), 8);
+    uint16x8_t thi = vshrq_n_u16(vmulq_u16(vmovl_u8(vget_high_u8(p8)), spreadNEON(f + 2)), 8);
+    uint16x8_t xlo = vmulq_u16(vsubq_u16(m255, alphaLanesNEON(tlo)), vmovl_u8(vget_low_u8(d8)));
+    uint16x8_t xhi = vmulq_u16(vsubq_u16(m255, alphaLanesNEON(thi)), vmovl_u8(vget_high_u8(d8)));
+    uint32x4_t o = vreinterpretq_u32_u8(packNEON(vaddq_u16(tlo, div255NEON(xlo)),
+                                                 vaddq_u16(thi, div255NEON(xhi))));
+    if (keepTransparent) {
+        uint32x4_t t = vreinterpretq_u32_u8(packNEON(tlo, thi));
+        o = vbslq_u32(vceqq_u32(vshrq_n_u32(t, 24), vdupq_n_u32(0)), d, o);
+    }
+    return o;
+}
+
+static void ptSrcOverNEON(jint *dst, const jint *paint, const jint *fracs, jint n,
+                          jboolean keepTransparent) {
+    jint i = 0;
+    for (; i + 4 <= n; i += 4) {
+        uint32x4_t d = vld1q_u32((const uint32_t *) (dst + i));
+        uint32x4_t p = vld1q_u32((const uint32_t *) (paint + i));
+        vst1q_u32((uint32_t *) (dst + i), ptSrcOver4NEON(d, p, fracs + i, keepTransparent));
+    }
+    if (i < n) {
+        jint tdst[4] = { 0, 0, 0, 0 };
+        jint tpaint[4] = { 0, 0, 0, 0 };
+        jint tfrac[4] = { 0, 0, 0, 0 };
+        memcpy(tdst, dst + i, (n - i) * sizeof(jint));
+        memcpy(tpaint, paint + i, (n - i) * sizeof(jint));
+        memcpy(tfrac, fracs + i, (n - i) * sizeof(jint));
+        vst1q_u32((uint32_t *) tdst,
+                  ptSrcOver4NEON(vld1q_u32((const uint32_t *) tdst),
+                                 vld1q_u32((const uint32_t *) tpaint), tfrac, keepTransparent));
+        memcpy(dst + i, tdst, (n - i) * sizeof(jint));
+    }
+}
+
+static const SpanBlitters neonBlitters = {
+    PISCES_BLIT_NEON, "neon",
+    srcOverNEON,
+    srcNEON,
+    ptSrcOverNEON,
+};
+
+#endif /* PISCES_NEON */
+
+static const SpanBlitters *selectedBlitters = NULL;
+static jboolean blittersSelected = XNI_FALSE;
+
+static const SpanBlitters *
+getBlitters(jint level) {
+    switch (level) {
+#ifdef PISCES_X86
+    case PISCES_BLIT_SSE2:
+        return cpuSupports(level) ? &sse2Blitters : NULL;
+    case PISCES_BLIT_AVX2:
+        return cpuSupports(level) ? &avx2Blitters : NULL;
+#endif
+#ifdef PISCES_NEON
+    case PISCES_BLIT_NEON:
+        // NEON is part of the target of NEON builds
+        return &neonBlitters;
+#endif
+    default:
+        return NULL;
+    }
+}
+
+jint
+selectBlitters(jint maxLevel) {
+    const SpanBlitters *blitters = NULL;
+    jint level;
+    if (maxLevel < 0 || maxLevel > PISCES_BLIT_NEON) {
+        maxLevel = PISCES_BLIT_NEON;
+    }
+    for (level = maxLevel; blitters == NULL && level > PISCES_BLIT_SCALAR; level--) {
+        blitters = getBlitters(level);
+    }
+    selectedBlitters = blitters;
+    blittersSelected = XNI_TRUE;
+    return (blitters != NULL) ? blitters->level : PISCES_BLIT_SCALAR;
+}
+
+jint
+getBlitLevel() {
+    if (!blittersSelected) {
+        selectBlitters(PISCES_BLIT_AUTO);
+    }
+    return (selectedBlitters != NULL) ? selectedBlitters->level : PISCES_BLIT_SCALAR;
+}
+
+/* BLITTERS */
+
+void
+blitSrcOver8888_pre_simd(Renderer *rdr, jint height) {
+    jint j, x, k, n, any;
+    jint minX, maxX, w;
+    jint aval_relative;
+    jint avals[SPAN_CHUNK];
+
+    const SpanBlitters *spans = selectedBlitters;
+    jint *intData = rdr->_data;
+    jint imageOffset = rdr->_currImageOffset;
+    jint imageScanlineStride = rdr->_imageScanlineStride;
+    jint *alpha = rdr->_rowAAInt;
+
+    jint *a, *d;
+
+    jint calpha = rdr->_calpha;
+    jint src = 0xFF000000 | (rdr->_cred << 16) | (rdr->_cgreen << 8) | rdr->_cblue;
+    jbyte *alphaMap = rdr->alphaMap;
+
+    if (spans == NULL || rdr->_imagePixelStride != 1) {
+        blitSrcOver8888_pre(rdr, height);
+        return;
+    }
+
+    minX = rdr->_minTouched;
+    maxX = rdr->_maxTouched;
+    w = (maxX >= minX) ? (maxX - minX + 1) : 0;
+
+    for (j = 0; j < height; j++) {
+        d = intData + imageOffset + minX;
+
+        aval_relative = 0;
+        a = alpha;
+        for (x = 0; x < w; x += n) {
+            n = (w - x < SPAN_CHUNK) ? (w - x) : SPAN_CHUNK;
+            any = 0;
+            for (k = 0; k < n; k++) {
+                aval_relative += a[k];
+                a[k] = 0;
+                avals[k] = aval_relative
+                    ? (((alphaMap[aval_relative] & 0xff) + 1) * calpha) >> 8
+                    : 0;
+                any |= avals[k];
+            }
+            if (any) {
+                spans->srcOver(d + x, avals, n, src);
+            }
+            a += n;
+        }
+
+        imageOffset += imageScanlineStride;
+    }
+}
+
+void
+blitSrcOverMask8888_pre_simd(Renderer *rdr, jint height) {
+    jint j, x, k, n, any;
+    jint minX, maxX, w;
+    jint avals[SPAN_CHUNK];
+
+    const SpanBlitters *spans = selectedBlitters;
+    jint *intData = rdr->_data;
+    jint imageOffset = rdr->_currImageOffset;
+    jint imageScanlineStride = rdr->_imageScanlineStride;
+    jbyte *alpha = rdr->_mask_byteData;
+    jint alphaOffset = rdr->_maskOffset;
+    jint alphaStride = rdr->_alphaWidth;
+
+    jbyte *a;
+    jint *d;
+
+    jint calpha = rdr->_calpha;
+    jint src = 0xFF000000 | (rdr->_cred << 16) | (rdr->_cgreen << 8) | rdr->_cblue;
+
+    if (spans == NULL || rdr->_imagePixelStride != 1) {
+        blitSrcOverMask8888_pre(rdr, height);
+        return;
+    }
+
+    minX = rdr->_minTouched;
+    maxX = rdr->_maxTouched;
+    w = (maxX >= minX) ? (maxX - minX + 1) : 0;
+
+    for (j = 0; j < height; j++) {
+        d = intData + imageOffset + minX;
+
+        a = alpha + alphaOffset;
+        for (x = 0; x < w; x += n) {
+            n = (w - x < SPAN_CHUNK) ? (w - x) : SPAN_CHUNK;
+            any = 0;
+            for (k = 0; k < n; k++) {
+                avals[k] = a[k] ? (((a[k] & 0xff) + 1) * calpha) >> 8 : 0;
+                any |= avals[k];
+            }
+            if (any) {
+                spans->srcOver(d + x, avals, n, src);
+            }
+            a += n;
+        }
+
+        imageOffset += imageScanlineStride;
+        alphaOffset += alphaStride;
+    }
+}
+
+void
+blitSrc8888_pre_simd(Renderer *rdr, jint height) {
+    jint j, x, k, n, any;
+    jint minX, maxX, w;
+    jint aval_relative;
+    jint covs[SPAN_CHUNK];
+
+    const SpanBlitters *spans = selectedBlitters;
+    jint *intData = rdr->_data;
+    jint imageOffset = rdr->_currImageOffset;
+    jint imageScanlineStride = rdr->_imageScanlineStride;
+    jint *alpha = rdr->_rowAAInt;
+
+    jint *a, *d;
+
+    jint calpha = rdr->_calpha;
+    jint src = (rdr->_cred << 16) | (rdr->_cgreen << 8) | rdr->_cblue;
+    jbyte *alphaMap = rdr->alphaMap;
+
+    if (spans == NULL || rdr->_imagePixelStride != 1) {
+        blitSrc8888_pre(rdr, height);
+        return;
+    }
+
+    minX = rdr->_minTouched;
+    maxX = rdr->_maxTouched;
+    w = (maxX >= minX) ? (maxX - minX + 1) : 0;
+
+    for (j = 0; j < height; j++) {
+        d = intData + imageOffset + minX;
+
+        aval_relative = 0;
+        a = alpha;
+        for (x = 0; x < w; x += n) {
+            n = (w - x < SPAN_CHUNK) ? (w - x) : SPAN_CHUNK;
+            any = 0;
+            for (k = 0; k < n; k++) {
+                aval_relative += a[k];
+                a[k] = 0;
+                covs[k] = alphaMap[aval_relative] & 0xff;
+                any |= covs[k];
+            }
+            if (any) {
+                spans->src(d + x, covs, n, calpha, src);
+            }
+            a += n;
+        }
+
+        imageOffset += imageScanlineStride;
+    }
+}
+
+void
+blitSrcMask8888_pre_simd(Renderer *rdr, jint height) {
+    jint j, x, k, n, any;
+    jint minX, maxX, w;
+    jint covs[SPAN_CHUNK];
+
+    const SpanBlitters *spans = selectedBlitters;
+    jint *intData = rdr->_data;
+    jint imageOffset = rdr->_currImageOffset;
+    jint imageScanlineStride = rdr->_imageScanlineStride;
+    jbyte *alpha = rdr->_mask_byteData;
+    jint alphaOffset = rdr->_maskOffset;
+    jint alphaStride = rdr->_alphaWidth;
+
+    jbyte *a;
+    jint *d;
+
+    jint calpha = rdr->_calpha;
+    jint src = (rdr->_cred << 16) | (rdr->_cgreen << 8) | rdr->_cblue;
+
+    if (spans == NULL || rdr->_imagePixelStride != 1) {
+        blitSrcMask8888_pre(rdr, height);
+        return;
+    }
+
+    minX = rdr->_minTouched;
+    maxX = rdr->_maxTouched;
+    w = (maxX >= minX) ? (maxX - minX + 1) : 0;
+
+    for (j = 0; j < height; j++) {
+        d = intData + imageOffset + minX;
+
+        a = alpha + alphaOffset;
+        for (x = 0; x < w; x += n) {
+            n = (w - x < SPAN_CHUNK) ? (w - x) : SPAN_CHUNK;
+            any = 0;
+            for (k = 0; k < n; k++) {
+                covs[k] = a[k] & 0xff;
+                any |= covs[k];
+            }
+            if (any) {
+                spans->src(d + x, covs, n, calpha, src);
+            }
+            a += n;
+        }
+
+        imageOffset += imageScanlineStride;
+        alphaOffset += alphaStride;
+    }
+}
+
+void
+blitPTSrcOver8888_pre_simd(Renderer *rdr, jint height) {
+    jint j, x, k, n, any;
+    jint minX, maxX, w;
+    jint aval_relative;
+    jint fracs[SPAN_CHUNK];
+
+    const SpanBlitters *spans = selectedBlitters;
+    jint *intData = rdr->_data;
+    jint imageOffset = rdr->_currImageOffset;
+    jint imageScanlineStride = rdr->_imageScanlineStride;
+    jint *alpha = rdr->_rowAAInt;
+
+    jint *a, *d;
+
+    jbyte *alphaMap = rdr->alphaMap;
+    jint *paint = rdr->_paint;
+
+    if (spans == NULL || rdr->_imagePixelStride != 1) {
+        blitPTSrcOver8888_pre(rdr, height);
+        return;
+    }
+
+    minX = rdr->_minTouched;
+    maxX = rdr->_maxTouched;
+    w = (maxX >= minX) ? (maxX - minX + 1) : 0;
+
+    assert(w <= rdr->_paint_length);
+
+    for (j = 0; j < height; j++) {
+        d = intData + imageOffset + minX;
+
+        aval_relative = 0;
+        a = alpha;
+        for (x = 0; x < w; x += n) {
+            n = (w - x < SPAN_CHUNK) ? (w - x) : SPAN_CHUNK;
+            any = 0;
+            for (k = 0; k < n; k++) {
+                aval_relative += a[k];
+                a[k] = 0;
+                fracs[k] = aval_relative ? (alphaMap[aval_relative] & 0xff) + 1 : 0;
+                any |= fracs[k];
+            }
+            if (any) {
+                spans->ptSrcOver(d + x, paint + x, fracs, n, XNI_TRUE);
+            }
+            a += n;
+        }
+
+        imageOffset += imageScanlineStride;
+    }
+}
+
+void
+blitPTSrcOverMask8888_pre_simd(Renderer *rdr, jint height) {
+    jint j, x, k, n, any;
+    jint minX, maxX, w;
+    jint fracs[SPAN_CHUNK];
+
+    const SpanBlitters *spans = selectedBlitters;
+    jint *intData = rdr->_data;
+    jint imageOffset = rdr->_currImageOffset;
+    jint imageScanlineStride = rdr->_imageScanlineStride;
+    jbyte *alpha = rdr->_mask_byteData;
+    jint alphaOffset = rdr->_maskOffset;
+
+    jbyte *a;
+    jint *d;
+
+    jint *paint = rdr->_paint;
+
+    if (spans == NULL || rdr->_imagePixelStride != 1) {
+        blitPTSrcOverMask8888_pre(rdr, height);
+        return;
+    }
+
+    minX = rdr->_minTouched;
+    maxX = rdr->_maxTouched;
+    w = (maxX >= minX) ? (maxX - minX + 1) : 0;
+
+    for (j = 0; j < height; j++) {
+        d = intData + imageOffset + minX;
+
+        a = alpha + alphaOffset;
+        for (x = 0; x < w; x += n) {
+            n = (w - x < SPAN_CHUNK) ? (w - x) : SPAN_CHUNK;
+            any = 0;
+            for (k = 0; k < n; k++) {
+                fracs[k] = a[k] ? (a[k] & 0xff) + 1 : 0;
+                any |= fracs[k];
+            }
+            if (any) {
+                spans->ptSrcOver(d + x, paint + x, fracs, n, XNI_TRUE);
+            }
+            a += n;
+        }
+
+        imageOffset += imageScanlineStride;
+    }
+}
+
+/* EMIT LINES */
+
+static void
+fillSpan(jint *avals, jint n, jint value) {
+    jint k;
+    for (k = 0; k < n; k++) {
+        avals[k] = value;
+    }
+}
+
+void
+emitLineSourceOver8888_pre_simd(Renderer *rdr, jint height, jint frac) {
+    jint j, x, n, minX, w;
+    jint avals[SPAN_CHUNK];
+
+    const SpanBlitters *spans = selectedBlitters;
+    jint *intData = rdr->_data;
+    jint imageOffset = rdr->_currImageOffset;
+    jint imageScanlineStride = rdr->_imageScanlineStride;
+
+    jint *a;
+
+    jint calpha = rdr->_calpha;
+    jint src = 0xFF000000 | (rdr->_cred << 16) | (rdr->_cgreen << 8) | rdr->_cblue;
+    jint alpha = (calpha * frac) >> 16;
+
+    jint lfrac = rdr->_el_lfrac;
+    jint rfrac = rdr->_el_rfrac;
+    jint lalpha, ralpha;
+
+    if (spans == NULL || rdr->_imagePixelStride != 1) {
+        emitLineSourceOver8888_pre(rdr, height, frac);
+        return;
+    }
+
+    minX = rdr->_minTouched;
+    w = rdr->_alphaWidth;
+    w -= (lfrac) ? 1 : 0;
+    w -= (rfrac) ? 1 : 0;
+
+    if (alpha == MAX_ALPHA) {
+        lalpha = lfrac >> 8;
+        ralpha = rfrac >> 8;
+    } else {
+        lalpha = (lfrac * alpha) >> 16;
+        ralpha = (rfrac * alpha) >> 16;
+        fillSpan(avals, (w < SPAN_CHUNK) ? w : SPAN_CHUNK, alpha);
+    }
+
+    for (j = 0; j < height; j++) {
+        a = intData + imageOffset + minX;
+        if (lfrac) {
+            spans->srcOver(a, &lalpha, 1, src);
+            a++;
+        }
+        if (alpha == MAX_ALPHA) {
+            fillSpan(a, w, src);
+        } else {
+            for (x = 0; x < w; x += n) {
+                n = (w - x < SPAN_CHUNK) ? (w - x) : SPAN_CHUNK;
+                spans->srcOver(a + x, avals, n, src);
+            }
+        }
+        a += w;
+        if (rfrac) {
+            spans->srcOver(a, &ralpha, 1, src);
+        }
+        imageOffset += imageScanlineStride;
+    }
+}
+
+void
+emitLinePTSourceOver8888_pre_simd(Renderer *rdr, jint height, jint frac) {
+    jint j, x, n, minX, w;
+    jint paint_offset = 0;
+    jint fracs[SPAN_CHUNK];
+
+    const SpanBlitters *spans = selectedBlitters;
+    jint *intData = rdr->_data;
+    jint imageOffset = rdr->_currImageOffset;
+    jint imageScanlineStride = rdr->_imageScanlineStride;
+
+    jint *paint = rdr->_paint;
+    jint *a, *p;
+    jint paint_stride;
+
+    jlong llfrac = (rdr->_el_lfrac * (jlong)frac);
+    jlong lrfrac = (rdr->_el_rfrac * (jlong)frac);
+    jint lfrac = (jint)(llfrac >> 16);
+    jint rfrac = (jint)(lrfrac >> 16);
+    jint lf = lfrac >> 8;
+    jint rf = rfrac >> 8;
+    jboolean full = (frac == 0x10000) ? XNI_TRUE : XNI_FALSE;
+
+    if (spans == NULL || rdr->_imagePixelStride != 1) {
+        emitLinePTSourceOver8888_pre(rdr, height, frac);
+        return;
+    }
+
+    minX = rdr->_minTouched;
+    paint_stride = w = rdr->_alphaWidth;
+    w -= (lfrac) ? 1 : 0;
+    w -= (rfrac) ? 1 : 0;
+
+    // full coverage uses the whole paint and skips transparent pixels
+    fillSpan(fracs, (w < SPAN_CHUNK) ? w : SPAN_CHUNK, full ? 0x100 : (frac >> 8));
+
+    for (j = 0; j < height; j++) {
+        a = intData + imageOffset + minX;
+        p = paint + paint_offset;
+        if (lfrac) {
+            spans->ptSrcOver(a, p, &lf, 1, XNI_FALSE);
+            a++;
+            p++;
+        }
+        for (x = 0; x < w; x += n) {
+            n = (w - x < SPAN_CHUNK) ? (w - x) : SPAN_CHUNK;
+            spans->ptSrcOver(a + x, p + x, fracs, n, full);
+        }
+        a += w;
+        p += w;
+        if (rfrac) {
+            spans->ptSrcOver(a, p, &rf, 1, XNI_FALSE);
+        }
+        imageOffset += imageScanlineStride;
+        paint_offset += paint_stride;
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,8 @@
 
 #include <PiscesUtil.h>
 #include <PiscesRenderer.h>
+#include <PiscesBlit.h>
+#include <PiscesPaint.h>
 
 #include <PiscesSysutils.h>
 #include <PiscesMath.h>
@@ -120,12 +122,16 @@ genLinearGradientPaint(Renderer *rdr, jint height) {
         pidx = paintOffset;
 
         frac = x * mx + y * my + b;
-        for (i = 0; i < width; i++, pidx++) {
-            jint ifrac = pad((jint)frac, cycleMethod);
-            ifrac >>= 16 - LG_GRADIENT_MAP_SIZE;
-            paint[pidx] = colors[ifrac];
+        if (!genLinearGradientSpan_simd(paint + pidx, colors, width, frac, mx,
+                                        cycleMethod))
+        {
+            for (i = 0; i < width; i++, pidx++) {
+                jint ifrac = pad((jint)frac, cycleMethod);
+                ifrac >>= 16 - LG_GRADIENT_MAP_SIZE;
+                paint[pidx] = colors[ifrac];
 
-            frac += mx;
+                frac += mx;
+            }
         }
 
         paintOffset += width;
@@ -213,20 +219,24 @@ genRadialGradientPaint(Renderer *rdr, jint height) {
         dU  = (65536.0f * dU);
         dV  = (65536.0f * 65536.0f * dV);
         ddV = (65536.0f * 65536.0f * ddV);
-        for (i = 0; i < width; i++, pidx++) {
-            if (V < 0) {
-                V = 0;
-            }
+        if (!genRadialGradientSpan_simd(paint + pidx, colors, width,
+                                        U, dU, V, dV, ddV, cycleMethod))
+        {
+            for (i = 0; i < width; i++, pidx++) {
+                if (V < 0) {
+                    V = 0;
+                }
 
-            ifrac = (jint)(U + PISCESsqrt(V));
+                ifrac = (jint)(U + PISCESsqrt(V));
 
-            U += dU;
-            V += dV ;
-            dV += ddV;
+                U += dU;
+                V += dV ;
+                dV += ddV;
 
-            ifrac = pad(ifrac, cycleMethod);
-            ifrac >>= (16 - LG_GRADIENT_MAP_SIZE);
-            paint[pidx] = colors[ifrac];
+                ifrac = pad(ifrac, cycleMethod);
+                ifrac >>= (16 - LG_GRADIENT_MAP_SIZE);
+                paint[pidx] = colors[ifrac];
+            }
         }
 
         paintOffset += width;
@@ -405,6 +415,80 @@ static INLINE void getPointsToInterpolateRepeat(jint *pts, jint *data, jint sidx
     pts[2] = (isXin) ? data[sidx2 + 1] : data[sidx2 - MAX(tx,0)];
 }
 
+#define INTERPOLATE_CHUNK 64
+
+/*
+ * Generates an interpolated row of n pixels the same way as the per pixel
+ * loops of genTexturePaintTarget(), but gathers the points and fractions
+ * of INTERPOLATE_CHUNK pixels at a time and interpolates them with
+ * interpolateSpan_simd(). Pixels outside the texture are transparent when
+ * checkInBounds is set (see the generic transform).
+ */
+static void
+genInterpolatedRow_simd(Renderer *rdr, jint *a, jint n, jlong ltx, jlong lty,
+    jlong dtx, jlong dty, jboolean repeat, jboolean checkInBounds)
+{
+    jint p00[INTERPOLATE_CHUNK], p01[INTERPOLATE_CHUNK];
+    jint p10[INTERPOLATE_CHUNK], p11[INTERPOLATE_CHUNK];
+    jint hfracs[INTERPOLATE_CHUNK], vfracs[INTERPOLATE_CHUNK];
+    jint* txtData = rdr->_texture_intData;
+    jint txtWidth = rdr->_texture_imageWidth;
+    jint txtHeight = rdr->_texture_imageHeight;
+    jint txtStride = rdr->_texture_stride;
+    jint txMin = rdr->_texture_txMin;
+    jint tyMin = rdr->_texture_tyMin;
+    jint txMax = rdr->_texture_txMax;
+    jint tyMax = rdr->_texture_tyMax;
+    jint pts[3];
+    jint tx, ty, sidx;
+    jint i, k, cnt;
+    jboolean inBounds;
+
+    for (i = 0; i < n; i += cnt) {
+        cnt = MIN(n - i, INTERPOLATE_CHUNK);
+        for (k = 0; k < cnt; k++) {
+            tx = (jint)(ltx >> 16);
+            ty = (jint)(lty >> 16);
+            hfracs[k] = (jint)(ltx & 0xffff);
+            vfracs[k] = (jint)(lty & 0xffff);
+            inBounds = XNI_TRUE;
+            if (repeat) {
+                checkBoundsRepeat(&tx, &ltx, txMin-1, txMax);
+                checkBoundsRepeat(&ty, &lty, tyMin-1, tyMax);
+            } else if (checkInBounds) {
+                inBounds =
+                    isInBoundsNoRepeat(&tx, &ltx, txMin-1, txMax) &&
+                    isInBoundsNoRepeat(&ty, &lty, tyMin-1, tyMax);
+            } else {
+                checkBoundsNoRepeat(&tx, &ltx, txMin-1, txMax);
+                checkBoundsNoRepeat(&ty, &lty, tyMin-1, tyMax);
+            }
+            if (inBounds) {
+                sidx = MAX(0, ty) * txtStride + MAX(0, tx);
+                p00[k] = txtData[sidx];
+                if (repeat) {
+                    getPointsToInterpolateRepeat(pts, txtData, sidx, txtStride, p00[k],
+                        tx, txtWidth-1, ty, txtHeight-1);
+                } else {
+                    getPointsToInterpolate(pts, txtData, sidx, txtStride, p00[k],
+                        tx, txtWidth-1, ty, txtHeight-1);
+                }
+                p01[k] = pts[0];
+                p10[k] = pts[1];
+                p11[k] = pts[2];
+            } else {
+                // interpolates to 0x00000000
+                p00[k] = p01[k] = p10[k] = p11[k] = 0;
+                hfracs[k] = vfracs[k] = 0;
+            }
+            ltx += dtx;
+            lty += dty;
+        }
+        interpolateSpan_simd(a + i, p00, p01, p10, p11, hfracs, vfracs, cnt,
+            rdr->_texture_hasAlpha);
+    }
+}
+
 void
 genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
     jint j;
@@ -420,6 +504,8 @@ genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
     jint txMax = rdr->_texture_txMax;
     jint tyMax = rdr->_texture_tyMax;
     jint repeatInterpolateMode;
+    jboolean interpolateSIMD = rdr->_texture_interpolate &&
+        getBlitLevel() != PISCES_BLIT_SCALAR;
 
     if (rdr->_texture_interpolate) {
         if (rdr->_texture_hasAlpha) {
@@ -485,6 +571,13 @@ genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
 
             PISCES_DEBUG("TRANSLATE, txMin: %d, txMax: %d, tyMin: %d, tyMax: %d\n", txMin, txMax, tyMin, tyMax);
 
+            if (interpolateSIMD) {
+                genInterpolatedRow_simd(rdr, a, paintStride, ltx, lty,
+                    0x10000, 0, rdr->_texture_repeat, XNI_FALSE);
+                paintOffset += paintStride;
+                continue;
+            }
+
             switch (repeatInterpolateMode) {
             case NO_REPEAT_NO_INTERPOLATE:
             {
@@ -660,6 +753,13 @@ genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
 
             PISCES_DEBUG("SCALE, txMin: %d, txMax: %d, tyMin: %d, tyMax: %d\n", txMin, txMax, tyMin, tyMax);
 
+            if (interpolateSIMD) {
+                genInterpolatedRow_simd(rdr, a, paintStride, ltx, lty,
+                    rdr->_texture_m00, rdr->_texture_m10, rdr->_texture_repeat, XNI_FALSE);
+                paintOffset += paintStride;
+                continue;
+            }
+
             switch (repeatInterpolateMode) {
             case NO_REPEAT_NO_INTERPOLATE:
                 while (a < am) {
@@ -865,6 +965,13 @@ genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
 
             PISCES_DEBUG("GENERIC, txMin: %d, txMax: %d, tyMin: %d, tyMax: %d\n", txMin, txMax, tyMin, tyMax);
 
+            if (interpolateSIMD) {
+                genInterpolatedRow_simd(rdr, a, paintStride, ltx, lty,
+                    rdr->_texture_m00, rdr->_texture_m10, rdr->_texture_repeat, XNI_TRUE);
+                paintOffset += paintStride;
+                continue;
+            }
+
             switch (repeatInterpolateMode) {
             case NO_REPEAT_NO_INTERPOLATE:
                 while (a < am) {
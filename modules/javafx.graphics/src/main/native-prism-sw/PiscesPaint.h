@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,4 +34,19 @@ void genRadialGradientPaint(Renderer *rdr, jint height);
 void genTexturePaint(Renderer *rdr, jint height);
 void genTexturePaintMultiply(Renderer *rdr, jint height);
 
+/*
+ * SIMD variants of the inner loops of the paint generators, using the
+ * instruction set of the selected blitters (see PiscesBlit.h). They return
+ * XNI_FALSE, doing nothing, when no SIMD blitters are selected.
+ */
+jboolean genLinearGradientSpan_simd(jint *paint, const jint *colors, jint n,
+                                    jfloat frac, jfloat mx, jint cycleMethod);
+jboolean genRadialGradientSpan_simd(jint *paint, const jint *colors, jint n,
+                                    jfloat U, jfloat dU, jfloat V, jfloat dV,
+                                    jfloat ddV, jint cycleMethod);
+jboolean interpolateSpan_simd(jint *dst, const jint *p00, const jint *p01,
+                              const jint *p10, const jint *p11,
+                              const jint *hfracs, const jint *vfracs, jint n,
+                              jboolean hasAlpha);
+
 #endif
@@ -0,0 +1,620 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * SIMD variants of the gradient and texture paint generators.
+ *
+ * The recurrences of the gradient generators in PiscesPaint.c are kept
+ * scalar, since their float rounding sequence defines the result, and are
+ * resolved into a small chunk of fractions. The conversion, cycle padding
+ * and, for radial gradients, the square root of those fractions is then
+ * done by the span routines of the instruction set selected for the
+ * blitters (see PiscesBlitSIMD.c). Texture interpolation works on points
+ * gathered by PiscesPaint.c, one channel of 4 or 8 pixels per register.
+ * All span routines compute exactly the same pixels as the scalar code.
+ */
+
+#include <string.h>
+
+#include <PiscesBlit.h>
+#include <PiscesPaint.h>
+#include <PiscesSysutils.h>
+#include <PiscesUtil.h>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define PISCES_X86 1
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define PISCES_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if defined(PISCES_X86) && (defined(__GNUC__) || defined(__clang__))
+#define PISCES_TARGET(isa) __attribute__((target(isa)))
+#else
+#define PISCES_TARGET(isa)
+#endif
+
+// Number of pixels resolved at a time, a multiple of every vector width
+#define SPAN_CHUNK 64
+
+#define SPAN_ROUND(n) (((n) + 7) & ~7)
+
+#define GRADIENT_SHIFT (16 - LG_GRADIENT_MAP_SIZE)
+
+typedef struct {
+    /*
+     * paint[i] = colors[pad((jint)fracs[i], cycleMethod) >> GRADIENT_SHIFT]
+     * for SPAN_ROUND(n) entries.
+     */
+    void (*linear)(jint *paint, const jint *colors, const jfloat *fracs, jint n,
+                   jint cycleMethod);
+
+    /*
+     * Same as linear with the fractions (jint)(u[i] + sqrt(v[i])), evaluated
+     * in double precision as in genRadialGradientPaint. NULL when there are
+     * no double lanes.
+     */
+    void (*radial)(jint *paint, const jint *colors, const jfloat *u,
+                   const jfloat *v, jint n, jint cycleMethod);
+
+    /*
+     * The bilinear interpolation of interpolate4points (or of
+     * interpolate4pointsNoAlpha) of n pixels.
+     */
+    void (*interpolate)(jint *dst, const jint *p00, const jint *p01,
+                        const jint *p10, const jint *p11, const jint *hfracs,
+                        const jint *vfracs, jint n, jboolean hasAlpha);
+} SpanPainters;
+
+/*
+ * Runs the interpolation of the last n < lanes pixels on copies padded to
+ * a full vector.
+ */
+#define INTERPOLATE_TAIL(body, lanes)                                          \
+    if (i < n) {                                                               \
+        jint t00[lanes], t01[lanes], t10[lanes], t11[lanes];                   \
+        jint th[lanes], tv[lanes], td[lanes];                                  \
+        jint r = n - i;                                                        \
+        memset(t00, 0, sizeof(t00)); memset(t01, 0, sizeof(t01));              \
+        memset(t10, 0, sizeof(t10)); memset(t11, 0, sizeof(t11));              \
+        memset(th, 0, sizeof(th)); memset(tv, 0, sizeof(tv));                  \
+        memcpy(t00, p00 + i, r * sizeof(jint));                                \
+        memcpy(t01, p01 + i, r * sizeof(jint));                                \
+        memcpy(t10, p10 + i, r * sizeof(jint));                                \
+        memcpy(t11, p11 + i, r * sizeof(jint));                                \
+        memcpy(th, hfracs + i, r * sizeof(jint));                              \
+        memcpy(tv, vfracs + i, r * sizeof(jint));                              \
+        body(td, t00, t01, t10, t11, th, tv, hasAlpha);                        \
+        memcpy(dst + i, td, r * sizeof(jint));                                 \
+    }
+
+#ifdef PISCES_X86
+
+/* SSE2 spans, 4 pixels at a time. */
+
+PISCES_TARGET("sse2")
+static INLINE __m128i selectSSE2(__m128i mask, __m128i a, __m128i b) {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+PISCES_TARGET("sse2")
+static INLINE __m128i padSSE2(__m128i f, jint cycleMethod) {
+    __m128i m = _mm_set1_epi32(0xffff);
+    __m128i s;
+    switch (cycleMethod) {
+    case CYCLE_NONE:
+        f = _mm_andnot_si128(_mm_srai_epi32(f, 31), f);
+        f = selectSSE2(_mm_cmpgt_epi32(f, m), m, f);
+        break;
+    case CYCLE_REPEAT:
+        f = _mm_and_si128(f, m);
+        break;
+    case CYCLE_REFLECT:
+        s = _mm_srai_epi32(f, 31);
+        f = _mm_sub_epi32(_mm_xor_si128(f, s), s);
+        f = _mm_and_si128(f, _mm_set1_epi32(0x1ffff));
+        f = selectSSE2(_mm_cmpgt_epi32(f, m),
+                       _mm_sub_epi32(_mm_set1_epi32(0x1ffff), f), f);
+        break;
+    }
+    return _mm_srli_epi32(f, GRADIENT_SHIFT);
+}
+
+PISCES_TARGET("sse2")
+static INLINE void lookup4SSE2(jint *paint, const jint *colors, __m128i idx) {
+    jint i[4];
+    _mm_storeu_si128((__m128i *)i, idx);
+    paint[0] = colors[i[0]];
+    paint[1] = colors[i[1]];
+    paint[2] = colors[i[2]];
+    paint[3] = colors[i[3]];
+}
+
+PISCES_TARGET("sse2")
+static void linearSSE2(jint *paint, const jint *colors, const jfloat *fracs, jint n,
+                       jint cycleMethod)
+{
+    jint i;
+    for (i = 0; i < n; i += 4) {
+        __m128i f = _mm_cvttps_epi32(_mm_loadu_ps(fracs + i));
+        lookup4SSE2(paint + i, colors, padSSE2(f, cycleMethod));
+    }
+}
+
+PISCES_TARGET("sse2")
+static void radialSSE2(jint *paint, const jint *colors, const jfloat *u,
+                       const jfloat *v, jint n, jint cycleMethod)
+{
+    jint i;
+    for (i = 0; i < n; i += 4) {
+        __m128 uu = _mm_loadu_ps(u + i);
+        __m128 vv = _mm_loadu_ps(v + i);
+        __m128d lo = _mm_add_pd(_mm_cvtps_pd(uu), _mm_sqrt_pd(_mm_cvtps_pd(vv)));
+        __m128d hi = _mm_add_pd(_mm_cvtps_pd(_mm_movehl_ps(uu, uu)),
+                                _mm_sqrt_pd(_mm_cvtps_pd(_mm_movehl_ps(vv, vv))));
+        __m128i f = _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo), _mm_cvttpd_epi32(hi));
+        lookup4SSE2(paint + i, colors, padSSE2(f, cycleMethod));
+    }
+}
+
+/*
+ * frac is split for the lack of a 32-bit multiply: with d in [-255, 255]
+ * and frac in [0, 0xffff] the high halves of the 32-bit lanes of d and
+ * frac >> 1 multiply to 0, so madd gives d * (frac >> 1), to which
+ * d * (frac & 1) is added twice over.
+ */
+typedef struct {
+    __m128i half;
+    __m128i odd;
+} FracSSE2;
+
+PISCES_TARGET("sse2")
+static INLINE FracSSE2 fracSSE2(__m128i f) {
+    FracSSE2 r;
+    r.half = _mm_srli_epi32(f, 1);
+    r.odd = _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(f, _mm_set1_epi32(1)));
+    return r;
+}
+
+// interp() of 4 lanes
+PISCES_TARGET("sse2")
+static INLINE __m128i interpSSE2(__m128i x0, __m128i x1, FracSSE2 f) {
+    __m128i d = _mm_sub_epi32(x1, x0);
+    __m128i p = _mm_madd_epi16(d, f.half);
+    p = _mm_add_epi32(_mm_add_epi32(p, p), _mm_and_si128(d, f.odd));
+    p = _mm_add_epi32(_mm_add_epi32(_mm_slli_epi32(x0, 16), p), _mm_set1_epi32(0x8000));
+    return _mm_srai_epi32(p, 16);
+}
+
+PISCES_TARGET("sse2")
+static INLINE __m128i channelSSE2(__m128i p, jint shift) {
+    return _mm_and_si128(_mm_srl_epi32(p, _mm_cvtsi32_si128(shift)), _mm_set1_epi32(0xff));
+}
+
+PISCES_TARGET("sse2")
+static INLINE __m128i bilerpChannelSSE2(__m128i p00, __m128i p01, __m128i p10,
+                                        __m128i p11, FracSSE2 h, FracSSE2 v,
+                                        jint shift)
+{
+    __m128i c0 = interpSSE2(channelSSE2(p00, shift), channelSSE2(p01, shift), h);
+    __m128i c1 = interpSSE2(channelSSE2(p10, shift), channelSSE2(p11, shift), h);
+    return _mm_sll_epi32(interpSSE2(c0, c1, v), _mm_cvtsi32_si128(shift));
+}
+
+PISCES_TARGET("sse2")
+static INLINE void interpolate4SSE2(jint *dst, const jint *p00, const jint *p01,
+                                    const jint *p10, const jint *p11,
+                                    const jint *hfracs, const jint *vfracs,
+                                    jboolean hasAlpha)
+{
+    __m128i q00 = _mm_loadu_si128((const __m128i *)p00);
+    __m128i q01 = _mm_loadu_si128((const __m128i *)p01);
+    __m128i q10 = _mm_loadu_si128((const __m128i *)p10);
+    __m128i q11 = _mm_loadu_si128((const __m128i *)p11);
+    __m128i hf = _mm_loadu_si128((const __m128i *)hfracs);
+    __m128i vf = _mm_loadu_si128((const __m128i *)vfracs);
+    FracSSE2 h = fracSSE2(hf);
+    FracSSE2 v = fracSSE2(vf);
+    __m128i r = _mm_or_si128(
+        _mm_or_si128(bilerpChannelSSE2(q00, q01, q10, q11, h, v, 16),
+                     bilerpChannelSSE2(q00, q01, q10, q11, h, v, 8)),
+        bilerpChannelSSE2(q00, q01, q10, q11, h, v, 0));
+    if (hasAlpha) {
+        r = _mm_or_si128(r, bilerpChannelSSE2(q00, q01, q10, q11, h, v, 24));
+    } else {
+        // pixels which are not interpolated keep the alpha of p00
+        __m128i none = _mm_cmpeq_epi32(_mm_or_si128(hf, vf), _mm_setzero_si128());
+        r = selectSSE2(none, q00, _mm_or_si128(r, _mm_set1_epi32(0xff000000)));
+    }
+    _mm_storeu_si128((__m128i *)dst, r);
+}
+
+PISCES_TARGET("sse2")
+static void interpolateSSE2(jint *dst, const jint *p00, const jint *p01,
+                            const jint *p10, const jint *p11,
+                            const jint *hfracs, const jint *vfracs, jint n,
+                            jboolean hasAlpha)
+{
+    jint i;
+    for (i = 0; i + 4 <= n; i += 4) {
+        interpolate4SSE2(dst + i, p00 + i, p01 + i, p10 + i, p11 + i,
+                         hfracs + i, vfracs + i, hasAlpha);
+    }
+    INTERPOLATE_TAIL(interpolate4SSE2, 4)
+}
+
+static const SpanPainters sse2Painters = {
+    linearSSE2,
+    radialSSE2,
+    interpolateSSE2,
+};
+
+/* AVX2 spans, 8 pixels at a time. */
+
+PISCES_TARGET("avx2")
+static INLINE __m256i padAVX2(__m256i f, jint cycleMethod) {
+    __m256i m = _mm256_set1_epi32(0xffff);
+    switch (cycleMethod) {
+    case CYCLE_NONE:
+        f = _mm256_min_epi32(_mm256_max_epi32(f, _mm256_setzero_si256()), m);
+        break;
+    case CYCLE_REPEAT:
+        f = _mm256_and_si256(f, m);
+        break;
+    case CYCLE_REFLECT:
+        f = _mm256_and_si256(_mm256_abs_epi32(f), _mm256_set1_epi32(0x1ffff));
+        f = _mm256_blendv_epi8(f, _mm256_sub_epi32(_mm256_set1_epi32(0x1ffff), f),
+                               _mm256_cmpgt_epi32(f, m));
+        break;
+    }
+    return _mm256_srli_epi32(f, GRADIENT_SHIFT);
+}
+
+PISCES_TARGET("avx2")
+static void linearAVX2(jint *paint, const jint *colors, const jfloat *fracs, jint n,
+                       jint cycleMethod)
+{
+    jint i;
+    for (i = 0; i < n; i += 8) {
+        __m256i f = _mm256_cvttps_epi32(_mm256_loadu_ps(fracs + i));
+        _mm256_storeu_si256((__m256i *)(paint + i),
+                            _mm256_i32gather_epi32(colors, padAVX2(f, cycleMethod), 4));
+    }
+}
+
+PISCES_TARGET("avx2")
+static void radialAVX2(jint *paint, const jint *colors, const jfloat *u,
+                       const jfloat *v, jint n, jint cycleMethod)
+{
+    jint i;
+    for (i = 0; i < n; i += 8) {
+        __m256d lo = _mm256_add_pd(_mm256_cvtps_pd(_mm_loadu_ps(u + i)),
+                                   _mm256_sqrt_pd(_mm256_cvtps_pd(_mm_loadu_ps(v + i))));
+        __m256d hi = _mm256_add_pd(_mm256_cvtps_pd(_mm_loadu_ps(u + i + 4)),
+                                   _mm256_sqrt_pd(_mm256_cvtps_pd(_mm_loadu_ps(v + i + 4))));
+        __m256i f = _mm256_setr_m128i(_mm256_cvttpd_epi32(lo), _mm256_cvttpd_epi32(hi));
+        _mm256_storeu_si256((__m256i *)(paint + i),
+                            _mm256_i32gather_epi32(colors, padAVX2(f, cycleMethod), 4));
+    }
+}
+
+// interp() of 8 lanes
+PISCES_TARGET("avx2")
+static INLINE __m256i interpAVX2(__m256i x0, __m256i x1, __m256i f) {
+    __m256i p = _mm256_mullo_epi32(_mm256_sub_epi32(x1, x0), f);
+    p = _mm256_add_epi32(_mm256_add_epi32(_mm256_slli_epi32(x0, 16), p),
+                         _mm256_set1_epi32(0x8000));
+    return _mm256_srai_epi32(p, 16);
+}
+
+PISCES_TARGET("avx2")
+static INLINE __m256i channelAVX2(__m256i p, jint shift) {
+    return _mm256_and_si256(_mm256_srl_epi32(p, _mm_cvtsi32_si128(shift)),
+                            _mm256_set1_epi32(0xff));
+}
+
+PISCES_TARGET("avx2")
+static INLINE __m256i bilerpChannelAVX2(__m256i p00, __m256i p01, __m256i p10,
+                                        __m256i p11, __m256i h, __m256i v,
+                                        jint shift)
+{
+    __m256i c0 = interpAVX2(channelAVX2(p00, shift), channelAVX2(p01, shift), h);
+    __m256i c1 = interpAVX2(channelAVX2(p10, shift), channelAVX2(p11, shift), h);
+    return _mm256_sll_epi32(interpAVX2(c0, c1, v), _mm_cvtsi32_si128(shift));
+}
+
+PISCES_TARGET("avx2")
+static INLINE void interpolate8AVX2(jint *dst, const jint *p00, const jint *p01,
+                                    const jint *p10, const jint *p11,
+                                    const jint *hfracs, const jint *vfracs,
+                                    jboolean hasAlpha)
+{
+    __m256i q00 = _mm256_loadu_si256((const __m256i *)p00);
+    __m256i q01 = _mm256_loadu_si256((const __m256i *)p01);
+    __m256i q10 = _mm256_loadu_si256((const __m256i *)p10);
+    __m256i q11 = _mm256_loadu_si256((const __m256i *)p11);
+    __m256i h = _mm256_loadu_si256((const __m256i *)hfracs);
+    __m256i v = _mm256_loadu_si256((const __m256i *)vfracs);
+    __m256i r = _mm256_or_si256(
+        _mm256_or_si256(bilerpChannelAVX2(q00, q01, q10, q11, h, v, 16),
+                        bilerpChannelAVX2(q00, q01, q10, q11, h, v, 8)),
+        bilerpChannelAVX2(q00, q01, q10, q11, h, v, 0));
+    if (hasAlpha) {
+        r = _mm256_or_si256(r, bilerpChannelAVX2(q00, q01, q10, q11, h, v, 24));
+    } else {
+        // pixels which are not interpolated keep the alpha of p00
+        __m256i none = _mm256_cmpeq_epi32(_mm256_or_si256(h, v), _mm256_setzero_si256());
+        r = _mm256_blendv_epi8(_mm256_or_si256(r, _mm256_set1_epi32(0xff000000)),
+                               q00, none);
+    }
+    _mm256_storeu_si256((__m256i *)dst, r);
+}
+
+PISCES_TARGET("avx2")
+static void interpolateAVX2(jint *dst, const jint *p00, const jint *p01,
+                            const jint *p10, const jint *p11,
+                            const jint *hfracs, const jint *vfracs, jint n,
+                            jboolean hasAlpha)
+{
+    jint i;
+    for (i = 0; i + 8 <= n; i += 8) {
+        interpolate8AVX2(dst + i, p00 + i, p01 + i, p10 + i, p11 + i,
+                         hfracs + i, vfracs + i, hasAlpha);
+    }
+    INTERPOLATE_TAIL(interpolate8AVX2, 8)
+}
+
+static const SpanPainters avx2Painters = {
+    linearAVX2,
+    radialAVX2,
+    interpolateAVX2,
+};
+
+#endif /* PISCES_X86 */
+
+#ifdef PISCES_NEON
+
+/* NEON spans, 4 pixels at a time. */
+
+static INLINE int32x4_t padNEON(int32x4_t f, jint cycleMethod) {
+    int32x4_t m = vdupq_n_s32(0xffff);
+    switch (cycleMethod) {
+    case CYCLE_NONE:
+        f = vminq_s32(vmaxq_s32(f, vdupq_n_s32(0)), m);
+        break;
+    case CYCLE_REPEAT:
+        f = vandq_s32(f, m);
+        break;
+    case CYCLE_REFLECT:
+        f = vandq_s32(vabsq_s32(f), vdupq_n_s32(0x1ffff));
+        f = vbslq_s32(vcgtq_s32(f, m), vsubq_s32(vdupq_n_s32(0x1ffff), f), f);
+        break;
+    }
+    return vshrq_n_s32(f, GRADIENT_SHIFT);
+}
+
+static INLINE void lookup4NEON(jint *paint, const jint *colors, int32x4_t idx) {
+    paint[0] = colors[vgetq_lane_s32(idx, 0)];
+    paint[1] = colors[vgetq_lane_s32(idx, 1)];
+    paint[2] = colors[vgetq_lane_s32(idx, 2)];
+    paint[3] = colors[vgetq_lane_s32(idx, 3)];
+}
+
+static void linearNEON(jint *paint, const jint *colors, const jfloat *fracs, jint n,
+                       jint cycleMethod)
+{
+    jint i;
+    for (i = 0; i < n; i += 4) {
+        int32x4_t f = vcvtq_s32_f32(vld1q_f32(fracs + i));
+        lookup4NEON(paint + i, colors, padNEON(f, cycleMethod));
+    }
+}
+
+#if defined(__aarch64__)
+static void radialNEON(jint *paint, const jint *colors, const jfloat *u,
+                       const jfloat *v, jint n, jint cycleMethod)
+{
+    jint i;
+    for (i = 0; i < n; i += 4) {
+        float32x4_t uu = vld1q_f32(u + i);
+        float32x4_t vv = vld1q_f32(v + i);
+        float64x2_t lo = vaddq_f64(vcvt_f64_f32(vget_low_f32(uu)),
+                                   vsqrtq_f64(vcvt_f64_f32(vget_low_f32(vv))));
+        float64x2_t hi = vaddq_f64(vcvt_high_f64_f32(uu),
+                                   vsqrtq_f64(vcvt_high_f64_f32(vv)));
+        int32x4_t f = vcombine_s32(vqmovn_s64(vcvtq_s64_f64(lo)),
+                                   vqmovn_s64(vcvtq_s64_f64(hi)));
+        lookup4NEON(paint + i, colors, padNEON(f, cycleMethod));
+    }
+}
+#endif
+
+// interp() of 4 lanes
+static INLINE int32x4_t interpNEON(int32x4_t x0, int32x4_t x1, int32x4_t f) {
+    int32x4_t p = vmlaq_s32(vshlq_n_s32(x0, 16), vsubq_s32(x1, x0), f);
+    return vshrq_n_s32(vaddq_s32(p, vdupq_n_s32(0x8000)), 16);
+}
+
+static INLINE int32x4_t channelNEON(int32x4_t p, int32x4_t shift) {
+    return vreinterpretq_s32_u32(vandq_u32(vshlq_u32(vreinterpretq_u32_s32(p),
+                                                     vnegq_s32(shift)),
+                                           vdupq_n_u32(0xff)));
+}
+
+static INLINE int32x4_t bilerpChannelNEON(int32x4_t p00, int32x4_t p01, int32x4_t p10,
+                                          int32x4_t p11, int32x4_t h, int32x4_t v,
+                                          jint shift)
+{
+    int32x4_t s = vdupq_n_s32(shift);
+    int32x4_t c0 = interpNEON(channelNEON(p00, s), channelNEON(p01, s), h);
+    int32x4_t c1 = interpNEON(channelNEON(p10, s), channelNEON(p11, s), h);
+    return vshlq_s32(interpNEON(c0, c1, v), s);
+}
+
+static INLINE void interpolate4NEON(jint *dst, const jint *p00, const jint *p01,
+                                    const jint *p10, const jint *p11,
+                                    const jint *hfracs, const jint *vfracs,
+                                    jboolean hasAlpha)
+{
+    int32x4_t q00 = vld1q_s32(p00);
+    int32x4_t q01 = vld1q_s32(p01);
+    int32x4_t q10 = vld1q_s32(p10);
+    int32x4_t q11 = vld1q_s32(p11);
+    int32x4_t h = vld1q_s32(hfracs);
+    int32x4_t v = vld1q_s32(vfracs);
+    int32x4_t r = vorrq_s32(
+        vorrq_s32(bilerpChannelNEON(q00, q01, q10, q11, h, v, 16),
+                  bilerpChannelNEON(q00, q01, q10, q11, h, v, 8)),
+        bilerpChannelNEON(q00, q01, q10, q11, h, v, 0));
+    if (hasAlpha) {
+        r = vorrq_s32(r, bilerpChannelNEON(q00, q01, q10, q11, h, v, 24));
+    } else {
+        // pixels which are not interpolated keep the alpha of p00
+        uint32x4_t none = vceqq_s32(vorrq_s32(h, v), vdupq_n_s32(0));
+        r = vbslq_s32(none, q00, vorrq_s32(r, vdupq_n_s32((jint)0xff000000)));
+    }
+    vst1q_s32(dst, r);
+}
+
+static void interpolateNEON(jint *dst, const jint *p00, const jint *p01,
+                            const jint *p10, const jint *p11,
+                            const jint *hfracs, const jint *vfracs, jint n,
+                            jboolean hasAlpha)
+{
+    jint i;
+    for (i = 0; i + 4 <= n; i += 4) {
+        interpolate4NEON(dst + i, p00 + i, p01 + i, p10 + i, p11 + i,
+                         hfracs + i, vfracs + i, hasAlpha);
+    }
+    INTERPOLATE_TAIL(interpolate4NEON, 4)
+}
+
+static const SpanPainters neonPainters = {
+    linearNEON,
+#if defined(__aarch64__)
+    radialNEON,
+#else
+    NULL,
+#endif
+    interpolateNEON,
+};
+
+#endif /* PISCES_NEON */
+
+static const SpanPainters *
+getPainters() {
+    switch (getBlitLevel()) {
+#ifdef PISCES_X86
+    case PISCES_BLIT_SSE2:
+        return &sse2Painters;
+    case PISCES_BLIT_AVX2:
+        return &avx2Painters;
+#endif
+#ifdef PISCES_NEON
+    case PISCES_BLIT_NEON:
+        return &neonPainters;
+#endif
+    default:
+        return NULL;
+    }
+}
+
+
+jboolean
+genLinearGradientSpan_simd(jint *paint, const jint *colors, jint n,
+                           jfloat frac, jfloat mx, jint cycleMethod)
+{
+    const SpanPainters *painters = getPainters();
+    jfloat fracs[SPAN_CHUNK];
+    jint tail[SPAN_CHUNK];
+    jint i, k, cnt;
+
+    if (painters == NULL) {
+        return XNI_FALSE;
+    }
+    for (i = 0; i < n; i += cnt) {
+        cnt = MIN(n - i, SPAN_CHUNK);
+        for (k = 0; k < SPAN_ROUND(cnt); k++) {
+            fracs[k] = frac;
+            frac += mx;
+        }
+        if (cnt == SPAN_CHUNK) {
+            painters->linear(paint + i, colors, fracs, cnt, cycleMethod);
+        } else {
+            painters->linear(tail, colors, fracs, cnt, cycleMethod);
+            memcpy(paint + i, tail, cnt * sizeof(jint));
+        }
+    }
+    return XNI_TRUE;
+}
+
+jboolean
+genRadialGradientSpan_simd(jint *paint, const jint *colors, jint n,
+                           jfloat U, jfloat dU, jfloat V, jfloat dV, jfloat ddV,
+                           jint cycleMethod)
+{
+    const SpanPainters *painters = getPainters();
+    jfloat u[SPAN_CHUNK], v[SPAN_CHUNK];
+    jint tail[SPAN_CHUNK];
+    jint i, k, cnt;
+
+    if (painters == NULL || painters->radial == NULL) {
+        return XNI_FALSE;
+    }
+    for (i = 0; i < n; i += cnt) {
+        cnt = MIN(n - i, SPAN_CHUNK);
+        for (k = 0; k < SPAN_ROUND(cnt); k++) {
+            if (V < 0) {
+                V = 0;
+            }
+            u[k] = U;
+            v[k] = V;
+            U += dU;
+            V += dV;
+            dV += ddV;
+        }
+        if (cnt == SPAN_CHUNK) {
+            painters->radial(paint + i, colors, u, v, cnt, cycleMethod);
+        } else {
+            painters->radial(tail, colors, u, v, cnt, cycleMethod);
+            memcpy(paint + i, tail, cnt * sizeof(jint));
+        }
+    }
+    return XNI_TRUE;
+}
+
+jboolean
+interpolateSpan_simd(jint *dst, const jint *p00, const jint *p01,
+                     const jint *p10, const jint *p11, const jint *hfracs,
+                     const jint *vfracs, jint n, jboolean hasAlpha)
+{
+    const SpanPainters *painters = getPainters();
+    if (painters == NULL) {
+        return XNI_FALSE;
+    }
+    painters->interpolate(dst, p00, p01, p10, p11, hfracs, vfracs, n, hasAlpha);
+    return XNI_TRUE;
+}
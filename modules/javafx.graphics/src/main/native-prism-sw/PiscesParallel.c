@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <string.h>
+
+#include <PiscesParallel.h>
+#include <PiscesUtil.h>
+#include <PiscesSysutils.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#if defined(_WIN32)
+typedef SRWLOCK PiscesLock;
+typedef CONDITION_VARIABLE PiscesCondition;
+#define PISCES_LOCK_INIT SRWLOCK_INIT
+#define PISCES_CONDITION_INIT CONDITION_VARIABLE_INIT
+#define lockPisces(l) AcquireSRWLockExclusive(l)
+#define unlockPisces(l) ReleaseSRWLockExclusive(l)
+#define waitPisces(c, l) SleepConditionVariableSRW(c, l, INFINITE, 0)
+#define signalPisces(c) WakeConditionVariable(c)
+#define broadcastPisces(c) WakeAllConditionVariable(c)
+#else
+typedef pthread_mutex_t PiscesLock;
+typedef pthread_cond_t PiscesCondition;
+#define PISCES_LOCK_INIT PTHREAD_MUTEX_INITIALIZER
+#define PISCES_CONDITION_INIT PTHREAD_COND_INITIALIZER
+#define lockPisces(l) pthread_mutex_lock(l)
+#define unlockPisces(l) pthread_mutex_unlock(l)
+#define waitPisces(c, l) pthread_cond_wait(c, l)
+#define signalPisces(c) pthread_cond_signal(c)
+#define broadcastPisces(c) pthread_cond_broadcast(c)
+#endif
+
+// Upper bound of the pool, setPiscesThreads() clamps to it
+#define PISCES_MAX_THREADS 32
+
+// Bands are kept a multiple of the rows emitted at once
+#define PISCES_BAND_ALIGN NUM_ALPHA_ROWS
+
+typedef struct {
+    PiscesBandFunc func;
+    const void *arg;
+    const Renderer *rdr;
+    jint rows;
+    jint bandSize;
+} PiscesTask;
+
+/*
+ * The pool state, all guarded by poolLock. Workers are started lazily
+ * and live for the rest of the process, idle ones block on workCond.
+ */
+static PiscesLock poolLock = PISCES_LOCK_INIT;
+static PiscesCondition workCond = PISCES_CONDITION_INIT;
+static PiscesCondition doneCond = PISCES_CONDITION_INIT;
+static jint poolThreads = 1;
+static jint poolStarted = 0;
+static const PiscesTask *poolTask = NULL;
+static jint poolBands = 0;
+static jint poolNextBand = 0;
+static jint poolPending = 0;
+
+// Serializes the callers, the pool runs one task at a time
+static PiscesLock taskLock = PISCES_LOCK_INIT;
+
+static void
+runBand(const PiscesTask *task, jint band) {
+    Renderer rdr;
+    jint start = band * task->bandSize;
+    jint end = MIN(start + task->bandSize, task->rows);
+
+    // a private copy, the paint buffer being the only state it owns
+    memcpy(&rdr, task->rdr, sizeof(Renderer));
+    rdr._paint = NULL;
+    rdr._paint_length = 0;
+    task->func(&rdr, task->arg, start, end);
+    my_free(rdr._paint);
+}
+
+/*
+ * Claims and runs bands of the current task until none are left, called
+ * with poolLock held.
+ */
+static void
+runBandsLocked() {
+    while (poolNextBand < poolBands) {
+        const PiscesTask *task = poolTask;
+        jint band = poolNextBand++;
+        unlockPisces(&poolLock);
+        runBand(task, band);
+        lockPisces(&poolLock);
+        if (--poolPending == 0) {
+            signalPisces(&doneCond);
+        }
+    }
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI
+piscesWorker(LPVOID unused)
+#else
+static void *
+piscesWorker(void *unused)
+#endif
+{
+    lockPisces(&poolLock);
+    for (;;) {
+        while (poolNextBand >= poolBands) {
+            waitPisces(&workCond, &poolLock);
+        }
+        runBandsLocked();
+    }
+    // not reached
+    return 0;
+}
+
+/*
+ * Starts workers up to poolThreads - 1, called with poolLock held.
+ * Returns the number of threads, including the caller, available.
+ */
+static jint
+startWorkersLocked() {
+    while (poolStarted < poolThreads - 1) {
+#if defined(_WIN32)
+        HANDLE thread = CreateThread(NULL, 0, piscesWorker, NULL, 0, NULL);
+        if (thread == NULL) {
+            break;
+        }
+        CloseHandle(thread);
+#else
+        pthread_t thread;
+        pthread_attr_t attr;
+        int err;
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        err = pthread_create(&thread, &attr, piscesWorker, NULL);
+        pthread_attr_destroy(&attr);
+        if (err != 0) {
+            break;
+        }
+#endif
+        poolStarted++;
+    }
+    return MIN(poolStarted + 1, poolThreads);
+}
+
+jint
+setPiscesThreads(jint threads) {
+    if (threads < 1) {
+        threads = 1;
+    } else if (threads > PISCES_MAX_THREADS) {
+        threads = PISCES_MAX_THREADS;
+    }
+    lockPisces(&poolLock);
+    poolThreads = threads;
+    unlockPisces(&poolLock);
+    return threads;
+}
+
+void
+renderBands(Renderer *rdr, PiscesBandFunc func, const void *arg,
+            jint rows, jint width)
+{
+    PiscesTask task;
+    jint threads, bandSize;
+
+    lockPisces(&poolLock);
+    threads = poolThreads;
+    unlockPisces(&poolLock);
+    if (threads <= 1 || (jlong)rows * width < PISCES_PARALLEL_MIN_PIXELS ||
+        rows < 2 * PISCES_BAND_ALIGN)
+    {
+        func(rdr, arg, 0, rows);
+        return;
+    }
+
+    lockPisces(&taskLock);
+    lockPisces(&poolLock);
+    threads = startWorkersLocked();
+    bandSize = (rows + threads - 1) / threads;
+    bandSize = (bandSize + PISCES_BAND_ALIGN - 1) / PISCES_BAND_ALIGN * PISCES_BAND_ALIGN;
+    task.func = func;
+    task.arg = arg;
+    task.rdr = rdr;
+    task.rows = rows;
+    task.bandSize = bandSize;
+    poolTask = &task;
+    poolBands = (rows + bandSize - 1) / bandSize;
+    poolNextBand = 0;
+    poolPending = poolBands;
+    broadcastPisces(&workCond);
+    runBandsLocked();
+    while (poolPending > 0) {
+        waitPisces(&doneCond, &poolLock);
+    }
+    poolTask = NULL;
+    unlockPisces(&poolLock);
+    unlockPisces(&taskLock);
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef PISCES_PARALLEL_H
+#define PISCES_PARALLEL_H
+
+#include <PiscesDefs.h>
+#include <PiscesRenderer.h>
+
+/*
+ * Tiled rendering of the rows of a fill. Fills of at least
+ * PISCES_PARALLEL_MIN_PIXELS pixels are split into horizontal bands, each
+ * rendered with its own copy of the Renderer state (and its own paint
+ * buffer) by a small pool of native worker threads, the calling thread
+ * rendering the first band itself. The call returns once every band is
+ * done, so the surface is complete before anything is presented from it.
+ *
+ * The workers only touch the memory the Renderer points to and never
+ * call into the JVM, so the caller can keep holding the surface and the
+ * mask or texture arrays with GetPrimitiveArrayCritical.
+ */
+
+#define PISCES_PARALLEL_MIN_PIXELS (256 * 256)
+
+/*
+ * Renders the rows [start, end) of a fill. rdr is the Renderer of the
+ * band, positioned by the function itself; arg is passed through.
+ */
+typedef void (*PiscesBandFunc)(Renderer *rdr, const void *arg, jint start, jint end);
+
+/*
+ * Sets the number of threads, including the calling one, used for a
+ * large fill. Returns the number actually used, at least 1.
+ */
+jint setPiscesThreads(jint threads);
+
+/*
+ * Runs func over rows [0, rows) of a fill width pixels wide. Small fills,
+ * or a single thread, run on the caller with rdr itself; otherwise rdr is
+ * only read.
+ */
+void renderBands(Renderer *rdr, PiscesBandFunc func, const void *arg,
+                 jint rows, jint width);
+
+#endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -548,6 +548,22 @@ updateSurfaceDependedRoutines(Renderer* rdr) {
             rdr->_el_SourceOver = emitLineSourceOver8888_pre;
             rdr->_el_PT_Source = emitLinePTSource8888_pre;
             rdr->_el_PT_SourceOver = emitLinePTSourceOver8888_pre;
+
+            if (getBlitLevel() != PISCES_BLIT_SCALAR) {
+                rdr->_bl_SourceOverNoMask = blitSrcOver8888_pre_simd;
+                rdr->_bl_PT_SourceOverNoMask = blitPTSrcOver8888_pre_simd;
+                rdr->_bl_SourceNoMask = blitSrc8888_pre_simd;
+
+                rdr->_bl_SourceOverMask = blitSrcOverMask8888_pre_simd;
+                rdr->_bl_PT_SourceOverMask = blitPTSrcOverMask8888_pre_simd;
+                rdr->_bl_SourceMask = blitSrcMask8888_pre_simd;
+
+                rdr->_bl_Clear = blitSrc8888_pre_simd;
+                rdr->_bl_PT_Clear = blitSrc8888_pre_simd;
+
+                rdr->_el_SourceOver = emitLineSourceOver8888_pre_simd;
+                rdr->_el_PT_SourceOver = emitLinePTSourceOver8888_pre_simd;
+            }
             break;
         default:
             // unsupported!
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -23,23 +23,11 @@
  * questions.
  */
 
-#include "config.h"
+package com.sun.javafx.text;
 
-#include "KeyedCoding.h"
-#include "NotImplemented.h"
-
-namespace WebCore {
-
-std::unique_ptr<KeyedEncoder> KeyedEncoder::encoder()
-{
-    notImplemented();
-    return nullptr;
-}
-
-std::unique_ptr<KeyedDecoder> KeyedDecoder::decoder(const uint8_t*, size_t)
-{
-    notImplemented();
-    return nullptr;
-}
+public class PrismTextLayoutShim {
 
+    public static boolean isLayoutCached(String text, Object font) {
+        return PrismTextLayout.test_isLayoutCached(text, font);
+    }
 }
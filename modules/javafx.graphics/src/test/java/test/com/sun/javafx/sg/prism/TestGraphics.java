@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,7 @@ import com.sun.javafx.sg.prism.NGCamera;
 import com.sun.javafx.sg.prism.NGLightBase;
 import com.sun.prism.BasicStroke;
 import com.sun.prism.Graphics;
+import com.sun.prism.GPUTimer;
 import com.sun.prism.Image;
 import com.sun.prism.MediaFrame;
 import com.sun.prism.Mesh;
@@ -281,6 +282,7 @@ public class TestGraphics extends BaseGraphics {
         @Override public void setGlyphTexture(Texture texture) { }
         @Override public Texture getGlyphTexture() { return null; }
         @Override public boolean isSuperShaderAllowed() {return false; }
+        @Override public GPUTimer getGPUTimer() { return null; }
 
     }
 
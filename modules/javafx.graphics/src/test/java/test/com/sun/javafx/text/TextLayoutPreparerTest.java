@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.javafx.text;
+
+import com.sun.javafx.font.PGFont;
+import com.sun.javafx.font.PrismFontFactory;
+import com.sun.javafx.text.PrismTextLayoutFactory;
+import com.sun.javafx.text.PrismTextLayoutShim;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assume.assumeTrue;
+import org.junit.Test;
+
+public class TextLayoutPreparerTest {
+
+    // The preparer leaves batches smaller than this to the FX thread
+    private static final int BATCH_SIZE = 64;
+
+    @Test
+    public void testLayoutsAreCachedAfterPrepare() {
+        assumeTrue("Text layout threads are enabled",
+                PrismFontFactory.textLayoutThreads > 0
+                && PrismFontFactory.cacheLayoutSize > 0);
+
+        PGFont font = PrismFontFactory.getFontFactory().createFont("System Regular", 12);
+        PrismTextLayoutFactory factory = PrismTextLayoutFactory.getFactory();
+        String[] texts = new String[BATCH_SIZE];
+        for (int i = 0; i < texts.length; i++) {
+            texts[i] = "TextLayoutPreparerTest " + i;
+            assertFalse(PrismTextLayoutShim.isLayoutCached(texts[i], font));
+            factory.prepareLayout(texts[i], font);
+        }
+
+        factory.prepareLayouts();
+
+        for (String text : texts) {
+            assertTrue("Layout of [" + text + "] is cached",
+                    PrismTextLayoutShim.isLayoutCached(text, font));
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -130,6 +130,17 @@ public class PrismMediaFrameHandler implements ResourceFactoryListener {
             tme.texture = null;
         }
 
+        // 10 bit video needs a pipeline that can sample it directly, convert
+        // it to BGRA on the CPU otherwise
+        VideoDataBuffer converted = null;
+        if (vdb.getFormat() == VideoFormat.YCbCr_420p10 &&
+            !GraphicsPipeline.getPipeline().getResourceFactory(screen).
+                isFormatSupported(PixelFormat.MULTI_YCbCr_420_10))
+        {
+            converted = vdb.convertToFormat(VideoFormat.BGRA_PRE);
+            vdb = converted;
+        }
+
         PrismFrameBuffer prismBuffer = new PrismFrameBuffer(vdb);
         if (tme.texture == null) {
             ResourceFactory factory = GraphicsPipeline.getDefaultResourceFactory();
@@ -152,6 +163,10 @@ public class PrismMediaFrameHandler implements ResourceFactoryListener {
             tme.texture.update(prismBuffer, false);
         }
         tme.lastFrameTime = vdb.getTimestamp();
+
+        if (converted != null) {
+            converted.releaseFrame();
+        }
     }
 
     private void releaseData() {
@@ -207,6 +222,9 @@ public class PrismMediaFrameHandler implements ResourceFactoryListener {
                 case YCbCr_420p:
                     videoFormat = PixelFormat.MULTI_YCbCr_420;
                     break;
+                case YCbCr_420p10:
+                    videoFormat = PixelFormat.MULTI_YCbCr_420_10;
+                    break;
                 case YCbCr_422:
                     videoFormat = PixelFormat.BYTE_APPLE_422;
                     break;
@@ -222,6 +240,11 @@ public class PrismMediaFrameHandler implements ResourceFactoryListener {
             return primary.getBufferForPlane(plane);
         }
 
+        @Override
+        public long getNativeSurface() {
+            return primary.getNativeSurface();
+        }
+
         @Override
         public void holdFrame() {
             primary.holdFrame();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -206,6 +206,48 @@ public interface MediaPlayer {
      */
     public long getAudioSyncDelay();
 
+    /**
+     * Retrieves a snapshot of the playback counters.
+     *
+     * @return the statistics, or <code>null</code> if the platform does not
+     * collect any.
+     */
+    public MediaPlayerStatistics getStatistics();
+
+    /**
+     * Decode priority of a player that is not on screen.
+     */
+    public static final int DECODE_PRIORITY_LOW = -1;
+
+    /**
+     * Decode priority of a player by default.
+     */
+    public static final int DECODE_PRIORITY_NORMAL = 0;
+
+    /**
+     * Decode priority of a player that covers a large part of the screen.
+     */
+    public static final int DECODE_PRIORITY_HIGH = 1;
+
+    /**
+     * Sets the scheduling priority of the threads decoding the media, so
+     * that when many players compete for the CPU the visible ones are
+     * decoded first. The priority is a hint; platforms may ignore it.
+     *
+     * @param priority one of the <code>DECODE_PRIORITY_</code> values.
+     */
+    public void setDecodePriority(int priority);
+
+    /**
+     * Sets the size in pixels the video is displayed at, so that frames much
+     * larger than that can be scaled down before they are uploaded. The size
+     * is a hint; platforms may ignore it.
+     *
+     * @param width the displayed width, or 0 to use the size of the video.
+     * @param height the displayed height, or 0 to use the size of the video.
+     */
+    public void setOutputSizeHint(int width, int height);
+
     /**
      * Begins playing of the media.  To ensure smooth playback, catch the
      * onReady event in the MediaPlayerListener before playing.
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.media.jfxmedia;
+
+import java.util.Arrays;
+
+/**
+ * A snapshot of the playback counters of a {@link MediaPlayer}. Times are in
+ * microseconds. A time histogram has {@link #HISTOGRAM_BUCKETS} buckets where
+ * bucket <code>i</code> counts the samples shorter than 2<sup>i</sup>
+ * milliseconds and the last one everything longer.
+ */
+public final class MediaPlayerStatistics {
+    /**
+     * Number of buckets of a time histogram.
+     */
+    public static final int HISTOGRAM_BUCKETS = 8;
+
+    // Layout of the native statistics array, keep in sync with PipelineMetric
+    private static final int DECODED_FRAMES = 0;
+    private static final int DROPPED_FRAMES = 1;
+    private static final int LATE_FRAMES = 2;
+    private static final int INVALID_FRAMES = 3;
+    private static final int CONVERTED_FRAMES = 4;
+    private static final int CONVERSION_TIME = 5;
+    private static final int CONVERSION_TIME_MAX = 6;
+    private static final int HANDOFF_TIME = 7;
+    private static final int HANDOFF_TIME_MAX = 8;
+    private static final int QUEUE_OVERRUNS = 9;
+    private static final int QUEUE_UNDERRUNS = 10;
+    private static final int AUDIO_QUEUE_LIMIT = 11;
+    private static final int VIDEO_QUEUE_LIMIT = 12;
+    private static final int BUFFERING_STALLS = 13;
+    private static final int CONVERSION_HISTOGRAM = 14;
+    private static final int HANDOFF_HISTOGRAM = CONVERSION_HISTOGRAM + HISTOGRAM_BUCKETS;
+
+    /**
+     * Length of the array the statistics are created from.
+     */
+    public static final int VALUE_COUNT = HANDOFF_HISTOGRAM + HISTOGRAM_BUCKETS;
+
+    private final long[] values;
+
+    /**
+     * Constructor.
+     *
+     * @param values the counters in native layout, at least {@link #VALUE_COUNT} long.
+     * @throws IllegalArgumentException if <code>values</code> is too short.
+     */
+    public MediaPlayerStatistics(long[] values) {
+        if (values == null || values.length < VALUE_COUNT) {
+            throw new IllegalArgumentException("values.length < VALUE_COUNT");
+        }
+        this.values = values.clone();
+    }
+
+    /**
+     * Frames decoded and received from the video sink.
+     */
+    public long getDecodedFrames() {
+        return values[DECODED_FRAMES];
+    }
+
+    /**
+     * Frames dropped because a newer frame arrived before they reached Java.
+     */
+    public long getDroppedFrames() {
+        return values[DROPPED_FRAMES];
+    }
+
+    /**
+     * Frames which waited longer than 20 milliseconds before reaching Java.
+     */
+    public long getLateFrames() {
+        return values[LATE_FRAMES];
+    }
+
+    /**
+     * Frames discarded because they could not be described.
+     */
+    public long getInvalidFrames() {
+        return values[INVALID_FRAMES];
+    }
+
+    /**
+     * Frames converted to another pixel format for rendering.
+     */
+    public long getConvertedFrames() {
+        return values[CONVERTED_FRAMES];
+    }
+
+    /**
+     * Total time spent in pixel format conversions.
+     */
+    public long getConversionTime() {
+        return values[CONVERSION_TIME];
+    }
+
+    /**
+     * Longest pixel format conversion.
+     */
+    public long getMaxConversionTime() {
+        return values[CONVERSION_TIME_MAX];
+    }
+
+    /**
+     * Histogram of pixel format conversion times.
+     */
+    public long[] getConversionTimeHistogram() {
+        return Arrays.copyOfRange(values, CONVERSION_HISTOGRAM, CONVERSION_HISTOGRAM + HISTOGRAM_BUCKETS);
+    }
+
+    /**
+     * Total time frames waited between decoding and delivery to Java.
+     */
+    public long getHandoffTime() {
+        return values[HANDOFF_TIME];
+    }
+
+    /**
+     * Longest wait of a frame between decoding and delivery to Java.
+     */
+    public long getMaxHandoffTime() {
+        return values[HANDOFF_TIME_MAX];
+    }
+
+    /**
+     * Histogram of the waits between decoding and delivery to Java.
+     */
+    public long[] getHandoffTimeHistogram() {
+        return Arrays.copyOfRange(values, HANDOFF_HISTOGRAM, HANDOFF_HISTOGRAM + HISTOGRAM_BUCKETS);
+    }
+
+    /**
+     * Times the audio or video queue ran full.
+     */
+    public long getQueueOverruns() {
+        return values[QUEUE_OVERRUNS];
+    }
+
+    /**
+     * Times the audio or video queue ran empty.
+     */
+    public long getQueueUnderruns() {
+        return values[QUEUE_UNDERRUNS];
+    }
+
+    /**
+     * Current capacity of the audio queue in buffers.
+     */
+    public long getAudioQueueLimit() {
+        return values[AUDIO_QUEUE_LIMIT];
+    }
+
+    /**
+     * Current capacity of the video queue in buffers.
+     */
+    public long getVideoQueueLimit() {
+        return values[VIDEO_QUEUE_LIMIT];
+    }
+
+    /**
+     * Times playback stalled waiting for data.
+     */
+    public long getBufferingStalls() {
+        return values[BUFFERING_STALLS];
+    }
+
+    @Override
+    public String toString() {
+        return "MediaPlayerStatistics {decoded: " + getDecodedFrames()
+                + " dropped: " + getDroppedFrames()
+                + " late: " + getLateFrames()
+                + " invalid: " + getInvalidFrames()
+                + " converted: " + getConvertedFrames()
+                + " overruns: " + getQueueOverruns()
+                + " underruns: " + getQueueUnderruns()
+                + " stalls: " + getBufferingStalls() + "}";
+    }
+}
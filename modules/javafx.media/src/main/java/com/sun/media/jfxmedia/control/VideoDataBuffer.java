@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -107,6 +107,16 @@ public interface VideoDataBuffer {
      */
     public int getPlaneCount();
 
+    /**
+     * Returns the platform surface that holds the video image on the GPU,
+     * an {@code IOSurfaceRef} on macOS. The surface is only valid while the
+     * buffer is held.
+     *
+     * @return the native surface handle, or zero if the image is only in
+     * system memory
+     */
+    public long getNativeSurface();
+
     /**
      * Returns the number of bytes in each row of pixels for the specified plane.
      *
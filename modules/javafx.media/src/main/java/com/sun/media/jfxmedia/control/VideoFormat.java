@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,7 +41,11 @@ public enum VideoFormat {
     YCbCr_420p(FormatTypes.FORMAT_TYPE_YCBCR_420P),
     /** Packed YCbCr 4:2:2, no alpha support (Only used on Mac currently). This
      *  format is synonymous with the 'yuvs' pixel format in QuickTime (tm) */
-    YCbCr_422(FormatTypes.FORMAT_TYPE_YCBCR_422);
+    YCbCr_422(FormatTypes.FORMAT_TYPE_YCBCR_422),
+    /** Planar YCbCr 4:2:0 with 10 bit samples stored in the low bits of
+     *  16 bit little endian words, no alpha support (Only produced by the
+     *  libav decoder currently) */
+    YCbCr_420p10(FormatTypes.FORMAT_TYPE_YCBCR_420P10);
 
     private int nativeType; // value passed down to native code to represent this format
     private static final Map<Integer, VideoFormat> lookupMap = new HashMap<>();
@@ -77,5 +81,6 @@ public enum VideoFormat {
         @Native public static final int FORMAT_TYPE_BGRA_PRE = 2;
         @Native public static final int FORMAT_TYPE_YCBCR_420P = 100;
         @Native public static final int FORMAT_TYPE_YCBCR_422 = 101;
+        @Native public static final int FORMAT_TYPE_YCBCR_420P10 = 103;
     }
 }
@@ -80,11 +80,26 @@ public abstract class ConnectionHolder {
         if (buffer.limit() < buffer.capacity()) {
             buffer.limit(buffer.capacity());
         }
+        return readNextBlock(buffer);
+    }
+
+    /**
+     * Reads a block of data from the current position of the opened stream
+     * into the remaining space of the target buffer. The native source passes
+     * its own buffer memory as target so the data is not copied again.
+     *
+     * @return The number of bytes read, possibly zero, or -1 if the channel
+     * has reached end-of-stream.
+     *
+     * @throws ClosedChannelException if an attempt is made to read after
+     * closeConnection has been called
+     */
+    int readNextBlock(ByteBuffer target) throws IOException {
         // avoid NPE if channel does not exist or has been closed
         if (null == channel) {
             throw new ClosedChannelException();
         }
-        return channel.read(buffer);
+        return channel.read(target);
     }
 
     public ByteBuffer getBuffer() {
@@ -102,6 +117,26 @@ public abstract class ConnectionHolder {
      */
     abstract int readBlock(long position, int size) throws IOException;
 
+    /**
+     * Reads a block of data from the arbitrary position of the opened stream
+     * into the remaining space of the target buffer.
+     *
+     * @return The number of bytes read, possibly zero, or -1 if the given position
+     * is greater than or equal to the file's current size.
+     *
+     * @throws ClosedChannelException if an attempt is made to read after
+     * closeConnection has been called
+     */
+    int readBlock(long position, ByteBuffer target) throws IOException {
+        int read = readBlock(position, target.remaining());
+        if (read > 0) {
+            ByteBuffer data = buffer.duplicate();
+            data.rewind().limit(read);
+            target.put(data);
+        }
+        return read;
+    }
+
     /**
      * Detects whether this source needs buffering at the pipeline level.
      * When true the pipeline contains progressbuffer after the source.
@@ -210,6 +245,15 @@ public abstract class ConnectionHolder {
             return ((FileChannel)channel).read(buffer, position);
         }
 
+        @Override
+        int readBlock(long position, ByteBuffer target) throws IOException {
+            if (null == channel) {
+                throw new ClosedChannelException();
+            }
+
+            return ((FileChannel)channel).read(target, position);
+        }
+
         private ReadableByteChannel openFile(final URI uri) throws IOException {
             if (file != null) {
                 file.close();
@@ -389,7 +433,7 @@ public abstract class ConnectionHolder {
                     }
 
                     int actual;
-                    if (bb.equals(buffer)) {
+                    if (bb == buffer) {
                         // we'll cheat here as we know that bb is buffer and rather
                         // than copy the data, just slice it like for readBlock
                         actual = Math.min(DEFAULT_BUFFER_SIZE, backingBuffer.remaining());
@@ -35,13 +35,18 @@ import java.net.MalformedURLException;
 import java.net.URI;
 import java.net.URISyntaxException;
 import java.net.URLConnection;
+import java.nio.ByteBuffer;
 import java.nio.channels.Channels;
 import java.nio.channels.ReadableByteChannel;
 import java.nio.charset.Charset;
+import java.security.AccessController;
+import java.security.PrivilegedAction;
 import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.Iterator;
+import java.util.LinkedHashMap;
 import java.util.List;
+import java.util.Map;
 import java.util.concurrent.BlockingQueue;
 import java.util.concurrent.CountDownLatch;
 import java.util.concurrent.LinkedBlockingQueue;
@@ -80,6 +85,7 @@ final class HLSConnectionHolder extends ConnectionHolder {
     static final int HLS_PROP_LOAD_SEGMENT = 4;
     static final int HLS_PROP_SEGMENT_START_TIME = 5;
     static final int HLS_PROP_HAS_AUDIO_EXT_STREAM = 6;
+    static final int HLS_PROP_GET_LOW_LATENCY = 7;
     static final int HLS_VALUE_MIMETYPE_UNKNOWN = -1;
     static final int HLS_VALUE_MIMETYPE_MP2T = 1;
     static final int HLS_VALUE_MIMETYPE_MP3 = 2;
@@ -88,6 +94,17 @@ final class HLSConnectionHolder extends ConnectionHolder {
     static final String CHARSET_UTF_8 = "UTF-8";
     static final String CHARSET_US_ASCII = "US-ASCII";
 
+    // Live playlists start at the live edge instead of the oldest segment,
+    // play LL-HLS partial segments and skip ahead when playback falls too
+    // far behind, e.g. -Djfxmedia.hls.lowlatency=true
+    private static final boolean lowLatency;
+    static {
+        @SuppressWarnings("removal")
+        boolean value = AccessController.doPrivileged((PrivilegedAction<Boolean>) () ->
+                Boolean.getBoolean("jfxmedia.hls.lowlatency"));
+        lowLatency = value;
+    }
+
     HLSConnectionHolder(URI uri) {
         playlistLoader = new PlaylistLoader();
         playlistLoader.setPlaylistURI(uri);
@@ -108,17 +125,13 @@ final class HLSConnectionHolder extends ConnectionHolder {
     }
 
     @Override
-    public int readNextBlock() throws IOException {
+    int readNextBlock(ByteBuffer target) throws IOException {
         if (isBitrateAdjustable && readStartTime == -1) {
             readStartTime = System.currentTimeMillis();
         }
 
         if (headerChannel != null) {
-            buffer.rewind();
-            if (buffer.limit() < buffer.capacity()) {
-                buffer.limit(buffer.capacity());
-            }
-            int read = headerChannel.read(buffer);
+            int read = headerChannel.read(target);
             if (read == -1) {
                 resetHeaderConnection();
             } else {
@@ -126,7 +139,7 @@ final class HLSConnectionHolder extends ConnectionHolder {
             }
         }
 
-        int read = super.readNextBlock();
+        int read = super.readNextBlock(target);
         if (isBitrateAdjustable && read == -1) {
             long readTime = System.currentTimeMillis() - readStartTime;
             readStartTime = -1;
@@ -225,6 +238,8 @@ final class HLSConnectionHolder extends ConnectionHolder {
                 return segmentStart;
             case HLS_PROP_HAS_AUDIO_EXT_STREAM:
                 return hasAudioExtStream ? 1 : 0;
+            case HLS_PROP_GET_LOW_LATENCY:
+                return (lowLatency && currentPlaylist.isLive()) ? 1 : 0;
             default:
                 return -1;
         }
@@ -654,6 +669,10 @@ final class HLSConnectionHolder extends ConnectionHolder {
         private VariantPlaylist variantPlaylist = null;
         private Playlist playlist = null;
         private boolean isEndList = false;
+        // Partial segments listed ahead of their parent segment
+        private final List<String> parts = new ArrayList<>();
+        private final List<Double> partsDuration = new ArrayList<>();
+        private final List<Boolean> partsIndependent = new ArrayList<>();
 
         private final String TAG_PARAM_TYPE = "TYPE";
         private final String TAG_PARAM_TYPE_AUDIO = "AUDIO";
@@ -663,6 +682,8 @@ final class HLSConnectionHolder extends ConnectionHolder {
         private final String TAG_PARAM_URI = "URI";
         private final String TAG_PARAM_BANDWIDTH = "BANDWIDTH";
         private final String TAG_PARAM_AUDIO = "AUDIO";
+        private final String TAG_PARAM_DURATION = "DURATION";
+        private final String TAG_PARAM_INDEPENDENT = "INDEPENDENT";
         private final String TAG_VALUE_YES = "YES";
 
         void load(URI uri) {
@@ -776,12 +797,33 @@ final class HLSConnectionHolder extends ConnectionHolder {
                         String[] params = tagParams[1].split(",");
                         validateArray(params, 1);
                         String URI = getNextLine(reader);
-                        getPlaylist().addMediaFile(URI,
-                                Double.parseDouble(params[0]), isDiscontinuity);
+                        if (parts.isEmpty()) {
+                            getPlaylist().addMediaFile(URI,
+                                    Double.parseDouble(params[0]), isDiscontinuity);
+                        } else {
+                            addParts(URI);
+                        }
                         // Clear discontinue flag, until it is set again by parser.
                         isDiscontinuity = false;
                         break;
                     }
+                    case "#EXT-X-PART": { // #EXT-X-PART:<attribute-list>
+                        if (lowLatency) {
+                            // URI can be absolute, so split only on the first ":"
+                            String[] params = line.split(":", 2);
+                            validateArray(params, 2);
+                            params = params[1].split(",");
+                            String uri = getStringParams(TAG_PARAM_URI, params);
+                            String duration = getStringParams(TAG_PARAM_DURATION, params);
+                            if (uri != null && duration != null) {
+                                parts.add(uri);
+                                partsDuration.add(Double.parseDouble(duration));
+                                partsIndependent.add(TAG_VALUE_YES.equalsIgnoreCase(
+                                        getStringParams(TAG_PARAM_INDEPENDENT, params)));
+                            }
+                        }
+                        break;
+                    }
                     case "#EXT-X-TARGETDURATION": { // #EXT-X-TARGETDURATION:<s>
                         validateArray(tagParams, 2);
                         getPlaylist().setTargetDuration(
@@ -857,6 +899,19 @@ final class HLSConnectionHolder extends ConnectionHolder {
                     }
                 }
             }
+
+            // Parts of the segment which is still being produced
+            if (!parts.isEmpty()) {
+                addParts(null);
+            }
+        }
+
+        private void addParts(String segmentURI) {
+            getPlaylist().addMediaFileParts(segmentURI, parts, partsDuration,
+                    partsIndependent, isDiscontinuity);
+            parts.clear();
+            partsDuration.clear();
+            partsIndependent.clear();
         }
 
         private String getStringParams(String name, String[] params) {
@@ -1179,6 +1234,12 @@ final class HLSConnectionHolder extends ConnectionHolder {
         private final List<String> mediaFiles = new ArrayList<>();
         final List<Double> mediaFilesStartTimes = new ArrayList<>();
         private final List<Boolean> mediaFilesDiscontinuities = new ArrayList<>();
+        // Whether a media file starts with a keyframe. False only for
+        // partial segments not marked INDEPENDENT.
+        private final List<Boolean> mediaFilesIndependent = new ArrayList<>();
+        // Segments played through their parts, mapped to their first part
+        private final Map<String, String> partSegments = new LinkedHashMap<>();
+        private boolean liveEdgeReached = false;
         private boolean needBaseURI = true;
         private String baseURI = null;
         private double startTime = 0.0;
@@ -1189,6 +1250,8 @@ final class HLSConnectionHolder extends ConnectionHolder {
         private boolean forceDiscontinuity = false;
         private int mimeType = HLS_VALUE_MIMETYPE_UNKNOWN;
         private int mediaFileIndex = -1;
+        private static final int MAX_LIVE_EDGE_DISTANCE = 3;
+        private static final int MAX_PART_SEGMENTS = 64;
         private final Semaphore liveSemaphore = new Semaphore(0);
         private boolean isPlaylistClosed = false;
         // Valid only if this playlist represent audio extension
@@ -1262,6 +1325,37 @@ final class HLSConnectionHolder extends ConnectionHolder {
         }
 
         void addMediaFile(String URI, double duration, boolean isDiscontinuity) {
+            addMediaFile(URI, duration, isDiscontinuity, true);
+        }
+
+        // Adds the parts of a segment. segmentURI is null for the segment
+        // which is still being produced. Once the segment is complete it is
+        // not loaded again, since its data was already read from the parts.
+        void addMediaFileParts(String segmentURI, List<String> parts, List<Double> partsDuration,
+                               List<Boolean> partsIndependent, boolean isDiscontinuity) {
+            synchronized (lock) {
+                if (segmentURI != null && !partSegments.containsKey(segmentURI)) {
+                    if (mediaFiles.contains(segmentURI)) {
+                        return; // Already added as a whole segment
+                    }
+                    partSegments.put(segmentURI, parts.get(0));
+                    // Keep the map bounded for long running streams
+                    Iterator<String> it = partSegments.keySet().iterator();
+                    while (partSegments.size() > MAX_PART_SEGMENTS) {
+                        it.next();
+                        it.remove();
+                    }
+                }
+
+                for (int i = 0; i < parts.size(); i++) {
+                    addMediaFile(parts.get(i), partsDuration.get(i), (i == 0) && isDiscontinuity,
+                            partsIndependent.get(i));
+                }
+            }
+        }
+
+        private void addMediaFile(String URI, double duration,
+                                  boolean isDiscontinuity, boolean isIndependent) {
             synchronized (lock) {
 
                 if (needBaseURI) {
@@ -1270,11 +1364,13 @@ final class HLSConnectionHolder extends ConnectionHolder {
 
                 if (isLive) {
                     if (sequenceNumberUpdated) {
-                        int index = mediaFiles.indexOf(URI);
+                        int index = mediaFiles.indexOf(
+                                partSegments.getOrDefault(URI, URI));
                         if (index != -1) {
                             for (int i = 0; i < index; i++) {
                                 mediaFiles.remove(0);
                                 mediaFilesDiscontinuities.remove(0);
+                                mediaFilesIndependent.remove(0);
                                 if (mediaFileIndex == -1) {
                                     forceDiscontinuity = true;
                                 }
@@ -1286,13 +1382,14 @@ final class HLSConnectionHolder extends ConnectionHolder {
                         sequenceNumberUpdated = false;
                     }
 
-                    if (mediaFiles.contains(URI)) {
+                    if (mediaFiles.contains(URI) || partSegments.containsKey(URI)) {
                         return; // Nothing to add
                     }
                 }
 
                 mediaFiles.add(URI);
                 mediaFilesDiscontinuities.add(isDiscontinuity);
+                mediaFilesIndependent.add(isIndependent);
 
                 if (isLive) {
                     if (isLiveWaiting) {
@@ -1339,6 +1436,9 @@ final class HLSConnectionHolder extends ConnectionHolder {
             }
 
             synchronized (lock) {
+                if (isLive && lowLatency) {
+                    seekToLiveEdge();
+                }
                 mediaFileIndex++;
                 if (mediaFileIndex < mediaFiles.size()) {
                     if (baseURI != null) {
@@ -1352,6 +1452,29 @@ final class HLSConnectionHolder extends ConnectionHolder {
             }
         }
 
+        // Moves to the newest media file which starts with a keyframe, when
+        // live playback starts or has fallen behind by more than
+        // MAX_LIVE_EDGE_DISTANCE media files. Should be called with lock held.
+        private void seekToLiveEdge() {
+            // Header of fMP4 stream at index 0 is sent separately
+            int first = isFragmentedMP4() ? 1 : 0;
+            int last = mediaFiles.size() - 1;
+            if (mediaFileIndex + 1 < first
+                    || (liveEdgeReached && last - mediaFileIndex <= MAX_LIVE_EDGE_DISTANCE)) {
+                return;
+            }
+
+            for (int i = last; i > mediaFileIndex + 1 && i >= first; i--) {
+                if (mediaFilesIndependent.get(i)) {
+                    // Timestamps jump, so let demuxer know
+                    forceDiscontinuity = liveEdgeReached;
+                    mediaFileIndex = i - 1; // Caller will increment mediaFileIndex
+                    break;
+                }
+            }
+            liveEdgeReached = true;
+        }
+
         String getHeaderFile() {
             synchronized (lock) {
                 if (mediaFiles.size() > 0) {
@@ -1465,6 +1588,7 @@ final class HLSConnectionHolder extends ConnectionHolder {
                         } else {
                             mediaFileIndex = -1;
                         }
+                        liveEdgeReached = false;
                         if (isLiveWaiting) {
                             isLiveStop = true;
                             liveSemaphore.release();
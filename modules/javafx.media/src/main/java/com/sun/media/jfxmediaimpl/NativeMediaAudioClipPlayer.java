@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,7 +33,10 @@ import com.sun.media.jfxmedia.events.PlayerStateListener;
 import com.sun.media.jfxmedia.locator.Locator;
 import com.sun.media.jfxmedia.logging.Logger;
 import java.net.URI;
+import java.util.ArrayDeque;
 import java.util.ArrayList;
+import java.util.Deque;
+import java.util.Iterator;
 import java.util.List;
 import java.util.concurrent.CountDownLatch;
 import java.util.concurrent.LinkedBlockingQueue;
@@ -68,6 +71,13 @@ final class NativeMediaAudioClipPlayer
                 new ArrayList<>(MAX_PLAYER_COUNT);
     private static final ReentrantLock playerListLock = new ReentrantLock();
 
+    // Players which finished playing are kept paused at the start of their
+    // clip, so playing the same clip again does not build a new pipeline.
+    // Guarded by playerListLock.
+    private static final int MAX_IDLE_PLAYER_COUNT = 4;
+    private static final long IDLE_PLAYER_TIMEOUT = 5000; // ms
+    private static final Deque<IdlePlayer> idlePlayers = new ArrayDeque<>();
+
     public static int getPlayerLimit() {
         return MAX_PLAYER_COUNT;
     }
@@ -100,9 +110,12 @@ final class NativeMediaAudioClipPlayer
         while (true) {
             SchedulerEntry entry = null;
             try {
-                entry = schedule.take();
+                // wake up periodically to release players idle for too long
+                entry = schedule.poll(IDLE_PLAYER_TIMEOUT, TimeUnit.MILLISECONDS);
             } catch (InterruptedException ie) {}
 
+            disposeIdlePlayers(System.currentTimeMillis() - IDLE_PLAYER_TIMEOUT);
+
             if (null != entry) {
                 if (entry.getCommand() == 0) {
                     NativeMediaAudioClipPlayer player = entry.getPlayer();
@@ -139,6 +152,9 @@ final class NativeMediaAudioClipPlayer
 
                     // purge the schedule too
                     boolean clearSchedule = (null == sourceURI); // if no source given, kill all instances
+                    if (clearSchedule) {
+                        disposeIdlePlayers(Long.MAX_VALUE);
+                    }
                     for (SchedulerEntry killEntry : schedule) {
                         NativeMediaAudioClipPlayer player = killEntry.getPlayer();
                         if (clearSchedule ||
@@ -214,6 +230,47 @@ final class NativeMediaAudioClipPlayer
         return true;
     }
 
+    // Returns the most recently parked player of the clip, or null
+    private static MediaPlayer takeIdlePlayer(URI sourceURI) {
+        playerListLock.lock();
+        try {
+            Iterator<IdlePlayer> it = idlePlayers.descendingIterator();
+            while (it.hasNext()) {
+                IdlePlayer idle = it.next();
+                if (idle.sourceURI.equals(sourceURI)) {
+                    it.remove();
+                    return idle.mediaPlayer;
+                }
+            }
+        } finally {
+            playerListLock.unlock();
+        }
+        return null;
+    }
+
+    // Disposes players parked before the given time, called on the
+    // scheduler thread
+    private static void disposeIdlePlayers(long idleBefore) {
+        List<MediaPlayer> expired = new ArrayList<>();
+        playerListLock.lock();
+        try {
+            Iterator<IdlePlayer> it = idlePlayers.iterator();
+            while (it.hasNext()) {
+                IdlePlayer idle = it.next();
+                if (idle.idleSince <= idleBefore) {
+                    it.remove();
+                    expired.add(idle.mediaPlayer);
+                }
+            }
+        } finally {
+            playerListLock.unlock();
+        }
+
+        for (MediaPlayer player : expired) {
+            player.dispose();
+        }
+    }
+
     // Pass null to stop all players
     public static void stopPlayers(Locator source) {
         URI sourceURI = (source != null) ? source.getURI() : null;
@@ -316,9 +373,21 @@ final class NativeMediaAudioClipPlayer
             playCount = 0;
 
             if (null == mediaPlayer) {
-                mediaPlayer = MediaManager.getPlayer(source());
-                mediaPlayer.addMediaPlayerListener(this);
-                mediaPlayer.addMediaErrorListener(this);
+                mediaPlayer = takeIdlePlayer(source().getURI());
+                if (null != mediaPlayer) {
+                    // already prerolled, onReady will not be called again
+                    mediaPlayer.addMediaPlayerListener(this);
+                    mediaPlayer.addMediaErrorListener(this);
+                    ready = true;
+                    mediaPlayer.setVolume((float)volume);
+                    mediaPlayer.setBalance((float)balance);
+                    mediaPlayer.setRate((float)rate);
+                    mediaPlayer.play();
+                } else {
+                    mediaPlayer = MediaManager.getPlayer(source());
+                    mediaPlayer.addMediaPlayerListener(this);
+                    mediaPlayer.addMediaErrorListener(this);
+                }
             } else {
                 mediaPlayer.play();
             }
@@ -362,6 +431,43 @@ final class NativeMediaAudioClipPlayer
         }
     }
 
+    // Playback completed, park the player for the next play of the clip
+    private synchronized void finish() {
+        playerStateLock.lock();
+        playerListLock.lock();
+
+        try {
+            playing = false;
+            playCount = 0;
+            ready = false;
+
+            activePlayers.remove(this);
+            sourceClip.playFinished();
+
+            if (null != mediaPlayer) {
+                mediaPlayer.removeMediaPlayerListener(this);
+                mediaPlayer.removeMediaErrorListener(this);
+                mediaPlayer.pause();
+                mediaPlayer.seek(0);
+                idlePlayers.addLast(new IdlePlayer(source().getURI(), mediaPlayer));
+                mediaPlayer = null;
+
+                if (idlePlayers.size() > MAX_IDLE_PLAYER_COUNT) {
+                    MediaPlayer oldest = idlePlayers.removeFirst().mediaPlayer;
+                    SchedulerEntry entry = new SchedulerEntry(oldest);
+                    if (!schedule.offer(entry)) {
+                        oldest.dispose();
+                    }
+                }
+            }
+        } catch (Throwable t) {
+            invalidate();
+        } finally {
+            playerListLock.unlock();
+            playerStateLock.unlock();
+        }
+    }
+
     @Override
     public void onReady(PlayerStateEvent evt) {
         playerStateLock.lock();
@@ -405,7 +511,7 @@ final class NativeMediaAudioClipPlayer
                     if (playCount <= loopCount) {
                         mediaPlayer.seek(0); // restart
                     } else {
-                        invalidate();
+                        finish();
                     }
                 } else {
                     mediaPlayer.seek(0); // restart
@@ -472,6 +578,18 @@ final class NativeMediaAudioClipPlayer
         return h;
     }
 
+    private static class IdlePlayer {
+        private final URI sourceURI;
+        private final MediaPlayer mediaPlayer;
+        private final long idleSince;
+
+        IdlePlayer(URI sourceURI, MediaPlayer mediaPlayer) {
+            this.sourceURI = sourceURI;
+            this.mediaPlayer = mediaPlayer;
+            idleSince = System.currentTimeMillis();
+        }
+    }
+
     private static class SchedulerEntry {
         private final int command; // 0 = play, 1 = stop, 2 = dispose
         private final NativeMediaAudioClipPlayer player; // MAY BE NULL!
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,10 +26,12 @@
 package com.sun.media.jfxmediaimpl;
 
 import java.lang.annotation.Native;
+import com.sun.javafx.logging.PulseLogger;
 import com.sun.media.jfxmedia.Media;
 import com.sun.media.jfxmedia.MediaError;
 import com.sun.media.jfxmedia.MediaException;
 import com.sun.media.jfxmedia.MediaPlayer;
+import com.sun.media.jfxmedia.MediaPlayerStatistics;
 import com.sun.media.jfxmedia.control.VideoRenderControl;
 import com.sun.media.jfxmedia.effects.AudioEqualizer;
 import com.sun.media.jfxmedia.effects.AudioSpectrum;
@@ -117,6 +119,7 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
     private boolean checkSeek = false;
     private double timeBeforeSeek = 0.0;
     private double timeAfterSeek = 0.0;
+    private long stallStart = 0L;
     private double previousTime = 0.0;
     private double firedMarkerTime = -1.0;
     private double startTime = 0.0;
@@ -1023,6 +1026,34 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
         return 0;
     }
 
+    @Override
+    public MediaPlayerStatistics getStatistics() {
+        try {
+            return playerGetStatistics();
+        } catch (MediaException me) {
+            sendPlayerEvent(new MediaErrorEvent(this, me.getMediaError()));
+        }
+        return null;
+    }
+
+    @Override
+    public void setDecodePriority(int priority) {
+        try {
+            playerSetDecodePriority(priority);
+        } catch (MediaException me) {
+            sendPlayerEvent(new MediaErrorEvent(this, me.getMediaError()));
+        }
+    }
+
+    @Override
+    public void setOutputSizeHint(int width, int height) {
+        try {
+            playerSetOutputSizeHint(width, height);
+        } catch (MediaException me) {
+            sendPlayerEvent(new MediaErrorEvent(this, me.getMediaError()));
+        }
+    }
+
     @Override
     public void play() {
         try {
@@ -1274,6 +1305,12 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
 
     protected abstract void playerSetAudioSyncDelay(long delay) throws MediaException;
 
+    protected abstract MediaPlayerStatistics playerGetStatistics() throws MediaException;
+
+    protected abstract void playerSetDecodePriority(int priority) throws MediaException;
+
+    protected abstract void playerSetOutputSizeHint(int width, int height) throws MediaException;
+
     protected abstract void playerPlay() throws MediaException;
 
     protected abstract void playerStop() throws MediaException;
@@ -1474,15 +1511,19 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
                 sendPlayerEvent(new PlayerStateEvent(PlayerStateEvent.PlayerState.READY, time));
                 break;
             case eventPlayerPlaying:
+                endStall();
                 sendPlayerEvent(new PlayerStateEvent(PlayerStateEvent.PlayerState.PLAYING, time));
                 break;
             case eventPlayerPaused:
+                endStall();
                 sendPlayerEvent(new PlayerStateEvent(PlayerStateEvent.PlayerState.PAUSED, time));
                 break;
             case eventPlayerStopped:
+                endStall();
                 sendPlayerEvent(new PlayerStateEvent(PlayerStateEvent.PlayerState.STOPPED, time));
                 break;
             case eventPlayerStalled:
+                stallStart = PulseLogger.nativeStart(PulseLogger.NATIVE_MEDIA);
                 sendPlayerEvent(new PlayerStateEvent(PlayerStateEvent.PlayerState.STALLED, time));
                 break;
             case eventPlayerFinished:
@@ -1493,6 +1534,16 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
         }
     }
 
+    /**
+     * Reports the time the native pipeline spent buffering since it stalled.
+     */
+    private void endStall() {
+        if (stallStart != 0L) {
+            PulseLogger.nativeEnd(PulseLogger.NATIVE_MEDIA, "Buffering stall", stallStart, 0L);
+            stallStart = 0L;
+        }
+    }
+
     protected void sendNewFrameEvent(long nativeRef) {
         NativeVideoBuffer newFrameData = NativeVideoBuffer.createVideoBuffer(nativeRef);
         // createVideoBuffer puts a hold on the frame
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -42,6 +42,7 @@ final class NativeVideoBuffer implements VideoDataBuffer {
 
     private native double nativeGetTimestamp(long handle);
     private native ByteBuffer nativeGetBufferForPlane(long handle, int plane);
+    private native long nativeGetNativeSurface(long handle);
     private native int nativeGetWidth(long handle);
     private native int nativeGetHeight(long handle);
     private native int nativeGetEncodedWidth(long handle);
@@ -123,6 +124,16 @@ final class NativeVideoBuffer implements VideoDataBuffer {
         return null;
     }
 
+    @Override
+    public long getNativeSurface() {
+        if (0 != nativePeer) {
+            return nativeGetNativeSurface(nativePeer);
+        } else if (DEBUG_DISPOSED_BUFFERS) {
+            throw new NullPointerException("method called on disposed NativeVideoBuffer");
+        }
+        return 0;
+    }
+
     @Override
     public int getWidth() {
         if (0 != nativePeer) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.media.jfxmediaimpl.platform.gstreamer;
 
 import com.sun.media.jfxmedia.MediaError;
 import com.sun.media.jfxmedia.MediaException;
+import com.sun.media.jfxmedia.MediaPlayerStatistics;
 import com.sun.media.jfxmedia.effects.AudioEqualizer;
 import com.sun.media.jfxmedia.effects.AudioSpectrum;
 import com.sun.media.jfxmedia.locator.Locator;
@@ -104,6 +105,32 @@ final class GSTMediaPlayer extends NativeMediaPlayer {
         }
     }
 
+    @Override
+    protected MediaPlayerStatistics playerGetStatistics() throws MediaException {
+        long[] statistics = new long[MediaPlayerStatistics.VALUE_COUNT];
+        int rc = gstGetStatistics(gstMedia.getNativeMediaRef(), statistics);
+        if (0 != rc) {
+            throwMediaErrorException(rc, null);
+        }
+        return new MediaPlayerStatistics(statistics);
+    }
+
+    @Override
+    protected void playerSetDecodePriority(int priority) throws MediaException {
+        int rc = gstSetDecodePriority(gstMedia.getNativeMediaRef(), priority);
+        if (0 != rc) {
+            throwMediaErrorException(rc, null);
+        }
+    }
+
+    @Override
+    protected void playerSetOutputSizeHint(int width, int height) throws MediaException {
+        int rc = gstSetOutputSizeHint(gstMedia.getNativeMediaRef(), width, height);
+        if (0 != rc) {
+            throwMediaErrorException(rc, null);
+        }
+    }
+
     @Override
     protected void playerPlay() throws MediaException {
         int rc = gstPlay(gstMedia.getNativeMediaRef());
@@ -284,6 +311,9 @@ final class GSTMediaPlayer extends NativeMediaPlayer {
     private native long gstGetAudioSpectrum(long refNativeMedia);
     private native int gstGetAudioSyncDelay(long refNativeMedia, long[] syncDelay);
     private native int gstSetAudioSyncDelay(long refNativeMedia, long delay);
+    private native int gstGetStatistics(long refNativeMedia, long[] statistics);
+    private native int gstSetDecodePriority(long refNativeMedia, int priority);
+    private native int gstSetOutputSizeHint(long refNativeMedia, int width, int height);
     private native int gstPlay(long refNativeMedia);
     private native int gstPause(long refNativeMedia);
     private native int gstStop(long refNativeMedia);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 package com.sun.media.jfxmediaimpl.platform.osx;
 
 import com.sun.media.jfxmedia.MediaException;
+import com.sun.media.jfxmedia.MediaPlayerStatistics;
 import com.sun.media.jfxmedia.effects.AudioEqualizer;
 import com.sun.media.jfxmedia.effects.AudioSpectrum;
 import com.sun.media.jfxmedia.locator.Locator;
@@ -81,6 +82,22 @@ final class OSXMediaPlayer extends NativeMediaPlayer {
         osxSetAudioSyncDelay(delay);
     }
 
+    @Override
+    protected MediaPlayerStatistics playerGetStatistics() throws MediaException {
+        // AVFoundation playback does not collect pipeline statistics
+        return null;
+    }
+
+    @Override
+    protected void playerSetDecodePriority(int priority) throws MediaException {
+        // AVFoundation schedules its own decoding threads
+    }
+
+    @Override
+    protected void playerSetOutputSizeHint(int width, int height) throws MediaException {
+        // AVFoundation decodes at the size of the video
+    }
+
     @Override
     protected void playerPlay() throws MediaException {
         osxPlay();
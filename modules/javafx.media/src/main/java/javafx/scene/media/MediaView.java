@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -44,10 +44,12 @@ import javafx.beans.value.ChangeListener;
 import javafx.beans.value.ObservableObjectValue;
 import javafx.collections.ObservableMap;
 import javafx.event.EventHandler;
+import javafx.geometry.Bounds;
 import javafx.geometry.NodeOrientation;
 import javafx.geometry.Rectangle2D;
 import javafx.scene.Node;
 import javafx.scene.Parent;
+import javafx.stage.Window;
 
 /**
  * A {@link Node} that provides a view of {@link Media} being played by a
@@ -177,6 +179,101 @@ public class MediaView extends Node {
         }
     }
 
+    /* *************************************** Decode priority ************************* */
+
+    // Views covering at least this many pixels have their player decoded first
+    private static final double LARGE_VIEW_AREA = 640 * 360;
+
+    private int decodePriority = com.sun.media.jfxmedia.MediaPlayer.DECODE_PRIORITY_NORMAL;
+
+    private final InvalidationListener decodePriorityListener = value -> updateDecodePriority();
+
+    /**
+     * Lets players that are on screen, and large ones first, get decode time
+     * before hidden ones when many are playing. If several views show the
+     * same player, the last updated one sets its priority.
+     */
+    private void updateDecodePriority() {
+        MediaPlayer player = getMediaPlayer();
+        com.sun.media.jfxmedia.MediaPlayer jfxPlayer = (player == null) ? null : player.retrieveJfxPlayer();
+        if (jfxPlayer == null) {
+            return;
+        }
+
+        int priority;
+        if (getScene() == null || !NodeHelper.isTreeVisible(this)) {
+            priority = com.sun.media.jfxmedia.MediaPlayer.DECODE_PRIORITY_LOW;
+        } else {
+            Bounds bounds = getLayoutBounds();
+            priority = (bounds.getWidth() * bounds.getHeight() >= LARGE_VIEW_AREA)
+                    ? com.sun.media.jfxmedia.MediaPlayer.DECODE_PRIORITY_HIGH
+                    : com.sun.media.jfxmedia.MediaPlayer.DECODE_PRIORITY_NORMAL;
+        }
+        if (priority != decodePriority) {
+            decodePriority = priority;
+            jfxPlayer.setDecodePriority(priority);
+        }
+    }
+
+    /* *************************************** Output size hint ************************* */
+
+    private static final String PRESCALE_VIDEO_PROPERTY_NAME = "jfxmedia.prescaleVideo";
+
+    private static final boolean prescaleVideo = isPrescaleVideoEnabled();
+
+    private static boolean isPrescaleVideoEnabled() {
+        try {
+            return Boolean.getBoolean(PRESCALE_VIDEO_PROPERTY_NAME);
+        } catch (Throwable t) {
+            return false;
+        }
+    }
+
+    private int outputWidthHint = 0;
+    private int outputHeightHint = 0;
+
+    /**
+     * Tells the player how many pixels the video covers on screen, so that
+     * frames much larger than that can be scaled down before upload. Off
+     * unless jfxmedia.prescaleVideo is set, since every view sharing the
+     * player gets the frames of the last updated one.
+     */
+    private void updateOutputSizeHint() {
+        if (!prescaleVideo) {
+            return;
+        }
+        MediaPlayer player = getMediaPlayer();
+        com.sun.media.jfxmedia.MediaPlayer jfxPlayer = (player == null) ? null : player.retrieveJfxPlayer();
+        if (jfxPlayer == null || getScene() == null || !NodeHelper.isTreeVisible(this)) {
+            return;
+        }
+
+        Bounds bounds = getLayoutBounds();
+        double width = bounds.getWidth();
+        double height = bounds.getHeight();
+        Window window = getScene().getWindow();
+        if (window != null) {
+            width *= window.getRenderScaleX();
+            height *= window.getRenderScaleY();
+        }
+        // With a viewport only part of each frame is shown
+        Rectangle2D viewport = getViewport();
+        Media media = player.getMedia();
+        if (viewport != null && viewport.getWidth() > 0 && viewport.getHeight() > 0
+                && media.getWidth() > 0 && media.getHeight() > 0) {
+            width *= media.getWidth() / viewport.getWidth();
+            height *= media.getHeight() / viewport.getHeight();
+        }
+
+        int w = (int) Math.ceil(width);
+        int h = (int) Math.ceil(height);
+        if (w != outputWidthHint || h != outputHeightHint) {
+            outputWidthHint = w;
+            outputHeightHint = h;
+            jfxPlayer.setOutputSizeHint(w, h);
+        }
+    }
+
     /* *************************************** Media Player Overlay support ************************* */
 
     private MediaPlayerOverlay mediaPlayerOverlay = null;
@@ -309,6 +406,8 @@ public class MediaView extends Node {
         setSmooth(Toolkit.getToolkit().getDefaultImageSmooth());
         decodedFrameRateListener = createVideoFrameRateListener();
         setNodeOrientation(NodeOrientation.LEFT_TO_RIGHT);
+        sceneProperty().addListener(decodePriorityListener);
+        NodeHelper.treeVisibleProperty(this).addListener(decodePriorityListener);
     }
 
     /**
@@ -978,6 +1077,14 @@ public class MediaView extends Node {
             } else {
                 peer.setMediaProvider(null);
             }
+            decodePriority = com.sun.media.jfxmedia.MediaPlayer.DECODE_PRIORITY_NORMAL;
+            outputWidthHint = 0;
+            outputHeightHint = 0;
+        }
+        if (NodeHelper.isDirty(this, DirtyBits.NODE_VIEWPORT)
+                || NodeHelper.isDirty(this, DirtyBits.MEDIAVIEW_MEDIA)) {
+            updateDecodePriority();
+            updateOutputSizeHint();
         }
     }
 
@@ -1022,6 +1129,9 @@ public class MediaView extends Node {
     void _mediaPlayerOnReady() {
         com.sun.media.jfxmedia.MediaPlayer jfxPlayer = getMediaPlayer().retrieveJfxPlayer();
         if (jfxPlayer != null) {
+            updateDecodePriority();
+            updateOutputSizeHint();
+
             if (decodedFrameRateListener != null && registerVideoFrameRateListener) {
                 jfxPlayer.getVideoRenderControl().addVideoFrameRateListener(decodedFrameRateListener);
                 registerVideoFrameRateListener = false;
@@ -36,6 +36,16 @@
 
 #include "gst/glib-compat-private.h"
 
+#ifdef GSTREAMER_LITE
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define EQU_STEREO_SSE2
+#elif defined (__aarch64__) || defined (_M_ARM64)
+#include <arm_neon.h>
+#define EQU_STEREO_NEON
+#endif
+#endif // GSTREAMER_LITE
+
 GST_DEBUG_CATEGORY (equalizer_debug);
 #define GST_CAT_DEFAULT equalizer_debug
 
@@ -849,6 +859,117 @@ CREATE_OPTIMIZED_FUNCTIONS_INT (gint16, gfloat, -32768.0, 32767.0);
 CREATE_OPTIMIZED_FUNCTIONS (gfloat);
 CREATE_OPTIMIZED_FUNCTIONS (gdouble);
 
+#if defined (EQU_STEREO_SSE2) || defined (EQU_STEREO_NEON)
+#ifdef EQU_STEREO_SSE2
+typedef __m128d EquVector;
+#define equ_vector_dup(v)       _mm_set1_pd (v)
+#define equ_vector_set(l, r)    _mm_set_pd (r, l)
+#define equ_vector_add(a, b)    _mm_add_pd (a, b)
+#define equ_vector_mul(a, b)    _mm_mul_pd (a, b)
+#define equ_vector_round(v)     _mm_cvtps_pd (_mm_cvtpd_ps (v))
+#define equ_vector_load(p)      \
+    _mm_cvtps_pd (_mm_castsi128_ps (_mm_loadl_epi64 ((const __m128i *) (p))))
+#define equ_vector_store(p, v)  \
+    _mm_storel_epi64 ((__m128i *) (p), _mm_castps_si128 (_mm_cvtpd_ps (v)))
+#define equ_vector_get(p, v)    _mm_storeu_pd (p, v)
+#else // EQU_STEREO_NEON
+typedef float64x2_t EquVector;
+#define equ_vector_dup(v)       vdupq_n_f64 (v)
+#define equ_vector_set(l, r)    vcombine_f64 (vdup_n_f64 (l), vdup_n_f64 (r))
+#define equ_vector_add(a, b)    vaddq_f64 (a, b)
+#define equ_vector_mul(a, b)    vmulq_f64 (a, b)
+#define equ_vector_round(v)     vcvt_f64_f32 (vcvt_f32_f64 (v))
+#define equ_vector_load(p)      vcvt_f64_f32 (vld1_f32 (p))
+#define equ_vector_store(p, v)  vst1_f32 (p, vcvt_f32_f64 (v))
+#define equ_vector_get(p, v)    vst1q_f64 (p, v)
+#endif // EQU_STEREO_SSE2
+
+/* More bands than this go through the generic code */
+#define EQU_STEREO_MAX_BANDS 32
+
+typedef struct {
+  EquVector a0, a1, a2, b1, b2;
+  EquVector x1, x2, y1, y2;
+} StereoBandgfloat;
+
+/* Stereo float is what playback pipelines negotiate. Left and right go
+ * through each band together, with the same double precision arithmetic
+ * and float rounded history as gst_iir_equ_process_gfloat. */
+static void
+gst_iir_equ_process_gfloat_stereo (GstIirEqualizer * equ, guint8 * data,
+    guint size, guint channels)
+{
+  guint frames = size / 2 / sizeof (gfloat);
+  guint i, f, nf = equ->freq_band_count;
+  GstIirEqualizerBand **filters = equ->bands;
+  SecondOrderHistorygfloat *history = equ->history;
+  StereoBandgfloat bands[EQU_STEREO_MAX_BANDS];
+  gfloat *samples = (gfloat *) data;
+  gdouble values[2];
+
+  if (channels != 2 || nf > EQU_STEREO_MAX_BANDS) {
+    gst_iir_equ_process_gfloat (equ, data, size, channels);
+    return;
+  }
+
+  /* history holds all bands of the left channel, then the right one */
+  for (f = 0; f < nf; f++) {
+    StereoBandgfloat *band = &bands[f];
+    SecondOrderHistorygfloat *left = &history[f];
+    SecondOrderHistorygfloat *right = &history[nf + f];
+
+    band->a0 = equ_vector_dup (filters[f]->a0);
+    band->a1 = equ_vector_dup (filters[f]->a1);
+    band->a2 = equ_vector_dup (filters[f]->a2);
+    band->b1 = equ_vector_dup (filters[f]->b1);
+    band->b2 = equ_vector_dup (filters[f]->b2);
+    band->x1 = equ_vector_set (left->x1, right->x1);
+    band->x2 = equ_vector_set (left->x2, right->x2);
+    band->y1 = equ_vector_set (left->y1, right->y1);
+    band->y2 = equ_vector_set (left->y2, right->y2);
+  }
+
+  for (i = 0; i < frames; i++) {
+    EquVector cur = equ_vector_load (samples);
+    for (f = 0; f < nf; f++) {
+      StereoBandgfloat *band = &bands[f];
+      EquVector output = equ_vector_mul (band->a0, cur);
+      output = equ_vector_add (output, equ_vector_mul (band->a1, band->x1));
+      output = equ_vector_add (output, equ_vector_mul (band->a2, band->x2));
+      output = equ_vector_add (output, equ_vector_mul (band->b1, band->y1));
+      output = equ_vector_add (output, equ_vector_mul (band->b2, band->y2));
+      output = equ_vector_round (output);
+      band->y2 = band->y1;
+      band->y1 = output;
+      band->x2 = band->x1;
+      band->x1 = cur;
+      cur = output;
+    }
+    equ_vector_store (samples, cur);
+    samples += 2;
+  }
+
+  for (f = 0; f < nf; f++) {
+    StereoBandgfloat *band = &bands[f];
+    SecondOrderHistorygfloat *left = &history[f];
+    SecondOrderHistorygfloat *right = &history[nf + f];
+
+    equ_vector_get (values, band->x1);
+    left->x1 = values[0];
+    right->x1 = values[1];
+    equ_vector_get (values, band->x2);
+    left->x2 = values[0];
+    right->x2 = values[1];
+    equ_vector_get (values, band->y1);
+    left->y1 = values[0];
+    right->y1 = values[1];
+    equ_vector_get (values, band->y2);
+    left->y2 = values[0];
+    right->y2 = values[1];
+  }
+}
+#endif // EQU_STEREO_SSE2 || EQU_STEREO_NEON
+
 static GstFlowReturn
 gst_iir_equalizer_transform_ip (GstBaseTransform * btrans, GstBuffer * buf)
 {
@@ -908,6 +1029,11 @@ gst_iir_equalizer_setup (GstAudioFilter * audio, const GstAudioInfo * info)
       break;
     case GST_AUDIO_FORMAT_F32:
       equ->history_size = history_size_gfloat;
+#if defined (EQU_STEREO_SSE2) || defined (EQU_STEREO_NEON)
+      if (GST_AUDIO_INFO_CHANNELS (info) == 2)
+        equ->process = gst_iir_equ_process_gfloat_stereo;
+      else
+#endif // EQU_STEREO_SSE2 || EQU_STEREO_NEON
       equ->process = gst_iir_equ_process_gfloat;
       break;
     case GST_AUDIO_FORMAT_F64:
@@ -777,8 +777,16 @@ gst_spectrum_run_fft (GstSpectrum * spectrum, GstSpectrumChannel * cd,
   GstFFTF32Complex *freqdata = cd->freqdata;
   GstFFTF32 *fft_ctx = cd->fft_ctx;
 
+#ifdef GSTREAMER_LITE
+  /* input is a ring buffer, unroll it with two copies instead of a
+   * modulo per sample */
+  input_pos %= nfft;
+  memcpy (input_tmp, input + input_pos, (nfft - input_pos) * sizeof (gfloat));
+  memcpy (input_tmp + nfft - input_pos, input, input_pos * sizeof (gfloat));
+#else // GSTREAMER_LITE
   for (i = 0; i < nfft; i++)
     input_tmp[i] = input[(input_pos + i) % nfft];
+#endif // GSTREAMER_LITE
 
   gst_fft_f32_window (fft_ctx, input_tmp, GST_FFT_WINDOW_HAMMING);
 
@@ -786,11 +794,18 @@ gst_spectrum_run_fft (GstSpectrum * spectrum, GstSpectrumChannel * cd,
 
   if (spectrum->message_magnitude) {
     gdouble val;
+#ifdef GSTREAMER_LITE
+    gdouble scale = 1.0 / ((gdouble) nfft * nfft);
+#endif // GSTREAMER_LITE
     /* Calculate magnitude in db */
     for (i = 0; i < bands; i++) {
       val = freqdata[i].r * freqdata[i].r;
       val += freqdata[i].i * freqdata[i].i;
+#ifdef GSTREAMER_LITE
+      val *= scale;
+#else // GSTREAMER_LITE
       val /= nfft * nfft;
+#endif // GSTREAMER_LITE
       val = 10.0 * log10 (val);
       if (val < threshold)
         val = threshold;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -53,5 +53,12 @@
 // Not required since 58 and removed in 59
 #define NO_REGISTER_ALL        (LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(59,0,0))
 
+// avcodec_get_hw_config() and the hwcontext device API are available in 58
+// and up
+#define HW_DECODE              (LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(58,0,0))
+
+// Demuxed packets hold a reference counted "buf" in 56 and up
+#define PACKET_BUFFER_REF      (LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(56,0,0))
+
 #endif  /* AVDEFINES_H */
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -187,6 +187,10 @@ void basedecoder_close_decoder(BaseDecoder *decoder)
 {
     if (decoder->context)
     {
+#if HW_DECODE
+        // Not released by avcodec_close()
+        av_buffer_unref(&decoder->context->hw_device_ctx);
+#endif // HW_DECODE
         avcodec_close(decoder->context);
         av_free(decoder->context);
     }
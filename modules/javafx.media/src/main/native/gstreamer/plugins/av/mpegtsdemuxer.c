@@ -63,13 +63,17 @@ struct _MpegTSDemuxer
     AVElement         parent;
 
     GstPad            *sinkpad;
-    GstAdapter        *sink_adapter;
+    GstAtomicQueue    *sink_queue;      // Buffers handed from _chain() to the reader
+    GstAdapter        *sink_adapter;    // Owned by the reader thread
     guint             offset;
     gboolean          flush_adapter;
     GstFlowReturn     sink_result;
 
-    gint64            adapter_limit_size;
+    volatile gint     queued_bytes;     // Bytes in sink_queue and sink_adapter
+    volatile gint     adapter_limit_size;
     LimitType         adapter_limit_type;
+    volatile gint     chain_waiting;
+    volatile gint     reader_waiting;
 
     Stream            video;
     Stream            audio;
@@ -244,6 +248,7 @@ static void mpegts_demuxer_init(MpegTSDemuxer *demuxer)
     g_mutex_init(&demuxer->lock);
     g_cond_init(&demuxer->add_cond);
     g_cond_init(&demuxer->del_cond);
+    demuxer->sink_queue = gst_atomic_queue_new(32);
     demuxer->sink_adapter = gst_adapter_new();
     demuxer->reader_thread = NULL;
     demuxer->numpads = 0;
@@ -258,6 +263,7 @@ static void mpegts_demuxer_finalize(GObject *object)
     g_cond_clear(&demuxer->add_cond);
     g_cond_clear(&demuxer->del_cond);
     g_object_unref(demuxer->sink_adapter);
+    gst_atomic_queue_unref(demuxer->sink_queue);
 
     G_OBJECT_CLASS (parent_class)->finalize (object);
 }
@@ -343,24 +349,54 @@ static GstFlowReturn get_locked_result(MpegTSDemuxer *demuxer)
     return demuxer->sink_result;
 }
 
+/*
+ * Wakes up a thread waiting on cond. The waiting flag is set under the lock
+ * before the waiter checks its condition, so the lock is only taken when
+ * someone may be waiting.
+ */
+static inline void wake_waiting(MpegTSDemuxer *demuxer, volatile gint *waiting, GCond *cond)
+{
+    if (g_atomic_int_get(waiting))
+    {
+        g_mutex_lock(&demuxer->lock);
+        g_cond_signal(cond);
+        g_mutex_unlock(&demuxer->lock);
+    }
+}
+
+static inline gboolean over_limit(MpegTSDemuxer *demuxer, gsize size)
+{
+    return ((gint64)g_atomic_int_get(&demuxer->queued_bytes) + size) >= g_atomic_int_get(&demuxer->adapter_limit_size);
+}
+
 static GstFlowReturn mpegts_demuxer_chain(GstPad *pad, GstObject *parent, GstBuffer *buf)
 {
     MpegTSDemuxer *demuxer = MPEGTS_DEMUXER(parent);
+    gsize size = gst_buffer_get_size(buf);
 
-    g_mutex_lock(&demuxer->lock);
-
+    // Buffers are queued without the lock unless the reader is behind
     GstFlowReturn result = get_locked_result(demuxer);
-    while (((gint64)gst_adapter_available(demuxer->sink_adapter) + gst_buffer_get_size(buf)) >= demuxer->adapter_limit_size &&
-           result == GST_FLOW_OK)
+    if (result == GST_FLOW_OK && over_limit(demuxer, size))
     {
-        g_cond_wait(&demuxer->del_cond, &demuxer->lock);
+        g_mutex_lock(&demuxer->lock);
+        g_atomic_int_set(&demuxer->chain_waiting, TRUE);
+
         result = get_locked_result(demuxer);
+        while (over_limit(demuxer, size) && result == GST_FLOW_OK)
+        {
+            g_cond_wait(&demuxer->del_cond, &demuxer->lock);
+            result = get_locked_result(demuxer);
+        }
+
+        g_atomic_int_set(&demuxer->chain_waiting, FALSE);
+        g_mutex_unlock(&demuxer->lock);
     }
 
     if (result == GST_FLOW_OK)
     {
-        gst_adapter_push(demuxer->sink_adapter, buf);
-        g_cond_signal(&demuxer->add_cond);
+        g_atomic_int_add(&demuxer->queued_bytes, (gint)size);
+        gst_atomic_queue_push(demuxer->sink_queue, buf);
+        wake_waiting(demuxer, &demuxer->reader_waiting, &demuxer->add_cond);
     }
     else
     {
@@ -368,8 +404,6 @@ static GstFlowReturn mpegts_demuxer_chain(GstPad *pad, GstObject *parent, GstBuf
         gst_buffer_unref(buf);
     }
 
-    g_mutex_unlock(&demuxer->lock);
-
     return result;
 }
 
@@ -655,12 +689,33 @@ static void mpegts_demuxer_check_streams(MpegTSDemuxer *demuxer)
 /***********************************************************************************
  * Push functions
  ***********************************************************************************/
-static inline GstBuffer* packet_to_buffer(AVPacket *packet)
+#if PACKET_BUFFER_REF
+static void unref_packet_buffer(gpointer data)
 {
-    GstBuffer* result = gst_buffer_new_allocate(NULL, packet->size, NULL);
-    if (result != NULL)
-        gst_buffer_fill(result, 0, packet->data, packet->size);
-    return result;
+    AVBufferRef *ref = (AVBufferRef*)data;
+    av_buffer_unref(&ref);
+}
+#endif // PACKET_BUFFER_REF
+
+static GstBuffer* packet_to_buffer(AVPacket *packet)
+{
+#if PACKET_BUFFER_REF
+    // Wrap the demuxed data instead of copying it, the buffer keeps a reference.
+    if (packet->buf)
+    {
+        AVBufferRef *ref = av_buffer_ref(packet->buf);
+        if (ref != NULL)
+            return gst_buffer_new_wrapped_full(GST_MEMORY_FLAG_READONLY, packet->data, packet->size,
+                                               0, packet->size, ref, &unref_packet_buffer);
+    }
+#endif // PACKET_BUFFER_REF
+
+    void *buffer_data = av_mallocz(packet->size);
+    if (buffer_data == NULL)
+        return NULL;
+
+    memcpy(buffer_data, packet->data, packet->size);
+    return gst_buffer_new_wrapped_full(0, buffer_data, packet->size, 0, packet->size, buffer_data, &av_free);
 }
 
 static inline gboolean same_stream(MpegTSDemuxer *demuxer, Stream *stream, AVPacket *packet)
@@ -683,11 +738,9 @@ static GstFlowReturn process_video_packet(MpegTSDemuxer *demuxer, AVPacket *pack
     GstBuffer     *buffer = NULL;
 
     GstEvent *newsegment_event = NULL;
-    void *buffer_data = av_mallocz(packet->size);
-    if (buffer_data != NULL)
+    buffer = packet_to_buffer(packet);
+    if (buffer != NULL)
     {
-        memcpy(buffer_data, packet->data, packet->size);
-        buffer = gst_buffer_new_wrapped_full(0, buffer_data, packet->size, 0, packet->size, buffer_data, &av_free);
 
         if (packet->pts != AV_NOPTS_VALUE)
         {
@@ -763,7 +816,7 @@ static GstFlowReturn process_video_packet(MpegTSDemuxer *demuxer, AVPacket *pack
 
     if (result == GST_FLOW_OK)
         result = gst_pad_push(stream->sourcepad, buffer);
-    else
+    else if (buffer != NULL)
         gst_buffer_unref(buffer);
 
     return result;
@@ -779,12 +832,10 @@ static GstFlowReturn process_audio_packet(MpegTSDemuxer *demuxer, AVPacket *pack
 
     GstBuffer *buffer = NULL;
     GstEvent *newsegment_event = NULL;
-    void *buffer_data = av_mallocz(packet->size);
+    buffer = packet_to_buffer(packet);
 
-    if (buffer_data != NULL)
+    if (buffer != NULL)
     {
-        memcpy(buffer_data, packet->data, packet->size);
-        buffer = gst_buffer_new_wrapped_full(0, buffer_data, packet->size, 0, packet->size, buffer_data, &av_free);
 
         if (packet->pts != AV_NOPTS_VALUE)
         {
@@ -852,7 +903,7 @@ static GstFlowReturn process_audio_packet(MpegTSDemuxer *demuxer, AVPacket *pack
 
     if (result == GST_FLOW_OK)
         result = gst_pad_push(stream->sourcepad, buffer);
-    else
+    else if (buffer != NULL)
         gst_buffer_unref(buffer);
 
 #ifdef VERBOSE_DEBUG_AUDIO
@@ -981,7 +1032,7 @@ static gpointer mpegts_demuxer_process_input(gpointer data)
                 demuxer->context->pb = io_context;
 
                 demuxer->adapter_limit_type = UNLIMITED;
-                demuxer->adapter_limit_size = ADAPTER_LIMIT;
+                g_atomic_int_set(&demuxer->adapter_limit_size, ADAPTER_LIMIT);
 
                 AVInputFormat* iformat = av_find_input_format("mpegts");
 
@@ -994,8 +1045,10 @@ static gpointer mpegts_demuxer_process_input(gpointer data)
 
                 g_mutex_lock(&demuxer->lock);
                 gint available = gst_adapter_available(demuxer->sink_adapter);
+                gint consumed = available > demuxer->offset ? demuxer->offset : available;
                 demuxer->adapter_limit_type = LIMITED;
-                gst_adapter_flush(demuxer->sink_adapter, available > demuxer->offset ? demuxer->offset : available);
+                gst_adapter_flush(demuxer->sink_adapter, consumed);
+                g_atomic_int_add(&demuxer->queued_bytes, -consumed);
                 demuxer->flush_adapter = TRUE;
                 demuxer->offset = 0;
                 g_cond_signal(&demuxer->del_cond);
@@ -1037,44 +1090,73 @@ static gpointer mpegts_demuxer_process_input(gpointer data)
     return NULL;
 }
 
+/*
+ * Moves the buffers queued by _chain() to the adapter. Called on the reader
+ * thread only.
+ */
+static gint mpegts_demuxer_take_input(MpegTSDemuxer *demuxer)
+{
+    GstBuffer *buf;
+    while ((buf = (GstBuffer*)gst_atomic_queue_pop(demuxer->sink_queue)) != NULL)
+        gst_adapter_push(demuxer->sink_adapter, buf);
+
+    return gst_adapter_available(demuxer->sink_adapter);
+}
+
 static int mpegts_demuxer_read_packet(void *opaque, uint8_t *buffer, int size)
 {
     MpegTSDemuxer *demuxer = MPEGTS_DEMUXER(opaque);
     int result = 0;
 
-    g_mutex_lock(&demuxer->lock);
-    gint available = gst_adapter_available(demuxer->sink_adapter);
-    while (available < demuxer->offset + size &&
-           !demuxer->is_eos && !demuxer->is_flushing && demuxer->is_reading)
+    // Whatever is available is returned, the lock is only taken to wait for more.
+    gint available = mpegts_demuxer_take_input(demuxer);
+    if (available <= (gint)demuxer->offset &&
+        !demuxer->is_eos && !demuxer->is_flushing && demuxer->is_reading)
     {
-        if (demuxer->adapter_limit_type == UNLIMITED &&
-            demuxer->adapter_limit_size - LIMIT_STEP < demuxer->offset + size)
+        g_mutex_lock(&demuxer->lock);
+        g_atomic_int_set(&demuxer->reader_waiting, TRUE);
+
+        available = mpegts_demuxer_take_input(demuxer);
+        while (available <= (gint)demuxer->offset &&
+               !demuxer->is_eos && !demuxer->is_flushing && demuxer->is_reading)
         {
-            demuxer->adapter_limit_size += LIMIT_STEP;
-            g_cond_signal(&demuxer->del_cond);
+            if (demuxer->adapter_limit_type == UNLIMITED &&
+                g_atomic_int_get(&demuxer->adapter_limit_size) - LIMIT_STEP < (gint)demuxer->offset + size)
+            {
+                g_atomic_int_add(&demuxer->adapter_limit_size, LIMIT_STEP);
+                g_cond_signal(&demuxer->del_cond);
+            }
+            else
+                g_cond_wait(&demuxer->add_cond, &demuxer->lock);
+
+            available = mpegts_demuxer_take_input(demuxer);
         }
-        else
-            g_cond_wait(&demuxer->add_cond, &demuxer->lock);
 
-        available = gst_adapter_available(demuxer->sink_adapter);
+        g_atomic_int_set(&demuxer->reader_waiting, FALSE);
+        g_mutex_unlock(&demuxer->lock);
     }
 
     if (demuxer->is_reading && !demuxer->is_flushing)
     {
-        if (demuxer->is_eos && available <= size) {
+        gint remaining = available - (gint)demuxer->offset;
+        if (demuxer->is_eos && remaining <= size)
             demuxer->is_last_buffer_send = TRUE; // Last buffer
-            size = available;
-        }
+
+        if (size > remaining)
+            size = remaining;
 
         if (size > 0)
         {
             gst_adapter_copy(demuxer->sink_adapter, buffer, demuxer->offset, size);
             if (demuxer->flush_adapter)
+            {
                 gst_adapter_flush(demuxer->sink_adapter, size);
+                g_atomic_int_add(&demuxer->queued_bytes, -size);
+                wake_waiting(demuxer, &demuxer->chain_waiting, &demuxer->del_cond);
+            }
             else
                 demuxer->offset += size;
 
-            g_cond_signal(&demuxer->del_cond);
             result = size;
 
 #ifdef FAKE_ERROR
@@ -1085,8 +1167,6 @@ static int mpegts_demuxer_read_packet(void *opaque, uint8_t *buffer, int size)
     else
         result = 0; // No more data
 
-    g_mutex_unlock(&demuxer->lock);
-
 #ifdef DEBUG_OUTPUT
     if (result <= 0)
         g_print("MpegTS: read_packet result = %d, is_eos=%s, is_reading=%s, is_flushing=%s\n",
@@ -1117,8 +1197,7 @@ static int64_t mpegts_demuxer_seek(void *opaque, int64_t offset, int whence)
     MpegTSDemuxer *demuxer = MPEGTS_DEMUXER(opaque);
     int64_t result = -1;
 
-    g_mutex_lock(&demuxer->lock);
-    gint available = gst_adapter_available(demuxer->sink_adapter);
+    gint available = mpegts_demuxer_take_input(demuxer);
 
     if (whence == SEEK_SET && offset >= 0 && offset < available)
     {
@@ -1135,7 +1214,6 @@ static int64_t mpegts_demuxer_seek(void *opaque, int64_t offset, int whence)
 #endif
     }
 
-    g_mutex_unlock(&demuxer->lock);
     return result;
 }
 
@@ -1216,7 +1294,9 @@ static void mpegts_demuxer_init_state(MpegTSDemuxer *demuxer)
     demuxer->update = FALSE;
 
     demuxer->adapter_limit_type = UNLIMITED;
-    demuxer->adapter_limit_size = ADAPTER_LIMIT;
+    g_atomic_int_set(&demuxer->adapter_limit_size, ADAPTER_LIMIT);
+    demuxer->chain_waiting = FALSE;
+    demuxer->reader_waiting = FALSE;
 
     init_stream(&demuxer->video);
     init_stream(&demuxer->audio);
@@ -1234,7 +1314,11 @@ static void mpegts_demuxer_init_state(MpegTSDemuxer *demuxer)
 
 static void mpegts_demuxer_flush(MpegTSDemuxer *demuxer)
 {
+    GstBuffer *buf;
+    while ((buf = (GstBuffer*)gst_atomic_queue_pop(demuxer->sink_queue)) != NULL)
+        gst_buffer_unref(buf);
     gst_adapter_clear(demuxer->sink_adapter);
+    g_atomic_int_set(&demuxer->queued_bytes, 0);
 
     demuxer->offset = 0;
     demuxer->flush_adapter = FALSE;
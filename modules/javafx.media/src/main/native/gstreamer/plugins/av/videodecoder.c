@@ -45,6 +45,9 @@ enum
     PROP_0,
     PROP_CODEC_ID,
     PROP_IS_SUPPORTED,
+    PROP_HW_DEVICE,
+    PROP_OUTPUT_WIDTH,
+    PROP_OUTPUT_HEIGHT,
 };
 
 /*
@@ -118,6 +121,10 @@ static GstFlowReturn        videodecoder_chain(GstPad *pad, GstObject *parent, G
 
 static void                 videodecoder_init_state(VideoDecoder *decoder);
 static void                 videodecoder_state_reset(VideoDecoder *decoder);
+static void                 videodecoder_drain(VideoDecoder *decoder);
+static void                 videodecoder_init_context(BaseDecoder *base);
+static void                 videodecoder_release_threads(VideoDecoder *decoder);
+static void                 (*parent_init_context)(BaseDecoder *base) = NULL;
 
 static gboolean videodecoder_configure(VideoDecoder *decoder, GstCaps *sink_caps);
 
@@ -147,6 +154,9 @@ static void videodecoder_class_init(VideoDecoderClass *klass)
     gobject_class->set_property = videodecoder_set_property;
     gobject_class->get_property = videodecoder_get_property;
 
+    parent_init_context = BASEDECODER_CLASS(klass)->init_context;
+    BASEDECODER_CLASS(klass)->init_context = videodecoder_init_context;
+
     g_object_class_install_property (gobject_class, PROP_CODEC_ID,
         g_param_spec_int ("codec-id", "Codec ID", "Codec ID", -1, G_MAXINT, 0,
         (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
@@ -154,6 +164,21 @@ static void videodecoder_class_init(VideoDecoderClass *klass)
     g_object_class_install_property (gobject_class, PROP_IS_SUPPORTED,
         g_param_spec_boolean ("is-supported", "Is supported", "Is codec ID supported", FALSE,
         (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property (gobject_class, PROP_HW_DEVICE,
+        g_param_spec_string ("hw-device", "Hardware device",
+        "Hardware decoding device type such as \"vaapi\" or \"vdpau\", NULL for software decoding", NULL,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property (gobject_class, PROP_OUTPUT_WIDTH,
+        g_param_spec_int ("output-width", "Output width",
+        "Width the video is displayed at, 0 if unknown. Much larger frames are scaled down", 0, G_MAXINT, 0,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property (gobject_class, PROP_OUTPUT_HEIGHT,
+        g_param_spec_int ("output-height", "Output height",
+        "Height the video is displayed at, 0 if unknown. Much larger frames are scaled down", 0, G_MAXINT, 0,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
 }
 
 static void videodecoder_init(VideoDecoder *decoder)
@@ -170,10 +195,21 @@ static void videodecoder_init(VideoDecoder *decoder)
     base->srcpad = gst_pad_new_from_static_template(&source_template, "src");
     gst_pad_use_fixed_caps(base->srcpad);
     gst_element_add_pad(GST_ELEMENT(decoder), base->srcpad);
+
+    // Hardware decoding is opt-in, the property overrides the environment.
+    decoder->hw_device = g_strdup(g_getenv(VIDEODECODER_HW_DEVICE_ENV));
 }
 
 void videodecoder_close_decoder(VideoDecoder *decoder)
 {
+#if HW_DECODE
+    if (decoder->transfer_frame)
+    {
+        av_frame_free(&decoder->transfer_frame);
+        decoder->transfer_frame = NULL;
+    }
+#endif // HW_DECODE
+
 #if HEVC_SUPPORT
     if (decoder->dest_frame)
     {
@@ -200,6 +236,20 @@ static void videodecoder_dispose(GObject* object)
     VideoDecoder *decoder = VIDEODECODER(object);
 
     basedecoder_close_decoder(decoder);
+    videodecoder_release_threads(decoder);
+#if HW_DECODE
+    if (decoder->transfer_frame)
+    {
+        av_frame_free(&decoder->transfer_frame);
+        decoder->transfer_frame = NULL;
+    }
+#endif // HW_DECODE
+
+    if (decoder->hw_device)
+    {
+        g_free(decoder->hw_device);
+        decoder->hw_device = NULL;
+    }
 
     G_OBJECT_CLASS(parent_class)->dispose(object);
 }
@@ -234,6 +284,16 @@ static void videodecoder_set_property(GObject *object, guint property_id, const
     case PROP_CODEC_ID:
         decoder->codec_id = g_value_get_int(value);
         break;
+    case PROP_HW_DEVICE:
+        g_free(decoder->hw_device);
+        decoder->hw_device = g_value_dup_string(value);
+        break;
+    case PROP_OUTPUT_WIDTH:
+        g_atomic_int_set(&decoder->output_width, g_value_get_int(value));
+        break;
+    case PROP_OUTPUT_HEIGHT:
+        g_atomic_int_set(&decoder->output_height, g_value_get_int(value));
+        break;
     default:
         break;
     }
@@ -249,11 +309,159 @@ static void videodecoder_get_property(GObject *object, guint property_id, GValue
         is_supported = videodecoder_is_decoder_by_codec_id_supported(decoder->codec_id);
         g_value_set_boolean(value, is_supported);
         break;
+    case PROP_HW_DEVICE:
+        g_value_set_string(value, decoder->hw_device);
+        break;
+    case PROP_OUTPUT_WIDTH:
+        g_value_set_int(value, g_atomic_int_get(&decoder->output_width));
+        break;
+    case PROP_OUTPUT_HEIGHT:
+        g_value_set_int(value, g_atomic_int_get(&decoder->output_height));
+        break;
     default:
         break;
     }
 }
 
+/***********************************************************************************
+ * Decoding threads and hardware decoding
+ ***********************************************************************************/
+#if HW_DECODE
+static enum AVPixelFormat videodecoder_get_format(AVCodecContext *context, const enum AVPixelFormat *formats)
+{
+    VideoDecoder *decoder = VIDEODECODER(context->opaque);
+    const enum AVPixelFormat *format = NULL;
+
+    for (format = formats; *format != AV_PIX_FMT_NONE; format++)
+    {
+        if (*format == decoder->hw_pix_fmt)
+            return *format;
+    }
+
+    // Profile is not supported by the device, decode in software.
+    decoder->hw_pix_fmt = AV_PIX_FMT_NONE;
+    return avcodec_default_get_format(context, formats);
+}
+
+static gboolean videodecoder_init_hw_device(VideoDecoder *decoder)
+{
+    BaseDecoder *base = BASEDECODER(decoder);
+    enum AVHWDeviceType type = AV_HWDEVICE_TYPE_NONE;
+    const AVCodecHWConfig *config = NULL;
+    int i = 0;
+
+    if (decoder->hw_device == NULL || *decoder->hw_device == '\0')
+        return FALSE;
+
+    type = av_hwdevice_find_type_by_name(decoder->hw_device);
+    if (type == AV_HWDEVICE_TYPE_NONE)
+        return FALSE;
+
+    for (i = 0; (config = avcodec_get_hw_config(base->codec, i)) != NULL; i++)
+    {
+        if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) &&
+            config->device_type == type)
+            break;
+    }
+
+    if (config == NULL)
+        return FALSE;
+
+    if (av_hwdevice_ctx_create(&base->context->hw_device_ctx, type, NULL, NULL, 0) < 0)
+    {
+#ifdef DEBUG_OUTPUT
+        g_print("videodecoder: %s device is not available\n", decoder->hw_device);
+#endif
+        return FALSE;
+    }
+
+    decoder->hw_pix_fmt = config->pix_fmt;
+    base->context->opaque = decoder;
+    base->context->get_format = videodecoder_get_format;
+
+    return TRUE;
+}
+
+/*
+ * Copies a frame decoded in hardware back to system memory, since the frames
+ * are uploaded to textures from there further down the pipeline.
+ */
+static gboolean videodecoder_transfer_hw_frame(VideoDecoder *decoder)
+{
+    BaseDecoder *base = BASEDECODER(decoder);
+    AVFrame *frame = NULL;
+
+    if (decoder->hw_pix_fmt == AV_PIX_FMT_NONE || base->frame->format != decoder->hw_pix_fmt)
+        return TRUE;
+
+    if (decoder->transfer_frame == NULL)
+    {
+        decoder->transfer_frame = av_frame_alloc();
+        if (decoder->transfer_frame == NULL)
+            return FALSE;
+    }
+    else
+    {
+        av_frame_unref(decoder->transfer_frame);
+    }
+
+    if (av_hwframe_transfer_data(decoder->transfer_frame, base->frame, 0) < 0 ||
+        av_frame_copy_props(decoder->transfer_frame, base->frame) < 0)
+        return FALSE;
+
+    // Keep the hardware frame as the spare one; it is unreferenced on the
+    // next transfer or by the next decoded frame.
+    frame = base->frame;
+    base->frame = decoder->transfer_frame;
+    decoder->transfer_frame = frame;
+
+    return TRUE;
+}
+#endif // HW_DECODE
+
+/*
+ * Number of software decoders holding decoding threads. The processors are
+ * shared among them, so that a video wall of many players does not start
+ * a full set of threads per decoder. A decoder keeps the threads it was
+ * opened with.
+ */
+static volatile gint threaded_decoders = 0;
+
+static void videodecoder_release_threads(VideoDecoder *decoder)
+{
+    if (decoder->holds_threads)
+    {
+        g_atomic_int_add(&threaded_decoders, -1);
+        decoder->holds_threads = FALSE;
+    }
+}
+
+static void videodecoder_init_context(BaseDecoder *base)
+{
+    VideoDecoder *decoder = VIDEODECODER(base);
+
+    parent_init_context(base);
+
+#if HW_DECODE
+    // Hardware decoders do not benefit from decoding threads.
+    if (videodecoder_init_hw_device(decoder))
+        return;
+#endif // HW_DECODE
+
+    videodecoder_release_threads(decoder);
+    gint decoders = g_atomic_int_add(&threaded_decoders, 1) + 1;
+    decoder->holds_threads = TRUE;
+
+    base->context->thread_count = CLAMP(g_get_num_processors() / decoders, 1, VIDEODECODER_MAX_THREADS);
+#if USE_SEND_RECEIVE
+    // Frame threading delays output by a frame per thread, the delayed frames
+    // are drained at end of stream.
+    base->context->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+#else
+    base->context->thread_type = FF_THREAD_SLICE;
+#endif // USE_SEND_RECEIVE
+}
+
 /***********************************************************************************
  * State change handler
  ***********************************************************************************/
@@ -284,6 +492,14 @@ videodecoder_change_state(GstElement* element, GstStateChange transition)
     {
         case GST_STATE_CHANGE_PAUSED_TO_READY:
             basedecoder_close_decoder(BASEDECODER(decoder));
+            videodecoder_release_threads(decoder);
+#if HW_DECODE
+            if (decoder->transfer_frame)
+            {
+                av_frame_free(&decoder->transfer_frame);
+                decoder->transfer_frame = NULL;
+            }
+#endif // HW_DECODE
             break;
         default:
             break;
@@ -333,6 +549,11 @@ static gboolean videodecoder_sink_event(GstPad *pad, GstObject *parent, GstEvent
             break;
         }
 
+        case GST_EVENT_EOS:
+            // Push the frames still held by the decoding threads.
+            videodecoder_drain(decoder);
+            break;
+
 #ifdef DEBUG_OUTPUT
         case GST_EVENT_SEGMENT:
         {
@@ -375,7 +596,15 @@ static void videodecoder_init_state(VideoDecoder *decoder)
     decoder->sws_getContext_func = NULL;
     decoder->sws_freeContext_func = NULL;
     decoder->sws_scale_func = NULL;
+    decoder->swscale_missing = FALSE;
+    decoder->frame_format = AV_PIX_FMT_NONE;
+    decoder->scaled_width = 0;
+    decoder->scaled_height = 0;
 #endif // HEVC_SUPPORT
+#if HW_DECODE
+    decoder->hw_pix_fmt = AV_PIX_FMT_NONE;
+    decoder->transfer_frame = NULL;
+#endif // HW_DECODE
 
     basedecoder_init_state(BASEDECODER(decoder));
 }
@@ -401,6 +630,7 @@ static gboolean videodecoder_configure(VideoDecoder *decoder, GstCaps *sink_caps
             videodecoder_state_reset(decoder);
             basedecoder_close_decoder(BASEDECODER(decoder));
             videodecoder_close_decoder(decoder);
+            videodecoder_release_threads(decoder);
             videodecoder_init_state(decoder);
         }
     }
@@ -445,56 +675,123 @@ static void videodecoder_state_reset(VideoDecoder *decoder)
 }
 
 #if HEVC_SUPPORT
-static gboolean videodecoder_init_converter(VideoDecoder *decoder)
+// Pixel formats pushed downstream as decoded, all others are converted to
+// YUV420P. 10-bit 4:2:0 (H.265/HEVC Main 10) is sampled by the renderer.
+static gboolean videodecoder_is_direct_format(int format)
 {
-    BaseDecoder *base = BASEDECODER(decoder);
+    return format == AV_PIX_FMT_YUV420P || format == AV_PIX_FMT_YUV420P10LE;
+}
+
+// Frames are converted when they cannot be pushed as decoded or are scaled down
+static gboolean videodecoder_needs_conversion(VideoDecoder *decoder, int format)
+{
+    return !videodecoder_is_direct_format(format) || decoder->scaled_width != 0;
+}
+
+/*
+ * Loads libswscale. Errors are only posted when converting is required,
+ * scaling down is skipped without the library.
+ */
+static gboolean videodecoder_load_swscale(VideoDecoder *decoder, gboolean post_errors)
+{
+    if (decoder->sws_scale_func != NULL)
+        return TRUE;
+
+    if (decoder->swscale_missing && !post_errors)
+        return FALSE;
+
+    // Marked missing until all functions are found
+    decoder->swscale_missing = TRUE;
 
-    // Load libswscale
     if (decoder->swscale_module == NULL)
-    {
         decoder->swscale_module = dlopen("libswscale.so", RTLD_LAZY);
-        if (decoder->swscale_module == NULL)
-        {
-            // Halt playback, since we cannot continue and post user
-            // friendly error message that libswscale is required
+
+    if (decoder->swscale_module == NULL)
+    {
+        // Halt playback, since we cannot continue and post user
+        // friendly error message that libswscale is required
+        if (post_errors)
             gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
                     JFX_GST_ERROR, JFX_GST_MISSING_LIBSWSCALE,
-                    g_strdup("Error: libswscale is required for H.265/HEVC 10/12-bit decoding"), NULL,
+                    g_strdup("Error: libswscale is required for H.265/HEVC 4:2:2, 4:4:4 and 12-bit decoding"), NULL,
                     ("videodecoder.c"), ("videodecoder_init_converter"), 0);
-            return FALSE;
-        }
+        return FALSE;
+    }
 
-        decoder->sws_getContext_func = dlsym(decoder->swscale_module, "sws_getContext");
-        if (!decoder->sws_getContext_func)
-        {
+    decoder->sws_getContext_func = dlsym(decoder->swscale_module, "sws_getContext");
+    if (!decoder->sws_getContext_func)
+    {
+        if (post_errors)
             gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
                     JFX_GST_ERROR, JFX_GST_INVALID_LIBSWSCALE,
                     g_strdup("Error: Failed to find \"sws_getContext()\" in libswscale"), NULL,
                     ("videodecoder.c"), ("videodecoder_init_converter"), 0);
-            return FALSE;
-        }
+        return FALSE;
+    }
 
-        decoder->sws_freeContext_func = dlsym(decoder->swscale_module, "sws_freeContext");
-        if (!decoder->sws_freeContext_func)
-        {
+    decoder->sws_freeContext_func = dlsym(decoder->swscale_module, "sws_freeContext");
+    if (!decoder->sws_freeContext_func)
+    {
+        if (post_errors)
             gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
                     JFX_GST_ERROR, JFX_GST_INVALID_LIBSWSCALE,
                     g_strdup("Error: Failed to find \"sws_freeContext()\" in libswscale"), NULL,
                     ("videodecoder.c"), ("videodecoder_init_converter"), 0);
-            return FALSE;
-        }
+        return FALSE;
+    }
 
-        decoder->sws_scale_func = dlsym(decoder->swscale_module, "sws_scale");
-        if (!decoder->sws_scale_func)
-        {
+    decoder->sws_scale_func = dlsym(decoder->swscale_module, "sws_scale");
+    if (!decoder->sws_scale_func)
+    {
+        if (post_errors)
             gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
                     JFX_GST_ERROR, JFX_GST_INVALID_LIBSWSCALE,
                     g_strdup("Error: Failed to find \"sws_scale()\" in libswscale"), NULL,
                     ("videodecoder.c"), ("videodecoder_init_converter"), 0);
-            return FALSE;
-        }
+        return FALSE;
     }
 
+    decoder->swscale_missing = FALSE;
+    return TRUE;
+}
+
+/*
+ * Sets scaled_width and scaled_height from the output size hint. Frames are
+ * halved while they still cover the hint, so a 4K video shown as a thumbnail
+ * is pushed at a fraction of its size, and resizing the view only changes
+ * the output size when it crosses a power of two.
+ */
+static void videodecoder_update_scaled_size(VideoDecoder *decoder, int width, int height)
+{
+    gint output_width = g_atomic_int_get(&decoder->output_width);
+    gint output_height = g_atomic_int_get(&decoder->output_height);
+    int shift = 0;
+
+    decoder->scaled_width = decoder->scaled_height = 0;
+
+    if (output_width <= 0 || output_height <= 0)
+        return;
+
+    while ((width >> (shift + 1)) >= output_width && (height >> (shift + 1)) >= output_height)
+        shift++;
+
+    if (shift == 0 || !videodecoder_load_swscale(decoder, FALSE))
+        return;
+
+    // Even sizes keep the chroma planes of 4:2:0 whole
+    decoder->scaled_width = MAX((width >> shift) & ~1, 2);
+    decoder->scaled_height = MAX((height >> shift) & ~1, 2);
+}
+
+static gboolean videodecoder_init_converter(VideoDecoder *decoder)
+{
+    BaseDecoder *base = BASEDECODER(decoder);
+    int dest_width = decoder->scaled_width ? decoder->scaled_width : decoder->width;
+    int dest_height = decoder->scaled_height ? decoder->scaled_height : decoder->height;
+
+    if (!videodecoder_load_swscale(decoder, TRUE))
+        return FALSE;
+
     if (decoder->dest_frame)
     {
         av_frame_free(&decoder->dest_frame);
@@ -509,9 +806,10 @@ static gboolean videodecoder_init_converter(VideoDecoder *decoder)
 
     decoder->sws_context =
             decoder->sws_getContext_func(decoder->width, decoder->height,
-                                         base->frame->format, decoder->width,
-                                         decoder->height, AV_PIX_FMT_YUV420P,
-                                         SWS_BILINEAR, NULL, NULL, NULL);
+                                         base->frame->format, dest_width,
+                                         dest_height, AV_PIX_FMT_YUV420P,
+                                         decoder->scaled_width ? SWS_AREA : SWS_BILINEAR,
+                                         NULL, NULL, NULL);
 
     if (decoder->sws_context == NULL)
         return FALSE;
@@ -521,8 +819,8 @@ static gboolean videodecoder_init_converter(VideoDecoder *decoder)
         return FALSE;
 
     decoder->dest_frame->format = AV_PIX_FMT_YUV420P;
-    decoder->dest_frame->width  = decoder->width;
-    decoder->dest_frame->height = decoder->height;
+    decoder->dest_frame->width  = dest_width;
+    decoder->dest_frame->height = dest_height;
     int ret = av_frame_get_buffer(decoder->dest_frame, 32);
     if (ret < 0)
     {
@@ -567,6 +865,10 @@ static gboolean videodecoder_configure_sourcepad(VideoDecoder *decoder)
     int linesize0 = 0;
     int linesize1 = 0;
     int linesize2 = 0;
+    int out_width = 0;
+    int out_height = 0;
+
+    const gchar *format = "YV12";
 
     GstCaps *caps = gst_pad_get_current_caps(base->srcpad);
 
@@ -578,17 +880,38 @@ static gboolean videodecoder_configure_sourcepad(VideoDecoder *decoder)
     int height = base->context->height;
 #endif // NEW_CODEC_ID
 
+#if HEVC_SUPPORT
+    int scaled_width = decoder->scaled_width;
+    int scaled_height = decoder->scaled_height;
+    videodecoder_update_scaled_size(decoder, width, height);
+#endif // HEVC_SUPPORT
+
     if (caps == NULL ||
-        decoder->width != width || decoder->height != height)
+        decoder->width != width || decoder->height != height
+#if HEVC_SUPPORT
+        // Hardware decoding may fall back to software, which changes format
+        || decoder->frame_format != base->frame->format
+        || decoder->scaled_width != scaled_width || decoder->scaled_height != scaled_height
+#endif // HEVC_SUPPORT
+        )
     {
         decoder->width = width;
         decoder->height = height;
-
+        out_width = width;
+        out_height = height;
 #if HEVC_SUPPORT
-    // Setup scaler and color converter if pixel format is not AV_PIX_FMT_YUV420P.
+        decoder->frame_format = base->frame->format;
+
+    if (base->frame->format == AV_PIX_FMT_YUV420P10LE && decoder->scaled_width == 0)
+        format = "YV12_10LE";
+
+    // Deblocking frames that are not referenced does not show once scaled down
+    base->context->skip_loop_filter = decoder->scaled_width ? AVDISCARD_NONREF : AVDISCARD_DEFAULT;
+
+    // Setup scaler and color converter if pixel format cannot be pushed as is.
     // We will get different pixel format for H.265 10-bit such as
-    // AV_PIX_FMT_YUV422P10LE. Scaling should not happen if resolution is same.
-    if (base->frame->format != AV_PIX_FMT_YUV420P)
+    // AV_PIX_FMT_YUV422P10LE. Scaling only happens for the output size hint.
+    if (videodecoder_needs_conversion(decoder, base->frame->format))
     {
         if (!videodecoder_init_converter(decoder))
         {
@@ -612,6 +935,8 @@ static gboolean videodecoder_configure_sourcepad(VideoDecoder *decoder)
         linesize0 = decoder->dest_frame->linesize[0];
         linesize1 = decoder->dest_frame->linesize[1];
         linesize2 = decoder->dest_frame->linesize[2];
+        out_width = decoder->dest_frame->width;
+        out_height = decoder->dest_frame->height;
 
         set_linesize = FALSE;
     }
@@ -626,16 +951,16 @@ static gboolean videodecoder_configure_sourcepad(VideoDecoder *decoder)
             linesize2 = base->frame->linesize[2];
         }
 
-        decoder->u_offset = linesize0 * decoder->height;
-        decoder->uv_blocksize = linesize1 * decoder->height / 2;
+        decoder->u_offset = linesize0 * out_height;
+        decoder->uv_blocksize = linesize1 * out_height / 2;
 
         decoder->v_offset = decoder->u_offset + decoder->uv_blocksize;
-        decoder->frame_size = (linesize0 + linesize1) * decoder->height;
+        decoder->frame_size = (linesize0 + linesize1) * out_height;
 
         GstCaps *src_caps = gst_caps_new_simple("video/x-raw-yuv",
-                                                "format", G_TYPE_STRING, "YV12",
-                                                "width", G_TYPE_INT, decoder->width,
-                                                "height", G_TYPE_INT, decoder->height,
+                                                "format", G_TYPE_STRING, format,
+                                                "width", G_TYPE_INT, out_width,
+                                                "height", G_TYPE_INT, out_height,
                                                 "stride-y", G_TYPE_INT, linesize0,
                                                 "stride-u", G_TYPE_INT, linesize1,
                                                 "stride-v", G_TYPE_INT, linesize2,
@@ -669,15 +994,11 @@ static gboolean videodecoder_configure_sourcepad(VideoDecoder *decoder)
 /***********************************************************************************
  * chain
  ***********************************************************************************/
-static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffer *buf)
+static GstFlowReturn videodecoder_push_frame(VideoDecoder *decoder, GstClockTime duration, gboolean discont)
 {
-    VideoDecoder  *decoder = VIDEODECODER(parent);
     BaseDecoder   *base = BASEDECODER(decoder);
     GstFlowReturn  result = GST_FLOW_OK;
-    int            num_dec = NO_DATA_USED;
-    GstMapInfo     info;
     GstMapInfo     info2;
-    gboolean       unmap_buf = FALSE;
     gboolean       set_frame_values = TRUE;
     int64_t        reordered_opaque = AV_NOPTS_VALUE;
     unsigned int   out_buf_size = 0;
@@ -686,6 +1007,233 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
     uint8_t*       data1 = NULL;
     uint8_t*       data2 = NULL;
 
+#if HW_DECODE
+    if (!videodecoder_transfer_hw_frame(decoder))
+    {
+        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
+                                 GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
+                                 g_strdup("Hardware video frame transfer failed"), NULL,
+                                 ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+        return GST_FLOW_ERROR;
+    }
+#endif // HW_DECODE
+
+    if (!videodecoder_configure_sourcepad(decoder))
+        return GST_FLOW_ERROR;
+
+#if HEVC_SUPPORT
+    // Check to see if we need to convert frame to YUV420p
+    if (videodecoder_needs_conversion(decoder, base->frame->format))
+    {
+        if (!videodecoder_convert_frame(decoder))
+        {
+            gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
+                                     GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
+                                     g_strdup("Video frame conversion failed"), NULL,
+                                     ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+
+            return GST_FLOW_ERROR;
+        }
+
+        reordered_opaque = decoder->dest_frame->reordered_opaque;
+        data0 = decoder->dest_frame->data[0];
+        data1 = decoder->dest_frame->data[1];
+        data2 = decoder->dest_frame->data[2];
+        set_frame_values = FALSE;
+    }
+#endif // HEVC_SUPPORT
+
+    if (set_frame_values)
+    {
+        reordered_opaque = base->frame->reordered_opaque;
+        data0 = base->frame->data[0];
+        data1 = base->frame->data[1];
+        data2 = base->frame->data[2];
+    }
+
+    GstBuffer *outbuf = gst_buffer_new_allocate(NULL, decoder->frame_size, NULL);
+    if (outbuf == NULL)
+    {
+        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
+                                 GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
+                                 g_strdup("Decoded video buffer allocation failed"), NULL,
+                                 ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+        return GST_FLOW_OK;
+    }
+
+    GST_BUFFER_OFFSET(outbuf) = base->context->frame_number;
+    if (reordered_opaque != AV_NOPTS_VALUE)
+    {
+        GST_BUFFER_TIMESTAMP(outbuf) = reordered_opaque;
+        GST_BUFFER_DURATION(outbuf) = duration; // Duration for video usually same
+    }
+
+    if (!gst_buffer_map(outbuf, &info2, GST_MAP_WRITE))
+    {
+        // INLINE - gst_buffer_unref()
+        gst_buffer_unref(outbuf);
+        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                         g_strdup("Decoded video buffer allocation failed"), NULL, ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+        return GST_FLOW_OK;
+    }
+
+    // Copy image by parts from different arrays.
+    if (decoder->frame_size > (unsigned int)info2.maxsize) // maxsize should be same or more due to alignment
+    {
+        gst_buffer_unmap(outbuf, &info2);
+        // INLINE - gst_buffer_unref()
+        gst_buffer_unref(outbuf);
+        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                         g_strdup("Wrong buffer size"), NULL, ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+        return GST_FLOW_OK;
+    }
+
+    out_buf_size = decoder->frame_size;
+    if (out_buf_size >= decoder->u_offset)
+    {
+        memcpy(info2.data, data0, decoder->u_offset);
+        out_buf_size -= decoder->u_offset;
+        if (out_buf_size >= decoder->uv_blocksize &&
+            decoder->uv_blocksize <= decoder->frame_size &&
+            decoder->u_offset <= (decoder->frame_size - decoder->uv_blocksize))
+        {
+            memcpy(info2.data + decoder->u_offset, data1, decoder->uv_blocksize);
+            out_buf_size -= decoder->uv_blocksize;
+            if (out_buf_size >= decoder->uv_blocksize &&
+                decoder->uv_blocksize <= decoder->frame_size &&
+                decoder->v_offset <= (decoder->frame_size - decoder->uv_blocksize))
+            {
+                memcpy(info2.data + decoder->v_offset, data2, decoder->uv_blocksize);
+            }
+            else
+            {
+                copy_error = TRUE;
+            }
+        }
+        else
+        {
+            copy_error = TRUE;
+        }
+    }
+    else
+    {
+        copy_error = TRUE;
+    }
+
+    gst_buffer_unmap(outbuf, &info2);
+
+    if (copy_error)
+    {
+        // INLINE - gst_buffer_unref()
+        gst_buffer_unref(outbuf);
+        gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                         g_strdup("Copy data failed"), NULL, ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+        return GST_FLOW_OK;
+    }
+
+    GST_BUFFER_OFFSET_END(outbuf) = GST_BUFFER_OFFSET_NONE;
+
+    if (decoder->discont || discont)
+    {
+#ifdef DEBUG_OUTPUT
+        g_print("Video discont: frame size=%dx%d\n", base->context->width, base->context->height);
+#endif
+        GST_BUFFER_FLAG_SET(outbuf, GST_BUFFER_FLAG_DISCONT);
+        decoder->discont = FALSE;
+    }
+
+
+#ifdef VERBOSE_DEBUG
+    g_print("videodecoder: pushing buffer ts=%.4f, duration=%.4f\n",
+        GST_BUFFER_TIMESTAMP_IS_VALID(outbuf) ? (double)GST_BUFFER_TIMESTAMP(outbuf)/GST_SECOND : -1.0,
+        GST_BUFFER_DURATION_IS_VALID(outbuf) ? (double)GST_BUFFER_DURATION(outbuf)/GST_SECOND : -1.0);
+#endif
+    result = gst_pad_push(base->srcpad, outbuf);
+#ifdef VERBOSE_DEBUG
+    g_print(" done, res=%s\n", gst_flow_get_name(result));
+#endif
+
+    return result;
+}
+
+/*
+ * Decodes one packet, or drains the decoder when packet is NULL, and pushes
+ * the frames it completes. With frame threading a packet can complete no
+ * frame or several.
+ */
+static GstFlowReturn videodecoder_decode_packet(VideoDecoder *decoder, AVPacket *packet,
+                                                GstClockTime duration, gboolean discont)
+{
+    BaseDecoder   *base = BASEDECODER(decoder);
+    GstFlowReturn  result = GST_FLOW_OK;
+    int            num_dec = NO_DATA_USED;
+
+#if USE_SEND_RECEIVE
+    num_dec = avcodec_send_packet(base->context, packet);
+    while (num_dec == 0 && result == GST_FLOW_OK)
+    {
+        num_dec = avcodec_receive_frame(base->context, base->frame);
+        if (num_dec == 0)
+        {
+            decoder->frame_finished = 1;
+            result = videodecoder_push_frame(decoder, duration, discont);
+            discont = FALSE;
+        }
+        else
+        {
+            decoder->frame_finished = 0;
+        }
+    }
+
+    // Running out of frames is not an error
+    if (num_dec == AVERROR(EAGAIN) || num_dec == AVERROR_EOF)
+        num_dec = 0;
+#else
+    if (packet == NULL)
+        return GST_FLOW_OK; // frame threading is only used with send/receive
+
+    num_dec = avcodec_decode_video2(base->context, base->frame, &decoder->frame_finished, packet);
+    if (num_dec >= 0 && decoder->frame_finished > 0)
+        result = videodecoder_push_frame(decoder, duration, discont);
+#endif
+
+    if (num_dec < 0)
+    {
+        //        basedecoder_flush(base);
+#ifdef DEBUG_OUTPUT
+        g_print ("videodecoder_chain error: %s\n", avelement_error_to_string(AVELEMENT(decoder), num_dec));
+#endif
+    }
+
+    return result;
+}
+
+/*
+ * Pushes the frames held by the decoding threads at the end of the stream.
+ */
+static void videodecoder_drain(VideoDecoder *decoder)
+{
+    BaseDecoder *base = BASEDECODER(decoder);
+
+    if (!base->is_initialized || base->is_flushing)
+        return;
+
+#if USE_SEND_RECEIVE
+    videodecoder_decode_packet(decoder, NULL, GST_CLOCK_TIME_NONE, FALSE);
+
+    // A drained decoder only accepts packets again after a flush
+    basedecoder_flush(base);
+#endif
+}
+
+static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffer *buf)
+{
+    VideoDecoder  *decoder = VIDEODECODER(parent);
+    BaseDecoder   *base = BASEDECODER(decoder);
+    GstFlowReturn  result = GST_FLOW_OK;
+    GstMapInfo     info;
+    gboolean       unmap_buf = FALSE;
+
     if (base->is_flushing)  // Reject buffers in flushing state.
     {
         result = GST_FLOW_FLUSHING;
@@ -715,19 +1263,9 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
                 base->context->reordered_opaque = GST_BUFFER_TIMESTAMP(buf);
             else
                 base->context->reordered_opaque = AV_NOPTS_VALUE;
-#if USE_SEND_RECEIVE
-            num_dec = avcodec_send_packet(base->context, &decoder->packet);
-            if (num_dec == 0)
-            {
-                num_dec = avcodec_receive_frame(base->context, base->frame);
-                if (num_dec == 0)
-                    decoder->frame_finished = 1;
-                else
-                    decoder->frame_finished = 0;
-            }
-#else
-            num_dec = avcodec_decode_video2(base->context, base->frame, &decoder->frame_finished, &decoder->packet);
-#endif
+
+            result = videodecoder_decode_packet(decoder, &decoder->packet,
+                                                GST_BUFFER_DURATION(buf), GST_BUFFER_IS_DISCONT(buf));
 
 #if PACKET_UNREF
             av_packet_unref(&decoder->packet);
@@ -751,173 +1289,8 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
         else
             base->context->reordered_opaque = AV_NOPTS_VALUE;
 
-#if USE_SEND_RECEIVE
-        num_dec = avcodec_send_packet(base->context, &decoder->packet);
-        if (num_dec == 0)
-        {
-            num_dec = avcodec_receive_frame(base->context, base->frame);
-            if (num_dec == 0)
-                decoder->frame_finished = 1;
-            else
-                decoder->frame_finished = 0;
-        }
-#else
-        num_dec = avcodec_decode_video2(base->context, base->frame, &decoder->frame_finished, &decoder->packet);
-#endif
-    }
-
-    if (num_dec < 0)
-    {
-        //        basedecoder_flush(base);
-#ifdef DEBUG_OUTPUT
-        g_print ("videodecoder_chain error: %s\n", avelement_error_to_string(AVELEMENT(decoder), num_dec));
-#endif
-        goto _exit;
-    }
-
-    if (decoder->frame_finished > 0)
-    {
-        if (!videodecoder_configure_sourcepad(decoder))
-            result = GST_FLOW_ERROR;
-        else
-        {
-#if HEVC_SUPPORT
-            // Check to see if we need to convert frame to YUV420p
-            if (base->frame->format != AV_PIX_FMT_YUV420P)
-            {
-                if (!videodecoder_convert_frame(decoder))
-                {
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
-                                             GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
-                                             g_strdup("Video frame conversion failed"), NULL,
-                                             ("videodecoder.c"), ("videodecoder_chain"), 0);
-
-                    result = GST_FLOW_ERROR;
-                    goto _exit;
-                }
-
-                reordered_opaque = decoder->dest_frame->reordered_opaque;
-                data0 = decoder->dest_frame->data[0];
-                data1 = decoder->dest_frame->data[1];
-                data2 = decoder->dest_frame->data[2];
-                set_frame_values = FALSE;
-            }
-#endif // HEVC_SUPPORTf
-
-            if (set_frame_values)
-            {
-                reordered_opaque = base->frame->reordered_opaque;
-                data0 = base->frame->data[0];
-                data1 = base->frame->data[1];
-                data2 = base->frame->data[2];
-            }
-
-            GstBuffer *outbuf = gst_buffer_new_allocate(NULL, decoder->frame_size, NULL);
-            if (outbuf == NULL)
-            {
-                if (result != GST_FLOW_FLUSHING)
-                {
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
-                                             GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
-                                             g_strdup("Decoded video buffer allocation failed"), NULL,
-                                             ("videodecoder.c"), ("videodecoder_chain"), 0);
-                }
-            }
-            else
-            {
-                GST_BUFFER_OFFSET(outbuf) = base->context->frame_number;
-                if (reordered_opaque != AV_NOPTS_VALUE)
-                {
-                    GST_BUFFER_TIMESTAMP(outbuf) = reordered_opaque;
-                    GST_BUFFER_DURATION(outbuf) = GST_BUFFER_DURATION(buf); // Duration for video usually same
-                }
-
-                if (!gst_buffer_map(outbuf, &info2, GST_MAP_WRITE))
-                {
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Decoded video buffer allocation failed"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
-
-                // Copy image by parts from different arrays.
-                if (decoder->frame_size > (unsigned int)info2.maxsize) // maxsize should be same or more due to alignment
-                {
-                    gst_buffer_unmap(outbuf, &info2);
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Wrong buffer size"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
-
-                out_buf_size = decoder->frame_size;
-                if (out_buf_size >= decoder->u_offset)
-                {
-                    memcpy(info2.data, data0, decoder->u_offset);
-                    out_buf_size -= decoder->u_offset;
-                    if (out_buf_size >= decoder->uv_blocksize &&
-                        decoder->uv_blocksize <= decoder->frame_size &&
-                        decoder->u_offset <= (decoder->frame_size - decoder->uv_blocksize))
-                    {
-                        memcpy(info2.data + decoder->u_offset, data1, decoder->uv_blocksize);
-                        out_buf_size -= decoder->uv_blocksize;
-                        if (out_buf_size >= decoder->uv_blocksize &&
-                            decoder->uv_blocksize <= decoder->frame_size &&
-                            decoder->v_offset <= (decoder->frame_size - decoder->uv_blocksize))
-                        {
-                            memcpy(info2.data + decoder->v_offset, data2, decoder->uv_blocksize);
-                        }
-                        else
-                        {
-                            copy_error = TRUE;
-                        }
-                    }
-                    else
-                    {
-                        copy_error = TRUE;
-                    }
-                }
-                else
-                {
-                    copy_error = TRUE;
-                }
-
-                gst_buffer_unmap(outbuf, &info2);
-
-                if (copy_error)
-                {
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Copy data failed"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
-
-                GST_BUFFER_OFFSET_END(outbuf) = GST_BUFFER_OFFSET_NONE;
-
-                if (decoder->discont || GST_BUFFER_IS_DISCONT(buf))
-                {
-#ifdef DEBUG_OUTPUT
-                    g_print("Video discont: frame size=%dx%d\n", base->context->width, base->context->height);
-#endif
-                    GST_BUFFER_FLAG_SET(outbuf, GST_BUFFER_FLAG_DISCONT);
-                    decoder->discont = FALSE;
-                }
-
-
-#ifdef VERBOSE_DEBUG
-                g_print("videodecoder: pushing buffer ts=%.4f, duration=%.4f\n",
-                    GST_BUFFER_TIMESTAMP_IS_VALID(outbuf) ? (double)GST_BUFFER_TIMESTAMP(outbuf)/GST_SECOND : -1.0,
-                    GST_BUFFER_DURATION_IS_VALID(outbuf) ? (double)GST_BUFFER_DURATION(outbuf)/GST_SECOND : -1.0);
-#endif
-                result = gst_pad_push(base->srcpad, outbuf);
-#ifdef VERBOSE_DEBUG
-                g_print(" done, res=%s\n", gst_flow_get_name(result));
-#endif
-            }
-        }
+        result = videodecoder_decode_packet(decoder, &decoder->packet,
+                                            GST_BUFFER_DURATION(buf), GST_BUFFER_IS_DISCONT(buf));
     }
 
 _exit:
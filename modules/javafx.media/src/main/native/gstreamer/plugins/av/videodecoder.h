@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,9 @@
 
 #include <dlfcn.h>
 #include <libswscale/swscale.h>
+#if HW_DECODE
+#include <libavutil/hwcontext.h>
+#endif
 
 G_BEGIN_DECLS
 
@@ -46,6 +49,12 @@ G_BEGIN_DECLS
 
 #define AV_VIDEO_DECODER_PLUGIN_NAME "avvideodecoder"
 
+// libavcodec warns about frame threading with more threads than this
+#define VIDEODECODER_MAX_THREADS 16
+
+// Environment variable giving the default of the "hw-device" property
+#define VIDEODECODER_HW_DEVICE_ENV "JFXMEDIA_AV_HWDEVICE"
+
 #if HEVC_SUPPORT
 // libswscale APIs
 typedef struct SwsContext *(*sws_getContext_ptr)(int srcW, int srcH,
@@ -80,6 +89,10 @@ struct _VideoDecoder {
     AVPacket     packet;
 
     gint         codec_id;
+    gchar        *hw_device;     // "vaapi", "vdpau", ... or NULL for software decoding
+    gboolean     holds_threads;  // counted in the decoding threads shared by all decoders
+    gint         output_width;   // size the video is displayed at, 0 if unknown
+    gint         output_height;
 
 #if HEVC_SUPPORT
     struct SwsContext *sws_context;
@@ -90,7 +103,16 @@ struct _VideoDecoder {
     sws_getContext_ptr  sws_getContext_func;
     sws_freeContext_ptr sws_freeContext_func;
     sws_scale_ptr       sws_scale_func;
+    gboolean            swscale_missing; // not loaded, frames are not scaled down
+    int                 frame_format;   // decoded format the source pad is set up for
+    int                 scaled_width;   // size frames are scaled down to, 0 if pushed as decoded
+    int                 scaled_height;
 #endif // HEVC_SUPPORT
+
+#if HW_DECODE
+    enum AVPixelFormat  hw_pix_fmt;     // AV_PIX_FMT_NONE unless decoding in hardware
+    AVFrame             *transfer_frame; // spare frame swapped with the decoded one on transfer
+#endif // HW_DECODE
 };
 
 struct _VideoDecoderClass
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -217,6 +217,26 @@ HRESULT CInputPin::ReceiveConnection(IPin *pConnector, const AM_MEDIA_TYPE *pmt)
     return hr;
 }
 
+// Number of upstream allocator buffers never held by GStreamer, so the
+// upstream filter can keep delivering while downstream queues are full
+#define WRAPPED_SAMPLES_RESERVE 2
+
+struct sWrappedSample
+{
+    IMediaSample *pSample;
+    CSink *pSink;
+};
+
+long CInputPin::GetAllocatorBufferCount()
+{
+    ALLOCATOR_PROPERTIES props;
+
+    if (m_pAllocator == NULL || FAILED(m_pAllocator->GetProperties(&props)))
+        return 0;
+
+    return props.cBuffers;
+}
+
 CSink::CSink(HRESULT *phr) : CBaseRenderer(CLSID_Sink, "CSink", NULL, phr)
 {
     ZeroMemory(&m_UserData, sizeof(sUserData));
@@ -232,6 +252,8 @@ CSink::CSink(HRESULT *phr) : CBaseRenderer(CLSID_Sink, "CSink", NULL, phr)
 
     m_bEOSInProgress = false;
     m_bWorkerThreadExits = false;
+
+    m_lWrappedSamples = 0;
 }
 
 HRESULT CSink::GetMediaType(int iPosition, CMediaType *pMediaType)
@@ -454,20 +476,49 @@ HRESULT CSink::DoRenderSampleExternal(IMediaSample *pMediaSample)
     if (lSize <= 0)
         return S_FALSE;
 
-    GetGstBuffer(&pBuffer, lSize, &m_UserData);
-    if (pBuffer == NULL)
-        return S_FALSE;
-
     hr = pMediaSample->GetPointer(&pData);
     if (FAILED(hr) || pData == NULL)
         return S_FALSE;
 
-    if (!gst_buffer_map(pBuffer, &info, GST_MAP_WRITE))
-        return S_FALSE;
+    // Upstream filters with their own allocator (MPEG-2 demultiplexer)
+    // deliver into DirectShow memory. Hand the sample to GStreamer without
+    // a copy while the allocator has spare buffers, otherwise copy it.
+    sWrappedSample *pWrapped = NULL;
+    if (m_lWrappedSamples < ((CInputPin*)m_pInputPin)->GetAllocatorBufferCount() - WRAPPED_SAMPLES_RESERVE)
+        pWrapped = new sWrappedSample;
 
-    memcpy(info.data, pData, lSize);
-    gst_buffer_unmap(pBuffer, &info);
-    gst_buffer_set_size(pBuffer, lSize);
+    if (pWrapped != NULL)
+    {
+        GetGstBuffer(&pBuffer, 0, &m_UserData);
+        if (pBuffer == NULL)
+        {
+            delete pWrapped;
+            return S_FALSE;
+        }
+
+        pWrapped->pSample = pMediaSample;
+        pWrapped->pSink = this;
+        pMediaSample->AddRef();
+        AddRef();
+        InterlockedIncrement(&m_lWrappedSamples);
+
+        gst_buffer_append_memory(pBuffer,
+                gst_memory_new_wrapped(GST_MEMORY_FLAG_READONLY, pData, pMediaSample->GetSize(),
+                                       0, lSize, pWrapped, (GDestroyNotify)ReleaseWrappedSample));
+    }
+    else
+    {
+        GetGstBuffer(&pBuffer, lSize, &m_UserData);
+        if (pBuffer == NULL)
+            return S_FALSE;
+
+        if (!gst_buffer_map(pBuffer, &info, GST_MAP_WRITE))
+            return S_FALSE;
+
+        memcpy(info.data, pData, lSize);
+        gst_buffer_unmap(pBuffer, &info);
+        gst_buffer_set_size(pBuffer, lSize);
+    }
 
     hr = pMediaSample->GetTime(&start, &stop);
     if (hr == S_OK)
@@ -504,6 +555,18 @@ HRESULT CSink::DoRenderSampleExternal(IMediaSample *pMediaSample)
     return S_OK;
 }
 
+void CSink::ReleaseWrappedSample(gpointer data)
+{
+    sWrappedSample *pWrapped = (sWrappedSample*)data;
+
+    // Returns the sample to the upstream allocator
+    pWrapped->pSample->Release();
+    InterlockedDecrement(&pWrapped->pSink->m_lWrappedSamples);
+    pWrapped->pSink->Release();
+
+    delete pWrapped;
+}
+
 HRESULT CSink::DoRenderSampleApp(IMediaSample *pMediaSample)
 {
     if (pMediaSample == NULL)
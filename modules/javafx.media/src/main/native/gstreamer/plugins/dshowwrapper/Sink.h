@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -88,6 +88,7 @@ public:
     HRESULT SetGetGstBufferCallback(void (*function)(GstBuffer **ppBuffer, long lSize, sUserData *pUserData));
     HRESULT CreateAllocator();
     STDMETHODIMP ReceiveConnection(IPin *pConnector, const AM_MEDIA_TYPE *pmt);
+    long GetAllocatorBufferCount();
 
 public:
     bool m_bUseExternalAllocator;
@@ -144,4 +145,8 @@ private:
 
     bool m_bEOSInProgress;
     bool m_bWorkerThreadExits;
+
+    // Samples of the upstream allocator currently held by GStreamer buffers
+    volatile LONG m_lWrappedSamples;
+    static void ReleaseWrappedSample(gpointer data);
 };
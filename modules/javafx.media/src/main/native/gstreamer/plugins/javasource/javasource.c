@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,12 @@ GST_DEBUG_CATEGORY (java_source_debug);
 #define _BS(val) (val ? "TRUE" : "FALSE")
 
 #define MAX_READ_SIZE 65536
+#define DEFAULT_BLOCK_SIZE 4096 // ConnectionHolder.DEFAULT_BUFFER_SIZE
+#define MIN_BLOCK_SIZE 512
+#define MAX_READ_AHEAD 64
+
+// Read-ahead doubles the block size after this many reads in a row filled the whole block
+#define BLOCK_GROWTH_READS 4
 
 /***********************************************************************************
 * HLS Properties and Values
@@ -52,6 +58,8 @@ enum
     SIGNAL_READ_NEXT_BLOCK,
     SIGNAL_READ_BLOCK,
     SIGNAL_COPY_BLOCK,
+    SIGNAL_READ_NEXT_BLOCK_DIRECT,
+    SIGNAL_READ_BLOCK_DIRECT,
     SIGNAL_CLOSE_CONNECTION,
     SIGNAL_PROPERTY,
     LAST_SIGNAL
@@ -66,7 +74,10 @@ enum
     PROP_STOP_ON_PAUSE,
     PROP_LOCATION,
     PROP_MIMETYPE,
-    PROP_HLS_MODE
+    PROP_HLS_MODE,
+    PROP_BLOCK_SIZE,
+    PROP_MAX_BLOCK_SIZE,
+    PROP_READ_AHEAD
 };
 
 /***********************************************************************************
@@ -106,6 +117,22 @@ struct _JavaSource
     gchar*        location; // property controlled
     gchar*        mimetype; // property controlled
     gdouble       rate;
+
+    // Read-ahead fields, used by the push mode loop outside of HLS mode
+    guint         block_size; // property controlled, grows up to max_block_size with read-ahead
+    guint         max_block_size; // property controlled
+    guint         read_ahead; // property controlled, number of blocks, 0 disables read-ahead
+    guint         full_reads;
+
+    GThread       *prefetch_thread;
+    GMutex        prefetch_lock;
+    GCond         prefetch_cond;
+    GQueue        prefetch_queue;
+    gint          prefetch_code; // EOS or error code which stopped reading, 0 otherwise
+    gboolean      prefetch_running;
+    gboolean      prefetch_blocked; // stopped until java_source_prefetch_resume()
+    gboolean      prefetch_reading;
+    gboolean      prefetch_quit;
 };
 
 struct _JavaSourceClass
@@ -170,6 +197,9 @@ static gboolean         java_source_event(GstPad *pad, GstObject *parent, GstEve
 static GstFlowReturn    java_source_getrange(GstPad *pad, GstObject *parent, guint64 offset,
     guint length, GstBuffer **data);
 static void             java_source_loop(void *data);
+static void             java_source_prefetch_stop(JavaSource *element);
+static void             java_source_prefetch_resume(JavaSource *element);
+static void             java_source_prefetch_join(JavaSource *element);
 
 static gboolean            java_source_query (GstPad *pad, GstObject *parent, GstQuery *query);
 
@@ -213,6 +243,18 @@ static void java_source_class_init (JavaSourceClass *klass)
         g_param_spec_boolean ("hls-mode", "HLS Mode", "HTTP Live Streaming Mode", FALSE,
         G_PARAM_WRITABLE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
 
+    g_object_class_install_property (gobject_klass, PROP_BLOCK_SIZE,
+        g_param_spec_uint ("block-size", "Block size", "Size of the blocks read from the connection", MIN_BLOCK_SIZE, MAX_READ_SIZE, DEFAULT_BLOCK_SIZE,
+        G_PARAM_WRITABLE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
+
+    g_object_class_install_property (gobject_klass, PROP_MAX_BLOCK_SIZE,
+        g_param_spec_uint ("max-block-size", "Maximum block size", "Size up to which read-ahead grows the blocks while reads fill them", MIN_BLOCK_SIZE, MAX_READ_SIZE, MAX_READ_SIZE,
+        G_PARAM_WRITABLE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
+
+    g_object_class_install_property (gobject_klass, PROP_READ_AHEAD,
+        g_param_spec_uint ("read-ahead", "Read-ahead", "Number of blocks read ahead on a helper thread in push mode, 0 reads on the streaming thread", 0, MAX_READ_AHEAD, 0,
+        G_PARAM_WRITABLE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
+
     g_object_class_install_property (gobject_klass, PROP_LOCATION,
         g_param_spec_string ("location", "Source Location", "Location of the source to read", NULL,
         G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS | GST_PARAM_MUTABLE_READY));
@@ -264,6 +306,28 @@ static void java_source_class_init (JavaSourceClass *klass)
         2,     /* n_params */
         G_TYPE_POINTER, G_TYPE_INT);
 
+    klass->signals[SIGNAL_READ_NEXT_BLOCK_DIRECT] = g_signal_new ("read-next-block-direct",
+        G_TYPE_FROM_CLASS (klass),
+        G_SIGNAL_RUN_LAST | G_SIGNAL_NO_HOOKS,
+        0,
+        NULL, /* accumulator */
+        NULL, /* accu_data */
+        source_marshal_INT__POINTER_INT,
+        G_TYPE_INT, /* return_type */
+        2,     /* n_params */
+        G_TYPE_POINTER, G_TYPE_INT);
+
+    klass->signals[SIGNAL_READ_BLOCK_DIRECT] = g_signal_new ("read-block-direct",
+        G_TYPE_FROM_CLASS (klass),
+        G_SIGNAL_RUN_LAST | G_SIGNAL_NO_HOOKS,
+        0,
+        NULL, /* accumulator */
+        NULL, /* accu_data */
+        source_marshal_INT__UINT64_UINT_POINTER,
+        G_TYPE_INT, /* return_type */
+        3,     /* n_params */
+        G_TYPE_UINT64, G_TYPE_UINT, G_TYPE_POINTER);
+
     klass->signals[SIGNAL_CLOSE_CONNECTION] = g_signal_new ("close-connection",
         G_TYPE_FROM_CLASS (klass),
         G_SIGNAL_RUN_LAST | G_SIGNAL_NO_HOOKS,
@@ -301,6 +365,17 @@ static void java_source_init(JavaSource *element)
 
     g_mutex_init(&element->lock);
 
+    g_mutex_init(&element->prefetch_lock);
+    g_cond_init(&element->prefetch_cond);
+    g_queue_init(&element->prefetch_queue);
+    element->prefetch_thread = NULL;
+    element->prefetch_code = 0;
+    element->prefetch_running = FALSE;
+    element->prefetch_blocked = FALSE;
+    element->prefetch_reading = FALSE;
+    element->prefetch_quit = FALSE;
+    element->full_reads = 0;
+
     element->mode = MODE_DEFAULT;
 
     element->rate = 1.0; // Default to 1.0
@@ -341,6 +416,15 @@ static void java_source_set_property (GObject *object, guint prop_id,
     case PROP_MIMETYPE:
         element->mimetype = g_strdup(g_value_get_string (value));
         break;
+    case PROP_BLOCK_SIZE:
+        element->block_size = g_value_get_uint (value);
+        break;
+    case PROP_MAX_BLOCK_SIZE:
+        element->max_block_size = g_value_get_uint (value);
+        break;
+    case PROP_READ_AHEAD:
+        element->read_ahead = g_value_get_uint (value);
+        break;
     default:
         break;
     }
@@ -362,6 +446,9 @@ static void java_source_get_property (GObject *object, guint prop_id,
 static void java_source_finalize (GObject *object)
 {
     JavaSource *element = JAVA_SOURCE(object);
+    java_source_prefetch_join(element);
+    g_mutex_clear(&element->prefetch_lock);
+    g_cond_clear(&element->prefetch_cond);
     g_mutex_clear(&element->lock);
     g_free(element->location);
     if (element->mimetype)
@@ -387,6 +474,8 @@ static gboolean java_source_activatemode(GstPad *pad, GstObject *parent, GstPadM
                 element->srcresult = GST_FLOW_OK;
                 g_mutex_unlock(&element->lock);
 
+                java_source_prefetch_resume(element);
+
                 if (gst_pad_is_linked(pad))
                     return gst_pad_start_task(pad, java_source_loop, element, NULL);
                 else
@@ -396,7 +485,10 @@ static gboolean java_source_activatemode(GstPad *pad, GstObject *parent, GstPadM
                 element->srcresult = GST_FLOW_FLUSHING;
                 g_mutex_unlock(&element->lock);
 
-                return gst_pad_stop_task(pad);
+                java_source_prefetch_stop(element);
+                res = gst_pad_stop_task(pad);
+                java_source_prefetch_join(element);
+                return res;
             }
 
             break;
@@ -450,6 +542,9 @@ static gboolean java_source_perform_seek(JavaSource *element, GstPad *pad, GstEv
     element->srcresult = GST_FLOW_FLUSHING;
     g_mutex_unlock(&element->lock);
 
+    // Blocks read ahead are from the old position and the connection must be idle to seek
+    java_source_prefetch_stop(element);
+
     if ((element->mode & MODE_HLS_LIVE) != MODE_HLS_LIVE)
         GST_PAD_STREAM_LOCK(pad);
 
@@ -493,6 +588,8 @@ static gboolean java_source_perform_seek(JavaSource *element, GstPad *pad, GstEv
     element->srcresult = GST_FLOW_OK;
     g_mutex_unlock(&element->lock);
 
+    java_source_prefetch_resume(element);
+
     if (flags & GST_SEEK_FLAG_FLUSH) {
         GstEvent *e = gst_event_new_flush_stop(TRUE);
         gst_event_set_seqnum(e, seqnum);
@@ -526,6 +623,251 @@ static gboolean java_source_event(GstPad *pad, GstObject *parent, GstEvent *even
     return gst_pad_event_default(pad, parent, event);
 }
 
+/***********************************************************************************
+* Block reading and read-ahead
+***********************************************************************************/
+/**
+ * java_source_read_next_block()
+ *
+ * Reads the next block of the stream into a new buffer. When the connection can
+ * read into the buffer directly block_size bytes are requested at most, otherwise
+ * the connection decides the size and the block is copied over. Returns the size
+ * of the buffer or the EOS or error code, buffer is NULL if nothing was read.
+ */
+static gint java_source_read_next_block(JavaSource *element, guint block_size, GstBuffer **buffer)
+{
+    gint       size = 0;
+    GstMapInfo info;
+
+    *buffer = NULL;
+
+    if (g_signal_has_handler_pending(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_NEXT_BLOCK_DIRECT], 0, FALSE))
+    {
+        // Let the connection read straight into the buffer we are going to push
+        *buffer = gst_buffer_new_allocate(NULL, block_size, NULL);
+        if (*buffer == NULL)
+            return 0;
+
+        if (!gst_buffer_map(*buffer, &info, GST_MAP_WRITE))
+        {
+            gst_buffer_unref(*buffer);
+            *buffer = NULL;
+            return OTHER_ERROR_CODE;
+        }
+
+        g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_NEXT_BLOCK_DIRECT], 0, info.data, block_size, &size);
+
+        gst_buffer_unmap(*buffer, &info);
+
+        if (size > 0 && size <= (gint)block_size)
+            gst_buffer_set_size(*buffer, size);
+        else
+        {
+            gst_buffer_unref(*buffer);
+            *buffer = NULL;
+        }
+    }
+    else
+    {
+        g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_NEXT_BLOCK], 0, &size);
+        if (size > 0)
+        {
+            *buffer = gst_buffer_new_allocate(NULL, size, NULL);
+            if (*buffer)
+            {
+                if (!gst_buffer_map(*buffer, &info, GST_MAP_WRITE))
+                {
+                    gst_buffer_unref(*buffer);
+                    *buffer = NULL;
+                    return OTHER_ERROR_CODE;
+                }
+
+                g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_COPY_BLOCK], 0, info.data, size);
+
+                gst_buffer_unmap(*buffer, &info);
+            }
+        }
+    }
+
+    return size;
+}
+
+/**
+ * java_source_prefetch_thread()
+ *
+ * Keeps up to read_ahead blocks queued while running. Reading stops at EOS or an
+ * error until the streaming thread has taken the code and asks for more data.
+ * The block size doubles while reads keep filling whole blocks, waiting for the
+ * connection costs the same for a larger block when data is arriving fast.
+ */
+static gpointer java_source_prefetch_thread(gpointer data)
+{
+    JavaSource *element = JAVA_SOURCE(data);
+
+    g_mutex_lock(&element->prefetch_lock);
+    while (!element->prefetch_quit)
+    {
+        GstBuffer *buffer = NULL;
+        guint      block_size = element->block_size;
+        gint       size;
+
+        if (!element->prefetch_running || element->prefetch_code != 0 ||
+            g_queue_get_length(&element->prefetch_queue) >= element->read_ahead)
+        {
+            g_cond_wait(&element->prefetch_cond, &element->prefetch_lock);
+            continue;
+        }
+
+        element->prefetch_reading = TRUE;
+        g_mutex_unlock(&element->prefetch_lock);
+
+        size = java_source_read_next_block(element, block_size, &buffer);
+
+        g_mutex_lock(&element->prefetch_lock);
+        element->prefetch_reading = FALSE;
+
+        if (!element->prefetch_running)
+        {
+            // Stopped while reading, the block is from before the seek
+            if (buffer)
+                gst_buffer_unref(buffer);
+        }
+        else if (buffer)
+        {
+            g_queue_push_tail(&element->prefetch_queue, buffer);
+
+            if (size == (gint)block_size && block_size < element->max_block_size)
+            {
+                if (++element->full_reads >= BLOCK_GROWTH_READS)
+                {
+                    element->block_size = MIN(block_size * 2, element->max_block_size);
+                    element->full_reads = 0;
+                }
+            }
+            else
+                element->full_reads = 0;
+        }
+        else if (size < 0)
+            element->prefetch_code = size;
+
+        g_cond_broadcast(&element->prefetch_cond);
+    }
+    g_mutex_unlock(&element->prefetch_lock);
+
+    return NULL;
+}
+
+/**
+ * java_source_prefetch_pop()
+ *
+ * Takes the next block read ahead, starting the read-ahead if needed. Returns the
+ * size of the block or the EOS or error code, 0 if read-ahead was stopped while
+ * waiting.
+ */
+static gint java_source_prefetch_pop(JavaSource *element, GstBuffer **buffer)
+{
+    gint size = 0;
+
+    *buffer = NULL;
+
+    g_mutex_lock(&element->prefetch_lock);
+
+    if (element->prefetch_blocked)
+    {
+        g_mutex_unlock(&element->prefetch_lock);
+        return 0;
+    }
+
+    if (element->prefetch_thread == NULL)
+    {
+        element->prefetch_quit = FALSE;
+        element->prefetch_thread = g_thread_try_new("javasource-read-ahead", java_source_prefetch_thread, element, NULL);
+        if (element->prefetch_thread == NULL)
+        {
+            // Fall back to reading on the streaming thread
+            element->read_ahead = 0;
+            g_mutex_unlock(&element->prefetch_lock);
+            return java_source_read_next_block(element, element->block_size, buffer);
+        }
+    }
+
+    if (!element->prefetch_running)
+    {
+        element->prefetch_running = TRUE;
+        g_cond_broadcast(&element->prefetch_cond);
+    }
+
+    while (element->prefetch_running && element->prefetch_code == 0 && g_queue_is_empty(&element->prefetch_queue))
+        g_cond_wait(&element->prefetch_cond, &element->prefetch_lock);
+
+    if (!g_queue_is_empty(&element->prefetch_queue))
+    {
+        *buffer = (GstBuffer*)g_queue_pop_head(&element->prefetch_queue);
+        size = (gint)gst_buffer_get_size(*buffer);
+        g_cond_broadcast(&element->prefetch_cond);
+    }
+    else if (element->prefetch_code != 0)
+    {
+        // Reading starts over on the next call, as it would without read-ahead
+        size = element->prefetch_code;
+        element->prefetch_code = 0;
+        element->prefetch_running = FALSE;
+    }
+
+    g_mutex_unlock(&element->prefetch_lock);
+
+    return size;
+}
+
+/**
+ * java_source_prefetch_stop()
+ *
+ * Stops reading ahead, waits for a read in progress and drops the queued blocks.
+ * The connection stays idle until java_source_prefetch_resume().
+ */
+static void java_source_prefetch_stop(JavaSource *element)
+{
+    g_mutex_lock(&element->prefetch_lock);
+
+    element->prefetch_running = FALSE;
+    element->prefetch_blocked = TRUE;
+    g_cond_broadcast(&element->prefetch_cond);
+
+    while (element->prefetch_reading)
+        g_cond_wait(&element->prefetch_cond, &element->prefetch_lock);
+
+    g_queue_foreach(&element->prefetch_queue, (GFunc)gst_buffer_unref, NULL);
+    g_queue_clear(&element->prefetch_queue);
+    element->prefetch_code = 0;
+    element->full_reads = 0;
+
+    g_mutex_unlock(&element->prefetch_lock);
+}
+
+static void java_source_prefetch_resume(JavaSource *element)
+{
+    g_mutex_lock(&element->prefetch_lock);
+    element->prefetch_blocked = FALSE;
+    g_mutex_unlock(&element->prefetch_lock);
+}
+
+static void java_source_prefetch_join(JavaSource *element)
+{
+    GThread *thread = NULL;
+
+    java_source_prefetch_stop(element);
+
+    g_mutex_lock(&element->prefetch_lock);
+    thread = element->prefetch_thread;
+    element->prefetch_thread = NULL;
+    element->prefetch_quit = TRUE;
+    g_cond_broadcast(&element->prefetch_cond);
+    g_mutex_unlock(&element->prefetch_lock);
+
+    if (thread)
+        g_thread_join(thread);
+}
+
 /***********************************************************************************
 * source pad loop
 ***********************************************************************************/
@@ -626,25 +968,19 @@ next_event:
         case GST_EVENT_UNKNOWN: // Pushing buffers
             {
                 gint     size;
-                GstMapInfo info;
-                g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_NEXT_BLOCK], 0, &size);
+                GstBuffer *buffer = NULL;
+
+                if (element->read_ahead > 0 && (element->mode & MODE_DEFAULT) == MODE_DEFAULT)
+                    size = java_source_prefetch_pop(element, &buffer);
+                else
+                    size = java_source_read_next_block(element, element->block_size, &buffer);
+
                 if (size > 0)
                 {
-                    GstBuffer *buffer = gst_buffer_new_allocate(NULL, size, NULL);
                     if (buffer)
                     {
                         GST_BUFFER_OFFSET(buffer) = element->position;
 
-                        if (!gst_buffer_map(buffer, &info, GST_MAP_WRITE))
-                        {
-                            result = GST_FLOW_ERROR;
-                            break;
-                        }
-
-                        g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_COPY_BLOCK], 0, info.data, size);
-
-                        gst_buffer_unmap(buffer, &info);
-
                         if (element->discont)
                         {
                             buffer = gst_buffer_make_writable (buffer);
@@ -814,6 +1150,7 @@ static GstFlowReturn java_source_getrange(GstPad *pad, GstObject *parent, guint6
     guint    read = 0;
     guint    toRead = 0;
     GstMapInfo info;
+    gboolean direct = g_signal_has_handler_pending(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_BLOCK_DIRECT], 0, FALSE);
 
     // Do not read from Java more then MAX_READ_SIZE, so we do not allocate very large objects in Java
     GstBuffer *buf = gst_buffer_new_allocate(NULL, length, NULL);
@@ -822,7 +1159,7 @@ static GstFlowReturn java_source_getrange(GstPad *pad, GstObject *parent, guint6
 
     GST_BUFFER_OFFSET(buf) = offset;
 
-    if (!gst_buffer_map(buf, &info, GST_MAP_READ))
+    if (!gst_buffer_map(buf, &info, GST_MAP_WRITE))
     {
         gst_buffer_unref(buf);
         return GST_FLOW_ERROR;
@@ -835,10 +1172,15 @@ static GstFlowReturn java_source_getrange(GstPad *pad, GstObject *parent, guint6
         else
             toRead = (length - read);
 
-        g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_BLOCK], 0, offset + read, toRead, &size);
+        // Direct reads land in the buffer memory, otherwise the block is copied over after the read
+        if (direct)
+            g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_BLOCK_DIRECT], 0, offset + read, toRead, info.data + read, &size);
+        else
+            g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_READ_BLOCK], 0, offset + read, toRead, &size);
         if (size > 0 && size <= toRead)
         {
-            g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_COPY_BLOCK], 0, info.data + read, size);
+            if (!direct)
+                g_signal_emit(element, JAVA_SOURCE_GET_CLASS(element)->signals[SIGNAL_COPY_BLOCK], 0, info.data + read, size);
             read += size;
 
             if (size < toRead)
@@ -46,6 +46,22 @@ extern void source_marshal_INT__INT_INT (GClosure     *closure,
                                          gpointer      invocation_hint,
                                          gpointer      marshal_data);
 
+/* INT:POINTER,INT (marshal.in:17) */
+extern void source_marshal_INT__POINTER_INT (GClosure     *closure,
+                                             GValue       *return_value,
+                                             guint         n_param_values,
+                                             const GValue *param_values,
+                                             gpointer      invocation_hint,
+                                             gpointer      marshal_data);
+
+/* INT:UINT64,UINT,POINTER (marshal.in:20) */
+extern void source_marshal_INT__UINT64_UINT_POINTER (GClosure     *closure,
+                                                     GValue       *return_value,
+                                                     guint         n_param_values,
+                                                     const GValue *param_values,
+                                                     gpointer      invocation_hint,
+                                                     gpointer      marshal_data);
+
 G_END_DECLS
 
 #endif /* __source_marshal_MARSHAL_H__ */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -700,6 +700,35 @@ static gboolean mfwrapper_convert_output(GstMFWrapper *decoder)
     return FALSE;
 }
 
+// Called when the last GstBuffer referencing a delivered media buffer goes away
+static void mfwrapper_release_media_buffer(gpointer data)
+{
+    IMFMediaBuffer *pMediaBuffer = (IMFMediaBuffer*)data;
+    pMediaBuffer->Unlock();
+    pMediaBuffer->Release();
+}
+
+// Gives the sample a new buffer of the same size, so the next frame is not
+// written into memory that was handed downstream
+static HRESULT mfwrapper_replace_sample_buffer(IMFSample *pSample, DWORD cbSize)
+{
+    IMFMediaBuffer *pBuffer = NULL;
+
+    HRESULT hr = pSample->RemoveAllBuffers();
+
+    if (SUCCEEDED(hr))
+        hr = MFCreateMemoryBuffer(cbSize, &pBuffer);
+
+    if (SUCCEEDED(hr))
+        hr = pSample->AddBuffer(pBuffer);
+
+    SafeRelease(&pBuffer);
+
+    return hr;
+}
+
+// The decoded frame is passed downstream without copying: the GstBuffer wraps
+// the locked media buffer and the sample gets a new one for the next frame.
 static GstFlowReturn mfwrapper_deliver_sample(GstMFWrapper *decoder, IMFSample *pSample)
 {
     GstFlowReturn ret = GST_FLOW_OK;
@@ -709,7 +738,6 @@ static GstFlowReturn mfwrapper_deliver_sample(GstMFWrapper *decoder, IMFSample *
     BYTE *pBuffer = NULL;
     DWORD cbMaxLength = 0;
     DWORD cbCurrentLength = 0;
-    GstMapInfo info;
 
     HRESULT hr = pSample->ConvertToContiguousBuffer(&pMediaBuffer);
 
@@ -718,25 +746,28 @@ static GstFlowReturn mfwrapper_deliver_sample(GstMFWrapper *decoder, IMFSample *
 
     if (SUCCEEDED(hr) && cbCurrentLength > 0)
     {
-        GstBuffer *pGstBuffer = gst_buffer_new_allocate(NULL, cbCurrentLength, NULL);
-        if (pGstBuffer == NULL || !gst_buffer_map(pGstBuffer, &info, GST_MAP_WRITE))
+        hr = mfwrapper_replace_sample_buffer(pSample, cbMaxLength);
+        if (FAILED(hr))
         {
             pMediaBuffer->Unlock();
-             if (pGstBuffer != NULL)
-                gst_buffer_unref(pGstBuffer); // INLINE - gst_buffer_unref()
+            SafeRelease(&pMediaBuffer);
             return GST_FLOW_ERROR;
         }
 
-        memcpy(info.data, pBuffer, cbCurrentLength);
-        gst_buffer_unmap(pGstBuffer, &info);
-        gst_buffer_set_size(pGstBuffer, cbCurrentLength);
+        // The GstBuffer takes over the lock and the reference
+        GstBuffer *pGstBuffer = gst_buffer_new_wrapped_full(GST_MEMORY_FLAG_READONLY,
+            pBuffer, cbMaxLength, 0, cbCurrentLength,
+            pMediaBuffer, mfwrapper_release_media_buffer);
+        if (pGstBuffer == NULL)
+        {
+            mfwrapper_release_media_buffer(pMediaBuffer);
+            return GST_FLOW_ERROR;
+        }
+        pMediaBuffer = NULL;
 
-        hr = pMediaBuffer->Unlock();
+        hr = pSample->GetSampleTime(&llTimestamp);
         if (SUCCEEDED(hr))
-        {
-            hr = pSample->GetSampleTime(&llTimestamp);
             GST_BUFFER_TIMESTAMP(pGstBuffer) = llTimestamp * 100;
-        }
 
         if (SUCCEEDED(hr))
         {
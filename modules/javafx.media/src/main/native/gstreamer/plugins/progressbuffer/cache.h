@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,12 @@ void           cache_write_buffer(Cache* cache, GstBuffer* buffer);
  */
 gint64         cache_read_buffer(Cache* cache, GstBuffer** buffer);
 
+/* Reads a buffer of at most size bytes from the current read position,
+ * regardless of the write position. The caller keeps track of which ranges
+ * have been written. Returns the read position after the operation has been made.
+ */
+gint64         cache_read_buffer_up_to(Cache* cache, guint size, GstBuffer** buffer);
+
 /* Reads a buffer of the specified size and start position.
  * Returns GST_FLOW_OK if the seek operation and subsequent read operation
  * were successfull. GST_FLOW_ERROR otherwise.
@@ -54,6 +60,9 @@ GstFlowReturn  cache_read_buffer_from_position(Cache* cache, gint64 start_positi
 // Sets a new write position
 gboolean       cache_set_write_position(Cache* cache, gint64 position);
 
+// Sets a new write position keeping the data written so far, including before the position
+gboolean       cache_seek_write_position(Cache* cache, gint64 position);
+
 // Sets a new read position
 gboolean       cache_set_read_position(Cache* cache, gint64 position);
 
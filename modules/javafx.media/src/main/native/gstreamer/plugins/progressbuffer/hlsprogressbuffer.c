@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,11 +34,23 @@ GST_DEBUG_CATEGORY (hls_progress_buffer_debug);
 
 #define ELEMENT_DESCRIPTION "JFX HLS Progress buffer element"
 
+/***********************************************************************************
+ * Properties
+ ***********************************************************************************/
+enum
+{
+    PROP_0,
+    PROP_MEMORY_BUDGET
+};
+
 /***********************************************************************************
  * Element structures are hidden from outside
  ***********************************************************************************/
 #define NUM_OF_CACHED_SEGMENTS 3
 
+// Segments are kept in memory as long as all cached segments fit in this many bytes
+#define DEFAULT_MEMORY_BUDGET (3 * 8 * 1024 * 1024)
+
 struct _HLSProgressBuffer
 {
     GstElement    parent;
@@ -57,6 +69,13 @@ struct _HLSProgressBuffer
     gint          cache_write_index;
     gint          cache_read_index;
 
+    // In-memory segments hold the received buffers instead of a file cache
+    gboolean      cache_in_memory[NUM_OF_CACHED_SEGMENTS];
+    GQueue        memory_queue[NUM_OF_CACHED_SEGMENTS];
+    guint64       memory_read_position[NUM_OF_CACHED_SEGMENTS];
+    guint64       memory_budget;
+    guint64       memory_reserved;
+
     gboolean      send_new_segment;
     gboolean      set_src_caps;
 
@@ -119,6 +138,8 @@ static GstStaticPadTemplate source_template = GST_STATIC_PAD_TEMPLATE ("src",
  * Instance init and forward declarations
  ***********************************************************************************/
 static void                 hls_progress_buffer_finalize (GObject *object);
+static void                 hls_progress_buffer_set_property (GObject *object, guint property_id, const GValue *value, GParamSpec *pspec);
+static void                 hls_progress_buffer_get_property (GObject *object, guint property_id, GValue *value, GParamSpec *pspec);
 static GstStateChangeReturn hls_progress_buffer_change_state (GstElement *element, GstStateChange transition);
 static GstFlowReturn        hls_progress_buffer_chain(GstPad *pad, GstObject *parent, GstBuffer *data);
 static gboolean             hls_progress_buffer_activatemode(GstPad *pad, GstObject *parent, GstPadMode mode, gboolean active);
@@ -148,9 +169,20 @@ static void hls_progress_buffer_class_init (HLSProgressBufferClass *klass)
     gst_element_class_add_pad_template (element_class,
         gst_static_pad_template_get (&source_template));
 
+    gobject_class->set_property = hls_progress_buffer_set_property;
+    gobject_class->get_property = hls_progress_buffer_get_property;
     gobject_class->finalize = hls_progress_buffer_finalize;
     GST_ELEMENT_CLASS (klass)->change_state = hls_progress_buffer_change_state;
 
+    g_object_class_install_property (gobject_class, PROP_MEMORY_BUDGET,
+                                     g_param_spec_uint64 ("memory-budget",
+                                                          "Memory budget",
+                                                          "Maximum number of bytes of cached segments kept in memory. Larger segments are cached in a file, 0 caches all segments in files.",
+                                                          0  /* minimum value */,
+                                                          G_MAXUINT64 /* maximum value */,
+                                                          DEFAULT_MEMORY_BUDGET  /* default value */,
+                                                          G_PARAM_READWRITE | G_PARAM_CONSTRUCT));
+
     cache_static_init();
 }
 
@@ -177,12 +209,17 @@ static void hls_progress_buffer_init(HLSProgressBuffer *element)
 
     for (int i = 0; i < NUM_OF_CACHED_SEGMENTS; i++)
     {
-        element->cache[i] = create_cache();
+        element->cache[i] = NULL; // Created when a segment does not fit in memory
         element->cache_size[i] = 0;
         element->cache_write_ready[i] = TRUE;
         element->cache_discont[i] = FALSE;
+        element->cache_in_memory[i] = FALSE;
+        g_queue_init(&element->memory_queue[i]);
+        element->memory_read_position[i] = 0;
     }
 
+    element->memory_reserved = 0;
+
     element->cache_write_index = -1;
     element->cache_read_index = 0;
 
@@ -211,6 +248,8 @@ static void hls_progress_buffer_finalize (GObject *object)
     {
         if (element->cache[i])
             destroy_cache(element->cache[i]);
+        g_queue_foreach(&element->memory_queue[i], (GFunc)gst_buffer_unref, NULL);
+        g_queue_clear(&element->memory_queue[i]);
     }
 
     g_mutex_clear(&element->lock);
@@ -220,6 +259,48 @@ static void hls_progress_buffer_finalize (GObject *object)
     G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
+/**
+ * hls_progress_buffer_set_property()
+ *
+ * Function to set properties on the element.
+ */
+static void hls_progress_buffer_set_property (GObject *object, guint property_id,
+                                              const GValue *value, GParamSpec *pspec)
+{
+    HLSProgressBuffer *element = HLS_PROGRESS_BUFFER(object);
+    switch (property_id)
+    {
+        case PROP_MEMORY_BUDGET:
+            g_mutex_lock(&element->lock);
+            element->memory_budget = g_value_get_uint64(value);
+            g_mutex_unlock(&element->lock);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ * hls_progress_buffer_get_property()
+ *
+ * Function to get properties from the element.
+ */
+static void hls_progress_buffer_get_property (GObject *object, guint property_id,
+                                              GValue *value, GParamSpec *pspec)
+{
+    HLSProgressBuffer *element = HLS_PROGRESS_BUFFER(object);
+    switch (property_id)
+    {
+        case PROP_MEMORY_BUDGET:
+            g_value_set_uint64(value, element->memory_budget);
+            break;
+
+        default:
+            break;
+    }
+}
+
 /**
  * hls_progress_buffer_activatepush_src()
  *
@@ -272,6 +353,46 @@ static gboolean hls_progress_buffer_activatepush_src(GstPad *pad, GstObject *par
 /***********************************************************************************
  * Internal functions
  ***********************************************************************************/
+static void hls_progress_buffer_clear_memory(HLSProgressBuffer *element, gint index)
+{
+    if (element->cache_in_memory[index])
+    {
+        g_queue_foreach(&element->memory_queue[index], (GFunc)gst_buffer_unref, NULL);
+        g_queue_clear(&element->memory_queue[index]);
+        element->memory_reserved -= element->cache_size[index];
+        element->memory_read_position[index] = 0;
+        element->cache_in_memory[index] = FALSE;
+    }
+}
+
+static gboolean hls_progress_buffer_has_data(HLSProgressBuffer *element, gint index)
+{
+    if (element->cache_in_memory[index])
+        return !g_queue_is_empty(&element->memory_queue[index]);
+    else
+        return element->cache[index] && cache_has_enough_data(element->cache[index]);
+}
+
+/*
+ * Reads the next buffer of the segment at index. In-memory segments hand out the
+ * buffers as they were received. Returns the read position after the operation.
+ */
+static guint64 hls_progress_buffer_read(HLSProgressBuffer *element, gint index, GstBuffer **buffer)
+{
+    if (element->cache_in_memory[index])
+    {
+        *buffer = gst_buffer_make_writable((GstBuffer*)g_queue_pop_head(&element->memory_queue[index]));
+        GST_BUFFER_FLAG_UNSET(*buffer, GST_BUFFER_FLAG_DISCONT);
+        GST_BUFFER_TIMESTAMP(*buffer) = GST_CLOCK_TIME_NONE;
+        GST_BUFFER_DTS(*buffer) = GST_CLOCK_TIME_NONE;
+        GST_BUFFER_OFFSET(*buffer) = element->memory_read_position[index];
+        element->memory_read_position[index] += gst_buffer_get_size(*buffer);
+        return element->memory_read_position[index];
+    }
+    else
+        return cache_read_buffer(element->cache[index], buffer);
+}
+
 static void hls_progress_buffer_flush_data(HLSProgressBuffer *element)
 {
     guint i = 0;
@@ -287,13 +408,14 @@ static void hls_progress_buffer_flush_data(HLSProgressBuffer *element)
     element->cache_read_index = 0;
     for (i = 0; i < NUM_OF_CACHED_SEGMENTS; i++)
     {
+        hls_progress_buffer_clear_memory(element, i);
         if (element->cache[i])
         {
             cache_set_write_position(element->cache[i], 0);
             cache_set_read_position(element->cache[i], 0);
-            element->cache_size[i] = 0;
-            element->cache_write_ready[i] = TRUE;
         }
+        element->cache_size[i] = 0;
+        element->cache_write_ready[i] = TRUE;
     }
 
     g_mutex_unlock(&element->lock);
@@ -327,13 +449,20 @@ static GstFlowReturn hls_progress_buffer_chain(GstPad *pad, GstObject *parent, G
             element->cache_discont[element->cache_write_index] = TRUE;
         }
 
-        cache_write_buffer(element->cache[element->cache_write_index], data);
+        if (element->cache_in_memory[element->cache_write_index])
+        {
+            g_queue_push_tail(&element->memory_queue[element->cache_write_index], data);
+            data = NULL;
+        }
+        else
+            cache_write_buffer(element->cache[element->cache_write_index], data);
         g_cond_signal(&element->add_cond);
     }
     g_mutex_unlock(&element->lock);
 
     // INLINE - gst_buffer_unref()
-    gst_buffer_unref(data);
+    if (data)
+        gst_buffer_unref(data);
 
     return result;
 }
@@ -398,7 +527,7 @@ static void hls_progress_buffer_loop(void *data)
 
     g_mutex_lock(&element->lock);
 
-    while (element->srcresult == GST_FLOW_OK && !cache_has_enough_data(element->cache[element->cache_read_index]))
+    while (element->srcresult == GST_FLOW_OK && !hls_progress_buffer_has_data(element, element->cache_read_index))
     {
         if (element->is_eos)
         {
@@ -418,7 +547,7 @@ static void hls_progress_buffer_loop(void *data)
     if (result == GST_FLOW_OK)
     {
         GstBuffer *buffer = NULL;
-        guint64 read_position = cache_read_buffer(element->cache[element->cache_read_index], &buffer);
+        guint64 read_position = hls_progress_buffer_read(element, element->cache_read_index, &buffer);
 
         if (element->cache_discont[element->cache_read_index])
         {
@@ -429,6 +558,7 @@ static void hls_progress_buffer_loop(void *data)
 
         if (read_position == element->cache_size[element->cache_read_index])
         {
+            hls_progress_buffer_clear_memory(element, element->cache_read_index);
             element->cache_write_ready[element->cache_read_index] = TRUE;
             element->cache_read_index = (element->cache_read_index + 1) % NUM_OF_CACHED_SEGMENTS;
             send_hls_not_full_message(element);
@@ -479,6 +609,7 @@ static gboolean hls_progress_buffer_sink_event(GstPad *pad, GstObject *parent, G
     case GST_EVENT_SEGMENT:
         {
             GstSegment segment;
+            gboolean in_memory = FALSE;
 
             g_mutex_lock(&element->lock);
             if (element->srcresult != GST_FLOW_OK)
@@ -527,7 +658,11 @@ static gboolean hls_progress_buffer_sink_event(GstPad *pad, GstObject *parent, G
             g_mutex_lock(&element->lock);
             element->cache_write_index = (element->cache_write_index + 1) % NUM_OF_CACHED_SEGMENTS;
 
-            while (element->srcresult == GST_FLOW_OK && !element->cache_write_ready[element->cache_write_index])
+            // Segments larger than the whole budget go to the file cache, others wait for room in memory
+            in_memory = (segment.stop >= 0 && (guint64)segment.stop <= element->memory_budget);
+            while (element->srcresult == GST_FLOW_OK &&
+                   (!element->cache_write_ready[element->cache_write_index] ||
+                    (in_memory && element->memory_reserved + segment.stop > element->memory_budget)))
             {
                 g_mutex_unlock(&element->lock);
                 send_hls_full_message(element);
@@ -539,10 +674,30 @@ static gboolean hls_progress_buffer_sink_event(GstPad *pad, GstObject *parent, G
                     return TRUE;
                 }
             }
+            if (!in_memory && element->cache[element->cache_write_index] == NULL)
+            {
+                element->cache[element->cache_write_index] = create_cache();
+                if (element->cache[element->cache_write_index] == NULL)
+                {
+                    element->srcresult = GST_FLOW_ERROR;
+                    g_mutex_unlock(&element->lock);
+                    gst_element_message_full(GST_ELEMENT(element), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_OPEN_READ_WRITE,
+                                             g_strdup("Failed to create the segment cache."), NULL,
+                                             ("hlsprogressbuffer.c"), ("hls_progress_buffer_sink_event"), 0);
+                    return FALSE;
+                }
+            }
+
             element->cache_size[element->cache_write_index] = segment.stop;
             element->cache_write_ready[element->cache_write_index] = FALSE;
-            cache_set_write_position(element->cache[element->cache_write_index], 0);
-            cache_set_read_position(element->cache[element->cache_write_index], 0);
+            element->cache_in_memory[element->cache_write_index] = in_memory;
+            if (in_memory)
+                element->memory_reserved += segment.stop;
+            else
+            {
+                cache_set_write_position(element->cache[element->cache_write_index], 0);
+                cache_set_read_position(element->cache[element->cache_write_index], 0);
+            }
 
             g_mutex_unlock(&element->lock);
 
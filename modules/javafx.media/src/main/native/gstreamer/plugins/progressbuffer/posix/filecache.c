@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,12 +26,29 @@
 #include <cache.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <string.h>
 
 #define DEFAULT_BUFFER_SIZE 4096
+
+// The cache file is mapped in segments of this size, a multiple of any page size.
+#define MAPPED_SEGMENT_SIZE (1024 * 1024)
+
 static const char *tempDir = NULL;
 
+/*
+ * A mapped part of the cache file. Buffers read from the cache wrap the mapping
+ * and hold a reference to it, so it stays valid when the cache moves on to a
+ * new file or is destroyed while the buffers are still downstream.
+ */
+typedef struct _MappedSegment
+{
+    guint8* data;
+    gint    ref_count;
+} MappedSegment;
+
 struct _Cache
 {
     char*   filename;
@@ -40,8 +57,141 @@ struct _Cache
 
     gint64  read_position;
     gint64  write_position;
+
+    // Mapped mode, NULL when the cache falls back to read() and write()
+    GPtrArray* segments;
+    gint64     file_size;
 };
 
+static MappedSegment* mapped_segment_ref(MappedSegment* segment)
+{
+    g_atomic_int_inc(&segment->ref_count);
+    return segment;
+}
+
+static void mapped_segment_unref(gpointer data)
+{
+    MappedSegment* segment = (MappedSegment*)data;
+    if (g_atomic_int_dec_and_test(&segment->ref_count))
+    {
+        munmap(segment->data, MAPPED_SEGMENT_SIZE);
+        g_free(segment);
+    }
+}
+
+static void cache_release_segments(Cache* cache)
+{
+    guint i;
+    for (i = 0; i < cache->segments->len; i++)
+    {
+        MappedSegment* segment = (MappedSegment*)g_ptr_array_index(cache->segments, i);
+        if (segment)
+            mapped_segment_unref(segment);
+    }
+    g_ptr_array_set_size(cache->segments, 0);
+}
+
+static gboolean cache_open_file(Cache* cache)
+{
+    cache->filename = g_build_filename(tempDir, "jfxmpbXXXXXX", NULL);
+    if (cache->filename == NULL)
+        return FALSE;
+
+    cache->writeHandle = g_mkstemp_full(cache->filename, O_RDWR, S_IRUSR|S_IWUSR);
+    cache->readHandle = open(cache->filename, O_RDONLY, 0);
+
+    if (cache->writeHandle < 0 || cache->readHandle < 0 || unlink(cache->filename) < 0)
+    {
+        if (cache->writeHandle >= 0)
+            close(cache->writeHandle);
+        if (cache->readHandle >= 0)
+            close(cache->readHandle);
+        g_free(cache->filename);
+        cache->filename = NULL;
+        return FALSE;
+    }
+
+    cache->file_size = 0;
+    return TRUE;
+}
+
+static void cache_close_file(Cache* cache)
+{
+    close(cache->writeHandle);
+    close(cache->readHandle);
+    g_free(cache->filename);
+    cache->filename = NULL;
+}
+
+/*
+ * Returns the mapping of the segment with the given index, mapping it and
+ * growing the file to cover it first if needed. Blocks are allocated when the
+ * file grows, since running out of space while writing to a mapping would
+ * raise SIGBUS instead of failing the write.
+ */
+static MappedSegment* cache_get_segment(Cache* cache, guint index, gboolean create)
+{
+    MappedSegment* segment = NULL;
+    gint64 segment_end = ((gint64)index + 1) * MAPPED_SEGMENT_SIZE;
+
+    if (index < cache->segments->len)
+        segment = (MappedSegment*)g_ptr_array_index(cache->segments, index);
+
+    if (segment || !create)
+        return segment;
+
+    if (segment_end > cache->file_size)
+    {
+        if (posix_fallocate(cache->writeHandle, (off_t)index * MAPPED_SEGMENT_SIZE, MAPPED_SEGMENT_SIZE) != 0)
+            return NULL;
+        cache->file_size = segment_end;
+    }
+
+    segment = (MappedSegment*)g_try_malloc(sizeof(MappedSegment));
+    if (segment == NULL)
+        return NULL;
+
+    segment->data = (guint8*)mmap(NULL, MAPPED_SEGMENT_SIZE, PROT_READ|PROT_WRITE, MAP_SHARED,
+                                  cache->writeHandle, (off_t)index * MAPPED_SEGMENT_SIZE);
+    if (segment->data == MAP_FAILED)
+    {
+        g_free(segment);
+        return NULL;
+    }
+    segment->ref_count = 1;
+
+    if (index >= cache->segments->len)
+        g_ptr_array_set_size(cache->segments, index + 1);
+    g_ptr_array_index(cache->segments, index) = segment;
+
+    return segment;
+}
+
+/*
+ * Wraps size bytes of the mapped cache from position into buffer without
+ * copying. The range must be written and within one segment.
+ */
+static gboolean cache_append_mapped_memory(Cache* cache, GstBuffer* buffer, gint64 position, guint size)
+{
+    MappedSegment* segment = cache_get_segment(cache, (guint)(position / MAPPED_SEGMENT_SIZE), FALSE);
+    GstMemory* memory;
+
+    if (segment == NULL)
+        return FALSE;
+
+    memory = gst_memory_new_wrapped(GST_MEMORY_FLAG_READONLY,
+                                    segment->data + (position % MAPPED_SEGMENT_SIZE), size, 0, size,
+                                    mapped_segment_ref(segment), mapped_segment_unref);
+    if (memory == NULL)
+    {
+        mapped_segment_unref(segment);
+        return FALSE;
+    }
+
+    gst_buffer_append_memory(buffer, memory);
+    return TRUE;
+}
+
 void cache_static_init(void)
 {
     tempDir = g_get_tmp_dir();
@@ -52,25 +202,22 @@ Cache* create_cache()
     Cache* result= (Cache*)g_try_malloc(sizeof(Cache));
     if (result)
     {
-        result->filename = g_build_filename(tempDir, "jfxmpbXXXXXX", NULL);
-        if (result->filename == NULL)
+        if (!cache_open_file(result))
             goto _error_exit;
-        else
-        {
-        result->writeHandle = g_mkstemp_full(result->filename, O_RDWR, S_IRUSR|S_IWUSR);
-            result->readHandle = open(result->filename, O_RDONLY, 0);
 
-            if(result->writeHandle < 0 || result->readHandle < 0)
-                goto _error_exit;
+        result->read_position = result->write_position = 0;
 
-        if (unlink(result->filename) < 0)
+        // Use the mapped mode if the temporary directory supports it
+        result->segments = g_ptr_array_new();
+        if (cache_get_segment(result, 0, TRUE) == NULL)
         {
-            close (result->writeHandle);
-            close (result->readHandle);
-        goto _error_exit;
-        }
-
-            result->read_position = result->write_position = 0;
+            g_ptr_array_free(result->segments, TRUE);
+            result->segments = NULL;
+            if (ftruncate(result->writeHandle, 0) < 0)
+            {
+                cache_close_file(result);
+                goto _error_exit;
+            }
         }
     }
     return result;
@@ -82,39 +229,84 @@ _error_exit:
 
 void destroy_cache(Cache* instance)
 {
-    close(instance->writeHandle);
-    close(instance->readHandle);
-    g_free(instance->filename);
+    if (instance->segments)
+    {
+        cache_release_segments(instance);
+        g_ptr_array_free(instance->segments, TRUE);
+    }
+
+    cache_close_file(instance);
 
     g_free(instance);
 }
 
+static void cache_write_mapped(Cache* cache, const guint8* data, gsize size)
+{
+    while (size > 0)
+    {
+        guint offset = (guint)(cache->write_position % MAPPED_SEGMENT_SIZE);
+        gsize chunk = MIN(size, (gsize)(MAPPED_SEGMENT_SIZE - offset));
+        MappedSegment* segment = cache_get_segment(cache, (guint)(cache->write_position / MAPPED_SEGMENT_SIZE), TRUE);
+
+        if (segment == NULL)
+            return; // Out of space, same as a failed write()
+
+        memcpy(segment->data + offset, data, chunk);
+        cache->write_position += chunk;
+        data += chunk;
+        size -= chunk;
+    }
+}
+
 void cache_write_buffer(Cache* cache, GstBuffer* buffer)
 {
     GstMapInfo info;
     if (gst_buffer_map(buffer, &info, GST_MAP_READ))
     {
-        ssize_t written = write(cache->writeHandle, info.data, info.size);
-        if (written > 0)
-            cache->write_position += written;
+        if (cache->segments)
+            cache_write_mapped(cache, info.data, info.size);
+        else
+        {
+            ssize_t written = write(cache->writeHandle, info.data, info.size);
+            if (written > 0)
+                cache->write_position += written;
+        }
         gst_buffer_unmap(buffer, &info);
     }
 }
 
-gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
+static gint64 cache_read_mapped(Cache* cache, guint size, GstBuffer** buffer)
 {
-    guint8 *data = (guint8*)g_try_malloc(DEFAULT_BUFFER_SIZE);
-    *buffer = NULL;
+    guint segment_left = MAPPED_SEGMENT_SIZE - (guint)(cache->read_position % MAPPED_SEGMENT_SIZE);
 
-    if (data)
+    if (size == 0)
+        return 0;
+
+    if (segment_left < size)
+        size = segment_left;
+
+    *buffer = gst_buffer_new();
+    if (*buffer == NULL)
+        return 0;
+
+    if (!cache_append_mapped_memory(cache, *buffer, cache->read_position, size))
     {
-        ssize_t size = 0;
-        if ((cache->write_position - cache->read_position) > 0 &&
-            (cache->write_position - cache->read_position) < DEFAULT_BUFFER_SIZE)
-            size = cache->write_position - cache->read_position;
-        else
-            size = DEFAULT_BUFFER_SIZE;
+        // INLINE - gst_buffer_unref()
+        gst_buffer_unref(*buffer);
+        *buffer = NULL;
+        return 0;
+    }
 
+    GST_BUFFER_OFFSET(*buffer) = cache->read_position;
+    cache->read_position += size;
+    return cache->read_position;
+}
+
+static gint64 cache_read_file(Cache* cache, guint size, GstBuffer** buffer)
+{
+    guint8 *data = (guint8*)g_try_malloc(DEFAULT_BUFFER_SIZE);
+    if (data)
+    {
         ssize_t read_bytes = read(cache->readHandle, data, size);
         if (read_bytes > 0)
         {
@@ -132,11 +324,72 @@ gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
     return 0;
 }
 
+gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
+{
+    gint64 available = cache->write_position - cache->read_position;
+    *buffer = NULL;
+
+    if (cache->segments)
+        return available > 0 ? cache_read_mapped(cache, (guint)MIN(available, DEFAULT_BUFFER_SIZE), buffer) : 0;
+
+    if (available > 0 && available < DEFAULT_BUFFER_SIZE)
+        return cache_read_file(cache, (guint)available, buffer);
+    else
+        return cache_read_file(cache, DEFAULT_BUFFER_SIZE, buffer);
+}
+
+gint64 cache_read_buffer_up_to(Cache* cache, guint size, GstBuffer** buffer)
+{
+    *buffer = NULL;
+    size = MIN(size, DEFAULT_BUFFER_SIZE);
+
+    if (cache->segments)
+        return cache_read_mapped(cache, size, buffer);
+
+    return size > 0 ? cache_read_file(cache, size, buffer) : 0;
+}
+
+static GstFlowReturn cache_read_mapped_from_position(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer)
+{
+    gint64 position = start_position;
+    guint left = size;
+
+    // Unwritten segments are not mapped, the caller checks the rest of the range
+    if (start_position < 0)
+        return GST_FLOW_ERROR;
+
+    *buffer = gst_buffer_new();
+    if (*buffer == NULL)
+        return GST_FLOW_ERROR;
+
+    // A range across segments gets a memory per segment
+    while (left > 0)
+    {
+        guint chunk = MIN(left, MAPPED_SEGMENT_SIZE - (guint)(position % MAPPED_SEGMENT_SIZE));
+        if (!cache_append_mapped_memory(cache, *buffer, position, chunk))
+        {
+            // INLINE - gst_buffer_unref()
+            gst_buffer_unref(*buffer);
+            *buffer = NULL;
+            return GST_FLOW_ERROR;
+        }
+        position += chunk;
+        left -= chunk;
+    }
+
+    GST_BUFFER_OFFSET(*buffer) = start_position;
+    cache->read_position = position;
+    return GST_FLOW_OK;
+}
+
 GstFlowReturn cache_read_buffer_from_position(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer)
 {
     GstFlowReturn result = GST_FLOW_ERROR;
     *buffer = NULL;
 
+    if (cache->segments)
+        return cache_read_mapped_from_position(cache, start_position, size, buffer);
+
     if (cache_set_read_position(cache, start_position))
     {
         guint8 *data = (guint8*)g_try_malloc(size);
@@ -169,7 +422,25 @@ static inline gboolean cache_set_handler_position(int handle, guint64 position)
 gboolean cache_set_write_position(Cache* cache, gint64 position)
 {
     gboolean result = (position == cache->write_position);
-    if (!result)
+    if (!result && cache->segments)
+    {
+        // Starting over, move to a new file so the old data stays intact
+        // under buffers that are still using it.
+        if (position == 0)
+        {
+            Cache old = *cache;
+            if (!cache_open_file(cache))
+            {
+                *cache = old;
+                return FALSE;
+            }
+            cache_release_segments(cache);
+            cache_close_file(&old);
+        }
+        cache->write_position = position;
+        return TRUE;
+    }
+    else if (!result)
     {
         result = cache_set_handler_position(cache->writeHandle, position);
         if (result)
@@ -178,10 +449,26 @@ gboolean cache_set_write_position(Cache* cache, gint64 position)
     return result;
 }
 
+gboolean cache_seek_write_position(Cache* cache, gint64 position)
+{
+    // Mapped segments are kept and writing past the end of the file leaves a hole
+    if (cache->segments)
+    {
+        cache->write_position = position;
+        return TRUE;
+    }
+    return cache_set_write_position(cache, position);
+}
+
 gboolean cache_set_read_position(Cache* cache, gint64 position)
 {
     gboolean result = (position == cache->read_position);
-    if (!result)
+    if (!result && cache->segments)
+    {
+        cache->read_position = position;
+        return TRUE;
+    }
+    else if (!result)
     {
         result = cache_set_handler_position(cache->readHandle, position);
         if (result)
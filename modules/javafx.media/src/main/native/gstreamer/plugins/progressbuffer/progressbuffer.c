@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -55,6 +55,13 @@ enum
  * Element structures are hidden from outside
  ***********************************************************************************/
 #define EOS_SIGNAL_LIMIT 1 // Send EOS notification only this amount of times
+#define NO_FILL -1
+
+typedef struct
+{
+    gint64        start;
+    gint64        stop;
+} CachedRange;
 
 struct EosStatus
 {
@@ -75,7 +82,9 @@ struct _ProgressBuffer
     // Cache infrastructure
     Cache         *cache;
     GstEvent      *pending_src_event;
-    gint64         cache_read_offset;
+    GArray        *cached_ranges; // CachedRange items written to the cache, sorted and apart
+    gint64         read_position;
+    gint64         fill_position; // Source seek issued to download a gap, NO_FILL if none
 
     GstSegment    sink_segment;
     gdouble       last_update;
@@ -256,7 +265,7 @@ static void progress_buffer_init(ProgressBuffer *element)
 
     element->srcpad = NULL;
     element->cache = NULL;
-    element->cache_read_offset = 0;
+    element->cached_ranges = g_array_new(FALSE, FALSE, sizeof(CachedRange));
     g_mutex_init(&element->lock);
     g_cond_init(&element->add_cond);
     element->bandwidth_timer = g_timer_new();
@@ -342,6 +351,8 @@ static void progress_buffer_finalize (GObject *object)
     if (element->cache)
         destroy_cache(element->cache);
 
+    g_array_free(element->cached_ranges, TRUE);
+
     g_mutex_clear(&element->lock);
     g_cond_clear(&element->add_cond);
     g_timer_destroy(element->bandwidth_timer);
@@ -499,6 +510,9 @@ static void progress_buffer_flush_data(ProgressBuffer *element)
     element->bandwidth = 0.0;
     element->subtotal = 0;
     element->pending_src_event = NULL;
+    element->read_position = 0;
+    element->fill_position = NO_FILL;
+    g_array_set_size(element->cached_ranges, 0);
     gst_segment_init (&element->sink_segment, GST_FORMAT_BYTES);
 
 #if ENABLE_PULL_MODE
@@ -522,6 +536,104 @@ static GstEventType progress_buffer_get_pending_event_type(ProgressBuffer *eleme
         return GST_EVENT_UNKNOWN;
 }
 
+/**
+ * progress_buffer_add_range()
+ *
+ * Records that the cache holds data from start to stop, merging the ranges it touches.
+ * Must be called in the locked context.
+ */
+static void progress_buffer_add_range(ProgressBuffer *element, gint64 start, gint64 stop)
+{
+    GArray      *ranges = element->cached_ranges;
+    CachedRange range = { start, stop };
+    guint       first = 0, last;
+
+    if (start >= stop)
+        return;
+
+    while (first < ranges->len && g_array_index(ranges, CachedRange, first).stop < start)
+        first++;
+
+    for (last = first; last < ranges->len && g_array_index(ranges, CachedRange, last).start <= stop; last++)
+    {
+        range.start = MIN(range.start, g_array_index(ranges, CachedRange, last).start);
+        range.stop = MAX(range.stop, g_array_index(ranges, CachedRange, last).stop);
+    }
+
+    if (last > first)
+        g_array_remove_range(ranges, first, last - first);
+    g_array_insert_val(ranges, first, range);
+}
+
+/**
+ * progress_buffer_get_cached_end()
+ *
+ * Returns the end of the cached data continuing from position, or position if it is not cached.
+ * Must be called in the locked context.
+ */
+static gint64 progress_buffer_get_cached_end(ProgressBuffer *element, gint64 position)
+{
+    guint i;
+
+    for (i = 0; i < element->cached_ranges->len; i++)
+    {
+        CachedRange *range = &g_array_index(element->cached_ranges, CachedRange, i);
+        if (range->start > position)
+            break;
+        if (position < range->stop)
+            return range->stop;
+    }
+    return position;
+}
+
+/**
+ * progress_buffer_fill_gap()
+ *
+ * Moves the source when it downloads data that is already cached, or when data is needed at
+ * position from a gap that the download does not reach within wait-tolerance. Only the gap is
+ * downloaded, the cached data after it is kept. Returns TRUE if a seek was sent to the source.
+ * Must be called in the locked context, the lock is released while seeking.
+ */
+static gboolean progress_buffer_fill_gap(ProgressBuffer *element, gint64 position)
+{
+#if ENABLE_SOURCE_SEEKING
+    gint64  write_position = element->sink_segment.position;
+    gint64  fill_position = progress_buffer_get_cached_end(element, write_position);
+    gdouble rate = element->sink_segment.rate;
+
+    if (element->srcresult != GST_FLOW_OK || element->fill_position != NO_FILL)
+        return FALSE;
+
+    if (fill_position == write_position || element->eos_status.eos)
+    {
+        fill_position = progress_buffer_get_cached_end(element, position);
+        if (fill_position >= write_position &&
+            (element->bandwidth == 0 || fill_position - write_position <= element->bandwidth * element->wait_tolerance))
+            return FALSE;
+    }
+
+    if (fill_position >= element->sink_segment.stop)
+        return FALSE;
+
+    element->fill_position = fill_position;
+    reset_eos(element, FALSE);
+    g_mutex_unlock(&element->lock);
+
+    if (!gst_pad_push_event(element->sinkpad, gst_event_new_seek(rate, GST_FORMAT_BYTES, GST_SEEK_FLAG_NONE,
+                            GST_SEEK_TYPE_SET, fill_position, GST_SEEK_TYPE_NONE, 0)))
+    {
+        g_mutex_lock(&element->lock);
+        element->fill_position = NO_FILL;
+        return FALSE;
+    }
+
+    g_mutex_lock(&element->lock);
+    return TRUE;
+#else
+    return FALSE;
+#endif
+}
+
 /**
  * send_position_message
  * Sends application message on the BUS with the following parameters:
@@ -574,6 +686,11 @@ static GstFlowReturn progress_buffer_enqueue_item(ProgressBuffer *element, GstMi
             return  GST_FLOW_ERROR;
 
         cache_write_buffer(element->cache, GST_BUFFER(item));
+        progress_buffer_add_range(element, GST_BUFFER_OFFSET(GST_BUFFER(item)), element->sink_segment.position);
+
+        // The download reached cached data, wake up the reader to move it to the next gap
+        if (progress_buffer_get_cached_end(element, element->sink_segment.position) > element->sink_segment.position)
+            signal = TRUE;
 
         elapsed = g_timer_elapsed(element->bandwidth_timer, NULL);
         element->subtotal += gst_buffer_get_size (GST_BUFFER(item));
@@ -612,6 +729,7 @@ static GstFlowReturn progress_buffer_enqueue_item(ProgressBuffer *element, GstMi
             case GST_EVENT_SEGMENT:
             {
                 GstSegment segment;
+                gboolean   fill;
 
                 element->unexpected = FALSE;
 
@@ -649,18 +767,26 @@ static GstFlowReturn progress_buffer_enqueue_item(ProgressBuffer *element, GstMi
                         gst_event_unref(event); // INLINE - gst_event_unref()
                         return GST_FLOW_ERROR;
                     }
+                    g_array_set_size(element->cached_ranges, 0);
                 }
+                else // Data cached before stays, the cache is addressed by stream position
+                    cache_seek_write_position(element->cache, segment.start);
+
+                gst_segment_copy_into (&segment, &element->sink_segment);
+
+                // The segment of a gap download is not a seek for the reader
+                fill = (element->fill_position != NO_FILL && element->fill_position == segment.start);
+                element->fill_position = NO_FILL;
+                if (fill)
+                    gst_event_unref(event); // INLINE - gst_event_unref()
                 else
                 {
-                    cache_set_write_position(element->cache, 0);
-                    cache_set_read_position(element->cache, 0);
-                    element->cache_read_offset = segment.start;
+                    cache_set_read_position(element->cache, segment.start);
+                    element->read_position = segment.start;
+                    progress_buffer_set_pending_event(element, event);
+                    element->instant_seek = TRUE;
                 }
 
-                gst_segment_copy_into (&segment, &element->sink_segment);
-                progress_buffer_set_pending_event(element, event);
-                element->instant_seek = TRUE;
-
                 signal = send_position_message(element, TRUE);
                 break;
             }
@@ -725,12 +851,14 @@ static gboolean progress_buffer_perform_push_seek(ProgressBuffer *element, GstPa
     element->srcresult = GST_FLOW_OK;
 
 #ifdef ENABLE_SOURCE_SEEKING
-    element->instant_seek = (position >= element->sink_segment.start &&
-                             (position - (gint64)element->sink_segment.position) <= element->bandwidth * element->wait_tolerance);
+    element->instant_seek = (progress_buffer_get_cached_end(element, position) > position ||
+                             (position >= element->sink_segment.start &&
+                              (position - (gint64)element->sink_segment.position) <= element->bandwidth * element->wait_tolerance));
 
     if (element->instant_seek)
     {
-        cache_set_read_position(element->cache, position - element->cache_read_offset);
+        cache_set_read_position(element->cache, position);
+        element->read_position = position;
         gst_segment_init(&segment, GST_FORMAT_BYTES);
         segment.rate = rate;
         segment.start = position;
@@ -742,9 +870,11 @@ static gboolean progress_buffer_perform_push_seek(ProgressBuffer *element, GstPa
     {
         // Clear any pending events, since we doing seek.
         reset_eos(element, TRUE);
+        element->fill_position = NO_FILL;
     }
 #else
-    cache_set_read_position(element->cache, position - element->cache_read_offset);
+    cache_set_read_position(element->cache, position);
+    element->read_position = position;
     gst_segment_init(&segment, GST_FORMAT_BYTES);
     segment.rate = rate;
     segment.start = position;
@@ -764,7 +894,8 @@ static gboolean progress_buffer_perform_push_seek(ProgressBuffer *element, GstPa
         if (!gst_pad_push_event(element->sinkpad, e))
         {
             element->instant_seek = TRUE;
-            cache_set_read_position(element->cache, position - element->cache_read_offset);
+            cache_set_read_position(element->cache, position);
+            element->read_position = position;
             gst_segment_init(&segment, GST_FORMAT_BYTES);
             segment.rate = rate;
             segment.start = position;
@@ -852,10 +983,15 @@ static void progress_buffer_loop(void *data)
 next_item:
     while (element->srcresult == GST_FLOW_OK &&
            element->pending_src_event == NULL &&
-           (!cache_has_enough_data(element->cache) || !element->instant_seek))
+           (progress_buffer_get_cached_end(element, element->read_position) == element->read_position ||
+            !element->instant_seek))
     {
         if (element->instant_seek)
+        {
+            if (progress_buffer_fill_gap(element, element->read_position))
+                continue;
             send_underrun_message(element);
+        }
         g_cond_wait(&element->add_cond, &element->lock);
     }
 
@@ -891,8 +1027,14 @@ next_item:
         else // create a buffer
         {
             GstBuffer *buffer = NULL;
-            guint64 read_position = cache_read_buffer(element->cache, &buffer);
-            read_position += element->cache_read_offset;
+            gint64 available = progress_buffer_get_cached_end(element, element->read_position) - element->read_position;
+            guint64 read_position;
+
+            if (progress_buffer_fill_gap(element, element->read_position))
+                goto next_item;
+
+            read_position = cache_read_buffer_up_to(element->cache, (guint)MIN(available, G_MAXUINT), &buffer);
+            element->read_position = read_position;
             GST_BUFFER_OFFSET(buffer) = read_position - gst_buffer_get_size(buffer);
 
             if (read_position == element->sink_segment.stop)
@@ -1011,16 +1153,10 @@ static gboolean progress_buffer_src_event(GstPad *pad, GstObject *parent, GstEve
 #if ENABLE_PULL_MODE
 #define VALID_RANGE(value)  (value != NO_RANGE_REQUEST)
 
-static inline gboolean pending_range_start(ProgressBuffer *element)
+static inline gboolean pending_range(ProgressBuffer *element)
 {
     return (VALID_RANGE(element->range_start) &&
-            element->sink_segment.start > element->range_start);
-}
-
-static inline gboolean pending_range_stop(ProgressBuffer *element)
-{
-    return (VALID_RANGE(element->range_stop) &&
-            element->sink_segment.position < element->range_stop);
+            progress_buffer_get_cached_end(element, element->range_start) < element->range_stop);
 }
 
 static gpointer progress_buffer_range_monitor(ProgressBuffer *element)
@@ -1029,9 +1165,11 @@ static gpointer progress_buffer_range_monitor(ProgressBuffer *element)
 
 check_loop:
     while (element->srcresult == GST_FLOW_OK && !pending_eos(element) &&
-           (pending_range_start(element) || pending_range_stop(element) ||
-           !VALID_RANGE(element->range_start) && !VALID_RANGE(element->range_stop)))
+           (pending_range(element) || !VALID_RANGE(element->range_start)))
     {
+        if (progress_buffer_fill_gap(element, VALID_RANGE(element->range_start) ?
+                                              element->range_start : element->sink_segment.position))
+            continue;
         g_cond_wait(&element->add_cond, &element->lock);
     }
 
@@ -1057,37 +1195,22 @@ static GstFlowReturn progress_buffer_getrange(GstPad *pad, GstObject *parent, gu
     ProgressBuffer *element = PROGRESS_BUFFER(parent);
     GstFlowReturn  result = GST_FLOW_OK;
     guint64        end_position = start_position + size;
-    gboolean       needs_seeking = FALSE;
 
     g_mutex_lock(&element->lock); // Use one lock for push and pull modes
 
     if (element->sink_segment.stop < (gint64)end_position)
         result = GST_FLOW_EOS;
-    else if (element->sink_segment.start <= (gint64)start_position &&
-             element->sink_segment.position >= (gint64)end_position)
+    else if (progress_buffer_get_cached_end(element, start_position) >= (gint64)end_position)
         result = cache_read_buffer_from_position(element->cache, start_position, size, buffer);
     else
     {
-#if ENABLE_SOURCE_SEEKING
-        needs_seeking = element->sink_segment.start > (gint64)start_position;
-        if (needs_seeking)
-        {
-            element->range_start = start_position;
-            reset_eos(element, TRUE);
-        }
-#endif
-        if (element->sink_segment.position < (gint64)end_position)
-        {
-            element->range_stop = end_position + (gint64)(element->bandwidth * element->prebuffer_time);
+        element->range_start = start_position;
+        element->range_stop = end_position + (gint64)(element->bandwidth * element->prebuffer_time);
 
-            if (element->sink_segment.stop < element->range_stop)
-                element->range_stop = element->sink_segment.stop;
+        if (element->sink_segment.stop < element->range_stop)
+            element->range_stop = element->sink_segment.stop;
 
-#if ENABLE_SOURCE_SEEKING
-            needs_seeking = element->bandwidth > 0 &&
-                end_position - element->sink_segment.position > element->bandwidth * element->wait_tolerance;
-#endif
-        }
+        progress_buffer_fill_gap(element, start_position);
 
         send_underrun_message(element);
         result = GST_FLOW_FLUSHING;
@@ -1095,10 +1218,6 @@ static GstFlowReturn progress_buffer_getrange(GstPad *pad, GstObject *parent, gu
 
     g_mutex_unlock(&element->lock);
 
-    if (needs_seeking)
-        gst_pad_push_event(element->sinkpad, gst_event_new_seek(element->sink_segment.rate, GST_FORMAT_BYTES, GST_SEEK_FLAG_NONE,
-            GST_SEEK_TYPE_SET, start_position, GST_SEEK_TYPE_NONE, 0));
-
     return result;
 #else
     ProgressBuffer *element = PROGRESS_BUFFER(GST_PAD_PARENT(pad));
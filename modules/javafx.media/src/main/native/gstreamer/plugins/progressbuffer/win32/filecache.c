@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 
 #include <cache.h>
 #include <windows.h>
+#include <winioctl.h>
 
 #define DEFAULT_BUFFER_SIZE 4096
 static char tempDir[MAX_PATH];
@@ -59,6 +60,7 @@ Cache* create_cache()
             goto _error_exit;
         else
         {
+            DWORD dwReturned = 0;
             result->writeHandle = CreateFile(result->filename, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ|FILE_SHARE_DELETE, NULL,
                                              CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY|FILE_FLAG_DELETE_ON_CLOSE, NULL);
             result->readHandle = CreateFile(result->filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE |FILE_SHARE_DELETE, NULL,
@@ -66,6 +68,10 @@ Cache* create_cache()
             if(result->writeHandle == INVALID_HANDLE_VALUE || result->readHandle == INVALID_HANDLE_VALUE)
                 goto _error_exit;
 
+            // Ranges written far apart should not allocate the space between them,
+            // the cache works without it
+            DeviceIoControl(result->writeHandle, FSCTL_SET_SPARSE, NULL, 0, NULL, 0, &dwReturned, NULL);
+
             result->read_position = result->write_position = 0;
         }
     }
@@ -96,17 +102,10 @@ void cache_write_buffer(Cache* cache, GstBuffer* buffer)
     }
 }
 
-gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
+static gint64 cache_read_file(Cache* cache, DWORD size, GstBuffer** buffer)
 {
     DWORD read = 0;
-    DWORD size = 0;
     guint8 *data = (guint8*)g_try_malloc(DEFAULT_BUFFER_SIZE);
-    *buffer = NULL;
-
-    if ((cache->write_position - cache->read_position) > 0 && (cache->write_position - cache->read_position) < DEFAULT_BUFFER_SIZE)
-        size = cache->write_position - cache->read_position;
-    else
-        size = DEFAULT_BUFFER_SIZE;
 
     if (data && ReadFile(cache->readHandle, data, size, &read, NULL))
     {
@@ -123,6 +122,25 @@ gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
     return 0;
 }
 
+gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
+{
+    DWORD size = 0;
+    *buffer = NULL;
+
+    if ((cache->write_position - cache->read_position) > 0 && (cache->write_position - cache->read_position) < DEFAULT_BUFFER_SIZE)
+        size = cache->write_position - cache->read_position;
+    else
+        size = DEFAULT_BUFFER_SIZE;
+
+    return cache_read_file(cache, size, buffer);
+}
+
+gint64 cache_read_buffer_up_to(Cache* cache, guint size, GstBuffer** buffer)
+{
+    *buffer = NULL;
+    return size > 0 ? cache_read_file(cache, MIN(size, DEFAULT_BUFFER_SIZE), buffer) : 0;
+}
+
 GstFlowReturn cache_read_buffer_from_position(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer)
 {
     GstFlowReturn result = GST_FLOW_ERROR;
@@ -175,6 +193,11 @@ gboolean cache_set_write_position(Cache* cache, gint64 position)
     return result;
 }
 
+gboolean cache_seek_write_position(Cache* cache, gint64 position)
+{
+    return cache_set_write_position(cache, position);
+}
+
 gboolean cache_set_read_position(Cache* cache, gint64 position)
 {
     gboolean result = (position == cache->read_position);
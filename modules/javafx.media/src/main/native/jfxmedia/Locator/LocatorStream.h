@@ -53,6 +53,13 @@ public:
      */
     virtual int  ReadBlock(int64_t position, int size) = 0;
 
+    /* ReadNextBlock and ReadBlock variants that read straight into destination,
+     * which can hold size bytes, so no CopyBlock call is needed. Return values
+     * are the same as above.
+     */
+    virtual int  ReadNextBlock(void* destination, int size) = 0;
+    virtual int  ReadBlock(int64_t position, int size, void* destination) = 0;
+
     /* CopyBlock copies the data from whatever internal buffer to the destination.*/
     virtual void CopyBlock(void* destination, int size) = 0;
 
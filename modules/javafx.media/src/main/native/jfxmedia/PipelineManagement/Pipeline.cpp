@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -193,3 +193,24 @@ CAudioSpectrum* CPipeline::GetAudioSpectrum()
 {
     return NULL;
 }
+
+uint32_t CPipeline::GetStatistics(int64_t* pValues, int iCount)
+{
+    if (NULL == pValues)
+        return ERROR_FUNCTION_PARAM_NULL;
+
+    for (int i = 0; i < iCount; i++)
+        pValues[i] = 0;
+
+    return ERROR_NONE;
+}
+
+uint32_t CPipeline::SetDecodePriority(int iPriority)
+{
+    return ERROR_NONE;
+}
+
+uint32_t CPipeline::SetOutputSizeHint(int iWidth, int iHeight)
+{
+    return ERROR_NONE;
+}
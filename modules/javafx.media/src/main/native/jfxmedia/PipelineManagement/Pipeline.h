@@ -92,6 +92,10 @@ public:
     virtual CAudioEqualizer*    GetAudioEqualizer();
     virtual CAudioSpectrum*     GetAudioSpectrum();
 
+    virtual uint32_t        GetStatistics(int64_t* pValues, int iCount);
+    virtual uint32_t        SetDecodePriority(int iPriority);
+    virtual uint32_t        SetOutputSizeHint(int iWidth, int iHeight);
+
     CPlayerEventDispatcher* m_pEventDispatcher;
 
 protected:
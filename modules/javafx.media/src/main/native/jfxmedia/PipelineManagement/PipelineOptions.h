@@ -47,6 +47,7 @@ public:
         m_StreamMimeType(-1),
         m_AudioStreamMimeType(-1),
         m_bHLSModeEnabled(false),
+        m_bHLSLowLatency(false),
         m_audioFlags(0)
     {}
 
@@ -70,6 +71,9 @@ public:
     inline void SetHLSModeEnabled(bool enabled) { m_bHLSModeEnabled = enabled; }
     inline bool GetHLSModeEnabled() { return m_bHLSModeEnabled; }
 
+    inline void SetHLSLowLatency(bool enabled) { m_bHLSLowLatency = enabled; }
+    inline bool GetHLSLowLatency() { return m_bHLSLowLatency; }
+
     inline void  SetAudioFlags(int audioFlags) { m_audioFlags = audioFlags; }
     inline int  GetAudioFlags() { return m_audioFlags; }
 
@@ -108,6 +112,8 @@ private:
     // and main stream mime type HLS.
     int         m_AudioStreamMimeType;
     bool        m_bHLSModeEnabled;
+    // Live HLS stream played close to the live edge
+    bool        m_bHLSLowLatency;
     int         m_audioFlags;
 
     // Audio parser or demultiplexer for main stream
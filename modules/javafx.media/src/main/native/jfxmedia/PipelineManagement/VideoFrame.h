@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,7 +48,8 @@ public:
         BGRA_PRE = 2,
         YCbCr_420p = 100,
         YCbCr_422 = 101,
-        YCbCr_422_rev = 102
+        YCbCr_422_rev = 102,
+        YCbCr_420p10 = 103
     };
 
 public:
@@ -75,6 +76,10 @@ public:
 
     virtual CVideoFrame *ConvertToFormat(FrameType type);
 
+    // Platform surface holding the frame on the GPU (an IOSurfaceRef on
+    // macOS), valid as long as the frame, or NULL if there is none
+    virtual void*       GetNativeSurface() { return NULL; }
+
     bool                GetFrameDirty() { return m_FrameDirty; }
     void                SetFrameDirty(bool dirty) { m_FrameDirty = dirty; }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 #include <Common/ProductFlags.h>
 #include "ColorConverter.h"
 #include <stdio.h>
+#include <string.h>
 
 #if (! TARGET_OS_LINUX || defined(__SSE2__))
 #if defined(TARGET_OS_MAC_ARM64)
@@ -37,6 +38,18 @@
 #define ENABLE_SIMD_SSE2 0
 #endif
 
+#if ENABLE_SIMD_SSE2 && (defined(__GNUC__) || defined(_MSC_VER))
+#define ENABLE_SIMD_AVX2 1
+#else
+#define ENABLE_SIMD_AVX2 0
+#endif
+
+#if !ENABLE_SIMD_SSE2 && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define ENABLE_SIMD_NEON 1
+#else
+#define ENABLE_SIMD_NEON 0
+#endif
+
 // --- Begin macros
 #define TCLAMP_U8(val, dst) dst = pClip[val]
 
@@ -380,6 +393,704 @@ const uint16_t color_tBU[256] = {
 };
 // --- End tables
 
+// --- Begin fixed-point conversion
+/*
+ * Coefficients of the fixed-point conversion done by the SIMD functions.
+ * The samples are multiplied in the upper byte of a 16-bit lane and only
+ * the upper 16 bits of the product are kept, which is the same as
+ * (sample * coefficient) >> 8.
+ */
+#define COLOR_FP_C0     0x2543      /* 1.1644  * 8192 */
+#define COLOR_FP_C1     0x4097      /* 2.0184  * 8192 */
+#define COLOR_FP_C4     0x0c8b      /* abs( -0.3920 * 8192 ) */
+#define COLOR_FP_C5     0x1a06      /* abs( -0.8132 * 8192 ) */
+#define COLOR_FP_C8     0x3317      /* 1.5966  * 8192 */
+#define COLOR_FP_COFF0  (-0x22a0)   /* -276.9856 * 32 */
+#define COLOR_FP_COFF1  0x10f4      /* 135.6352  * 32 */
+#define COLOR_FP_COFF2  (-0x1be0)   /* -222.9952 * 32 */
+
+#define COLOR_FP_CLAMP(val) ((val) < 0 ? 0 : ((val) > 255 ? 255 : (val)))
+
+/*
+ * Converts pairs of pixels sharing one chroma sample, with the same results
+ * as the SIMD functions. y_step and uv_step are the distances between
+ * neighbouring luma and chroma samples: 1 and 1 for planar data, 2 and 4
+ * for packed 4:2:2 data. Alpha is premultiplied into BGRA and stored as is
+ * into ARGB.
+ */
+static void ColorConvert_FixedPointPairs(uint8_t *dst, int32_t pairs,
+                                         const uint8_t *y, int32_t y_step,
+                                         const uint8_t *u, const uint8_t *v,
+                                         int32_t uv_step, const uint8_t *a,
+                                         int bgra)
+{
+    int32_t i, k;
+
+    for (i = 0; i < pairs; i++) {
+        int32_t iu = u[i * uv_step];
+        int32_t iv = v[i * uv_step];
+        int32_t ib = COLOR_FP_COFF0 + ((iu * COLOR_FP_C1) >> 8);
+        int32_t ig = COLOR_FP_COFF1 - (((iu * COLOR_FP_C4) >> 8) + ((iv * COLOR_FP_C5) >> 8));
+        int32_t ir = COLOR_FP_COFF2 + ((iv * COLOR_FP_C8) >> 8);
+
+        for (k = 0; k < 2; k++) {
+            int32_t yy = (y[(2 * i + k) * y_step] * COLOR_FP_C0) >> 8;
+            int32_t b = (yy + ib) >> 5;
+            int32_t g = (yy + ig) >> 5;
+            int32_t r = (yy + ir) >> 5;
+            int32_t alpha = a ? a[2 * i + k] : 0xff;
+
+            b = COLOR_FP_CLAMP(b);
+            g = COLOR_FP_CLAMP(g);
+            r = COLOR_FP_CLAMP(r);
+
+            if (bgra) {
+                if (a) {
+                    b = (b * (alpha + 1)) >> 8;
+                    g = (g * (alpha + 1)) >> 8;
+                    r = (r * (alpha + 1)) >> 8;
+                }
+                dst[0] = (uint8_t)b;
+                dst[1] = (uint8_t)g;
+                dst[2] = (uint8_t)r;
+                dst[3] = (uint8_t)alpha;
+            } else {
+                dst[0] = (uint8_t)alpha;
+                dst[1] = (uint8_t)r;
+                dst[2] = (uint8_t)g;
+                dst[3] = (uint8_t)b;
+            }
+            dst += 4;
+        }
+    }
+}
+
+/*
+ * Packed 4:2:2 data is only handled by the SIMD functions in the UYVY order
+ * the callers pass in.
+ */
+#define COLOR_IS_UYVY(y, v, u) ((y) == (u) + 1 && (v) == (u) + 2)
+// --- End fixed-point conversion
+
+// --- Begin table conversion
+/*
+ * Every entry of color_tYY, color_tRV, color_tGU, color_tGV and color_tBU
+ * equals (i * k + b) >> shift with the constants below, so the SIMD
+ * functions can compute the table-based 4:2:2 BGRA conversion exactly.
+ * color_tGU also needs COLOR_TAB_GU_OFF added. color_tClip[v] is
+ * (v >> 1) clamped to 0..255.
+ */
+#define COLOR_TAB_YY        9539, 2007, 12
+#define COLOR_TAB_RV        13079, 2111, 12
+#define COLOR_TAB_GU        (-6423), 6386, 13
+#define COLOR_TAB_GV        13323, 4130, 13
+#define COLOR_TAB_BU        16535, 2029, 12
+#define COLOR_TAB_GU_OFF    271
+#define COLOR_TAB_RRI       446
+#define COLOR_TAB_BBI       554
+
+/*
+ * Converts pairs of packed 4:2:2 pixels to BGRA with the tables. y, u and
+ * v point into the same UYVY data.
+ */
+static void ColorConvert_TablePairsBGRA(uint8_t *dst, int32_t pairs,
+                                        const uint8_t *y, const uint8_t *u,
+                                        const uint8_t *v)
+{
+    uint8_t *const pClip = (uint8_t *const)color_tClip + 288 * 2;
+    int32_t i;
+
+    for (i = 0; i < pairs; i++) {
+        int32_t sf01, sf03, sf1, sf2, sfr, sfg, sfb;
+
+        sf1 = u[0];
+        sf2 = v[0];
+
+        sf01 = y[0];
+        sf03 = y[2];
+
+        sfr = color_tRV[sf2] - COLOR_TAB_RRI;
+        sfg = color_tGU[sf1] - color_tGV[sf2];
+        sfb = color_tBU[sf1] - COLOR_TAB_BBI;
+
+        sf01 = color_tYY[sf01];
+        sf03 = color_tYY[sf03];
+
+        TCLAMP_U8(sf01 + sfr, dst[2]);
+        TCLAMP_U8(sf01 + sfg, dst[1]);
+        SCLAMP_U8(sf01 + sfb, dst[0]);
+        TCLAMP_U8(sf03 + sfr, dst[6]);
+        TCLAMP_U8(sf03 + sfg, dst[5]);
+        SCLAMP_U8(sf03 + sfb, dst[4]);
+
+        dst[3] = dst[7] = 0xff;
+
+        y += 4;
+        u += 4;
+        v += 4;
+        dst += 8;
+    }
+}
+// --- End table conversion
+
+#if ENABLE_SIMD_AVX2
+// --- Begin AVX2 conversion functions
+/*
+ * The library is built for SSE2, the AVX2 functions are compiled for their
+ * own target and only called after the processor was checked for it.
+ */
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define COLOR_TARGET_AVX2
+#else
+#define COLOR_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+static int color_hasAVX2 = -1;
+
+static int ColorConvert_HasAVX2(void)
+{
+    if (color_hasAVX2 < 0) {
+#if defined(_MSC_VER)
+        int info[4];
+        int maxLeaf, osxsave, avx;
+
+        __cpuid(info, 0);
+        maxLeaf = info[0];
+        __cpuid(info, 1);
+        osxsave = (info[2] & (1 << 27)) != 0;
+        avx = (info[2] & (1 << 28)) != 0;
+
+        // AVX2 also needs the OS to save the YMM registers.
+        color_hasAVX2 = 0;
+        if (osxsave && avx && maxLeaf >= 7 && (_xgetbv(0) & 6) == 6) {
+            __cpuidex(info, 7, 0);
+            color_hasAVX2 = (info[1] & (1 << 5)) != 0;
+        }
+#else
+        __builtin_cpu_init();
+        color_hasAVX2 = __builtin_cpu_supports("avx2") ? 1 : 0;
+#endif
+    }
+
+    return color_hasAVX2;
+}
+
+/*
+ * Interleaves 32 pixels from four registers holding one byte per pixel,
+ * in the order they are stored in memory.
+ */
+COLOR_TARGET_AVX2
+static void avx2_StorePixels(uint8_t *dst, __m256i c0, __m256i c1, __m256i c2, __m256i c3)
+{
+    __m256i x_lo01 = _mm256_unpacklo_epi8(c0, c1);   // 0-7, 16-23
+    __m256i x_hi01 = _mm256_unpackhi_epi8(c0, c1);   // 8-15, 24-31
+    __m256i x_lo23 = _mm256_unpacklo_epi8(c2, c3);
+    __m256i x_hi23 = _mm256_unpackhi_epi8(c2, c3);
+    __m256i x_p0 = _mm256_unpacklo_epi16(x_lo01, x_lo23);    // 0-3, 16-19
+    __m256i x_p1 = _mm256_unpackhi_epi16(x_lo01, x_lo23);    // 4-7, 20-23
+    __m256i x_p2 = _mm256_unpacklo_epi16(x_hi01, x_hi23);    // 8-11, 24-27
+    __m256i x_p3 = _mm256_unpackhi_epi16(x_hi01, x_hi23);    // 12-15, 28-31
+
+    _mm256_storeu_si256((__m256i*)dst, _mm256_permute2x128_si256(x_p0, x_p1, 0x20));
+    _mm256_storeu_si256((__m256i*)(dst + 32), _mm256_permute2x128_si256(x_p2, x_p3, 0x20));
+    _mm256_storeu_si256((__m256i*)(dst + 64), _mm256_permute2x128_si256(x_p0, x_p1, 0x31));
+    _mm256_storeu_si256((__m256i*)(dst + 96), _mm256_permute2x128_si256(x_p2, x_p3, 0x31));
+}
+
+/*
+ * Adds the chroma term to the scaled luma of the even and odd pixels and
+ * returns the clamped channel, even pixels in the low and odd pixels in
+ * the high byte of each lane.
+ */
+COLOR_TARGET_AVX2
+static __m256i avx2_Channel(__m256i x_ye, __m256i x_yo, __m256i x_c)
+{
+    const __m256i x_zero = _mm256_setzero_si256();
+    const __m256i x_max = _mm256_set1_epi16(0xff);
+    __m256i x_e = _mm256_srai_epi16(_mm256_add_epi16(x_ye, x_c), 5);
+    __m256i x_o = _mm256_srai_epi16(_mm256_add_epi16(x_yo, x_c), 5);
+
+    x_e = _mm256_min_epi16(_mm256_max_epi16(x_e, x_zero), x_max);
+    x_o = _mm256_min_epi16(_mm256_max_epi16(x_o, x_zero), x_max);
+    return _mm256_or_si256(x_e, _mm256_slli_epi16(x_o, 8));
+}
+
+/*
+ * cc = 32 color values
+ * aa = 32 corresponding alpha values to premultiply with
+ */
+COLOR_TARGET_AVX2
+static __m256i avx2_Premultiply(__m256i x_cc, __m256i x_aa)
+{
+    const __m256i x_one = _mm256_set1_epi16(0x0001);
+    const __m256i x_mask = _mm256_set1_epi16(0x00ff);
+    __m256i x_ae = _mm256_add_epi16(_mm256_and_si256(x_aa, x_mask), x_one);
+    __m256i x_ao = _mm256_add_epi16(_mm256_srli_epi16(x_aa, 8), x_one);
+    __m256i x_ce = _mm256_mullo_epi16(_mm256_and_si256(x_cc, x_mask), x_ae);
+    __m256i x_co = _mm256_mullo_epi16(_mm256_srli_epi16(x_cc, 8), x_ao);
+
+    return _mm256_or_si256(_mm256_srli_epi16(x_ce, 8), _mm256_andnot_si256(x_mask, x_co));
+}
+
+/*
+ * Converts 32 pixels. The luma of the even and odd pixels and the chroma of
+ * each pixel pair are in the upper byte of 16-bit lanes.
+ */
+COLOR_TARGET_AVX2
+static void avx2_ConvertPixels(uint8_t *dst, __m256i x_ye, __m256i x_yo,
+                               __m256i x_u, __m256i x_v, const uint8_t *a,
+                               int bgra)
+{
+    const __m256i x_c0 = _mm256_set1_epi16(COLOR_FP_C0);
+    __m256i x_b, x_g, x_r, x_a;
+
+    x_ye = _mm256_mulhi_epu16(x_ye, x_c0);
+    x_yo = _mm256_mulhi_epu16(x_yo, x_c0);
+
+    x_b = _mm256_add_epi16(_mm256_mulhi_epu16(x_u, _mm256_set1_epi16(COLOR_FP_C1)),
+                           _mm256_set1_epi16(COLOR_FP_COFF0));
+    x_g = _mm256_sub_epi16(_mm256_set1_epi16(COLOR_FP_COFF1),
+                           _mm256_add_epi16(_mm256_mulhi_epu16(x_u, _mm256_set1_epi16(COLOR_FP_C4)),
+                                            _mm256_mulhi_epu16(x_v, _mm256_set1_epi16(COLOR_FP_C5))));
+    x_r = _mm256_add_epi16(_mm256_mulhi_epu16(x_v, _mm256_set1_epi16(COLOR_FP_C8)),
+                           _mm256_set1_epi16(COLOR_FP_COFF2));
+
+    x_b = avx2_Channel(x_ye, x_yo, x_b);
+    x_g = avx2_Channel(x_ye, x_yo, x_g);
+    x_r = avx2_Channel(x_ye, x_yo, x_r);
+
+    if (a) {
+        x_a = _mm256_loadu_si256((const __m256i*)a);
+    } else {
+        x_a = _mm256_set1_epi8((char)0xff);
+    }
+
+    if (bgra) {
+        if (a) {
+            x_b = avx2_Premultiply(x_b, x_a);
+            x_g = avx2_Premultiply(x_g, x_a);
+            x_r = avx2_Premultiply(x_r, x_a);
+        }
+        avx2_StorePixels(dst, x_b, x_g, x_r, x_a);
+    } else {
+        avx2_StorePixels(dst, x_a, x_r, x_g, x_b);
+    }
+}
+
+/*
+ * Converts one row of planar 4:2:0 data, 32 pixels at a time.
+ */
+COLOR_TARGET_AVX2
+static void avx2_ConvertRow420(uint8_t *dst, int32_t width, const uint8_t *y,
+                               const uint8_t *u, const uint8_t *v,
+                               const uint8_t *a, int bgra)
+{
+    const __m256i x_mask = _mm256_set1_epi16((short)0xff00);
+    __m256i x_u, x_v, x_y;
+    int32_t iW;
+
+    for (iW = 0; iW <= width - 32; iW += 32) {
+        x_u = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(u + (iW >> 1))));
+        x_v = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(v + (iW >> 1))));
+        x_y = _mm256_loadu_si256((const __m256i*)(y + iW));
+
+        avx2_ConvertPixels(dst + 4 * iW,
+                           _mm256_slli_epi16(x_y, 8), _mm256_and_si256(x_y, x_mask),
+                           _mm256_slli_epi16(x_u, 8), _mm256_slli_epi16(x_v, 8),
+                           a ? a + iW : NULL, bgra);
+    }
+
+    ColorConvert_FixedPointPairs(dst + 4 * iW, (width - iW) >> 1,
+                                 y + iW, 1, u + (iW >> 1), v + (iW >> 1), 1,
+                                 a ? a + iW : NULL, bgra);
+}
+
+COLOR_TARGET_AVX2
+static int avx2_YCbCr420p(uint8_t *dst, int32_t dst_stride,
+                          int32_t width, int32_t height,
+                          const uint8_t *y, const uint8_t *v,
+                          const uint8_t *u, const uint8_t *a,
+                          int32_t y_stride, int32_t v_stride,
+                          int32_t u_stride, int32_t a_stride, int bgra)
+{
+    int32_t jH;
+
+    for (jH = 0; jH < (height >> 1); jH++) {
+        avx2_ConvertRow420(dst, width, y, u, v, a, bgra);
+        avx2_ConvertRow420(dst + dst_stride, width, y + y_stride, u, v,
+                           a ? a + a_stride : NULL, bgra);
+
+        dst += 2 * dst_stride;
+        y += 2 * y_stride;
+        u += u_stride;
+        v += v_stride;
+        if (a) {
+            a += 2 * a_stride;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Moves one byte of each UYVY group in two registers into the upper byte
+ * of 16-bit lanes, keeping the order of the groups.
+ */
+COLOR_TARGET_AVX2
+static __m256i avx2_Pack422(__m256i x_l0, __m256i x_l1)
+{
+    const __m256i x_mask = _mm256_set1_epi32(0xff00);
+    __m256i x_p = _mm256_packus_epi32(_mm256_and_si256(x_l0, x_mask),
+                                      _mm256_and_si256(x_l1, x_mask));
+
+    return _mm256_permute4x64_epi64(x_p, 0xd8);
+}
+
+/*
+ * Converts one row of packed UYVY data to ARGB, 32 pixels at a time.
+ */
+COLOR_TARGET_AVX2
+static void avx2_ConvertRow422(uint8_t *dst, int32_t width, const uint8_t *uyvy)
+{
+    __m256i x_l0, x_l1;
+    int32_t iW;
+
+    for (iW = 0; iW <= width - 32; iW += 32) {
+        x_l0 = _mm256_loadu_si256((const __m256i*)(uyvy + 2 * iW));
+        x_l1 = _mm256_loadu_si256((const __m256i*)(uyvy + 2 * iW + 32));
+
+        avx2_ConvertPixels(dst + 4 * iW,
+                           avx2_Pack422(x_l0, x_l1),
+                           avx2_Pack422(_mm256_srli_epi32(x_l0, 16), _mm256_srli_epi32(x_l1, 16)),
+                           avx2_Pack422(_mm256_slli_epi32(x_l0, 8), _mm256_slli_epi32(x_l1, 8)),
+                           avx2_Pack422(_mm256_srli_epi32(x_l0, 8), _mm256_srli_epi32(x_l1, 8)),
+                           NULL, 0);
+    }
+
+    ColorConvert_FixedPointPairs(dst + 4 * iW, (width - iW) >> 1,
+                                 uyvy + 2 * iW + 1, 2, uyvy + 2 * iW, uyvy + 2 * iW + 2, 4,
+                                 NULL, 0);
+}
+
+/*
+ * (x * k + b) >> shift for samples in the low 16 bits of 32-bit lanes.
+ */
+COLOR_TARGET_AVX2
+static __m256i avx2_Table(__m256i x_x, int32_t k, int32_t b, int shift)
+{
+    __m256i x_p = _mm256_madd_epi16(_mm256_or_si256(x_x, _mm256_set1_epi32(0x10000)),
+                                    _mm256_set1_epi32((b << 16) | (k & 0xffff)));
+
+    return _mm256_sra_epi32(x_p, _mm_cvtsi32_si128(shift));
+}
+
+/*
+ * Clamps the sum of the luma and chroma table entries like color_tClip.
+ */
+COLOR_TARGET_AVX2
+static __m256i avx2_TableChannel(__m256i x_y, __m256i x_c)
+{
+    __m256i x_s = _mm256_srai_epi32(_mm256_add_epi32(x_y, x_c), 1);
+
+    return _mm256_min_epi32(_mm256_max_epi32(x_s, _mm256_setzero_si256()),
+                            _mm256_set1_epi32(0xff));
+}
+
+COLOR_TARGET_AVX2
+static __m256i avx2_TablePixels(__m256i x_y, __m256i x_r, __m256i x_g, __m256i x_b)
+{
+    __m256i x_p = _mm256_or_si256(avx2_TableChannel(x_y, x_b),
+                                  _mm256_slli_epi32(avx2_TableChannel(x_y, x_g), 8));
+
+    x_p = _mm256_or_si256(x_p, _mm256_slli_epi32(avx2_TableChannel(x_y, x_r), 16));
+    return _mm256_or_si256(x_p, _mm256_set1_epi32((int)0xff000000));
+}
+
+/*
+ * Converts one row of packed UYVY data to BGRA, 16 pixels at a time, with
+ * the same results as the table-based code.
+ */
+COLOR_TARGET_AVX2
+static void avx2_ConvertRow422Table(uint8_t *dst, int32_t width, const uint8_t *uyvy)
+{
+    const __m256i x_mask = _mm256_set1_epi32(0xff);
+    int32_t iW;
+
+    for (iW = 0; iW <= width - 16; iW += 16) {
+        __m256i x_l = _mm256_loadu_si256((const __m256i*)(uyvy + 2 * iW));
+        __m256i x_u = _mm256_and_si256(x_l, x_mask);
+        __m256i x_v = _mm256_and_si256(_mm256_srli_epi32(x_l, 16), x_mask);
+        __m256i x_ye = avx2_Table(_mm256_and_si256(_mm256_srli_epi32(x_l, 8), x_mask), COLOR_TAB_YY);
+        __m256i x_yo = avx2_Table(_mm256_srli_epi32(x_l, 24), COLOR_TAB_YY);
+        __m256i x_r = _mm256_sub_epi32(avx2_Table(x_v, COLOR_TAB_RV),
+                                       _mm256_set1_epi32(COLOR_TAB_RRI));
+        __m256i x_g = _mm256_sub_epi32(_mm256_add_epi32(avx2_Table(x_u, COLOR_TAB_GU),
+                                                        _mm256_set1_epi32(COLOR_TAB_GU_OFF)),
+                                       avx2_Table(x_v, COLOR_TAB_GV));
+        __m256i x_b = _mm256_sub_epi32(avx2_Table(x_u, COLOR_TAB_BU),
+                                       _mm256_set1_epi32(COLOR_TAB_BBI));
+        __m256i x_pe = avx2_TablePixels(x_ye, x_r, x_g, x_b);
+        __m256i x_po = avx2_TablePixels(x_yo, x_r, x_g, x_b);
+        __m256i x_lo = _mm256_unpacklo_epi32(x_pe, x_po);   // 0-3, 8-11
+        __m256i x_hi = _mm256_unpackhi_epi32(x_pe, x_po);   // 4-7, 12-15
+
+        _mm256_storeu_si256((__m256i*)(dst + 4 * iW), _mm256_permute2x128_si256(x_lo, x_hi, 0x20));
+        _mm256_storeu_si256((__m256i*)(dst + 4 * iW + 32), _mm256_permute2x128_si256(x_lo, x_hi, 0x31));
+    }
+
+    ColorConvert_TablePairsBGRA(dst + 4 * iW, (width - iW) >> 1,
+                                uyvy + 2 * iW + 1, uyvy + 2 * iW, uyvy + 2 * iW + 2);
+}
+
+COLOR_TARGET_AVX2
+static int avx2_YCbCr422p(uint8_t *dst, int32_t dst_stride,
+                          int32_t width, int32_t height,
+                          const uint8_t *uyvy, int32_t stride, int bgra)
+{
+    int32_t jH;
+
+    for (jH = 0; jH < height; jH++) {
+        if (bgra) {
+            avx2_ConvertRow422Table(dst, width, uyvy);
+        } else {
+            avx2_ConvertRow422(dst, width, uyvy);
+        }
+        dst += dst_stride;
+        uyvy += stride;
+    }
+
+    return 0;
+}
+// --- End AVX2 conversion functions
+#endif // ENABLE_SIMD_AVX2
+
+#if ENABLE_SIMD_NEON
+// --- Begin NEON conversion functions
+#include <arm_neon.h>
+
+/* (x * c) >> 8 for samples in the low byte, like _mm_mulhi_epu16 above */
+static int16x8_t neon_MulHi(uint16x8_t x, uint16_t c)
+{
+    uint16x4_t lo = vshrn_n_u32(vmull_n_u16(vget_low_u16(x), c), 8);
+    uint16x4_t hi = vshrn_n_u32(vmull_n_u16(vget_high_u16(x), c), 8);
+
+    return vreinterpretq_s16_u16(vcombine_u16(lo, hi));
+}
+
+/*
+ * Adds the chroma term to the scaled luma of the even and odd pixels and
+ * returns the clamped channel of the 16 pixels in order.
+ */
+static uint8x16_t neon_Channel(int16x8_t ye, int16x8_t yo, int16x8_t c)
+{
+    uint8x8x2_t px = vzip_u8(vqshrun_n_s16(vaddq_s16(ye, c), 5),
+                             vqshrun_n_s16(vaddq_s16(yo, c), 5));
+
+    return vcombine_u8(px.val[0], px.val[1]);
+}
+
+static uint8x16_t neon_Premultiply(uint8x16_t cc, uint8x16_t aa)
+{
+    uint16x8_t lo = vaddw_u8(vmull_u8(vget_low_u8(cc), vget_low_u8(aa)), vget_low_u8(cc));
+    uint16x8_t hi = vaddw_u8(vmull_u8(vget_high_u8(cc), vget_high_u8(aa)), vget_high_u8(cc));
+
+    return vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+}
+
+/*
+ * Converts 16 pixels from the luma of the even and odd pixels and the
+ * chroma of each pixel pair.
+ */
+static void neon_ConvertPixels(uint8_t *dst, uint8x8_t yEven, uint8x8_t yOdd,
+                               uint8x8_t u8, uint8x8_t v8, const uint8_t *a,
+                               int bgra)
+{
+    uint16x8_t u = vmovl_u8(u8);
+    uint16x8_t v = vmovl_u8(v8);
+    int16x8_t ye = neon_MulHi(vmovl_u8(yEven), COLOR_FP_C0);
+    int16x8_t yo = neon_MulHi(vmovl_u8(yOdd), COLOR_FP_C0);
+    int16x8_t cb = vaddq_s16(neon_MulHi(u, COLOR_FP_C1), vdupq_n_s16(COLOR_FP_COFF0));
+    int16x8_t cg = vsubq_s16(vdupq_n_s16(COLOR_FP_COFF1),
+                             vaddq_s16(neon_MulHi(u, COLOR_FP_C4), neon_MulHi(v, COLOR_FP_C5)));
+    int16x8_t cr = vaddq_s16(neon_MulHi(v, COLOR_FP_C8), vdupq_n_s16(COLOR_FP_COFF2));
+    uint8x16x4_t px;
+    uint8x16_t b = neon_Channel(ye, yo, cb);
+    uint8x16_t g = neon_Channel(ye, yo, cg);
+    uint8x16_t r = neon_Channel(ye, yo, cr);
+    uint8x16_t alpha = a ? vld1q_u8(a) : vdupq_n_u8(0xff);
+
+    if (bgra) {
+        if (a) {
+            b = neon_Premultiply(b, alpha);
+            g = neon_Premultiply(g, alpha);
+            r = neon_Premultiply(r, alpha);
+        }
+        px.val[0] = b;
+        px.val[1] = g;
+        px.val[2] = r;
+        px.val[3] = alpha;
+    } else {
+        px.val[0] = alpha;
+        px.val[1] = r;
+        px.val[2] = g;
+        px.val[3] = b;
+    }
+    vst4q_u8(dst, px);
+}
+
+/*
+ * Converts one row of planar 4:2:0 data, 16 pixels at a time.
+ */
+static void neon_ConvertRow420(uint8_t *dst, int32_t width, const uint8_t *y,
+                               const uint8_t *u, const uint8_t *v,
+                               const uint8_t *a, int bgra)
+{
+    int32_t iW;
+
+    for (iW = 0; iW <= width - 16; iW += 16) {
+        uint8x8x2_t yy = vld2_u8(y + iW);
+
+        neon_ConvertPixels(dst + 4 * iW, yy.val[0], yy.val[1],
+                           vld1_u8(u + (iW >> 1)), vld1_u8(v + (iW >> 1)),
+                           a ? a + iW : NULL, bgra);
+    }
+
+    ColorConvert_FixedPointPairs(dst + 4 * iW, (width - iW) >> 1,
+                                 y + iW, 1, u + (iW >> 1), v + (iW >> 1), 1,
+                                 a ? a + iW : NULL, bgra);
+}
+
+static int neon_YCbCr420p(uint8_t *dst, int32_t dst_stride,
+                          int32_t width, int32_t height,
+                          const uint8_t *y, const uint8_t *v,
+                          const uint8_t *u, const uint8_t *a,
+                          int32_t y_stride, int32_t v_stride,
+                          int32_t u_stride, int32_t a_stride, int bgra)
+{
+    int32_t jH;
+
+    if (dst == NULL || y == NULL || u == NULL || v == NULL)
+        return 1;
+
+    if (width <= 0 || height <= 0)
+        return 1;
+
+    for (jH = 0; jH < (height >> 1); jH++) {
+        neon_ConvertRow420(dst, width, y, u, v, a, bgra);
+        neon_ConvertRow420(dst + dst_stride, width, y + y_stride, u, v,
+                           a ? a + a_stride : NULL, bgra);
+
+        dst += 2 * dst_stride;
+        y += 2 * y_stride;
+        u += u_stride;
+        v += v_stride;
+        if (a) {
+            a += 2 * a_stride;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * (x * k + b) >> shift for 8 samples.
+ */
+static int16x8_t neon_Table(uint8x8_t x8, int16_t k, int32_t b, int shift)
+{
+    int16x8_t x = vreinterpretq_s16_u16(vmovl_u8(x8));
+    int32x4_t s = vdupq_n_s32(-shift);
+    int32x4_t lo = vshlq_s32(vmlal_n_s16(vdupq_n_s32(b), vget_low_s16(x), k), s);
+    int32x4_t hi = vshlq_s32(vmlal_n_s16(vdupq_n_s32(b), vget_high_s16(x), k), s);
+
+    return vcombine_s16(vmovn_s32(lo), vmovn_s32(hi));
+}
+
+/*
+ * Clamps the sums of the luma and chroma table entries of the even and odd
+ * pixels like color_tClip and returns the channel of the 16 pixels in order.
+ */
+static uint8x16_t neon_TableChannel(int16x8_t ye, int16x8_t yo, int16x8_t c)
+{
+    uint8x8x2_t px = vzip_u8(vqshrun_n_s16(vaddq_s16(ye, c), 1),
+                             vqshrun_n_s16(vaddq_s16(yo, c), 1));
+
+    return vcombine_u8(px.val[0], px.val[1]);
+}
+
+/*
+ * Converts one row of packed UYVY data to BGRA, 16 pixels at a time, with
+ * the same results as the table-based code.
+ */
+static void neon_ConvertRow422Table(uint8_t *dst, int32_t width, const uint8_t *uyvy)
+{
+    int32_t iW;
+
+    for (iW = 0; iW <= width - 16; iW += 16) {
+        uint8x8x4_t in = vld4_u8(uyvy + 2 * iW);
+        int16x8_t ye = neon_Table(in.val[1], COLOR_TAB_YY);
+        int16x8_t yo = neon_Table(in.val[3], COLOR_TAB_YY);
+        int16x8_t cr = vsubq_s16(neon_Table(in.val[2], COLOR_TAB_RV),
+                                 vdupq_n_s16(COLOR_TAB_RRI));
+        int16x8_t cg = vsubq_s16(vaddq_s16(neon_Table(in.val[0], COLOR_TAB_GU),
+                                           vdupq_n_s16(COLOR_TAB_GU_OFF)),
+                                 neon_Table(in.val[2], COLOR_TAB_GV));
+        int16x8_t cb = vsubq_s16(neon_Table(in.val[0], COLOR_TAB_BU),
+                                 vdupq_n_s16(COLOR_TAB_BBI));
+        uint8x16x4_t px;
+
+        px.val[0] = neon_TableChannel(ye, yo, cb);
+        px.val[1] = neon_TableChannel(ye, yo, cg);
+        px.val[2] = neon_TableChannel(ye, yo, cr);
+        px.val[3] = vdupq_n_u8(0xff);
+        vst4q_u8(dst + 4 * iW, px);
+    }
+
+    ColorConvert_TablePairsBGRA(dst + 4 * iW, (width - iW) >> 1,
+                                uyvy + 2 * iW + 1, uyvy + 2 * iW, uyvy + 2 * iW + 2);
+}
+
+/*
+ * Converts one row of packed UYVY data to ARGB, 16 pixels at a time.
+ */
+static void neon_ConvertRow422(uint8_t *dst, int32_t width, const uint8_t *uyvy)
+{
+    int32_t iW;
+
+    for (iW = 0; iW <= width - 16; iW += 16) {
+        uint8x8x4_t px = vld4_u8(uyvy + 2 * iW);
+
+        neon_ConvertPixels(dst + 4 * iW, px.val[1], px.val[3],
+                           px.val[0], px.val[2], NULL, 0);
+    }
+
+    ColorConvert_FixedPointPairs(dst + 4 * iW, (width - iW) >> 1,
+                                 uyvy + 2 * iW + 1, 2, uyvy + 2 * iW, uyvy + 2 * iW + 2, 4,
+                                 NULL, 0);
+}
+
+static int neon_YCbCr422p(uint8_t *dst, int32_t dst_stride,
+                          int32_t width, int32_t height,
+                          const uint8_t *uyvy, int32_t stride, int bgra)
+{
+    int32_t jH;
+
+    for (jH = 0; jH < height; jH++) {
+        if (bgra) {
+            neon_ConvertRow422Table(dst, width, uyvy);
+        } else {
+            neon_ConvertRow422(dst, width, uyvy);
+        }
+        dst += dst_stride;
+        uyvy += stride;
+    }
+
+    return 0;
+}
+// --- End NEON conversion functions
+#endif // ENABLE_SIMD_NEON
+
 // --- Begin YCbCr420p conversion functions
 #if ENABLE_SIMD_SSE2
 // --- Begin SSE2 YCbCr420p conversion functions
@@ -506,6 +1217,13 @@ int ColorConvert_YCbCr420p_to_ARGB32(
     uint8_t *pY1, *pY2, *pU, *pV, *pA1, *pA2, *pD1, *pD2, *pd1, *pd2;
 
     __m128i (*load_si128) (const __m128i*);
+
+#if ENABLE_SIMD_AVX2
+    if (ColorConvert_HasAVX2())
+        return avx2_YCbCr420p(argb, argb_stride, width, height, y, v, u, a,
+                              y_stride, v_stride, u_stride, a_stride, 0);
+#endif
+
     if (((intptr_t)y % 16) != 0 || ((intptr_t)u % 16) != 0 || ((intptr_t)v % 16) != 0 || ((intptr_t)a % 16) != 0 || (y_stride % 16) != 0 || (u_stride % 16) != 0 || (v_stride % 16) != 0 || (a_stride % 16) != 0)
         load_si128 = &inline_loadu_si128;
     else
@@ -990,6 +1708,13 @@ int ColorConvert_YCbCr420p_to_ARGB32_no_alpha(
     uint8_t *pY1, *pY2, *pU, *pV, *pD1, *pD2, *pd1, *pd2;
 
     __m128i (*load_si128) (const __m128i*);
+
+#if ENABLE_SIMD_AVX2
+    if (ColorConvert_HasAVX2())
+        return avx2_YCbCr420p(argb, argb_stride, width, height, y, v, u, NULL,
+                              y_stride, v_stride, u_stride, 0, 0);
+#endif
+
     if (((intptr_t)y % 16) != 0 || ((intptr_t)u % 16) != 0 || ((intptr_t)v % 16) != 0 || (y_stride % 16) != 0 || (u_stride % 16) != 0 || (v_stride % 16) != 0)
         load_si128 = &inline_loadu_si128;
     else
@@ -1446,6 +2171,13 @@ int ColorConvert_YCbCr420p_to_BGRA32(
     uint8_t *pY1, *pY2, *pU, *pV, *pA1, *pA2, *pD1, *pD2, *pd1, *pd2;
 
     __m128i (*load_si128) (const __m128i*);
+
+#if ENABLE_SIMD_AVX2
+    if (ColorConvert_HasAVX2())
+        return avx2_YCbCr420p(bgra, bgra_stride, width, height, y, v, u, a,
+                              y_stride, v_stride, u_stride, a_stride, 1);
+#endif
+
     if (((intptr_t)y % 16) != 0 || ((intptr_t)u % 16) != 0 || ((intptr_t)v % 16) != 0 || ((intptr_t)a % 16) != 0 || (y_stride % 16) != 0 || (u_stride % 16) != 0 || (v_stride % 16) != 0 || (a_stride % 16) != 0)
         load_si128 = &inline_loadu_si128;
     else
@@ -1957,6 +2689,13 @@ int ColorConvert_YCbCr420p_to_BGRA32_no_alpha(
     uint8_t *pY1, *pY2, *pU, *pV, *pD1, *pD2, *pd1, *pd2;
 
     __m128i (*load_si128) (const __m128i*);
+
+#if ENABLE_SIMD_AVX2
+    if (ColorConvert_HasAVX2())
+        return avx2_YCbCr420p(bgra, bgra_stride, width, height, y, v, u, NULL,
+                              y_stride, v_stride, u_stride, 0, 1);
+#endif
+
     if (((intptr_t)y % 16) != 0 || ((intptr_t)u % 16) != 0 || ((intptr_t)v % 16) != 0 || (y_stride % 16) != 0 || (u_stride % 16) != 0 || (v_stride % 16) != 0)
         load_si128 = &inline_loadu_si128;
     else
@@ -2352,6 +3091,77 @@ int ColorConvert_YCbCr420p_to_BGRA32_no_alpha(
 }
 // --- End SSE2 YCbCr420p conversion functions
 
+#elif ENABLE_SIMD_NEON
+// --- Begin NEON YCbCr420p conversion functions
+int ColorConvert_YCbCr420p_to_ARGB32(
+                                     uint8_t *argb,
+                                     int32_t argb_stride,
+                                     int32_t width,
+                                     int32_t height,
+                                     const uint8_t *y,
+                                     const uint8_t *v,
+                                     const uint8_t *u,
+                                     const uint8_t *a,
+                                     int32_t y_stride,
+                                     int32_t v_stride,
+                                     int32_t u_stride,
+                                     int32_t a_stride)
+{
+    return neon_YCbCr420p(argb, argb_stride, width, height, y, v, u, a,
+                          y_stride, v_stride, u_stride, a_stride, 0);
+}
+
+int ColorConvert_YCbCr420p_to_ARGB32_no_alpha(
+                                     uint8_t *argb,
+                                     int32_t argb_stride,
+                                     int32_t width,
+                                     int32_t height,
+                                     const uint8_t *y,
+                                     const uint8_t *v,
+                                     const uint8_t *u,
+                                     int32_t y_stride,
+                                     int32_t v_stride,
+                                     int32_t u_stride)
+{
+    return neon_YCbCr420p(argb, argb_stride, width, height, y, v, u, NULL,
+                          y_stride, v_stride, u_stride, 0, 0);
+}
+
+int ColorConvert_YCbCr420p_to_BGRA32(
+                                     uint8_t *bgra,
+                                     int32_t bgra_stride,
+                                     int32_t width,
+                                     int32_t height,
+                                     const uint8_t *y,
+                                     const uint8_t *v,
+                                     const uint8_t *u,
+                                     const uint8_t *a,
+                                     int32_t y_stride,
+                                     int32_t v_stride,
+                                     int32_t u_stride,
+                                     int32_t a_stride)
+{
+    return neon_YCbCr420p(bgra, bgra_stride, width, height, y, v, u, a,
+                          y_stride, v_stride, u_stride, a_stride, 1);
+}
+
+int ColorConvert_YCbCr420p_to_BGRA32_no_alpha(
+                                              uint8_t *bgra,
+                                              int32_t bgra_stride,
+                                              int32_t width,
+                                              int32_t height,
+                                              const uint8_t *y,
+                                              const uint8_t *v,
+                                              const uint8_t *u,
+                                              int32_t y_stride,
+                                              int32_t v_stride,
+                                              int32_t u_stride)
+{
+    return neon_YCbCr420p(bgra, bgra_stride, width, height, y, v, u, NULL,
+                          y_stride, v_stride, u_stride, 0, 1);
+}
+// --- End NEON YCbCr420p conversion functions
+
 #else // Generic C implementation
 
 // --- Begin C YCbCr420p conversion functions
@@ -2607,7 +3417,35 @@ int ColorConvert_YCbCr422p_to_ARGB32_no_alpha(uint8_t *argb,
                                               int32_t y_stride,
                                               int32_t uv_stride)
 {
-    return 1; // NOTE: Not implemented
+    int32_t j;
+
+    if (argb == NULL || y == NULL || u == NULL || v == NULL)
+        return 1;
+
+    if (width <= 0 || height <= 0)
+        return 1;
+
+    if (width & 1)
+        return 1;
+
+#if ENABLE_SIMD_AVX2
+    if (COLOR_IS_UYVY(y, v, u) && ColorConvert_HasAVX2())
+        return avx2_YCbCr422p(argb, argb_stride, width, height, u, y_stride, 0);
+#elif ENABLE_SIMD_NEON
+    if (COLOR_IS_UYVY(y, v, u))
+        return neon_YCbCr422p(argb, argb_stride, width, height, u, y_stride, 0);
+#endif
+
+    for (j = 0; j < height; j++) {
+        ColorConvert_FixedPointPairs(argb, width >> 1, y, 2, u, v, 4, NULL, 0);
+
+        argb += argb_stride;
+        y += y_stride;
+        u += uv_stride;
+        v += uv_stride;
+    }
+
+    return 0;
 }
 
 int ColorConvert_YCbCr422p_to_BGRA32_no_alpha(uint8_t *bgra,
@@ -2620,14 +3458,7 @@ int ColorConvert_YCbCr422p_to_BGRA32_no_alpha(uint8_t *bgra,
                                               int32_t y_stride,
                                               int32_t uv_stride)
 {
-    int32_t i, j;
-    const uint8_t *say1, *sau, *sav, *sly1, *slu, *slv;
-    uint8_t *da1, *dl1;
-
-    int32_t BBi = 554;
-    int32_t RRi = 446;
-
-    uint8_t *const pClip = (uint8_t *const)color_tClip + 288 * 2;
+    int32_t j;
 
     if (bgra == NULL || y == NULL || u == NULL || v == NULL)
         return 1;
@@ -2638,49 +3469,82 @@ int ColorConvert_YCbCr422p_to_BGRA32_no_alpha(uint8_t *bgra,
     if (width & 1)
         return 1;
 
-    sly1 = say1 = y;
-    slu = sau = u;
-    slv = sav = v;
-    dl1 = da1 = bgra;
+#if ENABLE_SIMD_AVX2
+    if (COLOR_IS_UYVY(y, v, u) && ColorConvert_HasAVX2())
+        return avx2_YCbCr422p(bgra, bgra_stride, width, height, u, y_stride, 1);
+#elif ENABLE_SIMD_NEON
+    if (COLOR_IS_UYVY(y, v, u))
+        return neon_YCbCr422p(bgra, bgra_stride, width, height, u, y_stride, 1);
+#endif
 
     for (j = 0; j < height; j++) {
-        for (i = 0; i < (width >> 1); i++) {
-            int32_t sf01, sf03, sf1, sf2, sfr, sfg, sfb;
+        ColorConvert_TablePairsBGRA(bgra, width >> 1, y, u, v);
 
-            sf1 = sau[0];
-            sf2 = sav[0];
+        bgra += bgra_stride;
+        y += y_stride;
+        u += uv_stride;
+        v += uv_stride;
+    }
 
-            sf01 = say1[0];
-            sf03 = say1[2];
+    return 0;
+}
+// --- End YCbCr422p conversion functions
 
-            sfr = color_tRV[sf2] - RRi;
-            sfg = color_tGU[sf1] - color_tGV[sf2];
-            sfb = color_tBU[sf1] - BBi;
+// --- Begin byte swap functions
+#if ENABLE_SIMD_SSE2
+#include <emmintrin.h>
+#endif
 
-            sf01 = color_tYY[sf01];
-            sf03 = color_tYY[sf03];
+static inline uint32_t ColorConvert_Swap32(uint32_t x)
+{
+    return
+        ((x & 0x000000ffU) << 24) |
+        ((x & 0x0000ff00U) <<  8) |
+        ((x & 0x00ff0000U) >>  8) |
+        ((x & 0xff000000U) >> 24);
+}
 
-            TCLAMP_U8(sf01 + sfr, da1[2]);
-            TCLAMP_U8(sf01 + sfg, da1[1]);
-            SCLAMP_U8(sf01 + sfb, da1[0]);
-            TCLAMP_U8(sf03 + sfr, da1[6]);
-            TCLAMP_U8(sf03 + sfg, da1[5]);
-            SCLAMP_U8(sf03 + sfb, da1[4]);
+int ColorConvert_SwapBytes32(uint8_t *dst,
+                             int32_t dst_stride,
+                             const uint8_t *src,
+                             int32_t src_stride,
+                             int32_t width,
+                             int32_t height)
+{
+    int32_t i, j;
 
-            da1[3] = da1[7] = 0xff;
+    if (dst == NULL || src == NULL)
+        return 1;
 
-            say1 += 4;
-            sau += 4;
-            sav += 4;
-            da1 += 8;
+    if (width <= 0 || height <= 0)
+        return 1;
+
+    for (j = 0; j < height; j++) {
+        i = 0;
+#if ENABLE_SIMD_SSE2
+        // Swap the 16 bit halves, then the bytes within each half
+        for (; i + 4 <= width; i += 4) {
+            __m128i x = _mm_loadu_si128((const __m128i *)(src + 4 * i));
+            x = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, 0xB1), 0xB1);
+            x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+            _mm_storeu_si128((__m128i *)(dst + 4 * i), x);
+        }
+#elif ENABLE_SIMD_NEON
+        for (; i + 4 <= width; i += 4) {
+            vst1q_u8(dst + 4 * i, vrev32q_u8(vld1q_u8(src + 4 * i)));
+        }
+#endif
+        for (; i < width; i++) {
+            uint32_t x;
+            memcpy(&x, src + 4 * i, 4);
+            x = ColorConvert_Swap32(x);
+            memcpy(dst + 4 * i, &x, 4);
         }
 
-        sly1 = say1 = ((uint8_t *)sly1 + y_stride);
-        slu = sau = ((uint8_t *)slu + uv_stride);
-        slv = sav = ((uint8_t *)slv + uv_stride);
-        dl1 = da1 = ((uint8_t *)dl1 + bgra_stride);
+        dst += dst_stride;
+        src += src_stride;
     }
 
     return 0;
 }
-// --- End YCbCr422p conversion functions
+// --- End byte swap functions
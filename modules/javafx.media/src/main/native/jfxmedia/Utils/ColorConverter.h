@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -101,6 +101,17 @@ extern "C" {
                                                   int32_t y_stride,
                                                   int32_t uv_stride);
 
+    /*
+     * Reverses the byte order of every 32 bit pixel, converting between
+     * ARGB and BGRA. The source and destination may be the same.
+     */
+    int ColorConvert_SwapBytes32(uint8_t *dst,
+                                 int32_t dst_stride,
+                                 const uint8_t *src,
+                                 int32_t src_stride,
+                                 int32_t width,
+                                 int32_t height);
+
 #ifdef __cplusplus
 };
 #endif
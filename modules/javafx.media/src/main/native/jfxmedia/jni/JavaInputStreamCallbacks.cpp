@@ -35,6 +35,8 @@ jfieldID  CJavaInputStreamCallbacks::m_BufferFID = 0;
 jmethodID CJavaInputStreamCallbacks::m_NeedBufferMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_ReadNextBlockMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_ReadBlockMID = 0;
+jmethodID CJavaInputStreamCallbacks::m_ReadNextBlockDirectMID = 0;
+jmethodID CJavaInputStreamCallbacks::m_ReadBlockDirectMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_IsSeekableMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_IsRandomAccessMID = 0;
 jmethodID CJavaInputStreamCallbacks::m_SeekMID = 0;
@@ -103,6 +105,18 @@ bool CJavaInputStreamCallbacks::Init(JNIEnv *env, jobject jConnectionHolder)
             hasException = (javaEnv.reportException() || (NULL == m_ReadBlockMID));
         }
 
+        if (!hasException)
+        {
+            m_ReadNextBlockDirectMID = env->GetMethodID(klass, "readNextBlock", "(Ljava/nio/ByteBuffer;)I");
+            hasException = (javaEnv.reportException() || (NULL == m_ReadNextBlockDirectMID));
+        }
+
+        if (!hasException)
+        {
+            m_ReadBlockDirectMID = env->GetMethodID(klass, "readBlock", "(JLjava/nio/ByteBuffer;)I");
+            hasException = (javaEnv.reportException() || (NULL == m_ReadBlockDirectMID));
+        }
+
         if (!hasException)
         {
             m_IsSeekableMID = env->GetMethodID(klass, "isSeekable", "()Z");
@@ -201,6 +215,55 @@ int CJavaInputStreamCallbacks::ReadBlock(int64_t position, int size)
     return result;
 }
 
+int CJavaInputStreamCallbacks::ReadNextBlock(void* destination, int size)
+{
+    int result = -1;
+    CJavaEnvironment javaEnv(m_jvm);
+    JNIEnv *pEnv = javaEnv.getEnvironment();
+
+    if (pEnv) {
+        jobject connection = pEnv->NewLocalRef(m_ConnectionHolder);
+        if (connection) {
+            // Wrap the destination so Java reads into it directly
+            jobject target = pEnv->NewDirectByteBuffer(destination, size);
+            if (target) {
+                result = pEnv->CallIntMethod(connection, m_ReadNextBlockDirectMID, target);
+                pEnv->DeleteLocalRef(target);
+            }
+            if (javaEnv.clearException() || NULL == target) {
+                result = -2;
+            }
+            pEnv->DeleteLocalRef(connection);
+        }
+    }
+
+    return result;
+}
+
+int CJavaInputStreamCallbacks::ReadBlock(int64_t position, int size, void* destination)
+{
+    int result = -1;
+    CJavaEnvironment javaEnv(m_jvm);
+    JNIEnv *pEnv = javaEnv.getEnvironment();
+
+    if (pEnv) {
+        jobject connection = pEnv->NewLocalRef(m_ConnectionHolder);
+        if (connection) {
+            jobject target = pEnv->NewDirectByteBuffer(destination, size);
+            if (target) {
+                result = pEnv->CallIntMethod(connection, m_ReadBlockDirectMID, (jlong)position, target);
+                pEnv->DeleteLocalRef(target);
+            }
+            if (javaEnv.clearException() || NULL == target) {
+                result = -2;
+            }
+            pEnv->DeleteLocalRef(connection);
+        }
+    }
+
+    return result;
+}
+
 void CJavaInputStreamCallbacks::CopyBlock(void* destination, int size)
 {
     CJavaEnvironment javaEnv(m_jvm);
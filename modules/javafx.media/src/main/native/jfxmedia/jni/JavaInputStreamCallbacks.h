@@ -40,6 +40,8 @@ virtual ~CJavaInputStreamCallbacks();
     bool NeedBuffer();
     int  ReadNextBlock();
     int  ReadBlock(int64_t position, int size);
+    int  ReadNextBlock(void* destination, int size);
+    int  ReadBlock(int64_t position, int size, void* destination);
     void CopyBlock(void* destination, int size);
     bool IsSeekable();
     bool IsRandomAccess();
@@ -55,6 +57,8 @@ private:
     static jmethodID m_NeedBufferMID;
     static jmethodID m_ReadNextBlockMID;
     static jmethodID m_ReadBlockMID;
+    static jmethodID m_ReadNextBlockDirectMID;
+    static jmethodID m_ReadBlockDirectMID;
     static jmethodID m_IsSeekableMID;
     static jmethodID m_IsRandomAccessMID;
     static jmethodID m_SeekMID;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -83,6 +83,21 @@ JNIEXPORT jobject JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nati
     return NULL;
 }
 
+/*
+ * Class:     com_sun_media_jfxmediaimpl_NativeVideoBuffer
+ * Method:    nativeGetNativeSurface
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_sun_media_jfxmediaimpl_NativeVideoBuffer_nativeGetNativeSurface
+    (JNIEnv *env, jobject obj, jlong nativeHandle)
+{
+    CVideoFrame *frame = (CVideoFrame*)jlong_to_ptr(nativeHandle);
+    if (frame) {
+        return ptr_to_jlong(frame->GetNativeSurface());
+    }
+    return 0;
+}
+
 /*
  * Class:     com_sun_media_jfxmediaimpl_NativeVideoBuffer
  * Method:    nativeGetWidth
@@ -26,6 +26,7 @@
 #include "GstAVPlaybackPipeline.h"
 
 #include "GstVideoFrame.h"
+#include "GstFrameDispatcher.h"
 #include <gst/gst.h>
 #include <gst/app/gstappsink.h>
 #include <PipelineManagement/VideoTrack.h>
@@ -39,6 +40,9 @@
 
 #define MAX_SIZE_BUFFERS_LIMIT 25
 #define MAX_SIZE_BUFFERS_INC   5
+// Low latency live HLS keeps less data queued ahead of the sinks
+#define LOW_LATENCY_MAX_SIZE_BUFFERS       5
+#define LOW_LATENCY_MAX_SIZE_BUFFERS_LIMIT 15
 
 //*************************************************************************************************
 //********** class CGstAVPlaybackPipeline
@@ -64,6 +68,8 @@ CGstAVPlaybackPipeline::CGstAVPlaybackPipeline(const GstElementContainer& elemen
     m_videoCodecErrorCode = ERROR_NONE;
     m_bStaticPipeline = false; // For now all video pipelines are dynamic
     m_FirstPTS = GST_CLOCK_TIME_NONE;
+    m_pFrameBufferPool = CGstFrameBufferPool::Create();
+    m_pFrameDispatcher = NULL;
 }
 
 /**
@@ -77,6 +83,12 @@ CGstAVPlaybackPipeline::~CGstAVPlaybackPipeline()
     g_print ("CGstAVPlaybackPipeline::~CGstAVPlaybackPipeline()\n");
 #endif
     LOGGER_LOGMSG(LOGGER_DEBUG, "CGstAVPlaybackPipeline::~CGstAVPlaybackPipeline()");
+
+    if (NULL != m_pFrameDispatcher)
+        delete m_pFrameDispatcher;
+
+    // Frames still held by Java keep the pool alive until they are disposed
+    CGstFrameBufferPool::ReleaseRef(m_pFrameBufferPool);
 }
 
 /**
@@ -106,6 +118,18 @@ uint32_t CGstAVPlaybackPipeline::Init()
     g_signal_connect(m_Elements[AUDIO_QUEUE], "underrun", G_CALLBACK (queue_underrun), this);
     g_signal_connect(m_Elements[VIDEO_QUEUE], "underrun", G_CALLBACK (queue_underrun), this);
 
+    if (m_pOptions->GetHLSLowLatency())
+    {
+        g_object_set(m_Elements[AUDIO_QUEUE], "max-size-buffers", (guint)LOW_LATENCY_MAX_SIZE_BUFFERS, NULL);
+        g_object_set(m_Elements[VIDEO_QUEUE], "max-size-buffers", (guint)LOW_LATENCY_MAX_SIZE_BUFFERS, NULL);
+    }
+
+    guint max_size_buffers = 0;
+    g_object_get(m_Elements[AUDIO_QUEUE], "max-size-buffers", &max_size_buffers, NULL);
+    UpdateQueueLimit(m_Elements[AUDIO_QUEUE], max_size_buffers);
+    g_object_get(m_Elements[VIDEO_QUEUE], "max-size-buffers", &max_size_buffers, NULL);
+    UpdateQueueLimit(m_Elements[VIDEO_QUEUE], max_size_buffers);
+
     return CGstAudioPlaybackPipeline::Init();
 }
 
@@ -120,6 +144,14 @@ uint32_t CGstAVPlaybackPipeline::PostBuildInit()
         //Connect the callback
         g_signal_connect (m_Elements[VIDEO_SINK], "new-sample", G_CALLBACK (OnAppSinkHaveFrame), this);
         g_signal_connect (m_Elements[VIDEO_SINK], "new-preroll", G_CALLBACK (OnAppSinkPreroll), this);
+
+        // Frames are handed to Java off the streaming thread
+        m_pFrameDispatcher = new CGstFrameDispatcher(this, m_pMetrics);
+        if (!m_pFrameDispatcher->Start())
+        {
+            delete m_pFrameDispatcher;
+            m_pFrameDispatcher = NULL;
+        }
 #endif
 
         // Add a buffer probe on the sink pad of the decoder to capture frame rate
@@ -155,6 +187,10 @@ void CGstAVPlaybackPipeline::Dispose()
 #endif
     }
 
+    // No frame may reach Java once the event dispatcher is gone
+    if (NULL != m_pFrameDispatcher)
+        m_pFrameDispatcher->Stop();
+
     g_signal_handlers_disconnect_by_func(m_Elements[AUDIO_QUEUE], (void*)G_CALLBACK(queue_overrun), this);
     g_signal_handlers_disconnect_by_func(m_Elements[VIDEO_QUEUE], (void*)G_CALLBACK(queue_overrun), this);
     g_signal_handlers_disconnect_by_func(m_Elements[AUDIO_QUEUE], (void*)G_CALLBACK(queue_underrun), this);
@@ -299,6 +335,25 @@ bool CGstAVPlaybackPipeline::LoadDecoder(GstCaps *pCaps)
     return CGstAudioPlaybackPipeline::LoadDecoder(pCaps);
 }
 
+/**
+ * CGstAVPlaybackPipeline::SetOutputSizeHint()
+ *
+ * Passes the size the video is displayed at to decoders that can scale
+ * frames down before they are uploaded.
+ */
+uint32_t CGstAVPlaybackPipeline::SetOutputSizeHint(int iWidth, int iHeight)
+{
+    GstElement *pDecoder = m_Elements[VIDEO_DECODER];
+
+    if (pDecoder != NULL &&
+        g_object_class_find_property(G_OBJECT_GET_CLASS(pDecoder), "output-width") != NULL)
+    {
+        g_object_set(pDecoder, "output-width", (gint)iWidth, "output-height", (gint)iHeight, NULL);
+    }
+
+    return ERROR_NONE;
+}
+
 /**
  * CGstAVPlaybackPipeline::SetEncodedVideoFrameRate()
  *
@@ -319,8 +374,6 @@ void CGstAVPlaybackPipeline::SetEncodedVideoFrameRate(float frameRate)
  */
 GstFlowReturn CGstAVPlaybackPipeline::OnAppSinkHaveFrame(GstElement* pElem, CGstAVPlaybackPipeline* pPipeline)
 {
-    LOWLEVELPERF_RESETCOUNTER("FPS");
-
     //***** get the buffer from appsink
     GstSample* pSample = gst_app_sink_pull_sample(GST_APP_SINK (pElem));
     if (pSample == NULL)
@@ -350,14 +403,21 @@ GstFlowReturn CGstAVPlaybackPipeline::OnAppSinkHaveFrame(GstElement* pElem, CGst
 
     //***** Create a VideoFrame object
     CGstVideoFrame* pVideoFrame = new CGstVideoFrame();
-    if (!pVideoFrame->Init(pSample))
+    if (!pVideoFrame->Init(pSample, pPipeline->m_pFrameBufferPool, pPipeline->m_pMetrics))
     {
         gst_sample_unref(pSample);
         delete pVideoFrame;
         return GST_FLOW_OK;
     }
 
-    if (pVideoFrame->IsValid() && pPipeline->m_pEventDispatcher)
+    pPipeline->m_pMetrics->Increment(METRIC_DECODED_FRAMES);
+
+    if (pVideoFrame->IsValid() && pPipeline->m_pFrameDispatcher)
+    {
+        // The dispatcher sends the frame and Java deletes it later.
+        pPipeline->m_pFrameDispatcher->Push(pVideoFrame);
+    }
+    else if (pVideoFrame->IsValid() && pPipeline->m_pEventDispatcher)
     {
         CPlayerEventDispatcher* pEventDispatcher = pPipeline->m_pEventDispatcher;
 
@@ -373,6 +433,7 @@ GstFlowReturn CGstAVPlaybackPipeline::OnAppSinkHaveFrame(GstElement* pElem, CGst
     else
     {
         delete pVideoFrame;
+        pPipeline->m_pMetrics->Increment(METRIC_INVALID_FRAMES);
         if (pPipeline->m_pEventDispatcher != NULL) {
             pPipeline->m_pEventDispatcher->Warning(WARNING_GSTREAMER_INVALID_FRAME,
                                                    "Invalid frame");
@@ -428,14 +489,18 @@ GstFlowReturn CGstAVPlaybackPipeline::OnAppSinkPreroll(GstElement* pElem, CGstAV
         }
 
         CGstVideoFrame* pVideoFrame = new CGstVideoFrame();
-        if (!pVideoFrame->Init(pSample))
+        if (!pVideoFrame->Init(pSample, pPipeline->m_pFrameBufferPool, pPipeline->m_pMetrics))
         {
             // INLINE - gst_sample_unref()
             gst_sample_unref (pSample);
             delete pVideoFrame;
             return GST_FLOW_OK;
         }
-        if (pVideoFrame->IsValid()) {
+        if (pVideoFrame->IsValid() && pPipeline->m_pFrameDispatcher) {
+            // Frames queued before the preroll must not show up after the poster frame
+            pPipeline->m_pFrameDispatcher->Flush();
+            pPipeline->m_pFrameDispatcher->Push(pVideoFrame);
+        } else if (pVideoFrame->IsValid()) {
             if (!pPipeline->m_pEventDispatcher->SendNewFrameEvent(pVideoFrame))
             {
                 if (!pPipeline->m_pEventDispatcher->SendPlayerMediaErrorEvent(ERROR_JNI_SEND_NEW_FRAME_EVENT))
@@ -445,6 +510,7 @@ GstFlowReturn CGstAVPlaybackPipeline::OnAppSinkPreroll(GstElement* pElem, CGstAV
             }
         } else {
             delete pVideoFrame;
+            pPipeline->m_pMetrics->Increment(METRIC_INVALID_FRAMES);
             if (pPipeline->m_pEventDispatcher != NULL) {
                 pPipeline->m_pEventDispatcher->Warning(WARNING_GSTREAMER_INVALID_FRAME, "Invalid frame");
             }
@@ -758,18 +824,32 @@ void CGstAVPlaybackPipeline::CheckQueueSize(GstElement *element)
     if (inc_size_time)
     {
         g_object_get(element, "max-size-buffers", &max_size_buffers, NULL);
+        if (m_pOptions->GetHLSLowLatency() && max_size_buffers >= LOW_LATENCY_MAX_SIZE_BUFFERS_LIMIT)
+            return;
         max_size_buffers += MAX_SIZE_BUFFERS_INC;
         g_object_set(element, "max-size-buffers", max_size_buffers, NULL);
+        UpdateQueueLimit(element, max_size_buffers);
     }
 }
 
+void CGstAVPlaybackPipeline::UpdateQueueLimit(GstElement *element, guint max_size_buffers)
+{
+    if (m_Elements[AUDIO_QUEUE] == element)
+        m_pMetrics->Set(METRIC_AUDIO_QUEUE_LIMIT, max_size_buffers);
+    else if (m_Elements[VIDEO_QUEUE] == element)
+        m_pMetrics->Set(METRIC_VIDEO_QUEUE_LIMIT, max_size_buffers);
+}
+
 void CGstAVPlaybackPipeline::queue_overrun(GstElement *element, CGstAVPlaybackPipeline *pPipeline)
 {
+    pPipeline->m_pMetrics->Increment(METRIC_QUEUE_OVERRUNS);
     pPipeline->CheckQueueSize(element);
 }
 
 void CGstAVPlaybackPipeline::queue_underrun(GstElement *element, CGstAVPlaybackPipeline *pPipeline)
 {
+    pPipeline->m_pMetrics->Increment(METRIC_QUEUE_UNDERRUNS);
+
     if (pPipeline->m_pOptions->GetHLSModeEnabled())
     {
         if (pPipeline->m_Elements[AUDIO_QUEUE] == element)
@@ -818,6 +898,7 @@ void CGstAVPlaybackPipeline::queue_underrun(GstElement *element, CGstAVPlaybackP
             g_object_get(inc_element, "max-size-buffers", &max_size_buffers, NULL);
             max_size_buffers += MAX_SIZE_BUFFERS_INC;
             g_object_set(inc_element, "max-size-buffers", max_size_buffers, NULL);
+            pPipeline->UpdateQueueLimit(inc_element, max_size_buffers);
         }
     }
 }
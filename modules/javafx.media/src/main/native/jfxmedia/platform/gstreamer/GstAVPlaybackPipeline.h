@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,8 @@
 #include "GstAudioPlaybackPipeline.h"
 #include "GstPipelineFactory.h"
 
+class CGstFrameBufferPool;
+class CGstFrameDispatcher;
 
 /**
  * class CGstAVPlaybackPipeline
@@ -53,6 +55,8 @@ public:
 
     virtual void CheckQueueSize(GstElement *element);
 
+    virtual uint32_t SetOutputSizeHint(int iWidth, int iHeight);
+
     void         SetEncodedVideoFrameRate(float frameRate);
 
 protected:
@@ -64,6 +68,7 @@ private:
     static void     no_more_pads(GstElement *element, CGstAVPlaybackPipeline* pPipeline);
     static void     queue_overrun(GstElement *element, CGstAVPlaybackPipeline *pPipeline);
     static void     queue_underrun(GstElement *element, CGstAVPlaybackPipeline *pPipeline);
+    void            UpdateQueueLimit(GstElement *element, guint max_size_buffers);
 
     static GstFlowReturn     OnAppSinkPreroll(GstElement* pElem, CGstAVPlaybackPipeline* pPipeline);
     static GstFlowReturn     OnAppSinkHaveFrame(GstElement* pElem, CGstAVPlaybackPipeline* pPipeline);
@@ -83,6 +88,8 @@ private:
     gfloat                  m_EncodedVideoFrameRate;
     int                     m_videoCodecErrorCode;
     GstClockTime            m_FirstPTS;
+    CGstFrameBufferPool*    m_pFrameBufferPool;
+    CGstFrameDispatcher*    m_pFrameDispatcher;
 };
 
 #endif  //_GST_AV_PLAYBACK_PIPELINE_H_
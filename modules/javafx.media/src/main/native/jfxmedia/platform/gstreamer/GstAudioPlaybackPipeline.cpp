@@ -90,6 +90,8 @@ CGstAudioPlaybackPipeline::CGstAudioPlaybackPipeline(const GstElementContainer&
 #endif // ENABLE_PROGRESS_BUFFER
 
     m_audioCodecErrorCode = ERROR_NONE;
+    m_pMetrics = CGstPipelineMetrics::Create();
+    m_pStreamingThreads = new (nothrow) CGstStreamingThreads();
 
     m_pBusCallbackContent = NULL;
 }
@@ -107,6 +109,9 @@ CGstAudioPlaybackPipeline::~CGstAudioPlaybackPipeline()
     delete m_SeekLock;
     delete m_StateLock;
     delete m_StallLock;
+
+    CGstPipelineMetrics::ReleaseRef(m_pMetrics);
+    delete m_pStreamingThreads;
 }
 
 /**
@@ -145,6 +150,12 @@ uint32_t CGstAudioPlaybackPipeline::Init()
     m_pBusCallbackContent->m_bFreeMe = false;
 
     GstBus *pBus = gst_pipeline_get_bus (GST_PIPELINE (m_Elements[PIPELINE]));
+
+    // Streaming threads report themselves synchronously, so that they get
+    // the decode priority of this pipeline while they run its tasks.
+    if (m_pStreamingThreads != NULL)
+        gst_bus_set_sync_handler(pBus, CGstStreamingThreads::BusSyncHandler, m_pStreamingThreads, NULL);
+
     m_pBusSource = gst_bus_create_watch(pBus);
     if (m_pBusSource == NULL)
         return ERROR_MEMORY_ALLOCATION;
@@ -400,6 +411,11 @@ void CGstAudioPlaybackPipeline::Dispose()
     if (m_Elements[PIPELINE])
     {
         gst_element_set_state (m_Elements[PIPELINE], GST_STATE_NULL); // Ignore return value.
+
+        // All streaming threads have left
+        GstBus *pBus = gst_pipeline_get_bus (GST_PIPELINE (m_Elements[PIPELINE]));
+        gst_bus_set_sync_handler(pBus, NULL, NULL, NULL);
+        gst_object_unref (pBus);
     }
 
     if (m_pBusCallbackContent != NULL)
@@ -998,6 +1014,35 @@ CAudioSpectrum* CGstAudioPlaybackPipeline::GetAudioSpectrum()
     return m_pAudioSpectrum;
 }
 
+/**
+ * CGstAudioPlaybackPipeline::GetStatistics()
+ *
+ * Copies the playback counters, laid out as PipelineMetric. Entries past
+ * METRIC_COUNT are zeroed.
+ */
+uint32_t CGstAudioPlaybackPipeline::GetStatistics(int64_t* pValues, int iCount)
+{
+    if (NULL == pValues)
+        return ERROR_FUNCTION_PARAM_NULL;
+
+    m_pMetrics->GetValues(pValues, iCount);
+
+    return ERROR_NONE;
+}
+
+/**
+ * CGstAudioPlaybackPipeline::SetDecodePriority()
+ *
+ * Sets the scheduling priority of the streaming threads, see DecodePriority.
+ */
+uint32_t CGstAudioPlaybackPipeline::SetDecodePriority(int iPriority)
+{
+    if (m_pStreamingThreads != NULL)
+        m_pStreamingThreads->SetPriority(iPriority);
+
+    return ERROR_NONE;
+}
+
 bool CGstAudioPlaybackPipeline::IsCodecSupported(GstCaps *pCaps)
 {
 #if TARGET_OS_WIN32
@@ -1518,25 +1563,7 @@ gboolean CGstAudioPlaybackPipeline::BusCallback(GstBus* bus, GstMessage* msg, sB
                 if (!gst_structure_get_clock_time (pStr, "duration", &duration))
                     duration = GST_CLOCK_TIME_NONE;
 
-                size_t bandsNum = pPipeline->GetAudioSpectrum()->GetBands();
-
-                if (bandsNum > 0)
-                {
-                    float *magnitudes = new float[bandsNum];
-                    float *phases = new float[bandsNum];
-
-                    const GValue *magnitudes_value = gst_structure_get_value(pStr, "magnitude");
-                    const GValue *phases_value = gst_structure_get_value(pStr, "phase");
-                    for (int i=0; i < bandsNum; i++)
-                    {
-                        magnitudes[i] = g_value_get_float( gst_value_list_get_value (magnitudes_value, i));
-                        phases[i] = g_value_get_float( gst_value_list_get_value (phases_value, i));
-                    }
-                    pPipeline->GetAudioSpectrum()->UpdateBands((int)bandsNum, magnitudes, phases);
-
-                    delete [] magnitudes;
-                    delete [] phases;
-                }
+                pPipeline->m_pAudioSpectrum->UpdateBands(pStr);
 
                 if (!pPipeline->m_pEventDispatcher->SendAudioSpectrumEvent(GST_TIME_AS_SECONDS((double)timestamp),
                     GST_TIME_AS_SECONDS((double)duration), false)) // Always false, since GStreamer does not need it,
@@ -1614,6 +1641,9 @@ void CGstAudioPlaybackPipeline::SetPlayerState(PlayerState newPlayerState, bool
     bool updateState = newPlayerState != m_PlayerState;
     if (updateState)
     {
+        if (newPlayerState == Stalled)
+            m_pMetrics->Increment(METRIC_BUFFERING_STALLS);
+
         if (NULL != m_pEventDispatcher && !bSilent)
         {
             m_PlayerState = newPlayerState;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,8 @@
 #include "GstElementContainer.h"
 #include "GstAudioEqualizer.h"
 #include "GstAudioSpectrum.h"
+#include "GstPipelineMetrics.h"
+#include "GstStreamingThreads.h"
 #include <string>
 
 using namespace std;
@@ -106,6 +108,9 @@ public:
     virtual CAudioEqualizer*    GetAudioEqualizer();
     virtual CAudioSpectrum*     GetAudioSpectrum();
 
+    virtual uint32_t    GetStatistics(int64_t* pValues, int iCount);
+    virtual uint32_t    SetDecodePriority(int iPriority);
+
     virtual bool IsCodecSupported(GstCaps *pCaps);
     virtual bool CheckCodecSupport();
     virtual bool LoadDecoder(GstCaps *pCaps);
@@ -135,6 +140,8 @@ protected:
     CGstAudioEqualizer* m_pAudioEqualizer;
     CGstAudioSpectrum*  m_pAudioSpectrum;
     int                 m_audioCodecErrorCode;
+    CGstPipelineMetrics* m_pMetrics;
+    CGstStreamingThreads* m_pStreamingThreads;
 
     // Stall handling stuff
     volatile bool        m_StallOnPause; // True if paused because of stall condition
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,8 @@
 #include <jni/JavaBandsHolder.h>
 #include <jni/JniUtils.h>
 
+#include <new>
+
 /************************************************************************
  *
  *************************************************************************/
@@ -63,12 +65,19 @@ CGstAudioSpectrum::CGstAudioSpectrum(GstElement* pSpectrum, bool enabled)
                               "message-magnitude", TRUE,
                               "message-phase", TRUE, NULL);
     g_atomic_pointer_set(&m_pHolder, NULL);
+
+    m_pMagnitudes = NULL;
+    m_pPhases = NULL;
+    m_BandsCapacity = 0;
 }
 
 CGstAudioSpectrum::~CGstAudioSpectrum()
 {
     CBandsHolder::ReleaseRef((CBandsHolder*)g_atomic_pointer_get(&m_pHolder));
     gst_object_unref(m_pSpectrum);
+
+    delete [] m_pMagnitudes;
+    delete [] m_pPhases;
 }
 
 bool CGstAudioSpectrum::IsEnabled()
@@ -106,6 +115,46 @@ void CGstAudioSpectrum::UpdateBands(int size, const float* magnitudes, const flo
     CBandsHolder::ReleaseRef(holder);
 }
 
+void CGstAudioSpectrum::UpdateBands(const GstStructure* pStructure)
+{
+    const GValue *magnitudes_value = gst_structure_get_value(pStructure, "magnitude");
+    const GValue *phases_value = gst_structure_get_value(pStructure, "phase");
+    if (magnitudes_value == NULL || phases_value == NULL)
+        return;
+
+    // Message carries the band count it was computed with, so there is no
+    // need to query the element for every interval
+    guint bands = gst_value_list_get_size(magnitudes_value);
+    if (bands == 0 || gst_value_list_get_size(phases_value) != bands)
+        return;
+
+    if (bands > m_BandsCapacity)
+    {
+        float *magnitudes = new (std::nothrow) float[bands];
+        float *phases = new (std::nothrow) float[bands];
+        if (magnitudes == NULL || phases == NULL)
+        {
+            delete [] magnitudes;
+            delete [] phases;
+            return;
+        }
+
+        delete [] m_pMagnitudes;
+        delete [] m_pPhases;
+        m_pMagnitudes = magnitudes;
+        m_pPhases = phases;
+        m_BandsCapacity = bands;
+    }
+
+    for (guint i = 0; i < bands; i++)
+    {
+        m_pMagnitudes[i] = g_value_get_float(gst_value_list_get_value(magnitudes_value, i));
+        m_pPhases[i] = g_value_get_float(gst_value_list_get_value(phases_value, i));
+    }
+
+    UpdateBands((int)bands, m_pMagnitudes, m_pPhases);
+}
+
 double CGstAudioSpectrum::GetInterval()
 {
     guint64 interval;
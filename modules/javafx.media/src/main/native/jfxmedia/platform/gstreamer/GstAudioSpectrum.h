@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,6 +41,8 @@ public:
     virtual void      SetBands(int bands, CBandsHolder* updater);
     virtual size_t    GetBands();
     virtual void      UpdateBands(int size, const float* magnitudes, const float* phases);
+    // Updates bands from the "spectrum" element message
+    void              UpdateBands(const GstStructure* pStructure);
 
     virtual double    GetInterval();
     virtual void      SetInterval(double interval);
@@ -51,6 +53,11 @@ public:
 private:
     GstElement*            m_pSpectrum;
     volatile CBandsHolder* m_pHolder;
+
+    // Reused between messages, only accessed from the bus thread
+    float*                 m_pMagnitudes;
+    float*                 m_pPhases;
+    guint                  m_BandsCapacity;
 };
 
 #endif // _GST_AUDIO_SPECTRUM_H_
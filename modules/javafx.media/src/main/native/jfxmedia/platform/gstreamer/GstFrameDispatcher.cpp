@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "GstFrameDispatcher.h"
+#include "GstVideoFrame.h"
+#include "GstPipelineMetrics.h"
+#include "GstJniUtils.h"
+#include <PipelineManagement/Pipeline.h>
+#include <jni/Logger.h>
+#include <PipelineManagement/PlayerEventDispatcher.h>
+#include <Common/VSMemory.h>
+#include <jfxmedia_errors.h>
+
+//*************************************************************************************************
+//********** class CGstFrameDispatcher
+//*************************************************************************************************
+CGstFrameDispatcher::CGstFrameDispatcher(CPipeline* pPipeline, CGstPipelineMetrics* pMetrics)
+:   m_pPipeline(pPipeline),
+    m_pMetrics(CGstPipelineMetrics::AddRef(pMetrics)),
+    m_pThread(NULL),
+    m_bStop(false),
+    m_uiHead(0),
+    m_uiCount(0)
+{
+    g_mutex_init(&m_Mutex);
+    g_cond_init(&m_Cond);
+}
+
+CGstFrameDispatcher::~CGstFrameDispatcher()
+{
+    Stop();
+    g_mutex_clear(&m_Mutex);
+    g_cond_clear(&m_Cond);
+    CGstPipelineMetrics::ReleaseRef(m_pMetrics);
+}
+
+/**
+ * CGstFrameDispatcher::Start()
+ *
+ * Starts the dispatch thread. Frames pushed before are sent as soon as it runs.
+ */
+bool CGstFrameDispatcher::Start()
+{
+    g_mutex_lock(&m_Mutex);
+    if (NULL == m_pThread)
+    {
+        m_bStop = false;
+        m_pThread = g_thread_try_new("jfxmedia-frames", DispatchThread, this, NULL);
+    }
+    bool result = (NULL != m_pThread);
+    g_mutex_unlock(&m_Mutex);
+
+    return result;
+}
+
+/**
+ * CGstFrameDispatcher::Stop()
+ *
+ * Stops the dispatch thread, waiting for a frame being sent, and drops the frames
+ * still queued. Frames pushed afterwards are dropped right away.
+ */
+void CGstFrameDispatcher::Stop()
+{
+    g_mutex_lock(&m_Mutex);
+    GThread* pThread = m_pThread;
+    m_pThread = NULL;
+    m_bStop = true;
+    g_cond_signal(&m_Cond);
+    g_mutex_unlock(&m_Mutex);
+
+    if (NULL != pThread)
+        g_thread_join(pThread);
+
+    Flush();
+}
+
+void CGstFrameDispatcher::Push(CGstVideoFrame* pFrame)
+{
+    CGstVideoFrame* pDropped = NULL;
+
+    g_mutex_lock(&m_Mutex);
+    if (m_bStop)
+    {
+        pDropped = pFrame;
+    }
+    else
+    {
+        if (m_uiCount == FRAME_DISPATCHER_QUEUE_SIZE)
+        {
+            // Java is falling behind, the oldest frame would be shown late anyway
+            pDropped = m_Queue[m_uiHead].pFrame;
+            m_uiHead = (m_uiHead + 1) % FRAME_DISPATCHER_QUEUE_SIZE;
+            m_uiCount--;
+            if (NULL != m_pMetrics)
+                m_pMetrics->Increment(METRIC_DROPPED_FRAMES);
+        }
+
+        QueuedFrame& entry = m_Queue[(m_uiHead + m_uiCount) % FRAME_DISPATCHER_QUEUE_SIZE];
+        entry.pFrame = pFrame;
+        entry.queueTime = g_get_monotonic_time();
+        m_uiCount++;
+        g_cond_signal(&m_Cond);
+    }
+    g_mutex_unlock(&m_Mutex);
+
+    if (NULL != pDropped)
+        delete pDropped;
+}
+
+void CGstFrameDispatcher::Flush()
+{
+    CGstVideoFrame* pDropped[FRAME_DISPATCHER_QUEUE_SIZE];
+    guint count = 0;
+
+    g_mutex_lock(&m_Mutex);
+    while (m_uiCount > 0)
+    {
+        pDropped[count++] = m_Queue[m_uiHead].pFrame;
+        m_uiHead = (m_uiHead + 1) % FRAME_DISPATCHER_QUEUE_SIZE;
+        m_uiCount--;
+    }
+    g_mutex_unlock(&m_Mutex);
+
+    for (guint i = 0; i < count; i++)
+        delete pDropped[i];
+}
+
+gpointer CGstFrameDispatcher::DispatchThread(gpointer data)
+{
+    CGstFrameDispatcher* pDispatcher = (CGstFrameDispatcher*)data;
+
+    // Attach to the JVM once for the life of the thread, so sending a frame does
+    // not attach and detach again. The thread is detached when it exits.
+    JNIEnv* pEnv = NULL;
+    if (!GstGetEnv(&pEnv))
+        LOGGER_LOGMSG(LOGGER_WARNING, "Cannot attach the frame dispatch thread to the JVM.\n");
+
+    g_mutex_lock(&pDispatcher->m_Mutex);
+    while (!pDispatcher->m_bStop)
+    {
+        if (pDispatcher->m_uiCount == 0)
+        {
+            g_cond_wait(&pDispatcher->m_Cond, &pDispatcher->m_Mutex);
+            continue;
+        }
+
+        QueuedFrame entry = pDispatcher->m_Queue[pDispatcher->m_uiHead];
+        pDispatcher->m_uiHead = (pDispatcher->m_uiHead + 1) % FRAME_DISPATCHER_QUEUE_SIZE;
+        pDispatcher->m_uiCount--;
+        g_mutex_unlock(&pDispatcher->m_Mutex);
+
+        pDispatcher->Dispatch(entry.pFrame);
+
+        if (NULL != pDispatcher->m_pMetrics)
+        {
+            gint64 handoffTime = g_get_monotonic_time() - entry.queueTime;
+            pDispatcher->m_pMetrics->RecordTime(METRIC_HANDOFF_TIME, handoffTime);
+            if (handoffTime > FRAME_DISPATCHER_LATE_USEC)
+                pDispatcher->m_pMetrics->Increment(METRIC_LATE_FRAMES);
+        }
+
+        g_mutex_lock(&pDispatcher->m_Mutex);
+    }
+    g_mutex_unlock(&pDispatcher->m_Mutex);
+
+    return NULL;
+}
+
+void CGstFrameDispatcher::Dispatch(CGstVideoFrame* pFrame)
+{
+    CPlayerEventDispatcher* pEventDispatcher = m_pPipeline->m_pEventDispatcher;
+    if (NULL == pEventDispatcher)
+    {
+        delete pFrame;
+        return;
+    }
+
+    // Send new frame which Java will delete later.
+    if (!pEventDispatcher->SendNewFrameEvent(pFrame))
+    {
+        if (!pEventDispatcher->SendPlayerMediaErrorEvent(ERROR_JNI_SEND_NEW_FRAME_EVENT))
+        {
+            LOGGER_LOGMSG(LOGGER_ERROR, "Cannot send media error event.\n");
+        }
+    }
+}
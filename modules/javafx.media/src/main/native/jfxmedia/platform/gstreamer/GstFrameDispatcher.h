@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef _GST_FRAME_DISPATCHER_H_
+#define _GST_FRAME_DISPATCHER_H_
+
+#include <gst/gst.h>
+
+class CPipeline;
+class CGstVideoFrame;
+class CGstPipelineMetrics;
+
+// Frames waiting for Java at most, older frames are dropped to make room
+#define FRAME_DISPATCHER_QUEUE_SIZE 4
+
+// A frame is counted late when it waited longer than this for Java, in microseconds
+#define FRAME_DISPATCHER_LATE_USEC  (G_USEC_PER_SEC / 50)
+
+/**
+ * class CGstFrameDispatcher
+ *
+ * Hands decoded frames from the GStreamer streaming thread to Java on a thread
+ * of its own, so a slow event dispatch never holds up decoding. The queue lock is
+ * held only to add or take a frame, never across the call into Java.
+ */
+class CGstFrameDispatcher
+{
+public:
+    CGstFrameDispatcher(CPipeline* pPipeline, CGstPipelineMetrics* pMetrics);
+    ~CGstFrameDispatcher();
+
+    bool    Start();
+    void    Stop();
+
+    // Takes ownership of the frame
+    void    Push(CGstVideoFrame* pFrame);
+    // Drops the frames not handed to Java yet
+    void    Flush();
+
+private:
+    struct QueuedFrame
+    {
+        CGstVideoFrame* pFrame;
+        gint64          queueTime;
+    };
+
+    static gpointer DispatchThread(gpointer data);
+    void            Dispatch(CGstVideoFrame* pFrame);
+
+    CPipeline*  m_pPipeline;
+    CGstPipelineMetrics* m_pMetrics;
+    GThread*    m_pThread;
+    GMutex      m_Mutex;
+    GCond       m_Cond;
+    bool        m_bStop;
+
+    QueuedFrame m_Queue[FRAME_DISPATCHER_QUEUE_SIZE];
+    guint       m_uiHead;
+    guint       m_uiCount;
+};
+
+#endif // _GST_FRAME_DISPATCHER_H_
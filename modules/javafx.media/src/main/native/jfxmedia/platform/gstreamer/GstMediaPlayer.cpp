@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,7 @@
 #include <Utils/LowLevelPerf.h>
 
 #include "GstAudioEqualizer.h"
+#include "GstPipelineMetrics.h"
 
 using namespace std;
 
@@ -169,6 +170,78 @@ JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTMed
     return iRet;
 }
 
+/**
+ * gstGetStatistics()
+ *
+ * Gets the playback statistics of the media, see MediaPlayerStatistics for the layout.
+ */
+JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTMediaPlayer_gstGetStatistics
+(JNIEnv *env, jobject obj, jlong ref_media, jlongArray jrglStatistics)
+{
+    CMedia* pMedia = (CMedia*)jlong_to_ptr(ref_media);
+    if (NULL == pMedia)
+        return ERROR_MEDIA_NULL;
+
+    CPipeline* pPipeline = (CPipeline*)pMedia->GetPipeline();
+    if (NULL == pPipeline)
+        return ERROR_PIPELINE_NULL;
+
+    jlong values[METRIC_COUNT];
+    jsize count = env->GetArrayLength(jrglStatistics);
+    if (count > METRIC_COUNT)
+        count = METRIC_COUNT;
+
+    uint32_t uErrCode = pPipeline->GetStatistics((int64_t*)values, (int)count);
+    if (ERROR_NONE != uErrCode)
+        return (jint)uErrCode;
+
+    env->SetLongArrayRegion(jrglStatistics, 0, count, values);
+    if (env->ExceptionCheck()) {
+        env->ExceptionClear();
+        return ERROR_JNI_UNEXPECTED;
+    }
+
+    return ERROR_NONE;
+}
+
+/**
+ * gstSetDecodePriority()
+ *
+ * Sets the scheduling priority of the threads decoding the media.
+ */
+JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTMediaPlayer_gstSetDecodePriority
+(JNIEnv *env, jobject obj, jlong ref_media, jint priority)
+{
+    CMedia* pMedia = (CMedia*)jlong_to_ptr(ref_media);
+    if (NULL == pMedia)
+        return ERROR_MEDIA_NULL;
+
+    CPipeline* pPipeline = (CPipeline*)pMedia->GetPipeline();
+    if (NULL == pPipeline)
+        return ERROR_PIPELINE_NULL;
+
+    return (jint)pPipeline->SetDecodePriority((int)priority);
+}
+
+/**
+ * gstSetOutputSizeHint()
+ *
+ * Sets the size the video is displayed at.
+ */
+JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTMediaPlayer_gstSetOutputSizeHint
+(JNIEnv *env, jobject obj, jlong ref_media, jint width, jint height)
+{
+    CMedia* pMedia = (CMedia*)jlong_to_ptr(ref_media);
+    if (NULL == pMedia)
+        return ERROR_MEDIA_NULL;
+
+    CPipeline* pPipeline = (CPipeline*)pMedia->GetPipeline();
+    if (NULL == pPipeline)
+        return ERROR_PIPELINE_NULL;
+
+    return (jint)pPipeline->SetOutputSizeHint((int)width, (int)height);
+}
+
 /**
  * gstPlay()
  *
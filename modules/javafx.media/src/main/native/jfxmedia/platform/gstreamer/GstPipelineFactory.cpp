@@ -43,11 +43,15 @@
 // From HLSConnectionHolder.java
 #define HLS_PROP_GET_HLS_MODE   2
 #define HLS_PROP_GET_MIMETYPE   3
+#define HLS_PROP_GET_LOW_LATENCY 7
 #define HLS_VALUE_MIMETYPE_MP2T 1
 #define HLS_VALUE_MIMETYPE_MP3  2
 #define HLS_VALUE_MIMETYPE_FMP4 3
 #define HLS_VALUE_MIMETYPE_AAC  4
 
+// Blocks javasource reads ahead for sequential sources
+#define SOURCE_READ_AHEAD_BLOCKS 8
+
 
 //*************************************************************************************************
 //********** class CGstPipelineFactory
@@ -93,6 +97,8 @@ uint32_t CGstPipelineFactory::CreatePlayerPipeline(CLocator* locator, CPipelineO
 
     int hlsMode = callbacks->Property(HLS_PROP_GET_HLS_MODE, 0);
     pOptions->SetHLSModeEnabled(hlsMode == 1);
+    if (hlsMode == 1)
+        pOptions->SetHLSLowLatency(callbacks->Property(HLS_PROP_GET_LOW_LATENCY, 0) == 1);
     int streamMimeType = callbacks->Property(HLS_PROP_GET_MIMETYPE, 0);
     pOptions->SetStreamMimeType(streamMimeType);
 
@@ -244,15 +250,21 @@ uint32_t CGstPipelineFactory::CreateSourceElement(CLocator *locator, CStreamCall
 
     g_signal_connect(javaSource, "read-next-block", G_CALLBACK(SourceReadNextBlock), callbacks);
     g_signal_connect(javaSource, "copy-block", G_CALLBACK(SourceCopyBlock), callbacks);
+    g_signal_connect(javaSource, "read-next-block-direct", G_CALLBACK(SourceReadNextBlockDirect), callbacks);
     g_signal_connect(javaSource, "seek-data", G_CALLBACK(SourceSeekData), callbacks);
     g_signal_connect(javaSource, "close-connection", G_CALLBACK(SourceCloseConnection), callbacks);
     g_signal_connect(javaSource, "property", G_CALLBACK(SourceProperty), callbacks);
 
     if (isRandomAccess)
+    {
         g_signal_connect(javaSource, "read-block", G_CALLBACK(SourceReadBlock), callbacks);
+        g_signal_connect(javaSource, "read-block-direct", G_CALLBACK(SourceReadBlockDirect), callbacks);
+    }
 
     if (pOptions->GetHLSModeEnabled())
         g_object_set(javaSource, "hls-mode", TRUE, NULL);
+    else if (!isRandomAccess)
+        g_object_set(javaSource, "read-ahead", SOURCE_READ_AHEAD_BLOCKS, NULL);
 
     if (streamMimeType == HLS_VALUE_MIMETYPE_MP2T)
         g_object_set(javaSource, "mimetype", CONTENT_TYPE_MP2T, NULL);
@@ -319,6 +331,16 @@ void CGstPipelineFactory::SourceCopyBlock(GstElement *src, gpointer buffer, int
     ((CStreamCallbacks*)data)->CopyBlock(buffer, size);
 }
 
+gint CGstPipelineFactory::SourceReadNextBlockDirect(GstElement *src, gpointer buffer, int size, gpointer data)
+{
+    return ((CStreamCallbacks*)data)->ReadNextBlock(buffer, size);
+}
+
+gint CGstPipelineFactory::SourceReadBlockDirect(GstElement *src, guint64 position, guint size, gpointer buffer, gpointer data)
+{
+    return ((CStreamCallbacks*)data)->ReadBlock(position, size, buffer);
+}
+
 gint64 CGstPipelineFactory::SourceSeekData(GstElement *src, guint64 offset, gpointer data)
 {
     return (gint64)((CStreamCallbacks*)data)->Seek((int64_t)offset);
@@ -336,6 +358,8 @@ void CGstPipelineFactory::SourceCloseConnection(GstElement *src, gpointer data)
     g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceReadNextBlock), callbacks);
     g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceReadBlock), callbacks);
     g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceCopyBlock), callbacks);
+    g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceReadNextBlockDirect), callbacks);
+    g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceReadBlockDirect), callbacks);
     g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceSeekData), callbacks);
     g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceCloseConnection), callbacks);
     g_signal_handlers_disconnect_by_func (src, (void*)G_CALLBACK (SourceProperty), callbacks);
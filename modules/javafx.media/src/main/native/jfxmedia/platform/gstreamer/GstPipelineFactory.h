@@ -85,6 +85,8 @@ private:
     static gint     SourceReadNextBlock(GstElement *src, gpointer data);
     static gint     SourceReadBlock(GstElement *src, guint64 position, guint size, gpointer data);
     static void     SourceCopyBlock(GstElement *src, gpointer buffer, int size, gpointer data);
+    static gint     SourceReadNextBlockDirect(GstElement *src, gpointer buffer, int size, gpointer data);
+    static gint     SourceReadBlockDirect(GstElement *src, guint64 position, guint size, gpointer buffer, gpointer data);
     static gint64   SourceSeekData(GstElement *src, guint64 offset, gpointer data);
     static void     SourceCloseConnection(GstElement *src, gpointer data);
     static int      SourceProperty(GstElement *src, int prop, int value, gpointer data);
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "GstPipelineMetrics.h"
+
+//*************************************************************************************************
+//********** class CGstPipelineMetrics
+//*************************************************************************************************
+CGstPipelineMetrics* CGstPipelineMetrics::Create()
+{
+    return new CGstPipelineMetrics();
+}
+
+CGstPipelineMetrics::CGstPipelineMetrics()
+{
+    g_atomic_int_set(&m_RefCounter, 1);
+    for (int i = 0; i < METRIC_COUNT; i++)
+        m_Values[i] = 0;
+}
+
+CGstPipelineMetrics* CGstPipelineMetrics::AddRef(CGstPipelineMetrics* metrics)
+{
+    if (metrics != NULL)
+        g_atomic_int_add(&metrics->m_RefCounter, 1);
+    return metrics;
+}
+
+void CGstPipelineMetrics::ReleaseRef(CGstPipelineMetrics* metrics)
+{
+    if (metrics != NULL && g_atomic_int_dec_and_test(&metrics->m_RefCounter))
+        delete metrics;
+}
+
+void CGstPipelineMetrics::Increment(PipelineMetric metric)
+{
+    g_atomic_pointer_add(&m_Values[metric], 1);
+}
+
+void CGstPipelineMetrics::Set(PipelineMetric metric, gsize value)
+{
+    g_atomic_pointer_set(&m_Values[metric], value);
+}
+
+/**
+ * CGstPipelineMetrics::RecordTime()
+ *
+ * Records a duration. The total goes to metric, the maximum to the one after
+ * it and the histogram bucket to histogram.
+ *
+ * @param   metric      METRIC_CONVERSION_TIME or METRIC_HANDOFF_TIME
+ * @param   usec        duration in microseconds
+ */
+void CGstPipelineMetrics::RecordTime(PipelineMetric metric, gint64 usec)
+{
+    if (usec < 0)
+        usec = 0;
+
+    g_atomic_pointer_add(&m_Values[metric], (gssize)usec);
+
+    gsize max = (gsize)g_atomic_pointer_get(&m_Values[metric + 1]);
+    while ((gsize)usec > max &&
+           !g_atomic_pointer_compare_and_exchange(&m_Values[metric + 1], max, (gsize)usec))
+        max = (gsize)g_atomic_pointer_get(&m_Values[metric + 1]);
+
+    int histogram = (metric == METRIC_CONVERSION_TIME) ? METRIC_CONVERSION_HISTOGRAM : METRIC_HANDOFF_HISTOGRAM;
+    int bucket = 0;
+    for (gint64 limit = 1000; bucket < METRIC_HISTOGRAM_BUCKETS - 1 && usec >= limit; limit <<= 1)
+        bucket++;
+    g_atomic_pointer_add(&m_Values[histogram + bucket], 1);
+}
+
+void CGstPipelineMetrics::GetValues(int64_t* pValues, int iCount)
+{
+    for (int i = 0; i < iCount; i++)
+        pValues[i] = (i < METRIC_COUNT) ? (int64_t)g_atomic_pointer_get(&m_Values[i]) : 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef _GST_PIPELINE_METRICS_H_
+#define _GST_PIPELINE_METRICS_H_
+
+#include <stdint.h>
+#include <gst/gst.h>
+
+// Number of buckets of a time histogram. Bucket i counts the samples below
+// 2^i milliseconds, the last one everything longer.
+#define METRIC_HISTOGRAM_BUCKETS 8
+
+// Layout of the statistics array copied to Java; keep in sync with
+// com.sun.media.jfxmedia.MediaPlayerStatistics.
+enum PipelineMetric
+{
+    METRIC_DECODED_FRAMES = 0,
+    METRIC_DROPPED_FRAMES,
+    METRIC_LATE_FRAMES,
+    METRIC_INVALID_FRAMES,
+    METRIC_CONVERTED_FRAMES,
+    METRIC_CONVERSION_TIME,         // microseconds
+    METRIC_CONVERSION_TIME_MAX,     // microseconds
+    METRIC_HANDOFF_TIME,            // microseconds
+    METRIC_HANDOFF_TIME_MAX,        // microseconds
+    METRIC_QUEUE_OVERRUNS,
+    METRIC_QUEUE_UNDERRUNS,
+    METRIC_AUDIO_QUEUE_LIMIT,       // max-size-buffers of the audio queue
+    METRIC_VIDEO_QUEUE_LIMIT,       // max-size-buffers of the video queue
+    METRIC_BUFFERING_STALLS,
+    METRIC_CONVERSION_HISTOGRAM,
+    METRIC_HANDOFF_HISTOGRAM = METRIC_CONVERSION_HISTOGRAM + METRIC_HISTOGRAM_BUCKETS,
+    METRIC_COUNT = METRIC_HANDOFF_HISTOGRAM + METRIC_HISTOGRAM_BUCKETS
+};
+
+/**
+ * class CGstPipelineMetrics
+ *
+ * Always-on playback counters of one pipeline. Every value is updated with a
+ * single atomic operation, so the streaming threads never wait on a reader.
+ * Frames keep a reference since they may be converted after the pipeline is gone.
+ */
+class CGstPipelineMetrics
+{
+public:
+    static CGstPipelineMetrics* Create();
+    static CGstPipelineMetrics* AddRef(CGstPipelineMetrics* metrics);
+    static void                 ReleaseRef(CGstPipelineMetrics* metrics);
+
+    void    Increment(PipelineMetric metric);
+    void    Set(PipelineMetric metric, gsize value);
+    // Adds a duration to the total, maximum and histogram following metric
+    void    RecordTime(PipelineMetric metric, gint64 usec);
+
+    void    GetValues(int64_t* pValues, int iCount);
+
+private:
+    CGstPipelineMetrics();
+
+    volatile gint   m_RefCounter;
+    volatile gsize  m_Values[METRIC_COUNT];
+};
+
+#endif // _GST_PIPELINE_METRICS_H_
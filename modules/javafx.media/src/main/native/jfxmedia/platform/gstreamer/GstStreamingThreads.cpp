@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "GstStreamingThreads.h"
+
+#if TARGET_OS_LINUX
+#include <errno.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#elif TARGET_OS_MAC
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace std;
+
+//*************************************************************************************************
+//********** class CGstStreamingThreads
+//*************************************************************************************************
+CGstStreamingThreads::CGstStreamingThreads()
+{
+    m_pLock = CJfxCriticalSection::Create();
+    m_iPriority = DECODE_PRIORITY_NORMAL;
+}
+
+CGstStreamingThreads::~CGstStreamingThreads()
+{
+    // The pipeline is in the NULL state, every thread has left
+    for (size_t i = 0; i < m_Threads.size(); i++)
+        Detach(&m_Threads[i]);
+
+    delete m_pLock;
+}
+
+/**
+ * CGstStreamingThreads::BusSyncHandler()
+ *
+ * Bus sync handler of the pipeline. Stream status messages are posted by the
+ * streaming thread when it starts and stops running a task.
+ */
+GstBusSyncReply CGstStreamingThreads::BusSyncHandler(GstBus* pBus, GstMessage* pMessage, gpointer pData)
+{
+    if (GST_MESSAGE_TYPE(pMessage) == GST_MESSAGE_STREAM_STATUS)
+    {
+        CGstStreamingThreads* pThreads = (CGstStreamingThreads*)pData;
+        GstStreamStatusType type;
+        GstElement* pOwner = NULL;
+
+        gst_message_parse_stream_status(pMessage, &type, &pOwner);
+        if (type == GST_STREAM_STATUS_TYPE_ENTER)
+            pThreads->Enter();
+        else if (type == GST_STREAM_STATUS_TYPE_LEAVE)
+            pThreads->Leave();
+    }
+
+    return GST_BUS_PASS;
+}
+
+void CGstStreamingThreads::Enter()
+{
+    StreamingThread thread;
+    thread.pThread = g_thread_self();
+    if (!Attach(&thread))
+        return;
+
+    m_pLock->Enter();
+    if (m_iPriority != DECODE_PRIORITY_NORMAL)
+        Apply(&thread, m_iPriority);
+    m_Threads.push_back(thread);
+    m_pLock->Exit();
+}
+
+void CGstStreamingThreads::Leave()
+{
+    GThread* pSelf = g_thread_self();
+
+    m_pLock->Enter();
+    for (vector<StreamingThread>::iterator it = m_Threads.begin(); it != m_Threads.end(); ++it)
+    {
+        if (it->pThread == pSelf)
+        {
+            Detach(&*it);
+            m_Threads.erase(it);
+            break;
+        }
+    }
+    m_pLock->Exit();
+}
+
+void CGstStreamingThreads::SetPriority(int iPriority)
+{
+    m_pLock->Enter();
+    if (iPriority != m_iPriority)
+    {
+        m_iPriority = iPriority;
+        for (size_t i = 0; i < m_Threads.size(); i++)
+            Apply(&m_Threads[i], iPriority);
+    }
+    m_pLock->Exit();
+}
+
+#if TARGET_OS_WIN32
+
+bool CGstStreamingThreads::Attach(StreamingThread* pThread)
+{
+    pThread->hThread = OpenThread(THREAD_SET_INFORMATION | THREAD_QUERY_INFORMATION, FALSE, GetCurrentThreadId());
+    if (pThread->hThread == NULL)
+        return false;
+
+    pThread->iBasePriority = GetThreadPriority(pThread->hThread);
+    pThread->bAdjustable = pThread->iBasePriority != THREAD_PRIORITY_ERROR_RETURN;
+    return true;
+}
+
+void CGstStreamingThreads::Detach(StreamingThread* pThread)
+{
+    Apply(pThread, DECODE_PRIORITY_NORMAL);
+    CloseHandle(pThread->hThread);
+}
+
+void CGstStreamingThreads::Apply(StreamingThread* pThread, int iPriority)
+{
+    if (!pThread->bAdjustable)
+        return;
+
+    int iLevel = pThread->iBasePriority;
+    if (iPriority < DECODE_PRIORITY_NORMAL)
+        iLevel -= 2;
+    else if (iPriority > DECODE_PRIORITY_NORMAL)
+        iLevel += 1;
+
+    if (iLevel < THREAD_PRIORITY_LOWEST)
+        iLevel = THREAD_PRIORITY_LOWEST;
+    else if (iLevel > THREAD_PRIORITY_HIGHEST)
+        iLevel = THREAD_PRIORITY_HIGHEST;
+
+    SetThreadPriority(pThread->hThread, iLevel);
+}
+
+#elif TARGET_OS_LINUX
+
+bool CGstStreamingThreads::Attach(StreamingThread* pThread)
+{
+    pThread->tid = (pid_t)syscall(SYS_gettid);
+
+    errno = 0;
+    pThread->iBasePriority = getpriority(PRIO_PROCESS, pThread->tid);
+    if (errno != 0)
+        return false;
+
+    // Without privileges a raised nice value can only be lowered as far as
+    // RLIMIT_NICE allows. Leave the thread alone if it could not get back.
+    struct rlimit limit;
+    pThread->bAdjustable = geteuid() == 0 ||
+        (getrlimit(RLIMIT_NICE, &limit) == 0 &&
+         (limit.rlim_cur == RLIM_INFINITY || 20 - (int)limit.rlim_cur <= pThread->iBasePriority));
+    return true;
+}
+
+void CGstStreamingThreads::Detach(StreamingThread* pThread)
+{
+    Apply(pThread, DECODE_PRIORITY_NORMAL);
+}
+
+void CGstStreamingThreads::Apply(StreamingThread* pThread, int iPriority)
+{
+    if (!pThread->bAdjustable)
+        return;
+
+    int iNice = pThread->iBasePriority;
+    if (iPriority < DECODE_PRIORITY_NORMAL)
+        iNice += 10;
+    else if (iPriority > DECODE_PRIORITY_NORMAL)
+        iNice -= 5;
+
+    if (iNice < -20)
+        iNice = -20;
+    else if (iNice > 19)
+        iNice = 19;
+
+    // Raising the priority above the original one may not be permitted
+    setpriority(PRIO_PROCESS, pThread->tid, iNice);
+}
+
+#elif TARGET_OS_MAC
+
+bool CGstStreamingThreads::Attach(StreamingThread* pThread)
+{
+    struct sched_param param;
+
+    pThread->thread = pthread_self();
+    if (pthread_getschedparam(pThread->thread, &pThread->iPolicy, &param) != 0)
+        return false;
+
+    pThread->iBasePriority = param.sched_priority;
+    pThread->bAdjustable = true;
+    return true;
+}
+
+void CGstStreamingThreads::Detach(StreamingThread* pThread)
+{
+    Apply(pThread, DECODE_PRIORITY_NORMAL);
+}
+
+void CGstStreamingThreads::Apply(StreamingThread* pThread, int iPriority)
+{
+    struct sched_param param;
+    int iMin = sched_get_priority_min(pThread->iPolicy);
+    int iMax = sched_get_priority_max(pThread->iPolicy);
+
+    param.sched_priority = pThread->iBasePriority;
+    if (iPriority < DECODE_PRIORITY_NORMAL)
+        param.sched_priority -= 8;
+    else if (iPriority > DECODE_PRIORITY_NORMAL)
+        param.sched_priority += 4;
+
+    if (param.sched_priority < iMin)
+        param.sched_priority = iMin;
+    else if (param.sched_priority > iMax)
+        param.sched_priority = iMax;
+
+    pthread_setschedparam(pThread->thread, pThread->iPolicy, &param);
+}
+
+#else
+
+bool CGstStreamingThreads::Attach(StreamingThread* pThread)
+{
+    return false;
+}
+
+void CGstStreamingThreads::Detach(StreamingThread* pThread)
+{
+}
+
+void CGstStreamingThreads::Apply(StreamingThread* pThread, int iPriority)
+{
+}
+
+#endif // TARGET_OS_WIN32
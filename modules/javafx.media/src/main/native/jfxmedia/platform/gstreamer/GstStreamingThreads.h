@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef _GST_STREAMING_THREADS_H_
+#define _GST_STREAMING_THREADS_H_
+
+#include <Common/ProductFlags.h>
+#include <Utils/JfxCriticalSection.h>
+#include <gst/gst.h>
+#include <vector>
+
+#if TARGET_OS_LINUX
+#include <sys/types.h>
+#endif
+
+// Decode priorities; keep in sync with com.sun.media.jfxmedia.MediaPlayer.
+enum DecodePriority
+{
+    DECODE_PRIORITY_LOW = -1,
+    DECODE_PRIORITY_NORMAL = 0,
+    DECODE_PRIORITY_HIGH = 1
+};
+
+/**
+ * class CGstStreamingThreads
+ *
+ * Tracks the streaming threads of one pipeline and applies its decode
+ * priority to them. Threads are added and removed from the bus sync handler
+ * on the stream status messages they post themselves. The GStreamer task
+ * pool reuses threads across pipelines, so a thread gets its original
+ * priority back when it leaves.
+ */
+class CGstStreamingThreads
+{
+public:
+    CGstStreamingThreads();
+    ~CGstStreamingThreads();
+
+    // Called on the streaming thread
+    void    Enter();
+    void    Leave();
+
+    void    SetPriority(int iPriority);
+
+    static GstBusSyncReply BusSyncHandler(GstBus* pBus, GstMessage* pMessage, gpointer pData);
+
+private:
+    struct StreamingThread
+    {
+        GThread*    pThread;
+#if TARGET_OS_WIN32
+        HANDLE      hThread;
+#elif TARGET_OS_LINUX
+        pid_t       tid;
+#elif TARGET_OS_MAC
+        pthread_t   thread;
+        int         iPolicy;
+#endif
+        int         iBasePriority;
+        bool        bAdjustable;    // false if the original priority could not be restored
+    };
+
+    static bool Attach(StreamingThread* pThread);
+    static void Detach(StreamingThread* pThread);
+    static void Apply(StreamingThread* pThread, int iPriority);
+
+    CJfxCriticalSection*            m_pLock;
+    int                             m_iPriority;
+    std::vector<StreamingThread>    m_Threads;
+};
+
+#endif // _GST_STREAMING_THREADS_H_
@@ -25,6 +25,7 @@
 
 #include "GstVideoFrame.h"
 #include "GstPipelineFactory.h"
+#include "GstPipelineMetrics.h"
 #include <cstring>
 #include <jni/Logger.h>
 #include <Common/ProductFlags.h>
@@ -32,15 +33,6 @@
 #include <Utils/LowLevelPerf.h>
 #include <Utils/ColorConverter.h>
 
-static inline guint32 swap_uint32(guint32 x)
-{
-    return
-        ((x & 0x000000ffU) << 24) |
-        ((x & 0x0000ff00U) <<  8) |
-        ((x & 0x00ff0000U) >>  8) |
-        ((x & 0xff000000U) >> 24);
-}
-
 static void free_aligned_buffer(gpointer ptr)
 {
     if (ptr != NULL) {
@@ -73,6 +65,144 @@ static GstBuffer *alloc_aligned_buffer(guint size)
     return gst_buffer_new_wrapped_full((GstMemoryFlags)0, alignedData, alignedSize, 0, alignedSize, newData, free_aligned_buffer);
 }
 
+/*
+ * Header in front of the data of a pooled buffer.
+ */
+typedef struct FrameBlock {
+    CGstFrameBufferPool* pool;
+    guint                size;
+    struct FrameBlock*   next;  // next free block
+} FrameBlock;
+
+// the data of a block starts at the first 16 byte boundary after its header
+#define FRAME_BLOCK_DATA(block) ((guint8*)(((intptr_t)(block) + sizeof(FrameBlock) + 15) & ~15))
+
+CGstFrameBufferPool* CGstFrameBufferPool::Create()
+{
+    return new CGstFrameBufferPool();
+}
+
+CGstFrameBufferPool::CGstFrameBufferPool()
+{
+    g_atomic_int_set(&m_RefCounter, 1);
+    g_mutex_init(&m_Mutex);
+    m_uiBlockSize = 0;
+    m_pFreeBlocks = NULL;
+    m_uiFreeCount = 0;
+    m_uiInFlight = 0;
+    m_uiMaxInFlight = 0;
+}
+
+CGstFrameBufferPool::~CGstFrameBufferPool()
+{
+    ClearFreeBlocks();
+    g_mutex_clear(&m_Mutex);
+}
+
+CGstFrameBufferPool* CGstFrameBufferPool::AddRef(CGstFrameBufferPool* pool)
+{
+    if (pool != NULL)
+        g_atomic_int_add(&pool->m_RefCounter, 1);
+    return pool;
+}
+
+void CGstFrameBufferPool::ReleaseRef(CGstFrameBufferPool* pool)
+{
+    if (pool != NULL && g_atomic_int_dec_and_test(&pool->m_RefCounter))
+        delete pool;
+}
+
+// Must be called with m_Mutex held, or from the destructor
+void CGstFrameBufferPool::ClearFreeBlocks()
+{
+    FrameBlock *block = (FrameBlock*)m_pFreeBlocks;
+
+    while (block != NULL) {
+        FrameBlock *next = block->next;
+        g_free(block);
+        block = next;
+    }
+    m_pFreeBlocks = NULL;
+    m_uiFreeCount = 0;
+}
+
+GstBuffer *CGstFrameBufferPool::AllocBuffer(guint size)
+{
+    FrameBlock *block = NULL;
+
+    if (size > (G_MAXUINT - sizeof(FrameBlock) - 15)) {
+        return NULL;
+    }
+
+    g_mutex_lock(&m_Mutex);
+    if (size != m_uiBlockSize) {
+        // New caps, buffers of the old size will not be asked for again
+        ClearFreeBlocks();
+        m_uiBlockSize = size;
+        m_uiMaxInFlight = 0;
+    }
+    if (m_pFreeBlocks != NULL) {
+        block = (FrameBlock*)m_pFreeBlocks;
+        m_pFreeBlocks = block->next;
+        m_uiFreeCount--;
+    }
+    m_uiInFlight++;
+    if (m_uiInFlight > m_uiMaxInFlight) {
+        m_uiMaxInFlight = m_uiInFlight;
+    }
+    g_mutex_unlock(&m_Mutex);
+
+    if (NULL == block) {
+        block = (FrameBlock*)g_try_malloc(size + sizeof(FrameBlock) + 15);
+        if (NULL == block) {
+            g_mutex_lock(&m_Mutex);
+            m_uiInFlight--;
+            g_mutex_unlock(&m_Mutex);
+            return NULL;
+        }
+        block->size = size;
+    }
+
+    // Every buffer handed out keeps the pool alive until it comes back
+    block->pool = AddRef(this);
+    block->next = NULL;
+
+    return gst_buffer_new_wrapped_full((GstMemoryFlags)0, FRAME_BLOCK_DATA(block), size, 0, size, block, FreeBlock);
+}
+
+void CGstFrameBufferPool::RecycleBlock(gpointer ptr)
+{
+    FrameBlock *block = (FrameBlock*)ptr;
+    guint maxFree;
+
+    g_mutex_lock(&m_Mutex);
+    m_uiInFlight--;
+
+    // Keep as many buffers as the renderer held at one time
+    maxFree = MIN(MAX(m_uiMaxInFlight, 1), FRAME_BUFFER_POOL_MAX_FREE);
+    if (block->size == m_uiBlockSize && m_uiFreeCount < maxFree) {
+        block->next = (FrameBlock*)m_pFreeBlocks;
+        m_pFreeBlocks = block;
+        m_uiFreeCount++;
+        block = NULL;
+    }
+    g_mutex_unlock(&m_Mutex);
+
+    if (block != NULL) {
+        g_free(block);
+    }
+}
+
+void CGstFrameBufferPool::FreeBlock(gpointer ptr)
+{
+    FrameBlock *block = (FrameBlock*)ptr;
+    CGstFrameBufferPool *pool = block->pool;
+
+    block->pool = NULL;
+    pool->RecycleBlock(block);
+    ReleaseRef(pool);
+}
+
 GstCaps *create_RGB_caps(CVideoFrame::FrameType type, guint width, guint height, guint encodedWidth, guint encodedHeight, guint stride)
 {
     gint red_mask, green_mask, blue_mask, alpha_mask;
@@ -114,6 +244,8 @@ CGstVideoFrame::CGstVideoFrame()
     m_pSample = NULL;
     m_pBuffer = NULL;
     m_bIsI420 = false;
+    m_pPool = NULL;
+    m_pMetrics = NULL;
 }
 
 CGstVideoFrame::~CGstVideoFrame()
@@ -122,12 +254,18 @@ CGstVideoFrame::~CGstVideoFrame()
 
     if (NULL != m_pBuffer)
         Dispose();
+
+    CGstFrameBufferPool::ReleaseRef(m_pPool);
+    CGstPipelineMetrics::ReleaseRef(m_pMetrics);
 }
 
-bool CGstVideoFrame::Init(GstSample* sample)
+bool CGstVideoFrame::Init(GstSample* sample, CGstFrameBufferPool* pPool, CGstPipelineMetrics* pMetrics)
 {
     LOWLEVELPERF_COUNTERINC("CGstVideoFrame", 1, 1);
 
+    m_pPool = CGstFrameBufferPool::AddRef(pPool);
+    m_pMetrics = CGstPipelineMetrics::AddRef(pMetrics);
+
     // Increment the ref count as this object will be created
     // by the video sink and pushed into the FrameQueue.
     m_pSample = gst_sample_ref(sample);
@@ -180,6 +318,8 @@ void CGstVideoFrame::SetFrameCaps(GstCaps *newCaps)
     } else if (gst_structure_has_name(str, "video/x-raw-yuv")) {
         if (sFormatFourCC != NULL && g_ascii_strcasecmp(sFormatFourCC, FOURCC_UYVY) == 0) {
             m_typeFrame = YCbCr_422;
+        } else if (sFormatFourCC != NULL && g_ascii_strcasecmp(sFormatFourCC, FOURCC_YV12_10LE) == 0) {
+            m_typeFrame = YCbCr_420p10;
         } else {
             if (sFormatFourCC != NULL && g_ascii_strcasecmp(sFormatFourCC, FOURCC_I420) == 0) {
                 m_bIsI420 = true;
@@ -243,15 +383,17 @@ void CGstVideoFrame::SetFrameCaps(GstCaps *newCaps)
     Reset();
 
     switch (m_typeFrame) {
-        case YCbCr_420p: {
+        case YCbCr_420p:
+        case YCbCr_420p10: {
             unsigned int offset = 0;
+            unsigned int sampleSize = (m_typeFrame == YCbCr_420p10) ? 2 : 1;
             SetPlaneCount(3);
 
             if (!gst_structure_get_int(str, "stride-y", (int*)&m_puiPlaneStrides[0])) {
-                m_puiPlaneStrides[0] = m_uiEncodedWidth;
+                m_puiPlaneStrides[0] = m_uiEncodedWidth * sampleSize;
             }
             if (!gst_structure_get_int(str, "stride-v", (int*)&m_puiPlaneStrides[1])) {
-                m_puiPlaneStrides[1] = m_uiEncodedWidth/2;
+                m_puiPlaneStrides[1] = m_uiEncodedWidth/2 * sampleSize;
             }
             if (!gst_structure_get_int(str, "stride-u", (int*)&m_puiPlaneStrides[2])) {
                 m_puiPlaneStrides[2] = m_puiPlaneStrides[1];
@@ -339,6 +481,19 @@ void CGstVideoFrame::Dispose()
         gst_sample_unref(m_pSample);
         m_pSample = NULL;
     }
+
+    CGstFrameBufferPool::ReleaseRef(m_pPool);
+    m_pPool = NULL;
+    CGstPipelineMetrics::ReleaseRef(m_pMetrics);
+    m_pMetrics = NULL;
+}
+
+GstBuffer *CGstVideoFrame::AllocFrameBuffer(guint size)
+{
+    if (m_pPool != NULL) {
+        return m_pPool->AllocBuffer(size);
+    }
+    return alloc_aligned_buffer(size);
 }
 
 CVideoFrame *CGstVideoFrame::ConvertToFormat(FrameType type)
@@ -350,11 +505,13 @@ CVideoFrame *CGstVideoFrame::ConvertToFormat(FrameType type)
         return this;
     }
 
-    if ((type == YCbCr_422) || (type == YCbCr_420p)) {
+    if ((type == YCbCr_422) || (type == YCbCr_420p) || (type == YCbCr_420p10)) {
         LOGGER_LOGMSG(LOGGER_DEBUG, "Conversion to YCbCr is not supported");
         return NULL;
     }
 
+    gint64 startTime = (m_pMetrics != NULL) ? g_get_monotonic_time() : 0;
+
     switch (m_typeFrame) {
         case ARGB:
         case BGRA_PRE:
@@ -365,6 +522,10 @@ CVideoFrame *CGstVideoFrame::ConvertToFormat(FrameType type)
             newFrame = ConvertFromYCbCr420p(type);
             break;
 
+        case YCbCr_420p10:
+            newFrame = ConvertFromYCbCr420p10(type);
+            break;
+
         case YCbCr_422:
             newFrame = ConvertFromYCbCr422(type);
             break;
@@ -373,6 +534,11 @@ CVideoFrame *CGstVideoFrame::ConvertToFormat(FrameType type)
             break;
     }
 
+    if (m_pMetrics != NULL && newFrame != NULL) {
+        m_pMetrics->Increment(METRIC_CONVERTED_FRAMES);
+        m_pMetrics->RecordTime(METRIC_CONVERSION_TIME, g_get_monotonic_time() - startTime);
+    }
+
     return newFrame;
 }
 
@@ -414,7 +580,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr420p(FrameType destType)
         return NULL;
     }
 
-    destBuffer = alloc_aligned_buffer(alloc_size);
+    destBuffer = AllocFrameBuffer(alloc_size);
     if (!destBuffer) {
         return NULL;
     }
@@ -496,7 +662,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr420p(FrameType destType)
 
     if (0 == status && destSample) {
         CGstVideoFrame *newFrame = new CGstVideoFrame();
-        bool result = newFrame->Init(destSample) && newFrame->IsValid();
+        bool result = newFrame->Init(destSample, m_pPool) && newFrame->IsValid();
         // INLINE - gst_sample_unref()
         gst_buffer_unref(destBuffer); // else we'll have a massive memory leak!
         // INLINE - gst_sample_unref()
@@ -511,6 +677,126 @@ CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr420p(FrameType destType)
     return NULL;
 }
 
+// Reduces rows of little endian 10 bit samples to 8 bits
+static void downshift_plane_10(guint8 *dst, guint dstStride,
+                               const guint8 *src, guint srcStride,
+                               guint width, guint height)
+{
+    for (guint y = 0; y < height; y++) {
+        const guint8 *srcRow = src + (gsize)y * srcStride;
+        guint8 *dstRow = dst + (gsize)y * dstStride;
+
+        for (guint x = 0; x < width; x++) {
+            guint sample = srcRow[2*x] | (srcRow[2*x + 1] << 8);
+            dstRow[x] = (guint8)MIN(sample >> 2, 255);
+        }
+    }
+}
+
+CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr420p10(FrameType destType)
+{
+    // Converting 10 bit frames is the fallback for renderers that cannot
+    // sample them directly, so reuse the 8 bit converters through a
+    // temporary YV12 frame rather than duplicating them for 16 bit samples.
+    GstSample *tmpSample = NULL;
+    GstBuffer *tmpBuffer = NULL;
+    GstCaps *tmpCaps = NULL;
+    GstMapInfo info;
+    guint chromaWidth = m_uiEncodedWidth / 2;
+    guint chromaHeight = m_uiEncodedHeight / 2;
+    guint lumaStride, chromaStride;
+    guint lumaSize, chromaSize, alloc_size;
+
+    if (m_uiEncodedWidth > (G_MAXUINT - 15) || m_uiEncodedHeight == 0) {
+        return NULL;
+    }
+    lumaStride = (m_uiEncodedWidth + 15) & ~15;
+    chromaStride = (chromaWidth + 15) & ~15;
+
+    // Source rows have to hold the samples we read
+    if (m_puiPlaneStrides[0] / 2 < m_uiEncodedWidth ||
+        m_puiPlaneStrides[1] / 2 < chromaWidth ||
+        m_puiPlaneStrides[2] / 2 < chromaWidth) {
+        return NULL;
+    }
+
+    if (lumaStride > (G_MAXUINT / m_uiEncodedHeight)) {
+        return NULL;
+    }
+    lumaSize = lumaStride * m_uiEncodedHeight;
+    chromaSize = chromaStride * chromaHeight; // can't overflow if luma doesn't
+    if (chromaSize > ((G_MAXUINT - lumaSize) / 2)) {
+        return NULL;
+    }
+    alloc_size = lumaSize + 2 * chromaSize;
+
+    tmpBuffer = AllocFrameBuffer(alloc_size);
+    if (!tmpBuffer) {
+        return NULL;
+    }
+
+    GST_BUFFER_TIMESTAMP(tmpBuffer) = GST_BUFFER_TIMESTAMP(m_pBuffer);
+    GST_BUFFER_OFFSET(tmpBuffer) = GST_BUFFER_OFFSET(m_pBuffer);
+    GST_BUFFER_DURATION(tmpBuffer) = GST_BUFFER_DURATION(m_pBuffer);
+
+    if (!gst_buffer_map(tmpBuffer, &info, GST_MAP_WRITE)) {
+        // INLINE - gst_buffer_unref()
+        gst_buffer_unref(tmpBuffer);
+        return NULL;
+    }
+
+    // Planes keep their YV12 order: luma, Cr, Cb
+    downshift_plane_10(info.data, lumaStride,
+                       (const guint8*)m_pvPlaneData[0], m_puiPlaneStrides[0],
+                       m_uiEncodedWidth, m_uiEncodedHeight);
+    downshift_plane_10(info.data + lumaSize, chromaStride,
+                       (const guint8*)m_pvPlaneData[1], m_puiPlaneStrides[1],
+                       chromaWidth, chromaHeight);
+    downshift_plane_10(info.data + lumaSize + chromaSize, chromaStride,
+                       (const guint8*)m_pvPlaneData[2], m_puiPlaneStrides[2],
+                       chromaWidth, chromaHeight);
+
+    gst_buffer_unmap(tmpBuffer, &info);
+
+    tmpCaps = gst_caps_new_simple("video/x-raw-yuv",
+                                  "format", G_TYPE_STRING, "YV12",
+                                  "width", G_TYPE_INT, m_uiWidth,
+                                  "height", G_TYPE_INT, m_uiHeight,
+                                  "encoded-width", G_TYPE_INT, m_uiEncodedWidth,
+                                  "encoded-height", G_TYPE_INT, m_uiEncodedHeight,
+                                  "stride-y", G_TYPE_INT, lumaStride,
+                                  "stride-v", G_TYPE_INT, chromaStride,
+                                  "stride-u", G_TYPE_INT, chromaStride,
+                                  "offset-y", G_TYPE_INT, 0,
+                                  "offset-v", G_TYPE_INT, lumaSize,
+                                  "offset-u", G_TYPE_INT, lumaSize + chromaSize,
+                                  NULL);
+    if (!tmpCaps) {
+        // INLINE - gst_buffer_unref()
+        gst_buffer_unref(tmpBuffer);
+        return NULL;
+    }
+
+    tmpSample = gst_sample_new(tmpBuffer, tmpCaps, NULL, NULL);
+    gst_caps_unref(tmpCaps);
+    // INLINE - gst_buffer_unref()
+    gst_buffer_unref(tmpBuffer);
+    if (!tmpSample) {
+        return NULL;
+    }
+
+    CGstVideoFrame *newFrame = NULL;
+    CGstVideoFrame *tmpFrame = new CGstVideoFrame();
+    if (tmpFrame->Init(tmpSample, m_pPool) && tmpFrame->IsValid()) {
+        newFrame = tmpFrame->ConvertFromYCbCr420p(destType);
+    }
+    delete tmpFrame;
+    // INLINE - gst_sample_unref()
+    gst_sample_unref(tmpSample);
+
+    return newFrame;
+}
+
 CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr422(FrameType destType)
 {
     GstSample *destSample;
@@ -545,7 +831,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr422(FrameType destType)
         return NULL;
     }
 
-    destBuffer = alloc_aligned_buffer(alloc_size);
+    destBuffer = AllocFrameBuffer(alloc_size);
     if (!destBuffer) {
         return NULL;
     }
@@ -599,7 +885,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr422(FrameType destType)
 
     if (0 == status && destBuffer) {
         CGstVideoFrame *newFrame = new CGstVideoFrame();
-        bool result = newFrame->Init(destSample) && newFrame->IsValid();
+        bool result = newFrame->Init(destSample, m_pPool) && newFrame->IsValid();
         // INLINE - gst_buffer_unref()
         gst_buffer_unref(destBuffer); // else we'll have a massive memory leak!
         // INLINE - gst_sample_unref()
@@ -621,12 +907,11 @@ CGstVideoFrame *CGstVideoFrame::ConvertSwapRGB(FrameType destType)
     GstCaps *srcCaps, *dstCaps;
     GstMapInfo srcInfo, destInfo;
     GstStructure* str;
-    guint xx, yy, size;
-    guint32 *srcData, *dstData;
+    guint size;
 
     size = gst_buffer_get_size(m_pBuffer);
 
-    destBuffer = alloc_aligned_buffer(size);
+    destBuffer = AllocFrameBuffer(size);
     if (!destBuffer) {
         return NULL;
     }
@@ -691,21 +976,13 @@ CGstVideoFrame *CGstVideoFrame::ConvertSwapRGB(FrameType destType)
     }
 
     // Now copy data from src to dest, byteswapping as we copy
-    srcData = (guint32*)srcInfo.data;
-    dstData = (guint32*)destInfo.data;
     if (!(m_puiPlaneStrides[0] & 3)) {
-        // four byte alignment on the entire buffer, we can just loop once
-        for (xx = 0; xx < size; xx += 4) {
-            *dstData++ = swap_uint32(*srcData++); // NOTE: SSE could be used here instead
-        }
+        // four byte alignment on the entire buffer, we can swap it as one row
+        ColorConvert_SwapBytes32(destInfo.data, 0, srcInfo.data, 0, size / 4, 1);
     } else {
-        for (yy = 0; yy < m_uiHeight; yy++) {
-            for (xx = 0; xx < m_uiWidth; xx++) {
-                dstData[xx] = swap_uint32(srcData[xx]); // NOTE: SSE could be used here instead
-            }
-            dstData += m_puiPlaneStrides[0];
-            srcData += m_puiPlaneStrides[0];
-        }
+        ColorConvert_SwapBytes32(destInfo.data, m_puiPlaneStrides[0],
+                                 srcInfo.data, m_puiPlaneStrides[0],
+                                 m_uiWidth, m_uiHeight);
     }
 
     gst_buffer_unmap(m_pBuffer, &srcInfo);
@@ -713,7 +990,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertSwapRGB(FrameType destType)
 
     if (destBuffer) {
         CGstVideoFrame *newFrame = new CGstVideoFrame();
-        bool result = newFrame->Init(destSample) && newFrame->IsValid();
+        bool result = newFrame->Init(destSample, m_pPool) && newFrame->IsValid();
         // INLINE - gst_buffer_unref()
         gst_buffer_unref(destBuffer); // else we'll have a massive memory leak!
         // INLINE - gst_sample_unref()
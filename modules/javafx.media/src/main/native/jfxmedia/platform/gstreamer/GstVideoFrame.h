@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,47 @@
 
 #define FOURCC_I420 "I420"
 #define FOURCC_UYVY "UYVY"
+// YV12 plane order with 10 bit samples in 16 bit little endian words
+#define FOURCC_YV12_10LE "YV12_10LE"
+
+// Most free buffers a frame buffer pool keeps, whatever the frames in flight
+#define FRAME_BUFFER_POOL_MAX_FREE 8
+
+class CGstPipelineMetrics;
+
+/**
+ * class CGstFrameBufferPool
+ *
+ * Pool of the aligned destination buffers of frame conversions. A buffer goes
+ * back to the pool when the last converted frame holding it is disposed. Only
+ * buffers of the size last asked for are kept, so a change of the frame caps
+ * drops the old ones, and no more are kept than were in flight at one time.
+ */
+class CGstFrameBufferPool
+{
+public:
+    static CGstFrameBufferPool* Create();
+    static CGstFrameBufferPool* AddRef(CGstFrameBufferPool* pool);
+    static void                 ReleaseRef(CGstFrameBufferPool* pool);
+
+    GstBuffer* AllocBuffer(guint size);
+
+private:
+    CGstFrameBufferPool();
+    ~CGstFrameBufferPool();
+
+    static void FreeBlock(gpointer block);
+    void        RecycleBlock(gpointer block);
+    void        ClearFreeBlocks();
+
+    volatile int m_RefCounter;
+    GMutex       m_Mutex;
+    guint        m_uiBlockSize;     // size of the buffers now in use
+    gpointer     m_pFreeBlocks;
+    guint        m_uiFreeCount;
+    guint        m_uiInFlight;      // buffers handed out and not returned yet
+    guint        m_uiMaxInFlight;
+};
 
 /**
  * class CGstVideoFrame
@@ -46,9 +87,10 @@ public:
 
     /*
      * Initialize a VideoFrame that wraps the given GstBuffer. The frame caps are
-     * extracted from the buffer itself.
+     * extracted from the buffer itself. Conversions of the frame take their
+     * buffers from pPool when one is given and record their time in pMetrics.
      */
-    bool Init(GstSample* sample);
+    bool Init(GstSample* sample, CGstFrameBufferPool* pPool = NULL, CGstPipelineMetrics* pMetrics = NULL);
 
     virtual void Dispose();
 
@@ -69,9 +111,13 @@ private:
     void*       m_pvBufferBaseAddress;
     unsigned long m_ulBufferSize;
     bool        m_bIsI420;
+    CGstFrameBufferPool* m_pPool;   // destination buffers of conversions, may be NULL
+    CGstPipelineMetrics* m_pMetrics; // conversion times, may be NULL
 
+    GstBuffer *AllocFrameBuffer(guint size);
     CGstVideoFrame *ConvertSwapRGB(FrameType destType);
     CGstVideoFrame *ConvertFromYCbCr420p(FrameType destType);
+    CGstVideoFrame *ConvertFromYCbCr420p10(FrameType destType);
     CGstVideoFrame *ConvertFromYCbCr422(FrameType destType);
 };
 #endif  //_GST_VIDEO_FRAME_H_
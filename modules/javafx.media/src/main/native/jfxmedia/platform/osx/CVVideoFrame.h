@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,6 +39,8 @@ public:
 
     virtual CVideoFrame *ConvertToFormat(FrameType type);
 
+    virtual void *GetNativeSurface();
+
 private:
     bool m_bDisposePixelBuffer;
     CVPixelBufferRef m_pixelBuffer;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -178,6 +178,15 @@ void CVVideoFrame::Dispose()
     }
 }
 
+void *CVVideoFrame::GetNativeSurface()
+{
+    // Only the packed formats can be bound as a single texture
+    if (m_pixelBuffer == NULL || (m_typeFrame != BGRA_PRE && m_typeFrame != YCbCr_422)) {
+        return NULL;
+    }
+    return CVPixelBufferGetIOSurface(m_pixelBuffer);
+}
+
 CVideoFrame *CVVideoFrame::ConvertToFormat(FrameType type)
 {
     if (YCbCr_422 == m_typeFrame && BGRA_PRE == type) {
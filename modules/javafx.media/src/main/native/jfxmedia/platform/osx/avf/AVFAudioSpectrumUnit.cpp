@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,9 @@ AVFAudioSpectrumUnit::AVFAudioSpectrumUnit() : mSpectrumCallbackProc(NULL),
                                                mUpdateInterval(kDefaultAudioSpectrumUpdateInterval),
                                                mThreshold(kDefaultAudioSpectrumThreshold),
                                                mMixBufferFrameCapacity(0),
+                                               mMagnitudes(NULL),
+                                               mPhases(NULL),
+                                               mBandsCapacity(0),
                                                mSampleRate(0),
                                                mChannels(0),
                                                mMaxFrames(0),
@@ -57,6 +60,9 @@ AVFAudioSpectrumUnit::~AVFAudioSpectrumUnit() {
         mMixBuffer.mBuffers[0].mData = NULL;
     }
 
+    free(mMagnitudes);
+    free(mPhases);
+
     ReleaseSpectralProcessor();
 }
 
@@ -186,7 +192,7 @@ void AVFAudioSpectrumUnit::UpdateBands(int size, const float* magnitudes, const
     }
 
     // Update band data
-    mBands->UpdateBands(size, magnitudes, magnitudes);
+    mBands->UpdateBands(size, magnitudes, phases);
 
     // Call our listener to dispatch the spectrum event
     if (mSpectrumCallbackProc) {
@@ -200,6 +206,42 @@ void AVFAudioSpectrumUnit::UpdateBands(int size, const float* magnitudes, const
     unlockBands();
 }
 
+void AVFAudioSpectrumUnit::UpdateBands(const GstStructure* pStructure) {
+    const GValue *magnitudes_value = gst_structure_get_value(pStructure, "magnitude");
+    const GValue *phases_value = gst_structure_get_value(pStructure, "phase");
+    if (magnitudes_value == NULL || phases_value == NULL) {
+        return;
+    }
+
+    UInt32 bands = gst_value_list_get_size(magnitudes_value);
+    if (bands == 0 || gst_value_list_get_size(phases_value) != bands) {
+        return;
+    }
+
+    if (bands > mBandsCapacity) {
+        float *magnitudes = (float*) malloc(bands * sizeof(float));
+        float *phases = (float*) malloc(bands * sizeof(float));
+        if (!magnitudes || !phases) {
+            free(magnitudes);
+            free(phases);
+            return;
+        }
+
+        free(mMagnitudes);
+        free(mPhases);
+        mMagnitudes = magnitudes;
+        mPhases = phases;
+        mBandsCapacity = bands;
+    }
+
+    for (UInt32 i = 0; i < bands; i++) {
+        mMagnitudes[i] = g_value_get_float(gst_value_list_get_value(magnitudes_value, i));
+        mPhases[i] = g_value_get_float(gst_value_list_get_value(phases_value, i));
+    }
+
+    UpdateBands((int) bands, mMagnitudes, mPhases);
+}
+
 void AVFAudioSpectrumUnit::SetSampleRate(UInt32 rate) {
     mSampleRate = rate;
 }
@@ -231,31 +273,7 @@ static gboolean PostMessageCallback(GstElement * element, GstMessage * message)
 
     const GstStructure *pStr = gst_message_get_structure(message);
     if (gst_structure_has_name(pStr, "spectrum")) {
-        GstClockTime timestamp, duration;
-
-        if (!gst_structure_get_clock_time(pStr, "timestamp", &timestamp))
-            timestamp = GST_CLOCK_TIME_NONE;
-
-        if (!gst_structure_get_clock_time(pStr, "duration", &duration))
-            duration = GST_CLOCK_TIME_NONE;
-
-        size_t bandsNum = pSpectrumUnit->GetBands();
-
-        if (bandsNum > 0) {
-            float *magnitudes = new float[bandsNum];
-            float *phases = new float[bandsNum];
-
-            const GValue *magnitudes_value = gst_structure_get_value(pStr, "magnitude");
-            const GValue *phases_value = gst_structure_get_value(pStr, "phase");
-            for (int i = 0; i < bandsNum; i++) {
-                magnitudes[i] = g_value_get_float(gst_value_list_get_value(magnitudes_value, i));
-                phases[i] = g_value_get_float(gst_value_list_get_value(phases_value, i));
-            }
-            pSpectrumUnit->UpdateBands((int) bandsNum, magnitudes, phases);
-
-            delete [] magnitudes;
-            delete [] phases;
-        }
+        pSpectrumUnit->UpdateBands(pStr);
     }
 
     gst_message_unref(message);
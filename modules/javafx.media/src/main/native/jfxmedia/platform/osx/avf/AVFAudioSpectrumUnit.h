@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -76,6 +76,8 @@ public:
     virtual void SetThreshold(int threshold);
 
     virtual void UpdateBands(int size, const float* magnitudes, const float* phases);
+    // Updates bands from the "spectrum" element message
+    void UpdateBands(const GstStructure* pStructure);
 
     void SetSampleRate(UInt32 rate);
     void SetChannels(UInt32 count);
@@ -96,6 +98,11 @@ private:
     AudioBufferList mMixBuffer;
     int mMixBufferFrameCapacity;    // number of frames that can currently be stored in mix buffer
 
+    // Band data reused between updates, so the audio thread does not allocate
+    float *mMagnitudes;
+    float *mPhases;
+    UInt32 mBandsCapacity;
+
     // Audio parameters
     UInt32 mSampleRate;
     UInt32 mChannels;
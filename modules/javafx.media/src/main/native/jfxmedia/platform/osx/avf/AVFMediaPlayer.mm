@@ -58,9 +58,12 @@ static void *AVFMediaPlayerItemTracksContext = &AVFMediaPlayerItemTracksContext;
 // is in the list of prefered formats.
 // Uncomment to force list of supported formats by JavaFX.
 // Note: This array should match CVVideoFrame::IsFormatSupported().
+// The frames are backed by IOSurfaces so the ES2 pipeline can copy them to
+// textures on the GPU, see CVVideoFrame::GetNativeSurface().
 #define VO_FORMATS @{(id)kCVPixelBufferPixelFormatTypeKey: @[@(kCVPixelFormatType_422YpCbCr8),\
                                                            @(kCVPixelFormatType_420YpCbCr8Planar),\
-                                                           @(kCVPixelFormatType_32BGRA)]}
+                                                           @(kCVPixelFormatType_32BGRA)],\
+                     (id)kCVPixelBufferIOSurfacePropertiesKey: @{}}
 // Uncomment to let AVFoundation decide the format...
 //#define VO_FORMATS @{}
 
@@ -253,7 +256,8 @@ static CVReturn displayLinkCallback(CVDisplayLinkRef displayLink,
         LOGGER_DEBUGMSG(([[NSString stringWithFormat:@"Falling back on video format: %@", FourCCToNSString(FALLBACK_VO_FORMAT)] UTF8String]));
         AVPlayerItemVideoOutput *newOutput =
         [[AVPlayerItemVideoOutput alloc] initWithPixelBufferAttributes:
-         @{(id)kCVPixelBufferPixelFormatTypeKey: @(FALLBACK_VO_FORMAT)}];
+         @{(id)kCVPixelBufferPixelFormatTypeKey: @(FALLBACK_VO_FORMAT),
+           (id)kCVPixelBufferIOSurfacePropertiesKey: @{}}];
 
         if (newOutput) {
             newOutput.suppressesPlayerRendering = YES;
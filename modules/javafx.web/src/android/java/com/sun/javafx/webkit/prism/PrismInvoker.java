@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -74,6 +74,14 @@ public final class PrismInvoker extends Invoker {
         PlatformImpl.runLater(r);
     }
 
+    @Override public void enterNestedEventLoop(Object key) {
+        Toolkit.getToolkit().enterNestedEventLoop(key);
+    }
+
+    @Override public void exitNestedEventLoop(Object key) {
+        Toolkit.getToolkit().exitNestedEventLoop(key, null);
+    }
+
     static void invokeOnRenderThread(final Runnable r) {
         Toolkit.getToolkit().addRenderJob(new RenderJob(r));
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,8 @@ import java.security.PrivilegedAction;
 
 import com.sun.javafx.scene.traversal.Direction;
 import com.sun.javafx.scene.traversal.TraversalMethod;
+import javafx.beans.InvalidationListener;
+import javafx.beans.WeakInvalidationListener;
 import javafx.geometry.Point2D;
 import javafx.geometry.Rectangle2D;
 import javafx.scene.Cursor;
@@ -43,6 +45,7 @@ import javafx.stage.Window;
 
 import com.sun.javafx.util.Utils;
 import com.sun.webkit.CursorManager;
+import com.sun.webkit.WebPage;
 import com.sun.webkit.WebPageClient;
 import com.sun.webkit.graphics.WCGraphicsManager;
 import com.sun.webkit.graphics.WCPageBackBuffer;
@@ -57,6 +60,21 @@ public final class WebPageClientImpl implements WebPageClient<WebView> {
     private static WebConsoleListener consoleListener = null;
     private final Accessor accessor;
 
+    // WebKit caches the screen properties of a page, so tell it when the
+    // screens change, the window of the view moves, or the view is put
+    // into another scene or window
+    private static final InvalidationListener screenListener = o -> WebPage.screenChanged();
+    private static boolean screensTracked = false;
+    private final InvalidationListener containerListener = o -> {
+        trackScreen(accessor.getView());
+        WebPage.screenChanged();
+    };
+    private final WeakInvalidationListener weakContainerListener =
+            new WeakInvalidationListener(containerListener);
+    private WeakReference<WebView> trackedView;
+    private WeakReference<Scene> trackedScene;
+    private WeakReference<Window> trackedWindow;
+
     static void setConsoleListener(WebConsoleListener consoleListener) {
         WebPageClientImpl.consoleListener = consoleListener;
     }
@@ -115,8 +133,50 @@ public final class WebPageClientImpl implements WebPageClient<WebView> {
         NodeHelper.traverse(accessor.getView(), forward ? Direction.NEXT : Direction.PREVIOUS, TraversalMethod.DEFAULT);
     }
 
+    private void trackScreen(WebView view) {
+        if (!screensTracked) {
+            Screen.getScreens().addListener(screenListener);
+            screensTracked = true;
+        }
+        WebView oldView = trackedView != null ? trackedView.get() : null;
+        if (view != oldView) {
+            if (oldView != null) {
+                oldView.sceneProperty().removeListener(weakContainerListener);
+            }
+            if (view != null) {
+                view.sceneProperty().addListener(weakContainerListener);
+            }
+            trackedView = view != null ? new WeakReference<>(view) : null;
+        }
+        Scene scene = view != null ? view.getScene() : null;
+        Scene oldScene = trackedScene != null ? trackedScene.get() : null;
+        if (scene != oldScene) {
+            if (oldScene != null) {
+                oldScene.windowProperty().removeListener(weakContainerListener);
+            }
+            if (scene != null) {
+                scene.windowProperty().addListener(weakContainerListener);
+            }
+            trackedScene = scene != null ? new WeakReference<>(scene) : null;
+        }
+        Window window = scene != null ? scene.getWindow() : null;
+        Window tracked = trackedWindow != null ? trackedWindow.get() : null;
+        if (window != tracked) {
+            if (tracked != null) {
+                tracked.xProperty().removeListener(screenListener);
+                tracked.yProperty().removeListener(screenListener);
+            }
+            if (window != null) {
+                window.xProperty().addListener(screenListener);
+                window.yProperty().addListener(screenListener);
+            }
+            trackedWindow = window != null ? new WeakReference<>(window) : null;
+        }
+    }
+
     @Override public WCRectangle getScreenBounds(boolean available) {
         WebView view = accessor.getView();
+        trackScreen(view);
 
         Screen screen = Utils.getScreen(view);
         if (screen != null) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,9 @@ import com.sun.glass.ui.Screen;
 import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.media.jfxmedia.MediaManager;
 import com.sun.prism.Graphics;
+import com.sun.prism.GraphicsPipeline;
+import com.sun.prism.Image;
+import com.sun.prism.ResourceFactory;
 import com.sun.webkit.perf.WCFontPerfLogger;
 import com.sun.webkit.perf.WCGraphicsPerfLogger;
 import com.sun.webkit.graphics.*;
@@ -79,6 +82,25 @@ public final class PrismGraphicsManager extends WCGraphicsManager {
         return rq;
     }
 
+    @Override
+    public ByteBuffer renderToPixels(WCRenderQueue rq, int x, int y,
+                                     float scale, int w, int h)
+    {
+        RTImage image = new RTImage(w, h, highestPixelScale);
+        WCGraphicsContext g = new WCBufferedContext(image);
+        try {
+            PrismInvoker.runOnRenderThread(() -> {
+                g.scale(scale, scale);
+                g.translate(-x, -y);
+                rq.decode(g);
+                g.flush();
+            });
+            return image.getPixelBuffer();
+        } finally {
+            image.dispose();
+        }
+    }
+
     @Override protected WCFont getWCFont(String name, boolean bold, boolean italic, float size)
     {
         WCFont f = WCFontImpl.getFont(name, bold, italic, size);
@@ -112,6 +134,12 @@ public final class PrismGraphicsManager extends WCGraphicsManager {
         return new WCPathImpl((WCPathImpl)path);
     }
 
+    @Override
+    protected WCPath createWCPath(byte[] types, int numTypes,
+                                  float[] coords, int numCoords) {
+        return new WCPathImpl(types, numTypes, coords, numCoords);
+    }
+
     @Override
     protected WCImage createWCImage(int w, int h) {
         return new WCImageImpl(w, h);
@@ -122,6 +150,16 @@ public final class PrismGraphicsManager extends WCGraphicsManager {
         return new RTImage(w, h, highestPixelScale);
     }
 
+    @Override
+    protected int getMaximumTextureSize() {
+        ResourceFactory f = GraphicsPipeline.getDefaultResourceFactory();
+        if (f == null || f.isDisposed()) {
+            return 0;
+        }
+        // RTImage allocates its texture at the highest pixel scale
+        return (int) (f.getMaximumTextureSize() / highestPixelScale);
+    }
+
     @Override public WCImage getIconImage(String iconURL) {
         return null;
     }
@@ -143,6 +181,14 @@ public final class PrismGraphicsManager extends WCGraphicsManager {
         };
     }
 
+    @Override
+    protected byte[] encodePixels(int w, int h, ByteBuffer data,
+                                  String mimeType, double quality)
+    {
+        return PrismImage.encode(Image.fromByteBgraPreData(data, w, h),
+                                 mimeType, quality);
+    }
+
     @Override
     protected WCTransform createTransform(double m00, double m10, double m01,
             double m11, double m02, double m12)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,7 +36,9 @@ import java.util.Base64;
 import java.util.Iterator;
 import javafx.scene.image.PixelFormat;
 import javafx.scene.image.WritablePixelFormat;
+import javax.imageio.IIOImage;
 import javax.imageio.ImageIO;
+import javax.imageio.ImageWriteParam;
 import javax.imageio.ImageWriter;
 
 import com.sun.prism.Graphics;
@@ -68,8 +70,22 @@ abstract class PrismImage extends WCImage {
     }
 
     @Override
-    protected final byte[] toData(String mimeType) {
-        final BufferedImage image = toBufferedImage(mimeType.equals("image/jpeg"));
+    protected final byte[] toData(String mimeType, double quality) {
+        return encode(toBufferedImage(mimeType.equals("image/jpeg")),
+                      mimeType, quality);
+    }
+
+    static byte[] encode(Image img, String mimeType, double quality) {
+        BufferedImage image = null;
+        try {
+            image = fromFXImage(img, mimeType.equals("image/jpeg"));
+        } catch (Exception ex) {
+            ex.printStackTrace(System.err);
+        }
+        return encode(image, mimeType, quality);
+    }
+
+    private static byte[] encode(BufferedImage image, String mimeType, double quality) {
         if (image != null) {
             Iterator<ImageWriter> it = ImageIO.getImageWritersByMIMEType(mimeType);
             while (it.hasNext()) {
@@ -77,7 +93,18 @@ abstract class PrismImage extends WCImage {
                 ImageWriter writer = it.next();
                 try {
                     writer.setOutput(ImageIO.createImageOutputStream(output));
-                    writer.write(image);
+                    ImageWriteParam param = writer.getDefaultWriteParam();
+                    // the quality only applies to the lossy formats
+                    if (quality >= 0 && quality <= 1 && param.canWriteCompressed()
+                            && !mimeType.equals("image/png")) {
+                        param.setCompressionMode(ImageWriteParam.MODE_EXPLICIT);
+                        String[] types = param.getCompressionTypes();
+                        if (types != null && param.getCompressionType() == null) {
+                            param.setCompressionType(types[0]);
+                        }
+                        param.setCompressionQuality((float) quality);
+                    }
+                    writer.write(null, new IIOImage(image, null, null), param);
                 }
                 catch (IOException exception) {
                     continue; // try next image writer
@@ -93,7 +120,7 @@ abstract class PrismImage extends WCImage {
 
     @Override
     protected final String toDataURL(String mimeType) {
-        final byte[] data = toData(mimeType);
+        final byte[] data = toData(mimeType, -1);
         if (data != null) {
             StringBuilder sb = new StringBuilder();
             sb.append("data:").append(mimeType).append(";base64,");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -53,6 +53,21 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
     private ByteBuffer pixelBuffer;
     private float pixelScale;
 
+    // The pixel buffer and the last region read by getPixelBuffer(x, y, w, h)
+    // are valid until something more is drawn into the image, that is until
+    // its render queue is decoded again.
+    private boolean pixelBufferValid;
+    private int pixelBufferDecodeCount;
+    private ByteBuffer regionBuffer;
+    private ByteBuffer regionCopyBuffer;
+    private boolean regionValid;
+    private int regionX, regionY, regionW, regionH;
+    private int regionDecodeCount;
+    // The image returned by getImage(). It wraps the pixel buffer and is
+    // replaced whenever the pixel buffer changes, so that the textures
+    // Prism caches for it are uploaded again only then.
+    private Image pixelImage;
+
     private final static PlatformLogger log =
             PlatformLogger.getLogger(RTImage.class.getName());
 
@@ -83,9 +98,13 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
 
     @Override
     Image getImage() {
-         return Image.fromByteBgraPreData(
-                getPixelBuffer(),
-                getWidth(), getHeight());
+        ByteBuffer buffer = getPixelBuffer();
+        if (pixelImage == null) {
+            pixelImage = Image.fromByteBgraPreData(
+                    buffer,
+                    getWidth(), getHeight());
+        }
+        return pixelImage;
     }
 
     @Override
@@ -99,7 +118,7 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
         return g;
     }
 
-    private RTTexture getTexture() {
+    RTTexture getTexture() {
         if (txt != null && txt.isSurfaceLost()) {
             log.fine("RTImage::getTexture : surface lost: " + this);
         }
@@ -169,6 +188,25 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
         }
     }
 
+    /**
+     * Draws the source rect of the image to the destination rect straight
+     * from the texture. Returns false when there is no texture to draw from.
+     */
+    boolean drawTexture(Graphics g,
+            float dstx1, float dsty1, float dstx2, float dsty2,
+            float srcx1, float srcy1, float srcx2, float srcy2)
+    {
+        if (txt == null || g instanceof PrinterGraphics
+                || g.getResourceFactory().isDisposed()) {
+            return false;
+        }
+        g.drawTexture(txt,
+                dstx1, dsty1, dstx2, dsty2,
+                srcx1 * pixelScale, srcy1 * pixelScale,
+                srcx2 * pixelScale, srcy2 * pixelScale);
+        return true;
+    }
+
     @Override
     void dispose() {
         PrismInvoker.invokeOnRenderThread(() -> {
@@ -199,7 +237,7 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
                 isNew = true;
             }
         }
-        if (isNew || isDirty()) {
+        if (isNew || !isUpToDate(pixelBufferValid, pixelBufferDecodeCount)) {
             PrismInvoker.runOnRenderThread(() -> {
                 final ResourceFactory f = GraphicsPipeline.getDefaultResourceFactory();
                 if (f == null || f.isDisposed()) {
@@ -225,6 +263,7 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
                     }
 
                     pixelBuffer.rewind();
+                    pixelImage = null;
                     int[] pixels = t.getPixels();
                     if (pixels != null) {
                         pixelBuffer.asIntBuffer().put(pixels);
@@ -236,15 +275,133 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
                         t.dispose();
                     }
                 }
+                if (pixelBuffer != null) {
+                    pixelBufferValid = true;
+                    pixelBufferDecodeCount = getRQDecodeCount();
+                }
             });
         }
         return pixelBuffer;
     }
 
-    // This method is called from native [ImageBufferData::update]
-    // while lazy painting procedure
+    private boolean isUpToDate(boolean valid, int decodeCount) {
+        return valid && !isDirty() && decodeCount == getRQDecodeCount();
+    }
+
+    @Override
+    public ByteBuffer getPixelBuffer(int x, int y, int w, int h) {
+        if (x < 0 || y < 0 || w <= 0 || h <= 0 || x > width - w || y > height - h) {
+            return null;
+        }
+        if (w == width && h == height) {
+            return getPixelBuffer();
+        }
+        if (pixelBuffer != null && isUpToDate(pixelBufferValid, pixelBufferDecodeCount)) {
+            return copyRegion(pixelBuffer, 0, 0, width, x, y, w, h);
+        }
+        if (isUpToDate(regionValid, regionDecodeCount)
+                && x >= regionX && y >= regionY
+                && x + w <= regionX + regionW && y + h <= regionY + regionH)
+        {
+            if (x == regionX && y == regionY && w == regionW && h == regionH) {
+                regionBuffer.rewind();
+                return regionBuffer;
+            }
+            return copyRegion(regionBuffer, regionX, regionY, regionW, x, y, w, h);
+        }
+
+        if (regionBuffer == null || regionBuffer.capacity() < w * h * 4) {
+            regionBuffer = ByteBuffer.allocateDirect(w * h * 4);
+            regionBuffer.order(ByteOrder.nativeOrder());
+        }
+        regionValid = false;
+        PrismInvoker.runOnRenderThread(() -> {
+            final ResourceFactory f = GraphicsPipeline.getDefaultResourceFactory();
+            if (f == null || f.isDisposed()) {
+                log.fine("RTImage::getPixelBuffer : skip because device disposed or not ready");
+                return;
+            }
+            flushRQ();
+            boolean read;
+            if (txt == null) {
+                // nothing was drawn yet
+                regionBuffer.clear();
+                for (int i = 0; i < w * h; i++) {
+                    regionBuffer.putInt(0);
+                }
+                read = true;
+            } else {
+                PixelFormat pf = txt.getPixelFormat();
+                if (pf != PixelFormat.INT_ARGB_PRE &&
+                    pf != PixelFormat.BYTE_BGRA_PRE) {
+
+                    throw new AssertionError("Unexpected pixel format: " + pf);
+                }
+
+                RTTexture t = txt;
+                int tx = t.getContentX() + x;
+                int ty = t.getContentY() + y;
+                if (pixelScale != 1.0f) {
+                    // Convert the region of [txt] to a texture the size of the region
+                    t = f.createRTTexture(w, h, Texture.WrapMode.CLAMP_NOT_NEEDED);
+                    Graphics g = t.createGraphics();
+                    g.drawTexture(txt, 0, 0, w, h,
+                            x * pixelScale, y * pixelScale,
+                            (x + w) * pixelScale, (y + h) * pixelScale);
+                    tx = t.getContentX();
+                    ty = t.getContentY();
+                }
+                regionBuffer.rewind();
+                read = t.readPixels(regionBuffer, tx, ty, w, h);
+                if (t != txt) {
+                    t.dispose();
+                }
+            }
+            if (read) {
+                regionValid = true;
+                regionX = x;
+                regionY = y;
+                regionW = w;
+                regionH = h;
+                regionDecodeCount = getRQDecodeCount();
+            }
+        });
+        if (!regionValid) {
+            return null;
+        }
+        regionBuffer.rewind();
+        return regionBuffer;
+    }
+
+    private ByteBuffer copyRegion(ByteBuffer src, int srcX, int srcY, int srcW,
+                                  int x, int y, int w, int h) {
+        if (regionCopyBuffer == null || regionCopyBuffer.capacity() < w * h * 4) {
+            regionCopyBuffer = ByteBuffer.allocateDirect(w * h * 4);
+            regionCopyBuffer.order(ByteOrder.nativeOrder());
+        }
+        for (int row = 0; row < h; row++) {
+            int srcOffset = ((y - srcY + row) * srcW + x - srcX) * 4;
+            regionCopyBuffer.put(row * w * 4, src, srcOffset, w * 4);
+        }
+        regionCopyBuffer.rewind();
+        return regionCopyBuffer;
+    }
+
     @Override
     protected void drawPixelBuffer() {
+        drawPixelBuffer(0, 0, width, height);
+    }
+
+    // This method is called from native [ImageBufferJavaBackend::update]
+    // while lazy painting procedure
+    @Override
+    protected void drawPixelBuffer(int x, int y, int w, int h) {
+        if (x < 0 || y < 0 || w <= 0 || h <= 0 || x > width - w || y > height - h) {
+            return;
+        }
+        // the pixels were changed through the pixel buffer
+        regionValid = false;
+        pixelImage = null;
         PrismInvoker.invokeOnRenderThread(new Runnable() {
             @Override
             public void run() {
@@ -257,9 +414,21 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
                             pixelBuffer,
                             width,
                             height);
+                    boolean whole = w == width && h == height;
+                    if (!whole) {
+                        img = img.createSubImage(x, y, w, h);
+                    }
                     Texture txt = g.getResourceFactory().createTexture(img, Texture.Usage.DEFAULT, Texture.WrapMode.CLAMP_NOT_NEEDED);
-                    g.clear();
-                    g.drawTexture(txt, 0, 0, width, height);
+                    if (whole) {
+                        g.clear();
+                        g.drawTexture(txt, 0, 0, width, height);
+                    } else {
+                        // replace the pixels of the region only
+                        CompositeMode mode = g.getCompositeMode();
+                        g.setCompositeMode(CompositeMode.SRC);
+                        g.drawTexture(txt, x, y, x + w, y + h, 0, 0, w, h);
+                        g.setCompositeMode(mode);
+                    }
                     txt.dispose();
                 }
             }
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.webkit.prism;
+
+import com.sun.prism.Image;
+import com.sun.prism.paint.Color;
+import com.sun.prism.paint.ImagePattern;
+import com.sun.prism.paint.Stop;
+import com.sun.webkit.graphics.WCGradient;
+import com.sun.webkit.graphics.WCPoint;
+import com.sun.webkit.graphics.WCRectangle;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+
+/**
+ * Prism has no conic paint, so the gradient is rendered into an image that
+ * covers the painted bounds and used as an image pattern. The image is no
+ * larger than MAX_SIZE in either direction and is scaled up beyond that.
+ */
+final class WCConicGradient extends WCGradient<ImagePattern> {
+
+    private static final int MAX_SIZE = 1024;
+
+    private final WCPoint center;
+    private final float angle;
+    private final WCRectangle bounds;
+    private final List<Stop> stops = new ArrayList<>();
+    private ImagePattern platformGradient;
+
+    WCConicGradient(WCPoint center, float angle, WCRectangle bounds) {
+        this.center = center;
+        this.angle = angle;
+        this.bounds = bounds;
+    }
+
+    @Override
+    protected void addStop(Color color, float offset) {
+        this.stops.add(new Stop(color, offset));
+        this.platformGradient = null;
+    }
+
+    @Override
+    public ImagePattern getPlatformGradient() {
+        if (this.platformGradient != null) {
+            return this.platformGradient;
+        }
+        Collections.sort(this.stops, WCRadialGradient.COMPARATOR);
+
+        float bw = Math.max(this.bounds.getWidth(), 1f);
+        float bh = Math.max(this.bounds.getHeight(), 1f);
+        int w = Math.min((int) Math.ceil(bw), MAX_SIZE);
+        int h = Math.min((int) Math.ceil(bh), MAX_SIZE);
+        float sx = bw / w;
+        float sy = bh / h;
+
+        int[] pixels = new int[w * h];
+        double twoPi = 2 * Math.PI;
+        for (int y = 0; y < h; y++) {
+            double dy = this.bounds.getY() + (y + 0.5) * sy - this.center.getY();
+            for (int x = 0; x < w; x++) {
+                double dx = this.bounds.getX() + (x + 0.5) * sx - this.center.getX();
+                // clockwise from the top, as in CSS
+                double t = (Math.atan2(dx, -dy) - this.angle) / twoPi;
+                pixels[y * w + x] = colorAt((float) (t - Math.floor(t)));
+            }
+        }
+
+        Image image = Image.fromIntArgbPreData(pixels, w, h);
+        return this.platformGradient = new ImagePattern(image,
+                this.bounds.getX(), this.bounds.getY(), bw, bh, false, false);
+    }
+
+    private int colorAt(float t) {
+        int n = this.stops.size();
+        if (n == 0) {
+            return 0;
+        }
+        Stop s0 = this.stops.get(0);
+        Stop s1 = s0;
+        for (int i = 1; i < n && s1.getOffset() < t; i++) {
+            s0 = s1;
+            s1 = this.stops.get(i);
+        }
+        Color c0 = s0.getColor();
+        Color c1 = s1.getColor();
+        float span = s1.getOffset() - s0.getOffset();
+        float f = (span > 0f) ? Math.min(Math.max((t - s0.getOffset()) / span, 0f), 1f)
+                              : (t < s1.getOffset() ? 0f : 1f);
+        float a = c0.getAlpha() + (c1.getAlpha() - c0.getAlpha()) * f;
+        float r = c0.getRed() + (c1.getRed() - c0.getRed()) * f;
+        float g = c0.getGreen() + (c1.getGreen() - c0.getGreen()) * f;
+        float b = c0.getBlue() + (c1.getBlue() - c0.getBlue()) * f;
+        return ((int) (a * 255f + 0.5f) << 24)
+                | ((int) (r * a * 255f + 0.5f) << 16)
+                | ((int) (g * a * 255f + 0.5f) << 8)
+                | (int) (b * a * 255f + 0.5f);
+    }
+
+    @Override
+    public String toString() {
+        return "WCConicGradient[center=" + this.center + ", angle=" + this.angle
+                + ", bounds=" + this.bounds + ", stops=" + this.stops.size() + "]";
+    }
+}
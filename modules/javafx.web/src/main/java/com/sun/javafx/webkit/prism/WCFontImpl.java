@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,6 +37,8 @@ import com.sun.javafx.scene.text.TextLayout;
 import com.sun.prism.GraphicsPipeline;
 import com.sun.webkit.graphics.WCFont;
 import com.sun.webkit.graphics.WCTextRun;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.util.Arrays;
 import java.util.HashMap;
 
@@ -109,6 +111,16 @@ final class WCFontImpl extends WCFont {
         return getFontStrike().getFontResource().getAdvance(glyph, font.getSize());
     }
 
+    @Override public float[] getGlyphWidths(int[] glyphs) {
+        FontResource fr = getFontStrike().getFontResource();
+        float size = font.getSize();
+        float[] widths = new float[glyphs.length];
+        for (int i = 0; i < glyphs.length; i++) {
+            widths[i] = fr.getAdvance(glyphs[i], size);
+        }
+        return widths;
+    }
+
     @Override public float[] getGlyphBoundingBox(int glyph) {
         float[] bb = new float[4];
         bb = getFontStrike().getFontResource().getGlyphBoundingBox(glyph, font.getSize(), bb);
@@ -119,9 +131,9 @@ final class WCFontImpl extends WCFont {
         return getFontStrike().getMetrics().getXHeight();
     }
 
-    private static boolean needsTextLayout(final int glyphs[]) {
-        for (int g : glyphs) {
-            if (g == 0) {
+    private static boolean needsTextLayout(final int glyphs[], int count) {
+        for (int i = 0; i < count; i++) {
+            if (glyphs[i] == 0) {
                 return true;
             }
         }
@@ -130,14 +142,34 @@ final class WCFontImpl extends WCFont {
 
     @Override public int[] getGlyphCodes(char[] chars) {
         int[] glyphs = new int[chars.length];
+        getGlyphCodes(chars, glyphs, chars.length);
+        return glyphs;
+    }
+
+    // Scratch arrays for getGlyphCodes(ByteBuffer, int). Glyph codes are
+    // only requested on the event thread.
+    private static final char[] scratchChars = new char[GLYPH_BUFFER_CHARS];
+    private static final int[] scratchGlyphs = new int[GLYPH_BUFFER_CHARS];
+
+    @Override public void getGlyphCodes(ByteBuffer buffer, int count) {
+        ByteBuffer buf = buffer.order(ByteOrder.nativeOrder());
+        for (int i = 0; i < count; i++) {
+            scratchChars[i] = buf.getChar(i * Character.BYTES);
+        }
+        getGlyphCodes(scratchChars, scratchGlyphs, count);
+        for (int i = 0; i < count; i++) {
+            buf.putInt(GLYPH_BUFFER_GLYPHS_OFFSET + i * Integer.BYTES, scratchGlyphs[i]);
+        }
+    }
+
+    private void getGlyphCodes(char[] chars, int[] glyphs, int count) {
         CharToGlyphMapper mapper = getFontStrike().getFontResource().getGlyphMapper();
-        mapper.charsToGlyphs(chars.length, chars, glyphs);
-        if (needsTextLayout(glyphs)) {
+        mapper.charsToGlyphs(count, chars, glyphs);
+        if (needsTextLayout(glyphs, count)) {
             // Call charsToGlyphs once again after doing layout if any of the glyph index is zero
-            TextUtilities.createLayout(new String(chars), getPlatformFont()).getRuns();
-            mapper.charsToGlyphs(chars.length, chars, glyphs);
+            TextUtilities.createLayout(new String(chars, 0, count), getPlatformFont()).getRuns();
+            mapper.charsToGlyphs(count, chars, glyphs);
         }
-        return glyphs;
     }
 
     @Override
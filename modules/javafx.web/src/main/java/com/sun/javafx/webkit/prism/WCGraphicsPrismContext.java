@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -42,7 +42,6 @@ import com.sun.javafx.sg.prism.*;
 import com.sun.javafx.text.TextRun;
 import com.sun.prism.*;
 import com.sun.prism.paint.Color;
-import com.sun.prism.paint.Gradient;
 import com.sun.prism.paint.ImagePattern;
 import com.sun.prism.paint.Paint;
 import com.sun.scenario.effect.*;
@@ -315,6 +314,9 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
 
     @Override
     public void setClip(WCPath path, boolean isOut) {
+        // The path is transformed and kept with the clip, while the page
+        // may use it again as it is.
+        path = new WCPathImpl((WCPathImpl) path);
         Affine3D tr = new Affine3D(state.getTransformNoClone());
         path.transform(
                 tr.getMxx(), tr.getMyx(),
@@ -555,6 +557,37 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
         }.paint();
     }
 
+    // Only the plain composites paint a batch in one pass as they paint its
+    // rects one after another, the blending ones would blend them together
+    private boolean canPaintBatch() {
+        int op = state.getCompositeOperation();
+        return (op == COMPOSITE_COPY || op == COMPOSITE_SOURCE_OVER)
+                && state.getShadowNoClone() == null;
+    }
+
+    @Override
+    public void fillRects(final float[] rects, final Color color) {
+        if (log.isLoggable(Level.FINE)) {
+            log.fine(String.format("fillRects(%d rects, %s)", rects.length / 4, color));
+        }
+        if (!canPaintBatch() || !state.getPerspectiveTransformNoClone().isIdentity()) {
+            for (int i = 0; i + 3 < rects.length; i += 4) {
+                fillRect(rects[i], rects[i + 1], rects[i + 2], rects[i + 3], color);
+            }
+            return;
+        }
+        new Composite() {
+            @Override void doPaint(Graphics g) {
+                g.setPaint(color);
+                for (int i = 0; i + 3 < rects.length; i += 4) {
+                    if (shouldRenderRect(rects[i], rects[i + 1], rects[i + 2], rects[i + 3], null, null)) {
+                        g.fillRect(rects[i], rects[i + 1], rects[i + 2], rects[i + 3]);
+                    }
+                }
+            }
+        }.paint();
+    }
+
     @Override
     public void fillRoundedRect(final float x, final float y, final float w, final float h,
         final float topLeftW, final float topLeftH, final float topRightW, final float topRightH,
@@ -620,7 +653,7 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
         if (log.isLoggable(Level.FINE)) {
             log.fine("setFillGradient(" + gradient + ")");
         }
-        state.setPaint((Gradient) gradient.getPlatformGradient());
+        state.setPaint((Paint) gradient.getPlatformGradient());
     }
 
     @Override
@@ -670,7 +703,7 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
         if (log.isLoggable(Level.FINE)) {
             log.fine("setStrokeGradient(" + gradient + ")");
         }
-        state.getStrokeNoClone().setPaint((Gradient) gradient.getPlatformGradient());
+        state.getStrokeNoClone().setPaint((Paint) gradient.getPlatformGradient());
     }
 
     @Override
@@ -796,6 +829,11 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
         if (texture != null) {
             new Composite() {
                 @Override void doPaint(Graphics g) {
+                    if (texture instanceof RTImage
+                            && drawPatternTiles(g, (RTImage) texture, srcRect,
+                                                patternTransform, phase, destRect)) {
+                        return;
+                    }
                     Image img = ((PrismImage)texture).getImage();
 
                     // Create subImage only if srcRect doesn't fit the texture bounds. See RT-20193.
@@ -825,6 +863,57 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
         }
     }
 
+    // Up to this many tiles, a canvas pattern is drawn tile by tile from
+    // the canvas texture rather than read back to fill an ImagePattern
+    private static final int MAX_PATTERN_TILES = 256;
+
+    private static boolean drawPatternTiles(Graphics g, RTImage image,
+            WCRectangle srcRect, WCTransform patternTransform, WCPoint phase,
+            WCRectangle destRect)
+    {
+        double m[] = patternTransform.getMatrix();
+        if (m[1] != 0 || m[2] != 0 || m[0] <= 0 || m[3] <= 0) {
+            return false;
+        }
+        // The same tile drawPattern() gives the ImagePattern
+        float sx = 0, sy = 0, sw = image.getWidth(), sh = image.getHeight();
+        if (!srcRect.contains(new WCRectangle(0, 0, sw, sh))) {
+            sx = srcRect.getX();
+            sy = srcRect.getY();
+            sw = srcRect.getWidth();
+            sh = srcRect.getHeight();
+        }
+        double tileX = phase.getX() + m[0] * srcRect.getX() + m[4];
+        double tileY = phase.getY() + m[3] * srcRect.getY() + m[5];
+        double tileW = m[0] * srcRect.getWidth();
+        double tileH = m[3] * srcRect.getHeight();
+        if (sw <= 0 || sh <= 0 || tileW <= 0 || tileH <= 0) {
+            return false;
+        }
+        double x1 = destRect.getX(), y1 = destRect.getY();
+        double x2 = x1 + destRect.getWidth(), y2 = y1 + destRect.getHeight();
+        double firstX = tileX + Math.floor((x1 - tileX) / tileW) * tileW;
+        double firstY = tileY + Math.floor((y1 - tileY) / tileH) * tileH;
+        if (Math.ceil((x2 - firstX) / tileW) * Math.ceil((y2 - firstY) / tileH) > MAX_PATTERN_TILES) {
+            return false;
+        }
+        for (double ty = firstY; ty < y2; ty += tileH) {
+            double dy1 = Math.max(ty, y1), dy2 = Math.min(ty + tileH, y2);
+            for (double tx = firstX; tx < x2; tx += tileW) {
+                double dx1 = Math.max(tx, x1), dx2 = Math.min(tx + tileW, x2);
+                if (!image.drawTexture(g,
+                        (float) dx1, (float) dy1, (float) dx2, (float) dy2,
+                        (float) (sx + (dx1 - tx) / tileW * sw),
+                        (float) (sy + (dy1 - ty) / tileH * sh),
+                        (float) (sx + (dx2 - tx) / tileW * sw),
+                        (float) (sy + (dy2 - ty) / tileH * sh))) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
     @Override
     public void drawImage(final WCImage img,
                           final float dstx, final float dsty, final float dstw, final float dsth,
@@ -864,6 +953,145 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
         }
     }
 
+    @Override
+    public void drawImages(final WCImage img, final float[] rects) {
+        if (log.isLoggable(Level.FINE)) {
+            log.fine(String.format("drawImages(img, %d rects)", rects.length / 8));
+        }
+        if (!canPaintBatch()) {
+            for (int i = 0; i + 7 < rects.length; i += 8) {
+                drawImage(img, rects[i], rects[i + 1], rects[i + 2], rects[i + 3],
+                          rects[i + 4], rects[i + 5], rects[i + 6], rects[i + 7]);
+            }
+            return;
+        }
+        if (img instanceof PrismImage) {
+            new Composite() {
+                @Override void doPaint(Graphics g) {
+                    PrismImage pi = (PrismImage) img;
+                    for (int i = 0; i + 7 < rects.length; i += 8) {
+                        float dstx = rects[i], dsty = rects[i + 1];
+                        float dstw = rects[i + 2], dsth = rects[i + 3];
+                        float srcx = rects[i + 4], srcy = rects[i + 5];
+                        float srcw = rects[i + 6], srch = rects[i + 7];
+                        if (shouldRenderRect(dstx, dsty, dstw, dsth, null, null)) {
+                            pi.draw(g,
+                                    (int) dstx, (int) dsty,
+                                    (int) (dstx + dstw), (int) (dsty + dsth),
+                                    (int) srcx, (int) srcy,
+                                    (int) (srcx + srcw), (int) (srcy + srch));
+                        }
+                    }
+                }
+            }.paint();
+        }
+    }
+
+    @Override
+    public void drawFilteredImage(final WCImage img,
+                                  final float dstx, final float dsty, final float dstw, final float dsth,
+                                  final WCFilterOperation[] filters)
+    {
+        if (log.isLoggable(Level.FINE)) {
+            log.fine("drawFilteredImage(img, dst({0},{1},{2},{3}), {4} filters)",
+                    new Object[] {dstx, dsty, dstw, dsth, filters.length});
+        }
+        if (!(img instanceof PrismImage)) {
+            return;
+        }
+
+        // Opacity commutes with the other filters, so it becomes the alpha of the draw
+        float opacity = 1f;
+        boolean hasEffect = false;
+        for (WCFilterOperation filter : filters) {
+            if (filter.getType() == GraphicsDecoder.FILTER_OPACITY) {
+                opacity *= clamp(filter.getAmount(), 0f, 1f);
+            } else {
+                hasEffect = true;
+            }
+        }
+
+        saveState();
+        setAlpha(getAlpha() * opacity);
+        if (!hasEffect) {
+            drawImage(img, dstx, dsty, dstw, dsth, 0f, 0f, img.getWidth(), img.getHeight());
+        } else if (shouldRenderRect(dstx, dsty, dstw, dsth, null, null)) {
+            new Composite() {
+                @Override void doPaint(Graphics g) {
+                    RTTexture texture = (img instanceof RTImage) ? ((RTImage) img).getTexture() : null;
+                    if (texture != null) {
+                        // Filter the texture in place instead of reading it back.
+                        // The texture is drawn at its own size, as layer tiles are.
+                        PrDrawable src = PrDrawable.create(getFilterContext(g), texture);
+                        Effect input = new PassThrough(src, texture.getContentWidth(), texture.getContentHeight());
+                        PrEffectHelper.render(createFilterEffect(input, filters), g, dstx, dsty, null);
+                    } else {
+                        NGImageView node = new NGImageView();
+                        node.setImage(((PrismImage) img).getImage());
+                        node.setX(dstx);
+                        node.setY(dsty);
+                        node.setViewport(0f, 0f, img.getWidth(), img.getHeight(), dstw, dsth);
+                        node.setContentBounds(new RectBounds(dstx, dsty, dstx + dstw, dsty + dsth));
+                        render(g, createFilterEffect(null, filters), null, null, node);
+                    }
+                }
+            }.paint();
+        }
+        restoreState();
+    }
+
+    /**
+     * Chains the filters other than opacity into Decora effects on top of
+     * {@code input}, or of the default input when it is {@code null}.
+     */
+    private Effect createFilterEffect(Effect input, WCFilterOperation[] filters) {
+        Effect effect = input;
+        for (WCFilterOperation filter : filters) {
+            float amount = filter.getAmount();
+            switch (filter.getType()) {
+                case GraphicsDecoder.FILTER_BLUR: {
+                    GaussianBlur blur = new GaussianBlur();
+                    blur.setInput(effect);
+                    blur.setRadius(clamp(3f * amount, 0f, 63f));
+                    effect = blur;
+                    break;
+                }
+                case GraphicsDecoder.FILTER_DROP_SHADOW: {
+                    DropShadow shadow = new DropShadow();
+                    shadow.setShadowSourceInput(effect);
+                    shadow.setContentInput(effect);
+                    shadow.setOffsetX((int) filter.getDx());
+                    shadow.setOffsetY((int) filter.getDy());
+                    shadow.setRadius(clamp(3f * amount, 0f, 127f));
+                    shadow.setColor(createColor4f(filter.getColor()));
+                    effect = shadow;
+                    break;
+                }
+                case GraphicsDecoder.FILTER_GRAYSCALE: {
+                    ColorAdjust adjust = new ColorAdjust();
+                    adjust.setInput(effect);
+                    adjust.setSaturation(-clamp(amount, 0f, 1f));
+                    effect = adjust;
+                    break;
+                }
+                case GraphicsDecoder.FILTER_BRIGHTNESS: {
+                    ColorAdjust adjust = new ColorAdjust();
+                    adjust.setInput(effect);
+                    adjust.setBrightness(clamp(amount - 1f, -1f, 1f));
+                    effect = adjust;
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+        return effect;
+    }
+
+    private static float clamp(float value, float min, float max) {
+        return (value < min) ? min : (value > max) ? max : value;
+    }
+
     @Override
     public void drawBitmapImage(final ByteBuffer image, final int x, final int y, final int w, final int h) {
         if (!shouldRenderRect(x, y, w, h, null, null)) {
@@ -1676,10 +1904,11 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
             return imgData;
         }
 
-        @Override public RectBounds getBounds(
+        @Override public BaseBounds getBounds(
                 BaseTransform transform,
                 Effect defaultInput) {
-            return null;
+            // Effects chained on top of this one (e.g. blur) pad these bounds
+            return transformBounds(transform, new RectBounds(0, 0, width, height));
         }
 
         @Override public AccelType getAccelType(FilterContext fctx) {
@@ -1819,7 +2048,7 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
                         render(g, shadow, paint, null, node);
                     } else {
                         g.setPaint(paint);
-                        g.fill(p2d);
+                        ((WCPathImpl) path).fill(g);
                     }
                 }
             }.paint();
@@ -1878,4 +2107,9 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
     public WCGradient createRadialGradient(WCPoint p1, float r1, WCPoint p2, float r2) {
         return new WCRadialGradient(p1, r1, p2, r2);
     }
+
+    @Override
+    public WCGradient createConicGradient(WCPoint center, float angle, WCRectangle bounds) {
+        return new WCConicGradient(center, angle, bounds);
+    }
 }
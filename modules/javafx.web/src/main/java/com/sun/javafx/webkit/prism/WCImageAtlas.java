@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.webkit.prism;
+
+import com.sun.javafx.geom.Rectangle;
+import com.sun.prism.Graphics;
+import com.sun.prism.Image;
+import com.sun.prism.PixelFormat;
+import com.sun.prism.ResourceFactory;
+import com.sun.prism.Texture;
+import com.sun.prism.impl.packrect.RectanglePacker;
+import java.nio.ByteBuffer;
+
+/**
+ * A texture shared by the small decoded images of the web pages. Drawing
+ * many of them, such as the icons of a page, then does not switch textures
+ * and Prism batches the draws into a few quads.
+ */
+final class WCImageAtlas {
+    private static final int WIDTH = 1024;
+    private static final int HEIGHT = 1024;
+    // Images up to this size in both dimensions go to the atlas
+    private static final int MAX_IMAGE_SIZE = 64;
+    // The edge pixels of each image are repeated in a border of this size,
+    // so that linear filtering at the edges does not sample the neighbours
+    private static final int PAD = 1;
+
+    private static WCImageAtlas atlas;
+    private static int lastGeneration;
+
+    /**
+     * The location of an image in the atlas. It is valid while its
+     * generation is the one of the atlas.
+     */
+    static final class Location {
+        private int generation = -1;
+        private int x, y;
+
+        int getX() {
+            return x;
+        }
+
+        int getY() {
+            return y;
+        }
+    }
+
+    private final ResourceFactory factory;
+    private final Texture texture;
+    private final RectanglePacker packer;
+    private int generation;
+
+    private WCImageAtlas(ResourceFactory factory, Texture texture) {
+        this.factory = factory;
+        this.texture = texture;
+        this.packer = new RectanglePacker(texture, WIDTH, HEIGHT);
+        this.generation = ++lastGeneration;
+    }
+
+    static boolean isAtlasCandidate(Image img) {
+        int w = img.getWidth();
+        int h = img.getHeight();
+        return 0 < w && w <= MAX_IMAGE_SIZE &&
+               0 < h && h <= MAX_IMAGE_SIZE;
+    }
+
+    /**
+     * Returns the locked atlas texture for drawing {@code img}, which is
+     * first added to the atlas unless {@code location} is still valid.
+     * Returns null if the atlas cannot be used, in which case the image is
+     * drawn from its own texture.
+     */
+    static Texture lockImage(Graphics g, Image img, Location location) {
+        ResourceFactory factory = g.getResourceFactory();
+        WCImageAtlas a = atlas;
+        if (a != null) {
+            a.texture.lock();
+            if (a.texture.isSurfaceLost() || a.factory != factory) {
+                a.texture.unlock();
+                a.texture.dispose();
+                atlas = a = null;
+            }
+        }
+        if (a == null) {
+            Texture texture = factory.createTexture(PixelFormat.BYTE_BGRA_PRE,
+                    Texture.Usage.DEFAULT, Texture.WrapMode.CLAMP_NOT_NEEDED,
+                    WIDTH, HEIGHT);
+            if (texture == null) {
+                return null;
+            }
+            // a new texture is returned locked
+            texture.contentsUseful();
+            texture.makePermanent();
+            atlas = a = new WCImageAtlas(factory, texture);
+        }
+        if (location.generation != a.generation && !a.add(img, location)) {
+            a.texture.unlock();
+            return null;
+        }
+        return a.texture;
+    }
+
+    private boolean add(Image img, Location location) {
+        int w = img.getWidth();
+        int h = img.getHeight();
+        Rectangle rect = new Rectangle(0, 0, w + 2 * PAD, h + 2 * PAD);
+        if (!packer.add(rect)) {
+            // Start over, the images are added again as they are drawn.
+            // Updating the texture flushes the pending draws that use its
+            // old contents.
+            packer.clear();
+            generation = ++lastGeneration;
+            if (!packer.add(rect)) {
+                return false;
+            }
+        }
+        texture.update(ByteBuffer.wrap(getPaddedPixels(img)),
+                PixelFormat.BYTE_BGRA_PRE,
+                rect.x, rect.y, 0, 0, rect.width, rect.height,
+                rect.width * 4, false);
+        location.generation = generation;
+        location.x = rect.x + PAD;
+        location.y = rect.y + PAD;
+        return true;
+    }
+
+    private static byte[] getPaddedPixels(Image img) {
+        int w = img.getWidth();
+        int h = img.getHeight();
+        int scan = (w + 2 * PAD) * 4;
+        byte[] pixels = new byte[scan * (h + 2 * PAD)];
+        img.getPixels(0, 0, w, h,
+                javafx.scene.image.PixelFormat.getByteBgraPreInstance(),
+                pixels, PAD * scan + PAD * 4, scan);
+        for (int y = PAD; y < PAD + h; y++) {
+            int row = y * scan;
+            for (int i = 0; i < PAD; i++) {
+                System.arraycopy(pixels, row + PAD * 4, pixels, row + i * 4, 4);
+                System.arraycopy(pixels, row + (PAD + w - 1) * 4,
+                        pixels, row + (PAD + w + i) * 4, 4);
+            }
+        }
+        for (int i = 0; i < PAD; i++) {
+            System.arraycopy(pixels, PAD * scan, pixels, i * scan, scan);
+            System.arraycopy(pixels, (PAD + h - 1) * scan,
+                    pixels, (PAD + h + i) * scan, scan);
+        }
+        return pixels;
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,7 +40,8 @@ import com.sun.webkit.graphics.WCImageFrame;
 import java.io.ByteArrayInputStream;
 import java.io.IOException;
 import java.io.InputStream;
-import java.util.Arrays;
+import java.nio.ByteBuffer;
+import javafx.application.Platform;
 import javafx.concurrent.Service;
 import javafx.concurrent.Task;
 
@@ -57,6 +58,11 @@ final class WCImageDecoderImpl extends WCImageDecoder {
     private boolean fullDataReceived = false;
     private boolean framesDecoded = false; // guards frames from repeated decoding
     private PrismImage[] images;
+    // frames decoded at a reduced size, by subsampling level, see
+    // getFrame(int, int, int)
+    private static final int MAX_SUBSAMPLING_LEVEL = 3;
+    private ImageFrame[][] scaledFrames;
+    private PrismImage[][] scaledImages;
     private volatile byte[] data;
     private volatile int dataSize = 0;
     private String fileNameExtension;
@@ -79,9 +85,15 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         destroyLoader();
         frames = null;
         images = null;
+        destroyScaledFrames();
         framesDecoded = false;
     }
 
+    private void destroyScaledFrames() {
+        scaledFrames = null;
+        scaledImages = null;
+    }
+
     @Override protected String getFilenameExtension() {
         return "." + fileNameExtension;
     }
@@ -91,19 +103,22 @@ final class WCImageDecoderImpl extends WCImageDecoder {
     }
 
     @Override protected void addImageData(byte[] dataPortion) {
+        addImageData(dataPortion != null ? ByteBuffer.wrap(dataPortion) : null);
+    }
+
+    @Override protected void addImageData(ByteBuffer dataPortion) {
         if (dataPortion != null) {
             fullDataReceived = false;
+            int length = dataPortion.remaining();
             if (data == null) {
-                data = Arrays.copyOf(dataPortion, dataPortion.length * 2);
-                dataSize = dataPortion.length;
-            } else {
-                int newDataSize = dataSize + dataPortion.length;
-                if (newDataSize > data.length) {
-                    resizeDataArray(Math.max(newDataSize, data.length * 2));
-                }
-                System.arraycopy(dataPortion, 0, data, dataSize, dataPortion.length);
-                dataSize = newDataSize;
+                data = new byte[length * 2];
+                dataSize = 0;
+            } else if (dataSize + length > data.length) {
+                resizeDataArray(Math.max(dataSize + length, data.length * 2));
             }
+            // Copy straight from native memory into the accumulated data
+            dataPortion.get(data, dataSize, length);
+            dataSize += length;
             // Try to decode the partial data until we get image size.
             if (!imageSizeAvilable()) {
                 loadFrames();
@@ -173,12 +188,19 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         setFrames(loadFrames(in));
     }
 
-    private synchronized ImageFrame[] loadFrames(InputStream in) {
+    private ImageFrame[] loadFrames(InputStream in) {
+        return loadFrames(in, 0, 0);
+    }
+
+    private synchronized ImageFrame[] loadFrames(InputStream in, int width, int height) {
         if (log.isLoggable(Level.FINE)) {
-            log.fine(String.format("%X Decoding frames", hashCode()));
+            log.fine(String.format("%X Decoding frames at %dx%d", hashCode(), width, height));
         }
         try {
-            return ImageStorage.getInstance().loadAll(in, readerListener, 0, 0, true, 1.0f, false);
+            // A non-zero size lets the loaders decode at a reduced size,
+            // e.g. the JPEG loader uses DCT scaling.
+            return ImageStorage.getInstance().loadAll(in, readerListener,
+                    width, height, true, 1.0f, width > 0 || height > 0);
         } catch (ImageStorageException e) {
             return null; // consider image missing
         } finally {
@@ -206,13 +228,19 @@ final class WCImageDecoderImpl extends WCImageDecoder {
             }
             // The following lines is a workaround for RT-13475,
             // because image decoder does not report valid image size
+            boolean sizeChanged = false;
             if (imageWidth < metadata.imageWidth) {
                 imageWidth = metadata.imageWidth;
+                sizeChanged = true;
             }
             if (imageHeight < metadata.imageHeight) {
                 imageHeight = metadata.imageHeight;
+                sizeChanged = true;
             }
             fileNameExtension = l.getFormatDescription().getExtensions().get(0);
+            if (sizeChanged) {
+                pushProperties();
+            }
         }
     };
 
@@ -253,7 +281,24 @@ final class WCImageDecoderImpl extends WCImageDecoder {
     private synchronized void setFrames(ImageFrame[] frames) {
         this.frames = frames;
         this.images = null;
+        destroyScaledFrames();
         frameCount = frames == null ? 0 : frames.length;
+        pushProperties();
+    }
+
+    private synchronized void pushProperties() {
+        int[] properties = new int[frameCount * FRAME_PROPERTY_COUNT];
+        for (int i = 0; i < frameCount; i++) {
+            int offset = i * FRAME_PROPERTY_COUNT;
+            int[] size = getFrameSize(i);
+            if (size != null) {
+                properties[offset + FRAME_WIDTH] = size[0];
+                properties[offset + FRAME_HEIGHT] = size[1];
+            }
+            properties[offset + FRAME_DURATION] = getFrameDuration(i);
+            properties[offset + FRAME_COMPLETE] = getFrameCompleteStatus(i) ? 1 : 0;
+        }
+        updateProperties(imageWidth, imageHeight, framesDecoded, properties);
     }
 
     @Override protected int getFrameCount() {
@@ -287,6 +332,55 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return null;
     }
 
+    @Override protected synchronized WCImageFrame getFrame(int idx, int width, int height) {
+        // Partial data is decoded progressively at the original size only,
+        // and there is nothing to gain from upscaling.
+        if (!fullDataReceived || width <= 0 || height <= 0
+                || !imageSizeAvilable()
+                || (width >= imageWidth && height >= imageHeight)) {
+            return getFrame(idx);
+        }
+        // Requests are rounded up to the closest level, so that the frames
+        // decoded for a level serve every size drawn from it
+        int level = 0;
+        while (level < MAX_SUBSAMPLING_LEVEL
+                && subsampledSize(imageWidth, level + 1) >= width
+                && subsampledSize(imageHeight, level + 1) >= height) {
+            level++;
+        }
+        if (level == 0) {
+            return getFrame(idx);
+        }
+        if (scaledFrames == null) {
+            scaledFrames = new ImageFrame[MAX_SUBSAMPLING_LEVEL + 1][];
+            scaledImages = new PrismImage[MAX_SUBSAMPLING_LEVEL + 1][];
+        }
+        if (scaledFrames[level] == null) {
+            width = subsampledSize(imageWidth, level);
+            height = subsampledSize(imageHeight, level);
+            ImageFrame[] levelFrames = loadFrames(
+                    new ByteArrayInputStream(this.data, 0, this.dataSize), width, height);
+            // A failed decode is not retried
+            scaledFrames[level] = levelFrames != null ? levelFrames : new ImageFrame[0];
+            scaledImages[level] = new PrismImage[scaledFrames[level].length];
+        }
+        ImageFrame[] levelFrames = scaledFrames[level];
+        if (idx < 0 || idx >= levelFrames.length || levelFrames[idx] == null) {
+            return getFrame(idx);
+        }
+        PrismImage[] levelImages = scaledImages[level];
+        if (levelImages[idx] == null) {
+            levelImages[idx] = new WCImageImpl(levelFrames[idx]);
+        }
+        return new Frame(levelImages[idx], fileNameExtension);
+    }
+
+    // Every level halves both dimensions, rounding up like the DCT scaling
+    // done by the JPEG loader
+    private static int subsampledSize(int size, int level) {
+        return (size + (1 << level) - 1) >> level;
+    }
+
     private synchronized ImageMetadata getFrameMetadata(int idx) {
         return frames != null && frames.length > idx && frames[idx] != null ? frames[idx].getMetadata() : null;
     }
@@ -328,17 +422,52 @@ final class WCImageDecoderImpl extends WCImageDecoder {
 
     private synchronized ImageFrame getImageFrame(int idx) {
         if (!fullDataReceived) {
-            startLoader();
+            if (Platform.isFxApplicationThread()) {
+                startLoader();
+            } else {
+                // Asynchronous decoding from a WebCore decoding thread,
+                // the loader service can only be used on the event thread.
+                setFrames(loadFrames());
+            }
         } else if (fullDataReceived && !framesDecoded) {
             destroyLoader();
-            setFrames(loadFrames()); // re-decode frames if they have been destroyed
+            // re-decode frames if they have been destroyed
+            ImageFrame[] decoded = loadFrames();
             framesDecoded = true;
+            setFrames(decoded);
         }
         return (idx >= 0) && (this.frames != null) && (this.frames.length > idx)
                 ? this.frames[idx]
                 : null;
     }
 
+    @Override protected synchronized void clearFrameBufferCache(int idx) {
+        // WebCore drops the decoded data of images that have not been painted
+        // for a while, e.g. scrolled far off-screen, under its live decoded
+        // size budget and on memory pressure. A single frame can be decoded
+        // again from the encoded data, so it is released here as well, or
+        // the memory would stay held by the decoder. The frame WebCore may
+        // still use is referenced from its image.
+        if (fullDataReceived && framesDecoded && frameCount <= 1) {
+            destroyLoader();
+            frames = null;
+            images = null;
+            destroyScaledFrames();
+            framesDecoded = false;
+            return;
+        }
+        // The decoded frames of an animation stay, they can only be decoded
+        // all together, but the images created from them are recreated when
+        // needed. Those still in use by WebCore are referenced from there.
+        if (images != null) {
+            for (int i = 0; i < images.length; i++) {
+                if (i != idx) {
+                    images[i] = null;
+                }
+            }
+        }
+    }
+
     private synchronized PrismImage getPrismImage(int idx, ImageFrame frame) {
         if (this.images == null) {
             this.images = new PrismImage[this.frames.length];
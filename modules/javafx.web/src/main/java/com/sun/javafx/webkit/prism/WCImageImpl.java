@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -50,6 +50,7 @@ final class WCImageImpl extends PrismImage {
     private final Image img;
     private Texture texture;
     private CompoundTexture compoundTexture;
+    private WCImageAtlas.Location atlasLocation;
 
 
     WCImageImpl(int w, int h) {
@@ -108,6 +109,25 @@ final class WCImageImpl extends PrismImage {
             return;
         }
 
+        if (texture == null && compoundTexture == null &&
+                WCImageAtlas.isAtlasCandidate(img))
+        {
+            if (atlasLocation == null) {
+                atlasLocation = new WCImageAtlas.Location();
+            }
+            Texture atlasTexture = WCImageAtlas.lockImage(g, img, atlasLocation);
+            if (atlasTexture != null) {
+                int x = atlasLocation.getX();
+                int y = atlasLocation.getY();
+                g.drawTexture(
+                        atlasTexture,
+                        dstx1, dsty1, dstx2, dsty2,
+                        srcx1 + x, srcy1 + y, srcx2 + x, srcy2 + y);
+                atlasTexture.unlock();
+                return;
+            }
+        }
+
         if (texture != null) {
             texture.lock();
             if (texture.isSurfaceLost()) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,9 @@ import java.lang.ref.WeakReference;
 
 final class WCPageBackBufferImpl extends WCPageBackBuffer implements ResourceFactoryListener {
     private RTTexture texture;
+    // Scratch texture for scrolling, kept between scrolls so that each
+    // scroll step does not allocate and free a texture of the viewport size
+    private RTTexture scrollTexture;
     private WeakReference<ResourceFactory> registeredWithFactory = null;
     private boolean firstValidate = true;
     private float pixelScale;
@@ -87,11 +90,45 @@ final class WCPageBackBufferImpl extends WCPageBackBuffer implements ResourceFac
         h = (int) Math.ceil(h * pixelScale);
         dx *= pixelScale;
         dy *= pixelScale;
-        RTTexture aux = createTexture(w, h);
+        RTTexture aux = getScrollTexture(w, h);
         aux.createGraphics().drawTexture(texture, 0, 0, w, h, x, y, x + w, y + h);
         texture.createGraphics().drawTexture(aux, x + dx, y + dy, x + w + dx, y + h + dy,
                                              0, 0, w, h);
-        aux.dispose();
+        aux.unlock();
+    }
+
+    /**
+     * Returns a locked scratch texture at least {@code w} by {@code h}
+     * pixels, reusing the one from the previous scroll when it is still
+     * large enough.
+     */
+    private RTTexture getScrollTexture(int w, int h) {
+        if (scrollTexture != null) {
+            scrollTexture.lock();
+            if (scrollTexture.isSurfaceLost()
+                    || scrollTexture.getContentWidth() < w
+                    || scrollTexture.getContentHeight() < h) {
+                scrollTexture.dispose();
+                scrollTexture = null;
+            }
+        }
+        if (scrollTexture == null) {
+            int tw = w, th = h;
+            if (texture != null) {
+                // Size it for the whole page so that later scrolls fit
+                tw = Math.max(w, texture.getContentWidth());
+                th = Math.max(h, texture.getContentHeight());
+            }
+            scrollTexture = createTexture(tw, th);
+        }
+        return scrollTexture;
+    }
+
+    private void disposeScrollTexture() {
+        if (scrollTexture != null) {
+            scrollTexture.dispose();
+            scrollTexture = null;
+        }
     }
 
     @Override
@@ -140,6 +177,7 @@ final class WCPageBackBufferImpl extends WCPageBackBuffer implements ResourceFac
                         Math.min(width, tw), Math.min(height, th));
                 texture.dispose();
                 texture = newTexture;
+                disposeScrollTexture();
             }
         }
         return true;
@@ -150,6 +188,7 @@ final class WCPageBackBufferImpl extends WCPageBackBuffer implements ResourceFac
             texture.dispose();
             texture = null;
         }
+        disposeScrollTexture();
     }
 
     @Override public void factoryReleased() {
@@ -159,5 +198,6 @@ final class WCPageBackBufferImpl extends WCPageBackBuffer implements ResourceFac
             texture.dispose();
             texture = null;
         }
+        disposeScrollTexture();
     }
 }
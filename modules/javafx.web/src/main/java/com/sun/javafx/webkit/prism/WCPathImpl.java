@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,11 +39,16 @@ import com.sun.webkit.graphics.WCRectangle;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
 import com.sun.prism.BasicStroke;
+import com.sun.prism.Graphics;
+import com.sun.prism.ResourceFactory;
+import com.sun.prism.shape.ShapeRep;
 import java.util.Arrays;
 
 final class WCPathImpl extends WCPath<Path2D> {
     private final Path2D path;
     private boolean hasCP = false;
+    private ShapeRep fillRep;
+    private ResourceFactory fillRepFactory;
 
     private final static PlatformLogger log =
             PlatformLogger.getLogger(WCPathImpl.class.getName());
@@ -64,12 +69,22 @@ final class WCPathImpl extends WCPath<Path2D> {
         hasCP = wcp.hasCP;
     }
 
+    WCPathImpl(byte[] types, int numTypes, float[] coords, int numCoords) {
+        if (log.isLoggable(Level.FINE)) {
+            log.fine("Create WCPathImpl({0}) from {1} segments",
+                    new Object[] { getID(), numTypes });
+        }
+        path = new Path2D(Path2D.WIND_NON_ZERO, types, numTypes, coords, numCoords);
+        hasCP = numTypes > 0;
+    }
+
     @Override
     public void addRect(double x, double y, double w, double h) {
         if (log.isLoggable(Level.FINE)) {
             log.fine("WCPathImpl({0}).addRect({1},{2},{3},{4})",
                         new Object[] {getID(), x, y, w, h});
         }
+        shapeChanged();
         hasCP = true;
         path.append(new RoundRectangle2D(
                 (float)x, (float)y, (float)w, (int)h, 0.0f, 0.0f), false);
@@ -82,6 +97,7 @@ final class WCPathImpl extends WCPath<Path2D> {
             log.fine("WCPathImpl({0}).addEllipse({1},{2},{3},{4})",
                     new Object[] {getID(), x, y, w, h});
         }
+        shapeChanged();
         hasCP = true;
         path.append(new Ellipse2D((float)x, (float)y, (float)w, (float)h), false);
     }
@@ -101,6 +117,7 @@ final class WCPathImpl extends WCPath<Path2D> {
                 new Point2D((float) x2, (float) y2),
                 (float) r);
 
+        shapeChanged();
         hasCP = true;
         path.append(arc, true);
     }
@@ -119,6 +136,7 @@ final class WCPathImpl extends WCPath<Path2D> {
                     new Object[] {getID(), x, y, r, startAngle, endAngle, aclockwise});
         }
 
+        shapeChanged();
         hasCP = true;
 
         float newEndAngle = endAngle;
@@ -187,6 +205,7 @@ final class WCPathImpl extends WCPath<Path2D> {
         if (log.isLoggable(Level.FINE)) {
             log.fine("WCPathImpl({0}).clear()", getID());
         }
+        shapeChanged();
         hasCP = false;
         path.reset();
     }
@@ -197,6 +216,7 @@ final class WCPathImpl extends WCPath<Path2D> {
             log.fine("WCPathImpl({0}).moveTo({1},{2})",
                     new Object[] {getID(), x, y});
         }
+        shapeChanged();
         hasCP = true;
         path.moveTo((float)x, (float)y);
     }
@@ -207,6 +227,7 @@ final class WCPathImpl extends WCPath<Path2D> {
             log.fine("WCPathImpl({0}).addLineTo({1},{2})",
                     new Object[] {getID(), x, y});
         }
+        shapeChanged();
         hasCP = true;
         path.lineTo((float)x, (float)y);
     }
@@ -217,6 +238,7 @@ final class WCPathImpl extends WCPath<Path2D> {
             log.fine("WCPathImpl({0}).addQuadCurveTo({1},{2},{3},{4})",
                     new Object[] {getID(), x0, y0, x1, y1});
         }
+        shapeChanged();
         hasCP = true;
         path.quadTo((float)x0, (float)y0, (float)x1, (float)y1);
     }
@@ -228,6 +250,7 @@ final class WCPathImpl extends WCPath<Path2D> {
             log.fine("WCPathImpl({0}).addBezierCurveTo({1},{2},{3},{4},{5},{6})",
                     new Object[] {getID(), x0, y0, x1, y1, x2, y2});
         }
+        shapeChanged();
         hasCP = true;
         path.curveTo((float)x0, (float)y0, (float)x1, (float)y1,
                      (float)x2, (float)y2);
@@ -239,6 +262,7 @@ final class WCPathImpl extends WCPath<Path2D> {
             log.fine("WCPathImpl({0}).addPath({1})",
                     new Object[] {getID(), p.getID()});
         }
+        shapeChanged();
         hasCP = hasCP || ((WCPathImpl)p).hasCP;
         path.append(((WCPathImpl)p).path, false);
     }
@@ -248,6 +272,7 @@ final class WCPathImpl extends WCPath<Path2D> {
         if (log.isLoggable(Level.FINE)) {
             log.fine("WCPathImpl({0}).closeSubpath()", getID());
         }
+        shapeChanged();
         path.closePath();
     }
 
@@ -263,7 +288,34 @@ final class WCPathImpl extends WCPath<Path2D> {
 
     @Override
     public void setWindingRule(int rule) {
-        this.path.setWindingRule(1 - rule); // convert webkit to prism
+        int prismRule = 1 - rule; // convert webkit to prism
+        if (path.getWindingRule() != prismRule) {
+            shapeChanged();
+            path.setWindingRule(prismRule);
+        }
+    }
+
+    /**
+     * Fills the path. The path is usually unchanged from one frame to the
+     * next, so the rasterized shape is cached once it is filled often
+     * enough with the same transform.
+     */
+    void fill(Graphics g) {
+        ResourceFactory factory = g.getResourceFactory();
+        if (fillRep == null || fillRepFactory != factory) {
+            shapeChanged();
+            fillRep = factory.createPathRep();
+            fillRepFactory = factory;
+        }
+        fillRep.fill(g, path, path.getBounds());
+    }
+
+    private void shapeChanged() {
+        if (fillRep != null) {
+            fillRep.dispose();
+            fillRep = null;
+            fillRepFactory = null;
+        }
     }
 
     @Override
@@ -336,6 +388,7 @@ final class WCPathImpl extends WCPath<Path2D> {
             log.fine("WCPathImpl({0}).translate({1}, {2})",
                     new Object[] {getID(), x, y});
         }
+        shapeChanged();
         path.transform(BaseTransform.getTranslateInstance(x, y));
     }
 
@@ -348,6 +401,7 @@ final class WCPathImpl extends WCPath<Path2D> {
             log.fine("WCPathImpl({0}).transform({1},{2},{3},{4},{5},{6})",
                     new Object[] {getID(), mxx, myx, mxy, myy, mxt, myt});
         }
+        shapeChanged();
         path.transform(BaseTransform.getInstance(mxx, myx, mxy, myy, mxt, myt));
     }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,9 +28,23 @@ package com.sun.javafx.webkit.prism;
 import com.sun.webkit.graphics.WCGraphicsContext;
 import com.sun.webkit.graphics.WCRectangle;
 import com.sun.webkit.graphics.WCRenderQueue;
+import java.util.ArrayList;
+import java.util.LinkedHashSet;
+import java.util.List;
 
 final class WCRenderQueueImpl extends WCRenderQueue {
 
+    /*
+     * Queues of offscreen targets (canvases, image buffers) flushed since the
+     * render thread last decoded them. Each target has its own graphics
+     * context, so the queues are independent of each other and are decoded
+     * together in one render job rather than one job per flush. A target
+     * that is drawn before the job runs decodes its queue itself, see
+     * WCImage.flushRQ().
+     */
+    private static final LinkedHashSet<WCRenderQueueImpl> pendingQueues =
+            new LinkedHashSet<>();
+
     WCRenderQueueImpl(WCGraphicsContext gc) {
         super(gc);
     }
@@ -42,9 +56,25 @@ final class WCRenderQueueImpl extends WCRenderQueue {
     @Override
     protected void flush() {
         if (!isEmpty()) {
-            PrismInvoker.invokeOnRenderThread(() -> {
-                decode();
-            });
+            boolean schedule;
+            synchronized (pendingQueues) {
+                schedule = pendingQueues.isEmpty();
+                pendingQueues.add(this);
+            }
+            if (schedule) {
+                PrismInvoker.invokeOnRenderThread(WCRenderQueueImpl::decodePending);
+            }
+        }
+    }
+
+    private static void decodePending() {
+        List<WCRenderQueueImpl> queues;
+        synchronized (pendingQueues) {
+            queues = new ArrayList<>(pendingQueues);
+            pendingQueues.clear();
+        }
+        for (WCRenderQueueImpl rq : queues) {
+            rq.decode();
         }
     }
 
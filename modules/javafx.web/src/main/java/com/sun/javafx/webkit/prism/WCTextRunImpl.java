@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -78,4 +78,14 @@ public final class WCTextRunImpl implements WCTextRun {
     public int getCharOffset(int index) {
         return run.getCharOffset(index);
     }
+
+    @Override
+    public void getGlyphData(int[] glyphs, int[] charOffsets, float[] advances) {
+        int count = run.getGlyphCount();
+        for (int i = 0; i < count; i++) {
+            glyphs[i] = run.getGlyphCode(i);
+            charOffsets[i] = run.getCharOffset(i);
+            advances[i] = run.getAdvance(i);
+        }
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -42,6 +42,9 @@ public final class PopupMenuImpl extends com.sun.webkit.PopupMenu {
 
     private final static PlatformLogger log = PlatformLogger.getLogger(PopupMenuImpl.class.getName());
 
+    // Number of items fetched from the page in one native call
+    private static final int FETCH_BATCH = 512;
+
     private final ContextMenu popupMenu;
 
     public PopupMenuImpl() {
@@ -70,6 +73,12 @@ public final class PopupMenuImpl extends com.sun.webkit.PopupMenu {
         if (log.isLoggable(Level.FINE)) {
             log.fine("show at [{0}, {1}], width={2}", new Object[] {x, y, width});
         }
+        if (popupMenu.getItems().isEmpty()) {
+            int count = getItemCount();
+            for (int from = 0; from < count; from += FETCH_BATCH) {
+                fetchItems(from, from + FETCH_BATCH);
+            }
+        }
         // TODO: doesn't work
         popupMenu.setPrefWidth(width);
         popupMenu.setPrefHeight(popupMenu.getHeight());
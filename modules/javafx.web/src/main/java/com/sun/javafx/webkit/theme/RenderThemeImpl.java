@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,6 +47,7 @@ import java.util.ArrayList;
 import java.util.HashMap;
 import java.util.List;
 import java.util.Map;
+import java.util.WeakHashMap;
 import java.util.LinkedHashMap;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
@@ -88,6 +89,9 @@ public final class RenderThemeImpl extends RenderTheme {
 
     private Pool<FormControl> pool;
 
+    // References handed out for the controls in the pool
+    private final Map<FormControl, FormControlRef> refs = new WeakHashMap<>();
+
     /**
      * A pool of controls.
      * Based on a hash map where a control is the value and its ID is the key.
@@ -334,10 +338,15 @@ public final class RenderThemeImpl extends RenderTheme {
                 ProgressBar progress = (ProgressBar) ctrl;
                 extParams.order(ByteOrder.nativeOrder());
                 progress.setProgress(extParams.getFloat());
-                progress.setStyle(getMeterStyle(extParams.getInt()));
+                String style = getMeterStyle(extParams.getInt());
+                if (!style.equals(progress.getStyle())) {
+                    progress.setStyle(style);
+                }
             }
         }
-        return new FormControlRef(fc);
+        // Widgets are painted on every repaint, so reuse the reference
+        // rather than allocate a new one each time
+        return refs.computeIfAbsent(fc, FormControlRef::new);
     }
 
     private String getMeterStyle(int region) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,11 +31,10 @@ import java.io.FileNotFoundException;
 import java.io.IOException;
 import java.io.RandomAccessFile;
 import static java.lang.String.format;
-import java.nio.ByteBuffer;
-import java.nio.channels.FileChannel;
 import java.nio.file.Files;
 import java.nio.file.InvalidPathException;
 import java.nio.file.Paths;
+import java.nio.file.StandardCopyOption;
 
 final class FileSystem {
 
@@ -73,24 +72,6 @@ final class FileSystem {
         }
     }
 
-    private static int fwkReadFromFile(RandomAccessFile raf, ByteBuffer byteBuffer) {
-        try {
-            FileChannel fc = raf.getChannel();
-            return fc.read(byteBuffer);
-        } catch (IOException ex) {
-            logger.fine(format("Error while reading RandomAccessFile for file [%s]", raf), ex);
-        }
-        return -1;
-    }
-
-    private static void fwkSeekFile(RandomAccessFile raf, long pos) {
-        try {
-            raf.seek(pos);
-        } catch (IOException ex) {
-            logger.fine(format("Error while seek RandomAccessFile for file [%s]", raf), ex);
-        }
-    }
-
     private static long fwkGetFileSize(String path) {
         try {
             File file = new File(path);
@@ -143,4 +124,36 @@ final class FileSystem {
     private static String fwkPathGetFileName(String path) {
         return new File(path).getName();
     }
+
+    private static boolean fwkDeleteFile(String path) {
+        try {
+            Files.delete(Paths.get(path));
+            return true;
+        } catch (InvalidPathException|IOException|SecurityException ex) {
+            logger.fine(format("Error deleting file [%s]", path), ex);
+            return false;
+        }
+    }
+
+    private static boolean fwkMoveFile(String oldPath, String newPath) {
+        try {
+            Files.move(Paths.get(oldPath), Paths.get(newPath),
+                    StandardCopyOption.REPLACE_EXISTING,
+                    StandardCopyOption.ATOMIC_MOVE);
+            return true;
+        } catch (InvalidPathException|IOException|SecurityException ex) {
+            logger.fine(format("Error moving file [%s] to [%s]",
+                    oldPath, newPath), ex);
+            return false;
+        }
+    }
+
+    private static String[] fwkListDirectory(String path) {
+        try {
+            return new File(path).list();
+        } catch (SecurityException ex) {
+            logger.fine(format("Error listing directory [%s]", path), ex);
+            return null;
+        }
+    }
 }
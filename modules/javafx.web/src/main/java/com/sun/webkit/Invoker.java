@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -89,4 +89,16 @@ public abstract class Invoker {
     public abstract void invokeOnEventThread(Runnable r);
 
     public abstract void postOnEventThread(Runnable r);
+
+    /**
+     * Runs a nested event loop on the event thread until
+     * {@link #exitNestedEventLoop} is called with the same key.
+     */
+    public abstract void enterNestedEventLoop(Object key);
+
+    /**
+     * Makes the nested event loop entered with the given key return. Must
+     * be called on the event thread.
+     */
+    public abstract void exitNestedEventLoop(Object key);
 }
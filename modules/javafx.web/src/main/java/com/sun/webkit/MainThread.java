@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,7 +32,7 @@ final class MainThread {
 
     private static void fwkScheduleDispatchFunctions() {
         Invoker.getInvoker().postOnEventThread(() -> {
-            twkScheduleDispatchFunctions();
+            SynchronousLoad.runOrDefer(MainThread::twkScheduleDispatchFunctions);
         });
     }
 
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+import java.lang.management.ManagementFactory;
+import java.lang.management.MemoryNotificationInfo;
+import java.lang.management.MemoryPoolMXBean;
+import java.lang.management.MemoryType;
+import java.util.concurrent.atomic.AtomicBoolean;
+import javax.management.NotificationEmitter;
+
+/**
+ * Releases WebCore caches when memory runs low.
+ *
+ * The native side watches the footprint of the process. On top of that,
+ * heap pools without a usage threshold get one, and WebCore releases
+ * memory when a pool crosses it. It does so critically, dropping the page
+ * and memory caches too, when a pool is still above its threshold after
+ * a collection.
+ */
+final class MemoryPressure {
+
+    private static final double USAGE_THRESHOLD = 0.8;
+    private static final double COLLECTION_USAGE_THRESHOLD = 0.9;
+
+    private static final AtomicBoolean releasePending = new AtomicBoolean();
+
+    private MemoryPressure() {
+        throw new AssertionError();
+    }
+
+    /**
+     * Installs the memory pressure handlers. Must be called on the event
+     * thread once WebCore is initialized.
+     */
+    static void install() {
+        twkInstall();
+
+        for (MemoryPoolMXBean pool : ManagementFactory.getMemoryPoolMXBeans()) {
+            long max = pool.getUsage().getMax();
+            if (pool.getType() != MemoryType.HEAP || max <= 0) {
+                continue;
+            }
+            // Thresholds set by the application are left as they are
+            if (pool.isUsageThresholdSupported() && pool.getUsageThreshold() == 0) {
+                pool.setUsageThreshold((long) (max * USAGE_THRESHOLD));
+            }
+            if (pool.isCollectionUsageThresholdSupported()
+                    && pool.getCollectionUsageThreshold() == 0) {
+                pool.setCollectionUsageThreshold((long) (max * COLLECTION_USAGE_THRESHOLD));
+            }
+        }
+
+        NotificationEmitter emitter =
+                (NotificationEmitter) ManagementFactory.getMemoryMXBean();
+        emitter.addNotificationListener((notification, handback) -> {
+            String type = notification.getType();
+            boolean critical =
+                    MemoryNotificationInfo.MEMORY_COLLECTION_THRESHOLD_EXCEEDED.equals(type);
+            if (critical || MemoryNotificationInfo.MEMORY_THRESHOLD_EXCEEDED.equals(type)) {
+                releaseMemory(critical);
+            }
+        }, null, null);
+    }
+
+    // Notifications arrive on a JMX thread
+    private static void releaseMemory(boolean critical) {
+        if (releasePending.compareAndSet(false, true)) {
+            Invoker.getInvoker().postOnEventThread(() -> {
+                releasePending.set(false);
+                twkReleaseMemory(critical);
+            });
+        }
+    }
+
+    private static native void twkInstall();
+    private static native void twkReleaseMemory(boolean critical);
+}
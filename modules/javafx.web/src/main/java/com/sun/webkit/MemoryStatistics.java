@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+/**
+ * A snapshot of the memory used by WebKit. Sizes are in bytes.
+ *
+ * Resources in the memory cache (with their decoded data, such as decoded
+ * images), fonts, style sheets and the JavaScript heap are shared by all
+ * pages of the process, so they are reported for the process as a whole.
+ * Snapshots taken for a page add the values that belong to it alone.
+ * Garbage collection times are in microseconds and counted from the
+ * creation of the first page.
+ */
+public final class MemoryStatistics {
+    // Layout of the values array, the process values are filled natively
+    static final int CACHED_RESOURCES = 0;
+    static final int CACHED_RESOURCE_SIZE = 1;
+    static final int LIVE_RESOURCE_SIZE = 2;
+    static final int DECODED_RESOURCE_SIZE = 3;
+    static final int CACHED_IMAGES = 4;
+    static final int CACHED_IMAGE_SIZE = 5;
+    static final int FONTS = 6;
+    static final int INACTIVE_FONTS = 7;
+    static final int JS_HEAP_SIZE = 8;
+    static final int JS_HEAP_CAPACITY = 9;
+    static final int BACK_FORWARD_CACHE_PAGES = 10;
+    static final int GC_COUNT = 11;
+    static final int FULL_GC_COUNT = 12;
+    static final int GC_TIME = 13;
+    static final int MAX_GC_TIME = 14;
+    static final int PROCESS_VALUE_COUNT = 15;
+    static final int DOCUMENTS = 15;
+    static final int RETAINED_RENDER_QUEUE_SIZE = 16;
+    static final int VALUE_COUNT = 17;
+
+    private final long[] values;
+
+    private MemoryStatistics(long[] values) {
+        this.values = values;
+    }
+
+    /**
+     * Returns the memory used by the process as a whole. Must be called
+     * on the event thread.
+     */
+    public static MemoryStatistics forProcess() {
+        Invoker.getInvoker().checkEventThread();
+        return new MemoryStatistics(processValues());
+    }
+
+    /**
+     * Starts counting garbage collections. Must be called on the event
+     * thread once the first page is created.
+     */
+    static void install() {
+        twkInstall();
+    }
+
+    static MemoryStatistics forPage(int documents, long retainedRenderQueueSize) {
+        long[] values = processValues();
+        values[DOCUMENTS] = documents;
+        values[RETAINED_RENDER_QUEUE_SIZE] = retainedRenderQueueSize;
+        return new MemoryStatistics(values);
+    }
+
+    private static long[] processValues() {
+        long[] values = new long[VALUE_COUNT];
+        twkGetProcessValues(values);
+        return values;
+    }
+
+    /**
+     * Resources held by the memory cache.
+     */
+    public long getCachedResources() {
+        return values[CACHED_RESOURCES];
+    }
+
+    /**
+     * Size of the resources held by the memory cache, including their
+     * decoded data.
+     */
+    public long getCachedResourceSize() {
+        return values[CACHED_RESOURCE_SIZE];
+    }
+
+    /**
+     * Size of the cached resources that are in use by a page.
+     */
+    public long getLiveResourceSize() {
+        return values[LIVE_RESOURCE_SIZE];
+    }
+
+    /**
+     * Size of the decoded data of the cached resources.
+     */
+    public long getDecodedResourceSize() {
+        return values[DECODED_RESOURCE_SIZE];
+    }
+
+    /**
+     * Images held by the memory cache.
+     */
+    public long getCachedImages() {
+        return values[CACHED_IMAGES];
+    }
+
+    /**
+     * Size of the images held by the memory cache, including their
+     * decoded frames.
+     */
+    public long getCachedImageSize() {
+        return values[CACHED_IMAGE_SIZE];
+    }
+
+    /**
+     * Fonts held by the font cache.
+     */
+    public long getFonts() {
+        return values[FONTS];
+    }
+
+    /**
+     * Fonts held by the font cache that no page uses any more.
+     */
+    public long getInactiveFonts() {
+        return values[INACTIVE_FONTS];
+    }
+
+    /**
+     * Size of the live objects in the JavaScript heap.
+     */
+    public long getJavaScriptHeapSize() {
+        return values[JS_HEAP_SIZE];
+    }
+
+    /**
+     * Memory allocated for the JavaScript heap.
+     */
+    public long getJavaScriptHeapCapacity() {
+        return values[JS_HEAP_CAPACITY];
+    }
+
+    /**
+     * Pages kept in the back/forward cache.
+     */
+    public long getBackForwardCachePages() {
+        return values[BACK_FORWARD_CACHE_PAGES];
+    }
+
+    /**
+     * Collections of the JavaScript heap, eden and full.
+     */
+    public long getGCCount() {
+        return values[GC_COUNT];
+    }
+
+    /**
+     * Full collections of the JavaScript heap.
+     */
+    public long getFullGCCount() {
+        return values[FULL_GC_COUNT];
+    }
+
+    /**
+     * Time from the start to the end of the collections. With concurrent
+     * collection enabled, this includes marking done while scripts ran.
+     */
+    public long getGCTime() {
+        return values[GC_TIME];
+    }
+
+    /**
+     * Time taken by the longest collection.
+     */
+    public long getMaxGCTime() {
+        return values[MAX_GC_TIME];
+    }
+
+    /**
+     * Documents of the page, one per frame. Zero for the process.
+     */
+    public long getDocuments() {
+        return values[DOCUMENTS];
+    }
+
+    /**
+     * Size of the render queues the page retains for redrawing without
+     * painting again. Zero for the process.
+     */
+    public long getRetainedRenderQueueSize() {
+        return values[RETAINED_RENDER_QUEUE_SIZE];
+    }
+
+    @Override
+    public String toString() {
+        return "MemoryStatistics {resources: " + getCachedResources()
+                + " resource size: " + getCachedResourceSize()
+                + " live: " + getLiveResourceSize()
+                + " decoded: " + getDecodedResourceSize()
+                + " images: " + getCachedImages()
+                + " image size: " + getCachedImageSize()
+                + " fonts: " + getFonts()
+                + " js heap: " + getJavaScriptHeapSize()
+                + " js capacity: " + getJavaScriptHeapCapacity()
+                + " b/f pages: " + getBackForwardCachePages()
+                + " gcs: " + getGCCount()
+                + " full gcs: " + getFullGCCount()
+                + " gc time: " + getGCTime()
+                + " max gc time: " + getMaxGCTime()
+                + " documents: " + getDocuments()
+                + " retained rq: " + getRetainedRenderQueueSize() + "}";
+    }
+
+    private static native void twkInstall();
+    private static native void twkGetProcessValues(long[] values);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,7 +28,12 @@ package com.sun.webkit;
 import com.sun.webkit.graphics.WCFont;
 
 public abstract class PopupMenu {
+    private static final int ITEM_LABEL = 1;
+    private static final int ITEM_SEPARATOR = 2;
+    private static final int ITEM_ENABLED = 4;
+
     private long pdata;
+    private int itemCount;
 
     protected abstract void show(WebPage page, int x, int y, int width);
 
@@ -39,6 +44,40 @@ public abstract class PopupMenu {
     protected abstract void appendItem(String itemText, boolean isLabel, boolean isSeparator,
                                     boolean isEnabled, int bgColor, int fgColor, WCFont font);
 
+    /**
+     * Returns the number of items in the popup. The items themselves are
+     * fetched on demand with {@link #fetchItems}.
+     */
+    protected final int getItemCount() {
+        return itemCount;
+    }
+
+    /**
+     * Fetches the items in the range {@code [from, to)} from the page and
+     * passes each of them to {@link #appendItem}, in order.
+     */
+    protected final void fetchItems(int from, int to) {
+        from = Math.max(from, 0);
+        to = Math.min(to, itemCount);
+        int count = to - from;
+        if (pdata == 0 || count <= 0) {
+            return;
+        }
+        String[] texts = new String[count];
+        int[] flags = new int[count];
+        int[] bgColors = new int[count];
+        int[] fgColors = new int[count];
+        WCFont[] fonts = new WCFont[count];
+        count = twkGetItems(pdata, from, texts, flags, bgColors, fgColors, fonts);
+        for (int i = 0; i < count; i++) {
+            appendItem(texts[i],
+                       (flags[i] & ITEM_LABEL) != 0,
+                       (flags[i] & ITEM_SEPARATOR) != 0,
+                       (flags[i] & ITEM_ENABLED) != 0,
+                       bgColors[i], fgColors[i], fonts[i]);
+        }
+    }
+
     protected void notifySelectionCommited(int index) {
         twkSelectionCommited(pdata, index);
     }
@@ -66,16 +105,16 @@ public abstract class PopupMenu {
         setSelectedItem(index);
     }
 
-    private void fwkAppendItem(String itemText, boolean isLabel, boolean isSeparator,
-                               boolean isEnabled, int bgColor, int fgColor, WCFont font)
-    {
-        appendItem(itemText, isLabel, isSeparator, isEnabled, bgColor, fgColor, font);
+    private void fwkSetItemCount(int count) {
+        itemCount = count;
     }
 
     private void fwkDestroy() {
         pdata = 0;
     }
 
+    private native int twkGetItems(long pdata, int from, String[] texts, int[] flags,
+                                   int[] bgColors, int[] fgColors, WCFont[] fonts);
     private native void twkSelectionCommited(long pdata, int index);
     private native void twkPopupClosed(long pdata);
 }
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+import java.util.ArrayDeque;
+import java.util.concurrent.CompletableFuture;
+
+/**
+ * Waits for synchronous loads without blocking the event thread.
+ *
+ * While a synchronous load is in progress, WebCore is on the stack waiting
+ * for the result, so it must not be entered for anything but that load.
+ * The event thread runs a nested event loop instead of blocking, which
+ * keeps the rest of the application responsive. Work for WebCore that
+ * arrives meanwhile (timers, dispatched functions, callbacks of
+ * asynchronous loads) is deferred until the outermost synchronous load has
+ * finished, and input events and rendering updates for pages are skipped.
+ */
+public final class SynchronousLoad {
+
+    private static int depth;
+    private static final ArrayDeque<Runnable> deferred = new ArrayDeque<>();
+    private static boolean flushPosted;
+
+    private SynchronousLoad() {
+        throw new AssertionError();
+    }
+
+    /**
+     * Returns {@code true} if the event thread is waiting for a
+     * synchronous load.
+     */
+    public static boolean isInProgress() {
+        return depth > 0;
+    }
+
+    /**
+     * Runs a nested event loop until the given load completes. Must be
+     * called on the event thread.
+     */
+    public static void waitFor(CompletableFuture<?> load) {
+        Invoker.getInvoker().checkEventThread();
+        final Object key = new Object();
+        load.whenComplete((r, th) -> Invoker.getInvoker().postOnEventThread(() ->
+                Invoker.getInvoker().exitNestedEventLoop(key)));
+        depth++;
+        try {
+            Invoker.getInvoker().enterNestedEventLoop(key);
+        } finally {
+            depth--;
+            scheduleFlush();
+        }
+    }
+
+    /**
+     * Runs the given task now, or once the synchronous loads in progress
+     * have finished. Tasks run in the order they were given. Must be
+     * called on the event thread.
+     */
+    public static void runOrDefer(Runnable r) {
+        if (isInProgress() || !deferred.isEmpty()) {
+            deferred.add(r);
+            scheduleFlush();
+        } else {
+            r.run();
+        }
+    }
+
+    // Deferred tasks are posted rather than run from waitFor(), to let the
+    // caller of the synchronous load return before WebCore is entered again
+    private static void scheduleFlush() {
+        if (!isInProgress() && !flushPosted && !deferred.isEmpty()) {
+            flushPosted = true;
+            Invoker.getInvoker().postOnEventThread(SynchronousLoad::flush);
+        }
+    }
+
+    private static void flush() {
+        flushPosted = false;
+        Runnable task;
+        while (!isInProgress() && (task = deferred.poll()) != null) {
+            task.run();
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -61,6 +61,10 @@ public class Timer {
     }
 
     public synchronized void notifyTick() {
+        // Checked again on the next tick
+        if (SynchronousLoad.isInProgress()) {
+            return;
+        }
         if (fireTime > 0 && fireTime <= System.currentTimeMillis()) {
             fireTimerEvent(fireTime);
         }
@@ -94,7 +98,7 @@ public class Timer {
     }
 
     /**
-     * @param fireTime time to wait in seconds
+     * @param fireTime time to fire at, in seconds since the epoch
      */
     private static void fwkSetFireTime(double fireTime) {
         getTimer().setFireTime((long)Math.ceil(fireTime * 1000));
@@ -129,7 +133,8 @@ final class SeparateThreadTimer extends Timer implements Runnable {
 
         @Override
         public void run() {
-            fireTimerEvent(time);
+            final long t = time;
+            SynchronousLoad.runOrDefer(() -> fireTimerEvent(t));
         }
     }
 
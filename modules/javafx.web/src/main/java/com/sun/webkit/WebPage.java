@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@ import javafx.scene.paint.Color;
 import com.sun.glass.utils.NativeLibLoader;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
+import com.sun.javafx.logging.PulseLogger;
 import com.sun.javafx.tk.Toolkit;
 import com.sun.webkit.event.WCFocusEvent;
 import com.sun.webkit.event.WCInputMethodEvent;
@@ -133,6 +134,56 @@ public final class WebPage {
     // An ID of the current updateContent cycle associated with an updateContent call.
     private int updateContentCycleID;
 
+    // The render queues that reproduce the page content, see RetainedDisplayList.
+    // Accessed on: Event thread only.
+    private final RetainedDisplayList retainedDisplayList = new RetainedDisplayList();
+    // Whether the retained display list is to be rendered again in the next
+    // updateContent cycle.
+    private boolean replayPending;
+
+    // Rendering counters, see WebPageStatistics.
+    // Guarded by PAGE_LOCK.
+    private final long[] statistics = new long[WebPageStatistics.VALUE_COUNT];
+    private final long[] decodedOps = new long[GraphicsDecoder.OPCODE_COUNT];
+
+    // The largest total size in bytes of the retained render queues,
+    // 0 disables the retention.
+    private static final int MAX_RETAINED_SIZE;
+
+    static {
+        @SuppressWarnings("removal")
+        int size = AccessController.doPrivileged((PrivilegedAction<Integer>) () ->
+                Integer.getInteger("com.sun.webkit.retainedDisplayListSize",
+                        4 * WCRenderQueue.MAX_QUEUE_SIZE));
+        MAX_RETAINED_SIZE = size;
+    }
+
+    // Whether compiled script bytecode is cached in the user data directory
+    private static final boolean BYTECODE_CACHE_ENABLED;
+
+    static {
+        @SuppressWarnings("removal")
+        boolean enabled = AccessController.doPrivileged((PrivilegedAction<Boolean>) () ->
+                Boolean.getBoolean("com.sun.webkit.bytecodeCache"));
+        BYTECODE_CACHE_ENABLED = enabled;
+    }
+
+    // Whether HTTP responses are cached in the user data directory, and the
+    // size of that cache in megabytes
+    private static final boolean DISK_CACHE_ENABLED;
+    private static final long DISK_CACHE_SIZE;
+
+    static {
+        @SuppressWarnings("removal")
+        boolean enabled = AccessController.doPrivileged((PrivilegedAction<Boolean>) () ->
+                Boolean.getBoolean("com.sun.webkit.diskCache"));
+        DISK_CACHE_ENABLED = enabled;
+        @SuppressWarnings("removal")
+        int size = AccessController.doPrivileged((PrivilegedAction<Integer>) () ->
+                Integer.getInteger("com.sun.webkit.diskCacheSize", 50));
+        DISK_CACHE_SIZE = Math.max(size, 0) * 1024L * 1024L;
+    }
+
     static {
         @SuppressWarnings("removal")
         var dummy = AccessController.doPrivileged((PrivilegedAction<Void>) () -> {
@@ -152,14 +203,73 @@ public final class WebPage {
                     "com.sun.webkit.useJIT", "true"));
             final boolean useDFGJIT = Boolean.valueOf(System.getProperty(
                     "com.sun.webkit.useDFGJIT", "false"));
+            // Only effective when WebKit is built with the optimizing JIT
+            final boolean useFTLJIT = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.useFTLJIT", "true"));
+            final boolean useWebAssembly = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.useWebAssembly", "true"));
 
             // TODO: Enable CSS3D by default once it is stabilized.
             boolean useCSS3D = Boolean.valueOf(System.getProperty(
                     "com.sun.webkit.useCSS3D", "false"));
             useCSS3D = useCSS3D && Platform.isSupported(ConditionalFeature.SCENE3D);
 
+            // Composites accelerated layers and runs their animations
+            // on a separate native thread.
+            final boolean useCompositorThread = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.useCompositorThread", "false"));
+
+            // JavaScript garbage collector settings. The heap sizes are
+            // in MB, zero keeps the default.
+            final long gcMaxHeapSize = Long.getLong(
+                    "com.sun.webkit.gcMaxHeapSize", 0);
+            final long gcNurserySize = Long.getLong(
+                    "com.sun.webkit.gcNurserySize", 0);
+            final boolean useConcurrentGC = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.useConcurrentGC", "true"));
+            final boolean gcSmallHeap = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.gcSmallHeap", "false"));
+            twkInitGarbageCollector(gcMaxHeapSize * 1024 * 1024,
+                    gcNurserySize * 1024 * 1024, useConcurrentGC, gcSmallHeap);
+
             // Initialize WTF, WebCore and JavaScriptCore.
-            twkInitWebCore(useJIT, useDFGJIT, useCSS3D);
+            twkInitWebCore(useJIT, useDFGJIT, useFTLJIT, useWebAssembly,
+                    useCSS3D, useCompositorThread);
+
+            // CPU time, in seconds, a script may run on the main thread
+            // before it is terminated. There is no limit unless it is set.
+            final String scriptTimeLimit = System.getProperty(
+                    "com.sun.webkit.scriptTimeLimit");
+            if (scriptTimeLimit != null) {
+                try {
+                    twkSetScriptTimeLimit(Double.parseDouble(scriptTimeLimit));
+                } catch (NumberFormatException e) {
+                    log.warning("Invalid com.sun.webkit.scriptTimeLimit: {0}", scriptTimeLimit);
+                }
+            }
+
+            // Maximum number of worker threads running at once, for the
+            // whole process. Workers started beyond it wait for a free
+            // thread. 0 means no limit.
+            final int maxWorkerThreads = Integer.getInteger(
+                    "com.sun.webkit.maxWorkerThreads", 0);
+            if (maxWorkerThreads > 0) {
+                twkSetMaximumWorkerThreadCount(maxWorkerThreads);
+            }
+
+            // Memory cache capacity, in MB, for the whole process
+            final long memoryCacheSize = Long.getLong(
+                    "com.sun.webkit.memoryCacheSize", 0);
+            if (memoryCacheSize > 0) {
+                MemoryCache.setCapacity(memoryCacheSize * 1024 * 1024);
+            }
+
+            // Release caches when memory runs low
+            final boolean handleMemoryPressure = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.handleMemoryPressure", "true"));
+            if (handleMemoryPressure) {
+                MemoryPressure.install();
+            }
 
             // Inform the native webkit code when either the JVM or the
             // JavaFX runtime is being shutdown
@@ -228,6 +338,7 @@ public final class WebPage {
             // Add dummy object to get notification as soon as it is collected
             // by the JVM GC.
             Disposer.addRecord(new Object(), WebPage::collectJSCGarbages);
+            MemoryStatistics.install();
             firstWebPageCreated = true;
         }
     }
@@ -265,6 +376,10 @@ public final class WebPage {
 
     private WCPageBackBuffer backbuffer;
     private List<WCRectangle> dirtyRects = new LinkedList<>();
+    // Accelerated layers are to be composited again, even with no dirty rects.
+    // The native side works out which parts of the page they changed.
+    private boolean compositingPending;
+    private boolean visible = true;
 
     private void addDirtyRect(WCRectangle toPaint) {
         if (toPaint.getWidth() <= 0 || toPaint.getHeight() <= 0) {
@@ -298,7 +413,7 @@ public final class WebPage {
     public boolean isDirty() {
         lockPage();
         try {
-            return !dirtyRects.isEmpty();
+            return !dirtyRects.isEmpty() || compositingPending || replayPending;
         } finally {
             unlockPage();
         }
@@ -315,14 +430,30 @@ public final class WebPage {
             // Clear the list so that the platform doesn't consider
             // the page dirty.
             dirtyRects.clear();
+            compositingPending = false;
+            replayPending = false;
             return;
         }
+        compositingPending = false;
         if (clip == null) {
             clip = new WCRectangle(0, 0, width, height);
         }
         List<WCRectangle> oldDirtyRects = dirtyRects;
         dirtyRects = new LinkedList<>();
+        long start = System.nanoTime();
         twkPrePaint(getPage());
+        long end = System.nanoTime();
+        statistics[WebPageStatistics.LAYOUT_TIME] += (end - start) / 1000;
+        if (PulseLogger.isNativeEnabled(PulseLogger.NATIVE_WEB)) {
+            PulseLogger.addNativeEvent(PulseLogger.NATIVE_WEB, "Layout", end - start, 0L);
+        }
+        if (replayPending) {
+            replayPending = false;
+            paintLog.finest("Replaying: {0}", retainedDisplayList);
+            retainedDisplayList.replay(currentFrame);
+            statistics[WebPageStatistics.REPLAYED_FRAMES]++;
+        }
+        start = end;
         while (!oldDirtyRects.isEmpty()) {
             WCRectangle r = oldDirtyRects.remove(0).intersection(clip);
             if (r.getWidth() <= 0 || r.getHeight() <= 0) {
@@ -333,16 +464,30 @@ public final class WebPage {
                     .createRenderQueue(r, true);
             twkUpdateContent(getPage(), rq, r.getIntX() - 1, r.getIntY() - 1,
                              r.getIntWidth() + 2, r.getIntHeight() + 2);
+            if (rq.isEmpty()) {
+                // Nothing is painted with accelerated compositing
+                retainedDisplayList.clear();
+            } else {
+                retainedDisplayList.add(rq, width, height);
+                countRenderQueue(rq);
+            }
             currentFrame.addRenderQueue(rq);
         }
+        end = System.nanoTime();
+        statistics[WebPageStatistics.PAINT_TIME] += (end - start) / 1000;
+        if (PulseLogger.isNativeEnabled(PulseLogger.NATIVE_WEB)) {
+            PulseLogger.addNativeEvent(PulseLogger.NATIVE_WEB, "Paint", end - start, 0L);
+        }
         {
             WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
                     .createRenderQueue(clip, false);
             twkPostPaint(getPage(), rq,
                          clip.getIntX(), clip.getIntY(),
                          clip.getIntWidth(), clip.getIntHeight());
+            countRenderQueue(rq);
             currentFrame.addRenderQueue(rq);
         }
+        statistics[WebPageStatistics.COMPOSITE_TIME] += (System.nanoTime() - end) / 1000;
 
         if (paintLog.isLoggable(Level.FINEST)) {
             paintLog.finest("Dirty rects processed, dirtyRects: {0}, currentFrame: {1}",
@@ -350,46 +495,90 @@ public final class WebPage {
         }
 
         if (currentFrame.getRQList().size() > 0) {
-            synchronized (frameQueue) {
-                paintLog.finest("About to update frame queue, frameQueue: {0}", frameQueue);
-
-                Iterator<RenderFrame> it = frameQueue.iterator();
-                while (it.hasNext()) {
-                    RenderFrame frame = it.next();
-                    for (WCRenderQueue rq : currentFrame.getRQList()) {
-                        WCRectangle rqRect = rq.getClip();
-                        if (rq.isOpaque()
-                                && rqRect.contains(frame.getEnclosingRect()))
-                        {
-                            paintLog.finest("Dropping: {0}", frame);
-                            frame.drop();
-                            it.remove();
-                            break;
-                        }
-                    }
-                }
+            queueRenderFrame(currentFrame);
+            currentFrame = new RenderFrame();
+            statistics[WebPageStatistics.FRAMES]++;
+        }
 
-                frameQueue.add(currentFrame);
-                currentFrame = new RenderFrame();
+        if (paintLog.isLoggable(Level.FINEST)) {
+            paintLog.finest("Exiting, dirtyRects: {0}, currentFrame: {1}",
+                    new Object[] {dirtyRects, currentFrame});
+        }
+    }
 
-                if (frameQueue.size() > MAX_FRAME_QUEUE_SIZE) {
-                    paintLog.finest("Frame queue exceeded maximum "
-                            + "size, clearing and requesting full repaint");
-                    dropRenderFrames();
-                    repaintAll();
-                }
+    private void countRenderQueue(WCRenderQueue rq) {
+        if (!rq.isEmpty()) {
+            statistics[WebPageStatistics.RENDER_QUEUES]++;
+            statistics[WebPageStatistics.RQ_BUFFERS] += rq.getBufferCount();
+            statistics[WebPageStatistics.RQ_BYTES] += rq.getSize();
+        }
+    }
 
-                paintLog.finest("Frame queue updated, frameQueue: {0}", frameQueue);
+    /**
+     * Returns the memory used by the page, along with the memory shared
+     * by all pages of the process.
+     */
+    public MemoryStatistics getMemoryStatistics() {
+        lockPage();
+        try {
+            if (isDisposed) {
+                return MemoryStatistics.forProcess();
             }
+            return MemoryStatistics.forPage(twkGetDocumentCount(getPage()),
+                    retainedDisplayList.size);
+        } finally {
+            unlockPage();
         }
+    }
 
-        if (paintLog.isLoggable(Level.FINEST)) {
-            paintLog.finest("Exiting, dirtyRects: {0}, currentFrame: {1}",
-                    new Object[] {dirtyRects, currentFrame});
+    /**
+     * Returns the rendering counters of the page.
+     */
+    public WebPageStatistics getStatistics() {
+        lockPage();
+        try {
+            return new WebPageStatistics(statistics, decodedOps);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    private void queueRenderFrame(RenderFrame renderFrame) {
+        synchronized (frameQueue) {
+            paintLog.finest("About to update frame queue, frameQueue: {0}", frameQueue);
+
+            Iterator<RenderFrame> it = frameQueue.iterator();
+            while (it.hasNext()) {
+                RenderFrame frame = it.next();
+                for (WCRenderQueue rq : renderFrame.getRQList()) {
+                    WCRectangle rqRect = rq.getClip();
+                    if (rq.isOpaque()
+                            && rqRect.contains(frame.getEnclosingRect()))
+                    {
+                        paintLog.finest("Dropping: {0}", frame);
+                        frame.drop();
+                        it.remove();
+                        break;
+                    }
+                }
+            }
+
+            frameQueue.add(renderFrame);
+
+            if (frameQueue.size() > MAX_FRAME_QUEUE_SIZE) {
+                paintLog.finest("Frame queue exceeded maximum "
+                        + "size, clearing and requesting full repaint");
+                dropRenderFrames();
+                redrawAll();
+            }
+
+            paintLog.finest("Frame queue updated, frameQueue: {0}", frameQueue);
         }
     }
 
     private void scroll(int x, int y, int w, int h, int dx, int dy) {
+        // The retained queues paint the content where it was before
+        retainedDisplayList.clear();
         if (!isBackgroundColorOpaque()) {
             if (paintLog.isLoggable(Level.FINEST)) {
                 paintLog.finest("rect=[" + x + ", " + y + " " + w + "x" + h +"]");
@@ -457,11 +646,14 @@ public final class WebPage {
         private int scrollDx, scrollDy;
         private final WCRectangle enclosingRect = new WCRectangle();
 
-        // Called on: Event thread only
+        // Called on: Event thread and compositor thread
         private void addRenderQueue(WCRenderQueue rq) {
             if (rq.isEmpty()) {
                 return;
             }
+            // The queue may also be in the retained display list, which
+            // must not dispose it before this frame is rendered
+            rq.retain();
             rqList.add(rq);
             WCRectangle rqRect = rq.getClip();
             if (enclosingRect.isEmpty()) {
@@ -479,15 +671,15 @@ public final class WebPage {
             return rqList;
         }
 
-        // Called on: Event thread only
+        // Called on: Event thread and compositor thread
         private WCRectangle getEnclosingRect() {
             return enclosingRect;
         }
 
-        // Called on: Event thread only
+        // Called on: Event thread and compositor thread
         private void drop() {
             for (WCRenderQueue rq : rqList) {
-                rq.dispose();
+                rq.release();
             }
             rqList.clear();
             enclosingRect.setFrame(0, 0, 0, 0);
@@ -504,6 +696,73 @@ public final class WebPage {
         }
     }
 
+    // The render queues recorded for the dirty rects of the page, kept after
+    // they are rendered. Decoded in order they paint the current content of
+    // the page, so a repaint that WebCore did not ask for can be done by
+    // rendering them again, without painting and encoding the page.
+    // A queue is dropped once a later queue covers it.
+    // Instances of this class may not be accessed and modified concurrently
+    // by multiple threads
+    private static final class RetainedDisplayList {
+        private final LinkedList<WCRenderQueue> rqList = new LinkedList<>();
+        private int size;
+        private boolean complete;
+
+        // Called on: Event thread
+        private void add(WCRenderQueue rq, int width, int height) {
+            size += rq.getSize();
+            if (size > MAX_RETAINED_SIZE) {
+                clear();
+                return;
+            }
+            WCRectangle rqRect = rq.getClip();
+            for (Iterator<WCRenderQueue> it = rqList.iterator(); it.hasNext();) {
+                WCRenderQueue old = it.next();
+                if (rqRect.contains(old.getClip())) {
+                    size -= old.getSize();
+                    old.release();
+                    it.remove();
+                }
+            }
+            rq.retain();
+            rqList.add(rq);
+            if (rqRect.contains(new WCRectangle(0, 0, width, height))) {
+                complete = true;
+            }
+        }
+
+        // Called on: Event thread
+        private boolean isComplete() {
+            return complete;
+        }
+
+        // Called on: Event thread
+        private void replay(RenderFrame frame) {
+            for (WCRenderQueue rq : rqList) {
+                frame.addRenderQueue(rq);
+            }
+        }
+
+        // Called on: Event thread
+        private void clear() {
+            for (WCRenderQueue rq : rqList) {
+                rq.release();
+            }
+            rqList.clear();
+            size = 0;
+            complete = false;
+        }
+
+        @Override
+        public String toString() {
+            return "RetainedDisplayList{"
+                    + "rqList=" + rqList + ", "
+                    + "size=" + size + ", "
+                    + "complete=" + complete
+                    + "}";
+        }
+    }
+
     // *************************************************************************
     // Callback API
     // *************************************************************************
@@ -671,6 +930,11 @@ public final class WebPage {
                 return;
             }
             updateDirty(toPaint);
+            if (SynchronousLoad.isInProgress()) {
+                // The dirty region is kept for the next pulse
+                paintLog.finest("updateContent() during a synchronous load");
+                return;
+            }
             updateRendering();
         } finally {
             unlockPage();
@@ -726,6 +990,41 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Renders the given area of the page offscreen and returns its pixels,
+     * premultiplied BGRA in native byte order, {@code ceil(w * scale)} by
+     * {@code ceil(h * scale)} of them. Unlike painting through a WebView,
+     * this needs no scene or window, so pages can also be rendered on the
+     * headless Monocle platform. The viewport is set with
+     * {@link #setBounds}.
+     * Executed on the Event Thread.
+     */
+    public ByteBuffer renderToPixels(int x, int y, int w, int h, float scale) {
+        if (w <= 0 || h <= 0 || !(scale > 0)) {
+            throw new IllegalArgumentException("empty area or invalid scale");
+        }
+        lockPage();
+        try {
+            if (isDisposed) {
+                log.fine("renderToPixels() request for a disposed web page.");
+                return null;
+            }
+            twkUpdateRendering(getPage());
+            WCGraphicsManager gm = WCGraphicsManager.getGraphicsManager();
+            WCRenderQueue rq = gm.createRenderQueue(new WCRectangle(x, y, w, h),
+                    !isBackgroundColorTransparent());
+            try {
+                twkUpdateContent(getPage(), rq, x, y, w, h);
+                return gm.renderToPixels(rq, x, y, scale,
+                        (int) Math.ceil(w * scale), (int) Math.ceil(h * scale));
+            } finally {
+                rq.dispose();
+            }
+        } finally {
+            unlockPage();
+        }
+    }
+
     /*
      * Executed on the Render Thread.
      */
@@ -736,7 +1035,7 @@ public final class WebPage {
                 if (!backbuffer.validate(width, height)) {
                     // We need to repaint the whole page on the next turn
                     Invoker.getInvoker().invokeOnEventThread(() -> {
-                        repaintAll();
+                        redrawAll();
                     });
                     return;
                 }
@@ -768,6 +1067,7 @@ public final class WebPage {
 
         paintLog.finest("Frames to render: {0}", framesToRender);
 
+        long start = System.nanoTime();
         for (RenderFrame frame : framesToRender) {
             paintLog.finest("Rendering: {0}", frame);
             for (WCRenderQueue rq : frame.getRQList()) {
@@ -782,10 +1082,13 @@ public final class WebPage {
                     }
                     gc.setClip(clip);
                 }
-                rq.decode(gc);
+                rq.decode(gc, decodedOps);
+                rq.release();
                 gc.restoreState();
             }
         }
+        statistics[WebPageStatistics.RENDERED_FRAMES] += framesToRender.size();
+        statistics[WebPageStatistics.DECODE_TIME] += (System.nanoTime() - start) / 1000;
         paintLog.finest("Exiting");
     }
 
@@ -814,6 +1117,10 @@ public final class WebPage {
                 log.fine("Focus event for a disposed web page.");
                 return;
             }
+            if (SynchronousLoad.isInProgress()) {
+                log.finest("Focus event during a synchronous load, ignored");
+                return;
+            }
             twkProcessFocusEvent(getPage(), fe.getID(), fe.getDirection());
 
         } finally {
@@ -829,6 +1136,10 @@ public final class WebPage {
                 log.fine("Key event for a disposed web page.");
                 return false;
             }
+            if (SynchronousLoad.isInProgress()) {
+                log.finest("Key event during a synchronous load, ignored");
+                return false;
+            }
             if (WCKeyEvent.filterEvent(ke)) {
                 log.finest("filtered");
                 return false;
@@ -851,6 +1162,10 @@ public final class WebPage {
                 log.fine("Mouse event for a disposed web page.");
                 return false;
             }
+            if (SynchronousLoad.isInProgress()) {
+                log.finest("Mouse event during a synchronous load, ignored");
+                return false;
+            }
             boolean result = !isDragConfirmed() //When Webkit informes FX about drag start, it waits
                                                 // for system DnD loop and not intereasted in
                                                 //intermediate mouse events that can change text selection.
@@ -860,7 +1175,7 @@ public final class WebPage {
                                         me.isShiftDown(), me.isControlDown(), me.isAltDown(), me.isMetaDown(), me.isPopupTrigger(),
                                         me.getWhen() / 1000.0);
             if (!isBackgroundColorOpaque()) {
-                repaintAll();
+                redrawAll();
             }
             return result;
         } finally {
@@ -876,13 +1191,17 @@ public final class WebPage {
                 log.fine("MouseWheel event for a disposed web page.");
                 return false;
             }
+            if (SynchronousLoad.isInProgress()) {
+                log.finest("MouseWheel event during a synchronous load, ignored");
+                return false;
+            }
             boolean result = twkProcessMouseWheelEvent(getPage(),
                     me.getX(), me.getY(), me.getScreenX(), me.getScreenY(),
                     me.getDeltaX(), me.getDeltaY(),
                     me.isShiftDown(), me.isControlDown(), me.isAltDown(), me.isMetaDown(),
                     me.getWhen() / 1000.0);
             if (!isBackgroundColorOpaque()) {
-                repaintAll();
+                redrawAll();
             }
             return result;
         } finally {
@@ -898,6 +1217,10 @@ public final class WebPage {
                 log.fine("InputMethod event for a disposed web page.");
                 return false;
             }
+            if (SynchronousLoad.isInProgress()) {
+                log.finest("InputMethod event during a synchronous load, ignored");
+                return false;
+            }
             switch (ie.getID()) {
                 case WCInputMethodEvent.INPUT_METHOD_TEXT_CHANGED:
                     return twkProcessInputTextChange(getPage(),
@@ -1081,6 +1404,7 @@ public final class WebPage {
                 backbuffer.deref();
                 backbuffer = null;
             }
+            retainedDisplayList.clear();
         } finally {
             unlockPage();
         }
@@ -1810,6 +2134,29 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Reports whether the page is shown on screen. A hidden page has its
+     * timers throttled, its animations suspended and is not painted.
+     */
+    public void setVisible(boolean visible) {
+        lockPage();
+        try {
+            if (isDisposed || this.visible == visible) {
+                return;
+            }
+            log.fine("setVisible: {0}", visible);
+            this.visible = visible;
+            if (visible) {
+                repaintAll();
+            } else {
+                dirtyRects.clear();
+            }
+            twkSetVisible(getPage(), visible);
+        } finally {
+            unlockPage();
+        }
+    }
+
     public void setEditable(boolean editable) {
         lockPage();
         try {
@@ -2005,6 +2352,32 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Returns the hashes of the links this page has marked as visited,
+     * for an application to persist and later pass to
+     * {@link #addVisitedLinkHashes}.
+     */
+    public int[] getVisitedLinkHashes() {
+        lockPage();
+        try {
+            return twkGetVisitedLinkHashes(getPage());
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Marks the links with the given hashes as visited.
+     */
+    public void addVisitedLinkHashes(int[] hashes) {
+        lockPage();
+        try {
+            twkAddVisitedLinkHashes(getPage(), hashes);
+        } finally {
+            unlockPage();
+        }
+    }
+
     public boolean getDeveloperExtrasEnabled() {
         lockPage();
         try {
@@ -2098,6 +2471,46 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Sets the directory IndexedDB databases are stored in. The directory
+     * is shared by all pages and only takes effect if no page has opened
+     * a database yet.
+     */
+    public void setIndexedDatabasePath(String path) {
+        lockPage();
+        try {
+            twkSetIndexedDatabasePath(path);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    public static boolean isBytecodeCacheEnabled() {
+        return BYTECODE_CACHE_ENABLED;
+    }
+
+    public void setBytecodeCachePath(String path) {
+        lockPage();
+        try {
+            twkSetBytecodeCachePath(path);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    public static boolean isDiskCacheEnabled() {
+        return DISK_CACHE_ENABLED;
+    }
+
+    public void setDiskCachePath(String path) {
+        lockPage();
+        try {
+            twkSetDiskCachePath(getPage(), path, DISK_CACHE_SIZE);
+        } finally {
+            unlockPage();
+        }
+    }
+
     public void setLocalStorageEnabled(boolean enabled) {
         lockPage();
         try {
@@ -2167,6 +2580,10 @@ public final class WebPage {
     private void fwkRepaint(int x, int y, int w, int h) {
         lockPage();
         try {
+            if (!visible) {
+                // Repainted as a whole once visible again
+                return;
+            }
             if (paintLog.isLoggable(Level.FINEST)) {
                 paintLog.finest("x: {0}, y: {1}, w: {2}, h: {3}",
                         new Object[] {x, y, w, h});
@@ -2177,6 +2594,53 @@ public final class WebPage {
         }
     }
 
+    /*
+     * Executed on the compositor thread.
+     */
+    private WCRenderQueue fwkCreateCompositedFrame(int x, int y, int w, int h) {
+        return WCGraphicsManager.getGraphicsManager()
+                .createRenderQueue(new WCRectangle(x, y, w, h), true);
+    }
+
+    /*
+     * Executed on the compositor thread.
+     */
+    private void fwkAddCompositedFrame(WCRenderQueue rq) {
+        lockPage();
+        try {
+            if (isDisposed) {
+                rq.dispose();
+                return;
+            }
+            // The frame covers the whole page, so it replaces whatever
+            // composited frames the render thread has not picked up yet
+            RenderFrame frame = new RenderFrame();
+            frame.addRenderQueue(rq);
+            if (frame.getRQList().isEmpty()) {
+                return;
+            }
+            queueRenderFrame(frame);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    // Called when a script has used up its CPU time budget
+    private boolean fwkShouldTerminateScript() {
+        log.warning("Terminating a script on {0} that exceeded its CPU time limit",
+                getURL(getMainFrame()));
+        return true;
+    }
+
+    private void fwkScheduleCompositing() {
+        lockPage();
+        try {
+            compositingPending = true;
+        } finally {
+            unlockPage();
+        }
+    }
+
     private void fwkScroll(int x, int y, int w, int h, int deltaX, int deltaY) {
         if (paintLog.isLoggable(Level.FINEST)) {
             paintLog.finest("Scroll: " + x + " " + y + " " + w + " " + h + "  " + deltaX + " " + deltaY);
@@ -2526,7 +2990,13 @@ public final class WebPage {
         repaintAll();
     }
 
-    private boolean fwkSendInspectorMessageToFrontend(String message) {
+    private void fwkSendInspectorMessagesToFrontend(String[] messages) {
+        for (String message : messages) {
+            sendInspectorMessageToFrontend(message);
+        }
+    }
+
+    private boolean sendInspectorMessageToFrontend(String message) {
         if (log.isLoggable(Level.FINE)) {
             log.fine("Sending inspector message to frontend, message: [{0}]",
                     message);
@@ -2542,6 +3012,17 @@ public final class WebPage {
         return result;
     }
 
+    /**
+     * Drops the screen properties cached natively for every page. Called
+     * when the screens change or a window moves, as either can change the
+     * screen a page is on.
+     */
+    public static void screenChanged() {
+        twkScreenChanged();
+    }
+
+    private static native void twkScreenChanged();
+
     // ---- DumpRenderTree support ---- //
 
     public static int getWorkerThreadCount() {
@@ -2587,10 +3068,23 @@ public final class WebPage {
     }
 
     private void repaintAll() {
+        retainedDisplayList.clear();
+        replayPending = false;
         dirtyRects.clear();
         addDirtyRect(new WCRectangle(0, 0, width, height));
     }
 
+    // Renders the whole page again when its content has not changed, e.g.
+    // after the back buffer was lost. The retained display list is
+    // replayed when it covers the page, otherwise the page is repainted.
+    void redrawAll() {
+        if (retainedDisplayList.isComplete()) {
+            replayPending = true;
+        } else {
+            repaintAll();
+        }
+    }
+
     private boolean isBackgroundColorTransparent() {
         return (backgroundIntRgba & 0x000000FF) == 0;
     }
@@ -2621,7 +3115,15 @@ public final class WebPage {
     // Native methods
     // *************************************************************************
 
-    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useCSS3D);
+    private static native void twkInitGarbageCollector(long maxHeapSize,
+                                                       long nurserySize,
+                                                       boolean useConcurrentGC,
+                                                       boolean useSmallHeap);
+    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT,
+                                              boolean useFTLJIT, boolean useWebAssembly,
+                                              boolean useCSS3D, boolean useCompositorThread);
+    private static native void twkSetScriptTimeLimit(double seconds);
+    private static native void twkSetMaximumWorkerThreadCount(int count);
     private native long twkCreatePage(boolean editable);
     private native void twkInit(long pPage, boolean usePlugins, float devicePixelScale);
     private native void twkDestroyPage(long pPage);
@@ -2727,10 +3229,14 @@ public final class WebPage {
     private native String twkQueryCommandValue(long page, String command);
     private native boolean twkIsEditable(long page);
     private native void twkSetEditable(long page, boolean editable);
+    private native void twkSetVisible(long page, boolean visible);
+    private native int twkGetDocumentCount(long page);
     private native String twkGetHtml(long pFrame);
 
     private native boolean twkGetUsePageCache(long page);
     private native void twkSetUsePageCache(long page, boolean usePageCache);
+    private native int[] twkGetVisitedLinkHashes(long page);
+    private native void twkAddVisitedLinkHashes(long page, int[] hashes);
     private native boolean twkGetDeveloperExtrasEnabled(long page);
     private native void twkSetDeveloperExtrasEnabled(long page,
                                                      boolean enabled);
@@ -2742,6 +3248,9 @@ public final class WebPage {
     private native String twkGetUserAgent(long page);
     private native void twkSetUserAgent(long page, String userAgent);
     private native void twkSetLocalStorageDatabasePath(long page, String path);
+    private native void twkSetIndexedDatabasePath(String path);
+    private native void twkSetBytecodeCachePath(String path);
+    private native void twkSetDiskCachePath(long page, String path, long capacity);
     private native void twkSetLocalStorageEnabled(long page, boolean enabled);
 
     private native int twkGetUnloadEventListenersCount(long pFrame);
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+import java.util.Arrays;
+
+/**
+ * A snapshot of the rendering counters of a {@link WebPage}. Times are in
+ * microseconds. The counters start when the page is created and are not
+ * reset.
+ */
+public final class WebPageStatistics {
+    // Layout of the values array, see WebPage
+    static final int FRAMES = 0;
+    static final int REPLAYED_FRAMES = 1;
+    static final int RENDER_QUEUES = 2;
+    static final int RQ_BUFFERS = 3;
+    static final int RQ_BYTES = 4;
+    static final int LAYOUT_TIME = 5;
+    static final int PAINT_TIME = 6;
+    static final int COMPOSITE_TIME = 7;
+    static final int RENDERED_FRAMES = 8;
+    static final int DECODE_TIME = 9;
+    static final int VALUE_COUNT = 10;
+
+    private final long[] values;
+    private final long[] opCounts;
+
+    WebPageStatistics(long[] values, long[] opCounts) {
+        this.values = values.clone();
+        this.opCounts = opCounts.clone();
+    }
+
+    /**
+     * Frames queued for rendering by update cycles.
+     */
+    public long getFrames() {
+        return values[FRAMES];
+    }
+
+    /**
+     * Frames that rendered the retained render queues again instead of
+     * painting the page.
+     */
+    public long getReplayedFrames() {
+        return values[REPLAYED_FRAMES];
+    }
+
+    /**
+     * Render queues painted for the dirty rects of the page.
+     */
+    public long getRenderQueues() {
+        return values[RENDER_QUEUES];
+    }
+
+    /**
+     * Buffers the native side flushed into the page render queues.
+     */
+    public long getRenderQueueBuffers() {
+        return values[RQ_BUFFERS];
+    }
+
+    /**
+     * Bytes encoded into the page render queues.
+     */
+    public long getRenderQueueBytes() {
+        return values[RQ_BYTES];
+    }
+
+    /**
+     * Time spent updating style and layout before painting.
+     */
+    public long getLayoutTime() {
+        return values[LAYOUT_TIME];
+    }
+
+    /**
+     * Time spent painting the dirty rects into render queues.
+     */
+    public long getPaintTime() {
+        return values[PAINT_TIME];
+    }
+
+    /**
+     * Time spent compositing accelerated layers and painting overlays
+     * after the dirty rects.
+     */
+    public long getCompositeTime() {
+        return values[COMPOSITE_TIME];
+    }
+
+    /**
+     * Frames decoded on the render thread.
+     */
+    public long getRenderedFrames() {
+        return values[RENDERED_FRAMES];
+    }
+
+    /**
+     * Time the render thread spent decoding frames.
+     */
+    public long getDecodeTime() {
+        return values[DECODE_TIME];
+    }
+
+    /**
+     * Commands decoded from the page render queues, indexed by the opcodes
+     * of {@link com.sun.webkit.graphics.GraphicsDecoder}.
+     */
+    public long[] getDecodedOps() {
+        return Arrays.copyOf(opCounts, opCounts.length);
+    }
+
+    @Override
+    public String toString() {
+        return "WebPageStatistics {frames: " + getFrames()
+                + " replayed: " + getReplayedFrames()
+                + " rendered: " + getRenderedFrames()
+                + " rq bytes: " + getRenderQueueBytes()
+                + " rq buffers: " + getRenderQueueBuffers()
+                + " layout: " + getLayoutTime()
+                + " paint: " + getPaintTime()
+                + " composite: " + getCompositeTime()
+                + " decode: " + getDecodeTime() + "}";
+    }
+}
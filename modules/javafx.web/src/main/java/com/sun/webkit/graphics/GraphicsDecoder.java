@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -62,7 +62,7 @@ public final class GraphicsDecoder  {
     @Native public final static int SCALE                  = 27;
     @Native public final static int SETSHADOW              = 28;
     @Native public final static int DRAWSTRING             = 29;
-    @Native public final static int DRAWSTRING_FAST        = 31;
+    @Native public final static int DRAWSTRING_INLINE      = 32;
     @Native public final static int DRAWWIDGET             = 33;
     @Native public final static int DRAWSCROLLBAR          = 34;
     @Native public final static int CLEARRECT_FFFF         = 36;
@@ -86,11 +86,36 @@ public final class GraphicsDecoder  {
     @Native public final static int SET_MITER_LIMIT        = 54;
     @Native public final static int SET_TEXT_MODE          = 55;
     @Native public final static int SET_PERSPECTIVE_TRANSFORM = 56;
+    @Native public final static int DRAW_FILTERED_IMAGE    = 57;
+    // Format version 2 forms of SET_PERSPECTIVE_TRANSFORM
+    @Native public final static int SET_PERSPECTIVE_IDENTITY  = 58;
+    @Native public final static int SET_PERSPECTIVE_TRANSLATE = 59;
+    @Native public final static int SET_PERSPECTIVE_AFFINE    = 60;
+    @Native public final static int FILL_RECTS             = 61;
+    @Native public final static int DRAW_IMAGE_RECTS       = 62;
+
+    // Length of an array of counters indexed by opcode
+    public final static int OPCODE_COUNT = 63;
+
+    // Filter types of DRAW_FILTERED_IMAGE
+    @Native public final static int FILTER_BLUR            = 0;
+    @Native public final static int FILTER_DROP_SHADOW     = 1;
+    @Native public final static int FILTER_OPACITY         = 2;
+    @Native public final static int FILTER_GRAYSCALE       = 3;
+    @Native public final static int FILTER_BRIGHTNESS      = 4;
+
+    // Gradient types of SET_FILL_GRADIENT and SET_STROKE_GRADIENT
+    @Native public final static int GRADIENT_LINEAR        = 0;
+    @Native public final static int GRADIENT_RADIAL        = 1;
+    @Native public final static int GRADIENT_CONIC         = 2;
 
     private final static PlatformLogger log =
             PlatformLogger.getLogger(GraphicsDecoder.class.getName());
 
-    static void decode(WCGraphicsManager gm, WCGraphicsContext gc, BufferData bdata) {
+    // Counts the decoded commands into opCounts, unless it is null
+    static void decode(WCGraphicsManager gm, WCGraphicsContext gc, BufferData bdata,
+                       long[] opCounts)
+    {
         if (gc == null || !gc.isValid()) {
             log.fine("GraphicsDecoder::decode : GC is " +
                     (gc == null ? "null" : " invalid"));
@@ -102,6 +127,9 @@ public final class GraphicsDecoder  {
         buf.order(ByteOrder.nativeOrder());
         while (buf.remaining() > 0) {
             int op = buf.getInt();
+            if (opCounts != null && op >= 0 && op < OPCODE_COUNT) {
+                opCounts[op]++;
+            }
             switch(op) {
                 case FILLRECT_FFFF:
                     gc.fillRect(
@@ -119,6 +147,11 @@ public final class GraphicsDecoder  {
                         buf.getFloat(),
                         getColor(buf));
                     break;
+                case FILL_RECTS: {
+                    Color color = getColor(buf);
+                    gc.fillRects(getFloats(buf, buf.getInt() * 4), color);
+                    break;
+                }
                 case FILL_ROUNDED_RECT:
                     gc.fillRoundedRect(
                         // base rectangle
@@ -160,10 +193,10 @@ public final class GraphicsDecoder  {
                     gc.setStrokeWidth(buf.getFloat());
                     break;
                 case SET_FILL_GRADIENT:
-                    gc.setFillGradient(getGradient(gc, buf));
+                    gc.setFillGradient(getGradient(gm, gc, buf));
                     break;
                 case SET_STROKE_GRADIENT:
-                    gc.setStrokeGradient(getGradient(gc, buf));
+                    gc.setStrokeGradient(getGradient(gm, gc, buf));
                     break;
                 case SET_LINE_DASH:
                     gc.setLineDash(buf.getFloat(), getFloatArray(buf));
@@ -201,6 +234,21 @@ public final class GraphicsDecoder  {
                         buf.getFloat(),
                         buf.getFloat());
                     break;
+                case DRAW_IMAGE_RECTS: {
+                    Object imgFrame = gm.getRef(buf.getInt());
+                    drawImages(gc, imgFrame, getFloats(buf, buf.getInt() * 8));
+                    break;
+                }
+                case DRAW_FILTERED_IMAGE:
+                    drawFilteredImage(gc,
+                        gm.getRef(buf.getInt()),
+                        //dest React
+                        buf.getFloat(),
+                        buf.getFloat(),
+                        buf.getFloat(),
+                        buf.getFloat(),
+                        getFilterOperations(buf));
+                    break;
                 case DRAWICON:
                     gc.drawIcon((WCIcon)gm.getRef(buf.getInt()),
                         buf.getInt(),
@@ -302,13 +350,8 @@ public final class GraphicsDecoder  {
                         buf.getInt(), buf.getInt(),     // from and to positions
                         buf.getFloat(), buf.getFloat());// (x,y) position
                     break;
-                case DRAWSTRING_FAST:
-                    gc.drawString(
-                        (WCFont) gm.getRef(buf.getInt()),
-                        bdata.getIntArray(buf.getInt()), //glyphs
-                        bdata.getFloatArray(buf.getInt()), //offsets
-                        buf.getFloat(),
-                        buf.getFloat());
+                case DRAWSTRING_INLINE:
+                    drawGlyphs(gc, (WCFont) gm.getRef(buf.getInt()), buf);
                     break;
                 case DRAWWIDGET:
                     gc.drawWidget((RenderTheme)(gm.getRef(buf.getInt())),
@@ -339,6 +382,19 @@ public final class GraphicsDecoder  {
                             buf.getFloat(), buf.getFloat(), buf.getFloat(), buf.getFloat(),
                             buf.getFloat(), buf.getFloat(), buf.getFloat(), buf.getFloat()));
                     break;
+                case SET_PERSPECTIVE_IDENTITY:
+                    gc.setPerspectiveTransform(getPerspectiveTransform(
+                            1f, 0f, 0f, 1f, 0f, 0f));
+                    break;
+                case SET_PERSPECTIVE_TRANSLATE:
+                    gc.setPerspectiveTransform(getPerspectiveTransform(
+                            1f, 0f, 0f, 1f, buf.getFloat(), buf.getFloat()));
+                    break;
+                case SET_PERSPECTIVE_AFFINE:
+                    gc.setPerspectiveTransform(getPerspectiveTransform(
+                            buf.getFloat(), buf.getFloat(), buf.getFloat(),
+                            buf.getFloat(), buf.getFloat(), buf.getFloat()));
+                    break;
                 case SET_TRANSFORM:
                     gc.setTransform(new WCTransform(
                             buf.getFloat(), buf.getFloat(), buf.getFloat(),
@@ -448,10 +504,73 @@ public final class GraphicsDecoder  {
         }
     }
 
+    private static void drawImages(WCGraphicsContext gc, Object imgFrame, float[] rects) {
+        WCImage img = WCImage.getImage(imgFrame);
+        if (img != null) {
+            // See drawImage()
+            try {
+                gc.drawImages(img, rects);
+            } catch (OutOfMemoryError error) {
+                error.printStackTrace();
+            }
+        }
+    }
+
+    private static void drawFilteredImage(
+            WCGraphicsContext gc,
+            Object imgFrame,
+            float dstx, float dsty, float dstw, float dsth,
+            WCFilterOperation[] filters)
+    {
+        WCImage img = WCImage.getImage(imgFrame);
+        if (img != null) {
+            // The filters may need intermediate textures, see drawImage()
+            try {
+                gc.drawFilteredImage(img, dstx, dsty, dstw, dsth, filters);
+            } catch (OutOfMemoryError error) {
+                error.printStackTrace();
+            }
+        }
+    }
+
+    private static WCFilterOperation[] getFilterOperations(ByteBuffer buf) {
+        WCFilterOperation[] filters = new WCFilterOperation[buf.getInt()];
+        for (int i = 0; i < filters.length; i++) {
+            filters[i] = new WCFilterOperation(
+                    buf.getInt(),
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    getColor(buf));
+        }
+        return filters;
+    }
+
     private static boolean getBoolean(ByteBuffer buf) {
         return 0 != buf.getInt();
     }
 
+    private static void drawGlyphs(WCGraphicsContext gc, WCFont font, ByteBuffer buf) {
+        float x = buf.getFloat();
+        float y = buf.getFloat();
+        int count = buf.getInt();
+        // The glyph run keeps the arrays, so they can't be shared between runs
+        int[] glyphs = new int[count];
+        float[] advances = new float[count];
+        buf.asIntBuffer().get(glyphs);
+        buf.position(buf.position() + count * Integer.BYTES);
+        buf.asFloatBuffer().get(advances);
+        buf.position(buf.position() + count * Float.BYTES);
+        gc.drawString(font, glyphs, advances, x, y);
+    }
+
+    private static float[] getFloats(ByteBuffer buf, int count) {
+        float[] array = new float[count];
+        buf.asFloatBuffer().get(array);
+        buf.position(buf.position() + count * Float.BYTES);
+        return array;
+    }
+
     private static float[] getFloatArray(ByteBuffer buf) {
         float[] array = new float[buf.getInt()];
         for (int i = 0; i < array.length; i++) {
@@ -466,6 +585,18 @@ public final class GraphicsDecoder  {
         return path;
     }
 
+    // Expands the 2D affine transform (a, b, c, d, e, f) to the 4x4 matrix
+    // SET_PERSPECTIVE_TRANSFORM carries
+    private static WCTransform getPerspectiveTransform(
+            float a, float b, float c, float d, float e, float f)
+    {
+        return new WCTransform(
+                a, b, 0, 0,
+                c, d, 0, 0,
+                0, 0, 1, 0,
+                e, f, 0, 1);
+    }
+
     private static WCPoint getPoint(ByteBuffer buf) {
         return new WCPoint(buf.getFloat(),
                            buf.getFloat());
@@ -485,27 +616,16 @@ public final class GraphicsDecoder  {
                          buf.getFloat());
     }
 
-    private static WCGradient getGradient(WCGraphicsContext gc, ByteBuffer buf) {
-        WCPoint p1 = getPoint(buf);
-        WCPoint p2 = getPoint(buf);
-        WCGradient gradient = getBoolean(buf)
-                ? gc.createRadialGradient(p1, buf.getFloat(), p2, buf.getFloat())
-                : gc.createLinearGradient(p1, p2);
-
-        boolean proportional = getBoolean(buf);
-        int spreadMethod = buf.getInt();
-        if (gradient != null) {
-            gradient.setProportional(proportional);
-            gradient.setSpreadMethod(spreadMethod);
-        }
-        int count = buf.getInt();
-        for (int i = 0; i < count; i++) {
-            Color color = getColor(buf);
-            float offset = buf.getFloat();
-            if (gradient != null) {
-                gradient.addStop(color, offset);
-            }
+    private static WCGradient getGradient(WCGraphicsManager gm, WCGraphicsContext gc, ByteBuffer buf) {
+        WCGradientStops stops = (WCGradientStops) gm.getRef(buf.getInt());
+        int type = buf.getInt();
+        // linear: x1, y1, x2, y2; radial: x1, y1, x2, y2, r1, r2;
+        // conic: cx, cy, angle and the bounds x, y, w, h to be painted
+        float[] geometry = new float[type == GRADIENT_RADIAL ? 6
+                                     : type == GRADIENT_CONIC ? 7 : 4];
+        for (int i = 0; i < geometry.length; i++) {
+            geometry[i] = buf.getFloat();
         }
-        return gradient;
+        return stops.getGradient(gc, type, geometry);
     }
 }
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.graphics;
+
+import com.sun.prism.paint.Color;
+
+/**
+ * One CSS filter of a composited layer, see {@link WCGraphicsContext#drawFilteredImage}.
+ */
+public final class WCFilterOperation {
+    private final int type;
+    private final float amount;
+    private final float dx;
+    private final float dy;
+    private final Color color;
+
+    /**
+     * @param type one of the {@code GraphicsDecoder.FILTER_*} constants
+     * @param amount the filter amount, or the standard deviation of a blur or shadow
+     * @param dx the horizontal shadow offset
+     * @param dy the vertical shadow offset
+     * @param color the shadow color
+     */
+    public WCFilterOperation(int type, float amount, float dx, float dy, Color color) {
+        this.type = type;
+        this.amount = amount;
+        this.dx = dx;
+        this.dy = dy;
+        this.color = color;
+    }
+
+    public int getType() {
+        return type;
+    }
+
+    public float getAmount() {
+        return amount;
+    }
+
+    public float getDx() {
+        return dx;
+    }
+
+    public float getDy() {
+        return dy;
+    }
+
+    public Color getColor() {
+        return color;
+    }
+}
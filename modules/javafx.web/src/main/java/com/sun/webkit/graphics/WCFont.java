@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,8 +25,20 @@
 
 package com.sun.webkit.graphics;
 
+import java.lang.annotation.Native;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
 public abstract class WCFont extends Ref {
 
+    /*
+     * Layout of the buffer passed to getGlyphCodes(ByteBuffer, int):
+     * up to GLYPH_BUFFER_CHARS chars at the start of the buffer, followed
+     * by the same number of int glyph codes at GLYPH_BUFFER_GLYPHS_OFFSET.
+     */
+    @Native public final static int GLYPH_BUFFER_CHARS = 512;
+    @Native public final static int GLYPH_BUFFER_GLYPHS_OFFSET = GLYPH_BUFFER_CHARS * Character.BYTES;
+
     public abstract Object getPlatformFont();
 
     public abstract WCFont deriveFont(float size);
@@ -35,10 +47,37 @@ public abstract class WCFont extends Ref {
 
     public abstract int[] getGlyphCodes(char[] chars);
 
+    /**
+     * Maps the first {@code count} chars stored in the buffer to glyph codes
+     * and stores them at {@code GLYPH_BUFFER_GLYPHS_OFFSET} in the buffer.
+     * The buffer uses the native byte order.
+     * NB: This method is called from native code!
+     */
+    public void getGlyphCodes(ByteBuffer buffer, int count) {
+        ByteBuffer buf = buffer.duplicate().order(ByteOrder.nativeOrder());
+        char[] chars = new char[count];
+        buf.asCharBuffer().get(chars);
+        int[] glyphs = getGlyphCodes(chars);
+        buf.position(GLYPH_BUFFER_GLYPHS_OFFSET);
+        buf.asIntBuffer().put(glyphs, 0, count);
+    }
+
     public abstract float getXHeight();
 
     public abstract double getGlyphWidth(int glyph);
 
+    /**
+     * Returns the widths of the given glyphs.
+     * NB: This method is called from native code!
+     */
+    public float[] getGlyphWidths(int[] glyphs) {
+        float[] widths = new float[glyphs.length];
+        for (int i = 0; i < glyphs.length; i++) {
+            widths[i] = (float) getGlyphWidth(glyphs[i]);
+        }
+        return widths;
+    }
+
     public abstract float[] getGlyphBoundingBox(int glyph);
 
     /**
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.graphics;
+
+import com.sun.prism.paint.Color;
+import java.util.Arrays;
+
+/**
+ * The color stops and the spread method of a native gradient. The native
+ * side creates one per gradient and refers to it from the render queue, so
+ * the stops are not sent with every fill. The gradient built for the last
+ * geometry is kept, which lets a gradient painted again at the same place
+ * reuse its platform paint.
+ */
+public final class WCGradientStops extends Ref {
+
+    private final int spreadMethod;
+    private final Color[] colors;
+    private final float[] offsets;
+
+    private int lastType = -1;
+    private float[] lastGeometry;
+    private WCGradient lastGradient;
+
+    WCGradientStops(int spreadMethod, float[] stops) {
+        this.spreadMethod = spreadMethod;
+        int count = stops.length / 5;
+        this.colors = new Color[count];
+        this.offsets = new float[count];
+        for (int i = 0; i < count; i++) {
+            int j = i * 5;
+            colors[i] = new Color(stops[j], stops[j + 1], stops[j + 2], stops[j + 3]);
+            offsets[i] = stops[j + 4];
+        }
+    }
+
+    /**
+     * Returns the gradient of the given {@code GraphicsDecoder.GRADIENT_*}
+     * type and geometry with these stops.
+     */
+    synchronized WCGradient getGradient(WCGraphicsContext gc, int type, float[] geometry) {
+        if (lastGradient != null && type == lastType && Arrays.equals(geometry, lastGeometry)) {
+            return lastGradient;
+        }
+
+        WCGradient gradient;
+        switch (type) {
+            case GraphicsDecoder.GRADIENT_RADIAL:
+                gradient = gc.createRadialGradient(
+                        new WCPoint(geometry[0], geometry[1]), geometry[4],
+                        new WCPoint(geometry[2], geometry[3]), geometry[5]);
+                break;
+            case GraphicsDecoder.GRADIENT_CONIC:
+                gradient = gc.createConicGradient(
+                        new WCPoint(geometry[0], geometry[1]), geometry[2],
+                        new WCRectangle(geometry[3], geometry[4], geometry[5], geometry[6]));
+                break;
+            default:
+                gradient = gc.createLinearGradient(
+                        new WCPoint(geometry[0], geometry[1]),
+                        new WCPoint(geometry[2], geometry[3]));
+                break;
+        }
+        if (gradient != null) {
+            gradient.setProportional(false);
+            gradient.setSpreadMethod(spreadMethod);
+            for (int i = 0; i < colors.length; i++) {
+                gradient.addStop(colors[i], offsets[i]);
+            }
+        }
+
+        lastType = type;
+        lastGeometry = geometry;
+        lastGradient = gradient;
+        return gradient;
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,6 +47,8 @@ public abstract class WCGraphicsContext {
     public static final int COMPOSITE_PLUS_LIGHTER        = 13;
 
     public abstract void fillRect(float x, float y, float w, float h, Color color);
+    // rects holds x, y, w, h of each rect
+    public abstract void fillRects(float[] rects, Color color);
     public abstract void clearRect(float x, float y, float w, float h);
     public abstract void setFillColor(Color color);
     public abstract void setFillGradient(WCGradient gradient);
@@ -76,6 +78,12 @@ public abstract class WCGraphicsContext {
     public abstract void drawImage(WCImage img,
                           float dstx, float dsty, float dstw, float dsth,
                           float srcx, float srcy, float srcw, float srch);
+    // rects holds the destination and the source rect of each draw
+    public abstract void drawImages(WCImage img, float[] rects);
+
+    public abstract void drawFilteredImage(WCImage img,
+                          float dstx, float dsty, float dstw, float dsth,
+                          WCFilterOperation[] filters);
 
     public abstract void drawIcon(WCIcon icon, int x, int y);
 
@@ -136,6 +144,13 @@ public abstract class WCGraphicsContext {
     public abstract WCGradient createLinearGradient(WCPoint p1, WCPoint p2);
     public abstract WCGradient createRadialGradient(WCPoint p1, float r1, WCPoint p2, float r2);
 
+    /**
+     * Creates a conic gradient around {@code center} that starts at
+     * {@code angle} radians clockwise from the top. {@code bounds} is the
+     * area that is painted with it.
+     */
+    public abstract WCGradient createConicGradient(WCPoint center, float angle, WCRectangle bounds);
+
     public abstract void flush();
 
     public abstract boolean isValid();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -67,6 +67,15 @@ public abstract class WCGraphicsManager {
 
     protected abstract WCRenderQueue createBufferedContextRQ(WCImage image);
 
+    /**
+     * Decodes the render queue into a new offscreen image, {@code w} by
+     * {@code h} pixels, and returns its pixels as premultiplied BGRA in
+     * native byte order. The coordinates of the queue are translated by
+     * ({@code -x}, {@code -y}) and then scaled by {@code scale}.
+     */
+    public abstract ByteBuffer renderToPixels(WCRenderQueue rq, int x, int y,
+                                              float scale, int w, int h);
+
     public abstract WCPageBackBuffer createPageBackBuffer();
 
     protected abstract WCFont getWCFont(String name, boolean bold, boolean italic, float size);
@@ -90,16 +99,47 @@ public abstract class WCGraphicsManager {
 
     protected abstract WCPath createWCPath(WCPath path);
 
+    /**
+     * Creates a path from segments built natively. The arrays are
+     * owned by the path.
+     *
+     * @param types segment types, the {@code WCPathIterator.SEG_*} constants
+     * @param numTypes number of segments
+     * @param coords coordinates of the segment points
+     * @param numCoords number of coordinates
+     */
+    protected abstract WCPath createWCPath(byte[] types, int numTypes,
+                                           float[] coords, int numCoords);
+
+    /*is called from native*/
+    private WCGradientStops fwkCreateGradientStops(int spreadMethod, float[] stops) {
+        return new WCGradientStops(spreadMethod, stops);
+    }
+
     protected abstract WCImage createWCImage(int w, int h);
 
     protected abstract WCImage createRTImage(int w, int h);
 
+    /**
+     * Returns the largest width and height of an image created by
+     * {@link #createRTImage}, or {@code 0} if the graphics device is not ready.
+     */
+    protected abstract int getMaximumTextureSize();
+
     public abstract WCImage getIconImage(String iconURL);
 
     public abstract Object toPlatformImage(WCImage image);
 
     protected abstract WCImageFrame createFrame(int w, int h, ByteBuffer data);
 
+    /**
+     * Encodes premultiplied BGRA pixels the same way as
+     * {@link WCImage#toData(String, double)}. It is called from a native
+     * worker thread, so it must not touch any toolkit state.
+     */
+    protected abstract byte[] encodePixels(int w, int h, ByteBuffer data,
+                                           String mimeType, double quality);
+
     public static String getResourceName(String key) {
         if (imageProperties == null) {
             imageProperties = ResourceBundle.getBundle(
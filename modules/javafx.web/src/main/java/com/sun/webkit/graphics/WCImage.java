@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -46,14 +46,33 @@ public abstract class WCImage extends Ref {
 
     public Object getPlatformImage() {return null;}
 
-    protected abstract byte[] toData(String mimeType);
+    /**
+     * Encodes the image. A {@code quality} out of the range [0, 1] selects
+     * the default quality of the encoder.
+     */
+    protected abstract byte[] toData(String mimeType, double quality);
 
     protected abstract String toDataURL(String mimeType);
 
     public ByteBuffer getPixelBuffer() {return null;}
 
+    /**
+     * Returns the pixels of a region of the image as rows of {@code w}
+     * pixels with no padding, or null if the region cannot be read on its
+     * own, in which case the caller uses {@link #getPixelBuffer()}.
+     */
+    public ByteBuffer getPixelBuffer(int x, int y, int w, int h) {return null;}
+
     protected void drawPixelBuffer() {}
 
+    /**
+     * Uploads a region of the pixel buffer, leaving the rest of the image
+     * untouched.
+     */
+    protected void drawPixelBuffer(int x, int y, int w, int h) {
+        drawPixelBuffer();
+    }
+
     public synchronized void setRQ(WCRenderQueue rq) {
         this.rq = rq;
     }
@@ -71,6 +90,10 @@ public abstract class WCImage extends Ref {
            : !rq.isEmpty();
     }
 
+    protected synchronized int getRQDecodeCount() {
+        return (rq == null) ? 0 : rq.getDecodeCount();
+    }
+
     public static WCImage getImage(Object imgFrame) {
         WCImage img = null;
         if (imgFrame instanceof WCImage) {
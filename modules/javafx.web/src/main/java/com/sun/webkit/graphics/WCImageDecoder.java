@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,9 +25,99 @@
 
 package com.sun.webkit.graphics;
 
+import java.lang.annotation.Native;
+import java.nio.ByteBuffer;
+import java.security.AccessController;
+import java.security.PrivilegedAction;
 
 public abstract class WCImageDecoder {
 
+    /**
+     * Indices into the array returned by {@link #getAsyncDecodingCounters()}.
+     * QUEUED and RUNNING are current values, the others are cumulative.
+     * Latencies include the time spent waiting for a decoding slot.
+     */
+    @Native public final static int ASYNC_DECODE_QUEUED = 0;
+    @Native public final static int ASYNC_DECODE_RUNNING = 1;
+    @Native public final static int ASYNC_DECODE_DECODED = 2;
+    @Native public final static int ASYNC_DECODE_TOTAL_NANOS = 3;
+    @Native public final static int ASYNC_DECODE_MAX_NANOS = 4;
+    @Native final static int ASYNC_DECODE_COUNTER_COUNT = 5;
+
+    /**
+     * Offsets of the per frame values passed to {@link #updateProperties}.
+     * The duration is in ms, a frame without metadata has a zero size.
+     */
+    @Native public final static int FRAME_WIDTH = 0;
+    @Native public final static int FRAME_HEIGHT = 1;
+    @Native public final static int FRAME_DURATION = 2;
+    @Native public final static int FRAME_COMPLETE = 3;
+    @Native public final static int FRAME_PROPERTY_COUNT = 4;
+
+    // The native ImageDecoderJava that caches the properties of this
+    // decoder, 0 if there is none.
+    private long nativeDecoder;
+
+    /*
+     * Maximum number of images decoded at the same time off the event
+     * thread. Nonpositive values select the native default.
+     */
+    private final static int ASYNC_DECODING_THREADS;
+
+    static {
+        @SuppressWarnings("removal")
+        int threads = AccessController.doPrivileged((PrivilegedAction<Integer>) () ->
+            Integer.getInteger("com.sun.webkit.image.asyncDecodingThreads", 0));
+        ASYNC_DECODING_THREADS = threads;
+    }
+
+    /*is called from native*/
+    private static int fwkGetAsyncDecodingThreads() {
+        return ASYNC_DECODING_THREADS;
+    }
+
+    /**
+     * Returns the process-wide counters of asynchronous image decoding,
+     * indexed by the {@code ASYNC_DECODE_*} constants.
+     */
+    public static long[] getAsyncDecodingCounters() {
+        long[] counters = new long[ASYNC_DECODE_COUNTER_COUNT];
+        twkGetAsyncDecodingCounters(counters);
+        return counters;
+    }
+
+    private static native void twkGetAsyncDecodingCounters(long[] counters);
+
+    /*is called from native*/
+    private synchronized void fwkSetNativeDecoder(long nativeDecoder) {
+        this.nativeDecoder = nativeDecoder;
+    }
+
+    /**
+     * Pushes the image properties to the native decoder, which answers
+     * WebCore's queries from them instead of calling back into Java.
+     * Implementations call this whenever the image size, the number of
+     * frames or the properties of a frame change.
+     *
+     * @param width image width, or 0 if not known yet
+     * @param height image height, or 0 if not known yet
+     * @param framesDecoded whether all data has been decoded into frames,
+     *                      until then the frame count may change
+     * @param frameProperties {@code FRAME_PROPERTY_COUNT} values per frame,
+     *                        indexed by the {@code FRAME_*} offsets
+     */
+    protected final synchronized void updateProperties(int width, int height,
+            boolean framesDecoded, int[] frameProperties)
+    {
+        if (nativeDecoder != 0) {
+            twkUpdateProperties(nativeDecoder, width, height, framesDecoded,
+                    frameProperties);
+        }
+    }
+
+    private static native void twkUpdateProperties(long nativeDecoder,
+            int width, int height, boolean framesDecoded, int[] frameProperties);
+
     /**
      * Receives a portion of image data.
      *
@@ -36,6 +126,24 @@ public abstract class WCImageDecoder {
      */
     protected abstract void addImageData(byte[] data);
 
+    /**
+     * Receives a portion of image data held in native memory.
+     * The buffer is only valid for the duration of the call and
+     * must not be modified or retained.
+     *
+     * @param data  a direct buffer over a portion of image data,
+     *              or {@code null} if all data received
+     */
+    protected void addImageData(ByteBuffer data) {
+        if (data == null) {
+            addImageData((byte[]) null);
+            return;
+        }
+        byte[] bytes = new byte[data.remaining()];
+        data.get(bytes);
+        addImageData(bytes);
+    }
+
     /**
      * Returns image size.
      */
@@ -54,6 +162,18 @@ public abstract class WCImageDecoder {
      */
     protected abstract WCImageFrame getFrame(int index);
 
+    /**
+     * Returns image frame at the specified index, decoded to fit
+     * the requested size. Implementations that cannot decode at a
+     * reduced size return the full size frame.
+     * @param index frame index
+     * @param width requested width, or 0 for the original width
+     * @param height requested height, or 0 for the original height
+     */
+    protected WCImageFrame getFrame(int index, int width, int height) {
+        return getFrame(index);
+    }
+
     /**
      * Returns frame duration in ms
      * @param index frame index
@@ -73,6 +193,15 @@ public abstract class WCImageDecoder {
      */
     protected abstract boolean getFrameCompleteStatus(int index);
 
+    /**
+     * Releases what is retained for frames WebCore has destroyed. Only
+     * the frame at the specified index is still displayed, the frames
+     * that follow it may have been decoded ahead.
+     * @param index index of the current frame
+     */
+    protected void clearFrameBufferCache(int index) {
+    }
+
     protected abstract void loadFromResource(String name);
 
     protected abstract void destroy();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.webkit.graphics;
 
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.webkit.Invoker;
+import java.util.concurrent.atomic.AtomicBoolean;
 
 public abstract class WCMediaPlayer extends Ref {
 
@@ -224,14 +225,21 @@ public abstract class WCMediaPlayer extends Ref {
         });
     }
 
+    // Set while a new frame notification is queued on the event thread.
+    // Frames that arrive before it runs are covered by the same repaint.
+    private final AtomicBoolean newFramePending = new AtomicBoolean();
+
     private Runnable newFrameNotifier = () -> {
+        newFramePending.set(false);
         if (nPtr != 0) {
             notifyNewFrame(nPtr);
         }
     };
 
     protected void notifyNewFrame() {
-        Invoker.getInvoker().invokeOnEventThread(newFrameNotifier);
+        if (newFramePending.compareAndSet(false, true)) {
+            Invoker.getInvoker().invokeOnEventThread(newFrameNotifier);
+        }
     }
 
     /** {@code ranges} array contains pairs [start,end] of the buffered times */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,8 +28,11 @@ package com.sun.webkit.graphics;
 import java.lang.annotation.Native;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
+import com.sun.javafx.logging.PulseLogger;
 import com.sun.webkit.Invoker;
 import java.nio.ByteBuffer;
+import java.security.AccessController;
+import java.security.PrivilegedAction;
 import java.util.HashMap;
 import java.util.LinkedList;
 import java.util.concurrent.atomic.AtomicInteger;
@@ -40,11 +43,55 @@ public abstract class WCRenderQueue extends Ref {
             PlatformLogger.getLogger(WCRenderQueue.class.getName());
     @Native public final static int MAX_QUEUE_SIZE = 0x80000;
 
+    /*
+     * Configuration of the native per-queue buffer pool. The buffer size is
+     * the capacity of a pooled buffer (the size class), the pool size is the
+     * maximum number of idle buffers a queue keeps for reuse. Nonpositive
+     * (resp. negative) values select the native defaults.
+     */
+    private final static int BUFFER_SIZE;
+    private final static int BUFFER_POOL_SIZE;
+
+    /*
+     * Versions of the encoding the native side writes to the queue. Version 1
+     * sends every transform as a full matrix, version 2 sends identity,
+     * translate and 2D affine transforms with dedicated, shorter commands.
+     * The decoder reads both, "com.sun.webkit.rq.formatVersion" selects the
+     * one written.
+     */
+    @Native public final static int FORMAT_VERSION_1 = 1;
+    @Native public final static int FORMAT_VERSION_2 = 2;
+    private final static int FORMAT_VERSION;
+
+    static {
+        @SuppressWarnings("removal")
+        int[] config = AccessController.doPrivileged((PrivilegedAction<int[]>) () -> new int[] {
+            Integer.getInteger("com.sun.webkit.rq.bufferSize", 0),
+            Integer.getInteger("com.sun.webkit.rq.bufferPoolSize", -1),
+            Integer.getInteger("com.sun.webkit.rq.formatVersion", FORMAT_VERSION_2)
+        });
+        BUFFER_SIZE = config[0];
+        BUFFER_POOL_SIZE = config[1];
+        FORMAT_VERSION = config[2] == FORMAT_VERSION_1 ? FORMAT_VERSION_1 : FORMAT_VERSION_2;
+    }
+
+    /**
+     * Indices into the array returned by {@link #getBufferPoolCounters()}.
+     */
+    public final static int POOL_ALLOCATED = 0;
+    public final static int POOL_REUSED = 1;
+    public final static int POOL_RECYCLED = 2;
+    public final static int POOL_DISCARDED = 3;
+    public final static int POOL_IDLE = 4;
+    private final static int POOL_COUNTER_COUNT = 5;
+
     private final LinkedList<BufferData> buffers = new LinkedList<>();
     private BufferData currentBuffer = new BufferData();
     private final WCRectangle clip;
     private int size = 0;
     private final boolean opaque;
+    private int decodeCount = 0;
+    private int retainCount = 0;
 
     // Associated graphics context (currently used to draw to a buffered image).
     protected final WCGraphicsContext gc;
@@ -65,6 +112,10 @@ public abstract class WCRenderQueue extends Ref {
         return size;
     }
 
+    public synchronized int getBufferCount() {
+        return buffers.size();
+    }
+
     public synchronized void addBuffer(ByteBuffer buffer) {
         if (log.isLoggable(Level.FINE) && buffers.isEmpty()) {
             log.fine("'{'WCRenderQueue{0}[{1}]",
@@ -73,7 +124,7 @@ public abstract class WCRenderQueue extends Ref {
         currentBuffer.setBuffer(buffer);
         buffers.addLast(currentBuffer);
         currentBuffer = new BufferData();
-        size += buffer.capacity();
+        size += buffer.limit();
         if (size > MAX_QUEUE_SIZE && gc!=null) {
             // It is isolated queue over the canvas image [image-gc!=null].
             // We need to flush the changes periodically
@@ -86,20 +137,44 @@ public abstract class WCRenderQueue extends Ref {
         return buffers.isEmpty();
     }
 
+    /**
+     * Returns the number of times queued drawing was decoded, which lets the
+     * owner of a cached copy of the target know whether it is still valid.
+     */
+    public synchronized int getDecodeCount() {
+        return decodeCount;
+    }
+
     public synchronized void decode(WCGraphicsContext gc) {
+        decode(gc, null);
+    }
+
+    /**
+     * Decodes the queue to {@code gc}, adding the number of commands of each
+     * opcode to {@code opCounts}, which is {@link GraphicsDecoder#OPCODE_COUNT}
+     * long.
+     */
+    public synchronized void decode(WCGraphicsContext gc, long[] opCounts) {
         if (gc == null || !gc.isValid()) {
             log.fine("WCRenderQueue::decode : GC is " + (gc == null ? "null" : " invalid"));
             return;
         }
 
+        if (!buffers.isEmpty()) {
+            decodeCount++;
+        }
+        long start = PulseLogger.nativeStart(PulseLogger.NATIVE_WEB);
         for (BufferData bdata : buffers) {
+            // A retained queue is decoded more than once
+            bdata.getBuffer().rewind();
             try {
                 GraphicsDecoder.decode(
-                    WCGraphicsManager.getGraphicsManager(), gc, bdata);
+                    WCGraphicsManager.getGraphicsManager(), gc, bdata, opCounts);
             } catch (RuntimeException e) {
                 e.printStackTrace(System.err);
             }
         }
+        PulseLogger.nativeEnd(PulseLogger.NATIVE_WEB, "RQ decode", start, size);
         dispose();
     }
 
@@ -127,15 +202,82 @@ public abstract class WCRenderQueue extends Ref {
         flush();
     }
 
-    private void fwkAddBuffer(ByteBuffer buffer) {
+    private void fwkAddBuffer(ByteBuffer buffer, int length) {
+        // Native buffers are pooled and the NIO wrapper spans the whole
+        // capacity, so the number of valid bytes is passed explicitly.
+        buffer.clear();
+        buffer.limit(length);
         addBuffer(buffer);
     }
 
+    /*is called from native*/
+    private static int fwkGetBufferSize() {
+        return BUFFER_SIZE;
+    }
+
+    /*is called from native*/
+    private static int fwkGetBufferPoolSize() {
+        return BUFFER_POOL_SIZE;
+    }
+
+    /*is called from native*/
+    private static int fwkGetFormatVersion() {
+        return FORMAT_VERSION;
+    }
+
+    /**
+     * Returns the process-wide counters of the native render queue buffer
+     * pools: buffers allocated, reused, recycled, discarded and currently
+     * idle, indexed by the {@code POOL_*} constants.
+     */
+    public static long[] getBufferPoolCounters() {
+        long[] counters = new long[POOL_COUNTER_COUNT];
+        twkGetBufferPoolCounters(counters);
+        return counters;
+    }
+
+    /**
+     * Returns the number of state commands (colors, stroke, alpha, composite,
+     * shadow, text mode) the native graphics contexts did not queue because
+     * the value was already in effect.
+     */
+    public static long getElidedStateOps() {
+        return twkGetElidedStateOps();
+    }
+
     public WCRectangle getClip() {
         return clip;
     }
 
+    /**
+     * Keeps the buffers after they are decoded, so that the recorded
+     * drawing can be decoded again. {@link #dispose()} has no effect on
+     * a retained queue until every {@code retain()} is matched by a
+     * {@link #release()}.
+     */
+    public synchronized void retain() {
+        retainCount++;
+    }
+
+    /**
+     * Ends a retention started by {@link #retain()}, the queue is disposed
+     * when no retention is left.
+     */
+    public synchronized void release() {
+        if (retainCount > 0) {
+            retainCount--;
+        }
+        dispose();
+    }
+
+    public synchronized boolean isRetained() {
+        return retainCount > 0;
+    }
+
     public synchronized void dispose() {
+        if (retainCount > 0) {
+            return;
+        }
         int n = buffers.size();
         if (n > 0) {
             int i = 0;
@@ -148,6 +290,12 @@ public abstract class WCRenderQueue extends Ref {
                 twkRelease(arr);
             });
             size = 0;
+            if (log.isLoggable(Level.FINEST)) {
+                long[] c = getBufferPoolCounters();
+                log.finest("buffer pool: allocated={0}, reused={1}, idle={2}, elided state ops={3}",
+                        new Object[]{c[POOL_ALLOCATED], c[POOL_REUSED], c[POOL_IDLE],
+                                getElidedStateOps()});
+            }
             if (log.isLoggable(Level.FINE)) {
                 log.fine("'}'WCRenderQueue{0}[{1}]",
                         new Object[]{hashCode(), idCountObj.decrementAndGet()});
@@ -163,19 +311,13 @@ public abstract class WCRenderQueue extends Ref {
 
     private native void twkRelease(Object[] bufs);
 
-    /*is called from native*/
-    private int refString(String str) {
-        return currentBuffer.addString(str);
-    }
+    private static native void twkGetBufferPoolCounters(long[] counters);
 
-    /*is called from native*/
-    private int refIntArr(int[] arr) {
-        return currentBuffer.addIntArray(arr);
-    }
+    private static native long twkGetElidedStateOps();
 
     /*is called from native*/
-    private int refFloatArr(float[] arr) {
-        return currentBuffer.addFloatArray(arr);
+    private int refString(String str) {
+        return currentBuffer.addString(str);
     }
 
     public boolean isOpaque() {
@@ -186,7 +328,8 @@ public abstract class WCRenderQueue extends Ref {
         return "WCRenderQueue{"
                 + "clip=" + clip + ", "
                 + "size=" + size + ", "
-                + "opaque=" + opaque
+                + "opaque=" + opaque + ", "
+                + "retainCount=" + retainCount
                 + "}";
     }
 }
@@ -196,10 +339,6 @@ final class BufferData {
     private final AtomicInteger idCount = new AtomicInteger(0);
     private final HashMap<Integer,String> strMap =
             new HashMap<>();
-    private final HashMap<Integer,int[]> intArrMap =
-            new HashMap<>();
-    private final HashMap<Integer,float[]> floatArrMap =
-            new HashMap<>();
 
     private ByteBuffer buffer;
 
@@ -207,26 +346,6 @@ final class BufferData {
         return idCount.incrementAndGet();
     }
 
-    int addIntArray(int[] a) {
-        int id = createID();
-        intArrMap.put(id, a);
-        return id;
-    }
-
-    int[] getIntArray(int id) {
-        return intArrMap.get(id);
-    }
-
-    int addFloatArray(float[] a) {
-        int id = createID();
-        floatArrMap.put(id, a);
-        return id;
-    }
-
-    float[] getFloatArray(int id) {
-        return floatArrMap.get(id);
-    }
-
     int addString(String s) {
         int id = createID();
         strMap.put(id, s);
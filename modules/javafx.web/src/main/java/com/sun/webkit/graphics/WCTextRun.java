@@ -33,4 +33,10 @@ public interface WCTextRun {
     int getGlyph(int index);
     int getGlyphCount();
     int getStart();
+
+    /**
+     * Fills the glyph codes, char offsets and x advances of all glyphs
+     * of the run. The arrays must hold at least getGlyphCount() elements.
+     */
+    void getGlyphData(int[] glyphs, int[] charOffsets, float[] advances);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,12 +35,51 @@ import java.util.ArrayList;
 import java.util.HashMap;
 import java.util.List;
 import java.util.Map;
+import java.util.concurrent.atomic.AtomicInteger;
 
 final class CookieJar {
 
+    // Set once native code has asked for cookies, so that the native
+    // library is known to be loaded
+    private static volatile boolean notifyNative;
+
+    // The cookie manager whose contents the native cache holds
+    private static volatile CookieManager cachedManager;
+
+    private static final AtomicInteger lookupCount = new AtomicInteger();
+
     private CookieJar() {
     }
 
+    /**
+     * Invalidates the native cookie cache. Cached cookie strings are
+     * served until the next change or until {@code nextExpiryTime}, and
+     * only while {@code manager} is the default cookie handler.
+     */
+    static void cookiesChanged(CookieManager manager, long nextExpiryTime) {
+        if (notifyNative && manager == getDefaultHandler()) {
+            cachedManager = manager;
+            twkCookiesChanged(manager, nextExpiryTime);
+        }
+    }
+
+    static int test_getLookupCount() {
+        return lookupCount.get();
+    }
+
+    @SuppressWarnings("removal")
+    private static CookieHandler getDefaultHandler() {
+        return AccessController.doPrivileged((PrivilegedAction<CookieHandler>) CookieHandler::getDefault);
+    }
+
+    /**
+     * Called by native code on every lookup. Cached cookie strings are only
+     * served while the handler returned here is the one they came from.
+     */
+    private static CookieHandler fwkGetHandler() {
+        return getDefaultHandler();
+    }
+
     private static void fwkPut(String url, String cookie) {
         @SuppressWarnings("removal")
         CookieHandler handler =
@@ -66,9 +105,21 @@ final class CookieJar {
     }
 
     private static String fwkGet(String url, boolean includeHttpOnlyCookies) {
-        @SuppressWarnings("removal")
-        CookieHandler handler =
-            AccessController.doPrivileged((PrivilegedAction<CookieHandler>) CookieHandler::getDefault);
+        lookupCount.incrementAndGet();
+        CookieHandler handler = getDefaultHandler();
+        if (handler instanceof CookieManager) {
+            notifyNative = true;
+            if (handler != cachedManager) {
+                // The default handler has been replaced since the cache
+                // was filled
+                ((CookieManager) handler).cookiesChanged();
+            }
+        } else {
+            // Changes made through other handlers cannot be observed,
+            // so nothing may be cached
+            cachedManager = null;
+            twkCookiesChanged(null, Long.MIN_VALUE);
+        }
         if (handler != null) {
             URI uri = null;
             try {
@@ -120,4 +171,6 @@ final class CookieJar {
                 uri.getRawSchemeSpecificPart(),
                 uri.getRawFragment());
     }
+
+    private static native void twkCookiesChanged(CookieHandler handler, long nextExpiryTime);
 }
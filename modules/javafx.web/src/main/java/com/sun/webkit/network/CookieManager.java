@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -46,7 +46,7 @@ public final class CookieManager extends CookieHandler {
             PlatformLogger.getLogger(CookieManager.class.getName());
 
 
-    private final CookieStore store = new CookieStore();
+    private final CookieStore store = new CookieStore(this);
 
 
     /**
@@ -126,6 +126,15 @@ public final class CookieManager extends CookieHandler {
         return sb.length() > 0 ? sb.toString() : null;
     }
 
+    /**
+     * Reports the current state of the store to the native cookie cache.
+     */
+    void cookiesChanged() {
+        synchronized (store) {
+            store.changed();
+        }
+    }
+
     /**
      * {@inheritDoc}
      */
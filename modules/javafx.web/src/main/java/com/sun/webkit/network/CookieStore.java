@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -67,11 +67,23 @@ final class CookieStore {
      */
     private int totalCount = 0;
 
+    /**
+     * The earliest expiry time of the cookies currently in the store.
+     */
+    private long nextExpiryTime = Long.MAX_VALUE;
+
+
+    /**
+     * The cookie manager that owns the store.
+     */
+    private final CookieManager owner;
+
 
     /**
      * Creates a new {@code CookieStore}.
      */
-    CookieStore() {
+    CookieStore(CookieManager owner) {
+        this.owner = owner;
     }
 
 
@@ -111,6 +123,7 @@ final class CookieStore {
         }
 
         ArrayList<Cookie> result = new ArrayList<>();
+        int countBefore = totalCount;
 
         String domain = hostname;
         while (domain.length() > 0) {
@@ -132,6 +145,9 @@ final class CookieStore {
         for (Cookie cookie : result) {
             cookie.setLastAccessTime(currentTime);
         }
+        if (totalCount != countBefore || currentTime > nextExpiryTime) {
+            changed();
+        }
 
         logger.finest("result: {0}", result);
         return result;
@@ -221,6 +237,24 @@ final class CookieStore {
                 log("Cookie updated", cookie, bucket);
             }
         }
+        changed();
+    }
+
+    /**
+     * Recomputes the earliest expiry time and tells the native cookie
+     * cache that the contents of the store have changed.
+     */
+    void changed() {
+        long next = Long.MAX_VALUE;
+        for (Map<Cookie,Cookie> bucket : buckets.values()) {
+            for (Cookie cookie : bucket.values()) {
+                if (!cookie.hasExpired()) {
+                    next = Math.min(next, cookie.getExpiryTime());
+                }
+            }
+        }
+        nextExpiryTime = next;
+        CookieJar.cookiesChanged(owner, next);
     }
 
     /**
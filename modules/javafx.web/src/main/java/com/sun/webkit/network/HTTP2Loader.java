@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,9 +27,9 @@ package com.sun.webkit.network;
 
 import com.sun.javafx.logging.PlatformLogger.Level;
 import com.sun.javafx.logging.PlatformLogger;
-import com.sun.javafx.tk.Toolkit;
 import com.sun.webkit.Invoker;
 import com.sun.webkit.LoadListenerClient;
+import com.sun.webkit.SynchronousLoad;
 import com.sun.webkit.WebPage;
 import java.io.FileNotFoundException;
 import java.io.IOException;
@@ -58,13 +58,13 @@ import java.time.Duration;
 import java.util.Arrays;
 import java.util.List;
 import java.util.Locale;
+import java.util.Map;
 import java.util.Vector;
 import java.util.concurrent.CompletableFuture;
 import java.util.concurrent.CompletionStage;
 import java.util.concurrent.Flow;
 import java.util.concurrent.atomic.AtomicBoolean;
 import java.util.concurrent.atomic.AtomicLong;
-import java.util.stream.Collectors;
 import java.util.stream.Stream;
 import java.util.zip.GZIPInputStream;
 import java.util.zip.InflaterInputStream;
@@ -85,6 +85,7 @@ final class HTTP2Loader extends URLLoaderBase {
     private String method;
     private final String headers;
     private FormDataElement[] formDataElements;
+    private final int priority;
     private final long data;
     private volatile boolean canceled = false;
 
@@ -110,6 +111,12 @@ final class HTTP2Loader extends URLLoaderBase {
        BUFFER = ByteBuffer.allocateDirect(bufSize);
     }
 
+    // Urgency of the Priority request header (RFC 9218) for each WebCore
+    // ResourceLoadPriority, from VeryLow to VeryHigh. HttpClient has no API
+    // for HTTP/2 stream priorities, but servers that schedule streams by
+    // urgency read this header.
+    private static final int[] PRIORITY_URGENCY = { 6, 5, 3, 1, 0 };
+
     /**
      * Creates a new {@code HTTP2Loader}.
      */
@@ -120,6 +127,7 @@ final class HTTP2Loader extends URLLoaderBase {
               String method,
               String headers,
               FormDataElement[] formDataElements,
+              int priority,
               long data) {
         if (url.startsWith("http://") || url.startsWith("https://")) {
             return new HTTP2Loader(
@@ -130,6 +138,7 @@ final class HTTP2Loader extends URLLoaderBase {
                 method,
                 headers,
                 formDataElements,
+                priority,
                 data);
         }
         return null;
@@ -158,6 +167,18 @@ final class HTTP2Loader extends URLLoaderBase {
                      .toArray(String[]::new);
     }
 
+    private String getPriorityHeader() {
+        if (priority < 0 || priority >= PRIORITY_URGENCY.length) {
+            return null;
+        }
+        for (String header : headers.split("\n")) {
+            if (header.regionMatches(true, 0, "priority:", 0, 9)) {
+                return null; // set by WebCore
+            }
+        }
+        return "u=" + PRIORITY_URGENCY[priority];
+    }
+
     private URI toURI() throws MalformedURLException {
         URI uriObj;
         try {
@@ -364,6 +385,7 @@ final class HTTP2Loader extends URLLoaderBase {
               String method,
               String headers,
               FormDataElement[] formDataElements,
+              int priority,
               long data)
     {
         this.webPage = webPage;
@@ -372,6 +394,7 @@ final class HTTP2Loader extends URLLoaderBase {
         this.method = method;
         this.headers = headers;
         this.formDataElements = formDataElements;
+        this.priority = priority;
         this.data = data;
 
         URI uri;
@@ -383,13 +406,17 @@ final class HTTP2Loader extends URLLoaderBase {
             return;
         }
 
-        final var request = HttpRequest.newBuilder()
+        final var requestBuilder = HttpRequest.newBuilder()
                                .uri(uri)
                                .headers(getRequestHeaders()) // headers from WebCore
                                .headers(getCustomHeaders()) // headers set by us
                                .version(Version.HTTP_2)  // this is the default
-                               .method(method, getFormDataPublisher())
-                               .build();
+                               .method(method, getFormDataPublisher());
+        final String priorityHeader = getPriorityHeader();
+        if (priorityHeader != null) {
+            requestBuilder.setHeader("Priority", priorityHeader);
+        }
+        final var request = requestBuilder.build();
 
         final BodyHandler<Void> bodyHandler = rsp -> {
             if(!handleRedirectionIfNeeded(rsp)) {
@@ -424,26 +451,22 @@ final class HTTP2Loader extends URLLoaderBase {
     }
 
     private void callBackIfNotCanceled(final Runnable r) {
-        Invoker.getInvoker().invokeOnEventThread(() -> {
+        final Runnable callBack = () -> {
             if (!canceled) {
                 r.run();
             }
-        });
+        };
+        // Callbacks of asynchronous loads are held back while the event
+        // thread waits for a synchronous load
+        Invoker.getInvoker().invokeOnEventThread(asynchronous
+                ? () -> SynchronousLoad.runOrDefer(callBack)
+                : callBack);
     }
 
     private void waitForRequestToComplete() {
         // Wait for the response using nested event loop. Once the response
         // arrives, nested event loop will be terminated.
-        final Object key = new Object();
-        this.response.handle((r, th) -> {
-            Invoker.getInvoker().invokeOnEventThread(() ->
-                Toolkit.getToolkit().exitNestedEventLoop(key, null));
-            return null;
-        });
-        Toolkit.getToolkit().enterNestedEventLoop(key);
-        // No need to join, nested event loop takes care of
-        // blocking the caller until response arrives.
-        // this.response.join();
+        SynchronousLoad.waitFor(this.response);
     }
 
     private boolean handleRedirectionIfNeeded(final HttpResponse.ResponseInfo rsp) {
@@ -476,12 +499,15 @@ final class HTTP2Loader extends URLLoaderBase {
     }
 
     private static String getHeadersAsString(final HttpResponse.ResponseInfo rsp) {
-        return rsp.headers()
-                  .map()
-                  .entrySet()
-                  .stream()
-                  .map(e -> String.format("%s:%s", e.getKey(), e.getValue().stream().collect(Collectors.joining(","))))
-                  .collect(Collectors.joining("\n")) + "\n";
+        final StringBuilder sb = new StringBuilder();
+        for (Map.Entry<String, List<String>> e : rsp.headers().map().entrySet()) {
+            sb.append(e.getKey()).append(':');
+            sb.append(String.join(",", e.getValue())).append('\n');
+        }
+        if (sb.length() == 0) {
+            sb.append('\n');
+        }
+        return sb.toString();
     }
 
     private void willSendRequest(final HttpResponse.ResponseInfo rsp) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,18 +27,28 @@ package com.sun.webkit.network;
 
 import static com.sun.webkit.network.URLs.newURL;
 
+import java.net.InetAddress;
 import java.net.MalformedURLException;
+import java.net.Proxy;
+import java.net.ProxySelector;
+import java.net.URI;
+import java.net.UnknownHostException;
 import java.security.AccessController;
 import java.security.PrivilegedAction;
 import java.util.Arrays;
+import java.util.List;
+import java.util.concurrent.CompletableFuture;
 import java.util.concurrent.LinkedBlockingQueue;
 import java.util.concurrent.ThreadFactory;
 import java.util.concurrent.ThreadPoolExecutor;
 import java.util.concurrent.TimeUnit;
 import java.util.concurrent.atomic.AtomicInteger;
+import java.util.function.Consumer;
 
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
+import com.sun.webkit.Invoker;
+import com.sun.webkit.SynchronousLoad;
 import com.sun.webkit.WebPage;
 import java.security.Permission;
 
@@ -57,16 +67,30 @@ final class NetworkContext {
      */
     private static final long THREAD_POOL_KEEP_ALIVE_TIME = 10000L;
 
+    /**
+     * The number of threads that resolve host names. Lookups block, so they
+     * have threads of their own instead of holding up the loaders.
+     */
+    private static final int DNS_RESOLVER_POOL_SIZE = 4;
+
+    /**
+     * The number of lookups that may wait for a resolver thread before
+     * prefetches are dropped.
+     */
+    private static final int MAX_PENDING_DNS_LOOKUPS = 32;
+
     /**
      * The default value of the "http.maxConnections" system property.
      */
     private static final int DEFAULT_HTTP_MAX_CONNECTIONS = 5;
 
     /**
-     * The default value of the maximum concurrent connections for
-     * new gen HTTP2 client
+     * The default value of the maximum concurrent requests per host for
+     * new gen HTTP2 client. Requests to an HTTP/2 server are multiplexed
+     * over one connection, so this is kept below the 100 concurrent streams
+     * servers commonly allow rather than at an HTTP/1.1 connection count.
      */
-    private static final int DEFAULT_HTTP2_MAX_CONNECTIONS = 20;
+    private static final int DEFAULT_HTTP2_MAX_CONNECTIONS = 64;
 
     /**
      * The buffer size for the shared pool of byte buffers.
@@ -78,6 +102,11 @@ final class NetworkContext {
      */
     private static final ThreadPoolExecutor threadPool;
 
+    /**
+     * The thread pool used to resolve host names.
+     */
+    private static final ThreadPoolExecutor dnsResolverPool;
+
     /**
      * Can use HTTP2Loader
      */
@@ -89,9 +118,18 @@ final class NetworkContext {
                 THREAD_POOL_KEEP_ALIVE_TIME,
                 TimeUnit.MILLISECONDS,
                 new LinkedBlockingQueue<Runnable>(),
-                new URLLoaderThreadFactory());
+                new NetworkThreadFactory("URL-Loader-"));
         threadPool.allowCoreThreadTimeOut(true);
 
+        dnsResolverPool = new ThreadPoolExecutor(
+                DNS_RESOLVER_POOL_SIZE,
+                DNS_RESOLVER_POOL_SIZE,
+                THREAD_POOL_KEEP_ALIVE_TIME,
+                TimeUnit.MILLISECONDS,
+                new LinkedBlockingQueue<Runnable>(),
+                new NetworkThreadFactory("DNS-Resolver-"));
+        dnsResolverPool.allowCoreThreadTimeOut(true);
+
         @SuppressWarnings("removal")
         boolean tmp = AccessController.doPrivileged((PrivilegedAction<Boolean>) () -> {
             // Use HTTP2 by default on JDK 12 or later
@@ -143,6 +181,7 @@ final class NetworkContext {
                                      String method,
                                      String headers,
                                      FormDataElement[] formDataElements,
+                                     int priority,
                                      long data)
     {
         if (logger.isLoggable(Level.FINEST)) {
@@ -152,6 +191,7 @@ final class NetworkContext {
                     "url: [%s], " +
                     "method: [%s], " +
                     "formDataElements: %s, " +
+                    "priority: [%d], " +
                     "data: [0x%016X], " +
                     "headers:%n%s",
                     webPage,
@@ -160,6 +200,7 @@ final class NetworkContext {
                     method,
                     formDataElements != null
                             ? Arrays.asList(formDataElements) : "[null]",
+                    priority,
                     data,
                     Util.formatHeaders(headers)));
         }
@@ -173,12 +214,18 @@ final class NetworkContext {
                 method,
                 headers,
                 formDataElements,
+                priority,
                 data);
             if (loader != null) {
                 return loader;
             }
         }
 
+        // A synchronous load from the network runs in the thread pool while
+        // the event thread waits in a nested event loop. Local loads are
+        // quick enough to run on the event thread itself.
+        final boolean waitInNestedEventLoop = !asynchronous
+                && (url.startsWith("http://") || url.startsWith("https://"));
         URLLoader loader = new URLLoader(
                 webPage,
                 byteBufferPool,
@@ -188,7 +235,10 @@ final class NetworkContext {
                 headers,
                 formDataElements,
                 data);
-        if (asynchronous) {
+        if (waitInNestedEventLoop) {
+            SynchronousLoad.waitFor(CompletableFuture.runAsync(loader, threadPool));
+            return null;
+        } else if (asynchronous) {
             threadPool.submit(loader);
             if (logger.isLoggable(Level.FINEST)) {
                 logger.finest(
@@ -229,24 +279,123 @@ final class NetworkContext {
     }
 
     /**
-     * Thread factory for URL loader threads.
+     * Returns {@code true} if connections to an arbitrary HTTP host would
+     * go through a proxy, in which case WebCore skips DNS prefetching.
+     */
+    private static boolean fwkIsUsingProxy() {
+        @SuppressWarnings("removal")
+        boolean usingProxy = AccessController.doPrivileged((PrivilegedAction<Boolean>) () -> {
+            ProxySelector selector = ProxySelector.getDefault();
+            if (selector == null) {
+                return false;
+            }
+            List<Proxy> proxies = selector.select(URI.create("http://www.example.com/"));
+            for (Proxy proxy : proxies) {
+                if (proxy.type() != Proxy.Type.DIRECT) {
+                    return true;
+                }
+            }
+            return false;
+        });
+        return usingProxy;
+    }
+
+    /**
+     * Resolves a host name in the background so that the result is in the
+     * InetAddress cache by the time a loader connects to the host.
+     * Returns {@code false} if the prefetch was dropped.
+     */
+    private static boolean fwkPrefetchDNS(String hostname) {
+        return prefetchDNS(hostname,
+                () -> Invoker.getInvoker().invokeOnEventThread(() -> twkDidPrefetchDNS(hostname)));
+    }
+
+    /**
+     * Resolves a host name in the background and reports the addresses
+     * back to WebCore.
+     */
+    private static void fwkResolveDNS(String hostname, long identifier) {
+        resolveDNS(hostname,
+                addresses -> Invoker.getInvoker().invokeOnEventThread(() -> twkDidResolveDNS(identifier, addresses)));
+    }
+
+    /**
+     * Prefetches are hints, they are dropped rather than queued behind
+     * lookups that are waiting already. Otherwise {@code done} is called
+     * on a resolver thread once the lookup has completed.
+     */
+    static boolean prefetchDNS(String hostname, Runnable done) {
+        if (dnsResolverPool.getQueue().size() >= MAX_PENDING_DNS_LOOKUPS) {
+            if (logger.isLoggable(Level.FINE)) {
+                logger.fine("Dropping the prefetch of [" + hostname + "]");
+            }
+            return false;
+        }
+        dnsResolverPool.execute(() -> {
+            lookup(hostname);
+            done.run();
+        });
+        return true;
+    }
+
+    /**
+     * Calls {@code callback} on a resolver thread with the addresses of the
+     * host, or with {@code null} if it could not be resolved.
+     */
+    static void resolveDNS(String hostname, Consumer<String[]> callback) {
+        dnsResolverPool.execute(() -> {
+            InetAddress[] addresses = lookup(hostname);
+            String[] result = null;
+            if (addresses != null) {
+                result = new String[addresses.length];
+                for (int i = 0; i < addresses.length; i++) {
+                    result[i] = addresses[i].getHostAddress();
+                }
+            }
+            callback.accept(result);
+        });
+    }
+
+    private static InetAddress[] lookup(String hostname) {
+        @SuppressWarnings("removal")
+        InetAddress[] addresses = AccessController.doPrivileged((PrivilegedAction<InetAddress[]>) () -> {
+            try {
+                return InetAddress.getAllByName(hostname);
+            } catch (UnknownHostException | SecurityException ex) {
+                if (logger.isLoggable(Level.FINE)) {
+                    logger.fine("Could not resolve [" + hostname + "]: " + ex);
+                }
+                return null;
+            }
+        });
+        return addresses;
+    }
+
+    private static native void twkDidPrefetchDNS(String hostname);
+
+    private static native void twkDidResolveDNS(long identifier, String[] addresses);
+
+    /**
+     * Thread factory for URL loader and DNS resolver threads.
      */
-    private static final class URLLoaderThreadFactory implements ThreadFactory {
+    private static final class NetworkThreadFactory implements ThreadFactory {
         private final ThreadGroup group;
+        private final String namePrefix;
         private final AtomicInteger index = new AtomicInteger(1);
 
         // Need to assert the modifyThread and modifyThreadGroup permission when
-        // creating the thread from the URLLoaderThreadFactory, so we can
+        // creating the thread from the NetworkThreadFactory, so we can
         // create the thread with the desired ThreadGroup.
         // Note that this is needed when running with a security manager
         private static final Permission modifyThreadGroupPerm = new RuntimePermission("modifyThreadGroup");
         private static final Permission modifyThreadPerm = new RuntimePermission("modifyThread");
 
-        private URLLoaderThreadFactory() {
+        private NetworkThreadFactory(String namePrefix) {
             @SuppressWarnings("removal")
             SecurityManager sm = System.getSecurityManager();
             group = (sm != null) ? sm.getThreadGroup()
                     : Thread.currentThread().getThreadGroup();
+            this.namePrefix = namePrefix;
         }
 
         @SuppressWarnings("removal")
@@ -256,7 +405,7 @@ final class NetworkContext {
             return
                 AccessController.doPrivileged((PrivilegedAction<Thread>) () -> {
                     Thread t = new Thread(group, r,
-                            "URL-Loader-" + index.getAndIncrement());
+                            namePrefix + index.getAndIncrement());
                     t.setDaemon(true);
                     if (t.getPriority() != Thread.NORM_PRIORITY) {
                         t.setPriority(Thread.NORM_PRIORITY);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,9 +43,12 @@ import java.net.SocketException;
 import java.net.URI;
 import java.net.URISyntaxException;
 import java.net.UnknownHostException;
+import java.nio.ByteBuffer;
 import java.security.AccessController;
 import java.security.PrivilegedAction;
 import java.util.List;
+import java.util.Queue;
+import java.util.concurrent.ConcurrentLinkedQueue;
 import java.util.concurrent.SynchronousQueue;
 import java.util.concurrent.ThreadFactory;
 import java.util.concurrent.ThreadPoolExecutor;
@@ -69,6 +72,9 @@ final class SocketStreamHandle {
 
     private enum State {ACTIVE, CLOSE_REQUESTED, DISPOSED}
 
+    private static final int RECEIVE_BUFFER_SIZE = 8192;
+    private static final int MAX_POOLED_BUFFERS = 4;
+
     private final String host;
     private final int port;
     private final boolean ssl;
@@ -78,6 +84,13 @@ final class SocketStreamHandle {
     private volatile State state = State.ACTIVE;
     private volatile boolean connected;
 
+    // Direct buffers handed to native code with received data, reused
+    // once native code has consumed them
+    private final Queue<ByteBuffer> receiveBuffers =
+            new ConcurrentLinkedQueue<>();
+    // Accessed on the event thread only
+    private byte[] sendBuffer = new byte[0];
+
     private SocketStreamHandle(String host, int port, boolean ssl,
                                WebPage webPage, long data)
     {
@@ -130,15 +143,18 @@ final class SocketStreamHandle {
             logger.finest("{0} connected", this);
             didOpen();
             InputStream is = socket.getInputStream();
+            byte[] buffer = new byte[RECEIVE_BUFFER_SIZE];
             while (true) {
-                byte[] buffer = new byte[8192];
                 int n = is.read(buffer);
                 if(n > 0) {
                     if (logger.isLoggable(Level.FINEST)) {
                         logger.finest(format("%s received len: [%d], data:%s",
-                                this, n, dump(buffer, n)));
+                                this, n, dump(ByteBuffer.wrap(buffer), n)));
                     }
-                    didReceiveData(buffer, n);
+                    ByteBuffer receiveBuffer = acquireReceiveBuffer();
+                    receiveBuffer.put(buffer, 0, n);
+                    receiveBuffer.flip();
+                    didReceiveData(receiveBuffer, n);
                 } else {
                     logger.finest("{0} connection closed by remote host", this);
                     break;
@@ -286,15 +302,24 @@ final class SocketStreamHandle {
         }
     }
 
-    private int fwkSend(byte[] buffer) {
+    /**
+     * Sends the contents of a direct buffer that wraps native memory.
+     * The buffer is only valid for the duration of the call.
+     */
+    private int fwkSend(ByteBuffer buffer) {
+        int len = buffer.remaining();
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(format("%s sending len: [%d], data:%s",
-                    this, buffer.length, dump(buffer, buffer.length)));
+                    this, len, dump(buffer, len)));
         }
         if (connected) {
             try {
-                socket.getOutputStream().write(buffer);
-                return buffer.length;
+                if (sendBuffer.length < len) {
+                    sendBuffer = new byte[Math.max(len, RECEIVE_BUFFER_SIZE)];
+                }
+                buffer.get(sendBuffer, 0, len);
+                socket.getOutputStream().write(sendBuffer, 0, len);
+                return len;
             } catch (IOException ex) {
                 logger.finest(format("%s exception", this), ex);
                 didFail(0, "I/O error");
@@ -332,14 +357,32 @@ final class SocketStreamHandle {
         });
     }
 
-    private void didReceiveData(final byte[] buffer, final int len) {
+    private void didReceiveData(final ByteBuffer buffer, final int len) {
         Invoker.getInvoker().postOnEventThread(() -> {
-            if (state == State.ACTIVE) {
-                notifyDidReceiveData(buffer, len);
+            try {
+                if (state == State.ACTIVE) {
+                    notifyDidReceiveData(buffer, len);
+                }
+            } finally {
+                releaseReceiveBuffer(buffer);
             }
         });
     }
 
+    private ByteBuffer acquireReceiveBuffer() {
+        ByteBuffer buffer = receiveBuffers.poll();
+        return buffer != null
+                ? buffer
+                : ByteBuffer.allocateDirect(RECEIVE_BUFFER_SIZE);
+    }
+
+    private void releaseReceiveBuffer(ByteBuffer buffer) {
+        buffer.clear();
+        if (receiveBuffers.size() < MAX_POOLED_BUFFERS) {
+            receiveBuffers.offer(buffer);
+        }
+    }
+
     private void didFail(final int errorCode, final String errorDescription) {
         Invoker.getInvoker().postOnEventThread(() -> {
             if (state == State.ACTIVE) {
@@ -361,7 +404,7 @@ final class SocketStreamHandle {
         twkDidOpen(data);
     }
 
-    private void notifyDidReceiveData(byte[] buffer, int len) {
+    private void notifyDidReceiveData(ByteBuffer buffer, int len) {
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(format("%s, len: [%d], data:%s",
                     this, len, dump(buffer, len)));
@@ -384,13 +427,14 @@ final class SocketStreamHandle {
     }
 
     private static native void twkDidOpen(long data);
-    private static native void twkDidReceiveData(byte[] buffer, int len,
+    private static native void twkDidReceiveData(ByteBuffer buffer, int len,
                                                  long data);
     private static native void twkDidFail(int errorCode,
                                           String errorDescription, long data);
     private static native void twkDidClose(long data);
 
-    private static String dump(byte[] buffer, int len) {
+    private static String dump(ByteBuffer buffer, int len) {
+        int offset = buffer.position();
         StringBuilder sb = new StringBuilder();
         int i = 0;
         while (i < len) {
@@ -398,7 +442,7 @@ final class SocketStreamHandle {
             StringBuilder c2 = new StringBuilder();
             for (int k = 0; k < 16; k++, i++) {
                 if (i < len) {
-                    int b = buffer[i] & 0xff;
+                    int b = buffer.get(offset + i) & 0xff;
                     c1.append(format("%02x ", b));
                     c2.append((b >= 0x20 && b <= 0x7e) ? (char) b : '.');
                 } else {
@@ -30,6 +30,7 @@ import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
 import com.sun.webkit.Invoker;
 import com.sun.webkit.LoadListenerClient;
+import com.sun.webkit.SynchronousLoad;
 import com.sun.webkit.WebPage;
 import static com.sun.webkit.network.URLs.newURL;
 import java.io.EOFException;
@@ -802,9 +803,13 @@ final class URLLoader extends URLLoaderBase implements Runnable {
 
     private void callBack(Runnable runnable) {
         if (asynchronous) {
-            Invoker.getInvoker().invokeOnEventThread(runnable);
+            // Held back while the event thread waits for a synchronous load
+            Invoker.getInvoker().invokeOnEventThread(() ->
+                    SynchronousLoad.runOrDefer(runnable));
         } else {
-            runnable.run();
+            // Synchronous loads from the network run off the event thread,
+            // see NetworkContext.fwkLoad()
+            Invoker.getInvoker().invokeOnEventThread(runnable);
         }
     }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@ package com.sun.webkit.perf;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.webkit.graphics.WCFont;
 import com.sun.webkit.graphics.WCTextRun;
+import java.nio.ByteBuffer;
 
 public final class WCFontPerfLogger extends WCFont {
     private static final PlatformLogger log =
@@ -82,6 +83,13 @@ public final class WCFontPerfLogger extends WCFont {
         return res;
     }
 
+    @Override
+    public void getGlyphCodes(ByteBuffer buffer, int count) {
+        logger.resumeCount("GETGLYPHCODES");
+        fnt.getGlyphCodes(buffer, count);
+        logger.suspendCount("GETGLYPHCODES");
+    }
+
     @Override
     public float getXHeight() {
         logger.resumeCount("GETXHEIGHT");
@@ -98,6 +106,14 @@ public final class WCFontPerfLogger extends WCFont {
         return res;
     }
 
+    @Override
+    public float[] getGlyphWidths(int[] glyphs) {
+        logger.resumeCount("GETGLYPHWIDTHS");
+        float[] res = fnt.getGlyphWidths(glyphs);
+        logger.suspendCount("GETGLYPHWIDTHS");
+        return res;
+    }
+
     @Override
     public float[] getGlyphBoundingBox(int glyph) {
         logger.resumeCount("GETGLYPHBOUNDINGBOX");
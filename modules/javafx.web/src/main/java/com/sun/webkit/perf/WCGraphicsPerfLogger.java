@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,7 @@ import com.sun.prism.paint.Color;
 import com.sun.webkit.graphics.Ref;
 import com.sun.webkit.graphics.RenderTheme;
 import com.sun.webkit.graphics.ScrollBarTheme;
+import com.sun.webkit.graphics.WCFilterOperation;
 import com.sun.webkit.graphics.WCFont;
 import com.sun.webkit.graphics.WCGradient;
 import com.sun.webkit.graphics.WCGraphicsContext;
@@ -99,6 +100,13 @@ public final class WCGraphicsPerfLogger extends WCGraphicsContext {
         logger.suspendCount("FILLRECT_FFFFI");
     }
 
+    @Override
+    public void fillRects(float[] rects, Color color) {
+        logger.resumeCount("FILL_RECTS");
+        gc.fillRects(rects, color);
+        logger.suspendCount("FILL_RECTS");
+    }
+
     @Override public void fillRoundedRect(float x, float y, float w, float h,
             float topLeftW, float topLeftH, float topRightW, float topRightH,
             float bottomLeftW, float bottomLeftH, float bottomRightW, float bottomRightH,
@@ -238,6 +246,22 @@ public final class WCGraphicsPerfLogger extends WCGraphicsContext {
         logger.suspendCount("DRAWIMAGE");
     }
 
+    @Override
+    public void drawImages(WCImage img, float[] rects) {
+        logger.resumeCount("DRAW_IMAGE_RECTS");
+        gc.drawImages(img, rects);
+        logger.suspendCount("DRAW_IMAGE_RECTS");
+    }
+
+    @Override
+    public void drawFilteredImage(WCImage img,
+                                  float dstx, float dsty, float dstw, float dsth,
+                                  WCFilterOperation[] filters) {
+        logger.resumeCount("DRAWFILTEREDIMAGE");
+        gc.drawFilteredImage(img, dstx, dsty, dstw, dsth, filters);
+        logger.suspendCount("DRAWFILTEREDIMAGE");
+    }
+
     @Override
     public void drawIcon(WCIcon icon, int x, int y) {
         logger.resumeCount("DRAWICON");
@@ -496,4 +520,12 @@ public final class WCGraphicsPerfLogger extends WCGraphicsContext {
         logger.suspendCount("CREATE_RADIAL_GRADIENT");
         return gradient;
     }
+
+    @Override
+    public WCGradient createConicGradient(WCPoint center, float angle, WCRectangle bounds) {
+        logger.resumeCount("CREATE_CONIC_GRADIENT");
+        WCGradient gradient = gc.createConicGradient(center, angle, bounds);
+        logger.suspendCount("CREATE_CONIC_GRADIENT");
+        return gradient;
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,9 +28,12 @@ package com.sun.webkit.text;
 import java.nio.ByteBuffer;
 import java.nio.CharBuffer;
 import java.nio.charset.Charset;
+import java.nio.charset.StandardCharsets;
 import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.List;
 import java.util.Map;
+import java.util.Set;
 
 final class TextCodec {
     private final Charset charset;
@@ -39,6 +42,17 @@ final class TextCodec {
     private static final Map<String, String> RE_MAP = Map.of(
         "ISO-10646-UCS-2", "UTF-16");
 
+    // Charsets WebKit decodes natively (TextCodecUTF8, TextCodecUTF16 and
+    // TextCodecLatin1), these are never handed out to the native side.
+    private static final Set<String> NATIVE_CHARSETS = Set.of(
+        StandardCharsets.UTF_8.name(),
+        StandardCharsets.UTF_16.name(),
+        StandardCharsets.UTF_16BE.name(),
+        StandardCharsets.UTF_16LE.name(),
+        StandardCharsets.ISO_8859_1.name(),
+        StandardCharsets.US_ASCII.name(),
+        "windows-1252");
+
     /**
      * This could throw a runtime exception (see the documentation for the
      * Charset.forName.)  JNI code should handle the exception.
@@ -54,6 +68,27 @@ final class TextCodec {
         return encoded;
     }
 
+    /**
+     * Returns true if ASCII text, other than the ESC, SO and SI controls
+     * stateful charsets use to switch modes, encodes to the same bytes.
+     * The native side then decodes such input without calling into Java.
+     */
+    private boolean isASCIICompatible() {
+        if (!charset.canEncode()) {
+            return false;
+        }
+        byte[] ascii = new byte[0x80 - 3];
+        int n = 0;
+        for (int c = 0; c < 0x80; c++) {
+            if (c != 0x0E && c != 0x0F && c != 0x1B) {
+                ascii[n++] = (byte) c;
+            }
+        }
+        String text = new String(ascii, StandardCharsets.US_ASCII);
+        return Arrays.equals(ascii, encode(text.toCharArray()))
+                && text.equals(decode(ascii));
+    }
+
     private String decode(byte[] data) {
         CharBuffer cb = charset.decode(ByteBuffer.wrap(data));
         char[] decoded = new char[cb.remaining()];
@@ -74,6 +109,9 @@ final class TextCodec {
         Map<String, Charset> ac = Charset.availableCharsets();
         for (Map.Entry<String, Charset> entry: ac.entrySet()) {
             String e = entry.getKey();
+            if (NATIVE_CHARSETS.contains(e)) {
+                continue;
+            }
             encodings.add(e);
             encodings.add(e);
             Charset c = entry.getValue();
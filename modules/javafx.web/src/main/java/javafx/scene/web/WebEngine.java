@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1025,10 +1025,19 @@ final public class WebEngine {
             try {
                 userDataDir = DirectoryLock.canonicalize(userDataDir);
                 File localStorageDir = new File(userDataDir, "localstorage");
-                File[] dirs = new File[] {
-                    userDataDir,
-                    localStorageDir,
-                };
+                File indexedDbDir = new File(userDataDir, "indexeddb");
+                File bytecodeCacheDir = new File(userDataDir, "bytecodecache");
+                File diskCacheDir = new File(userDataDir, "httpcache");
+                List<File> dirs = new ArrayList<>(List.of(
+                        userDataDir,
+                        localStorageDir,
+                        indexedDbDir));
+                if (WebPage.isBytecodeCacheEnabled()) {
+                    dirs.add(bytecodeCacheDir);
+                }
+                if (WebPage.isDiskCacheEnabled()) {
+                    dirs.add(diskCacheDir);
+                }
                 for (File dir : dirs) {
                     createDirectories(dir);
                     // Additional security check to make sure the caller
@@ -1042,6 +1051,13 @@ final public class WebEngine {
 
                 page.setLocalStorageDatabasePath(localStorageDir.getPath());
                 page.setLocalStorageEnabled(true);
+                page.setIndexedDatabasePath(indexedDbDir.getPath());
+                if (WebPage.isBytecodeCacheEnabled()) {
+                    page.setBytecodeCachePath(bytecodeCacheDir.getPath());
+                }
+                if (WebPage.isDiskCacheEnabled()) {
+                    page.setDiskCachePath(diskCacheDir.getPath());
+                }
 
                 logger.fine("User data directory [{0}] has "
                         + "been applied successfully", displayString);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1040,6 +1040,8 @@ final public class WebView extends Parent {
         if (page == null) return;
 
         boolean reallyVisible = isTreeReallyVisible();
+        // Hidden pages get their timers throttled and animations suspended
+        page.setVisible(reallyVisible);
 
         if (reallyVisible) {
             if (page.isDirty()) {
@@ -1050,6 +1052,9 @@ final public class WebView extends Parent {
                     NodeHelper.markDirty(this, DirtyBits.WEBVIEW_VIEW);
                 }
                 SceneHelper.setAllowPGAccess(false);
+            } else if (page.isRepaintPending()) {
+                // Frames queued by the compositor thread
+                NodeHelper.markDirty(this, DirtyBits.WEBVIEW_VIEW);
             }
         } else {
             page.dropRenderFrames();
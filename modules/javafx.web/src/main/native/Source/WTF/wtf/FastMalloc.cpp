@@ -284,7 +284,15 @@ TryMallocReturnValue tryFastRealloc(void* p, size_t n)
     return realloc(p, n);
 }
 
+#if OS(WINDOWS)
+void releaseFastMallocFreeMemory()
+{
+    // Coalesces free blocks of the CRT heap and returns them to the system.
+    _heapmin();
+}
+#else
 void releaseFastMallocFreeMemory() { }
+#endif
 void releaseFastMallocFreeMemoryForThisThread() { }
 
 FastMallocStatistics fastMallocStatistics()
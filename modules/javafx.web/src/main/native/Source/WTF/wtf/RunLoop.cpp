@@ -26,6 +26,7 @@
 #include "config.h"
 #include <wtf/RunLoop.h>
 
+#include <wtf/MonotonicTime.h>
 #include <wtf/NeverDestroyed.h>
 #include <wtf/Ref.h>
 #include <wtf/StdLibExtras.h>
@@ -62,6 +63,12 @@ void RunLoop::initializeMain()
 {
     RELEASE_ASSERT(!s_mainRunLoop);
     s_mainRunLoop = &RunLoop::current();
+#if PLATFORM(JAVA) && USE(GENERIC_EVENT_LOOP)
+    // The FX event loop never enters run() on the main thread
+    Thread::create("WebKit RunLoop Timers", [] {
+        RunLoop::main().runMainThreadTimerService();
+    })->detach();
+#endif
 }
 
 auto RunLoop::runLoopHolder() -> ThreadSpecific<Holder>&
@@ -137,11 +144,24 @@ void RunLoop::performWork()
         m_currentIteration = std::exchange(m_nextIteration, { });
     }
 
+#if PLATFORM(JAVA)
+    // The main run loop shares the FX thread with input and rendering, the
+    // rest of the functions go to the next dispatch once the slice is used up.
+    static constexpr Seconds mainThreadDispatchSlice { 8_ms };
+    MonotonicTime sliceEnd = this == &RunLoop::main() ? MonotonicTime::now() + mainThreadDispatchSlice : MonotonicTime::infinity();
+#endif
+
     while (!m_currentIteration.isEmpty()) {
         if (m_isFunctionDispatchSuspended) {
             didSuspendFunctions = true;
             break;
         }
+#if PLATFORM(JAVA)
+        if (sliceEnd != MonotonicTime::infinity() && MonotonicTime::now() >= sliceEnd) {
+            didSuspendFunctions = true;
+            break;
+        }
+#endif
 
         auto function = m_currentIteration.takeFirst();
         function();
@@ -228,7 +248,7 @@ void RunLoop::assertIsCurrent() const
 }
 #endif
 
-#if PLATFORM(JAVA)
+#if PLATFORM(JAVA) && !USE(GENERIC_EVENT_LOOP)
 void RunLoop::dispatchFunctionsFromMainThread()
 {
     performWork();
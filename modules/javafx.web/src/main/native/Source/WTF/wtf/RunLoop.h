@@ -270,6 +270,10 @@ private:
     };
     void runImpl(RunMode);
     bool populateTasks(RunMode, Status&, Deque<Ref<TimerBase::ScheduledTask>>&);
+    void fireTimers(Deque<Ref<TimerBase::ScheduledTask>>&);
+#if PLATFORM(JAVA)
+    void runMainThreadTimerService();
+#endif
 
     friend class TimerBase;
 
@@ -280,6 +284,9 @@ private:
     Vector<Status*> m_mainLoops;
     bool m_shutdown { false };
     bool m_pendingTasks { false };
+#if PLATFORM(JAVA)
+    bool m_mainThreadTimersPending WTF_GUARDED_BY_LOCK(m_loopLock) { false };
+#endif
 #endif
 
 #if USE(GENERIC_EVENT_LOOP) || USE(WINDOWS_EVENT_LOOP)
@@ -31,6 +31,11 @@
 #include <wtf/NeverDestroyed.h>
 #include <wtf/ProcessID.h>
 
+#if PLATFORM(JAVA)
+#include <wtf/MainThread.h>
+#include <wtf/java/JavaEnv.h>
+#endif
+
 namespace WTF {
 
 static constexpr bool report = false;
@@ -213,24 +218,88 @@ void RunLoop::runImpl(RunMode runMode)
         if (!populateTasks(runMode, statusOfThisLoop, firedTimers))
             return;
 
-        // Dispatch scheduled timers.
-        while (!firedTimers.isEmpty()) {
-            auto task = firedTimers.takeFirst();
-            task->fired();
-
-            Locker locker { m_loopLock };
-            // It is possible the task is already scheduled while executing fired().
-            if (task->isActive() && !task->isScheduled()) {
-                // Reschedule because the timer requires repeating.
-                // Since we will query the timers' time points before sleeping,
-                // we do not call wakeUp() here.
-                scheduleWithLock(task.get());
-            }
-        }
+        fireTimers(firedTimers);
         performWork();
     }
 }
 
+void RunLoop::fireTimers(Deque<Ref<TimerBase::ScheduledTask>>& firedTimers)
+{
+    // Dispatch scheduled timers.
+    while (!firedTimers.isEmpty()) {
+        auto task = firedTimers.takeFirst();
+        task->fired();
+
+        Locker locker { m_loopLock };
+        // It is possible the task is already scheduled while executing fired().
+        if (task->isActive() && !task->isScheduled()) {
+            // Reschedule because the timer requires repeating.
+            // Since we will query the timers' time points before sleeping,
+            // we do not call wakeUp() here.
+            scheduleWithLock(task.get());
+        }
+    }
+}
+
+#if PLATFORM(JAVA)
+// The main run loop of the Java port is driven by the FX event loop, which
+// never calls run(). This thread sleeps until the earliest main thread timer
+// is due and then has the main thread dispatch fire it.
+void RunLoop::runMainThreadTimerService()
+{
+    ASSERT(this == &RunLoop::main());
+    AttachThreadAsDaemonToJavaEnv autoAttach;
+
+    Locker locker { m_loopLock };
+    while (!m_shutdown) {
+        MonotonicTime sleepUntil = MonotonicTime::infinity();
+        if (!m_mainThreadTimersPending && !m_schedules.isEmpty())
+            sleepUntil = m_schedules.first()->scheduledTimePoint();
+
+        m_readyToRun.waitUntil(m_loopLock, sleepUntil, [&] {
+            return m_shutdown || m_pendingTasks;
+        });
+        m_pendingTasks = false;
+
+        if (m_shutdown || m_mainThreadTimersPending || m_schedules.isEmpty()
+            || m_schedules.first()->scheduledTimePoint() > MonotonicTime::now())
+            continue;
+
+        m_mainThreadTimersPending = true;
+        DropLockForScope unlocker { locker };
+        scheduleDispatchFunctionsOnMainThread();
+    }
+}
+
+void RunLoop::dispatchFunctionsFromMainThread()
+{
+    Deque<Ref<TimerBase::ScheduledTask>> firedTimers;
+    {
+        Locker locker { m_loopLock };
+        m_mainThreadTimersPending = false;
+
+        MonotonicTime now = MonotonicTime::now();
+        while (!m_schedules.isEmpty()) {
+            auto task = m_schedules.first();
+            if (task->scheduledTimePoint() > now)
+                break;
+            unscheduleWithLock(*task);
+            firedTimers.append(Ref(*task));
+        }
+    }
+
+    if (!firedTimers.isEmpty()) {
+        fireTimers(firedTimers);
+
+        // Let the timer thread pick up the next deadline
+        Locker locker { m_loopLock };
+        wakeUpWithLock();
+    }
+
+    performWork();
+}
+#endif
+
 void RunLoop::run()
 {
     RunLoop::current().runImpl(RunMode::Drain);
@@ -1,17 +1,39 @@
 #include "config.h"
 #include <wtf/CPUTime.h>
 
+// On Windows win/CPUTimeWin.cpp provides these.
+#if !OS(WINDOWS)
+
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <time.h>
+
 namespace WTF {
 
+static Seconds timevalToSeconds(const struct timeval& value)
+{
+    return Seconds(value.tv_sec) + Seconds::fromMicroseconds(value.tv_usec);
+}
+
 std::optional<CPUTime> CPUTime::get()
 {
-    return std::nullopt;
+    struct rusage resource { };
+    int ret = getrusage(RUSAGE_SELF, &resource);
+    if (ret)
+        return std::nullopt;
+    return CPUTime { MonotonicTime::now(), timevalToSeconds(resource.ru_utime), timevalToSeconds(resource.ru_stime) };
 }
 
+// The JSC watchdog measures script time with this, so it must not be a
+// constant: with a constant the CPU deadline is never reached.
 Seconds CPUTime::forCurrentThread()
 {
-    return Seconds {};
+    struct timespec ts { };
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts))
+        return MonotonicTime::now().secondsSinceEpoch();
+    return Seconds(ts.tv_sec) + Seconds::fromNanoseconds(ts.tv_nsec);
 }
 
 }
 
+#endif
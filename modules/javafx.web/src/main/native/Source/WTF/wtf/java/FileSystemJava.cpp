@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,10 +29,64 @@
 #include <wtf/java/JavaEnv.h>
 #include <wtf/text/CString.h>
 
+#if OS(WINDOWS)
+#include <windows.h>
+#else
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace WTF {
 
 namespace FileSystemImpl {
 
+// -----------------------------------------------------------------------
+//  Files are opened in Java, so that the usual access checks apply, and a
+//  PlatformFileHandle is the RandomAccessFile. Reads, writes and mappings
+//  go straight to the descriptor of that file.
+// -----------------------------------------------------------------------
+#if OS(WINDOWS)
+using NativeFileHandle = HANDLE;
+static const NativeFileHandle invalidNativeFileHandle = INVALID_HANDLE_VALUE;
+#else
+using NativeFileHandle = int;
+static const NativeFileHandle invalidNativeFileHandle = -1;
+#endif
+
+static NativeFileHandle nativeFileHandle(const PlatformFileHandle& handle)
+{
+    if (!isHandleValid(handle))
+        return invalidNativeFileHandle;
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static JGClass randomAccessFileClass(env->FindClass("java/io/RandomAccessFile"));
+    static JGClass fileDescriptorClass(env->FindClass("java/io/FileDescriptor"));
+    static jmethodID midGetFD = env->GetMethodID(
+            randomAccessFileClass,
+            "getFD",
+            "()Ljava/io/FileDescriptor;");
+    ASSERT(midGetFD);
+#if OS(WINDOWS)
+    static jfieldID fidHandle = env->GetFieldID(fileDescriptorClass, "handle", "J");
+#else
+    static jfieldID fidHandle = env->GetFieldID(fileDescriptorClass, "fd", "I");
+#endif
+    ASSERT(fidHandle);
+
+    JLObject fd(env->CallObjectMethod((jobject)handle, midGetFD));
+    if (WTF::CheckAndClearException(env) || !fd)
+        return invalidNativeFileHandle;
+
+#if OS(WINDOWS)
+    return reinterpret_cast<HANDLE>(env->GetLongField(fd, fidHandle));
+#else
+    return env->GetIntField(fd, fidHandle);
+#endif
+}
+
 
 // -----------------------------------------------------------------------
 //  Below methods use Java calls to implement the intended functionality.
@@ -211,9 +265,6 @@ CString fileSystemRepresentation(const String& s)
 
 PlatformFileHandle openFile(const String& path, FileOpenMode mode, FileAccessPermission, bool)
 {
-    if (mode != FileOpenMode::Read) {
-        return invalidPlatformFileHandle;
-    }
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID mid = env->GetStaticMethodID(
             comSunWebkitFileSystem,
@@ -224,10 +275,17 @@ PlatformFileHandle openFile(const String& path, FileOpenMode mode, FileAccessPer
     PlatformFileHandle result = env->CallStaticObjectMethod(
             comSunWebkitFileSystem,
             mid,
-            (jstring)path.toJavaString(env), (jstring)(env->NewStringUTF("r")));
+            (jstring)path.toJavaString(env),
+            (jstring)(env->NewStringUTF(mode == FileOpenMode::Read ? "r" : "rw")));
 
     WTF::CheckAndClearException(env);
-    return result ? result : invalidPlatformFileHandle;
+    if (!result)
+        return invalidPlatformFileHandle;
+    if (mode == FileOpenMode::Truncate && !truncateFile(result, 0)) {
+        closeFile(result);
+        return invalidPlatformFileHandle;
+    }
+    return result;
 }
 
 void closeFile(PlatformFileHandle& handle)
@@ -250,70 +308,312 @@ void closeFile(PlatformFileHandle& handle)
 
 int readFromFile(PlatformFileHandle handle, void* data, int length)
 {
-    if (length < 0 || !isHandleValid(handle) || data == nullptr) {
+    if (length < 0 || data == nullptr)
         return -1;
-    }
+    NativeFileHandle fd = nativeFileHandle(handle);
+    if (fd == invalidNativeFileHandle)
+        return -1;
+#if OS(WINDOWS)
+    DWORD bytesRead;
+    if (!::ReadFile(fd, data, length, &bytesRead, nullptr))
+        return -1;
+    return static_cast<int>(bytesRead);
+#else
+    do {
+        int bytesRead = read(fd, data, static_cast<size_t>(length));
+        if (bytesRead >= 0)
+            return bytesRead;
+    } while (errno == EINTR);
+    return -1;
+#endif
+}
+
+int writeToFile(PlatformFileHandle handle, const void* data, int length)
+{
+    if (length < 0 || data == nullptr)
+        return -1;
+    NativeFileHandle fd = nativeFileHandle(handle);
+    if (fd == invalidNativeFileHandle)
+        return -1;
+#if OS(WINDOWS)
+    DWORD bytesWritten;
+    if (!::WriteFile(fd, data, length, &bytesWritten, nullptr))
+        return -1;
+    return static_cast<int>(bytesWritten);
+#else
+    do {
+        int bytesWritten = write(fd, data, static_cast<size_t>(length));
+        if (bytesWritten >= 0)
+            return bytesWritten;
+    } while (errno == EINTR);
+    return -1;
+#endif
+}
+
+bool truncateFile(PlatformFileHandle handle, long long offset)
+{
+    NativeFileHandle fd = nativeFileHandle(handle);
+    if (fd == invalidNativeFileHandle)
+        return false;
+#if OS(WINDOWS)
+    FILE_END_OF_FILE_INFO eofInfo;
+    eofInfo.EndOfFile.QuadPart = offset;
+    return ::SetFileInformationByHandle(fd, FileEndOfFileInfo, &eofInfo, sizeof(eofInfo));
+#else
+    // ftruncate returns 0 to indicate the success.
+    return !ftruncate(fd, offset);
+#endif
+}
+
+bool flushFile(PlatformFileHandle handle)
+{
+    NativeFileHandle fd = nativeFileHandle(handle);
+    if (fd == invalidNativeFileHandle)
+        return false;
+#if OS(WINDOWS)
+    return ::FlushFileBuffers(fd);
+#else
+    return !fsync(fd);
+#endif
+}
+
+std::optional<uint64_t> fileSize(PlatformFileHandle handle)
+{
+    NativeFileHandle fd = nativeFileHandle(handle);
+    if (fd == invalidNativeFileHandle)
+        return std::nullopt;
+#if OS(WINDOWS)
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(fd, &size))
+        return std::nullopt;
+    return size.QuadPart;
+#else
+    struct stat fileStat;
+    if (fstat(fd, &fileStat))
+        return std::nullopt;
+    return fileStat.st_size;
+#endif
+}
+
+String pathGetFileName(const String& path)
+{
     JNIEnv* env = WTF::GetJavaEnv();
+
     static jmethodID mid = env->GetStaticMethodID(
             comSunWebkitFileSystem,
-            "fwkReadFromFile",
-            "(Ljava/io/RandomAccessFile;Ljava/nio/ByteBuffer;)I");
+            "fwkPathGetFileName",
+            "(Ljava/lang/String;)Ljava/lang/String;");
     ASSERT(mid);
 
-    int result = env->CallStaticIntMethod(
+    JLString result = static_cast<jstring>(env->CallStaticObjectMethod(
             comSunWebkitFileSystem,
             mid,
-            (jobject)handle,
-            (jobject)(env->NewDirectByteBuffer(data, length)));
+            (jstring) path.toJavaString(env)));
     WTF::CheckAndClearException(env);
 
-    if (result < 0) {
+    return String(env, result);
+}
+
+long long seekFile(PlatformFileHandle handle, long long offset, FileSeekOrigin origin)
+{
+    NativeFileHandle fd = nativeFileHandle(handle);
+    if (fd == invalidNativeFileHandle)
+        return -1;
+#if OS(WINDOWS)
+    DWORD moveMethod = FILE_BEGIN;
+    if (origin == FileSeekOrigin::Current)
+        moveMethod = FILE_CURRENT;
+    else if (origin == FileSeekOrigin::End)
+        moveMethod = FILE_END;
+    LARGE_INTEGER distance, position;
+    distance.QuadPart = offset;
+    if (!::SetFilePointerEx(fd, distance, &position, moveMethod))
         return -1;
+    return position.QuadPart;
+#else
+    int whence = SEEK_SET;
+    if (origin == FileSeekOrigin::Current)
+        whence = SEEK_CUR;
+    else if (origin == FileSeekOrigin::End)
+        whence = SEEK_END;
+    return static_cast<long long>(lseek(fd, offset, whence));
+#endif
+}
+
+bool MappedFileData::mapFileHandle(PlatformFileHandle handle, FileOpenMode openMode, MappedFileMode mapMode)
+{
+    NativeFileHandle fd = nativeFileHandle(handle);
+    if (fd == invalidNativeFileHandle)
+        return false;
+
+    auto size = fileSize(handle);
+    if (!size || *size > std::numeric_limits<size_t>::max() || *size > std::numeric_limits<decltype(m_fileSize)>::max())
+        return false;
+
+    if (!*size)
+        return true;
+
+#if OS(WINDOWS)
+    UNUSED_PARAM(mapMode);
+    DWORD pageProtection = PAGE_READONLY;
+    DWORD desiredAccess = FILE_MAP_READ;
+    switch (openMode) {
+    case FileOpenMode::Read:
+        break;
+    case FileOpenMode::Truncate:
+        pageProtection = PAGE_READWRITE;
+        desiredAccess = FILE_MAP_WRITE;
+        break;
+    case FileOpenMode::ReadWrite:
+        pageProtection = PAGE_READWRITE;
+        desiredAccess = FILE_MAP_WRITE | FILE_MAP_READ;
+        break;
     }
-    return result;
+
+    m_fileMapping = Win32Handle::adopt(CreateFileMapping(fd, nullptr, pageProtection, 0, 0, nullptr));
+    if (!m_fileMapping)
+        return false;
+
+    m_fileData = MapViewOfFile(m_fileMapping.get(), desiredAccess, 0, 0, *size);
+    if (!m_fileData)
+        return false;
+#else
+    int pageProtection = PROT_READ;
+    switch (openMode) {
+    case FileOpenMode::Read:
+        break;
+    case FileOpenMode::Truncate:
+        pageProtection = PROT_WRITE;
+        break;
+    case FileOpenMode::ReadWrite:
+        pageProtection = PROT_READ | PROT_WRITE;
+        break;
+#if OS(DARWIN)
+    case FileOpenMode::EventsOnly:
+        ASSERT_NOT_REACHED();
+#endif
+    }
+
+    void* data = mmap(0, *size, pageProtection, MAP_FILE | (mapMode == MappedFileMode::Shared ? MAP_SHARED : MAP_PRIVATE), fd, 0);
+    if (data == MAP_FAILED)
+        return false;
+    m_fileData = data;
+#endif
+    m_fileSize = *size;
+    return true;
 }
 
-String pathGetFileName(const String& path)
+bool unmapViewOfFile(void* buffer, size_t size)
+{
+#if OS(WINDOWS)
+    UNUSED_PARAM(size);
+    return ::UnmapViewOfFile(buffer);
+#else
+    return !munmap(buffer, size);
+#endif
+}
+
+MappedFileData::~MappedFileData()
+{
+    if (!m_fileData)
+        return;
+    unmapViewOfFile(m_fileData, m_fileSize);
+}
+
+bool deleteFile(const String& path)
 {
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetStaticMethodID(
             comSunWebkitFileSystem,
-            "fwkPathGetFileName",
-            "(Ljava/lang/String;)Ljava/lang/String;");
+            "fwkDeleteFile",
+            "(Ljava/lang/String;)Z");
     ASSERT(mid);
 
-    JLString result = static_cast<jstring>(env->CallStaticObjectMethod(
+    jboolean result = env->CallStaticBooleanMethod(
             comSunWebkitFileSystem,
             mid,
-            (jstring) path.toJavaString(env)));
+            (jstring)path.toJavaString(env));
     WTF::CheckAndClearException(env);
 
-    return String(env, result);
+    return jbool_to_bool(result);
 }
 
-long long seekFile(PlatformFileHandle handle, long long offset, FileSeekOrigin)
+std::optional<Vector<uint8_t>> readEntireFile(PlatformFileHandle handle)
 {
-    // we always get positive value for offset from webkit.
-    // Below check for offset < 0 might be redundant?
-    if (offset < 0 || !isHandleValid(handle)) {
-        return -1;
+    auto size = fileSize(handle);
+    if (!size || *size > std::numeric_limits<int>::max())
+        return std::nullopt;
+
+    Vector<uint8_t> buffer(static_cast<size_t>(*size));
+    size_t totalBytesRead = 0;
+    while (totalBytesRead < buffer.size()) {
+        int bytesRead = readFromFile(handle, buffer.data() + totalBytesRead, buffer.size() - totalBytesRead);
+        if (bytesRead < 0)
+            return std::nullopt;
+        if (!bytesRead)
+            break;
+        totalBytesRead += bytesRead;
     }
+    buffer.shrink(totalBytesRead);
+    return buffer;
+}
+
+std::optional<Vector<uint8_t>> readEntireFile(const String& path)
+{
+    auto handle = openFile(path, FileOpenMode::Read);
+    if (!isHandleValid(handle))
+        return std::nullopt;
+    auto contents = readEntireFile(handle);
+    closeFile(handle);
+    return contents;
+}
+
+bool moveFile(const String& oldPath, const String& newPath)
+{
     JNIEnv* env = WTF::GetJavaEnv();
+
     static jmethodID mid = env->GetStaticMethodID(
             comSunWebkitFileSystem,
-            "fwkSeekFile",
-            "(Ljava/io/RandomAccessFile;J)V");
+            "fwkMoveFile",
+            "(Ljava/lang/String;Ljava/lang/String;)Z");
     ASSERT(mid);
 
-    env->CallStaticVoidMethod(
+    jboolean result = env->CallStaticBooleanMethod(
             comSunWebkitFileSystem,
             mid,
-            (jobject)handle, (jlong)offset);
-    if (WTF::CheckAndClearException(env)) {
-        offset = -1;
+            (jstring)oldPath.toJavaString(env),
+            (jstring)newPath.toJavaString(env));
+    WTF::CheckAndClearException(env);
+
+    return jbool_to_bool(result);
+}
+
+Vector<String> listDirectory(const String& path)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkListDirectory",
+            "(Ljava/lang/String;)[Ljava/lang/String;");
+    ASSERT(mid);
+
+    JLocalRef<jobjectArray> names(static_cast<jobjectArray>(env->CallStaticObjectMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring)path.toJavaString(env))));
+    Vector<String> entries;
+    if (WTF::CheckAndClearException(env) || !names)
+        return entries;
+
+    jsize count = env->GetArrayLength(names);
+    entries.reserveInitialCapacity(count);
+    for (jsize i = 0; i < count; i++) {
+        JLString name(static_cast<jstring>(env->GetObjectArrayElement(names, i)));
+        entries.append(String(env, name));
     }
-    return offset;
+    return entries;
 }
 
 
@@ -340,69 +640,12 @@ String directoryName(String const &)
     return String();
 }
 
-Vector<String> listDirectory(const String&, const String&)
-{
-    fprintf(stderr, "listDirectory(const String&, const String&) NOT IMPLEMENTED\n");
-    Vector<String> entities;
-    return entities;
-}
-
-Vector<String> listDirectory(const String&)
-{
-    fprintf(stderr, "listDirectory(const String&) NOT IMPLEMENTED\n");
-    Vector<String> entities;
-    return entities;
-}
-
-int writeToFile(PlatformFileHandle, const void* data, int length)
-{
-    fprintf(stderr, "writeToFile(PlatformFileHandle, const void* data, int length) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(data);
-    UNUSED_PARAM(length);
-
-    return -1;
-}
-
-bool truncateFile(PlatformFileHandle, long long offset)
-{
-    fprintf(stderr, "truncateFile(PlatformFileHandle, long long offset) NOT IMPLEMENTED\n");
-
-    // FIXME: openjfx2.26 implement truncateFile
-    UNUSED_PARAM(offset);
-    return false;
-}
-
 std::optional<int32_t> getFileDeviceId(const String&)
 {
     fprintf(stderr, "getFileDeviceId(const String&) NOT IMPLEMENTED\n");
     return {};
 }
 
-bool MappedFileData::mapFileHandle(PlatformFileHandle, FileOpenMode, MappedFileMode)
-{
-    fprintf(stderr, "MappedFileData::mapFileHandle(PlatformFileHandle handle, MappedFileMode) NOT IMPLEMENTED\n");
-    return false;
-}
-
-bool unmapViewOfFile(void* , size_t)
-{
-    fprintf(stderr, "unmapViewOfFile(void* , size_t) NOT IMPLEMENTED()\n");
-    return false;
-}
-
-MappedFileData::~MappedFileData()
-{
-    if (!m_fileData)
-        return;
-    unmapViewOfFile(m_fileData, m_fileSize);
-}
-
-bool deleteFile(const String&)
-{
-    fprintf(stderr, "deleteFile(const String&) NOT IMPLEMENTED\n");
-    return false;
-}
-
 bool deleteEmptyDirectory(String const &)
 {
     fprintf(stderr, "deleteEmptyDirectory(String const &) NOT IMPLEMENTED\n");
@@ -425,14 +668,6 @@ String parentPath(const String& path)
     return String();
 }
 
-bool moveFile(const String& oldPath, const String& newPath)
-{
-    fprintf(stderr, "moveFile(const String& oldPath, const String& newPath) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(oldPath);
-    UNUSED_PARAM(newPath);
-
-    return false;
-}
 
 bool isHiddenFile(const String& path)
 {
@@ -478,42 +713,12 @@ void deleteAllFilesModifiedSince(const String& path, WallTime t)
     UNUSED_PARAM(t);
 }
 
-bool flushFile(PlatformFileHandle handle)
-{
-     fprintf(stderr, "flushFile(PlatformFileHandle) NOT IMPLEMENTED\n");
-     UNUSED_PARAM(handle);
-     return false;
-}
-
-std::optional<Vector<uint8_t>> readEntireFile(PlatformFileHandle handle)
-{
-    fprintf(stderr, "readEntireFile(PlatformFileHandle handle) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(handle);
-    Vector<uint8_t> vec;
-    return vec;
-}
-std::optional<Vector<uint8_t>> readEntireFile(const String& path)
-{
-    fprintf(stderr, "readEntireFile(const String& path) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(path);
-    Vector<uint8_t> vec;
-    return vec;
-}
-
 bool deleteNonEmptyDirectory(String const &)
 {
     fprintf(stderr, "deleteNonEmptyDirectory(String const &) NOT IMPLEMENTED\n");
     return false;
 }
 
-std::optional<uint64_t> fileSize(PlatformFileHandle handle)
-{
-    long long size = 0;
-    fprintf(stderr, "readEntireFile(PlatformFileHandle) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(handle);
-    return size;
-}
-
 std::optional<PlatformFileID> fileID(PlatformFileHandle fileHandle)
 {
     UNUSED_PARAM(fileHandle);
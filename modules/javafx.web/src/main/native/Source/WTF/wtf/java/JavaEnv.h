@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,10 +38,26 @@ extern volatile bool g_ShuttingDown;
 
 namespace WTF {
 
+// The JNIEnv of the current thread, cached after the first lookup so that
+// the calls into Java on hot paths do not each go through the JavaVM.
+// A thread keeps its JNIEnv for as long as it stays attached, and the only
+// threads that WebKit detaches are the ones it attached itself through
+// AttachThreadToJavaEnv, which drops the cached value.
+ALWAYS_INLINE JNIEnv*& CachedJavaEnv()
+{
+    static thread_local JNIEnv* env = nullptr;
+    return env;
+}
+
 ALWAYS_INLINE JNIEnv* JNICALL GetJavaEnv()
 {
-    void* env;
-    jvm->GetEnv(&env, JNI_VERSION_1_2);
+    JNIEnv*& cached = CachedJavaEnv();
+    if (LIKELY(cached))
+        return cached;
+
+    void* env = nullptr;
+    if (jvm->GetEnv(&env, JNI_VERSION_1_2) == JNI_OK)
+        cached = (JNIEnv*)env;
     return (JNIEnv*)env;
 }
 
@@ -102,6 +118,7 @@ public:
     ~AttachThreadToJavaEnv()
     {
         if (m_status == JNI_EDETACHED) {
+            CachedJavaEnv() = nullptr;
             jvm->DetachCurrentThread();
         }
     }
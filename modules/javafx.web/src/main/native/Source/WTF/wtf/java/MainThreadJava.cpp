@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,8 @@
 #include <wtf/MainThread.h>
 #include <wtf/RunLoop.h>
 
+#include <atomic>
+
 #if OS(UNIX)
 #include <pthread.h>
 #endif
@@ -38,6 +40,10 @@ namespace WTF {
 static JGClass jMainThreadCls;
 static jmethodID fwkScheduleDispatchFunctions;
 
+// Set by the first post since the last drain. Later ones find the dispatch
+// already queued on the FX thread and don't attach to the JVM at all.
+static std::atomic<bool> s_dispatchPending { false };
+
 #if OS(UNIX)
 static pthread_t s_mainThread;
 #elif OS(WINDOWS)
@@ -46,12 +52,19 @@ static ThreadIdentifier s_mainThread { 0 };
 
 void scheduleDispatchFunctionsOnMainThread()
 {
+    if (s_dispatchPending.exchange(true))
+        return;
+
     AttachThreadAsNonDaemonToJavaEnv autoAttach;
     JNIEnv* env = autoAttach.env();
-    if (env) {
-        env->CallStaticVoidMethod(jMainThreadCls, fwkScheduleDispatchFunctions);
-        WTF::CheckAndClearException(env);
+    if (!env) {
+        s_dispatchPending = false;
+        return;
     }
+
+    env->CallStaticVoidMethod(jMainThreadCls, fwkScheduleDispatchFunctions);
+    if (WTF::CheckAndClearException(env))
+        s_dispatchPending = false;
 }
 
 void initializeMainThreadPlatform()
@@ -117,6 +130,8 @@ extern "C" {
 JNIEXPORT void JNICALL Java_com_sun_webkit_MainThread_twkScheduleDispatchFunctions
   (JNIEnv*, jobject)
 {
+    // Cleared before draining, functions posted from now on need a new dispatch
+    s_dispatchPending = false;
     RunLoop::main().dispatchFunctionsFromMainThread();
 }
 
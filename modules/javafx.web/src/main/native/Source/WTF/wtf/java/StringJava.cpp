@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,10 +26,48 @@
 #include "config.h"
 
 #include <wtf/Vector.h>
+#include <wtf/text/ASCIIFastPath.h>
 #include <wtf/text/WTFString.h>
 
+#if CPU(X86_SSE2)
+#include <emmintrin.h>
+#endif
+
 namespace WTF {
 
+// Java strings handed to WebKit (URLs, header values, DOM arguments, script
+// source) are almost always Latin-1, so they are stored as 8-bit strings
+// when possible. Like charactersAreAllASCII(), the scan ORs the input
+// together a vector or machine word at a time and does not exit early.
+static bool charactersAreAllLatin1(const UChar* characters, size_t length)
+{
+    const UChar* end = characters + length;
+    MachineWord allCharBits = 0;
+
+#if CPU(X86_SSE2)
+    __m128i allVectorBits = _mm_setzero_si128();
+    for (; end - characters >= 8; characters += 8)
+        allVectorBits = _mm_or_si128(allVectorBits, _mm_loadu_si128(reinterpret_cast<const __m128i*>(characters)));
+    allVectorBits = _mm_and_si128(allVectorBits, _mm_set1_epi16(static_cast<short>(0xFF00)));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(allVectorBits, _mm_setzero_si128())) != 0xFFFF)
+        return false;
+#else
+    while (!isAlignedToMachineWord(characters) && characters != end)
+        allCharBits |= *characters++;
+
+    const UChar* wordEnd = alignToMachineWord(end);
+    const size_t loopIncrement = sizeof(MachineWord) / sizeof(UChar);
+    for (; characters < wordEnd; characters += loopIncrement)
+        allCharBits |= *(reinterpret_cast_ptr<const MachineWord*>(characters));
+#endif
+
+    while (characters != end)
+        allCharBits |= *characters++;
+
+    constexpr MachineWord nonLatin1Mask = static_cast<MachineWord>(0xFF00FF00FF00FF00ULL);
+    return !(allCharBits & nonLatin1Mask);
+}
+
 // String conversions
 String::String(JNIEnv* env, const JLString &s)
 {
@@ -42,7 +80,14 @@ String::String(JNIEnv* env, const JLString &s)
         } else {
             const jchar* str = env->GetStringCritical(s, NULL);
             if (str) {
-                m_impl = StringImpl::create((const UChar*)str, len);
+                const UChar* characters = reinterpret_cast<const UChar*>(str);
+                if (charactersAreAllLatin1(characters, len)) {
+                    LChar* data8;
+                    m_impl = StringImpl::createUninitialized(len, data8);
+                    StringImpl::copyCharacters(data8, characters, len);
+                } else {
+                    m_impl = StringImpl::create(characters, len);
+                }
                 env->ReleaseStringCritical(s, str);
             } else {
                 m_impl = StringImpl::create(reinterpret_cast<const UChar*>(L"OME"), 3);
@@ -58,11 +103,18 @@ JLString String::toJavaString(JNIEnv *env) const
     } else {
         const unsigned len = length();
         if (is8Bit()) {
-            // Convert latin1 chars to unicode.
-            Vector<jchar> jchars(len);
-            for (unsigned i = 0; i < len; i++) {
-                jchars[i] = characterAt(i);
+            // Short strings are converted on the stack. ASCII without embedded
+            // NULs is valid modified UTF-8, which lets the VM build a compact
+            // string without widening; other Latin-1 is widened to UTF-16.
+            const LChar* data8 = characters8();
+            if (charactersAreAllASCII(data8, len) && !memchr(data8, 0, len)) {
+                Vector<char, 1024> utf8(len + 1);
+                memcpy(utf8.data(), data8, len);
+                utf8[len] = '\0';
+                return env->NewStringUTF(utf8.data());
             }
+            Vector<jchar, 512> jchars(len);
+            StringImpl::copyCharacters(reinterpret_cast<UChar*>(jchars.data()), data8, len);
             return env->NewString(jchars.data(), len);
         } else {
             return env->NewString((jchar*)characters16(), len);
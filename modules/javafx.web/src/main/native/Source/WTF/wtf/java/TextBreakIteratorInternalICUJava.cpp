@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,20 +27,63 @@
 
 #include "TextBreakIteratorInternalICU.h"
 
+#include <mutex>
+#include <unicode/uloc.h>
+#include <wtf/NeverDestroyed.h>
 #include <wtf/StdLibExtras.h>
+#include <wtf/java/JavaEnv.h>
 #include <wtf/text/WTFString.h>
 #include <wtf/text/CString.h>
 
 
 namespace WTF {
 
+// ICU break iterators are opened with this locale, so that line and word
+// breaking follow the JVM default locale without a round trip through
+// java.text.BreakIterator.
+static CString javaDefaultLocaleID()
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+    if (!env)
+        return { };
+
+    jclass localeClass = env->FindClass("java/util/Locale");
+    if (WTF::CheckAndClearException(env) || !localeClass)
+        return { };
+    JLClass localeClassRef(localeClass);
+
+    jmethodID midGetDefault = env->GetStaticMethodID(localeClass, "getDefault", "()Ljava/util/Locale;");
+    jmethodID midToLanguageTag = env->GetMethodID(localeClass, "toLanguageTag", "()Ljava/lang/String;");
+    if (WTF::CheckAndClearException(env) || !midGetDefault || !midToLanguageTag)
+        return { };
+
+    JLObject locale(env->CallStaticObjectMethod(localeClass, midGetDefault));
+    if (WTF::CheckAndClearException(env) || !locale)
+        return { };
+
+    JLString tag(static_cast<jstring>(env->CallObjectMethod(locale, midToLanguageTag)));
+    if (WTF::CheckAndClearException(env) || !tag)
+        return { };
+
+    CString languageTag = String(env, tag).utf8();
+    char localeID[ULOC_FULLNAME_CAPACITY];
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t length = uloc_forLanguageTag(languageTag.data(), localeID, sizeof(localeID), nullptr, &status);
+    if (U_FAILURE(status) || status == U_STRING_NOT_TERMINATED_WARNING || length <= 0)
+        return { };
+    return CString(localeID, length);
+}
+
 static const char* UILanguage()
 {
-    // Chrome's UI language can be different from the OS UI language on Windows.
-    // We want to return Chrome's UI language here.
-    // DEPRECATED_DEFINE_STATIC_LOCAL(CString, locale, (WebCore::defaultLanguage().latin1()));
-    // FIXME-java: Get default language from Java using Locale.getDefault()
-    return "en";
+    static NeverDestroyed<CString> localeID;
+    static std::once_flag onceFlag;
+    std::call_once(onceFlag, [] {
+        localeID.get() = javaDefaultLocaleID();
+        if (localeID.get().isNull())
+            localeID.get() = "en";
+    });
+    return localeID.get().data();
 }
 
 const char* currentSearchLocaleID()
@@ -53,4 +96,4 @@ const char* currentTextBreakLocaleID()
     return UILanguage();
 }
 
-} // namespace WebCore
+} // namespace WTF
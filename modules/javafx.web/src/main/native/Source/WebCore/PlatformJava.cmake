@@ -104,9 +104,11 @@ list(APPEND WebCore_PRIVATE_FRAMEWORK_HEADERS
     platform/java/PageSupplementJava.h
     platform/java/PlatformJavaClasses.h
     platform/java/PluginWidgetJava.h
+    platform/java/ScriptBytecodeCacheJava.h
     platform/mock/GeolocationClientMock.h
     platform/network/java/AuthenticationChallenge.h
     platform/network/java/CertificateInfo.h
+    platform/network/java/HTTPDiskCacheJava.h
     platform/network/java/ResourceError.h
     platform/network/java/ResourceRequest.h
     platform/network/java/ResourceResponse.h
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,6 +36,8 @@
 #include "DOMException.h"
 #include "LocalFrame.h"
 
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
 #include <wtf/java/JavaEnv.h>
 
 #include "JavaDOMUtils.h"
@@ -78,6 +80,73 @@ void raiseDOMErrorException(JNIEnv* env, Exception&& ec)
 {
     raiseDOMErrorException(env, ec.code());
 }
+
+AtomString toAtomString(JNIEnv* env, jstring string)
+{
+    // Direct-mapped on length and the first and last characters, which is
+    // enough to tell apart the handful of names a DOM walker keeps asking
+    // for. A hit skips both the String allocation and the atom table.
+    constexpr jsize maxCachedLength = 64;
+    constexpr unsigned cacheSize = 256;
+    static NeverDestroyed<std::array<AtomString, cacheSize>> cache;
+
+    ASSERT(isMainThread());
+
+    if (!string)
+        return emptyAtom();
+
+    jsize length = env->GetStringLength(string);
+    if (!length)
+        return emptyAtom();
+    if (length > maxCachedLength)
+        return AtomString { String(env, JLString(string)) };
+
+    jchar characters[maxCachedLength];
+    env->GetStringRegion(string, 0, length, characters);
+    const UChar* data = reinterpret_cast<const UChar*>(characters);
+
+    unsigned index = (length * 31 + data[0] * 7 + data[length - 1]) % cacheSize;
+    AtomString& entry = cache.get()[index];
+    if (entry.length() == static_cast<unsigned>(length) && equal(entry.impl(), data, length))
+        return entry;
+
+    entry = AtomString(data, length);
+    return entry;
+}
+
+jlongArray toJavaPeerArray(JNIEnv* env, const Vector<Ref<Node>>& nodes)
+{
+    if (env->ExceptionCheck())
+        return nullptr;
+
+    jlongArray result = env->NewLongArray(nodes.size());
+    if (!result)
+        return nullptr;
+
+    Vector<jlong> peers;
+    peers.reserveInitialCapacity(nodes.size());
+    for (auto& node : nodes)
+        peers.uncheckedAppend(ptr_to_jlong(&node.copyRef().leakRef()));
+    env->SetLongArrayRegion(result, 0, peers.size(), peers.data());
+    return result;
+}
+
+jobjectArray toJavaStringArray(JNIEnv* env, const Vector<String>& strings)
+{
+    if (env->ExceptionCheck())
+        return nullptr;
+
+    static JGClass stringClass(env->FindClass("java/lang/String"));
+    jobjectArray result = env->NewObjectArray(strings.size(), stringClass, nullptr);
+    if (!result)
+        return nullptr;
+
+    for (size_t i = 0; i < strings.size(); ++i) {
+        if (!strings[i].isNull())
+            env->SetObjectArrayElement(result, i, (jstring)strings[i].toJavaString(env));
+    }
+    return result;
+}
 } // namespace WebCore
 
 
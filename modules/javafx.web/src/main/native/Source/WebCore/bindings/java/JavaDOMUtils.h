@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,8 @@
 #include <wtf/Ref.h>
 #include <wtf/RefPtr.h>
 #include <wtf/GetPtr.h>
+#include <wtf/Vector.h>
+#include <wtf/text/AtomString.h>
 #include <wtf/text/WTFString.h>
 #include "ExceptionOr.h"
 
@@ -44,6 +46,8 @@
 
 namespace WebCore {
 
+class Node;
+
 enum JavaExceptionType {
     JavaDOMException = 0,
     JavaEventException,
@@ -51,6 +55,17 @@ enum JavaExceptionType {
     JavaUndefinedException
 };
 
+// Converts a Java string argument to an AtomString. Short strings such as
+// attribute, tag and CSS property names are looked up in a small cache of
+// recently used atoms first. Must be called on the main thread.
+AtomString toAtomString(JNIEnv*, jstring);
+
+// Results of the bulk accessors in com.sun.webkit.dom. Every peer in the
+// array holds a reference that is released by the Java wrapper, exactly as
+// for a single JavaReturn<Node>. Null strings become null elements.
+jlongArray toJavaPeerArray(JNIEnv*, const Vector<Ref<Node>>&);
+jobjectArray toJavaStringArray(JNIEnv*, const Vector<String>&);
+
 uint32_t getJavaHashCode(jobject o);
 bool isJavaEquals(jobject o1, jobject o2);
 
@@ -1036,6 +1036,18 @@ public class ElementImpl extends NodeImpl implements Element {
     native static boolean hasAttributesImpl(long peer);
 
 
+    /**
+     * Returns the qualified names and values of all attributes of this
+     * element with a single native call, packed as
+     * {@code name0, value0, name1, value1, ...}.
+     */
+    public String[] getAttributeNamesAndValues()
+    {
+        return getAttributeNamesAndValuesImpl(getPeer());
+    }
+    native static String[] getAttributeNamesAndValuesImpl(long peer);
+
+
     @Override
     public String getAttributeNS(String namespaceURI
         , String localName)
@@ -289,6 +289,15 @@ public class NodeImpl extends JSObject implements Node, EventTarget {
     }
     native static long getChildNodesImpl(long peer);
 
+    /**
+     * Returns the children of this node with a single native call, rather
+     * than one call per {@code getChildNodes().item(i)}.
+     */
+    public Node[] getChildNodesArray() {
+        return NodeListImpl.toNodes(getChildNodePeersImpl(getPeer()));
+    }
+    native static long[] getChildNodePeersImpl(long peer);
+
     @Override
     public Node getFirstChild() {
         return NodeImpl.getImpl(getFirstChildImpl(getPeer()));
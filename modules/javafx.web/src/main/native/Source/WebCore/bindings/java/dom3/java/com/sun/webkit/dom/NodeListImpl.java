@@ -98,5 +98,43 @@ public class NodeListImpl implements NodeList {
         , int index);
 
 
+// Bulk access
+    /**
+     * Returns all items of this list with a single native call.
+     */
+    public Node[] toArray() {
+        return toNodes(getItemPeersImpl(getPeer()));
+    }
+    native static long[] getItemPeersImpl(long peer);
+
+    /**
+     * Returns the value of the named attribute for every item of this list,
+     * in list order. An entry is {@code null} if the item is not an element
+     * or does not have the attribute.
+     */
+    public String[] getAttributeValues(String name) {
+        return getAttributeValuesImpl(getPeer(), name);
+    }
+    native static String[] getAttributeValuesImpl(long peer
+        , String name);
+
+    /**
+     * Returns the text content of every item of this list, in list order.
+     */
+    public String[] getTextContents() {
+        return getTextContentsImpl(getPeer());
+    }
+    native static String[] getTextContentsImpl(long peer);
+
+    static Node[] toNodes(long[] peers) {
+        if (peers == null) return new Node[0];
+        Node[] nodes = new Node[peers.length];
+        for (int i = 0; i < peers.length; i++) {
+            nodes[i] = NodeImpl.getImpl(peers[i]);
+        }
+        return nodes;
+    }
+
+
 }
 
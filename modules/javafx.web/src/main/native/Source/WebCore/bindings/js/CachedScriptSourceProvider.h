@@ -31,6 +31,10 @@
 #include "CachedScriptFetcher.h"
 #include <JavaScriptCore/SourceProvider.h>
 
+#if PLATFORM(JAVA)
+#include "ScriptBytecodeCacheJava.h"
+#endif
+
 namespace WebCore {
 
 class CachedScriptSourceProvider : public JSC::SourceProvider, public CachedResourceClient {
@@ -40,21 +44,37 @@ public:
 
     virtual ~CachedScriptSourceProvider()
     {
+#if PLATFORM(JAVA)
+        m_bytecodeCache.commitCachedBytecode();
+#endif
         m_cachedScript->removeClient(*this);
     }
 
     unsigned hash() const override;
     StringView source() const override;
 
+#if PLATFORM(JAVA)
+    RefPtr<JSC::CachedBytecode> cachedBytecode() const final { return m_bytecodeCache.cachedBytecode(); }
+    void updateCache(const JSC::UnlinkedFunctionExecutable* executable, const JSC::SourceCode&, JSC::CodeSpecializationKind kind, const JSC::UnlinkedFunctionCodeBlock* codeBlock) const final { m_bytecodeCache.updateCache(executable, kind, codeBlock); }
+    void cacheBytecode(const BytecodeCacheGenerator& generator) const final { m_bytecodeCache.cacheBytecode(generator); }
+    void commitCachedBytecode() const final { m_bytecodeCache.commitCachedBytecode(); }
+#endif
+
 private:
     CachedScriptSourceProvider(CachedScript* cachedScript, JSC::SourceProviderSourceType sourceType, Ref<CachedScriptFetcher>&& scriptFetcher)
         : SourceProvider(JSC::SourceOrigin { cachedScript->response().url(), WTFMove(scriptFetcher) }, String(cachedScript->response().url().string()), cachedScript->response().isRedirected() ? String(cachedScript->url().string()) : String(), TextPosition(), sourceType)
         , m_cachedScript(cachedScript)
+#if PLATFORM(JAVA)
+        , m_bytecodeCache(*this)
+#endif
     {
         m_cachedScript->addClient(*this);
     }
 
     CachedResourceHandle<CachedScript> m_cachedScript;
+#if PLATFORM(JAVA)
+    ScriptBytecodeCacheJava m_bytecodeCache;
+#endif
 };
 
 inline unsigned CachedScriptSourceProvider::hash() const
@@ -34,7 +34,9 @@
 #include "runtime_object.h"
 #include "runtime_root.h"
 #include <JavaScriptCore/JSArray.h>
+#include <JavaScriptCore/JSArrayBufferView.h>
 #include <JavaScriptCore/JSLock.h>
+#include <wtf/java/JavaEnv.h>
 
 #include "JavaArrayJSC.h"
 #include "JavaInstanceJSC.h"
@@ -61,6 +63,77 @@ static jchar toJCharValue(const JSValue& value, JSGlobalObject* globalObject)
     return (jchar)value.toNumber(globalObject);
 }
 
+// Copies a JS typed array into a new Java primitive array with a single
+// Set<Type>ArrayRegion call. Returns null when the element types of the
+// typed array and of the Java array type named by javaClassName differ.
+static jarray convertTypedArrayToJavaArray(JSArrayBufferView* view, const char* javaClassName)
+{
+    if (!javaClassName || javaClassName[0] != '[' || !javaClassName[1] || javaClassName[2])
+        return nullptr;
+    if (view->isDetached() || view->isOutOfBounds())
+        return nullptr;
+
+    JNIEnv* env = getJNIEnv();
+    jsize length = static_cast<jsize>(view->length());
+    const void* data = view->vector();
+    TypedArrayType type = typedArrayType(view->type());
+    jarray result = nullptr;
+    switch (javaClassName[1]) {
+    case 'B':
+        if (type == TypeInt8 || type == TypeUint8 || type == TypeUint8Clamped) {
+            result = env->NewByteArray(length);
+            if (result)
+                env->SetByteArrayRegion(static_cast<jbyteArray>(result), 0, length, static_cast<const jbyte*>(data));
+        }
+        break;
+    case 'S':
+        if (type == TypeInt16 || type == TypeUint16) {
+            result = env->NewShortArray(length);
+            if (result)
+                env->SetShortArrayRegion(static_cast<jshortArray>(result), 0, length, static_cast<const jshort*>(data));
+        }
+        break;
+    case 'C':
+        if (type == TypeUint16) {
+            result = env->NewCharArray(length);
+            if (result)
+                env->SetCharArrayRegion(static_cast<jcharArray>(result), 0, length, static_cast<const jchar*>(data));
+        }
+        break;
+    case 'I':
+        if (type == TypeInt32 || type == TypeUint32) {
+            result = env->NewIntArray(length);
+            if (result)
+                env->SetIntArrayRegion(static_cast<jintArray>(result), 0, length, static_cast<const jint*>(data));
+        }
+        break;
+    case 'J':
+        if (type == TypeBigInt64 || type == TypeBigUint64) {
+            result = env->NewLongArray(length);
+            if (result)
+                env->SetLongArrayRegion(static_cast<jlongArray>(result), 0, length, static_cast<const jlong*>(data));
+        }
+        break;
+    case 'F':
+        if (type == TypeFloat32) {
+            result = env->NewFloatArray(length);
+            if (result)
+                env->SetFloatArrayRegion(static_cast<jfloatArray>(result), 0, length, static_cast<const jfloat*>(data));
+        }
+        break;
+    case 'D':
+        if (type == TypeFloat64) {
+            result = env->NewDoubleArray(length);
+            if (result)
+                env->SetDoubleArrayRegion(static_cast<jdoubleArray>(result), 0, length, static_cast<const jdouble*>(data));
+        }
+        break;
+    }
+    if (WTF::CheckAndClearException(env)) // OOME
+        return nullptr;
+    return result;
+}
+
 jobject convertUndefinedToJObject()
 {
     static JGObject jgoUndefined;
@@ -115,6 +188,9 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
                         return result;
                     }
                     result.l = array->javaArray();
+                } else if (javaType == JavaTypeArray && object->inherits(JSArrayBufferView::info())) {
+                    // A typed array passed for a primitive Java array
+                    result.l = convertTypedArrayToJavaArray(jsCast<JSArrayBufferView*>(object), javaClassName);
                 } else if ((!result.l && (!strcmp(javaClassName, "java.lang.Object")))
                            || (!strcmp(javaClassName, "netscape.javascript.JSObject"))) {
                     // Wrap objects in JSObject instances.
@@ -304,7 +380,7 @@ jobject jvalueToJObject(jvalue value, JavaType jtype) {
     }
 }
 
-jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, JavaType returnType, jmethodID methodId, jobject* args, jvalue& result, jobject accessControlContext) {
+jthrowable dispatchJNICall(int count, RootObject* rootObject, jobject obj, bool isStatic, JavaType returnType, jmethodID methodId, jobject* args, jvalue& result, jobject accessControlContext) {
 
     // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
     JLObject jlinstance(obj, true);
@@ -315,18 +391,38 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
     }
 
     JNIEnv* env = getJNIEnv();
-    jclass objClass = env->GetObjectClass(obj);
-    jobject rmethod = env->ToReflectedMethod(objClass, methodId, isStatic);
-    jclass utilityCls = env->FindClass("com/sun/webkit/Utilities");
-    jclass objectCls = env->FindClass("java/lang/Object");
-    jobjectArray argsArray = env->NewObjectArray(count, objectCls, NULL);
-    for (int i = 0;  i < count; i++)
-      env->SetObjectArrayElement(argsArray, i, args[i]);
-    jmethodID invokeMethod =
+    JLClass objClass(env->GetObjectClass(obj));
+    JLObject rmethod(env->ToReflectedMethod(objClass, methodId, isStatic));
+    return dispatchJNICall(count, rootObject, obj, rmethod, returnType, args, result, accessControlContext);
+}
+
+jthrowable dispatchJNICall(int count, RootObject*, jobject obj, jobject reflectedMethod, JavaType returnType, jobject* args, jvalue& result, jobject accessControlContext) {
+
+    // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
+    JLObject jlinstance(obj, true);
+
+    if (!jlinstance) {
+        LOG_ERROR("Could not get javaInstance for %p in JNIUtilityPrivate::dispatchJNICall", (jobject)jlinstance);
+        return NULL;
+    }
+
+    // The invocation has to go through Utilities, which checks it against
+    // the reject lists and runs it with the page's access control context.
+    JNIEnv* env = getJNIEnv();
+    static JGClass utilityCls(env->FindClass("com/sun/webkit/Utilities"));
+    static JGClass objectCls(env->FindClass("java/lang/Object"));
+    static jmethodID invokeMethod =
         env->GetStaticMethodID(utilityCls, "fwkInvokeWithContext",
                                "(Ljava/lang/reflect/Method;Ljava/lang/Object;[Ljava/lang/Object;Ljava/security/AccessControlContext;)Ljava/lang/Object;");
+    ASSERT(invokeMethod);
+
+    // Scripts can call into Java many times before returning to it, so the
+    // local references made here must not pile up
+    JLocalRef<jobjectArray> argsArray(env->NewObjectArray(count, objectCls, NULL));
+    for (int i = 0;  i < count; i++)
+      env->SetObjectArrayElement(argsArray, i, args[i]);
     jobject r = env->CallStaticObjectMethod(utilityCls, invokeMethod,
-                                            rmethod, obj, argsArray,
+                                            reflectedMethod, obj, (jobjectArray)argsArray,
                                             accessControlContext);
 
     jthrowable ex = env->ExceptionOccurred();
@@ -343,7 +439,7 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
     // to treat it as JS foreign object.
     case JavaTypeChar:
         result.l = r;
-        break;
+        return ex;
 
     case JavaTypeBoolean:
         result.z = callJNIMethod<jboolean>(r, "booleanValue", "()Z");
@@ -377,6 +473,8 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
         /* Nothing to do */
         break;
     }
+    if (r)
+        env->DeleteLocalRef(r);
     return ex;
 }
 
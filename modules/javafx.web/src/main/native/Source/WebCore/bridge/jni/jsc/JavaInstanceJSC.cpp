@@ -309,10 +309,9 @@ JSValue JavaInstance::invokeMethod(JSGlobalObject* globalObject, CallFrame* call
     Vector<jobject> jArgs(count);
 
     for (int i = 0; i < count; i++) {
-        CString javaClassName = jMethod->parameterAt(i).utf8();
-        JavaType jtype = javaTypeFromClassName(javaClassName.data());
+        JavaType jtype = jMethod->parameterTypeAt(i);
         jvalue jarg = convertValueToJValue(globalObject, m_rootObject.get(),
-            callFrame->argument(i), jtype, javaClassName.data());
+            callFrame->argument(i), jtype, jMethod->parameterClassNameAt(i));
         jArgs[i] = jvalueToJObject(jarg, jtype);
 #if !PLATFORM(JAVA)
         LOG(LiveConnect, "JavaInstance::invokeMethod arg[%d] = %s", i, callFrame->argument(i).toString(globalObject)->value(globalObject).ascii().data());
@@ -342,11 +341,9 @@ JSValue JavaInstance::invokeMethod(JSGlobalObject* globalObject, CallFrame* call
         }
 
         // const char *callingURL = 0; // FIXME, need to propagate calling URL to Java
-        jmethodID methodId = getMethodID(obj, jMethod->name().utf8().data(), jMethod->signature());
-
         jthrowable ex = dispatchJNICall(callFrame->argumentCount(), rootObject,
-                                        obj, jMethod->isStatic(),
-                                        jMethod->returnType(), methodId,
+                                        obj, jMethod->reflectedMethod(),
+                                        jMethod->returnType(),
                                         jArgs.data(), result,
                                         accessControlContext());
         if (ex != NULL) {
@@ -47,6 +47,10 @@ public:
     const String name() const { return m_name.impl(); }
     RuntimeType returnTypeClassName() const { return m_returnTypeClassName.utf8(); }
     const String parameterAt(int i) const { return m_parameters[i]; }
+    // Resolved once, invokeMethod converts every argument with these
+    const char* parameterClassNameAt(int i) const { return m_parameterClassNames[i].data(); }
+    JavaType parameterTypeAt(int i) const { return m_parameterTypes[i]; }
+    jobject reflectedMethod() const { return m_reflectedMethod; }
     const char* signature() const;
     JavaType returnType() const { return m_returnType; }
     bool isStatic() const { return m_isStatic; }
@@ -56,6 +60,9 @@ public:
 
 private:
     Vector<WTF::String> m_parameters;
+    Vector<CString> m_parameterClassNames;
+    Vector<JavaType> m_parameterTypes;
+    JGObject m_reflectedMethod;
     JavaString m_name;
     mutable char* m_signature;
     JavaString m_returnTypeClassName;
@@ -767,11 +767,22 @@ ExceptionOr<void> HTMLCanvasElement::toBlob(Ref<BlobCallback>&& callback, const
 
     makeRenderingResultsAvailable();
 
+#if PLATFORM(JAVA)
+    // The pixels are encoded off the main thread, which keeps large canvases
+    // from blocking the page.
+    buffer()->toDataAsync(encodingMIMEType, quality, [document = Ref { document() }, callback = WTFMove(callback), encodingMIMEType](Vector<uint8_t>&& blobData) mutable {
+        RefPtr<Blob> blob;
+        if (!blobData.isEmpty())
+            blob = Blob::create(document.ptr(), WTFMove(blobData), encodingMIMEType);
+        callback->scheduleCallback(document.get(), WTFMove(blob));
+    });
+#else
     RefPtr<Blob> blob;
     Vector<uint8_t> blobData = buffer()->toData(encodingMIMEType, quality);
     if (!blobData.isEmpty())
         blob = Blob::create(&document(), WTFMove(blobData), encodingMIMEType);
     callback->scheduleCallback(document(), WTFMove(blob));
+#endif
     return { };
 }
 
@@ -348,6 +348,7 @@ private:
 #if PLATFORM(JAVA)
     Pasteboard(RefPtr<DataObjectJava>, bool copyPasteMode);
     static std::unique_ptr<Pasteboard> create(RefPtr<DataObjectJava>);
+    void readClipboardDataIfNeeded();
 #endif
 
 #if PLATFORM(COCOA)
@@ -387,6 +388,7 @@ private:
 #if PLATFORM(JAVA)
     RefPtr<DataObjectJava> m_dataObject;
     bool m_copyPasteMode;
+    bool m_clipboardDataRead { false };
 #endif
 };
 
@@ -72,6 +72,11 @@ WEBCORE_EXPORT DestinationColorSpace screenColorSpace(Widget* = nullptr);
 
 bool screenHasInvertedColors();
 
+#if PLATFORM(JAVA)
+// Drops the screen properties cached for every page
+WEBCORE_EXPORT void screenPropertiesChanged();
+#endif
+
 #if USE(GLIB)
 double screenDPI();
 void setScreenDPIObserverHandler(Function<void()>&&, void*);
@@ -210,6 +210,12 @@ public:
     SCRIPT_CACHE* scriptCache() const { return &m_scriptCache; }
 #endif
 
+#if PLATFORM(JAVA)
+    // Fetches the widths of the given glyphs in a single JNI call and stores
+    // them in the glyph width map. Called when a GlyphPage is filled.
+    void platformCacheGlyphWidths(const Glyph*, unsigned count) const;
+#endif
+
     void setIsUsedInSystemFallbackFontCache() { m_isUsedInSystemFallbackFontCache = true; }
     bool isUsedInSystemFallbackFontCache() const { return m_isUsedInSystemFallbackFontCache; }
 
@@ -226,6 +226,9 @@ public:
 
 #if PLATFORM(JAVA)
     RefPtr<RQRef> nativeFontData() const { return m_jFont; }
+    // Maps |length| UTF-16 code units to glyphs through a reusable direct
+    // buffer shared with WCFont, so no java arrays are allocated.
+    bool mapCharactersToGlyphs(const UChar*, unsigned length, Glyph*) const;
 #endif
 
     unsigned hash() const;
@@ -40,6 +40,10 @@
 #include "GradientRendererCG.h"
 #endif
 
+#if PLATFORM(JAVA)
+#include "RQRef.h"
+#endif
+
 #if USE(CG)
 typedef struct CGContext* CGContextRef;
 #endif
@@ -105,6 +109,13 @@ public:
     void paint(CGContextRef);
 #endif
 
+#if PLATFORM(JAVA)
+    // The java copy of the color stops and the spread method, created on
+    // first use. The render queue refers to it instead of sending the stops
+    // with every fill, which lets java reuse the paint it built.
+    RefPtr<RQRef> javaStops();
+#endif
+
 private:
     Gradient(Data&&, ColorInterpolationMethod, GradientSpreadMethod, GradientColorStops&&, std::optional<RenderingResourceIdentifier>);
 
@@ -121,6 +132,10 @@ private:
 #if USE(CG)
     std::optional<GradientRendererCG> m_platformRenderer;
 #endif
+
+#if PLATFORM(JAVA)
+    RefPtr<RQRef> m_javaStops;
+#endif
 };
 
 WEBCORE_EXPORT WTF::TextStream& operator<<(WTF::TextStream&, const Gradient&);
@@ -516,6 +516,16 @@ Vector<uint8_t> ImageBuffer::toData(Ref<ImageBuffer> source, const String& mimeT
 #endif
 }
 
+#if PLATFORM(JAVA)
+void ImageBuffer::toDataAsync(const String& mimeType, std::optional<double> quality, CompletionHandler<void(Vector<uint8_t>&&)>&& completionHandler)
+{
+    if (auto* backend = ensureBackendCreated())
+        backend->toDataJavaAsync(mimeType, quality, WTFMove(completionHandler));
+    else
+        completionHandler({ });
+}
+#endif
+
 RefPtr<PixelBuffer> ImageBuffer::getPixelBuffer(const PixelBufferFormat& destinationFormat, const IntRect& sourceRect, const ImageBufferAllocator& allocator) const
 {
     auto* backend = ensureBackendCreated();
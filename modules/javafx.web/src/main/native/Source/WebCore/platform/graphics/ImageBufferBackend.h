@@ -36,6 +36,7 @@
 #include "PixelBufferFormat.h"
 #include "PlatformLayer.h"
 #include "RenderingMode.h"
+#include <wtf/CompletionHandler.h>
 #include <wtf/RefPtr.h>
 #include <wtf/Vector.h>
 
@@ -136,6 +137,13 @@ public:
             UNUSED_PARAM(quality);
         return { };
     };
+
+    // Encodes the current pixels like toDataJava, possibly off the main
+    // thread. The completion handler is called on the main thread.
+    virtual void toDataJavaAsync(const String& mimeType, std::optional<double> quality, CompletionHandler<void(Vector<uint8_t>&&)>&& completionHandler)
+    {
+        completionHandler(toDataJava(mimeType, quality));
+    }
 #endif
 #if USE(CAIRO)
     virtual RefPtr<cairo_surface_t> createCairoSurface() { return nullptr; }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -91,34 +91,34 @@ unsigned jGetEnd(jobject jRun)
     return env->CallIntMethod(jRun, mID);
 }
 
-unsigned jGetCharOffset(jobject jRun, unsigned glyphIndex)
-{
-    if (!jGetGlyphCount(jRun)) {
-        // Return same value as TextRun.getCharOffset() when there is
-        // no glyph information available.
-        return glyphIndex;
-    }
-
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mID = env->GetMethodID(
-        PG_GetTextRun(env),
-        "getCharOffset",
-        "(I)I");
-    ASSERT(mID);
-
-    return env->CallIntMethod(jRun, mID, glyphIndex);
-}
-
-CGGlyph jGetGlyph(jobject jRun, unsigned glyphIndex)
+// Fetches the glyphs, char offsets and advances of the whole run in one call.
+bool jGetGlyphData(jobject jRun, unsigned glyphCount, Vector<jint>& glyphs,
+                   Vector<jint>& charOffsets, Vector<jfloat>& advances)
 {
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID mID = env->GetMethodID(
         PG_GetTextRun(env),
-        "getGlyph",
-        "(I)I");
+        "getGlyphData",
+        "([I[I[F)V");
     ASSERT(mID);
 
-    return env->CallIntMethod(jRun, mID, glyphIndex);
+    JLocalRef<jintArray> jglyphs(env->NewIntArray(glyphCount));
+    JLocalRef<jintArray> joffsets(env->NewIntArray(glyphCount));
+    JLocalRef<jfloatArray> jadvances(env->NewFloatArray(glyphCount));
+    if (WTF::CheckAndClearException(env) || !jglyphs || !joffsets || !jadvances) // OOME
+        return false;
+
+    env->CallVoidMethod(jRun, mID, (jintArray)jglyphs, (jintArray)joffsets, (jfloatArray)jadvances);
+    if (WTF::CheckAndClearException(env))
+        return false;
+
+    glyphs.grow(glyphCount);
+    charOffsets.grow(glyphCount);
+    advances.grow(glyphCount);
+    env->GetIntArrayRegion(jglyphs, 0, glyphCount, glyphs.data());
+    env->GetIntArrayRegion(joffsets, 0, glyphCount, charOffsets.data());
+    env->GetFloatArrayRegion(jadvances, 0, glyphCount, advances.data());
+    return !WTF::CheckAndClearException(env);
 }
 
 FloatRect jGetGlyphPosAndAdvance(jobject jRun, unsigned glyphIndex)
@@ -178,21 +178,32 @@ ComplexTextController::ComplexTextRun::ComplexTextRun(JLObject jRun, const Font&
     // m_glyphOrigins.grow(m_glyphCount);
     m_coreTextIndices.grow(m_glyphCount);
 
-    for (unsigned i = 0; i < m_glyphCount; ++i) {
-        // The given string will be broken down into multiple java TextRuns. Each
-        // java TextRun will have indicies relative to it's text. So it has to
-        // be converted to absolute index w.r.t WebCore String.
-        // Refer {CTGlyphLayout, DWGlyphLayout, PangoGlyphLayout}.layout()
-        m_coreTextIndices[i] = m_indexBegin + jGetCharOffset(jRun, i);
+    // The given string will be broken down into multiple java TextRuns. Each
+    // java TextRun will have indicies relative to it's text. So it has to
+    // be converted to absolute index w.r.t WebCore String.
+    // Refer {CTGlyphLayout, DWGlyphLayout, PangoGlyphLayout}.layout()
+    Vector<jint> glyphs;
+    Vector<jint> charOffsets;
+    Vector<jfloat> advances;
+    if (!jGetGlyphCount(jRun) || !jGetGlyphData(jRun, m_glyphCount, glyphs, charOffsets, advances)) {
+        // Same values as TextRun returns when there is no glyph information.
+        for (unsigned i = 0; i < m_glyphCount; ++i) {
+            m_coreTextIndices[i] = m_indexBegin + i;
+            m_glyphs[i] = 0;
+            m_baseAdvances[i] = { };
+        }
+        return;
+    }
 
-        m_glyphs[i]= jGetGlyph(jRun, i);
+    for (unsigned i = 0; i < m_glyphCount; ++i) {
+        m_coreTextIndices[i] = m_indexBegin + charOffsets[i];
+        m_glyphs[i] = glyphs[i];
         if (m_font.isZeroWidthSpaceGlyph(m_glyphs[i])) {
             m_baseAdvances[i] = { };
             continue;
         }
-
-        auto glyphBox = jGetGlyphPosAndAdvance(jRun, i);
-        m_baseAdvances[i] = glyphBox.size();
+        // FIXME: We don't yet support Y advance from prism.
+        m_baseAdvances[i] = { advances[i], 0 };
     }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,7 @@
 #include "FontPlatformData.h"
 #include "FontSelector.h"
 #include "GraphicsContextJava.h"
+#include "Logging.h"
 #include "NotImplemented.h"
 
 #include <wtf/Assertions.h>
@@ -122,6 +123,64 @@ RefPtr<Font> Font::platformCreateScaledFont(const FontDescription&, float scaleF
     return Font::create(*m_platformData.derive(scaleFactor), origin(), Interstitial::No);
 }
 
+#if !LOG_DISABLED
+// Glyph widths fetched by platformCacheGlyphWidths() vs. one at a time.
+static unsigned s_bulkGlyphWidthCount;
+static unsigned s_singleGlyphWidthCount;
+#endif
+
+void Font::platformCacheGlyphWidths(const Glyph* glyphs, unsigned count) const
+{
+#if ENABLE(OPENTYPE_VERTICAL)
+    if (m_verticalData)
+        return;
+#endif
+
+    RefPtr<RQRef> jFont = m_platformData.nativeFontData();
+    if (!jFont || !count)
+        return;
+
+    Vector<jint, 256> missing;
+    for (unsigned i = 0; i < count; ++i) {
+        if (glyphs[i] && m_glyphToWidthMap.metricsForGlyph(glyphs[i]) == cGlyphSizeUnknown)
+            missing.append(glyphs[i]);
+    }
+    if (missing.isEmpty())
+        return;
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    JLocalRef<jintArray> jglyphs(env->NewIntArray(missing.size()));
+    WTF::CheckAndClearException(env); // OOME
+    if (!jglyphs)
+        return;
+    env->SetIntArrayRegion(jglyphs, 0, missing.size(), missing.data());
+
+    static jmethodID getGlyphWidths_mID = env->GetMethodID(PG_GetFontClass(env),
+        "getGlyphWidths", "([I)[F");
+    ASSERT(getGlyphWidths_mID);
+
+    JLocalRef<jfloatArray> jwidths(static_cast<jfloatArray>(
+        env->CallObjectMethod(*jFont, getGlyphWidths_mID, (jintArray)jglyphs)));
+    if (WTF::CheckAndClearException(env) || !jwidths)
+        return;
+
+    Vector<jfloat, 256> widths(missing.size());
+    env->GetFloatArrayRegion(jwidths, 0, missing.size(), widths.data());
+    if (WTF::CheckAndClearException(env))
+        return;
+
+    for (size_t i = 0; i < missing.size(); ++i)
+        m_glyphToWidthMap.setMetricsForGlyph(missing[i], widths[i]);
+
+#if !LOG_DISABLED
+    s_bulkGlyphWidthCount += missing.size();
+    LOG(Fonts, "Font %p: cached %zu glyph widths in bulk (bulk: %u, single: %u, bulk ratio: %.1f%%)",
+        this, missing.size(), s_bulkGlyphWidthCount, s_singleGlyphWidthCount,
+        100.0 * s_bulkGlyphWidthCount / (s_bulkGlyphWidthCount + s_singleGlyphWidthCount));
+#endif
+}
+
 float Font::platformWidthForGlyph(Glyph c) const
 {
     JNIEnv* env = WTF::GetJavaEnv();
@@ -130,6 +189,10 @@ float Font::platformWidthForGlyph(Glyph c) const
     if (!jFont)
         return 0.0f;
 
+#if !LOG_DISABLED
+    ++s_singleGlyphWidthCount;
+#endif
+
     static jmethodID getGlyphWidth_mID = env->GetMethodID(PG_GetFontClass(env),
         "getGlyphWidth", "(I)D");
     ASSERT(getGlyphWidth_mID);
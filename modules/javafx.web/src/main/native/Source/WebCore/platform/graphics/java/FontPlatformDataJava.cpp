@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,9 +31,13 @@
 #include "NotImplemented.h"
 
 #include <wtf/Assertions.h>
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
 #include <wtf/text/CString.h>
 #include <wtf/text/WTFString.h>
 
+#include "com_sun_webkit_graphics_WCFont.h"
+
 namespace WebCore {
 
 namespace {
@@ -56,6 +60,59 @@ RefPtr<RQRef> getJavaFont(const String& family, float size, bool italic, bool bo
 
     return RQRef::create(wcFont);
 }
+
+/*
+ * A native scratch area wrapped in a direct ByteBuffer once and handed to
+ * WCFont.getGlyphCodes(ByteBuffer, int): the characters are written at the
+ * start of the buffer, the glyph codes are read back from
+ * GLYPH_BUFFER_GLYPHS_OFFSET. Glyph pages are only filled on the main
+ * thread, so a single buffer is enough.
+ */
+class GlyphCodesBuffer {
+    WTF_MAKE_NONCOPYABLE(GlyphCodesBuffer);
+public:
+    static GlyphCodesBuffer& shared()
+    {
+        ASSERT(isMainThread());
+        static NeverDestroyed<GlyphCodesBuffer> buffer;
+        return buffer.get();
+    }
+
+    bool map(JNIEnv* env, jobject jFont, const UChar* chars, unsigned length, Glyph* glyphs)
+    {
+        ASSERT(length <= com_sun_webkit_graphics_WCFont_GLYPH_BUFFER_CHARS);
+        if (length > com_sun_webkit_graphics_WCFont_GLYPH_BUFFER_CHARS)
+            return false;
+
+        if (!static_cast<jobject>(m_nioBuffer)) {
+            m_nioBuffer = JLObject(env->NewDirectByteBuffer(m_data, sizeof(m_data)));
+            WTF::CheckAndClearException(env); // OOME
+            if (!static_cast<jobject>(m_nioBuffer))
+                return false;
+        }
+
+        memcpy(m_data, chars, length * sizeof(UChar));
+
+        static jmethodID mid = env->GetMethodID(PG_GetFontClass(env),
+            "getGlyphCodes", "(Ljava/nio/ByteBuffer;I)V");
+        ASSERT(mid);
+        env->CallVoidMethod(jFont, mid, static_cast<jobject>(m_nioBuffer), static_cast<jint>(length));
+        if (WTF::CheckAndClearException(env))
+            return false;
+
+        static_assert(sizeof(Glyph) == sizeof(jint));
+        memcpy(glyphs, m_data + com_sun_webkit_graphics_WCFont_GLYPH_BUFFER_GLYPHS_OFFSET, length * sizeof(jint));
+        return true;
+    }
+
+private:
+    friend class NeverDestroyed<GlyphCodesBuffer>;
+    GlyphCodesBuffer() = default;
+
+    alignas(jint) char m_data[com_sun_webkit_graphics_WCFont_GLYPH_BUFFER_GLYPHS_OFFSET
+        + com_sun_webkit_graphics_WCFont_GLYPH_BUFFER_CHARS * sizeof(jint)];
+    JGObject m_nioBuffer;
+};
 }
 
 FontPlatformData::FontPlatformData(RefPtr<RQRef> font, float size)
@@ -72,7 +129,16 @@ std::unique_ptr<FontPlatformData> FontPlatformData::create(
             fontDescription.computedSize(),
             isItalic(fontDescription.italic()),
             fontDescription.weight() >= boldWeightValue());
-    return !wcFont ? nullptr : std::make_unique<FontPlatformData>(wcFont, fontDescription.computedSize());
+    if (!wcFont)
+        return nullptr;
+    return std::make_unique<FontPlatformData>(wcFont, fontDescription.computedSize());
+}
+
+bool FontPlatformData::mapCharactersToGlyphs(const UChar* chars, unsigned length, Glyph* glyphs) const
+{
+    if (!m_jFont)
+        return false;
+    return GlyphCodesBuffer::shared().map(WTF::GetJavaEnv(), *m_jFont, chars, length, glyphs);
 }
 
 std::unique_ptr<FontPlatformData> FontPlatformData::derive(float scaleFactor) const
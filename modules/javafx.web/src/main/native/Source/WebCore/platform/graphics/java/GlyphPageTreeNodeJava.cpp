@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,34 +33,10 @@ namespace WebCore {
 
 bool GlyphPage::fill(UChar* buffer, unsigned bufferLength)
 {
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    RefPtr<RQRef> jFont = this->font().platformData().nativeFontData();
-    if (!jFont)
-        return false;
-
-    JLocalRef<jcharArray> jchars(env->NewCharArray(bufferLength));
-    WTF::CheckAndClearException(env); // OOME
-    ASSERT(jchars);
-    if (!jchars)
-        return false;
-
-    jchar* chars = (jchar*)env->GetPrimitiveArrayCritical(jchars, NULL);
-    ASSERT(chars);
-    memcpy(chars, buffer, bufferLength * 2);
-    env->ReleasePrimitiveArrayCritical(jchars, chars, 0);
-
-    static jmethodID mid = env->GetMethodID(PG_GetFontClass(env), "getGlyphCodes", "([C)[I");
-    ASSERT(mid);
-    JLocalRef<jintArray> jglyphs(static_cast<jintArray>(env->CallObjectMethod(*jFont, mid, (jcharArray)jchars)));
-    WTF::CheckAndClearException(env);
-    ASSERT(jglyphs);
-    if (!jglyphs)
+    Glyph glyphs[2 * GlyphPage::size];
+    if (!this->font().platformData().mapCharactersToGlyphs(buffer, bufferLength, glyphs))
         return false;
 
-    Glyph* glyphs = (Glyph*)env->GetPrimitiveArrayCritical(jglyphs, NULL);
-    ASSERT(glyphs);
-
     unsigned step;  // 1 for BMP, 2 for non-BMP
     if (bufferLength == GlyphPage::size) {
         step = 1;
@@ -71,15 +47,20 @@ bool GlyphPage::fill(UChar* buffer, unsigned bufferLength)
     }
 
     bool haveGlyphs = false;
+    Glyph pageGlyphs[GlyphPage::size];
     for (unsigned i = 0; i < GlyphPage::size; i++) {
         Glyph glyph = glyphs[i * step];
+        pageGlyphs[i] = glyph;
         if (glyph) {
             haveGlyphs = true;
             setGlyphForIndex(i, glyph,ColorGlyphType::Outline);
         } else
             setGlyphForIndex(i, 0, this->font().colorGlyphType(glyph));
     }
-    env->ReleasePrimitiveArrayCritical(jglyphs, glyphs, JNI_ABORT);
+
+    // Fetch the widths of the whole page in one go rather than one JNI call per glyph.
+    if (haveGlyphs)
+        this->font().platformCacheGlyphWidths(pageGlyphs, GlyphPage::size);
 
     return haveGlyphs;
 }
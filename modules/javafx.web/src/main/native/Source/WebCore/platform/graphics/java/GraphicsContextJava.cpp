@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -64,58 +64,54 @@
 
 namespace WebCore {
 
+// Queues the gradient to paint |bounds| with. Conic gradients have no
+// prism paint, so java renders them to an image covering |bounds|.
 static void setGradient(Gradient &gradient,
-    const AffineTransform& gradientSpaceTransformation, PlatformGraphicsContext* context, jint id)
+    const AffineTransform& gradientSpaceTransformation, const FloatRect& bounds,
+    PlatformGraphicsContext* context, jint id)
 {
-    const Vector<GradientColorStop, 2> stops = gradient.stops().stops();
-    int nStops = stops.size();
+    RefPtr<RQRef> stops = gradient.javaStops();
+    if (!stops)
+        return;
+
+    // The gradient replaces the color of the java paint it is set to.
+    if (id == com_sun_webkit_graphics_GraphicsDecoder_SET_FILL_GRADIENT)
+        context->emittedState().fillColor = std::nullopt;
+    else
+        context->emittedState().strokeColor = std::nullopt;
 
-    FloatPoint p0, p1;
-    float startRadius, endRadius;
-    bool isRadialGradient = true;
     WTF::switchOn(gradient.data(),
             [&] (const Gradient::LinearData& data) -> void {
-                isRadialGradient = false;
-                p0 = data.point0;
-                p1 = data.point1;
+                FloatPoint p0 = gradientSpaceTransformation.mapPoint(data.point0);
+                FloatPoint p1 = gradientSpaceTransformation.mapPoint(data.point1);
+                context->rq().freeSpace(4 * 7)
+                << id
+                << stops
+                << (jint)com_sun_webkit_graphics_GraphicsDecoder_GRADIENT_LINEAR
+                << p0.x() << p0.y() << p1.x() << p1.y();
             },
             [&] (const Gradient::RadialData& data) -> void {
-                p0 = data.point0;
-                p1 = data.point1;
-                startRadius = data.startRadius;
-                endRadius = data.endRadius;
+                FloatPoint p0 = gradientSpaceTransformation.mapPoint(data.point0);
+                FloatPoint p1 = gradientSpaceTransformation.mapPoint(data.point1);
+                context->rq().freeSpace(4 * 9)
+                << id
+                << stops
+                << (jint)com_sun_webkit_graphics_GraphicsDecoder_GRADIENT_RADIAL
+                << p0.x() << p0.y() << p1.x() << p1.y()
+                << (jfloat)(gradientSpaceTransformation.xScale() * data.startRadius)
+                << (jfloat)(gradientSpaceTransformation.xScale() * data.endRadius);
             },
-            [&] (const Gradient::ConicData&) -> void {
-                notImplemented();
+            [&] (const Gradient::ConicData& data) -> void {
+                FloatPoint center = gradientSpaceTransformation.mapPoint(data.point0);
+                float angle = data.angleRadians + atan2f(gradientSpaceTransformation.b(), gradientSpaceTransformation.a());
+                context->rq().freeSpace(4 * 10)
+                << id
+                << stops
+                << (jint)com_sun_webkit_graphics_GraphicsDecoder_GRADIENT_CONIC
+                << center.x() << center.y() << angle
+                << bounds.x() << bounds.y() << bounds.width() << bounds.height();
             }
     );
-
-    p0 = gradientSpaceTransformation.mapPoint(p0);
-    p1 = gradientSpaceTransformation.mapPoint(p1);
-
-    context->rq().freeSpace(4 * 11 + 20 * nStops)
-    << id
-    << (jfloat)p0.x()
-    << (jfloat)p0.y()
-    << (jfloat)p1.x()
-    << (jfloat)p1.y()
-    << (jint)isRadialGradient;
-
-    if (isRadialGradient) {
-        context->rq()
-        << (jfloat)(gradientSpaceTransformation.xScale() * startRadius)
-        << (jfloat)(gradientSpaceTransformation.xScale() * endRadius);
-    }
-    context->rq()
-    << (jint)0 //is not proportional
-    << (jint)gradient.spreadMethod()
-    << (jint)nStops;
-
-    for (const auto& cs : stops) {
-        auto [r, g, b, a] = cs.color.toColorTypeLossy<SRGBA<float>>().resolved();
-        context->rq()
-        << r << g << b << a << (jfloat)cs.offset;
-    }
 }
 
 static void flushImageRQ(PlatformGraphicsContext* context, const PlatformImagePtr& image)
@@ -163,6 +159,7 @@ void GraphicsContextJava::savePlatformState()
 
     platformContext()->rq().freeSpace(4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SAVESTATE;
+    platformContext()->saveEmittedState();
 }
 
 void GraphicsContextJava::restore() {
@@ -177,6 +174,7 @@ void GraphicsContextJava::restorePlatformState()
 
     platformContext()->rq().freeSpace(4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_RESTORESTATE;
+    platformContext()->restoreEmittedState();
 }
 
 // Draws a filled rectangle with a stroked border.
@@ -231,11 +229,28 @@ void GraphicsContextJava::fillRect(const FloatRect& rect, const Color& color)
         return;
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
-    platformContext()->rq().freeSpace(36)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFFI
-    << rect.x() << rect.y()
-    << rect.width() << rect.height()
-    << r << g << b << a;
+    // Runs of rects in one 8-bit color, typical for canvas, share a command
+    auto bytes = color.tryGetAsSRGBABytes();
+    if (!bytes) {
+        platformContext()->rq().freeSpace(36)
+        << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFFI
+        << rect.x() << rect.y()
+        << rect.width() << rect.height()
+        << r << g << b << a;
+        return;
+    }
+
+    RenderingQueue& rq = platformContext()->rq();
+    const jint opcode = com_sun_webkit_graphics_GraphicsDecoder_FILL_RECTS;
+    uint64_t key = (static_cast<uint64_t>(bytes->red) << 24) | (bytes->green << 16) | (bytes->blue << 8) | bytes->alpha;
+    if (!rq.extendBatch(opcode, key, 16)) {
+        rq.freeSpace(40)
+        << opcode << r << g << b << a;
+        rq.beginBatch(opcode, key);
+    }
+    rq << rect.x() << rect.y()
+    << rect.width() << rect.height();
+    rq.endBatchItem();
 }
 
 void GraphicsContextJava::fillRect(const FloatRect& rect)
@@ -257,6 +272,7 @@ void GraphicsContextJava::fillRect(const FloatRect& rect)
             setGradient(
                 *fillGradient(),
                 fillGradientSpaceTransform(),
+                rect,
                 platformContext(),
                 com_sun_webkit_graphics_GraphicsDecoder_SET_FILL_GRADIENT);
         }
@@ -498,6 +514,9 @@ void GraphicsContextJava::setPlatformFillColor(const Color& color)
     if (paintingDisabled())
         return;
 
+    if (!platformContext()->shouldEmit(platformContext()->emittedState().fillColor, color))
+        return;
+
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
     platformContext()->rq().freeSpace(20)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR
@@ -509,6 +528,9 @@ void GraphicsContextJava::setPlatformTextDrawingMode(TextDrawingModeFlags mode)
     if (paintingDisabled())
         return;
 
+    if (!platformContext()->shouldEmit(platformContext()->emittedState().textDrawingMode, mode))
+        return;
+
     platformContext()->rq().freeSpace(16)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_TEXT_MODE
     << (jint)(mode.contains(TextDrawingMode::Fill))
@@ -523,6 +545,9 @@ void GraphicsContextJava::setPlatformStrokeStyle(StrokeStyle style)
     if (paintingDisabled())
         return;
 
+    if (!platformContext()->shouldEmit(platformContext()->emittedState().strokeStyle, style))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKESTYLE
     << (jint)style;
@@ -533,6 +558,9 @@ void GraphicsContextJava::setPlatformStrokeColor(const Color& color)
     if (paintingDisabled())
         return;
 
+    if (!platformContext()->shouldEmit(platformContext()->emittedState().strokeColor, color))
+        return;
+
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
     platformContext()->rq().freeSpace(20)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR
@@ -544,6 +572,9 @@ void GraphicsContextJava::setPlatformStrokeThickness(float strokeThickness)
     if (paintingDisabled())
         return;
 
+    if (!platformContext()->shouldEmit(platformContext()->emittedState().strokeThickness, strokeThickness))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKEWIDTH
     << strokeThickness;
@@ -570,6 +601,14 @@ void GraphicsContextJava::concatCTM(const AffineTransform& at)
         return;
 
     m_state.transform.multiply(at);
+    if (RenderingQueue::isCompactFormat() && at.isIdentityOrTranslation()) {
+        if (!at.isIdentity()) {
+            platformContext()->rq().freeSpace(12)
+            << (jint)com_sun_webkit_graphics_GraphicsDecoder_TRANSLATE
+            << (float)at.e() << (float)at.f();
+        }
+        return;
+    }
     platformContext()->rq().freeSpace(28)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_CONCATTRANSFORM_FFFFFF
     << (float)at.a() << (float)at.b() << (float)at.c() << (float)at.d() << (float)at.e() << (float)at.f();
@@ -601,6 +640,10 @@ void GraphicsContextJava::setPlatformShadow(const FloatSize& s, float blur, cons
         height = -height;
     }
 
+    if (!platformContext()->shouldEmit(platformContext()->emittedState().shadow,
+            std::make_tuple(FloatSize(width, height), blur, color)))
+        return;
+
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
     platformContext()->rq().freeSpace(32)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSHADOW
@@ -617,6 +660,10 @@ void GraphicsContextJava::beginTransparencyLayer(float opacity)
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_BEGINTRANSPARENCYLAYER
     << opacity;
+
+    // The java side saves its state for the layer and resets the composite.
+    platformContext()->saveEmittedState();
+    platformContext()->emittedState().compositeOperator = std::nullopt;
 }
 
 void GraphicsContextJava::endTransparencyLayer()
@@ -626,6 +673,7 @@ void GraphicsContextJava::endTransparencyLayer()
 
     platformContext()->rq().freeSpace(4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_ENDTRANSPARENCYLAYER;
+    platformContext()->restoreEmittedState();
 
     GraphicsContext::endTransparencyLayer();
 }
@@ -647,9 +695,12 @@ void GraphicsContextJava::strokeRect(const FloatRect& rect, float lineWidth)
         return;
 
     if (strokeGradient()) {
+        FloatRect bounds(rect);
+        bounds.inflate(lineWidth / 2);
         setGradient(
             *strokeGradient(),
             strokeGradientSpaceTransform(),
+            bounds,
             platformContext(),
             com_sun_webkit_graphics_GraphicsDecoder_SET_STROKE_GRADIENT);
     }
@@ -718,6 +769,9 @@ void GraphicsContextJava::setMiterLimit(float limit)
 
 void GraphicsContextJava::setPlatformAlpha(float alpha)
 {
+    if (!platformContext()->shouldEmit(platformContext()->emittedState().alpha, alpha))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETALPHA
     << alpha;
@@ -728,6 +782,9 @@ void GraphicsContextJava::setPlatformCompositeOperation(CompositeOperator op, Bl
     if (paintingDisabled())
         return;
 
+    if (!platformContext()->shouldEmit(platformContext()->emittedState().compositeOperator, op))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETCOMPOSITE
     << (jint)op;
@@ -740,16 +797,19 @@ void GraphicsContextJava::strokePath(const Path& path)
         return;
 
     if (strokeGradient()) {
+        FloatRect bounds = path.fastBoundingRect();
+        bounds.inflate(strokeThickness() / 2);
         setGradient(
             *strokeGradient(),
             strokeGradientSpaceTransform(),
+            bounds,
             platformContext(),
             com_sun_webkit_graphics_GraphicsDecoder_SET_STROKE_GRADIENT);
     }
 
     platformContext()->rq().freeSpace(12)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_STROKE_PATH
-    << copyPath(path.platformPath())
+    << path.platformPath()
     << (jint)fillRule();
 }
 
@@ -766,7 +826,7 @@ static void setClipPath(
     state.clipBounds.intersect(state.transform.mapRect(path.fastBoundingRect()));
     gc.platformContext()->rq().freeSpace(16)
     << jint(com_sun_webkit_graphics_GraphicsDecoder_CLIP_PATH)
-    << copyPath(path.platformPath())
+    << path.platformPath()
     << jint(wrule == WindRule::EvenOdd
        ? com_sun_webkit_graphics_WCPath_RULE_EVENODD
        : com_sun_webkit_graphics_WCPath_RULE_NONZERO)
@@ -800,6 +860,27 @@ void GraphicsContextJava::drawPlatformImage(const PlatformImagePtr& image, const
     if (!image || !image->getImage())
         return;
 
+    // Runs of draws of one image with the current composite, e.g. canvas
+    // sprites, share a command
+    if (options.orientation() == ImageOrientation::Orientation::None
+        && options.compositeOperator() == compositeOperation()
+        && options.blendMode() == blendMode()) {
+        RenderingQueue& rq = platformContext()->rq();
+        const jint opcode = com_sun_webkit_graphics_GraphicsDecoder_DRAW_IMAGE_RECTS;
+        uint64_t key = reinterpret_cast<uintptr_t>(image->getImage().get());
+        if (!rq.extendBatch(opcode, key, 32)) {
+            rq.freeSpace(44)
+            << opcode << image->getImage();
+            rq.beginBatch(opcode, key);
+        }
+        rq << destRect.x() << destRect.y()
+        << destRect.width() << destRect.height()
+        << srcRect.x() << srcRect.y()
+        << srcRect.width() << srcRect.height();
+        rq.endBatchItem();
+        return;
+    }
+
     savePlatformState();
     setCompositeOperation(options.compositeOperator(), options.blendMode());
 
@@ -886,13 +967,14 @@ void GraphicsContextJava::fillPath(const Path& path)
             setGradient(
                 *fillGradient(),
                 fillGradientSpaceTransform(),
+                path.fastBoundingRect(),
                 platformContext(),
                 com_sun_webkit_graphics_GraphicsDecoder_SET_FILL_GRADIENT);
         }
 
         platformContext()->rq().freeSpace(12)
         << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILL_PATH
-        << copyPath(path.platformPath())
+        << path.platformPath()
         << (jint)fillRule();
     }
 }
@@ -1063,6 +1145,43 @@ void GraphicsContextJava::setCTM(const AffineTransform& tm)
 
 void Gradient::stopsChanged()
 {
+    m_javaStops = nullptr;
+}
+
+RefPtr<RQRef> Gradient::javaStops()
+{
+    if (m_javaStops)
+        return m_javaStops;
+
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID mid = env->GetMethodID(PG_GetGraphicsManagerClass(env),
+        "fwkCreateGradientStops", "(I[F)Lcom/sun/webkit/graphics/WCGradientStops;");
+    ASSERT(mid);
+
+    // Each stop is passed as r, g, b, a, offset.
+    Vector<jfloat> values;
+    values.reserveInitialCapacity(m_stops.size() * 5);
+    for (const auto& stop : m_stops) {
+        auto [r, g, b, a] = stop.color.toColorTypeLossy<SRGBA<float>>().resolved();
+        values.append(r);
+        values.append(g);
+        values.append(b);
+        values.append(a);
+        values.append(stop.offset);
+    }
+
+    JLocalRef<jfloatArray> jvalues(env->NewFloatArray(values.size()));
+    if (!jvalues) {
+        WTF::CheckAndClearException(env);
+        return nullptr;
+    }
+    env->SetFloatArrayRegion(jvalues, 0, values.size(), values.data());
+
+    JLObject ref(env->CallObjectMethod(PL_GetGraphicsManager(env), mid,
+        (jint)m_spreadMethod, (jfloatArray)jvalues));
+    WTF::CheckAndClearException(env);
+    m_javaStops = RQRef::create(ref);
+    return m_javaStops;
 }
 
 void Gradient::fill(GraphicsContext& gc, const FloatRect& rect)
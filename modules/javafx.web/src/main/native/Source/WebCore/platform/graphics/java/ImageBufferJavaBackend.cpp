@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,10 +31,39 @@
 #include "GraphicsContext.h"
 #include "ImageData.h"
 #include "MIMETypeRegistry.h"
+#include "PixelBufferConversion.h"
 #include "PlatformContextJava.h"
 #include "GraphicsContextJava.h"
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/WorkQueue.h>
 namespace WebCore {
 
+static WorkQueue& encodingQueue()
+{
+    static NeverDestroyed<Ref<WorkQueue>> queue(WorkQueue::create("com.sun.webkit.ImageEncoder"));
+    return queue.get();
+}
+
+static jmethodID encodePixelsMID(JNIEnv* env)
+{
+    static jmethodID midEncodePixels = env->GetMethodID(
+        PG_GetGraphicsManagerClass(env),
+        "encodePixels",
+        "(IILjava/nio/ByteBuffer;Ljava/lang/String;D)[B");
+    ASSERT(midEncodePixels);
+    return midEncodePixels;
+}
+
+static Vector<uint8_t> toVector(JNIEnv* env, jbyteArray jdata)
+{
+    uint8_t* dataArray = (uint8_t*)env->GetPrimitiveArrayCritical(jdata, 0);
+    Vector<uint8_t> data;
+    data.append(dataArray, env->GetArrayLength(jdata));
+    env->ReleasePrimitiveArrayCritical(jdata, dataArray, 0);
+    return data;
+}
+
 std::unique_ptr<ImageBufferJavaBackend> ImageBufferJavaBackend::create(
     const Parameters& parameters, const ImageBufferCreationContext&)
 {
@@ -102,12 +131,18 @@ ImageBufferJavaBackend::ImageBufferJavaBackend(
 {
 }
 
+ImageBufferJavaBackend::~ImageBufferJavaBackend()
+{
+    if (!m_pendingUpdateRect.isEmpty())
+        context().platformContext()->rq().setFlushCallback(nullptr);
+}
+
 JLObject ImageBufferJavaBackend::getWCImage() const
 {
     return m_image->getImage()->cloneLocalCopy();
 }
 
-Vector<uint8_t> ImageBufferJavaBackend::toDataJava(const String& mimeType, std::optional<double>)
+Vector<uint8_t> ImageBufferJavaBackend::toDataJava(const String& mimeType, std::optional<double> quality)
 {
     if (MIMETypeRegistry::isSupportedImageMIMETypeForEncoding(mimeType)) {
         // RenderQueue need to be processed before pixel buffer extraction.
@@ -119,25 +154,69 @@ Vector<uint8_t> ImageBufferJavaBackend::toDataJava(const String& mimeType, std::
         static jmethodID midToData = env->GetMethodID(
                 PG_GetImageClass(env),
                 "toData",
-                "(Ljava/lang/String;)[B");
+                "(Ljava/lang/String;D)[B");
         ASSERT(midToData);
 
         JLocalRef<jbyteArray> jdata((jbyteArray)env->CallObjectMethod(
                 getWCImage(),
                 midToData,
-                (jstring) JLString(mimeType.toJavaString(env))));
-
-        if (!WTF::CheckAndClearException(env) && jdata) {
-            uint8_t* dataArray = (uint8_t*)env->GetPrimitiveArrayCritical((jbyteArray)jdata, 0);
-            Vector<uint8_t> data;
-            data.append(dataArray, env->GetArrayLength(jdata));
-            env->ReleasePrimitiveArrayCritical(jdata, dataArray, 0);
-            return data;
-        }
+                (jstring) JLString(mimeType.toJavaString(env)),
+                (jdouble) quality.value_or(-1)));
+
+        if (!WTF::CheckAndClearException(env) && jdata)
+            return toVector(env, jdata);
     }
     return { };
 }
 
+void ImageBufferJavaBackend::toDataJavaAsync(const String& mimeType, std::optional<double> quality, CompletionHandler<void(Vector<uint8_t>&&)>&& completionHandler)
+{
+    if (!MIMETypeRegistry::isSupportedImageMIMETypeForEncoding(mimeType)) {
+        completionHandler({ });
+        return;
+    }
+
+    // RenderQueue need to be processed before pixel buffer extraction.
+    context().platformContext()->rq().flushBuffer();
+
+    auto* data = static_cast<const uint8_t*>(getData());
+    if (!data) {
+        completionHandler({ });
+        return;
+    }
+
+    // The pixel buffer keeps changing with the canvas, so the worker encodes
+    // a snapshot of it. The Java method is resolved here, as the classes
+    // cannot be looked up from a native thread.
+    Vector<uint8_t> pixels(data, bytesPerRow() * m_backendSize.height());
+    encodePixelsMID(WTF::GetJavaEnv());
+
+    encodingQueue().dispatch([pixels = WTFMove(pixels), size = m_backendSize, mimeType = mimeType.isolatedCopy(), quality, completionHandler = WTFMove(completionHandler)]() mutable {
+        Vector<uint8_t> result;
+        if (JNIEnv* env = WTF::GetJavaEnv()) {
+            JLObject buffer(env->NewDirectByteBuffer(pixels.data(), pixels.size()));
+            if (buffer) {
+                JLocalRef<jbyteArray> jdata((jbyteArray)env->CallObjectMethod(
+                        PL_GetGraphicsManager(env),
+                        encodePixelsMID(env),
+                        (jint) size.width(),
+                        (jint) size.height(),
+                        (jobject) buffer,
+                        (jstring) JLString(mimeType.toJavaString(env)),
+                        (jdouble) quality.value_or(-1)));
+
+                if (!WTF::CheckAndClearException(env) && jdata)
+                    result = toVector(env, jdata);
+            }
+            WTF::CheckAndClearException(env);
+        }
+
+        callOnMainThread([result = WTFMove(result), completionHandler = WTFMove(completionHandler)]() mutable {
+            completionHandler(WTFMove(result));
+        });
+    });
+}
+
 void *ImageBufferJavaBackend::getData() const
 {
     JNIEnv* env = WTF::GetJavaEnv();
@@ -161,6 +240,33 @@ void *ImageBufferJavaBackend::getData() const
     return env->GetDirectBufferAddress(byteBuffer);
 }
 
+// Returns the pixels of the rect only, as rows with no padding, without
+// reading back the entire backing store. Returns NULL if the image can't
+// read a rect on its own.
+void *ImageBufferJavaBackend::getData(const IntRect& rect) const
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    //RenderQueue need to be processed before pixel buffer extraction.
+    //For that purpose it has to be in actual state.
+    context().platformContext()->rq().flushBuffer();
+
+    static jmethodID midGetRectBGRABytes = env->GetMethodID(
+        PG_GetImageClass(env),
+        "getPixelBuffer",
+        "(IIII)Ljava/nio/ByteBuffer;");
+    ASSERT(midGetRectBGRABytes);
+
+    jobject pixelBuf = env->CallObjectMethod(getWCImage(), midGetRectBGRABytes,
+        (jint)rect.x(), (jint)rect.y(), (jint)rect.width(), (jint)rect.height());
+    if (WTF::CheckAndClearException(env) || !pixelBuf) {
+        return NULL;
+    }
+    JLObject byteBuffer(pixelBuf);
+
+    return env->GetDirectBufferAddress(byteBuffer);
+}
+
 void ImageBufferJavaBackend::update() const
 {
     JNIEnv* env = WTF::GetJavaEnv();
@@ -175,6 +281,29 @@ void ImageBufferJavaBackend::update() const
     WTF::CheckAndClearException(env);
 }
 
+void ImageBufferJavaBackend::update(const IntRect& rect) const
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID midUpdateByteBufferRect = env->GetMethodID(
+        PG_GetImageClass(env),
+        "drawPixelBuffer",
+        "(IIII)V");
+    ASSERT(midUpdateByteBufferRect);
+
+    env->CallVoidMethod(getWCImage(), midUpdateByteBufferRect,
+        (jint)rect.x(), (jint)rect.y(), (jint)rect.width(), (jint)rect.height());
+    WTF::CheckAndClearException(env);
+}
+
+void ImageBufferJavaBackend::flushPendingUpdate()
+{
+    IntRect rect = std::exchange(m_pendingUpdateRect, IntRect());
+    m_pendingUpdateData = nullptr;
+    if (!rect.isEmpty())
+        update(rect);
+}
+
 GraphicsContext& ImageBufferJavaBackend::context() const
 {
     return *m_context;
@@ -201,11 +330,41 @@ RefPtr<NativeImage> ImageBufferJavaBackend::copyNativeImageForDrawing(GraphicsCo
 
 void ImageBufferJavaBackend::getPixelBuffer(const IntRect& srcRect, PixelBuffer& destination)
 {
-    void *data = getData();
-    if (!data)
-        return;
-    return getPixelBuffer(srcRect, data, destination);
+    auto sourceRectClipped = intersection(backendRect(), srcRect);
+    void *rectData = !sourceRectClipped.isEmpty() ? getData(sourceRectClipped) : NULL;
+    if (!rectData) {
+        void *data = getData();
+        if (!data)
+            return;
+        return getPixelBuffer(srcRect, data, destination);
+    }
+
+    // Same as ImageBufferBackend::getPixelBuffer, with the source being the
+    // clipped rect only
+    IntRect destinationRect { IntPoint::zero(), sourceRectClipped.size() };
+
+    if (srcRect.x() < 0)
+        destinationRect.setX(-srcRect.x());
+
+    if (srcRect.y() < 0)
+        destinationRect.setY(-srcRect.y());
 
+    if (destinationRect.size() != srcRect.size())
+        destination.zeroFill();
+
+    ConstPixelBufferConversionView source {
+        { AlphaPremultiplication::Premultiplied, pixelFormat(), colorSpace() },
+        static_cast<unsigned>(4u * sourceRectClipped.width()),
+        static_cast<uint8_t*>(rectData)
+    };
+    unsigned destinationBytesPerRow = static_cast<unsigned>(4u * srcRect.width());
+    PixelBufferConversionView destinationView {
+        destination.format(),
+        destinationBytesPerRow,
+        destination.bytes() + destinationRect.y() * destinationBytesPerRow + destinationRect.x() * 4
+    };
+
+    convertImagePixels(source, destinationView, destinationRect.size());
 }
 
 void ImageBufferJavaBackend::getPixelBuffer(const IntRect& srcRect, void* data, PixelBuffer& destination)
@@ -218,18 +377,44 @@ void ImageBufferJavaBackend::getPixelBuffer(const IntRect& srcRect, void* data,
 void ImageBufferJavaBackend::putPixelBuffer(const PixelBuffer& sourcePixelBuffer, const IntRect& srcRect, const IntPoint& destPoint, AlphaPremultiplication destFormat, void* destination)
 {
     ImageBufferBackend::putPixelBuffer(sourcePixelBuffer, srcRect, destPoint, destFormat, destination);
-    update();
 
+    // Same destination rect as ImageBufferBackend::putPixelBuffer
+    auto sourceRectClipped = intersection({ IntPoint::zero(), sourcePixelBuffer.size() }, srcRect);
+    auto destinationRect = sourceRectClipped;
+    destinationRect.moveBy(destPoint);
+
+    if (srcRect.x() < 0)
+        destinationRect.setX(destinationRect.x() - srcRect.x());
+
+    if (srcRect.y() < 0)
+        destinationRect.setY(destinationRect.y() - srcRect.y());
+
+    destinationRect.intersect(backendRect());
+    if (destinationRect.isEmpty())
+        return;
+
+    // The upload is deferred to the next flush of the render queue, so
+    // that the rects of several putImageData calls are uploaded at once.
+    RenderingQueue& rq = context().platformContext()->rq();
+    if (m_pendingUpdateRect.isEmpty()) {
+        rq.setFlushCallback([this] {
+            flushPendingUpdate();
+        });
+    }
+    m_pendingUpdateRect.unite(destinationRect);
+    m_pendingUpdateData = destination;
 }
 
 void ImageBufferJavaBackend::putPixelBuffer(const PixelBuffer& sourcePixelBuffer, const IntRect& srcRect, const IntPoint& destPoint, AlphaPremultiplication destFormat)
 {
-    void *data = getData();
+    // While nothing was drawn since the last putPixelBuffer, its pixels are
+    // still up to date and there is no need to flush and get them again.
+    RenderingQueue& rq = context().platformContext()->rq();
+    void *data = m_pendingUpdateData && rq.hasFlushCallback() && rq.isBufferEmpty()
+        ? m_pendingUpdateData : getData();
     if (!data)
         return;
     putPixelBuffer(sourcePixelBuffer, srcRect, destPoint, destFormat, data);
-    update();
-
 }
 
 size_t ImageBufferJavaBackend::calculateMemoryCost(const Parameters& parameters)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,7 +36,7 @@ namespace WebCore {
 
 class ImageBufferJavaBackend : public ImageBufferBackend {
 public:
-    ~ImageBufferJavaBackend() {}
+    ~ImageBufferJavaBackend();
     static unsigned calculateBytesPerRow(const IntSize& backendSize);
     static size_t calculateMemoryCost(const Parameters&);
     void transformToColorSpace(const DestinationColorSpace&) override { }
@@ -46,8 +46,11 @@ public:
 
     JLObject getWCImage() const;
     Vector<uint8_t> toDataJava(const String& mimeType, std::optional<double>) override;
+    void toDataJavaAsync(const String& mimeType, std::optional<double>, CompletionHandler<void(Vector<uint8_t>&&)>&&) override;
     void* getData() const;
+    void* getData(const IntRect&) const;
     void update() const;
+    void update(const IntRect&) const;
 
     GraphicsContext& context() const override;
     void flushContext() override;
@@ -73,9 +76,17 @@ protected:
 
     unsigned bytesPerRow() const override;
 
+    void flushPendingUpdate();
+
     PlatformImagePtr m_image;
     std::unique_ptr<GraphicsContext> m_context;
     IntSize m_backendSize;
+
+    // The rect changed by putPixelBuffer and not uploaded yet, and the
+    // pixels it was written to. The upload is done when the render queue of
+    // the context is flushed.
+    IntRect m_pendingUpdateRect;
+    void* m_pendingUpdateData { nullptr };
 };
 
 } // namespace WebCore
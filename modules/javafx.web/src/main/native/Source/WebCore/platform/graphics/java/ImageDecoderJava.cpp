@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,12 +29,130 @@
 
 #include "NotImplemented.h"
 #include "SharedBuffer.h"
-#include "SharedBuffer.h"
 #include "PlatformJavaClasses.h"
 #include "Logging.h"
 
+#include <wtf/Condition.h>
+#include <wtf/Lock.h>
+#include <wtf/MainThread.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/NumberOfCores.h>
+#include <wtf/WorkQueue.h>
+
+#include "com_sun_webkit_graphics_WCImageDecoder.h"
+
 namespace WebCore {
 
+namespace ImageDecoderJavaInternal {
+
+// Counters for asynchronous decoding, indexed by the ASYNC_DECODE_*
+// constants of WCImageDecoder.
+static std::atomic<uint64_t> s_asyncDecodingCounters[com_sun_webkit_graphics_WCImageDecoder_ASYNC_DECODE_COUNTER_COUNT];
+
+static uint64_t asyncDecodingCounter(int counter)
+{
+    return s_asyncDecodingCounters[counter].load(std::memory_order_relaxed);
+}
+
+static void addToAsyncDecodingCounter(int counter, int64_t delta)
+{
+    s_asyncDecodingCounters[counter].fetch_add(static_cast<uint64_t>(delta), std::memory_order_relaxed);
+}
+
+// WebCore gives every image with pending asynchronous decodes its own
+// decoding queue. This bounds how many of them run WCImageDecoder work
+// at the same time, so a page with many large images does not contend
+// with the event thread for every core.
+class AsyncDecodingLimiter {
+    WTF_MAKE_NONCOPYABLE(AsyncDecodingLimiter);
+public:
+    static AsyncDecodingLimiter& singleton()
+    {
+        static NeverDestroyed<AsyncDecodingLimiter> limiter(defaultLimit());
+        return limiter;
+    }
+
+    void acquire()
+    {
+        Locker locker { m_lock };
+        m_condition.wait(m_lock, [this] {
+            return m_running < m_limit;
+        });
+        ++m_running;
+    }
+
+    void release()
+    {
+        {
+            Locker locker { m_lock };
+            ASSERT(m_running);
+            --m_running;
+        }
+        m_condition.notifyOne();
+    }
+
+private:
+    friend class NeverDestroyed<AsyncDecodingLimiter>;
+
+    explicit AsyncDecodingLimiter(unsigned limit)
+        : m_limit(limit)
+    {
+    }
+
+    static unsigned defaultLimit()
+    {
+        // Called on a decoding thread, which WorkQueue attaches to the JVM.
+        if (JNIEnv* env = WTF::GetJavaEnv()) {
+            jclass cls = PG_GetGraphicsImageDecoderClass(env);
+            static jmethodID mid = env->GetStaticMethodID(cls, "fwkGetAsyncDecodingThreads", "()I");
+            ASSERT(mid);
+            jint value = env->CallStaticIntMethod(cls, mid);
+            if (!WTF::CheckAndClearException(env) && value > 0)
+                return static_cast<unsigned>(value);
+        }
+        return std::clamp(WTF::numberOfProcessorCores() / 2, 1, 4);
+    }
+
+    Lock m_lock;
+    Condition m_condition;
+    const unsigned m_limit;
+    unsigned m_running WTF_GUARDED_BY_LOCK(m_lock) { 0 };
+};
+
+// Holds a decoding slot for the lifetime of an asynchronous frame decode
+// and records its latency, including the time spent waiting for the slot.
+class AsyncDecodingScope {
+    WTF_MAKE_NONCOPYABLE(AsyncDecodingScope);
+public:
+    AsyncDecodingScope()
+        : m_startTime(MonotonicTime::now())
+    {
+        addToAsyncDecodingCounter(com_sun_webkit_graphics_WCImageDecoder_ASYNC_DECODE_QUEUED, 1);
+        AsyncDecodingLimiter::singleton().acquire();
+        addToAsyncDecodingCounter(com_sun_webkit_graphics_WCImageDecoder_ASYNC_DECODE_QUEUED, -1);
+        addToAsyncDecodingCounter(com_sun_webkit_graphics_WCImageDecoder_ASYNC_DECODE_RUNNING, 1);
+    }
+
+    ~AsyncDecodingScope()
+    {
+        AsyncDecodingLimiter::singleton().release();
+        addToAsyncDecodingCounter(com_sun_webkit_graphics_WCImageDecoder_ASYNC_DECODE_RUNNING, -1);
+
+        auto latency = static_cast<uint64_t>((MonotonicTime::now() - m_startTime).nanoseconds());
+        addToAsyncDecodingCounter(com_sun_webkit_graphics_WCImageDecoder_ASYNC_DECODE_DECODED, 1);
+        addToAsyncDecodingCounter(com_sun_webkit_graphics_WCImageDecoder_ASYNC_DECODE_TOTAL_NANOS, latency);
+        auto& maxLatency = s_asyncDecodingCounters[com_sun_webkit_graphics_WCImageDecoder_ASYNC_DECODE_MAX_NANOS];
+        uint64_t previous = maxLatency.load(std::memory_order_relaxed);
+        while (previous < latency && !maxLatency.compare_exchange_weak(previous, latency, std::memory_order_relaxed)) { }
+    }
+
+private:
+    MonotonicTime m_startTime;
+};
+
+} // namespace ImageDecoderJavaInternal
+
 #ifndef NDEBUG
   struct ImageDecoderCounter {
     static int created;
@@ -73,6 +191,22 @@ ImageDecoderJava::ImageDecoderJava()
         PL_GetGraphicsManager(env),
         midGetImageDecoder));
 
+    if (WTF::CheckAndClearException(env) || !m_nativeDecoder) {
+        return;
+    }
+
+    setNativeDecoder(env, m_nativeDecoder, this);
+}
+
+void ImageDecoderJava::setNativeDecoder(JNIEnv* env, jobject decoder, ImageDecoderJava* nativeDecoder)
+{
+    static jmethodID midSetNativeDecoder = env->GetMethodID(
+        PG_GetGraphicsImageDecoderClass(env),
+        "fwkSetNativeDecoder",
+        "(J)V");
+    ASSERT(midSetNativeDecoder);
+
+    env->CallVoidMethod(decoder, midSetNativeDecoder, ptr_to_jlong(nativeDecoder));
     WTF::CheckAndClearException(env);
 }
 
@@ -87,6 +221,9 @@ ImageDecoderJava::~ImageDecoderJava()
         return;
     }
 
+    // Waits for an update in progress on another thread.
+    setNativeDecoder(env, m_nativeDecoder, nullptr);
+
     static jmethodID midDestroy = env->GetMethodID(
             PG_GetGraphicsImageDecoderClass(env),
             "destroy",
@@ -97,6 +234,40 @@ ImageDecoderJava::~ImageDecoderJava()
     WTF::CheckAndClearException(env);
 }
 
+// Segments at least this large are handed to Java as they are; smaller ones
+// are copied into a staging buffer and sent together, so the number of JNI
+// crossings depends on the amount of data rather than on the segment count.
+static constexpr size_t imageDataDirectSegmentSize = 64 * 1024;
+static constexpr size_t imageDataCoalesceLimit = 1024 * 1024;
+
+void ImageDecoderJava::addImageData(JNIEnv* env, const uint8_t* bytes, size_t length)
+{
+    static jmethodID midAddImageData = env->GetMethodID(
+        PG_GetGraphicsImageDecoderClass(env),
+        "addImageData",
+        "(Ljava/nio/ByteBuffer;)V");
+    ASSERT(midAddImageData);
+
+    // The buffer aliases native memory owned by m_data (or m_coalesceBuffer)
+    // and is only valid for the duration of the call.
+    JLObject buffer(bytes
+        ? env->NewDirectByteBuffer(const_cast<uint8_t*>(bytes), static_cast<jlong>(length))
+        : nullptr);
+    if (bytes && (!buffer || WTF::CheckAndClearException(env)))
+        return;
+
+    env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jobject)buffer);
+    WTF::CheckAndClearException(env);
+}
+
+void ImageDecoderJava::flushCoalescedImageData(JNIEnv* env)
+{
+    if (m_coalesceBuffer.isEmpty())
+        return;
+    addImageData(env, m_coalesceBuffer.data(), m_coalesceBuffer.size());
+    m_coalesceBuffer.shrink(0);
+}
+
 void ImageDecoderJava::setData(const FragmentedSharedBuffer& data, bool allDataReceived)
 {
     JNIEnv* env = WTF::GetJavaEnv();
@@ -104,95 +275,158 @@ void ImageDecoderJava::setData(const FragmentedSharedBuffer& data, bool allDataR
         return;
     }
 
-    static jmethodID midAddImageData = env->GetMethodID(
-        PG_GetGraphicsImageDecoderClass(env),
-        "addImageData",
-        "([B)V");
-    ASSERT(midAddImageData);
+    // Keep the segments alive while Java reads from them.
+    m_data = &data;
 
     while (m_receivedDataSize < data.size()) {
-        const auto& someData = data.getSomeData(m_receivedDataSize);
-        unsigned length = someData.size();
-        JLByteArray jArray(env->NewByteArray(length));
-        if (jArray && !WTF::CheckAndClearException(env)) {
-            // not OOME in Java
-            env->SetByteArrayRegion(jArray, 0, length, (const jbyte*)someData.data());
-            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jbyteArray)jArray);
-            WTF::CheckAndClearException(env);
+        auto someData = data.getSomeData(m_receivedDataSize);
+        size_t length = someData.size();
+        if (length >= imageDataDirectSegmentSize) {
+            flushCoalescedImageData(env);
+            addImageData(env, someData.data(), length);
+        } else {
+            if (m_coalesceBuffer.size() + length > imageDataCoalesceLimit)
+                flushCoalescedImageData(env);
+            m_coalesceBuffer.append(someData.data(), length);
         }
         m_receivedDataSize += length;
     }
+    flushCoalescedImageData(env);
 
     if (allDataReceived) {
         m_isAllDataReceived = true;
-        env->CallVoidMethod(m_nativeDecoder, midAddImageData, 0);
-        WTF::CheckAndClearException(env);
+        addImageData(env, nullptr, 0);
+        m_coalesceBuffer.clear();
     }
+    m_data = nullptr;
 }
 
-bool ImageDecoderJava::isSizeAvailable() const
+void ImageDecoderJava::updateProperties(const IntSize& size, bool framesDecoded, Vector<jint>&& frameProperties)
 {
-    JNIEnv* env = WTF::GetJavaEnv();
-    if (!env || !m_nativeDecoder) {
-        return { };
-    }
-
-    static jmethodID midGetImageSize = env->GetMethodID(
-        PG_GetGraphicsImageDecoderClass(env),
-        "getImageSize",
-        "()[I");
-    ASSERT(midGetImageSize);
+    Locker locker { m_propertiesLock };
+    m_size = size;
+    m_framesDecoded = framesDecoded;
+    m_frameProperties = WTFMove(frameProperties);
+}
 
-    JLocalRef<jintArray> jsize((jintArray)env->CallObjectMethod(
-                m_nativeDecoder, midGetImageSize));
-    WTF::CheckAndClearException(env);
+const jint* ImageDecoderJava::frameProperties(size_t idx) const
+{
+    size_t offset = idx * com_sun_webkit_graphics_WCImageDecoder_FRAME_PROPERTY_COUNT;
+    if (offset + com_sun_webkit_graphics_WCImageDecoder_FRAME_PROPERTY_COUNT > m_frameProperties.size())
+        return nullptr;
+    return m_frameProperties.data() + offset;
+}
 
-    jint* size = (jint*)env->GetPrimitiveArrayCritical((jintArray)jsize, 0);
-    m_size.setWidth(size[0]);
-    m_size.setHeight(size[1]);
-    env->ReleasePrimitiveArrayCritical(jsize, size, 0);
+size_t ImageDecoderJava::knownFrameCount() const
+{
+    Locker locker { m_propertiesLock };
+    return std::max<size_t>(m_frameProperties.size() / com_sun_webkit_graphics_WCImageDecoder_FRAME_PROPERTY_COUNT, 1);
+}
 
-    return m_size.width();
+bool ImageDecoderJava::isSizeAvailable() const
+{
+    Locker locker { m_propertiesLock };
+    return !m_size.isEmpty();
 }
 
 size_t ImageDecoderJava::frameCount() const
 {
+    // The frames are decoded, and their count becomes known, once
+    // WCImageDecoder.getFrameCount() is called after all data is received.
+    bool needsFrameCount = false;
+    if (m_isAllDataReceived) {
+        Locker locker { m_propertiesLock };
+        needsFrameCount = !m_framesDecoded && !m_frameCountRequested;
+        m_frameCountRequested = true;
+    }
+
     JNIEnv* env = WTF::GetJavaEnv();
-    if (!env || !m_nativeDecoder) {
-        return { };
+    if (needsFrameCount && env && m_nativeDecoder) {
+        static jmethodID midGetFrameCount = env->GetMethodID(
+            PG_GetGraphicsImageDecoderClass(env),
+            "getFrameCount",
+            "()I");
+        ASSERT(midGetFrameCount);
+
+        // The count comes back through updateProperties().
+        env->CallIntMethod(m_nativeDecoder, midGetFrameCount);
+        WTF::CheckAndClearException(env);
     }
 
-    static jmethodID midGetFrameCount = env->GetMethodID(
-        PG_GetGraphicsImageDecoderClass(env),
-        "getFrameCount",
-        "()I");
-    ASSERT(midGetFrameCount);
+    return knownFrameCount();
+}
 
-    jint count = env->CallIntMethod(m_nativeDecoder, midGetFrameCount);
-    WTF::CheckAndClearException(env);
+static IntSize subsampledSize(const IntSize& size, SubsamplingLevel subsamplingLevel)
+{
+    // Every level halves both dimensions, rounding up like the DCT scaling
+    // done by the JPEG loader.
+    int shift = static_cast<int>(subsamplingLevel);
+    if (shift <= 0)
+        return size;
+    int scale = 1 << shift;
+    return IntSize((size.width() + scale - 1) / scale, (size.height() + scale - 1) / scale);
+}
 
-    return count < 1
-        ? 1
-        : count;
+// Animated images get this many frames decoded ahead of the one being
+// displayed, as long as they fit in the budget.
+static constexpr size_t decodeAheadFrameCount = 2;
+static constexpr size_t decodeAheadBudget = 16 * 1024 * 1024;
+
+static WorkQueue& decodeAheadQueue()
+{
+    static NeverDestroyed<Ref<WorkQueue>> queue(WorkQueue::create("com.sun.webkit.ImageDecoder.decodeAhead"));
+    return queue.get();
 }
 
-PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, SubsamplingLevel, const DecodingOptions&)
+PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, SubsamplingLevel subsamplingLevel, const DecodingOptions& decodingOptions)
 {
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
         return { };
     }
 
+    // A zero size asks for the frame at its original size.
+    IntSize requestedSize;
+    if (subsamplingLevel != SubsamplingLevel::Default)
+        requestedSize = subsampledSize(frameSizeAtIndex(idx), subsamplingLevel);
+    if (auto sizeForDrawing = decodingOptions.sizeForDrawing()) {
+        if (requestedSize.isEmpty() || sizeForDrawing->area() < requestedSize.area())
+            requestedSize = *sizeForDrawing;
+    }
+
+    // Only animations advancing at the original size are decoded ahead.
+    bool isAnimationFrame = requestedSize.isEmpty() && m_isAllDataReceived && knownFrameCount() > 1;
+    if (isAnimationFrame) {
+        auto image = takeDecodedAheadFrame(idx);
+        decodeAhead(idx + 1);
+        if (image)
+            return image;
+    }
+
+    // ImageSource runs asynchronous decodes on its decoding queue and hands
+    // the frame back to the main thread itself, only the concurrency is
+    // limited here.
+    std::optional<ImageDecoderJavaInternal::AsyncDecodingScope> asyncDecodingScope;
+    if (decodingOptions.decodingMode() == DecodingMode::Asynchronous && !isMainThread())
+        asyncDecodingScope.emplace();
+
+    return createFrameImage(env, idx, requestedSize);
+}
+
+PlatformImagePtr ImageDecoderJava::createFrameImage(JNIEnv* env, size_t idx, const IntSize& requestedSize)
+{
     static jmethodID midGetFrame = env->GetMethodID(
         PG_GetGraphicsImageDecoderClass(env),
         "getFrame",
-        "(I)Lcom/sun/webkit/graphics/WCImageFrame;");
+        "(III)Lcom/sun/webkit/graphics/WCImageFrame;");
     ASSERT(midGetFrame);
 
     JLObject frame(env->CallObjectMethod(
         m_nativeDecoder,
         midGetFrame,
-        idx));
+        idx,
+        requestedSize.width(),
+        requestedSize.height()));
     WTF::CheckAndClearException(env);
 
     if(!frame)
@@ -217,22 +451,106 @@ PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, Subsampli
     return ImageJava::create(RQRef::create(frame), nullptr, frameSize.width(), frameSize.height());
 }
 
-WTF::Seconds ImageDecoderJava::frameDurationAtIndex(size_t idx) const
+PlatformImagePtr ImageDecoderJava::takeDecodedAheadFrame(size_t idx)
+{
+    Locker locker { m_decodedAheadLock };
+    for (size_t i = 0; i < m_decodedAheadFrames.size(); ++i) {
+        if (m_decodedAheadFrames[i].index != idx)
+            continue;
+        auto image = WTFMove(m_decodedAheadFrames[i].image);
+        m_decodedAheadBytes -= m_decodedAheadFrames[i].bytes;
+        m_decodedAheadFrames.remove(i);
+        return image;
+    }
+    return nullptr;
+}
+
+void ImageDecoderJava::decodeAhead(size_t idx)
+{
+    size_t count = knownFrameCount();
+    Vector<size_t> indices;
+    {
+        Locker locker { m_decodedAheadLock };
+        if (m_isDecodingAhead)
+            return;
+        for (size_t i = 0; i < decodeAheadFrameCount; ++i) {
+            size_t index = (idx + i) % count;
+            if (!m_decodedAheadFrames.containsIf([index](auto& frame) { return frame.index == index; }))
+                indices.append(index);
+        }
+        if (indices.isEmpty())
+            return;
+        m_isDecodingAhead = true;
+    }
+
+    decodeAheadQueue().dispatch([protectedThis = Ref { *this }, indices = WTFMove(indices)] () mutable {
+        if (JNIEnv* env = WTF::GetJavaEnv()) {
+            ImageDecoderJavaInternal::AsyncDecodingScope asyncDecodingScope;
+            for (size_t index : indices) {
+                auto image = protectedThis->createFrameImage(env, index, { });
+                if (!image || !protectedThis->cacheDecodedAheadFrame(index, WTFMove(image)))
+                    break;
+            }
+        }
+        {
+            Locker locker { protectedThis->m_decodedAheadLock };
+            protectedThis->m_isDecodingAhead = false;
+        }
+        // Ensure destruction happens on the main thread.
+        callOnMainThread([protectedThis = WTFMove(protectedThis)] { });
+    });
+}
+
+bool ImageDecoderJava::cacheDecodedAheadFrame(size_t idx, PlatformImagePtr&& image)
+{
+    size_t bytes = static_cast<size_t>(image->size().area()) * 4;
+    Locker locker { m_decodedAheadLock };
+    if (m_decodedAheadBytes + bytes > decodeAheadBudget)
+        return false;
+    m_decodedAheadBytes += bytes;
+    m_decodedAheadFrames.append({ idx, bytes, WTFMove(image) });
+    return true;
+}
+
+void ImageDecoderJava::clearFrameBufferCache(size_t beforeFrame)
 {
+    // BitmapImage destroys the frames it no longer needs and calls this
+    // with the current frame, keep only the frames following it.
+    size_t count = knownFrameCount();
+    {
+        Locker locker { m_decodedAheadLock };
+        m_decodedAheadFrames.removeAllMatching([&](auto& frame) {
+            size_t distance = (frame.index + count - beforeFrame) % count;
+            if (distance && distance <= decodeAheadFrameCount)
+                return false;
+            m_decodedAheadBytes -= frame.bytes;
+            return true;
+        });
+    }
+
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
-        return { };
+        return;
     }
-    static jmethodID midGetDuration = env->GetMethodID(
+
+    static jmethodID midClearFrameBufferCache = env->GetMethodID(
         PG_GetGraphicsImageDecoderClass(env),
-        "getFrameDuration",
-        "(I)I");
-    ASSERT(midGetDuration);
-    jint duration = env->CallIntMethod(
-                        m_nativeDecoder,
-                        midGetDuration,
-                        idx);
-    return WTF::Seconds::fromMilliseconds(duration);
+        "clearFrameBufferCache",
+        "(I)V");
+    ASSERT(midClearFrameBufferCache);
+
+    env->CallVoidMethod(m_nativeDecoder, midClearFrameBufferCache, (jint)beforeFrame);
+    WTF::CheckAndClearException(env);
+}
+
+WTF::Seconds ImageDecoderJava::frameDurationAtIndex(size_t idx) const
+{
+    Locker locker { m_propertiesLock };
+    auto* properties = frameProperties(idx);
+    if (!properties) {
+        return { };
+    }
+    return WTF::Seconds::fromMilliseconds(properties[com_sun_webkit_graphics_WCImageDecoder_FRAME_DURATION]);
 }
 
 EncodedDataStatus ImageDecoderJava::encodedDataStatus() const
@@ -245,38 +563,27 @@ EncodedDataStatus ImageDecoderJava::encodedDataStatus() const
 
 IntSize ImageDecoderJava::size() const
 {
+    Locker locker { m_propertiesLock };
     return m_size;
 }
 
-IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel) const
+IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel subsamplingLevel) const
 {
-    JNIEnv* env = WTF::GetJavaEnv();
-    if (!env || !m_nativeDecoder) {
-        return { };
+    Locker locker { m_propertiesLock };
+    IntSize frameSize = m_size;
+    // Frames without metadata have the size of the image.
+    if (auto* properties = frameProperties(idx)) {
+        IntSize size(properties[com_sun_webkit_graphics_WCImageDecoder_FRAME_WIDTH],
+            properties[com_sun_webkit_graphics_WCImageDecoder_FRAME_HEIGHT]);
+        if (!size.isZero())
+            frameSize = size;
     }
-    static jmethodID midGetFrameSize = env->GetMethodID(
-        PG_GetGraphicsImageDecoderClass(env),
-        "getFrameSize",
-        "(I)[I");
-    ASSERT(midGetFrameSize);
-    JLocalRef<jintArray> jsize((jintArray)env->CallObjectMethod(
-                        m_nativeDecoder,
-                        midGetFrameSize,
-                        idx));
-    if (!jsize) {
-        return m_size;
-    }
-
-    jint* size = (jint*)env->GetPrimitiveArrayCritical((jintArray)jsize, 0);
-    IntSize frameSize(size[0], size[1]);
-    env->ReleasePrimitiveArrayCritical(jsize, size, 0);
-
-    return frameSize;
+    return subsampledSize(frameSize, subsamplingLevel);
 }
 
 bool ImageDecoderJava::frameAllowSubsamplingAtIndex(size_t) const
 {
-    notImplemented();
+    // WCImageDecoder.getFrame() decodes at a reduced size on request.
     return true;
 }
 
@@ -288,18 +595,9 @@ bool ImageDecoderJava::frameHasAlphaAtIndex(size_t) const
 
 bool ImageDecoderJava::frameIsCompleteAtIndex(size_t idx) const
 {
-    JNIEnv* env = WTF::GetJavaEnv();
-    if (!env || !m_nativeDecoder) {
-        return { };
-    }
-    static jmethodID midGetFrameIsComplete = env->GetMethodID(
-        PG_GetGraphicsImageDecoderClass(env),
-        "getFrameCompleteStatus",
-        "(I)Z");
-    ASSERT(midGetFrameIsComplete);
-    return (bool)env->CallBooleanMethod(m_nativeDecoder,
-            midGetFrameIsComplete,
-            idx);
+    Locker locker { m_propertiesLock };
+    auto* properties = frameProperties(idx);
+    return properties && properties[com_sun_webkit_graphics_WCImageDecoder_FRAME_COMPLETE];
 }
 
 unsigned ImageDecoderJava::frameBytesAtIndex(size_t idx, SubsamplingLevel samplingLevel) const
@@ -352,3 +650,23 @@ size_t ImageDecoderJava::bytesDecodedToDetermineProperties() const
     return 13088;
 }
 } // namespace WebCore
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCImageDecoder_twkGetAsyncDecodingCounters
+    (JNIEnv* env, jclass, jlongArray counters)
+{
+    using namespace WebCore::ImageDecoderJavaInternal;
+    jsize count = std::min<jsize>(env->GetArrayLength(counters), com_sun_webkit_graphics_WCImageDecoder_ASYNC_DECODE_COUNTER_COUNT);
+    for (jsize i = 0; i < count; ++i) {
+        jlong value = static_cast<jlong>(asyncDecodingCounter(i));
+        env->SetLongArrayRegion(counters, i, 1, &value);
+    }
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCImageDecoder_twkUpdateProperties
+    (JNIEnv* env, jclass, jlong nativeDecoder, jint width, jint height, jboolean framesDecoded, jintArray jframeProperties)
+{
+    auto* decoder = static_cast<WebCore::ImageDecoderJava*>(jlong_to_ptr(nativeDecoder));
+    Vector<jint> frameProperties(env->GetArrayLength(jframeProperties));
+    env->GetIntArrayRegion(jframeProperties, 0, frameProperties.size(), frameProperties.data());
+    decoder->updateProperties(WebCore::IntSize(width, height), framesDecoded, WTFMove(frameProperties));
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,7 @@
 #include "RQRef.h"
 
 #include <jni.h>
+#include <wtf/Lock.h>
 
 namespace WebCore {
 
@@ -74,17 +75,53 @@ public:
 
     void setData(const FragmentedSharedBuffer&, bool allDataReceived) final;
     bool isAllDataReceived() const final { return m_isAllDataReceived;}
-    void clearFrameBufferCache(size_t) final {  }
+    void clearFrameBufferCache(size_t) final;
 
     JLObject nativeDecoder() const { return m_nativeDecoder; }
 
+    // Called by WCImageDecoder, on any thread, when properties change.
+    void updateProperties(const IntSize&, bool framesDecoded, Vector<jint>&& frameProperties);
+
 protected:
+    static void setNativeDecoder(JNIEnv*, jobject, ImageDecoderJava*);
+    const jint* frameProperties(size_t) const WTF_REQUIRES_LOCK(m_propertiesLock);
+    size_t knownFrameCount() const;
+
+    PlatformImagePtr createFrameImage(JNIEnv*, size_t, const IntSize& requestedSize);
+    PlatformImagePtr takeDecodedAheadFrame(size_t);
+    void decodeAhead(size_t);
+    bool cacheDecodedAheadFrame(size_t, PlatformImagePtr&&);
+
+    void addImageData(JNIEnv*, const uint8_t*, size_t);
+    void flushCoalescedImageData(JNIEnv*);
+
     bool m_isAllDataReceived { false };
     size_t m_receivedDataSize { 0 };
+    RefPtr<const FragmentedSharedBuffer> m_data;
+    Vector<uint8_t> m_coalesceBuffer;
     mutable EncodedDataStatus m_encodedDataStatus { EncodedDataStatus::Unknown };
     // Native Handle for Java object.
     JGObject m_nativeDecoder;
-    mutable IntSize m_size;
+
+    // Properties pushed by WCImageDecoder, WebCore queries them often
+    // during layout and animation. Frame properties are packed as laid
+    // out by the WCImageDecoder.FRAME_* offsets.
+    mutable Lock m_propertiesLock;
+    IntSize m_size WTF_GUARDED_BY_LOCK(m_propertiesLock);
+    bool m_framesDecoded WTF_GUARDED_BY_LOCK(m_propertiesLock) { false };
+    mutable bool m_frameCountRequested WTF_GUARDED_BY_LOCK(m_propertiesLock) { false };
+    Vector<jint> m_frameProperties WTF_GUARDED_BY_LOCK(m_propertiesLock);
+
+    // Frames of an animation decoded on a worker before they are shown.
+    struct DecodedAheadFrame {
+        size_t index;
+        size_t bytes;
+        PlatformImagePtr image;
+    };
+    Lock m_decodedAheadLock;
+    Vector<DecodedAheadFrame> m_decodedAheadFrames WTF_GUARDED_BY_LOCK(m_decodedAheadLock);
+    size_t m_decodedAheadBytes WTF_GUARDED_BY_LOCK(m_decodedAheadLock) { 0 };
+    bool m_isDecodingAhead WTF_GUARDED_BY_LOCK(m_decodedAheadLock) { false };
 };
 
 } // namespace WebCore
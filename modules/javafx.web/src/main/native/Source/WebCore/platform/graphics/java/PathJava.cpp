@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 #include "config.h"
 
 #include "PathJava.h"
+#include "AffineTransform.h"
 #include "FloatRect.h"
 #include "PlatformContextJava.h"
 #include "PlatformJavaClasses.h"
@@ -36,6 +37,7 @@
 #include "ImageBuffer.h"
 #include "PathStream.h"
 
+#include <wtf/MathExtras.h>
 #include <wtf/text/WTFString.h>
 #include <wtf/java/JavaRef.h>
 
@@ -59,6 +61,11 @@ UniqueRef<PathJava> PathJava::create(const PathStream& stream)
     return pathJava;
 }
 
+UniqueRef<PathJava> PathJava::create(UniqueRef<PathStream>&& elements)
+{
+    return makeUniqueRef<PathJava>(WTFMove(elements));
+}
+
 RefPtr<RQRef> createEmptyPath()
 {
     JNIEnv* env = WTF::GetJavaEnv();
@@ -72,61 +79,97 @@ RefPtr<RQRef> createEmptyPath()
     return RQRef::create(ref);
 }
 
-static GraphicsContext& scratchContext()
+// Creates the Java path from the segments in a single call.
+static RefPtr<RQRef> createPlatformPath(const PathStream& elements)
 {
-    static auto img = ImageBuffer::create(FloatSize(1.f, 1.f), RenderingPurpose::Unspecified, 1, DestinationColorSpace::SRGB(), PixelFormat::BGRA8);
-    static GraphicsContext &context = img->context();
-    return context;
-}
+    Vector<jbyte> types;
+    Vector<jfloat> coords;
+    auto addPoint = [&](const FloatPoint& p) {
+        coords.append(p.x());
+        coords.append(p.y());
+    };
+    elements.applyElements([&](const PathElement& element) {
+        switch (element.type) {
+        case PathElement::Type::MoveToPoint:
+            types.append(com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO);
+            addPoint(element.points[0]);
+            break;
+        case PathElement::Type::AddLineToPoint:
+            types.append(com_sun_webkit_graphics_WCPathIterator_SEG_LINETO);
+            addPoint(element.points[0]);
+            break;
+        case PathElement::Type::AddQuadCurveToPoint:
+            types.append(com_sun_webkit_graphics_WCPathIterator_SEG_QUADTO);
+            addPoint(element.points[0]);
+            addPoint(element.points[1]);
+            break;
+        case PathElement::Type::AddCurveToPoint:
+            types.append(com_sun_webkit_graphics_WCPathIterator_SEG_CUBICTO);
+            addPoint(element.points[0]);
+            addPoint(element.points[1]);
+            addPoint(element.points[2]);
+            break;
+        case PathElement::Type::CloseSubpath:
+            types.append(com_sun_webkit_graphics_WCPathIterator_SEG_CLOSE);
+            break;
+        }
+    });
 
-RefPtr<RQRef> copyPath(RefPtr<RQRef> p)
-{
-    if (!p) {
+    if (types.isEmpty())
         return createEmptyPath();
-    }
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(PG_GetGraphicsManagerClass(env),
-        "createWCPath",
-        "(Lcom/sun/webkit/graphics/WCPath;)Lcom/sun/webkit/graphics/WCPath;");
+        "createWCPath", "([BI[FI)Lcom/sun/webkit/graphics/WCPath;");
     ASSERT(mid);
 
-    JLObject ref(env->CallObjectMethod(PL_GetGraphicsManager(env), mid, (jobject)*p));
+    JLocalRef<jbyteArray> jtypes(env->NewByteArray(types.size()));
+    JLocalRef<jfloatArray> jcoords(env->NewFloatArray(coords.size()));
+    if (!jtypes || !jcoords) {
+        WTF::CheckAndClearException(env);
+        return createEmptyPath();
+    }
+    env->SetByteArrayRegion(jtypes, 0, types.size(), types.data());
+    env->SetFloatArrayRegion(jcoords, 0, coords.size(), coords.data());
+
+    JLObject ref(env->CallObjectMethod(PL_GetGraphicsManager(env), mid,
+        (jbyteArray)jtypes, (jint)types.size(),
+        (jfloatArray)jcoords, (jint)coords.size()));
     ASSERT(ref);
     WTF::CheckAndClearException(env);
-
     return RQRef::create(ref);
 }
 
-UniqueRef<PathJava> PathJava::create(RefPtr<RQRef>&& platformPath, std::unique_ptr<PathStream>&& elementsStream)
+static GraphicsContext& scratchContext()
 {
-    return makeUniqueRef<PathJava>(WTFMove(platformPath), WTFMove(elementsStream));
+    static auto img = ImageBuffer::create(FloatSize(1.f, 1.f), RenderingPurpose::Unspecified, 1, DestinationColorSpace::SRGB(), PixelFormat::BGRA8);
+    static GraphicsContext &context = img->context();
+    return context;
 }
 
 PathJava::PathJava()
-    : m_platformPath(createEmptyPath())
-    , m_elementsStream(PathStream::create().moveToUniquePtr())
+    : m_elements(PathStream::create())
 {
 }
 
-PathJava::PathJava(RefPtr<RQRef>&& platformPath, std::unique_ptr<PathStream>&& elementsStream)
-    : m_platformPath(WTFMove(platformPath))
-    , m_elementsStream(WTFMove(elementsStream))
+PathJava::PathJava(UniqueRef<PathStream>&& elements)
+    : m_elements(WTFMove(elements))
 {
-    ASSERT(m_platformPath);
 }
 
 UniqueRef<PathImpl> PathJava::clone() const
 {
-    RefPtr<RQRef> platformPathCopy(copyPath(platformPath()));
-
-    auto elementsStream = m_elementsStream ? m_elementsStream->clone().moveToUniquePtr() : nullptr;
-
-    return PathJava::create(WTFMove(platformPathCopy), std::unique_ptr<PathStream> { downcast<PathStream>(elementsStream.release()) });
+    auto path = PathJava::create(PathStream::create(m_elements->segments()));
+    // The Java path is shared until one of the copies changes.
+    path->m_platformPath = m_platformPath;
+    return path;
 }
 
 PlatformPathPtr PathJava::platformPath() const
 {
+    if (!m_platformPath)
+        m_platformPath = createPlatformPath(m_elements.get());
     return m_platformPath.get();
 }
 
@@ -134,66 +177,61 @@ bool PathJava::operator==(const PathImpl& other) const
 {
     if (!is<PathJava>(other))
         return false;
-    return m_platformPath == downcast<PathJava>(other).m_platformPath;
+    return elements() == downcast<PathJava>(other).elements();
 }
 
 void PathJava::moveTo(const FloatPoint& p)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "moveTo",
-        "(DD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)p.x(), (jdouble)p.y());
-    WTF::CheckAndClearException(env);
+    m_elements->moveTo(p);
+    didChange();
 }
 
 void PathJava::addLineTo(const FloatPoint& p)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addLineTo",
-        "(DD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)p.x(), (jdouble)p.y());
-    WTF::CheckAndClearException(env);
+    m_elements->addLineTo(p);
+    didChange();
 }
 
 void PathJava::addQuadCurveTo(const FloatPoint& cp, const FloatPoint& p)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addQuadCurveTo",
-                                            "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)cp.x(), (jdouble)cp.y(), (jdouble)p.x(), (jdouble)p.y());
-    WTF::CheckAndClearException(env);
+    m_elements->addQuadCurveTo(cp, p);
+    didChange();
 }
 
 void PathJava::addBezierCurveTo(const FloatPoint& controlPoint1, const FloatPoint& controlPoint2, const FloatPoint& endPoint)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "addBezierCurveTo", "(DDDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)controlPoint1.x(), (jdouble)controlPoint1.y(),
-                        (jdouble)controlPoint2.x(), (jdouble)controlPoint2.y(),
-                        (jdouble)endPoint.x(), (jdouble)endPoint.y());
-    WTF::CheckAndClearException(env);
+    m_elements->addBezierCurveTo(controlPoint1, controlPoint2, endPoint);
+    didChange();
+}
+
+// Appends the arc as bezier curves of at most a quarter turn each, starting
+// from the current point, which is expected to be at startAngle.
+void PathJava::addEllipticArc(const FloatPoint& center, float radiusX, float radiusY, float rotation, float startAngle, float sweepAngle)
+{
+    if (!sweepAngle)
+        return;
+
+    AffineTransform transform;
+    transform.translate(center.x(), center.y());
+    transform.rotate(rad2deg(rotation));
+    transform.scale(radiusX, radiusY);
+
+    int count = std::min(static_cast<int>(std::ceil(std::abs(sweepAngle) / piOverTwoFloat - 0.001f)), 8);
+    count = std::max(count, 1);
+    float step = sweepAngle / count;
+    // Distance of the control points from the end points on the unit circle.
+    float k = 4.f / 3.f * std::tan(step / 4);
+
+    float angle = startAngle;
+    for (int i = 0; i < count; ++i) {
+        float cos1 = std::cos(angle), sin1 = std::sin(angle);
+        angle = i == count - 1 ? startAngle + sweepAngle : angle + step;
+        float cos2 = std::cos(angle), sin2 = std::sin(angle);
+        m_elements->addBezierCurveTo(
+            transform.mapPoint(FloatPoint(cos1 - k * sin1, sin1 + k * cos1)),
+            transform.mapPoint(FloatPoint(cos2 + k * sin2, sin2 - k * cos2)),
+            transform.mapPoint(FloatPoint(cos2, sin2)));
+    }
 }
 
 static inline float areaOfTriangleFormedByPoints(const FloatPoint& p1, const FloatPoint& p2, const FloatPoint& p3)
@@ -203,75 +241,96 @@ static inline float areaOfTriangleFormedByPoints(const FloatPoint& p1, const Flo
 
 void PathJava::addArcTo(const FloatPoint& p1, const FloatPoint& p2, float radius)
 {
-    ASSERT(m_platformPath);
+    didChange();
 
-    JNIEnv* env = WTF::GetJavaEnv();
+    if (elements().isEmpty()) {
+        m_elements->moveTo(p1);
+        return;
+    }
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArcTo",
-        "(DDDDD)V");
-    ASSERT(mid);
+    // The arc is tangent to the lines from the current point to p1 and
+    // from p1 to p2, see the canvas arcTo() specification.
+    FloatPoint p0 = elements().currentPoint();
+    if (p0 == p1 || p1 == p2 || !radius || !areaOfTriangleFormedByPoints(p0, p1, p2)) {
+        m_elements->addLineTo(p1);
+        return;
+    }
 
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)p1.x(), (jdouble)p1.y(),
-                        (jdouble)p2.x(), (jdouble)p2.y(), (jdouble)radius);
-    WTF::CheckAndClearException(env);
-}
+    FloatSize v1 = p0 - p1;
+    FloatSize v2 = p2 - p1;
+    float length1 = v1.diagonalLength();
+    float length2 = v2.diagonalLength();
+    v1.scale(1 / length1);
+    v2.scale(1 / length2);
 
-void PathJava::addArc(const FloatPoint& p, float radius, float startAngle, float endAngle, RotationDirection direction)
-{
-    ASSERT(m_platformPath);
-    bool clockwise = false;
-    if (direction == RotationDirection::Counterclockwise) {
-        clockwise = true;
-    } else if (direction == RotationDirection::Clockwise) {
-        clockwise = false;
-    }
+    float cosine = std::clamp(v1.width() * v2.width() + v1.height() * v2.height(), -1.f, 1.f);
+    float halfAngle = std::acos(cosine) / 2;
+    float tangentDistance = radius / std::tan(halfAngle);
+    FloatPoint t1 = p1 + FloatSize(v1.width() * tangentDistance, v1.height() * tangentDistance);
+    FloatPoint t2 = p1 + FloatSize(v2.width() * tangentDistance, v2.height() * tangentDistance);
 
-    JNIEnv* env = WTF::GetJavaEnv();
+    FloatSize bisector = v1 + v2;
+    bisector.scale(radius / std::sin(halfAngle) / bisector.diagonalLength());
+    FloatPoint center = p1 + bisector;
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArc",
-        "(DDDDDZ)V");
-    ASSERT(mid);
+    float startAngle = std::atan2(t1.y() - center.y(), t1.x() - center.x());
+    float endAngle = std::atan2(t2.y() - center.y(), t2.x() - center.x());
+    // The arc between the tangent points is always shorter than a half turn.
+    float sweepAngle = endAngle - startAngle;
+    if (sweepAngle > piFloat)
+        sweepAngle -= 2 * piFloat;
+    else if (sweepAngle < -piFloat)
+        sweepAngle += 2 * piFloat;
 
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)p.x(), (jdouble)p.y(),
-        (jdouble)radius, (jdouble)startAngle, (jdouble)endAngle,
-        bool_to_jbool(clockwise));
-    WTF::CheckAndClearException(env);
+    m_elements->addLineTo(t1);
+    addEllipticArc(center, radius, radius, 0, startAngle, sweepAngle);
 }
 
-void PathJava::addEllipse(const FloatPoint& point, float radiusX, float radiusY, float rotation, float startAngle, float endAngle, RotationDirection direction)
+void PathJava::addArc(const FloatPoint& p, float radius, float startAngle, float endAngle, RotationDirection direction)
 {
-    notImplemented();
+    addEllipse(p, radius, radius, 0, startAngle, endAngle, direction);
 }
 
-void PathJava::addEllipseInRect(const FloatRect& r)
+void PathJava::addEllipse(const FloatPoint& point, float radiusX, float radiusY, float rotation, float startAngle, float endAngle, RotationDirection direction)
 {
-    ASSERT(m_platformPath);
+    didChange();
 
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addEllipse",
-        "(DDDD)V");
-    ASSERT(mid);
+    // The angles are normalized by CanvasPath, the arc goes from the start
+    // angle to the end angle, in the given direction, and never covers more
+    // than a full turn.
+    float newEndAngle = endAngle;
+    if (direction == RotationDirection::Clockwise && startAngle > endAngle)
+        newEndAngle = startAngle + (2 * piFloat - std::fmod(startAngle - endAngle, 2 * piFloat));
+    else if (direction == RotationDirection::Counterclockwise && startAngle < endAngle)
+        newEndAngle = startAngle - (2 * piFloat - std::fmod(endAngle - startAngle, 2 * piFloat));
 
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)r.x(), (jdouble)r.y(),
-                        (jdouble)r.width(), (jdouble)r.height());
-    WTF::CheckAndClearException(env);
+    AffineTransform transform;
+    transform.translate(point.x(), point.y());
+    transform.rotate(rad2deg(rotation));
+    FloatPoint start = transform.mapPoint(FloatPoint(radiusX * std::cos(startAngle), radiusY * std::sin(startAngle)));
+    if (elements().isEmpty())
+        m_elements->moveTo(start);
+    else if (elements().currentPoint() != start)
+        m_elements->addLineTo(start);
+
+    addEllipticArc(point, radiusX, radiusY, rotation, startAngle, newEndAngle - startAngle);
 }
 
-void PathJava::addRect(const FloatRect& r)
+void PathJava::addEllipseInRect(const FloatRect& r)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
+    didChange();
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addRect",
-        "(DDDD)V");
-    ASSERT(mid);
+    float radiusX = r.width() / 2;
+    float radiusY = r.height() / 2;
+    FloatPoint center = r.center();
+    m_elements->moveTo(FloatPoint(center.x() + radiusX, center.y()));
+    addEllipticArc(center, radiusX, radiusY, 0, 0, 2 * piFloat);
+    m_elements->closeSubpath();
+}
 
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)r.x(), (jdouble)r.y(),
-                              (jdouble)r.width(), (jdouble)r.height());
-    WTF::CheckAndClearException(env);
+void PathJava::addRect(const FloatRect& r)
+{
+    addLinesForRect(r);
 }
 
 void PathJava::addRoundedRect(const FloatRoundedRect& roundedRect, PathRoundedRect::Strategy)
@@ -281,120 +340,165 @@ void PathJava::addRoundedRect(const FloatRoundedRect& roundedRect, PathRoundedRe
 
 void PathJava::closeSubpath()
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "closeSubpath", "()V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid);
-    WTF::CheckAndClearException(env);
+    m_elements->closeSubpath();
+    didChange();
 }
 
 void PathJava::addPath(const PathJava& path, const AffineTransform& transform)
 {
-    notImplemented();
+    auto elements = PathStream::create(path.m_elements->segments());
+    elements->transform(transform);
+    elements->applySegments([&](const PathSegment& segment) {
+        appendSegment(segment);
+    });
 }
 
 void PathJava::applySegments(const PathSegmentApplier& applier) const
 {
-    applyElements([&](const PathElement& pathElement) {
-        switch (pathElement.type) {
-        case PathElement::Type::MoveToPoint:
-            applier({ PathMoveTo { pathElement.points[0] } });
-            break;
-
-        case PathElement::Type::AddLineToPoint:
-            applier({ PathLineTo { pathElement.points[0] } });
-            break;
-
-        case PathElement::Type::AddQuadCurveToPoint:
-            applier({ PathQuadCurveTo { pathElement.points[0], pathElement.points[1] } });
-            break;
-
-        case PathElement::Type::AddCurveToPoint:
-            applier({ PathBezierCurveTo { pathElement.points[0], pathElement.points[1], pathElement.points[2] } });
-            break;
-
-        case PathElement::Type::CloseSubpath:
-            applier({ PathCloseSubpath { } });
-            break;
-        }
-    });
+    m_elements->applySegments(applier);
 }
 
 bool PathJava::applyElements(const PathElementApplier& applier) const
 {
-    // need to implement this method after looking into cairo implementation
-    return true;
+    return m_elements->applyElements(applier);
 }
 
 bool PathJava::isEmpty() const
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-                                            "isEmpty", "()Z");
-    ASSERT(mid);
-
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid);
-    WTF::CheckAndClearException(env);
-
-    return jbool_to_bool(res);
+    return elements().isEmpty();
 }
 
 FloatPoint PathJava::currentPoint() const
 {
-    //utatodo: return current point of subpath.
-    float quietNaN = std::numeric_limits<float>::quiet_NaN();
-    return FloatPoint(quietNaN, quietNaN);
+    return elements().currentPoint();
 }
 
 bool PathJava::transform(const AffineTransform& transform)
 {
-    ASSERT(m_platformPath);
+    didChange();
+    return m_elements->transform(transform);
+}
 
-    JNIEnv* env = WTF::GetJavaEnv();
+namespace {
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "transform", "(DDDDDD)V");
-    ASSERT(mid);
+// Winding number of a point, the curves are flattened into lines.
+class WindingCounter {
+public:
+    explicit WindingCounter(const FloatPoint& point)
+        : m_point(point)
+    {
+    }
 
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)transform.a(), (jdouble)transform.b(),
-                        (jdouble)transform.c(), (jdouble)transform.d(),
-                        (jdouble)transform.e(), (jdouble)transform.f());
-    WTF::CheckAndClearException(env);
-    return true;
-}
+    int winding() const { return m_winding; }
+
+    void moveTo(const FloatPoint& p)
+    {
+        closeSubpath();
+        m_start = m_current = p;
+    }
+
+    void lineTo(const FloatPoint& p)
+    {
+        const FloatPoint& a = m_current;
+        float side = (p.x() - a.x()) * (m_point.y() - a.y()) - (m_point.x() - a.x()) * (p.y() - a.y());
+        if (a.y() <= m_point.y()) {
+            if (p.y() > m_point.y() && side > 0)
+                ++m_winding;
+        } else if (p.y() <= m_point.y() && side < 0)
+            --m_winding;
+        m_current = p;
+    }
+
+    void quadTo(const FloatPoint& c, const FloatPoint& p)
+    {
+        FloatPoint p0 = m_current;
+        int count = segmentCount(FloatPoint(p0.x() - 2 * c.x() + p.x(), p0.y() - 2 * c.y() + p.y()), .25f);
+        for (int i = 1; i <= count; ++i) {
+            float t = static_cast<float>(i) / count;
+            float u = 1 - t;
+            lineTo(FloatPoint(
+                u * u * p0.x() + 2 * u * t * c.x() + t * t * p.x(),
+                u * u * p0.y() + 2 * u * t * c.y() + t * t * p.y()));
+        }
+    }
+
+    void cubicTo(const FloatPoint& c1, const FloatPoint& c2, const FloatPoint& p)
+    {
+        FloatPoint p0 = m_current;
+        FloatPoint d1(p0.x() - 2 * c1.x() + c2.x(), p0.y() - 2 * c1.y() + c2.y());
+        FloatPoint d2(c1.x() - 2 * c2.x() + p.x(), c1.y() - 2 * c2.y() + p.y());
+        int count = segmentCount(std::abs(d1.x()) + std::abs(d1.y()) > std::abs(d2.x()) + std::abs(d2.y()) ? d1 : d2, .75f);
+        for (int i = 1; i <= count; ++i) {
+            float t = static_cast<float>(i) / count;
+            float u = 1 - t;
+            float a = u * u * u, b = 3 * u * u * t, c = 3 * u * t * t, d = t * t * t;
+            lineTo(FloatPoint(
+                a * p0.x() + b * c1.x() + c * c2.x() + d * p.x(),
+                a * p0.y() + b * c1.y() + c * c2.y() + d * p.y()));
+        }
+    }
+
+    void closeSubpath()
+    {
+        if (m_current != m_start)
+            lineTo(m_start);
+    }
+
+private:
+    // Number of lines keeping a curve within the flattening tolerance, from
+    // its second difference, see Wang's formula.
+    static int segmentCount(const FloatPoint& secondDifference, float factor)
+    {
+        static constexpr float tolerance = .1f;
+        float length = std::hypot(secondDifference.x(), secondDifference.y());
+        return std::clamp(static_cast<int>(std::ceil(std::sqrt(factor * length / tolerance))), 1, 256);
+    }
+
+    FloatPoint m_point;
+    FloatPoint m_start;
+    FloatPoint m_current;
+    int m_winding { 0 };
+};
+
+} // namespace
 
 bool PathJava::contains(const FloatPoint &point, WindRule rule) const
 {
     if (isEmpty() || !std::isfinite(point.x()) || !std::isfinite(point.y()))
         return false;
 
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "contains",
-        "(IDD)Z");
-    ASSERT(mid);
+    if (!fastBoundingRect().contains(point))
+        return false;
 
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid, (jint)rule,
-        (jdouble)point.x(), (jdouble)point.y());
-    WTF::CheckAndClearException(env);
+    WindingCounter counter(point);
+    m_elements->applyElements([&](const PathElement& element) {
+        switch (element.type) {
+        case PathElement::Type::MoveToPoint:
+            counter.moveTo(element.points[0]);
+            break;
+        case PathElement::Type::AddLineToPoint:
+            counter.lineTo(element.points[0]);
+            break;
+        case PathElement::Type::AddQuadCurveToPoint:
+            counter.quadTo(element.points[0], element.points[1]);
+            break;
+        case PathElement::Type::AddCurveToPoint:
+            counter.cubicTo(element.points[0], element.points[1], element.points[2]);
+            break;
+        case PathElement::Type::CloseSubpath:
+            counter.closeSubpath();
+            break;
+        }
+    });
+    counter.closeSubpath();
 
-    return jbool_to_bool(res);
+    return rule == WindRule::EvenOdd
+        ? counter.winding() & 1
+        : counter.winding();
 }
 
 bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
-    ASSERT(m_platformPath);
     ASSERT(strokeStyleApplier);
 
     GraphicsContext& gc = scratchContext();
@@ -426,7 +530,7 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
     JLocalRef<jdoubleArray> dashArray(env->NewDoubleArray(size));
     env->SetDoubleArrayRegion(dashArray, 0, size, dashes.data());
 
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid, (jdouble)p.x(),
+    jboolean res = env->CallBooleanMethod(*platformPath(), mid, (jdouble)p.x(),
         (jdouble)p.y(), (jdouble) thickness, (jdouble) miterLimit,
         (jint) cap, (jint) join, (jdouble) dashOffset, (jdoubleArray) dashArray);
 
@@ -437,56 +541,29 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
 
 FloatRect PathJava::fastBoundingRect() const
 {
-    return boundingRect();
+    return m_elements->fastBoundingRect();
 }
 
 FloatRect PathJava::boundingRect() const
 {
-    return strokeBoundingRect(nullptr);
+    return m_elements->boundingRect();
 }
 
 FloatRect PathJava::strokeBoundingRect(const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "getBounds",
-            "()Lcom/sun/webkit/graphics/WCRectangle;");
-    ASSERT(mid);
-
-    JLObject rect(env->CallObjectMethod(*m_platformPath, mid));
-    WTF::CheckAndClearException(env);
-    if (rect) {
-        static jfieldID rectxFID = env->GetFieldID(PG_GetRectangleClass(env), "x", "F");
-        ASSERT(rectxFID);
-        static jfieldID rectyFID = env->GetFieldID(PG_GetRectangleClass(env), "y", "F");
-        ASSERT(rectyFID);
-        static jfieldID rectwFID = env->GetFieldID(PG_GetRectangleClass(env), "w", "F");
-        ASSERT(rectwFID);
-        static jfieldID recthFID = env->GetFieldID(PG_GetRectangleClass(env), "h", "F");
-        ASSERT(recthFID);
-
-        FloatRect bounds(
-            float(env->GetFloatField(rect, rectxFID)),
-            float(env->GetFloatField(rect, rectyFID)),
-            float(env->GetFloatField(rect, rectwFID)),
-            float(env->GetFloatField(rect, recthFID)));
-        WTF::CheckAndClearException(env);
-
-        float thickness;
-        if (strokeStyleApplier) {
-            GraphicsContext& gc = scratchContext();
-            gc.save();
-            strokeStyleApplier(gc);
-            thickness = gc.strokeThickness();
-            gc.restore();
-            bounds.inflate(thickness / 2);
-        }
-        return bounds;
-    } else {
+    if (isEmpty())
         return FloatRect();
+
+    FloatRect bounds = boundingRect();
+    if (strokeStyleApplier) {
+        GraphicsContext& gc = scratchContext();
+        gc.save();
+        strokeStyleApplier(gc);
+        float thickness = gc.strokeThickness();
+        gc.restore();
+        bounds.inflate(thickness / 2);
     }
+    return bounds;
 }
 
 } // namespace WebCore
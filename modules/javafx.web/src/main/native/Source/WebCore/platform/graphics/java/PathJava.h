@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -34,16 +34,19 @@
 namespace WebCore {
 
 class GraphicsContext;
-class PathStream;
 
+// Keeps the segments natively, arcs and ellipses are converted to bezier
+// curves as they are added. The Java WCPath is created from all segments
+// at once when it is first needed to draw the path, and dropped when the
+// path changes, so it is never modified once queued for rendering.
 class PathJava final : public PathImpl {
 public:
     static UniqueRef<PathJava> create();
     static UniqueRef<PathJava> create(const PathStream&);
-    static UniqueRef<PathJava> create(RefPtr<RQRef>&&, std::unique_ptr<PathStream>&& = nullptr);
+    static UniqueRef<PathJava> create(UniqueRef<PathStream>&&);
 
     PathJava();
-    PathJava(RefPtr<RQRef>&&, std::unique_ptr<PathStream>&&);
+    PathJava(UniqueRef<PathStream>&&);
 
     PlatformPathPtr platformPath() const;
 
@@ -87,8 +90,13 @@ private:
     FloatRect fastBoundingRect() const final;
     FloatRect boundingRect() const final;
 
-    RefPtr<RQRef> m_platformPath;
-    std::unique_ptr<PathStream> m_elementsStream;
+    void addEllipticArc(const FloatPoint& center, float radiusX, float radiusY, float rotation, float startAngle, float sweepAngle);
+    PathImpl& elements() { return m_elements.get(); }
+    const PathImpl& elements() const { return m_elements.get(); }
+    void didChange() { m_platformPath = nullptr; }
+
+    UniqueRef<PathStream> m_elements;
+    mutable RefPtr<RQRef> m_platformPath;
 };
 
 } // namespace WebCore
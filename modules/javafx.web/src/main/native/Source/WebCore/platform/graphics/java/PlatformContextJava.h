@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,22 +25,39 @@
 
 #pragma once
 
+#include "Color.h"
+#include "FloatSize.h"
 #include "GraphicsContext.h"
 #include "Path.h"
 #include "RenderingQueue.h"
 #include "com_sun_webkit_graphics_WCRenderQueue.h"
 #include <jni.h>
+#include <optional>
+#include <tuple>
 #include <wtf/Noncopyable.h>
+#include <wtf/Vector.h>
 
 namespace WebCore {
 
-    RefPtr<RQRef> copyPath(RefPtr<RQRef> p);
-
     class PlatformContextJava {
         WTF_MAKE_NONCOPYABLE(PlatformContextJava);
     public:
+        // The state last sent to the java graphics context. An empty value
+        // means the java side value is not known, so the next set is always
+        // sent. It is saved and restored together with the java state.
+        struct EmittedState {
+            std::optional<Color> fillColor;
+            std::optional<Color> strokeColor;
+            std::optional<float> strokeThickness;
+            std::optional<StrokeStyle> strokeStyle;
+            std::optional<TextDrawingModeFlags> textDrawingMode;
+            std::optional<CompositeOperator> compositeOperator;
+            std::optional<float> alpha;
+            std::optional<std::tuple<FloatSize, float, Color>> shadow;
+        };
+
         PlatformContextJava(const JLObject& jRQ, RefPtr<RQRef> jTheme, bool autoFlush = false)
-            : m_rq(RenderingQueue::create(jRQ, com_sun_webkit_graphics_WCRenderQueue_MAX_QUEUE_SIZE / RenderingQueue::MAX_BUFFER_COUNT, autoFlush))
+            : m_rq(RenderingQueue::create(jRQ, ByteBufferPool::defaultSizeClass(), autoFlush))
             , m_jRenderTheme(jTheme)
         {}
 
@@ -119,6 +136,32 @@ namespace WebCore {
         void setMiterLimit(float miterLimit) {
             m_miterLimit = miterLimit;
         }
+
+        EmittedState& emittedState() {
+            return m_emittedState;
+        }
+
+        // Returns false if |value| is what the java side already has, in
+        // which case the caller does not send it. Otherwise remembers it.
+        template<typename T>
+        bool shouldEmit(std::optional<T>& emitted, const T& value) {
+            if (emitted && *emitted == value) {
+                RenderingQueue::countElidedStateOp();
+                return false;
+            }
+            emitted = value;
+            return true;
+        }
+
+        void saveEmittedState() {
+            m_emittedStateStack.append(m_emittedState);
+        }
+
+        void restoreEmittedState() {
+            m_emittedState = m_emittedStateStack.isEmpty()
+                ? EmittedState { }
+                : m_emittedStateStack.takeLast();
+        }
     private:
         RefPtr<RenderingQueue> m_rq;
         RefPtr<RQRef> m_jRenderTheme;
@@ -130,5 +173,7 @@ namespace WebCore {
         LineCap m_lineCap { };
         LineJoin m_lineJoin { };
         float m_miterLimit { };
+        EmittedState m_emittedState;
+        Vector<EmittedState> m_emittedStateStack;
     };
 }
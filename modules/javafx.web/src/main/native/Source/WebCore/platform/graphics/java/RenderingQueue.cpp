@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,7 @@
 #include <wtf/java/JavaRef.h>
 #include <wtf/HashMap.h>
 #include <wtf/NeverDestroyed.h>
+#include <atomic>
 
 #include "com_sun_webkit_graphics_WCRenderQueue.h"
 
@@ -45,6 +46,132 @@ static Addr2ByteBuffer& getAddr2ByteBuffer()
     return container.get();
 }
 
+static std::atomic<uint64_t> s_bufferPoolCounters[ByteBufferPool::CounterCount];
+
+static void incrementBufferPoolCounter(ByteBufferPool::Counter counter)
+{
+    s_bufferPoolCounters[counter].fetch_add(1, std::memory_order_relaxed);
+}
+
+static void decrementBufferPoolCounter(ByteBufferPool::Counter counter)
+{
+    s_bufferPoolCounters[counter].fetch_sub(1, std::memory_order_relaxed);
+}
+
+static std::atomic<uint64_t> s_elidedStateOps;
+
+void RenderingQueue::countElidedStateOp()
+{
+    s_elidedStateOps.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t RenderingQueue::elidedStateOps()
+{
+    return s_elidedStateOps.load(std::memory_order_relaxed);
+}
+
+static jint getRenderQueueConfigValue(const char* methodName)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+    jclass cls = PG_GetRenderQueueClass(env);
+    jmethodID mid = env->GetStaticMethodID(cls, methodName, "()I");
+    ASSERT(mid);
+
+    jint value = env->CallStaticIntMethod(cls, mid);
+    if (WTF::CheckAndClearException(env)) {
+        return -1;
+    }
+    return value;
+}
+
+/*static*/
+int ByteBufferPool::defaultSizeClass()
+{
+    static int sizeClass = [] {
+        jint value = getRenderQueueConfigValue("fwkGetBufferSize");
+        return value > 0
+            ? value
+            : com_sun_webkit_graphics_WCRenderQueue_MAX_QUEUE_SIZE / RenderingQueue::MAX_BUFFER_COUNT;
+    }();
+    return sizeClass;
+}
+
+/*static*/
+size_t ByteBufferPool::defaultHighWaterMark()
+{
+    static size_t highWaterMark = [] {
+        jint value = getRenderQueueConfigValue("fwkGetBufferPoolSize");
+        return value >= 0 ? static_cast<size_t>(value) : 2;
+    }();
+    return highWaterMark;
+}
+
+/*static*/
+bool RenderingQueue::isCompactFormat()
+{
+    static bool compact = getRenderQueueConfigValue("fwkGetFormatVersion")
+        == com_sun_webkit_graphics_WCRenderQueue_FORMAT_VERSION_2;
+    return compact;
+}
+
+/*static*/
+uint64_t ByteBufferPool::counter(Counter counter)
+{
+    return s_bufferPoolCounters[counter].load(std::memory_order_relaxed);
+}
+
+RefPtr<ByteBuffer> ByteBufferPool::acquire(int size)
+{
+    if (size > m_sizeClass || m_closed) {
+        incrementBufferPoolCounter(Allocated);
+        return ByteBuffer::create(std::max(m_sizeClass, size));
+    }
+    if (!m_freeList.isEmpty()) {
+        incrementBufferPoolCounter(Reused);
+        decrementBufferPoolCounter(Idle);
+        RefPtr<ByteBuffer> buffer = m_freeList.takeLast();
+        buffer->m_pool = this;
+        return buffer;
+    }
+    incrementBufferPoolCounter(Allocated);
+    return ByteBuffer::create(m_sizeClass, this);
+}
+
+void ByteBufferPool::recycle(ByteBuffer& buffer)
+{
+    ASSERT(buffer.m_capacity == m_sizeClass);
+    // The pool does not keep itself alive through the idle buffers.
+    buffer.m_pool = nullptr;
+    if (m_closed || m_freeList.size() >= m_highWaterMark) {
+        incrementBufferPoolCounter(Discarded);
+        return;
+    }
+    incrementBufferPoolCounter(Recycled);
+    incrementBufferPoolCounter(Idle);
+    m_freeList.append(&buffer);
+}
+
+void ByteBufferPool::close()
+{
+    m_closed = true;
+    for (size_t i = 0; i < m_freeList.size(); ++i) {
+        decrementBufferPoolCounter(Idle);
+        incrementBufferPoolCounter(Discarded);
+    }
+    m_freeList.clear();
+}
+
+void ByteBuffer::recycle()
+{
+    m_refList.clear();
+    m_position = 0;
+    if (m_pool) {
+        // Keep the pool alive while it adopts the buffer.
+        RefPtr<ByteBufferPool> pool = m_pool;
+        pool->recycle(*this);
+    }
+}
+
 /*static*/
 RefPtr<RenderingQueue> RenderingQueue::create(
     const JLObject &jRQ,
@@ -65,11 +192,31 @@ RenderingQueue& RenderingQueue::freeSpace(int size) {
         }
     }
     if (!m_buffer) {
-        m_buffer = RefPtr<ByteBuffer>(ByteBuffer::create(std::max(m_capacity, size)));
+        m_buffer = m_bufferPool->acquire(size);
     }
     return *this;
 }
 
+bool RenderingQueue::extendBatch(jint opcode, uint64_t key, int itemSize) {
+    if (m_batchOpcode != opcode || m_batchKey != key || !m_buffer
+        || m_buffer->position() != m_batchEnd || !m_buffer->hasFreeSpace(itemSize)) {
+        return false;
+    }
+    m_buffer->putIntAt(m_batchCountPosition, m_buffer->intAt(m_batchCountPosition) + 1);
+    return true;
+}
+
+void RenderingQueue::beginBatch(jint opcode, uint64_t key) {
+    m_batchOpcode = opcode;
+    m_batchKey = key;
+    m_batchCountPosition = m_buffer->position();
+    m_buffer->putInt(1);
+}
+
+void RenderingQueue::endBatchItem() {
+    m_batchEnd = m_buffer->position();
+}
+
 void RenderingQueue::flush() {
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -100,13 +247,17 @@ void RenderingQueue::disposeGraphics() {
  * The method is called on Event thread (so, it's not concurrent with JS and the release of resources).
  */
 RenderingQueue& RenderingQueue::flushBuffer() {
-    if (isEmpty()) {
+    if (m_flushCallback) {
+        auto callback = std::exchange(m_flushCallback, nullptr);
+        callback();
+    }
+    if (isBufferEmpty()) {
         return *this;
     }
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID midFwkAddBuffer = env->GetMethodID(PG_GetRenderQueueClass(env),
-        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;)V");
+        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;I)V");
     ASSERT(midFwkAddBuffer);
 
     Addr2ByteBuffer &a2bb = getAddr2ByteBuffer();
@@ -114,10 +265,12 @@ RenderingQueue& RenderingQueue::flushBuffer() {
     env->CallVoidMethod(
         getWCRenderingQueue(),
         midFwkAddBuffer,
-        (jobject)(m_buffer->createDirectByteBuffer(env)));
+        (jobject)(m_buffer->directByteBuffer(env)),
+        (jint)m_buffer->position());
     WTF::CheckAndClearException(env);
 
     m_buffer = nullptr;
+    m_batchOpcode = -1;
 
     return *this;
 }
@@ -139,7 +292,26 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkRelease
         char *key = (char *)env->GetDirectBufferAddress(
             JLObject(env->GetObjectArrayElement(bufs, i)));
         if (key != 0) {
-            a2bb.remove(key);
+            if (RefPtr<ByteBuffer> buffer = a2bb.take(key)) {
+                buffer->recycle();
+            }
         }
     }
 }
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkGetBufferPoolCounters
+    (JNIEnv* env, jclass, jlongArray counters)
+{
+    using namespace WebCore;
+    jsize count = std::min<jsize>(env->GetArrayLength(counters), ByteBufferPool::CounterCount);
+    for (jsize i = 0; i < count; ++i) {
+        jlong value = static_cast<jlong>(ByteBufferPool::counter(static_cast<ByteBufferPool::Counter>(i)));
+        env->SetLongArrayRegion(counters, i, 1, &value);
+    }
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkGetElidedStateOps
+    (JNIEnv*, jclass)
+{
+    return static_cast<jlong>(WebCore::RenderingQueue::elidedStateOps());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 #pragma once
 
 #include <jni.h>
+#include <wtf/Function.h>
 #include <wtf/Vector.h>
 #include <wtf/RefCounted.h>
 #include <wtf/HashSet.h>
@@ -36,19 +37,24 @@
 namespace WebCore {
 
 class RQRef;
+class ByteBufferPool;
 
 class ByteBuffer : public RefCounted<ByteBuffer> {
     RQ_LOG_INSTANCE_COUNT(ByteBuffer)
 public:
-    static RefPtr<ByteBuffer> create(int capacity) {
-        return adoptRef(new ByteBuffer(capacity));
+    static RefPtr<ByteBuffer> create(int capacity, RefPtr<ByteBufferPool> pool = nullptr) {
+        return adoptRef(new ByteBuffer(capacity, WTFMove(pool)));
     }
 
-    JLObject createDirectByteBuffer(JNIEnv* env) {
+    // The NIO wrapper spans the whole capacity and is kept for the lifetime
+    // of the buffer, so a recycled buffer goes to java without a new
+    // NewDirectByteBuffer call. The number of valid bytes is passed separately.
+    JLObject directByteBuffer(JNIEnv* env) {
         ASSERT(!isEmpty());
-        JLObject ret(env->NewDirectByteBuffer(m_buffer, m_position));
-        m_nio_holder = ret;
-        return ret;
+        if (!static_cast<jobject>(m_nio_holder)) {
+            m_nio_holder = JLObject(env->NewDirectByteBuffer(m_buffer, m_capacity));
+        }
+        return JLObject(m_nio_holder);
     }
 
     char* bufferAddress() { return m_buffer; }
@@ -66,25 +72,56 @@ public:
         m_position += sizeof(jint);
     }
 
+    void putInts(const jint* values, unsigned count) {
+        ASSERT(m_position + count * sizeof(jint) <= m_capacity);
+        memcpy((m_buffer + m_position), values, count * sizeof(jint));
+        m_position += count * sizeof(jint);
+    }
+
     void putFloat(jfloat f) {
         ASSERT(m_position + sizeof(jfloat) <= m_capacity);
         memcpy((m_buffer + m_position), &f, sizeof(jfloat));
         m_position += sizeof(jfloat);
     }
 
+    // Reads and rewrites an int already put at |position|
+    jint intAt(int position) {
+        ASSERT(position + sizeof(jint) <= static_cast<size_t>(m_position));
+        jint i;
+        memcpy(&i, (m_buffer + position), sizeof(jint));
+        return i;
+    }
+
+    void putIntAt(int position, jint i) {
+        ASSERT(position + sizeof(jint) <= static_cast<size_t>(m_position));
+        memcpy((m_buffer + position), &i, sizeof(jint));
+    }
+
     bool hasFreeSpace(int size) { return m_position + size <= m_capacity; }
 
     bool isEmpty() { return m_position == 0; }
 
+    int capacity() { return m_capacity; }
+
+    int position() { return m_position; }
+
+    // Called once java is done with the buffer. Drops the references
+    // held by the recorded commands and hands the memory back to the
+    // pool it came from (if any).
+    void recycle();
+
     ~ByteBuffer() {
         delete[] m_buffer;
     }
 
 private:
-    ByteBuffer(int capacity) :
+    friend class ByteBufferPool;
+
+    ByteBuffer(int capacity, RefPtr<ByteBufferPool> pool) :
         m_buffer(new char[capacity]),
         m_capacity(capacity),
-        m_position(0)
+        m_position(0),
+        m_pool(WTFMove(pool))
     {}
 
     char* m_buffer;
@@ -92,6 +129,63 @@ private:
     int m_position;
     JGObject m_nio_holder;
     Vector< RefPtr<RQRef> > m_refList;
+    RefPtr<ByteBufferPool> m_pool;
+};
+
+/*
+ * A free-list of fixed-capacity ByteBuffers owned by a RenderingQueue.
+ * Buffers flushed to java come back here from WCRenderQueue.twkRelease
+ * instead of being destroyed, up to a high-water mark of idle buffers.
+ * The size class and the high-water mark are taken from the
+ * "com.sun.webkit.rq.bufferSize" and "com.sun.webkit.rq.bufferPoolSize"
+ * system properties (see WCRenderQueue.java).
+ *
+ * All methods are called on the Event thread.
+ */
+class ByteBufferPool : public RefCounted<ByteBufferPool> {
+public:
+    // Indices of the process-wide counters reported by
+    // WCRenderQueue.getBufferPoolCounters().
+    enum Counter {
+        Allocated = 0, // buffers created with new char[]
+        Reused,        // buffers handed out from a free-list
+        Recycled,      // buffers returned to a free-list
+        Discarded,     // buffers destroyed because the pool was full or closed
+        Idle,          // buffers currently sitting in free-lists
+        CounterCount
+    };
+
+    static RefPtr<ByteBufferPool> create(int sizeClass, size_t highWaterMark) {
+        return adoptRef(new ByteBufferPool(sizeClass, highWaterMark));
+    }
+
+    // Falls back to MAX_QUEUE_SIZE / MAX_BUFFER_COUNT when no size is configured.
+    static int defaultSizeClass();
+    static size_t defaultHighWaterMark();
+    static uint64_t counter(Counter);
+
+    int sizeClass() const { return m_sizeClass; }
+
+    // Returns a buffer that can hold at least |size| bytes. Requests that
+    // do not fit the size class get a one-off buffer that is not pooled.
+    RefPtr<ByteBuffer> acquire(int size);
+    void recycle(ByteBuffer&);
+
+    // Releases the idle buffers and stops pooling. Buffers that are still
+    // in flight are destroyed when java releases them.
+    void close();
+
+private:
+    ByteBufferPool(int sizeClass, size_t highWaterMark)
+        : m_sizeClass(sizeClass)
+        , m_highWaterMark(highWaterMark)
+        , m_closed(false)
+    {}
+
+    int m_sizeClass;
+    size_t m_highWaterMark;
+    bool m_closed;
+    Vector<RefPtr<ByteBuffer>> m_freeList;
 };
 
 /*
@@ -131,13 +225,59 @@ public:
         return *this;
     }
 
+    RenderingQueue& putInts(const jint* values, unsigned count) {
+        m_buffer->putInts(values, count);
+        return *this;
+    }
+
     RenderingQueue& freeSpace(int size);
     RenderingQueue& flushBuffer();
 
+    // Batch commands are a header, an item count and the items. While
+    // nothing else is queued after a batch, a command with the same opcode
+    // and key is added to it as one more item instead of being queued on
+    // its own. Typical use:
+    //
+    //     if (!rq.extendBatch(opcode, key, itemSize)) {
+    //         rq.freeSpace(headerSize + 4 + itemSize) << opcode << ...header;
+    //         rq.beginBatch(opcode, key);
+    //     }
+    //     rq << ...item;
+    //     rq.endBatchItem();
+    bool extendBatch(jint opcode, uint64_t key, int itemSize);
+    void beginBatch(jint opcode, uint64_t key);
+    void endBatchItem();
+
+    // Process-wide count of state commands not sent because the java
+    // graphics context already had the value (see PlatformContextJava).
+    static void countElidedStateOp();
+    static uint64_t elidedStateOps();
+
+    // True when the java side reads the version 2 commands, see
+    // WCRenderQueue.FORMAT_VERSION_2.
+    static bool isCompactFormat();
+
+    // A queue with a flush callback is not empty, so that drawing the
+    // target flushes it.
     bool isEmpty() {
+        return !m_flushCallback && isBufferEmpty();
+    }
+
+    bool isBufferEmpty() {
         return m_buffer == nullptr || m_buffer->isEmpty();
     }
 
+    // Sets a function to call once at the next flush, before the buffer is
+    // sent to java. Used to apply changes made to the target outside of the
+    // queue before the drawing recorded after them.
+    void setFlushCallback(Function<void()>&& callback) {
+        m_flushCallback = WTFMove(callback);
+    }
+
+    bool hasFlushCallback() const {
+        return !!m_flushCallback;
+    }
+
     JLObject getWCRenderingQueue() {
         return m_rqoRenderingQueue->cloneLocalCopy();
     }
@@ -149,6 +289,7 @@ public:
     }
 
     ~RenderingQueue() {
+        m_bufferPool->close();
         disposeGraphics();
     }
 
@@ -157,7 +298,8 @@ private:
         m_rqoRenderingQueue(RQRef::create(jRQ)),
         m_capacity(capacity),
         m_autoFlush(autoFlush),
-        m_buffer(nullptr)
+        m_buffer(nullptr),
+        m_bufferPool(ByteBufferPool::create(capacity, ByteBufferPool::defaultHighWaterMark()))
     {}
 
     void flush();
@@ -170,6 +312,14 @@ private:
     int m_capacity;
     bool m_autoFlush;
     RefPtr<ByteBuffer> m_buffer; // ref to the current ByteBuffer
+    RefPtr<ByteBufferPool> m_bufferPool;
+    Function<void()> m_flushCallback;
+
+    // The open batch in m_buffer, if any (see extendBatch)
+    jint m_batchOpcode { -1 };
+    uint64_t m_batchKey { 0 };
+    int m_batchCountPosition { 0 };
+    int m_batchEnd { 0 };
 
 };
 } // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,15 +26,39 @@
 #include "config.h"
 
 #include "BitmapTextureJava.h"
+#include "ByteArrayPixelBuffer.h"
+#include "FilterOperations.h"
 #include "GraphicsLayer.h"
+#include "LengthFunctions.h"
+#include "NativeImage.h"
 #include "NotImplemented.h"
 #include "PlatformContextJava.h"
 #include "TextureMapperJava.h"
 
+#include "com_sun_webkit_graphics_GraphicsDecoder.h"
+
 namespace WebCore {
 
-void BitmapTextureJava::updateContents(const void*, const IntRect&, const IntPoint&, int)
+void BitmapTextureJava::updateContents(const void* srcData, const IntRect& targetRect, const IntPoint& sourceOffset, int bytesPerLine)
 {
+    if (!m_image || targetRect.isEmpty())
+        return;
+
+    PixelBufferFormat format { AlphaPremultiplication::Premultiplied, PixelFormat::BGRA8, DestinationColorSpace::SRGB() };
+    auto pixelBuffer = ByteArrayPixelBuffer::tryCreate(format, targetRect.size());
+    if (!pixelBuffer)
+        return;
+
+    const size_t rowBytes = targetRect.width() * 4;
+    const uint8_t* src = static_cast<const uint8_t*>(srcData) + sourceOffset.y() * bytesPerLine + sourceOffset.x() * 4;
+    uint8_t* dst = pixelBuffer->bytes();
+    for (int y = 0; y < targetRect.height(); ++y) {
+        memcpy(dst, src, rowBytes);
+        src += bytesPerLine;
+        dst += rowBytes;
+    }
+
+    m_image->putPixelBuffer(*pixelBuffer, IntRect(IntPoint(), targetRect.size()), targetRect.location());
 }
 
 void BitmapTextureJava::didReset()
@@ -49,10 +73,101 @@ void BitmapTextureJava::updateContents(Image* image, const IntRect& targetRect,
     m_image->context().drawImage(*image, targetRect, IntRect(offset, targetRect.size()), CompositeOperator::Copy);
 }
 
-RefPtr<BitmapTexture> BitmapTextureJava::applyFilters(TextureMapper&, const FilterOperations&, bool)
+static bool isSupportedFilter(const FilterOperation& filter)
 {
-    notImplemented();
-    return this;
+    switch (filter.type()) {
+    case FilterOperation::Type::Blur:
+    case FilterOperation::Type::DropShadow:
+    case FilterOperation::Type::Opacity:
+    case FilterOperation::Type::Grayscale:
+    case FilterOperation::Type::Brightness:
+        return true;
+    default:
+        return false;
+    }
+}
+
+RefPtr<BitmapTexture> BitmapTextureJava::applyFilters(TextureMapper& textureMapper, const FilterOperations& filters, bool)
+{
+    if (filters.isEmpty() || !m_image)
+        return this;
+
+    for (auto& filter : filters.operations()) {
+        if (!isSupportedFilter(*filter)) {
+            notImplemented();
+            return this;
+        }
+    }
+
+    auto nativeImage = m_image->copyNativeImage(DontCopyBackingStore);
+    if (!nativeImage)
+        return this;
+    PlatformImagePtr image = nativeImage->platformImage();
+
+    RefPtr<BitmapTexture> resultSurface = textureMapper.acquireTextureFromPool(contentSize(), BitmapTexture::SupportsAlpha);
+    GraphicsContext* context = static_cast<BitmapTextureJava*>(resultSurface.get())->graphicsContext();
+    if (!context)
+        return this;
+
+    IntSize size = contentSize();
+    context->clearRect(FloatRect(FloatPoint(), size));
+
+    // The whole chain is applied by a single Prism pass on the Java side.
+    auto rq = image->getRenderingQueue();
+    if (rq && !rq->isEmpty()) {
+        rq->flushBuffer();
+        context->platformContext()->rq().freeSpace(8)
+            << (jint)com_sun_webkit_graphics_GraphicsDecoder_DECODERQ
+            << rq->getRQRenderingQueue();
+    }
+
+    RenderingQueue& out = context->platformContext()->rq().freeSpace(28 + 32 * static_cast<int>(filters.size()));
+    out << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAW_FILTERED_IMAGE
+        << image->getImage()
+        << 0.0f << 0.0f << (float)size.width() << (float)size.height()
+        << (jint)filters.size();
+
+    for (auto& filter : filters.operations()) {
+        jint type = 0;
+        float amount = 0;
+        float dx = 0;
+        float dy = 0;
+        SRGBA<float> color { 0, 0, 0, 0 };
+        switch (filter->type()) {
+        case FilterOperation::Type::Blur:
+            type = com_sun_webkit_graphics_GraphicsDecoder_FILTER_BLUR;
+            amount = floatValueForLength(downcast<BlurFilterOperation>(*filter).stdDeviation(), size.width());
+            break;
+        case FilterOperation::Type::DropShadow: {
+            auto& shadow = downcast<DropShadowFilterOperation>(*filter);
+            type = com_sun_webkit_graphics_GraphicsDecoder_FILTER_DROP_SHADOW;
+            amount = shadow.stdDeviation();
+            dx = shadow.x();
+            dy = shadow.y();
+            color = shadow.color().toColorTypeLossy<SRGBA<float>>();
+            break;
+        }
+        case FilterOperation::Type::Opacity:
+            type = com_sun_webkit_graphics_GraphicsDecoder_FILTER_OPACITY;
+            amount = downcast<BasicComponentTransferFilterOperation>(*filter).amount();
+            break;
+        case FilterOperation::Type::Grayscale:
+            type = com_sun_webkit_graphics_GraphicsDecoder_FILTER_GRAYSCALE;
+            amount = downcast<BasicColorMatrixFilterOperation>(*filter).amount();
+            break;
+        case FilterOperation::Type::Brightness:
+            type = com_sun_webkit_graphics_GraphicsDecoder_FILTER_BRIGHTNESS;
+            amount = downcast<BasicComponentTransferFilterOperation>(*filter).amount();
+            break;
+        default:
+            ASSERT_NOT_REACHED();
+            break;
+        }
+        auto [r, g, b, a] = color.resolved();
+        out << type << amount << dx << dy << r << g << b << a;
+    }
+
+    return resultSurface;
 }
 
 } // namespace WebCore
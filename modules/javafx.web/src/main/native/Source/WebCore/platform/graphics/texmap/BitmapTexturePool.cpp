@@ -31,6 +31,8 @@
 #include "BitmapTextureGL.h"
 #elif PLATFORM(JAVA)
 #include "BitmapTextureJava.h"
+#include "TextureMapperJava.h"
+#include <wtf/MainThread.h>
 #endif
 
 namespace WebCore {
@@ -72,6 +74,12 @@ RefPtr<BitmapTexture> BitmapTexturePool::acquireTexture(const IntSize& size, con
 
 void BitmapTexturePool::scheduleReleaseUnusedTextures()
 {
+#if PLATFORM(JAVA)
+    // The timer belongs to the main run loop. Textures acquired by a
+    // compositor thread are released after the next main thread acquisition.
+    if (!isMainThread())
+        return;
+#endif
     if (m_releaseUnusedTexturesTimer.isActive())
         return;
 
@@ -80,6 +88,9 @@ void BitmapTexturePool::scheduleReleaseUnusedTextures()
 
 void BitmapTexturePool::releaseUnusedTexturesTimerFired()
 {
+#if PLATFORM(JAVA)
+    Locker locker { TextureMapperJava::layerTreeLock() };
+#endif
     if (m_textures.isEmpty())
         return;
 
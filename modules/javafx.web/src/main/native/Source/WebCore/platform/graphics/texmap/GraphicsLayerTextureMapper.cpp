@@ -27,6 +27,10 @@
 #include "NicosiaAnimation.h"
 #include "TransformOperation.h"
 
+#if PLATFORM(JAVA)
+#include "TextureMapperJava.h"
+#endif
+
 #if !USE(COORDINATED_GRAPHICS)
 
 namespace WebCore {
@@ -59,6 +63,11 @@ void GraphicsLayerTextureMapper::notifyChange(ChangeMask changeMask)
 
 GraphicsLayerTextureMapper::~GraphicsLayerTextureMapper()
 {
+#if PLATFORM(JAVA)
+    // A compositor thread must not paint the tree again before it is committed
+    TextureMapperJava::layerTreeWillChange();
+#endif
+
     if (m_contentsLayer)
         m_contentsLayer->setClient(0);
 
@@ -426,6 +435,12 @@ void GraphicsLayerTextureMapper::commitLayerChanges()
     if (m_changeMask == NoChanges)
         return;
 
+#if PLATFORM(JAVA)
+    // Anything but a contents repaint may move or restyle the whole layer
+    if (m_changeMask & ~DisplayChange)
+        m_layer.setNeedsDamage();
+#endif
+
     if (m_changeMask & ChildrenChange) {
         Vector<TextureMapperLayer*> rawChildren;
         rawChildren.reserveInitialCapacity(children().size());
@@ -578,6 +593,10 @@ void GraphicsLayerTextureMapper::updateBackingStoreIfNeeded(TextureMapper& textu
     if (dirtyRect.isEmpty())
         return;
 
+#if PLATFORM(JAVA)
+    m_layer.addContentsDamage(dirtyRect);
+#endif
+
     m_backingStore->updateContentsScale(pageScaleFactor() * deviceScaleFactor());
 
     dirtyRect.scale(pageScaleFactor() * deviceScaleFactor());
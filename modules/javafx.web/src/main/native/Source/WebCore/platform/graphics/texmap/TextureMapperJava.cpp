@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,13 +30,19 @@
 #include "BitmapTexturePool.h"
 #include "GraphicsLayer.h"
 #include "NotImplemented.h"
+#include "PlatformJavaClasses.h"
 
 #include "com_sun_webkit_graphics_GraphicsDecoder.h"
 
+#include <wtf/NeverDestroyed.h>
+
 #if USE(TEXTURE_MAPPER)
 namespace WebCore {
 
-static const int s_maximumAllowedImageBufferDimension = 256;
+// Tiles are never smaller than this, even when Prism is not up yet.
+static const int s_minimumTileDimension = 256;
+// Larger tiles mostly waste texture memory on layer edges and partial updates.
+static const int s_maximumTileDimension = 2048;
 
 std::unique_ptr<TextureMapper> TextureMapper::platformCreateAccelerated()
 {
@@ -48,9 +54,74 @@ TextureMapperJava::TextureMapperJava()
     m_texturePool = std::make_unique<BitmapTexturePool>();
 }
 
+static unsigned s_layerTreeGeneration { 0 };
+
+RecursiveLock& TextureMapperJava::layerTreeLock()
+{
+    static NeverDestroyed<RecursiveLock> lock;
+    return lock;
+}
+
+unsigned TextureMapperJava::layerTreeGeneration()
+{
+    Locker locker { layerTreeLock() };
+    return s_layerTreeGeneration;
+}
+
+void TextureMapperJava::layerTreeWillChange()
+{
+    Locker locker { layerTreeLock() };
+    ++s_layerTreeGeneration;
+}
+
 IntSize TextureMapperJava::maxTextureSize() const
 {
-    return IntSize(s_maximumAllowedImageBufferDimension, s_maximumAllowedImageBufferDimension);
+    if (!m_maxTextureDimension) {
+        JNIEnv* env = WTF::GetJavaEnv();
+
+        static jmethodID mid = env->GetMethodID(
+            PG_GetGraphicsManagerClass(env),
+            "getMaximumTextureSize",
+            "()I");
+        ASSERT(mid);
+
+        jint size = env->CallIntMethod(PL_GetGraphicsManager(env), mid);
+        if (WTF::CheckAndClearException(env) || size <= 0)
+            return IntSize(s_minimumTileDimension, s_minimumTileDimension);
+
+        // Keep the size until the mapper goes away, the backing stores tile with it
+        m_maxTextureDimension = std::clamp<int>(size, s_minimumTileDimension, s_maximumTileDimension);
+    }
+    return IntSize(m_maxTextureDimension, m_maxTextureDimension);
+}
+
+// Layer transforms are mostly plain translations, which the compact format
+// sends without the rest of the 4x4 matrix.
+static void setPerspectiveTransform(RenderingQueue& rq, const TransformationMatrix& transform)
+{
+    if (RenderingQueue::isCompactFormat() && transform.isAffine()) {
+        if (transform.isIdentity()) {
+            rq.freeSpace(4)
+                << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_PERSPECTIVE_IDENTITY;
+        } else if (transform.isIdentityOrTranslation()) {
+            rq.freeSpace(12)
+                << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_PERSPECTIVE_TRANSLATE
+                << (float)transform.m41() << (float)transform.m42();
+        } else {
+            rq.freeSpace(28)
+                << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_PERSPECTIVE_AFFINE
+                << (float)transform.m11() << (float)transform.m12()
+                << (float)transform.m21() << (float)transform.m22()
+                << (float)transform.m41() << (float)transform.m42();
+        }
+        return;
+    }
+    rq.freeSpace(68)
+        << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_PERSPECTIVE_TRANSFORM
+        << (float)transform.m11() << (float)transform.m12() << (float)transform.m13() << (float)transform.m14()
+        << (float)transform.m21() << (float)transform.m22() << (float)transform.m23() << (float)transform.m24()
+        << (float)transform.m31() << (float)transform.m32() << (float)transform.m33() << (float)transform.m34()
+        << (float)transform.m41() << (float)transform.m42() << (float)transform.m43() << (float)transform.m44();
 }
 
 void TextureMapperJava::beginClip(const TransformationMatrix& matrix, const FloatRoundedRect& rect)
@@ -76,12 +147,7 @@ void TextureMapperJava::drawTexture(const BitmapTexture& texture, const FloatRec
     context->save();
     context->setCompositeOperation(isInMaskMode() ? CompositeOperator::DestinationIn : CompositeOperator::SourceOver);
     context->setAlpha(opacity);
-    context->platformContext()->rq().freeSpace(68)
-        << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_PERSPECTIVE_TRANSFORM
-        << (float)transform.m11() << (float)transform.m12() << (float)transform.m13() << (float)transform.m14()
-        << (float)transform.m21() << (float)transform.m22() << (float)transform.m23() << (float)transform.m24()
-        << (float)transform.m31() << (float)transform.m32() << (float)transform.m33() << (float)transform.m34()
-        << (float)transform.m41() << (float)transform.m42() << (float)transform.m43() << (float)transform.m44();
+    setPerspectiveTransform(context->platformContext()->rq(), transform);
     context->drawImageBuffer(*image, targetRect);
     context->restore();
 }
@@ -94,12 +160,7 @@ void TextureMapperJava::drawSolidColor(const FloatRect& rect, const Transformati
 
     context->save();
     context->setCompositeOperation(isInMaskMode() ? CompositeOperator::DestinationIn : CompositeOperator::SourceOver);
-    context->platformContext()->rq().freeSpace(68)
-        << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_PERSPECTIVE_TRANSFORM
-        << (float)transform.m11() << (float)transform.m12() << (float)transform.m13() << (float)transform.m14()
-        << (float)transform.m21() << (float)transform.m22() << (float)transform.m23() << (float)transform.m24()
-        << (float)transform.m31() << (float)transform.m32() << (float)transform.m33() << (float)transform.m34()
-        << (float)transform.m41() << (float)transform.m42() << (float)transform.m43() << (float)transform.m44();
+    setPerspectiveTransform(context->platformContext()->rq(), transform);
 
     context->fillRect(rect, color);
     context->restore();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@
 #include "ImageBuffer.h"
 #include "TextureMapper.h"
 #include "GraphicsContext.h"
+#include <wtf/RecursiveLockAdapter.h>
 #if USE(TEXTURE_MAPPER)
 namespace WebCore {
 
@@ -60,9 +61,18 @@ public:
 
     void setGraphicsContext(GraphicsContext* context) { m_context = context; }
     GraphicsContext* graphicsContext() { return m_context; }
+
+    // Held while a layer tree is committed or painted, once pages composite
+    // on their own threads (see WebPageCompositor).
+    static RecursiveLock& layerTreeLock();
+    // Changes whenever a layer is destroyed. Until the next commit a tree
+    // may still point at it, so it must not be painted off the main thread.
+    static unsigned layerTreeGeneration();
+    static void layerTreeWillChange();
 private:
     RefPtr<BitmapTexture> m_currentSurface;
     GraphicsContext* m_context;
+    mutable int m_maxTextureDimension { 0 };
 };
 
 }
@@ -178,6 +178,56 @@ void TextureMapperLayer::paint(TextureMapper& textureMapper)
     paintRecursive(options);
 }
 
+#if PLATFORM(JAVA)
+FloatRect TextureMapperLayer::computeDamage()
+{
+    ComputeTransformData data;
+    computeTransformsRecursive(data);
+
+    FloatRect damage;
+    collectDamageRecursive(damage, false);
+    return damage;
+}
+
+FloatRect TextureMapperLayer::collectDamageRecursive(FloatRect& damage, bool ancestorChanged)
+{
+    FloatRect rect = layerRect();
+    if (m_currentFilters.hasOutsets()) {
+        auto outsets = m_currentFilters.outsets();
+        rect.move(-outsets.left(), -outsets.top());
+        rect.expand(outsets.left() + outsets.right(), outsets.top() + outsets.bottom());
+    }
+    FloatRect bounds = m_layerTransforms.combined.mapRect(rect);
+
+    bool changed = ancestorChanged || m_damage.changed || m_animations.hasRunningAnimations() || bounds != m_damage.bounds;
+    // Masks, replicas and backdrops are painted as part of this layer
+    for (auto* layer : { m_state.maskLayer.get(), m_state.replicaLayer.get(), m_state.backdropLayer.get() }) {
+        if (layer && (layer->m_damage.changed || !layer->m_damage.contentsRect.isEmpty())) {
+            layer->m_damage.changed = false;
+            layer->m_damage.contentsRect = { };
+            changed = true;
+        }
+    }
+
+    if (changed) {
+        // Also covers the descendants this layer no longer has
+        damage.unite(m_damage.subtreeBounds);
+        damage.unite(bounds);
+    } else if (!m_damage.contentsRect.isEmpty())
+        damage.unite(m_layerTransforms.combined.mapRect(m_damage.contentsRect));
+
+    FloatRect subtreeBounds = bounds;
+    for (auto* child : m_children)
+        subtreeBounds.unite(child->collectDamageRecursive(damage, changed));
+
+    m_damage.bounds = bounds;
+    m_damage.subtreeBounds = subtreeBounds;
+    m_damage.contentsRect = { };
+    m_damage.changed = false;
+    return subtreeBounds;
+}
+#endif
+
 void TextureMapperLayer::paintSelf(TextureMapperPaintOptions& options)
 {
     if (!m_state.visible || !m_state.contentsVisible)
@@ -102,6 +102,14 @@ public:
 
     void paint(TextureMapper&);
 
+#if PLATFORM(JAVA)
+    // Root coordinates area that the next paint() changes since the previous
+    // one. Computes the layer transforms the way paint() does.
+    FloatRect computeDamage();
+    void setNeedsDamage() { m_damage.changed = true; }
+    void addContentsDamage(const FloatRect& rect) { m_damage.contentsRect.unite(rect); }
+#endif
+
     void addChild(TextureMapperLayer*);
 
 private:
@@ -116,6 +124,9 @@ private:
 
     struct ComputeTransformData;
     void computeTransformsRecursive(ComputeTransformData&);
+#if PLATFORM(JAVA)
+    FloatRect collectDamageRecursive(FloatRect& damage, bool ancestorChanged);
+#endif
 
     static void sortByZOrder(Vector<TextureMapperLayer* >& array);
 
@@ -229,6 +240,18 @@ private:
     bool m_isBackdrop { false };
     bool m_isReplica { false };
 
+#if PLATFORM(JAVA)
+    struct {
+        // Root coordinates, as of the last computeDamage()
+        FloatRect bounds;
+        FloatRect subtreeBounds;
+        // Layer coordinates, repainted since then
+        FloatRect contentsRect;
+        // A committed property changed since then
+        bool changed { true };
+    } m_damage;
+#endif
+
     struct {
         TransformationMatrix localTransform;
         TransformationMatrix combined;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,8 +31,32 @@
 #include "Image.h"
 #include "com_sun_webkit_CursorManager.h"
 
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Vector.h>
+
 namespace WebCore {
 
+namespace {
+
+// EventHandler creates a new Cursor from the CSS cursor image on every
+// mouse move, the most recently used custom cursors are kept so that the
+// same image is not turned into a Java cursor again each time.
+struct CustomCursor {
+    RefPtr<NativeImage> image;
+    IntPoint hotspot;
+    PlatformCursor platformCursor;
+};
+
+constexpr size_t customCursorCacheSize = 8;
+
+Vector<CustomCursor>& customCursors()
+{
+    static NeverDestroyed<Vector<CustomCursor>> cursors;
+    return cursors;
+}
+
+}
+
 jclass getJCursorManagerClass()
 {
     static JGClass jCursorManagerClass(
@@ -64,6 +88,24 @@ Cursor::Cursor(Image* image, const IntPoint& hotspot)
         return;
     }
 
+    RefPtr<NativeImage> cursorImageFrame = image->javaImage();
+    if (!cursorImageFrame) {
+        return;
+    }
+
+    auto& cursors = customCursors();
+    for (size_t i = 0; i < cursors.size(); i++) {
+        if (cursors[i].image == cursorImageFrame && cursors[i].hotspot == hotspot) {
+            m_platformCursor = cursors[i].platformCursor;
+            if (i) {
+                auto cursor = WTFMove(cursors[i]);
+                cursors.remove(i);
+                cursors.insert(0, WTFMove(cursor));
+            }
+            return;
+        }
+    }
+
     JLObject jCursorManager(getJCursorManager());
     if (!jCursorManager) {
         return;
@@ -73,14 +115,16 @@ Cursor::Cursor(Image* image, const IntPoint& hotspot)
                                             "(Lcom/sun/webkit/graphics/WCImageFrame;II)J");
     ASSERT(mid);
 
-    RefPtr<NativeImage> cursorImageFrame = image->javaImage();
-    if (!cursorImageFrame) {
+    m_platformCursor = env->CallLongMethod(jCursorManager, mid, (jobject)(*cursorImageFrame->platformImage()->getImage()),
+                                         hotspot.x(), hotspot.y());
+    if (WTF::CheckAndClearException(env) || !m_platformCursor) {
         return;
     }
 
-    m_platformCursor = env->CallLongMethod(jCursorManager, mid, (jobject)(*cursorImageFrame->platformImage()->getImage()),
-                                         hotspot.x(), hotspot.y());
-    WTF::CheckAndClearException(env);
+    if (cursors.size() == customCursorCacheSize) {
+        cursors.removeLast();
+    }
+    cursors.insert(0, CustomCursor { WTFMove(cursorImageFrame), hotspot, m_platformCursor });
 }
 
 Cursor::Cursor(PlatformCursor c)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,46 +25,43 @@
 
 #include "config.h"
 #include "IDNJava.h"
-#include <wtf/java/JavaEnv.h>
-#include "com_sun_webkit_network_URLLoaderBase.h"
+#include <unicode/uidna.h>
+#include <wtf/text/StringView.h>
 
-namespace IDNJavaInternal {
+namespace WebCore {
 
-static JGClass idnClass;
-static jmethodID toASCIIMID;
+namespace IDNJava {
 
-static void initRefs(JNIEnv* env)
+// Converts with ICU's UTS #46 implementation rather than java.net.IDN,
+// so a conversion makes no JNI transition and allocates no Java strings.
+// Transitional processing matches the IDNA2003 behaviour of java.net.IDN.
+static const UIDNA* transcoder()
 {
-    if (!idnClass) {
-        idnClass = JLClass(env->FindClass("java/net/IDN"));
-        ASSERT(idnClass);
-
-        toASCIIMID = env->GetStaticMethodID(
-                idnClass,
-                "toASCII",
-                "(Ljava/lang/String;I)Ljava/lang/String;");
-        ASSERT(toASCIIMID);
-    }
-}
+    static UIDNA* encoder = [] {
+        UErrorCode error = U_ZERO_ERROR;
+        UIDNA* encoder = uidna_openUTS46(UIDNA_DEFAULT, &error);
+        ASSERT(U_SUCCESS(error));
+        return encoder;
+    }();
+    return encoder;
 }
 
-namespace WebCore {
-
-namespace IDNJava {
-
 String toASCII(const String& hostname)
 {
-    using namespace IDNJavaInternal;
-    JNIEnv* env = WTF::GetJavaEnv();
-    initRefs(env);
+    if (hostname.isEmpty() || !transcoder())
+        return hostname;
 
-    JLString result = static_cast<jstring>(env->CallStaticObjectMethod(
-            idnClass,
-            toASCIIMID,
-            (jstring)hostname.toJavaString(env),
-            com_sun_webkit_network_URLLoaderBase_ALLOW_UNASSIGNED));
-    WTF::CheckAndClearException(env);
-    return String(env, result);
+    // Host names are at most 255 characters once converted
+    constexpr int32_t bufferLength = 256;
+    UChar buffer[bufferLength];
+    UIDNAInfo info = UIDNA_INFO_INITIALIZER;
+    UErrorCode error = U_ZERO_ERROR;
+    auto characters = StringView(hostname).upconvertedCharacters();
+    int32_t length = uidna_nameToASCII(transcoder(), characters, hostname.length(),
+                                       buffer, bufferLength, &info, &error);
+    if (U_FAILURE(error) || info.errors)
+        return String();
+    return String(buffer, length);
 }
 
 } // namespace IDNJava
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,38 +30,51 @@
 
 #include <wtf/Assertions.h>
 #include <wtf/MainThread.h>
+#include <wtf/WallTime.h>
 
 namespace WebCore {
 
+// WebCore reschedules and stops the shared timer far more often than it
+// fires, so the deadline is kept here and Java is only told about it when
+// it has to fire earlier than what it is armed for. A Java timer that goes
+// off early or after stop() is re-armed or ignored in fireTimerEvent().
+static WallTime s_deadline { WallTime::infinity() };
+static WallTime s_armedFireTime { WallTime::infinity() };
+
+// A deadline this close after the armed one is left to fire a bit late
+static constexpr Seconds s_coalescingTolerance { 1_ms };
+static constexpr Seconds s_minimalInterval { 1_ns };
+
 // The fire time is relative to the classic POSIX epoch of January 1, 1970,
-// as the result of currentTime() is.
-#define MINIMAL_INTERVAL 1e-9 //1ns
-void MainThreadSharedTimer::setFireInterval(Seconds timeout)
+// as System.currentTimeMillis() is.
+static void armJavaTimer(WallTime fireTime)
 {
-    auto fireTime = timeout.value();
-    if (fireTime < MINIMAL_INTERVAL) {
-        fireTime = MINIMAL_INTERVAL;
-    }
     WC_GETJAVAENV_CHKRET(env);
 
     static jmethodID mid = env->GetStaticMethodID(getTimerClass(env),
                                                   "fwkSetFireTime", "(D)V");
     ASSERT(mid);
 
-    env->CallStaticVoidMethod(getTimerClass(env), mid, fireTime);
+    env->CallStaticVoidMethod(getTimerClass(env), mid, fireTime.secondsSinceEpoch().value());
     WTF::CheckAndClearException(env);
+    s_armedFireTime = fireTime;
 }
 
-void MainThreadSharedTimer::stop()
+void MainThreadSharedTimer::setFireInterval(Seconds timeout)
 {
-    WC_GETJAVAENV_CHKRET(env);
+    ASSERT(isMainThread());
 
-    static jmethodID mid = env->GetStaticMethodID(getTimerClass(env),
-                                                  "fwkStopTimer", "()V");
-    ASSERT(mid);
+    s_deadline = WallTime::now() + std::max(timeout, s_minimalInterval);
+    if (s_armedFireTime > s_deadline + s_coalescingTolerance)
+        armJavaTimer(s_deadline);
+}
 
-    env->CallStaticVoidMethod(getTimerClass(env), mid);
-    WTF::CheckAndClearException(env);
+void MainThreadSharedTimer::stop()
+{
+    ASSERT(isMainThread());
+
+    // Java still fires once, fireTimerEvent() ignores it
+    s_deadline = WallTime::infinity();
 }
 
 // JDK-8146958
@@ -69,6 +82,22 @@ void MainThreadSharedTimer::invalidate()
 {
 }
 
+static void fireTimerEvent()
+{
+    s_armedFireTime = WallTime::infinity();
+    if (s_deadline == WallTime::infinity())
+        return;
+
+    if (s_deadline - WallTime::now() > s_coalescingTolerance) {
+        // Rescheduled to a later time since Java was armed
+        armJavaTimer(s_deadline);
+        return;
+    }
+
+    s_deadline = WallTime::infinity();
+    MainThreadSharedTimer::singleton().fired();
+}
+
 } // namespace WebCore
 
 extern "C" {
@@ -76,7 +105,7 @@ extern "C" {
 JNIEXPORT void JNICALL Java_com_sun_webkit_Timer_twkFireTimerEvent
     (JNIEnv*, jclass)
 {
-    WebCore::MainThreadSharedTimer::singleton().fired();
+    WebCore::fireTimerEvent();
 }
 
 }
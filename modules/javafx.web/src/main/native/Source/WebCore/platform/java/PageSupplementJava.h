@@ -25,7 +25,9 @@
 
 #pragma once
 
+#include "FloatRect.h"
 #include "Supplementable.h"
+#include <optional>
 #include <wtf/java/JavaRef.h>
 #include <jni.h>
 
@@ -45,8 +47,18 @@ class PageSupplementJava final : public Supplement<WebCore::Page> {
     WEBCORE_EXPORT static PageSupplementJava* from(Frame*);
     WEBCORE_EXPORT static PageSupplementJava* from(Page*);
 
+    // Screen properties of the page, cached by PlatformScreenJava
+    struct ScreenProperties {
+        unsigned generation { 0 };
+        std::optional<int> depth;
+        std::optional<FloatRect> rect;
+        std::optional<FloatRect> availableRect;
+    };
+    ScreenProperties& screenProperties() { return m_screenProperties; }
+
   private:
     JGObject m_webPage;
+    ScreenProperties m_screenProperties;
 };
 
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -235,13 +235,27 @@ std::unique_ptr<Pasteboard> Pasteboard::create(RefPtr<DataObjectJava> dataObject
 std::unique_ptr<Pasteboard> Pasteboard::createForCopyAndPaste(std::unique_ptr<PasteboardContext>&&)
 {
     // Use single shared data instance for all copy'n'paste pasteboards.
+    // It is filled from the system clipboard when first read, see
+    // readClipboardDataIfNeeded().
     static RefPtr<DataObjectJava> data = DataObjectJava::create();
-    // TODO: setURL, setFiles, setData, setHtml (needs URL)
-    data->setPlainText(jGetPlainText());
-    data->setData(DataObjectJava::mimeHTML(), jGetPlainText());
     return std::unique_ptr<Pasteboard>(new Pasteboard(data, true));
 }
 
+void Pasteboard::readClipboardDataIfNeeded()
+{
+    // Copying only writes to the clipboard, and the clipboard may hold a
+    // lot of text, so it is not converted until the data object is used.
+    if (!m_copyPasteMode || m_clipboardDataRead) {
+        return;
+    }
+    m_clipboardDataRead = true;
+
+    // TODO: setURL, setFiles, setData, setHtml (needs URL)
+    String plainText = jGetPlainText();
+    m_dataObject->setPlainText(plainText);
+    m_dataObject->setData(DataObjectJava::mimeHTML(), plainText);
+}
+
 #if ENABLE(DRAG_SUPPORT)
 std::unique_ptr<Pasteboard> Pasteboard::createForDragAndDrop(std::unique_ptr<PasteboardContext>&&)
 {
@@ -274,6 +288,7 @@ void Pasteboard::writeSelection(
 #endif
     replaceNBSPWithSpace(plainText);
 
+    m_clipboardDataRead = true;
     m_dataObject->clear();
     m_dataObject->setPlainText(plainText);
     m_dataObject->setHTML(markup, frame.document()->url());
@@ -291,6 +306,7 @@ void Pasteboard::writePlainText(const String& text, SmartReplaceOption)
 #endif
 
     if (m_dataObject) {
+        m_clipboardDataRead = true;
         m_dataObject->clear();
         m_dataObject->setPlainText(plainText);
     }
@@ -312,6 +328,7 @@ void Pasteboard::write(const PasteboardURL& pasteboardURL)
     }
     String markup(urlToMarkup(pasteboardURL.url, title));
 
+    m_clipboardDataRead = true;
     m_dataObject->clear();
     m_dataObject->setURL(pasteboardURL.url, title);
     m_dataObject->setPlainText(pasteboardURL.url.string());
@@ -324,6 +341,7 @@ void Pasteboard::write(const PasteboardURL& pasteboardURL)
 
 void Pasteboard::writeImage(Element& element, const URL& url, const String& title)
 {
+    readClipboardDataIfNeeded();
     m_dataObject->setURL(url, title);
 
     // Write the bytes of the image to the file format
@@ -366,6 +384,7 @@ void Pasteboard::writeString(const String& type, const String& data)
 {
     // DnD only mode
     if (m_dataObject) {
+        readClipboardDataIfNeeded();
         m_dataObject->setData(type, data);
     }
 }
@@ -374,6 +393,7 @@ String Pasteboard::readString(const String& type)
 {
     // DnD only mode
     if (m_dataObject) {
+        readClipboardDataIfNeeded();
         return m_dataObject->getData(type);
     }
     return String();
@@ -382,6 +402,7 @@ String Pasteboard::readString(const String& type)
 void Pasteboard::clear(const String& type)
 {
     if (m_dataObject) {
+        readClipboardDataIfNeeded();
         m_dataObject->clearData(type);
     }
     if (m_copyPasteMode) {
@@ -398,6 +419,7 @@ void Pasteboard::clear(const String& type)
 void Pasteboard::clear()
 {
     if (m_dataObject) {
+        m_clipboardDataRead = true;
         m_dataObject->clear();
     }
     if (m_copyPasteMode) {
@@ -422,6 +444,7 @@ String Pasteboard::readOrigin()
 Vector<String> Pasteboard::typesForLegacyUnsafeBindings()
 {
     if (m_dataObject) {
+        readClipboardDataIfNeeded();
         return m_dataObject->types();
     }
     return Vector<String>();
@@ -429,12 +452,17 @@ Vector<String> Pasteboard::typesForLegacyUnsafeBindings()
 
 bool Pasteboard::hasData()
 {
-    return m_dataObject && m_dataObject->hasData();
+    if (!m_dataObject) {
+        return false;
+    }
+    readClipboardDataIfNeeded();
+    return m_dataObject->hasData();
 }
 
 void Pasteboard::read(PasteboardFileReader& reader, std::optional<size_t>)
 {
     if (m_dataObject) {
+        readClipboardDataIfNeeded();
         for (const auto& filename : m_dataObject->asFilenames())
             reader.readFilename(filename);
     }
@@ -459,6 +487,10 @@ void Pasteboard::read(PasteboardPlainText& text, PlainTextURLReadingPolicy, std:
     if (m_copyPasteMode) {
         text.text = jGetPlainText();
         if (m_dataObject) {
+            if (!m_clipboardDataRead) {
+                m_clipboardDataRead = true;
+                m_dataObject->setData(DataObjectJava::mimeHTML(), text.text);
+            }
             m_dataObject->setPlainText(text.text);
         }
         return;
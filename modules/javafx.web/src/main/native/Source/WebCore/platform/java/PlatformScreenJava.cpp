@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,8 @@
 #include "Frame.h"
 #include "FrameView.h"
 #include "HostWindow.h"
+#include "LocalFrameView.h"
+#include "PageSupplementJava.h"
 #include "PlatformJavaClasses.h"
 #include "PlatformScreen.h"
 #include "ScrollView.h"
@@ -48,6 +50,25 @@ static jfieldID recthFID;
 static jmethodID getScreenDepthMID;
 static jmethodID getScreenRectMID;
 
+// Bumped whenever the screens change, which makes the properties cached
+// for every page stale
+static unsigned screenGeneration = 1;
+
+static WebCore::PageSupplementJava::ScreenProperties* cachedScreenProperties(WebCore::Widget* w)
+{
+    auto* view = dynamicDowncast<WebCore::LocalFrameView>(w->root());
+    WebCore::Page* page = view ? view->frame().page() : nullptr;
+    if (!page)
+        return nullptr;
+
+    auto& properties = WebCore::PageSupplementJava::from(page)->screenProperties();
+    if (properties.generation != screenGeneration) {
+        properties = { };
+        properties.generation = screenGeneration;
+    }
+    return &properties;
+}
+
 static void initRefs(JNIEnv* env)
 {
     if (!widgetClass) {
@@ -84,6 +105,11 @@ static void initRefs(JNIEnv* env)
 namespace WebCore
 {
 
+void screenPropertiesChanged()
+{
+    ++PlatformScreenJavaInternal::screenGeneration;
+}
+
 int screenHorizontalDPI(Widget*)
 {
     notImplemented();
@@ -108,6 +134,10 @@ int screenDepth(Widget* w)
     if (!j)
         return 24;
 
+    auto* properties = cachedScreenProperties(w);
+    if (properties && properties->depth)
+        return *properties->depth;
+
     JNIEnv* env = WTF::GetJavaEnv();
     initRefs(env);
 
@@ -116,6 +146,8 @@ int screenDepth(Widget* w)
             getScreenDepthMID));
     WTF::CheckAndClearException(env);
 
+    if (properties)
+        properties->depth = depth;
     return depth;
 }
 
@@ -142,6 +174,11 @@ FloatRect getScreenRect(Widget* w, bool available)
     if (!j)
         return IntRect(0, 0, 0, 0);
 
+    auto* properties = cachedScreenProperties(w);
+    auto* cached = properties ? &(available ? properties->availableRect : properties->rect) : nullptr;
+    if (cached && *cached)
+        return **cached;
+
     JNIEnv* env = WTF::GetJavaEnv();
     initRefs(env);
 
@@ -160,6 +197,8 @@ FloatRect getScreenRect(Widget* w, bool available)
     float width = env->GetFloatField(rect, rectwFID);
     float height = env->GetFloatField(rect, recthFID);
 
+    if (cached)
+        *cached = FloatRect(x, y, width, height);
     return FloatRect(x, y, width, height);
 }
 
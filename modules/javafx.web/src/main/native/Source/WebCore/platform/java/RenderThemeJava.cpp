@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -274,14 +274,21 @@ void RenderThemeJava::setRadioSize(RenderStyle& style) const
         return;
     }
 
-    JNIEnv* env = WTF::GetJavaEnv();
+    // The size comes from the default theme object and only depends on the
+    // user agent stylesheet, so ask for it once rather than on every layout.
+    static int radioRadius = 0;
+    if (!radioRadius) {
+        JNIEnv* env = WTF::GetJavaEnv();
 
-    static jmethodID mid = env->GetMethodID(PG_GetRenderThemeClass(env), "getRadioButtonSize", "()I");
-    ASSERT(mid);
+        static jmethodID mid = env->GetMethodID(PG_GetRenderThemeClass(env), "getRadioButtonSize", "()I");
+        ASSERT(mid);
 
-    // Get from default theme object.
-    int radioRadius = env->CallIntMethod((jobject)PG_GetRenderThemeObjectFromPage(env, nullptr), mid);
-    WTF::CheckAndClearException(env);
+        radioRadius = env->CallIntMethod((jobject)PG_GetRenderThemeObjectFromPage(env, nullptr), mid);
+        if (WTF::CheckAndClearException(env)) {
+            radioRadius = 0;
+            return;
+        }
+    }
 
     if (style.width().isIntrinsicOrAuto()) {
         style.setWidth(Length(radioRadius, LengthType::Fixed));
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "ScriptBytecodeCacheJava.h"
+
+#include <JavaScriptCore/BytecodeCacheError.h>
+#include <JavaScriptCore/CachedBytecode.h>
+#include <JavaScriptCore/CachedTypes.h>
+#include <JavaScriptCore/UnlinkedFunctionExecutable.h>
+#include <wtf/FileSystem.h>
+#include <wtf/HexNumber.h>
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Scope.h>
+#include <wtf/text/StringConcatenateNumbers.h>
+
+namespace WebCore {
+
+static String& cacheDirectory()
+{
+    static NeverDestroyed<String> directory;
+    return directory;
+}
+
+void ScriptBytecodeCacheJava::setDirectory(const String& path)
+{
+    ASSERT(isMainThread());
+    cacheDirectory() = path;
+}
+
+ScriptBytecodeCacheJava::ScriptBytecodeCacheJava(const JSC::SourceProvider& provider)
+{
+    // Scripts evaluated by workers may outlive the page, only cache on the
+    // main thread where the cache directory is owned.
+    const String& directory = cacheDirectory();
+    const URL& url = provider.sourceOrigin().url();
+    if (directory.isEmpty() || !isMainThread() || url.isEmpty())
+        return;
+
+    m_path = FileSystem::pathByAppendingComponent(directory,
+        makeString(hex(url.string().hash(), 8), '-', hex(provider.hash(), 8), ".bytecode-cache"_s));
+}
+
+RefPtr<JSC::CachedBytecode> ScriptBytecodeCacheJava::cachedBytecode() const
+{
+    if (!m_loaded)
+        loadBytecode();
+    return m_cachedBytecode;
+}
+
+void ScriptBytecodeCacheJava::loadBytecode() const
+{
+    m_loaded = true;
+    if (!isEnabled())
+        return;
+
+    auto fd = FileSystem::openFile(m_path, FileSystem::FileOpenMode::Read);
+    if (!FileSystem::isHandleValid(fd))
+        return;
+
+    auto closeFD = makeScopeExit([&] {
+        FileSystem::closeFile(fd);
+    });
+
+    bool success;
+    FileSystem::MappedFileData mappedFileData(fd, FileSystem::MappedFileMode::Private, success);
+    if (!success || !mappedFileData.size())
+        return;
+
+    m_cachedBytecode = JSC::CachedBytecode::create(WTFMove(mappedFileData));
+}
+
+void ScriptBytecodeCacheJava::updateCache(const JSC::UnlinkedFunctionExecutable* executable, JSC::CodeSpecializationKind kind, const JSC::UnlinkedFunctionCodeBlock* codeBlock) const
+{
+    if (!isEnabled() || !m_cachedBytecode)
+        return;
+
+    JSC::BytecodeCacheError error;
+    RefPtr<JSC::CachedBytecode> cachedBytecode = JSC::encodeFunctionCodeBlock(executable->vm(), codeBlock, error);
+    if (cachedBytecode && !error.isValid())
+        m_cachedBytecode->addFunctionUpdate(executable, kind, *cachedBytecode);
+}
+
+void ScriptBytecodeCacheJava::cacheBytecode(const JSC::SourceProvider::BytecodeCacheGenerator& generator) const
+{
+    if (!isEnabled())
+        return;
+
+    if (!m_cachedBytecode)
+        m_cachedBytecode = JSC::CachedBytecode::create();
+    if (auto update = generator())
+        m_cachedBytecode->addGlobalUpdate(*update);
+}
+
+void ScriptBytecodeCacheJava::commitCachedBytecode() const
+{
+    if (!isEnabled() || !m_cachedBytecode || !m_cachedBytecode->hasUpdates())
+        return;
+
+    auto clearBytecode = makeScopeExit([&] {
+        m_cachedBytecode = nullptr;
+    });
+
+    auto fd = FileSystem::openFile(m_path, FileSystem::FileOpenMode::ReadWrite);
+    if (!FileSystem::isHandleValid(fd))
+        return;
+
+    auto closeFD = makeScopeExit([&] {
+        FileSystem::closeFile(fd);
+    });
+
+    auto fileSize = FileSystem::fileSize(fd);
+    if (!fileSize || *fileSize != m_cachedBytecode->size()) {
+        // The cache file has been rewritten since it was mapped.
+        return;
+    }
+
+    if (!FileSystem::truncateFile(fd, m_cachedBytecode->sizeForUpdate()))
+        return;
+
+    m_cachedBytecode->commitUpdates([&] (off_t offset, const void* data, size_t size) {
+        if (FileSystem::seekFile(fd, offset, FileSystem::FileSeekOrigin::Beginning) == -1)
+            return;
+        FileSystem::writeToFile(fd, data, size);
+    });
+}
+
+} // namespace WebCore
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <JavaScriptCore/SourceProvider.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebCore {
+
+// On-disk JavaScriptCore bytecode cache for scripts loaded by the page.
+// Entries are keyed by script URL and source hash. The cache is disabled
+// until a directory has been set with setDirectory().
+class ScriptBytecodeCacheJava {
+    WTF_MAKE_FAST_ALLOCATED;
+    WTF_MAKE_NONCOPYABLE(ScriptBytecodeCacheJava);
+public:
+    WEBCORE_EXPORT static void setDirectory(const String&);
+
+    explicit ScriptBytecodeCacheJava(const JSC::SourceProvider&);
+
+    RefPtr<JSC::CachedBytecode> cachedBytecode() const;
+    void updateCache(const JSC::UnlinkedFunctionExecutable*, JSC::CodeSpecializationKind, const JSC::UnlinkedFunctionCodeBlock*) const;
+    void cacheBytecode(const JSC::SourceProvider::BytecodeCacheGenerator&) const;
+    void commitCachedBytecode() const;
+
+private:
+    bool isEnabled() const { return !m_path.isNull(); }
+    void loadBytecode() const;
+
+    String m_path;
+    mutable RefPtr<JSC::CachedBytecode> m_cachedBytecode;
+    mutable bool m_loaded { false };
+};
+
+} // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -120,8 +120,29 @@ IntRect getPartRect(Scrollbar& scrollbar, ScrollbarPart part) {
     jint *r = (jint*)env->GetPrimitiveArrayCritical(jrect, 0);
     IntRect rect(r[0], r[1], r[2], r[3]);
     env->ReleasePrimitiveArrayCritical(jrect, r, 0);
-    if (rect.isEmpty()) {
-        return rect;
+    return rect;
+}
+
+IntRect ScrollbarThemeJava::partRect(Scrollbar& scrollbar, ScrollbarPart part)
+{
+    auto& cache = m_partRects.add(&scrollbar, PartRects { }).iterator->value;
+    if (cache.size != scrollbar.frameRect().size() || cache.orientation != scrollbar.orientation()) {
+        cache.size = scrollbar.frameRect().size();
+        cache.orientation = scrollbar.orientation();
+        cache.rects.clear();
+    }
+
+    IntRect rect;
+    auto index = cache.rects.findIf([part](auto& entry) { return entry.first == part; });
+    if (index != notFound) {
+        rect = cache.rects[index].second;
+    } else {
+        rect = getPartRect(scrollbar, part);
+        if (rect.isEmpty()) {
+            // No widget yet, ask again next time
+            return rect;
+        }
+        cache.rects.append({ part, rect });
     }
     // Bounding box should be absolute location, so adjust according to
     // the position of scrollbar.
@@ -129,6 +150,16 @@ IntRect getPartRect(Scrollbar& scrollbar, ScrollbarPart part) {
     return rect;
 }
 
+void ScrollbarThemeJava::unregisterScrollbar(Scrollbar& scrollbar)
+{
+    m_partRects.remove(&scrollbar);
+}
+
+void ScrollbarThemeJava::themeChanged()
+{
+    m_partRects.clear();
+}
+
 
 bool ScrollbarThemeJava::paint(Scrollbar& scrollbar, GraphicsContext& gc, const IntRect& damageRect)
 {
@@ -152,6 +183,9 @@ bool ScrollbarThemeJava::paint(Scrollbar& scrollbar, GraphicsContext& gc, const
         return true;
     }
 
+    // The Java widget is updated below and may lay out its parts anew
+    m_partRects.remove(&scrollbar);
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(
@@ -208,15 +242,15 @@ bool ScrollbarThemeJava::hasThumb(Scrollbar& scrollbar)
 }
 
 IntRect ScrollbarThemeJava::backButtonRect(Scrollbar& scrollbar, ScrollbarPart part, bool) {
-    return getPartRect(scrollbar, part);
+    return partRect(scrollbar, part);
 }
 
 IntRect ScrollbarThemeJava::forwardButtonRect(Scrollbar& scrollbar, ScrollbarPart part, bool) {
-    return getPartRect(scrollbar, part);
+    return partRect(scrollbar, part);
 }
 
 IntRect ScrollbarThemeJava::trackRect(Scrollbar& scrollbar, bool) {
-    return getPartRect(scrollbar, TrackBGPart);
+    return partRect(scrollbar, TrackBGPart);
 }
     // REVISIT
 int ScrollbarThemeJava::scrollbarThickness(ScrollbarWidth, ScrollbarExpansionState)
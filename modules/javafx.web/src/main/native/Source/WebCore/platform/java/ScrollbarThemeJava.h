@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,8 @@
 
 #include "PlatformJavaClasses.h"
 #include "ScrollbarThemeComposite.h"
+#include <wtf/HashMap.h>
+#include <wtf/Vector.h>
 
 namespace WebCore {
 
@@ -46,6 +48,22 @@ public:
     bool usesOverlayScrollbars() const final { return true; }
     // When using overlay scrollbars, always invalidate the whole scrollbar when entering/leaving.
     bool invalidateOnMouseEnterExit() override { return usesOverlayScrollbars(); }
+
+    void unregisterScrollbar(Scrollbar&) override;
+    void themeChanged() override;
+
+private:
+    IntRect partRect(Scrollbar&, ScrollbarPart);
+
+    // Part rects are asked for many times between two paints of a
+    // scrollbar, so they are kept, relative to the scrollbar, until its
+    // next paint or a change of its size or orientation.
+    struct PartRects {
+        IntSize size;
+        ScrollbarOrientation orientation { ScrollbarOrientation::Horizontal };
+        Vector<std::pair<ScrollbarPart, IntRect>, 3> rects;
+    };
+    HashMap<const Scrollbar*, PartRects> m_partRects;
 };
 
 } // namespace WebCore
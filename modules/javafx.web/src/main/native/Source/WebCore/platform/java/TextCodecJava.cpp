@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,7 @@ static jmethodID ctorMID;
 static jmethodID getEncodingsMID;
 static jmethodID encodeMID;
 static jmethodID decodeMID;
+static jmethodID isASCIICompatibleMID;
 
 static std::unique_ptr<TextCodec> newTextCodecJava(const TextEncoding& encoding, const void*)
 {
@@ -61,6 +62,8 @@ static JNIEnv* setUpCodec() {
         decodeMID = env->GetMethodID(
                 textCodecClass, "decode", "([B)Ljava/lang/String;");
         ASSERT(decodeMID);
+        isASCIICompatibleMID = env->GetMethodID(textCodecClass, "isASCIICompatible", "()Z");
+        ASSERT(isASCIICompatibleMID);
         getEncodingsMID = env->GetStaticMethodID(
                 textCodecClass, "getEncodings", "()[Ljava/lang/String;");
         ASSERT(getEncodingsMID);
@@ -147,6 +150,10 @@ TextCodecJava::TextCodecJava(const TextEncoding& encoding)
     m_codec = env->NewGlobalRef(codec);
     ASSERT(m_codec);
     env->DeleteLocalRef(codec);
+
+    m_isASCIICompatible = env->CallBooleanMethod(m_codec, isASCIICompatibleMID);
+    if (WTF::CheckAndClearException(env))
+        m_isASCIICompatible = false;
 }
 
 TextCodecJava::~TextCodecJava()
@@ -158,9 +165,27 @@ TextCodecJava::~TextCodecJava()
     }
 }
 
+// ESC, SO and SI switch modes in stateful encodings such as ISO-2022-JP
+static bool isPlainASCII(const char* bytes, size_t length)
+{
+    // Branch free so that the compiler can vectorize the scan
+    uint8_t nonASCII = 0;
+    uint8_t shifts = 0;
+    for (size_t i = 0; i < length; ++i) {
+        uint8_t c = static_cast<uint8_t>(bytes[i]);
+        nonASCII |= c;
+        shifts |= (c == 0x0E) | (c == 0x0F) | (c == 0x1B);
+    }
+    return !(nonASCII & 0x80) && !shifts;
+}
+
 String TextCodecJava::decode(const char* bytes, size_t length, bool flush,
                              bool stopOnError, bool& sawError)
 {
+    // Most HTML and JSON is ASCII whatever the declared charset is
+    if (m_isASCIICompatible && isPlainASCII(bytes, length))
+        return String(reinterpret_cast<const LChar*>(bytes), length);
+
     JNIEnv* env = setUpCodec();
 
     JLocalRef<jbyteArray> barr(env->NewByteArray(length));
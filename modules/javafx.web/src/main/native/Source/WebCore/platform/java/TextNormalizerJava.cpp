@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,46 +25,54 @@
 
 #include "config.h"
 
-#include "PlatformJavaClasses.h"
 #include "TextNormalizerJava.h"
+#include <unicode/unorm2.h>
+#include <wtf/Vector.h>
 
 namespace WebCore {
 
 namespace TextNormalizer {
 
-    static JGClass textNormalizerClass;
-    static jmethodID normalizeMID;
-
-    static JNIEnv* setUpNormalizer(void)
+    // ICU is linked in every configuration, so normalize with unorm2
+    // rather than calling java.text.Normalizer over JNI.
+    static const UNormalizer2* normalizer(Form form, UErrorCode* status)
     {
-        JNIEnv* env = WTF::GetJavaEnv();
-
-        if (! textNormalizerClass) {
-            textNormalizerClass = JLClass(env->FindClass(
-                         "com/sun/webkit/text/TextNormalizer"));
-            ASSERT(textNormalizerClass);
-            normalizeMID = env->GetStaticMethodID(textNormalizerClass,
-                    "normalize", "(Ljava/lang/String;I)Ljava/lang/String;");
-            ASSERT(normalizeMID);
+        switch (form) {
+        case NFC:
+            return unorm2_getNFCInstance(status);
+        case NFD:
+            return unorm2_getNFDInstance(status);
+        case NFKC:
+            return unorm2_getNFKCInstance(status);
+        case NFKD:
+            return unorm2_getNFKDInstance(status);
         }
-
-        return env;
+        ASSERT_NOT_REACHED();
+        return nullptr;
     }
 
     String normalize(const UChar* data, int length, Form form)
     {
-        JNIEnv *env = setUpNormalizer();
+        UErrorCode status = U_ZERO_ERROR;
+        const UNormalizer2* n = normalizer(form, &status);
+        if (!n || U_FAILURE(status))
+            return String(data, length);
 
-        JLString jData(env->NewString(reinterpret_cast<const jchar*>(data), length));
-        ASSERT(jData);
-        WTF::CheckAndClearException(env); // OOME
+        // Most text is already normalized, so skip the copy in that case
+        if (unorm2_isNormalized(n, data, length, &status) && U_SUCCESS(status))
+            return String(data, length);
 
-        JLString s(static_cast<jstring>(env->CallStaticObjectMethod(
-                textNormalizerClass, normalizeMID, (jstring)jData, form)));
-        ASSERT(s);
-        WTF::CheckAndClearException(env);
+        status = U_ZERO_ERROR;
+        int32_t normalizedLength = unorm2_normalize(n, data, length, nullptr, 0, &status);
+        if (status != U_BUFFER_OVERFLOW_ERROR && U_FAILURE(status))
+            return String(data, length);
 
-        return String(env, s);
+        Vector<UChar> buffer(normalizedLength);
+        status = U_ZERO_ERROR;
+        unorm2_normalize(n, data, length, buffer.data(), normalizedLength, &status);
+        if (U_FAILURE(status))
+            return String(data, length);
+        return String(buffer.data(), normalizedLength);
     }
 
 } // namespace TextNormalizer
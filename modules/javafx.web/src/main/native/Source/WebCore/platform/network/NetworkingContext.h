@@ -37,6 +37,9 @@ typedef struct _SoupSession SoupSession;
 
 namespace WebCore {
 
+#if PLATFORM(JAVA)
+class HTTPDiskCacheJava;
+#endif
 class NetworkStorageSession;
 class ResourceError;
 class ResourceRequest;
@@ -62,6 +65,10 @@ public:
     virtual ResourceError blockedError(const ResourceRequest&) const = 0;
 #endif
 
+#if PLATFORM(JAVA)
+    virtual HTTPDiskCacheJava* diskCache() const { return nullptr; }
+#endif
+
 protected:
     NetworkingContext() = default;
 };
@@ -28,30 +28,180 @@
 
 #if PLATFORM(JAVA)
 
-#include "NotImplemented.h"
+#include "PlatformJavaClasses.h"
+#include <wtf/CompletionHandler.h>
+#include <wtf/MainThread.h>
+#include <wtf/java/JavaEnv.h>
+
+namespace DNSResolveQueueJavaInternal {
+
+static JGClass networkContextClass;
+static jmethodID isUsingProxyMethod;
+static jmethodID prefetchDNSMethod;
+static jmethodID resolveDNSMethod;
+
+static void initRefs(JNIEnv* env)
+{
+    if (!networkContextClass) {
+        networkContextClass = JLClass(env->FindClass(
+                "com/sun/webkit/network/NetworkContext"));
+        ASSERT(networkContextClass);
+
+        isUsingProxyMethod = env->GetStaticMethodID(
+                networkContextClass, "fwkIsUsingProxy", "()Z");
+        ASSERT(isUsingProxyMethod);
+
+        prefetchDNSMethod = env->GetStaticMethodID(
+                networkContextClass, "fwkPrefetchDNS", "(Ljava/lang/String;)Z");
+        ASSERT(prefetchDNSMethod);
+
+        resolveDNSMethod = env->GetStaticMethodID(
+                networkContextClass, "fwkResolveDNS", "(Ljava/lang/String;J)V");
+        ASSERT(resolveDNSMethod);
+    }
+}
+
+// A prefetched host is not looked up again for this long. This matches the
+// default positive TTL of java's InetAddress cache.
+static const Seconds prefetchedHostTTL { 30_s };
+
+// Upper bound of the number of hosts remembered as prefetched.
+static const unsigned maxPrefetchedHosts = 256;
+
+}
 
 namespace WebCore {
 
 void DNSResolveQueueJava::updateIsUsingProxy()
 {
-    notImplemented();
+    using namespace DNSResolveQueueJavaInternal;
+    JNIEnv* env = WTF::GetJavaEnv();
+    initRefs(env);
+
+    jboolean usingProxy = env->CallStaticBooleanMethod(networkContextClass, isUsingProxyMethod);
+    if (WTF::CheckAndClearException(env)) {
+        m_isUsingProxy = true;
+        return;
+    }
+    m_isUsingProxy = jbool_to_bool(usingProxy);
+}
+
+bool DNSResolveQueueJava::wasRecentlyPrefetched(const String& hostname)
+{
+    using namespace DNSResolveQueueJavaInternal;
+    MonotonicTime now = MonotonicTime::now();
+
+    auto it = m_prefetchedHosts.find(hostname);
+    if (it != m_prefetchedHosts.end()) {
+        if (it->value > now)
+            return true;
+        m_prefetchedHosts.remove(it);
+    }
+
+    if (m_prefetchedHosts.size() >= maxPrefetchedHosts) {
+        m_prefetchedHosts.removeIf([now](auto& entry) {
+            return entry.value <= now;
+        });
+        // Still full of live entries: drop an arbitrary one.
+        if (m_prefetchedHosts.size() >= maxPrefetchedHosts)
+            m_prefetchedHosts.remove(m_prefetchedHosts.begin());
+    }
+    m_prefetchedHosts.set(hostname, now + prefetchedHostTTL);
+    return false;
+}
+
+void DNSResolveQueueJava::platformResolve(const String& hostname)
+{
+    using namespace DNSResolveQueueJavaInternal;
+    ASSERT(isMainThread());
+
+    if (wasRecentlyPrefetched(hostname)) {
+        decrementRequestCount();
+        return;
+    }
+
+    JNIEnv* env = WTF::GetJavaEnv();
+    initRefs(env);
+
+    // The prefetch is dropped when the resolver threads are busy
+    jboolean queued = env->CallStaticBooleanMethod(networkContextClass, prefetchDNSMethod,
+        (jstring)JLString(hostname.toJavaString(env)));
+    if (WTF::CheckAndClearException(env) || !queued)
+        decrementRequestCount();
 }
 
-void DNSResolveQueueJava::platformResolve(const String& /* hostname */)
+void DNSResolveQueueJava::didPrefetch(const String&)
 {
-    notImplemented();
+    decrementRequestCount();
 }
 
-void DNSResolveQueueJava::resolve(const String& /* hostname */, uint64_t /* identifier */, DNSCompletionHandler&& /* completionHandler */)
+void DNSResolveQueueJava::resolve(const String& hostname, uint64_t identifier, DNSCompletionHandler&& completionHandler)
 {
-    notImplemented();
+    using namespace DNSResolveQueueJavaInternal;
+    ASSERT(isMainThread());
+
+    JNIEnv* env = WTF::GetJavaEnv();
+    initRefs(env);
+
+    m_pendingResolves.set(identifier, WTFMove(completionHandler));
+    env->CallStaticVoidMethod(networkContextClass, resolveDNSMethod,
+        (jstring)JLString(hostname.toJavaString(env)), static_cast<jlong>(identifier));
+    if (WTF::CheckAndClearException(env))
+        didResolve(identifier, makeUnexpected(DNSError::Unknown));
 }
 
-void DNSResolveQueueJava::stopResolve(uint64_t /* identifier */)
+void DNSResolveQueueJava::stopResolve(uint64_t identifier)
 {
-    notImplemented();
+    // The java lookup cannot be interrupted; its result is dropped.
+    if (auto completionHandler = m_pendingResolves.take(identifier))
+        completionHandler(makeUnexpected(DNSError::Cancelled));
 }
 
+void DNSResolveQueueJava::didResolve(uint64_t identifier, DNSAddressesOrError&& result)
+{
+    if (auto completionHandler = m_pendingResolves.take(identifier))
+        completionHandler(WTFMove(result));
 }
 
+}
+
+using namespace WebCore;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_NetworkContext_twkDidPrefetchDNS
+    (JNIEnv* env, jclass, jstring hostname)
+{
+    static_cast<DNSResolveQueueJava&>(DNSResolveQueue::singleton()).didPrefetch(String(env, hostname));
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_NetworkContext_twkDidResolveDNS
+    (JNIEnv* env, jclass, jlong identifier, jobjectArray addresses)
+{
+    auto& queue = static_cast<DNSResolveQueueJava&>(DNSResolveQueue::singleton());
+    if (!addresses) {
+        queue.didResolve(static_cast<uint64_t>(identifier), makeUnexpected(DNSError::CannotResolve));
+        return;
+    }
+
+    Vector<IPAddress> result;
+    jsize count = env->GetArrayLength(addresses);
+    for (jsize i = 0; i < count; ++i) {
+        JLString jaddress(static_cast<jstring>(env->GetObjectArrayElement(addresses, i)));
+        if (auto address = IPAddress::fromString(String(env, jaddress)))
+            result.append(WTFMove(*address));
+    }
+    if (result.isEmpty()) {
+        queue.didResolve(static_cast<uint64_t>(identifier), makeUnexpected(DNSError::CannotResolve));
+        return;
+    }
+    queue.didResolve(static_cast<uint64_t>(identifier), WTFMove(result));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
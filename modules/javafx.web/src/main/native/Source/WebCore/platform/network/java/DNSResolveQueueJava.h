@@ -26,6 +26,8 @@
 #pragma once
 
 #include "DNSResolveQueue.h"
+#include <wtf/HashMap.h>
+#include <wtf/MonotonicTime.h>
 
 namespace WebCore {
 
@@ -35,9 +37,21 @@ public:
     void resolve(const String& hostname, uint64_t identifier, DNSCompletionHandler&&) final;
     void stopResolve(uint64_t identifier) final;
 
+    // Called back from java on the main thread once a lookup is done.
+    void didPrefetch(const String& hostname);
+    void didResolve(uint64_t identifier, DNSAddressesOrError&&);
+
 private:
     void updateIsUsingProxy() final;
     void platformResolve(const String&) final;
+
+    bool wasRecentlyPrefetched(const String& hostname);
+
+    HashMap<uint64_t, DNSCompletionHandler> m_pendingResolves;
+    // Hosts prefetched recently, with the time the entry expires. The
+    // addresses themselves are cached by java's InetAddress, which is what
+    // the java loaders connect through.
+    HashMap<String, MonotonicTime> m_prefetchedHosts;
 };
 
 using DNSResolveQueuePlatform = DNSResolveQueueJava;
@@ -0,0 +1,539 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "HTTPDiskCacheJava.h"
+
+#include "CacheValidation.h"
+#include "HTTPHeaderNames.h"
+#include "ResourceRequest.h"
+#include <wtf/CrossThreadCopier.h>
+#include <wtf/FileSystem.h>
+#include <wtf/HashSet.h>
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/SHA1.h>
+#include <wtf/text/StringBuilder.h>
+#include <wtf/text/StringToIntegerConversion.h>
+
+namespace WebCore {
+
+static const unsigned formatVersion = 1;
+static constexpr auto indexFileName = "index"_s;
+static constexpr auto metaFileExtension = ".meta"_s;
+static constexpr auto bodyFileExtension = ".body"_s;
+static constexpr auto temporaryFileExtension = ".tmp"_s;
+static constexpr Seconds saveIndexDelay = 1_s;
+
+// A single response may take at most this part of the cache capacity.
+static const uint64_t maxEntrySizeDivisor = 8;
+
+static HashMap<String, HTTPDiskCacheJava*>& openCaches()
+{
+    static NeverDestroyed<HashMap<String, HTTPDiskCacheJava*>> caches;
+    return caches;
+}
+
+Ref<HTTPDiskCacheJava> HTTPDiskCacheJava::open(const String& directory, uint64_t capacity)
+{
+    ASSERT(isMainThread());
+    RefPtr<HTTPDiskCacheJava> cache;
+    if (!directory.isEmpty())
+        cache = openCaches().get(directory);
+    if (!cache) {
+        cache = adoptRef(*new HTTPDiskCacheJava(directory, capacity));
+        if (cache->isEnabled())
+            openCaches().set(directory, cache.get());
+    }
+    cache->m_openCount++;
+    return cache.releaseNonNull();
+}
+
+HTTPDiskCacheJava::HTTPDiskCacheJava(const String& directory, uint64_t capacity)
+    : m_directory(directory.isEmpty() || !capacity ? String() : directory)
+    , m_capacity(capacity)
+    , m_ioQueue(WorkQueue::create("com.sun.webkit.HTTPDiskCache"))
+    , m_saveIndexTimer(*this, &HTTPDiskCacheJava::saveIndex)
+{
+    ASSERT(isMainThread());
+    if (!isEnabled())
+        return;
+
+    loadIndex();
+    shrinkIfNeeded();
+}
+
+void HTTPDiskCacheJava::close()
+{
+    ASSERT(isMainThread());
+    ASSERT(m_openCount);
+    if (--m_openCount || !isEnabled())
+        return;
+
+    openCaches().remove(m_directory);
+    if (m_saveIndexTimer.isActive()) {
+        m_saveIndexTimer.stop();
+        saveIndex();
+    }
+    m_index.clear();
+    m_pendingStores.clear();
+    m_totalSize = 0;
+    m_directory = String();
+    m_ioQueue->dispatchSync([] { });
+}
+
+String HTTPDiskCacheJava::computeKey(const ResourceRequest& request)
+{
+    SHA1 sha1;
+    sha1.addBytes(request.url().viewWithoutFragmentIdentifier().utf8());
+    SHA1::Digest digest;
+    sha1.computeHash(digest);
+    return String::fromLatin1(SHA1::hexDigest(digest).data());
+}
+
+String HTTPDiskCacheJava::metaPath(const String& key) const
+{
+    return FileSystem::pathByAppendingComponent(m_directory, makeString(key, metaFileExtension));
+}
+
+String HTTPDiskCacheJava::bodyPath(const String& key) const
+{
+    return FileSystem::pathByAppendingComponent(m_directory, makeString(key, bodyFileExtension));
+}
+
+// Writes to a temporary file first so that a crash never leaves a partially
+// written file under the final name.
+static bool writeFileAtomically(const String& path, const Function<bool(FileSystem::PlatformFileHandle)>& write)
+{
+    String temporaryPath = makeString(path, temporaryFileExtension);
+    auto handle = FileSystem::openFile(temporaryPath, FileSystem::FileOpenMode::Truncate);
+    if (!FileSystem::isHandleValid(handle))
+        return false;
+    bool written = write(handle);
+    FileSystem::closeFile(handle);
+    if (written && FileSystem::moveFile(temporaryPath, path))
+        return true;
+    FileSystem::deleteFile(temporaryPath);
+    return false;
+}
+
+static bool writeData(FileSystem::PlatformFileHandle handle, const uint8_t* data, size_t size)
+{
+    return FileSystem::writeToFile(handle, data, size) == static_cast<int>(size);
+}
+
+static bool isSafeMethod(const String& method)
+{
+    return method == "GET"_s || method == "HEAD"_s || method == "OPTIONS"_s;
+}
+
+static bool canCacheRequest(const ResourceRequest& request)
+{
+    if (!request.url().protocolIsInHTTPFamily() || request.httpMethod() != "GET"_s)
+        return false;
+    // Responses to authenticated and partial requests are left to the network.
+    if (request.hasHTTPHeaderField(HTTPHeaderName::Authorization) || request.hasHTTPHeaderField(HTTPHeaderName::Range))
+        return false;
+    return request.cachePolicy() != ResourceRequestCachePolicy::DoNotUseAnyCache;
+}
+
+static CString serializeResponse(const ResourceResponse& response, WallTime responseTime, uint64_t bodySize)
+{
+    StringBuilder builder;
+    builder.append(formatVersion, '\n');
+    builder.append(response.url().string(), '\n');
+    builder.append(response.httpStatusCode(), '\n');
+    builder.append(response.httpStatusText(), '\n');
+    builder.append(response.mimeType(), '\n');
+    builder.append(response.textEncodingName(), '\n');
+    builder.append(static_cast<uint64_t>(responseTime.secondsSinceEpoch().milliseconds()), '\n');
+    builder.append(bodySize, '\n');
+    for (const auto& header : response.httpHeaderFields()) {
+        // Cookies have been handed to the cookie store already.
+        if (header.keyAsHTTPHeaderName == HTTPHeaderName::SetCookie || header.keyAsHTTPHeaderName == HTTPHeaderName::SetCookie2)
+            continue;
+        builder.append(header.key, ':', header.value, '\n');
+    }
+    return builder.toString().utf8();
+}
+
+static std::optional<std::pair<ResourceResponse, WallTime>> deserializeResponse(const Vector<uint8_t>& data, uint64_t& bodySize)
+{
+    String string = String::fromUTF8(data.data(), data.size());
+    Vector<String> lines = string.splitAllowingEmptyEntries('\n');
+    if (lines.size() < 8 || parseInteger<unsigned>(lines[0]) != formatVersion)
+        return std::nullopt;
+
+    auto statusCode = parseInteger<int>(lines[2]);
+    auto responseTime = parseInteger<uint64_t>(lines[6]);
+    auto size = parseInteger<uint64_t>(lines[7]);
+    if (!statusCode || !responseTime || !size)
+        return std::nullopt;
+
+    ResourceResponse response(URL { lines[1] }, lines[4], *size, lines[5]);
+    response.setHTTPStatusCode(*statusCode);
+    response.setHTTPStatusText(AtomString { lines[3] });
+    for (size_t i = 8; i < lines.size(); ++i) {
+        size_t colonPosition = lines[i].find(':');
+        if (colonPosition != notFound)
+            response.setHTTPHeaderField(lines[i].left(colonPosition), lines[i].substring(colonPosition + 1));
+    }
+    response.setSource(ResourceResponse::Source::DiskCache);
+
+    bodySize = *size;
+    return std::make_pair(WTFMove(response), WallTime::fromRawSeconds(Seconds::fromMilliseconds(*responseTime).seconds()));
+}
+
+std::unique_ptr<HTTPDiskCacheJava::Entry> HTTPDiskCacheJava::retrieve(const ResourceRequest& request)
+{
+    ASSERT(isMainThread());
+    if (!isEnabled() || !request.url().protocolIsInHTTPFamily())
+        return nullptr;
+
+    String key = computeKey(request);
+    auto it = m_index.find(key);
+    if (it == m_index.end())
+        return nullptr;
+
+    // The files of the entry are still being written.
+    if (m_pendingStores.contains(key))
+        return nullptr;
+
+    // A successful unsafe request invalidates the stored response (RFC 7234,
+    // section 4.4). The outcome is not known yet, so drop it right away.
+    if (!isSafeMethod(request.httpMethod())) {
+        remove(key);
+        return nullptr;
+    }
+    if (!canCacheRequest(request) || request.cachePolicy() == ResourceRequestCachePolicy::ReloadIgnoringCacheData)
+        return nullptr;
+
+    auto meta = FileSystem::readEntireFile(metaPath(key));
+    uint64_t bodySize = 0;
+    auto response = meta ? deserializeResponse(*meta, bodySize) : std::nullopt;
+    if (!response) {
+        remove(key);
+        return nullptr;
+    }
+
+    RefPtr<SharedBuffer> body;
+    if (bodySize) {
+        bool success;
+        FileSystem::MappedFileData mappedBody(bodyPath(key), FileSystem::MappedFileMode::Private, success);
+        if (!success || mappedBody.size() != bodySize) {
+            remove(key);
+            return nullptr;
+        }
+        body = SharedBuffer::create(WTFMove(mappedBody));
+    } else
+        body = SharedBuffer::create();
+
+    it->value.lastAccessTime = WallTime::now();
+    scheduleIndexSave();
+
+    return std::unique_ptr<Entry>(new Entry { WTFMove(key), WTFMove(response->first), response->second, body.releaseNonNull() });
+}
+
+bool HTTPDiskCacheJava::canUseWithoutRevalidation(const Entry& entry, const ResourceRequest& request) const
+{
+    switch (request.cachePolicy()) {
+    case ResourceRequestCachePolicy::ReturnCacheDataElseLoad:
+    case ResourceRequestCachePolicy::ReturnCacheDataDontLoad:
+        return true;
+    case ResourceRequestCachePolicy::RefreshAnyCacheData:
+    case ResourceRequestCachePolicy::ReloadIgnoringCacheData:
+    case ResourceRequestCachePolicy::DoNotUseAnyCache:
+        return false;
+    case ResourceRequestCachePolicy::UseProtocolCachePolicy:
+        break;
+    }
+
+    if (entry.response.cacheControlContainsNoCache())
+        return false;
+
+    auto requestDirectives = parseCacheControlDirectives(request.httpHeaderFields());
+    if (requestDirectives.noCache)
+        return false;
+
+    auto age = computeCurrentAge(entry.response, entry.responseTime);
+    auto lifetime = computeFreshnessLifetimeForHTTPFamily(entry.response, entry.responseTime);
+    if (requestDirectives.maxAge)
+        lifetime = std::min(lifetime, *requestDirectives.maxAge);
+    return age <= lifetime;
+}
+
+bool HTTPDiskCacheJava::addValidationHeaders(const Entry& entry, ResourceRequest& request)
+{
+    // Conditional requests made by the memory cache are left alone; the
+    // 304 response belongs to the memory cache then.
+    if (request.isConditional())
+        return false;
+
+    String eTag = entry.response.httpHeaderField(HTTPHeaderName::ETag);
+    String lastModified = entry.response.httpHeaderField(HTTPHeaderName::LastModified);
+    if (eTag.isEmpty() && lastModified.isEmpty())
+        return false;
+
+    if (!eTag.isEmpty())
+        request.setHTTPHeaderField(HTTPHeaderName::IfNoneMatch, eTag);
+    if (!lastModified.isEmpty())
+        request.setHTTPHeaderField(HTTPHeaderName::IfModifiedSince, lastModified);
+    return true;
+}
+
+void HTTPDiskCacheJava::didRevalidate(Entry& entry, const ResourceResponse& notModifiedResponse)
+{
+    ASSERT(isMainThread());
+    updateResponseHeadersAfterRevalidation(entry.response, notModifiedResponse);
+    entry.response.setSource(ResourceResponse::Source::DiskCacheAfterValidation);
+    entry.responseTime = WallTime::now();
+    if (!isEnabled() || !m_index.contains(entry.key))
+        return;
+
+    // Only the response changes, the mapped body stays where it is.
+    auto meta = serializeResponse(entry.response, entry.responseTime, entry.body->size());
+    auto& record = m_index.find(entry.key)->value;
+    m_totalSize = m_totalSize - record.size + meta.length() + entry.body->size();
+    record.size = meta.length() + entry.body->size();
+    record.lastAccessTime = entry.responseTime;
+    scheduleIndexSave();
+
+    m_ioQueue->dispatch([path = metaPath(entry.key).isolatedCopy(), meta = WTFMove(meta)] {
+        writeFileAtomically(path, [&](FileSystem::PlatformFileHandle handle) {
+            return writeData(handle, reinterpret_cast<const uint8_t*>(meta.data()), meta.length());
+        });
+    });
+}
+
+
+HTTPDiskCacheJava::Writer::Writer(const String& key, const ResourceResponse& response, uint64_t maxSize)
+    : m_key(key)
+    , m_response(response)
+    , m_responseTime(WallTime::now())
+    , m_maxSize(maxSize)
+{
+}
+
+void HTTPDiskCacheJava::Writer::append(const SharedBuffer& data)
+{
+    if (m_exceededMaxSize)
+        return;
+    if (m_body.size() + data.size() > m_maxSize) {
+        m_exceededMaxSize = true;
+        m_body.reset();
+        return;
+    }
+    m_body.append(data);
+}
+
+std::unique_ptr<HTTPDiskCacheJava::Writer> HTTPDiskCacheJava::makeWriter(const ResourceRequest& request, const ResourceResponse& response)
+{
+    ASSERT(isMainThread());
+    if (!isEnabled() || !canCacheRequest(request))
+        return nullptr;
+
+    if (response.httpStatusCode() != 200 || response.cacheControlContainsNoStore())
+        return nullptr;
+
+    // The stored response is reused for any request headers, so responses
+    // that vary on anything other than the encoding are not stored.
+    String vary = response.httpHeaderField(HTTPHeaderName::Vary);
+    if (!vary.isEmpty() && !equalLettersIgnoringASCIICase(vary.trim(isASCIIWhitespace<UChar>), "accept-encoding"_s))
+        return nullptr;
+
+    // Without validators a response that is stale on arrival is of no use.
+    if (!response.hasCacheValidatorFields() && computeFreshnessLifetimeForHTTPFamily(response, WallTime::now()) <= 0_s)
+        return nullptr;
+
+    uint64_t maxSize = m_capacity / maxEntrySizeDivisor;
+    if (response.expectedContentLength() > 0 && static_cast<uint64_t>(response.expectedContentLength()) > maxSize)
+        return nullptr;
+
+    return std::unique_ptr<Writer>(new Writer(computeKey(request), response, maxSize));
+}
+
+void HTTPDiskCacheJava::store(std::unique_ptr<Writer> writer)
+{
+    ASSERT(isMainThread());
+    if (!isEnabled() || !writer || writer->m_exceededMaxSize)
+        return;
+
+    Ref<FragmentedSharedBuffer> body = writer->m_body.take();
+    auto meta = serializeResponse(writer->m_response, writer->m_responseTime, body->size());
+    uint64_t size = meta.length() + body->size();
+
+    auto it = m_index.find(writer->m_key);
+    if (it != m_index.end())
+        m_totalSize -= it->value.size;
+    m_index.set(writer->m_key, IndexRecord { size, WallTime::now() });
+    m_totalSize += size;
+    m_pendingStores.add(writer->m_key, 0).iterator->value++;
+
+    // The body file is written first; an entry is only complete once its
+    // meta file is in place, which is what loadIndex() checks for.
+    m_ioQueue->dispatch([weakThis = WeakPtr { *this }, key = writer->m_key.isolatedCopy(), metaPath = metaPath(writer->m_key).isolatedCopy(), bodyPath = bodyPath(writer->m_key).isolatedCopy(), meta = WTFMove(meta), body = WTFMove(body)]() mutable {
+        FileSystem::deleteFile(metaPath);
+        bool written = writeFileAtomically(bodyPath, [&](FileSystem::PlatformFileHandle handle) {
+            bool success = true;
+            body->forEachSegment([&](std::span<const uint8_t> segment) {
+                success = success && writeData(handle, segment.data(), segment.size());
+            });
+            return success;
+        });
+        written = written && writeFileAtomically(metaPath, [&](FileSystem::PlatformFileHandle handle) {
+            return writeData(handle, reinterpret_cast<const uint8_t*>(meta.data()), meta.length());
+        });
+        if (!written)
+            FileSystem::deleteFile(bodyPath);
+
+        callOnMainThread([weakThis = WTFMove(weakThis), key = WTFMove(key)] {
+            if (weakThis)
+                weakThis->didStore(key);
+        });
+    });
+
+    shrinkIfNeeded();
+    scheduleIndexSave();
+}
+
+void HTTPDiskCacheJava::didStore(const String& key)
+{
+    ASSERT(isMainThread());
+    auto it = m_pendingStores.find(key);
+    if (it != m_pendingStores.end() && !--it->value)
+        m_pendingStores.remove(it);
+}
+
+void HTTPDiskCacheJava::remove(const String& key)
+{
+    auto it = m_index.find(key);
+    if (it == m_index.end())
+        return;
+    m_totalSize -= it->value.size;
+    m_index.remove(it);
+    scheduleIndexSave();
+
+    m_ioQueue->dispatch([metaPath = metaPath(key).isolatedCopy(), bodyPath = bodyPath(key).isolatedCopy()] {
+        FileSystem::deleteFile(metaPath);
+        FileSystem::deleteFile(bodyPath);
+    });
+}
+
+void HTTPDiskCacheJava::shrinkIfNeeded()
+{
+    if (m_totalSize <= m_capacity)
+        return;
+
+    // Evict least recently used entries until the cache is back to 7/8 of
+    // its capacity, so that a full cache does not evict on every store.
+    Vector<std::pair<WallTime, String>> entries;
+    entries.reserveInitialCapacity(m_index.size());
+    for (auto& [key, record] : m_index)
+        entries.append({ record.lastAccessTime, key });
+    std::sort(entries.begin(), entries.end(), [](auto& a, auto& b) {
+        return a.first < b.first;
+    });
+
+    uint64_t targetSize = m_capacity - m_capacity / 8;
+    for (auto& entry : entries) {
+        if (m_totalSize <= targetSize)
+            break;
+        remove(entry.second);
+    }
+}
+
+// The index is a text file with one "key size lastAccessTime" line per entry.
+void HTTPDiskCacheJava::loadIndex()
+{
+    Vector<String> names = FileSystem::listDirectory(m_directory);
+    HashSet<String> completeEntries;
+    for (auto& name : names) {
+        if (name.endsWith(metaFileExtension))
+            completeEntries.add(name.left(name.length() - metaFileExtension.length()));
+    }
+
+    if (auto data = FileSystem::readEntireFile(FileSystem::pathByAppendingComponent(m_directory, indexFileName))) {
+        String index = String::fromUTF8(data->data(), data->size());
+        for (auto& line : index.split('\n')) {
+            auto fields = line.split(' ');
+            if (fields.size() != 3 || !completeEntries.contains(fields[0]))
+                continue;
+            auto size = parseInteger<uint64_t>(fields[1]);
+            auto lastAccessTime = parseInteger<uint64_t>(fields[2]);
+            if (!size || !lastAccessTime)
+                continue;
+            auto addResult = m_index.add(fields[0], IndexRecord { *size, WallTime::fromRawSeconds(Seconds::fromMilliseconds(*lastAccessTime).seconds()) });
+            if (addResult.isNewEntry)
+                m_totalSize += *size;
+        }
+    }
+
+    // Files of entries missing from the index were written after it was last
+    // saved, or not written completely. Either way they are dropped.
+    Vector<String> strayFiles;
+    for (auto& name : names) {
+        if (name == indexFileName)
+            continue;
+        String key;
+        if (name.endsWith(metaFileExtension))
+            key = name.left(name.length() - metaFileExtension.length());
+        else if (name.endsWith(bodyFileExtension))
+            key = name.left(name.length() - bodyFileExtension.length());
+        if (key.isNull() || !m_index.contains(key))
+            strayFiles.append(FileSystem::pathByAppendingComponent(m_directory, name));
+    }
+    if (strayFiles.isEmpty())
+        return;
+
+    m_ioQueue->dispatch([strayFiles = crossThreadCopy(WTFMove(strayFiles))] {
+        for (auto& path : strayFiles)
+            FileSystem::deleteFile(path);
+    });
+}
+
+void HTTPDiskCacheJava::scheduleIndexSave()
+{
+    if (!m_saveIndexTimer.isActive())
+        m_saveIndexTimer.startOneShot(saveIndexDelay);
+}
+
+void HTTPDiskCacheJava::saveIndex()
+{
+    if (!isEnabled())
+        return;
+
+    StringBuilder builder;
+    for (auto& [key, record] : m_index)
+        builder.append(key, ' ', record.size, ' ', static_cast<uint64_t>(record.lastAccessTime.secondsSinceEpoch().milliseconds()), '\n');
+
+    m_ioQueue->dispatch([path = FileSystem::pathByAppendingComponent(m_directory, indexFileName).isolatedCopy(), index = builder.toString().utf8()] {
+        writeFileAtomically(path, [&](FileSystem::PlatformFileHandle handle) {
+            return writeData(handle, reinterpret_cast<const uint8_t*>(index.data()), index.length());
+        });
+    });
+}
+
+
+} // namespace WebCore
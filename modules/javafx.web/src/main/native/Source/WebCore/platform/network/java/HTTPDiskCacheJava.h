@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "ResourceResponse.h"
+#include "SharedBuffer.h"
+#include "Timer.h"
+#include <wtf/HashMap.h>
+#include <wtf/RefCounted.h>
+#include <wtf/WallTime.h>
+#include <wtf/WeakPtr.h>
+#include <wtf/WorkQueue.h>
+#include <wtf/text/StringHash.h>
+
+namespace WebCore {
+
+class ResourceRequest;
+
+// Persistent HTTP cache for resource loads, consulted by ResourceHandle
+// before a request is handed to the java loader. Every entry is a pair of
+// files named after the SHA-1 of the request URL: a text file with the
+// response and the raw body, which is mapped when the entry is served. An
+// index of entry sizes and access times drives LRU eviction once the total
+// size goes over the capacity. There is one cache per user data directory,
+// shared by the pages that use the directory; loads find it through their
+// NetworkingContext. The cache is only used on the main thread; files are
+// written on a background queue.
+class HTTPDiskCacheJava : public RefCounted<HTTPDiskCacheJava>, public CanMakeWeakPtr<HTTPDiskCacheJava> {
+    WTF_MAKE_FAST_ALLOCATED;
+    WTF_MAKE_NONCOPYABLE(HTTPDiskCacheJava);
+public:
+    // Returns the cache in the directory, loading it if no page has it open.
+    // Every call must be balanced by a call to close().
+    WEBCORE_EXPORT static Ref<HTTPDiskCacheJava> open(const String& directory, uint64_t capacity);
+    // Once the last page has closed the cache, saves the index and waits for
+    // the pending writes. The cache does not touch the directory afterwards,
+    // even if loads still hold on to it.
+    WEBCORE_EXPORT void close();
+    bool isEnabled() const { return !m_directory.isNull(); }
+
+    struct Entry {
+        WTF_MAKE_FAST_ALLOCATED;
+    public:
+        String key;
+        ResourceResponse response;
+        WallTime responseTime;
+        Ref<SharedBuffer> body;
+    };
+
+    class Writer {
+        WTF_MAKE_FAST_ALLOCATED;
+    public:
+        void append(const SharedBuffer&);
+
+    private:
+        friend class HTTPDiskCacheJava;
+        Writer(const String& key, const ResourceResponse&, uint64_t maxSize);
+
+        String m_key;
+        ResourceResponse m_response;
+        WallTime m_responseTime;
+        SharedBufferBuilder m_body;
+        uint64_t m_maxSize;
+        bool m_exceededMaxSize { false };
+    };
+
+    // Returns the stored response for the request, if there is one the
+    // request is allowed to use.
+    std::unique_ptr<Entry> retrieve(const ResourceRequest&);
+    // Whether the entry can be served without asking the server first.
+    bool canUseWithoutRevalidation(const Entry&, const ResourceRequest&) const;
+    // Makes the request conditional on the entry. Returns false if the
+    // entry has no validators or the request is conditional already.
+    static bool addValidationHeaders(const Entry&, ResourceRequest&);
+    void didRevalidate(Entry&, const ResourceResponse& notModifiedResponse);
+
+    // Returns a writer if the response to the request may be stored.
+    std::unique_ptr<Writer> makeWriter(const ResourceRequest&, const ResourceResponse&);
+    void store(std::unique_ptr<Writer>);
+
+private:
+    HTTPDiskCacheJava(const String& directory, uint64_t capacity);
+
+    struct IndexRecord {
+        uint64_t size;
+        WallTime lastAccessTime;
+    };
+
+    static String computeKey(const ResourceRequest&);
+    String metaPath(const String& key) const;
+    String bodyPath(const String& key) const;
+
+    void loadIndex();
+    void scheduleIndexSave();
+    void saveIndex();
+    void remove(const String& key);
+    void shrinkIfNeeded();
+    void didStore(const String& key);
+
+    String m_directory;
+    unsigned m_openCount { 0 };
+    uint64_t m_capacity { 0 };
+    uint64_t m_totalSize { 0 };
+    HashMap<String, IndexRecord> m_index;
+    // Number of stores of each key whose files are still being written
+    HashMap<String, unsigned> m_pendingStores;
+    Ref<WorkQueue> m_ioQueue;
+    Timer m_saveIndexTimer;
+};
+
+} // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,10 +33,15 @@
 #include "NotImplemented.h"
 #include "ResourceHandle.h"
 
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
 #include <wtf/MainThread.h>
 #include <wtf/NeverDestroyed.h>
 #include <wtf/URL.h>
+#include <wtf/WallTime.h>
+#include <wtf/text/StringHash.h>
 #include "PlatformJavaClasses.h"
+#include "com_sun_webkit_network_CookieJar.h"
 
 namespace WebCore {
 
@@ -45,6 +50,7 @@ namespace CookieInternalJava {
 static JGClass cookieJarClass;
 static jmethodID getMethod;
 static jmethodID putMethod;
+static jmethodID getHandlerMethod;
 
 static void initRefs(JNIEnv* env)
 {
@@ -64,15 +70,59 @@ static void initRefs(JNIEnv* env)
                 "fwkPut",
                 "(Ljava/lang/String;Ljava/lang/String;)V");
         ASSERT(putMethod);
+
+        getHandlerMethod = env->GetStaticMethodID(
+                cookieJarClass,
+                "fwkGetHandler",
+                "()Ljava/net/CookieHandler;");
+        ASSERT(getHandlerMethod);
     }
 }
 
+// Cookie strings returned by the Java cookie jar, keyed by the URL without
+// query and fragment. The cache is cleared whenever the cookie store changes,
+// is not used past the earliest expiry time of the stored cookies, and is
+// only used while the default cookie handler is the one it was filled from.
+static constexpr unsigned maxCachedCookieStrings = 256;
+static Lock cacheLock;
+static uint64_t cacheGeneration WTF_GUARDED_BY_LOCK(cacheLock);
+static int64_t cacheNextExpiryTime WTF_GUARDED_BY_LOCK(cacheLock);
+static jweak cacheHandler WTF_GUARDED_BY_LOCK(cacheLock);
+
+static HashMap<String, String>& cachedCookieStrings() WTF_REQUIRES_LOCK(cacheLock)
+{
+    static NeverDestroyed<HashMap<String, String>> cache;
+    return cache;
+}
+
+static bool isCacheValid(JNIEnv* env, jobject handler) WTF_REQUIRES_LOCK(cacheLock)
+{
+    return handler && cacheHandler && env->IsSameObject(cacheHandler, handler)
+        && WallTime::now().secondsSinceEpoch().millisecondsAs<int64_t>() <= cacheNextExpiryTime;
+}
+
 static String getCookies(const URL& url, bool includeHttpOnlyCookies)
 {
     using namespace CookieInternalJava;
+
     JNIEnv* env = WTF::GetJavaEnv();
     initRefs(env);
 
+    JLObject handler(env->CallStaticObjectMethod(cookieJarClass, getHandlerMethod));
+    WTF::CheckAndClearException(env);
+
+    String key = makeString(includeHttpOnlyCookies ? '1' : '0', url.viewWithoutQueryOrFragmentIdentifier());
+    uint64_t generation;
+    {
+        Locker locker { cacheLock };
+        if (isCacheValid(env, handler)) {
+            auto it = cachedCookieStrings().find(key);
+            if (it != cachedCookieStrings().end())
+                return it->value;
+        }
+        generation = cacheGeneration;
+    }
+
     JLString result = static_cast<jstring>(env->CallStaticObjectMethod(
             cookieJarClass,
             getMethod,
@@ -80,7 +130,16 @@ static String getCookies(const URL& url, bool includeHttpOnlyCookies)
             bool_to_jbool(includeHttpOnlyCookies)));
     WTF::CheckAndClearException(env);
 
-    return result ? String(env, result) : emptyString();
+    String cookies = result ? String(env, result) : emptyString();
+    {
+        Locker locker { cacheLock };
+        if (generation == cacheGeneration && isCacheValid(env, handler)) {
+            if (cachedCookieStrings().size() >= maxCachedCookieStrings)
+                cachedCookieStrings().clear();
+            cachedCookieStrings().set(WTFMove(key), cookies);
+        }
+    }
+    return cookies;
 }
 }
 
@@ -181,3 +240,21 @@ Vector<Cookie> NetworkStorageSession::getCookies(const URL&)
 
 } // namespace WebCore
 
+using namespace WebCore;
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_CookieJar_twkCookiesChanged
+    (JNIEnv* env, jclass, jobject handler, jlong nextExpiryTime)
+{
+    using namespace CookieInternalJava;
+    Locker locker { cacheLock };
+    cacheGeneration++;
+    if (cacheHandler)
+        env->DeleteWeakGlobalRef(cacheHandler);
+    cacheHandler = handler ? env->NewWeakGlobalRef(handler) : nullptr;
+    cacheNextExpiryTime = nextExpiryTime;
+    cachedCookieStrings().clear();
+}
+
+} // extern "C"
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 #include "config.h"
 
 #include <wtf/CompletionHandler.h>
+#include "HTTPDiskCacheJava.h"
 #include "NotImplemented.h"
 #include "ResourceHandle.h"
 #include "ResourceHandleInternal.h"
@@ -41,10 +42,22 @@ ResourceHandle::~ResourceHandle()
 {
 }
 
+static std::unique_ptr<URLLoader> startLoader(NetworkingContext* context, ResourceHandle* handle, const ResourceRequest& request)
+{
+    // Every page has a disk cache of its own, in its user data directory.
+    auto* diskCache = context ? context->diskCache() : nullptr;
+    if (!diskCache)
+        return URLLoader::loadAsynchronously(context, handle, request);
+    auto cachedEntry = diskCache->retrieve(request);
+    if (cachedEntry && diskCache->canUseWithoutRevalidation(*cachedEntry, request))
+        return URLLoader::loadFromDiskCache(diskCache, handle, request, WTFMove(cachedEntry));
+    return URLLoader::loadAsynchronously(context, handle, request, diskCache, WTFMove(cachedEntry));
+}
+
 bool ResourceHandle::start()
 {
     ASSERT(!d->m_loader);
-    d->m_loader = URLLoader::loadAsynchronously(context(), this, this->firstRequest());
+    d->m_loader = startLoader(context(), this, this->firstRequest());
     return d->m_loader != nullptr;
 }
 
@@ -148,7 +161,7 @@ void ResourceHandle::continueAfterWillSendRequest(ResourceRequest&& request)
     if (request.isNull()) {
         return;
     }
-    d->m_loader = URLLoader::loadAsynchronously(context(), this, request);
+    d->m_loader = startLoader(context(), this, request);
 }
 
 //utatodo: merge artifact
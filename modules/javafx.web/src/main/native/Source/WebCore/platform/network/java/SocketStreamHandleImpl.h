@@ -1,7 +1,7 @@
 /*
  * Copyright (C) 2009 Apple Inc. All rights reserved.
  * Copyright (C) 2009, 2011 Google Inc.  All rights reserved.
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are
@@ -69,8 +69,15 @@ protected:
 private:
     SocketStreamHandleImpl(const URL&, Page*, SocketStreamHandleClient&, const StorageSessionProvider*);
 
+    void flushPendingSends();
+
     RefPtr<const StorageSessionProvider> m_storageSessionProvider;
     JGObject m_ref;
+    // Data written during the current run loop iteration, handed to Java
+    // in a single call by flushPendingSends().
+    Vector<uint8_t> m_pendingSends;
+    bool m_flushScheduled { false };
+    static const size_t maxPendingSendSize = 64 * 1024;
     StreamBuffer<uint8_t, 1024 * 1024> m_buffer;
     static const unsigned maxBufferSize = 100 * 1024 * 1024;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@
 #include "SocketStreamError.h"
 #include "SocketStreamHandleClient.h"
 #include "com_sun_webkit_network_SocketStreamHandle.h"
+#include <wtf/MainThread.h>
 #include <wtf/java/JavaEnv.h>
 
 namespace WebCore {
@@ -87,30 +88,49 @@ SocketStreamHandleImpl::~SocketStreamHandleImpl()
 
 std::optional<size_t> SocketStreamHandleImpl::platformSendInternal(const uint8_t* data, size_t len)
 {
-    JNIEnv* env = WTF::GetJavaEnv();
+    // Frames written in a burst are coalesced and sent with one Java call.
+    m_pendingSends.append(data, len);
+    if (m_pendingSends.size() >= maxPendingSendSize) {
+        flushPendingSends();
+        return { len };
+    }
 
-    JLByteArray byteArray = env->NewByteArray(len);
-    env->SetByteArrayRegion(
-            (jbyteArray) byteArray,
-            (jsize) 0,
-            (jsize) len,
-            (const jbyte*) data);
+    if (!m_flushScheduled) {
+        m_flushScheduled = true;
+        callOnMainThread([protectedThis = Ref { *this }] {
+            protectedThis->m_flushScheduled = false;
+            protectedThis->flushPendingSends();
+        });
+    }
+    return { len };
+}
+
+void SocketStreamHandleImpl::flushPendingSends()
+{
+    if (m_pendingSends.isEmpty())
+        return;
+
+    JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(
             GetSocketStreamHandleClass(env),
             "fwkSend",
-            "([B)I");
+            "(Ljava/nio/ByteBuffer;)I");
     ASSERT(mid);
 
-    jint res = env->CallIntMethod(m_ref, mid, (jbyteArray) byteArray);
-    if (WTF::CheckAndClearException(env)) {
-        return { };
-    }
-    return { static_cast<size_t>(res) };
+    // The Java side copies the data out before returning.
+    JLObject buffer(env->NewDirectByteBuffer(m_pendingSends.data(), m_pendingSends.size()));
+    env->CallIntMethod(m_ref, mid, (jobject) buffer);
+    WTF::CheckAndClearException(env);
+
+    // Keep the capacity for the next batch.
+    m_pendingSends.shrink(0);
 }
 
 void SocketStreamHandleImpl::platformClose()
 {
+    flushPendingSends();
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(
@@ -170,15 +190,16 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_SocketStreamHandle_twkDidOpen
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_SocketStreamHandle_twkDidReceiveData
-  (JNIEnv* env, jclass, jbyteArray buffer, jint len, jlong data)
+  (JNIEnv* env, jclass, jobject buffer, jint len, jlong data)
 {
     using namespace WebCore;
     SocketStreamHandleImpl* handle =
             static_cast<SocketStreamHandleImpl*>(jlong_to_ptr(data));
     ASSERT(handle);
-    jbyte* p = env->GetByteArrayElements(buffer, NULL);
-    handle->didReceiveData((const uint8_t*) p, len);
-    env->ReleaseByteArrayElements(buffer, p, JNI_ABORT);
+    // The direct buffer is returned to the Java pool after this call.
+    const uint8_t* p = static_cast<const uint8_t*>(env->GetDirectBufferAddress(buffer));
+    ASSERT(p);
+    handle->didReceiveData(p, len);
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_SocketStreamHandle_twkDidFail
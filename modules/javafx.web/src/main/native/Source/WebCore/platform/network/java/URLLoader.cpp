@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,6 +47,9 @@
 #include "com_sun_webkit_LoadListenerClient.h"
 #include "com_sun_webkit_network_URLLoaderBase.h"
 #include <wtf/CompletionHandler.h>
+#include <wtf/MainThread.h>
+#include <wtf/ThreadSafeRefCounted.h>
+#include <atomic>
 
 namespace WebCore {
 class Page;
@@ -56,6 +59,42 @@ namespace WebCore {
 
 namespace URLLoaderJavaInternal {
 
+/*
+ * Data received from java lives in a direct ByteBuffer that the java loader
+ * recycles once twkDidReceiveData returns. The data is lent to WebCore
+ * through a DataSegment::Provider and detached (copied into a Vector owned
+ * by this object) only if somebody holds on to the segment after the
+ * client callback.
+ */
+class BorrowedJavaData : public ThreadSafeRefCounted<BorrowedJavaData> {
+public:
+    static Ref<BorrowedJavaData> create(const uint8_t* data, size_t size)
+    {
+        return adoptRef(*new BorrowedJavaData(data, size));
+    }
+
+    const uint8_t* data() const { return m_data.load(std::memory_order_acquire); }
+    size_t size() const { return m_size; }
+
+    void detach()
+    {
+        ASSERT(m_ownedData.isEmpty());
+        m_ownedData.append(data(), m_size);
+        m_data.store(m_ownedData.data(), std::memory_order_release);
+    }
+
+private:
+    BorrowedJavaData(const uint8_t* data, size_t size)
+        : m_data(data)
+        , m_size(size)
+    {
+    }
+
+    std::atomic<const uint8_t*> m_data;
+    size_t m_size;
+    Vector<uint8_t> m_ownedData;
+};
+
 static JGClass networkContextClass;
 static jmethodID loadMethod;
 
@@ -78,7 +117,7 @@ static void initRefs(JNIEnv* env)
                 "fwkLoad",
                 "(Lcom/sun/webkit/WebPage;Z"
                 "Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;"
-                "[Lcom/sun/webkit/network/FormDataElement;J)"
+                "[Lcom/sun/webkit/network/FormDataElement;IJ)"
                 "Lcom/sun/webkit/network/URLLoaderBase;");
         ASSERT(loadMethod);
     }
@@ -123,18 +162,42 @@ URLLoader::~URLLoader()
 
 std::unique_ptr<URLLoader> URLLoader::loadAsynchronously(NetworkingContext* context,
                                                     ResourceHandle* handle,
-                                                    const ResourceRequest& request)
+                                                    const ResourceRequest& request,
+                                                    HTTPDiskCacheJava* diskCache,
+                                                    std::unique_ptr<HTTPDiskCacheJava::Entry>&& cachedEntry)
 {
+    // A stored response that can be revalidated is sent along with the
+    // request as the validators, and served if the server says it is
+    // still good.
+    ResourceRequest loadRequest = request;
+    if (cachedEntry && !HTTPDiskCacheJava::addValidationHeaders(*cachedEntry, loadRequest))
+        cachedEntry = nullptr;
+
     std::unique_ptr<URLLoader> result = std::unique_ptr<URLLoader>(new URLLoader());
-    result->m_target = std::unique_ptr<AsynchronousTarget>(new AsynchronousTarget(handle));
+    result->m_target = std::unique_ptr<AsynchronousTarget>(new AsynchronousTarget(diskCache, handle, request, WTFMove(cachedEntry)));
     result->m_ref = load(
             true,
             context,
-            request,
+            loadRequest,
             result->m_target.get());
     return result;
 }
 
+std::unique_ptr<URLLoader> URLLoader::loadFromDiskCache(HTTPDiskCacheJava* diskCache,
+                                                    ResourceHandle* handle,
+                                                    const ResourceRequest& request,
+                                                    std::unique_ptr<HTTPDiskCacheJava::Entry>&& cachedEntry)
+{
+    std::unique_ptr<URLLoader> result = std::unique_ptr<URLLoader>(new URLLoader());
+    result->m_target = std::unique_ptr<AsynchronousTarget>(new AsynchronousTarget(diskCache, handle, request, WTFMove(cachedEntry)));
+    // Callbacks are never made from within ResourceHandle::start().
+    callOnMainThread([target = WeakPtr { *result->m_target }] {
+        if (target)
+            target->didLoadFromDiskCache();
+    });
+    return result;
+}
+
 void URLLoader::cancel()
 {
     using namespace URLLoaderJavaInternal;
@@ -202,6 +265,7 @@ JLObject URLLoader::load(bool asynchronous,
             (jstring) request.httpMethod().toJavaString(env),
             (jstring) headerString.toJavaString(env),
             (jobjectArray) toJava(request.httpBody().get()),
+            static_cast<jint>(request.priority()),
             ptr_to_jlong(target));
     WTF::CheckAndClearException(env);
 
@@ -269,8 +333,14 @@ URLLoader::Target::~Target()
 {
 }
 
-URLLoader::AsynchronousTarget::AsynchronousTarget(ResourceHandle* handle)
-    : m_handle(handle)
+URLLoader::AsynchronousTarget::AsynchronousTarget(HTTPDiskCacheJava* diskCache,
+                                                  ResourceHandle* handle,
+                                                  const ResourceRequest& request,
+                                                  std::unique_ptr<HTTPDiskCacheJava::Entry>&& cachedEntry)
+    : m_diskCache(diskCache)
+    , m_handle(handle)
+    , m_request(request)
+    , m_cachedEntry(WTFMove(cachedEntry))
 {
 }
 
@@ -293,6 +363,19 @@ bool URLLoader::AsynchronousTarget::willSendRequest(const ResourceResponse& resp
 void URLLoader::AsynchronousTarget::didReceiveResponse(
         const ResourceResponse& response)
 {
+    if (m_cachedEntry) {
+        if (response.isNotModified()) {
+            // The client gets the stored response once the load finishes.
+            m_diskCache->didRevalidate(*m_cachedEntry, response);
+            m_notModified = true;
+            return;
+        }
+        m_cachedEntry = nullptr;
+    }
+    if (m_diskCache) {
+        m_cacheWriter = m_diskCache->makeWriter(m_request, response);
+    }
+
     ResourceHandleClient* client = m_handle->client();
     if (client) {
         client->didReceiveResponseAsync(m_handle, ResourceResponse(response), [] () {});
@@ -301,6 +384,12 @@ void URLLoader::AsynchronousTarget::didReceiveResponse(
 
 void URLLoader::AsynchronousTarget::didReceiveData(const SharedBuffer* data, int length)
 {
+    if (m_notModified) {
+        return;
+    }
+    if (m_cacheWriter) {
+        m_cacheWriter->append(*data);
+    }
     ResourceHandleClient* client = m_handle->client();
     if (client) {
         client->didReceiveData(m_handle, *data, length);
@@ -309,6 +398,13 @@ void URLLoader::AsynchronousTarget::didReceiveData(const SharedBuffer* data, int
 
 void URLLoader::AsynchronousTarget::didFinishLoading()
 {
+    if (m_notModified) {
+        didLoadFromDiskCache();
+        return;
+    }
+    if (m_cacheWriter) {
+        m_diskCache->store(WTFMove(m_cacheWriter));
+    }
     ResourceHandleClient* client = m_handle->client();
     if (client) {
         client->didFinishLoading(m_handle, {});
@@ -317,12 +413,39 @@ void URLLoader::AsynchronousTarget::didFinishLoading()
 
 void URLLoader::AsynchronousTarget::didFail(const ResourceError& error)
 {
+    m_cacheWriter = nullptr;
     ResourceHandleClient* client = m_handle->client();
     if (client) {
         client->didFail(m_handle, error);
     }
 }
 
+void URLLoader::AsynchronousTarget::didLoadFromDiskCache()
+{
+    ASSERT(m_cachedEntry);
+    // The client may cancel the load from any of the callbacks below, which
+    // destroys this target.
+    WeakPtr weakThis { *this };
+    Ref<ResourceHandle> handle(*m_handle);
+    auto entry = WTFMove(m_cachedEntry);
+
+    if (auto* client = handle->client()) {
+        client->didReceiveResponseAsync(handle.ptr(), ResourceResponse(entry->response), [] () {});
+    }
+    if (!weakThis) {
+        return;
+    }
+    if (auto* client = handle->client(); client && !entry->body->isEmpty()) {
+        client->didReceiveData(handle.ptr(), entry->body.get(), entry->body->size());
+    }
+    if (!weakThis) {
+        return;
+    }
+    if (auto* client = handle->client()) {
+        client->didFinishLoading(handle.ptr(), {});
+    }
+}
+
 URLLoader::SynchronousTarget::SynchronousTarget(const ResourceRequest& request,
                                                 ResourceError& error,
                                                 ResourceResponse& response,
@@ -420,18 +543,21 @@ static WebCore::ResourceResponse setupResponse(JNIEnv* env,
                 static_cast<long long>(contentLength));
     }
 
+    // The header block is a sequence of "name:value\n" lines. Walk it in a
+    // single pass; only the name and the value of each line are copied.
     String headersString(env, headers);
-    int splitPos = headersString.find("\n"_s);
-    while (splitPos != -1) {
-        String s = headersString.left(splitPos);
-        int j = s.find(":"_s);
-        if (j != -1) {
-            String key = s.left(j);
-            String val = s.substring(j + 1);
-            response.setHTTPHeaderField(key, val);
+    StringView headersView = headersString;
+    size_t lineStart = 0;
+    size_t lineEnd;
+    while ((lineEnd = headersView.find('\n', lineStart)) != notFound) {
+        StringView line = headersView.substring(lineStart, lineEnd - lineStart);
+        size_t colonPos = line.find(':');
+        if (colonPos != notFound) {
+            response.setHTTPHeaderField(
+                line.left(colonPos).toString(),
+                line.substring(colonPos + 1).toString());
         }
-        headersString = headersString.substring(splitPos + 1);
-        splitPos = headersString.find("\n"_s);
+        lineStart = lineEnd + 1;
     }
 
     URL kurl = URL(URL(), String(env, url));
@@ -508,9 +634,22 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveDa
     ASSERT(target);
     const uint8_t* address =
             static_cast<const uint8_t*>(env->GetDirectBufferAddress(byteBuffer));
-    Ref<FragmentedSharedBuffer> tmp_buf = FragmentedSharedBuffer::create(address,remaining);
-    target->didReceiveData(tmp_buf->makeContiguous().ptr() + position, remaining);
-    //target->didReceiveData((SharedBuffer*)(address) + position, remaining);
+    if (!address) {
+        return;
+    }
+
+    // Hand the java memory to the client without copying it. The buffer is
+    // reused by java as soon as we return, so the bytes are copied out only
+    // if the client kept a reference to the segment.
+    auto borrowed = URLLoaderJavaInternal::BorrowedJavaData::create(address + position, remaining);
+    Ref<DataSegment> segment = DataSegment::create(DataSegment::Provider {
+        [borrowed] { return borrowed->data(); },
+        [borrowed] { return borrowed->size(); }
+    });
+    target->didReceiveData(SharedBuffer::create(Ref<const DataSegment> { segment }).ptr(), remaining);
+    if (!segment->hasOneRef()) {
+        borrowed->detach();
+    }
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidFinishLoading
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,8 +25,11 @@
 
 #pragma once
 
+#include "HTTPDiskCacheJava.h"
+#include "ResourceRequest.h"
 #include <wtf/java/JavaRef.h>
 #include <wtf/Vector.h>
+#include <wtf/WeakPtr.h>
 #include <wtf/text/WTFString.h>
 
 namespace WebCore {
@@ -35,14 +38,18 @@ class FormData;
 class NetworkingContext;
 class ResourceError;
 class ResourceHandle;
-class ResourceRequest;
-class ResourceResponse;
 
 class URLLoader {
 public:
     static std::unique_ptr<URLLoader> loadAsynchronously(NetworkingContext* context,
                                                     ResourceHandle* handle,
-                                                    const ResourceRequest& request);
+                                                    const ResourceRequest& request,
+                                                    HTTPDiskCacheJava* diskCache = nullptr,
+                                                    std::unique_ptr<HTTPDiskCacheJava::Entry>&& cachedEntry = nullptr);
+    static std::unique_ptr<URLLoader> loadFromDiskCache(HTTPDiskCacheJava* diskCache,
+                                                    ResourceHandle* handle,
+                                                    const ResourceRequest& request,
+                                                    std::unique_ptr<HTTPDiskCacheJava::Entry>&& cachedEntry);
     void cancel();
     static void loadSynchronously(NetworkingContext* context,
                                   const ResourceRequest& request,
@@ -72,9 +79,12 @@ private:
                          Target* target);
     static JLObjectArray toJava(const FormData* formData);
 
-    class AsynchronousTarget : public Target {
+    class AsynchronousTarget : public Target, public CanMakeWeakPtr<AsynchronousTarget> {
     public:
-        AsynchronousTarget(ResourceHandle* handle);
+        AsynchronousTarget(HTTPDiskCacheJava* diskCache,
+                           ResourceHandle* handle,
+                           const ResourceRequest& request,
+                           std::unique_ptr<HTTPDiskCacheJava::Entry>&& cachedEntry);
 
         void didSendData(long totalBytesSent, long totalBytesToBeSent) final;
         bool willSendRequest(const ResourceResponse& response) final;
@@ -82,8 +92,17 @@ private:
         void didReceiveData(const SharedBuffer* data, int length) final;
         void didFinishLoading() final;
         void didFail(const ResourceError& error) final;
+
+        void didLoadFromDiskCache();
     private:
+        RefPtr<HTTPDiskCacheJava> m_diskCache;
         ResourceHandle* m_handle;
+        ResourceRequest m_request;
+        // The stored response being revalidated, served once the server
+        // answers 304 Not Modified.
+        std::unique_ptr<HTTPDiskCacheJava::Entry> m_cachedEntry;
+        std::unique_ptr<HTTPDiskCacheJava::Writer> m_cacheWriter;
+        bool m_notModified { false };
     };
 
     class SynchronousTarget : public Target {
@@ -39,8 +39,66 @@
 #include <wtf/glib/GRefPtr.h>
 #endif
 
+#if PLATFORM(JAVA)
+#include <wtf/Deque.h>
+#include <wtf/NeverDestroyed.h>
+#endif
+
 namespace WebCore {
 
+#if PLATFORM(JAVA)
+static Lock threadSlotsLock;
+static unsigned maximumThreadCount;
+static unsigned runningThreadCount;
+
+static Deque<Ref<WorkerOrWorkletThread>>& pendingThreads()
+{
+    static NeverDestroyed<Deque<Ref<WorkerOrWorkletThread>>> pendingThreads;
+    return pendingThreads;
+}
+
+void WorkerOrWorkletThread::setMaximumThreadCount(unsigned count)
+{
+    Vector<Ref<WorkerOrWorkletThread>> threadsToStart;
+    {
+        Locker locker { threadSlotsLock };
+        maximumThreadCount = count;
+        while (!pendingThreads().isEmpty() && (!maximumThreadCount || runningThreadCount < maximumThreadCount)) {
+            ++runningThreadCount;
+            threadsToStart.append(pendingThreads().takeFirst());
+        }
+    }
+    for (auto& thread : threadsToStart)
+        thread->startPendingThread();
+}
+
+// Called as a thread exits. Its slot passes to the oldest pending thread,
+// if any.
+void WorkerOrWorkletThread::releaseThreadSlot()
+{
+    RefPtr<WorkerOrWorkletThread> next;
+    {
+        Locker locker { threadSlotsLock };
+        if (!pendingThreads().isEmpty() && (!maximumThreadCount || runningThreadCount <= maximumThreadCount))
+            next = pendingThreads().takeFirst();
+        else
+            --runningThreadCount;
+    }
+    if (next)
+        next->startPendingThread();
+}
+
+void WorkerOrWorkletThread::startPendingThread()
+{
+    Locker locker { m_threadCreationAndGlobalScopeLock };
+    m_startPending = false;
+
+    auto thread = createThread();
+    WTF::storeStoreFence();
+    m_thread = WTFMove(thread);
+}
+#endif
+
 Lock WorkerOrWorkletThread::s_workerOrWorkletThreadsLock;
 
 Lock& WorkerOrWorkletThread::workerOrWorkletThreadsLock()
@@ -164,6 +222,10 @@ void WorkerOrWorkletThread::workerOrWorkletThread()
         // When running out of memory, createGlobalScope() may return null because we could not allocate a JSC::VM.
         if (!m_globalScope) {
             WTFLogAlways("Error: Failed to create a WorkerOrWorkerGlobalScope.");
+#if PLATFORM(JAVA)
+            locker.unlockEarly();
+            releaseThreadSlot();
+#endif
             return;
         }
 
@@ -213,6 +275,9 @@ void WorkerOrWorkletThread::destroyWorkerGlobalScope(Ref<WorkerOrWorkletThread>&
     ASSERT(m_childThreads.isEmpty());
 
     RefPtr<Thread> protector = m_thread;
+#if PLATFORM(JAVA)
+    bool ownsThreadSlot = !is<WorkerMainRunLoop>(m_runLoop.get());
+#endif
 
     ASSERT(m_globalScope->hasOneRef());
 
@@ -247,6 +312,11 @@ void WorkerOrWorkletThread::destroyWorkerGlobalScope(Ref<WorkerOrWorkletThread>&
 
     // The thread object may be already destroyed from notification now, don't try to access "this".
     protector->detach();
+
+#if PLATFORM(JAVA)
+    if (ownsThreadSlot)
+        releaseThreadSlot();
+#endif
 }
 
 void WorkerOrWorkletThread::start(Function<void(const String&)>&& evaluateCallback)
@@ -257,8 +327,26 @@ void WorkerOrWorkletThread::start(Function<void(const String&)>&& evaluateCallba
     if (m_thread)
         return;
 
+#if PLATFORM(JAVA)
+    if (m_startPending)
+        return;
+#endif
+
     m_evaluateCallback = WTFMove(evaluateCallback);
 
+#if PLATFORM(JAVA)
+    if (!is<WorkerMainRunLoop>(m_runLoop.get())) {
+        Locker slotsLocker { threadSlotsLock };
+        if (maximumThreadCount && runningThreadCount >= maximumThreadCount) {
+            // startPendingThread() creates the thread once a slot is free
+            m_startPending = true;
+            pendingThreads().append(*this);
+            return;
+        }
+        ++runningThreadCount;
+    }
+#endif
+
     auto thread = createThread();
 
     // Force the Thread object to be initialized fully before storing it to m_thread (and becoming visible to other threads).
@@ -77,6 +77,13 @@ public:
     static Lock& workerOrWorkletThreadsLock() WTF_RETURNS_LOCK(s_workerOrWorkletThreadsLock);
     static void releaseFastMallocFreeMemoryInAllThreads();
 
+#if PLATFORM(JAVA)
+    // Bounds the number of worker and worklet threads that run at once.
+    // A thread started beyond the bound waits until a running one exits.
+    // 0, the default, means no bound.
+    WEBCORE_EXPORT static void setMaximumThreadCount(unsigned);
+#endif
+
     void addChildThread(WorkerOrWorkletThread&);
     void removeChildThread(WorkerOrWorkletThread&);
 
@@ -93,6 +100,10 @@ private:
     virtual void evaluateScriptIfNecessary(String&) { }
     virtual bool shouldWaitForWebInspectorOnStartup() const { return false; }
     void destroyWorkerGlobalScope(Ref<WorkerOrWorkletThread>&& protectedThis);
+#if PLATFORM(JAVA)
+    void startPendingThread();
+    static void releaseThreadSlot();
+#endif
 
     static Lock s_workerOrWorkletThreadsLock;
 
@@ -108,6 +119,9 @@ private:
     Function<void()> m_runWhenLastChildThreadIsGone;
     bool m_isSuspended { false };
     bool m_pausedForDebugger { false };
+#if PLATFORM(JAVA)
+    bool m_startPending { false };
+#endif
 };
 
 } // namespace WebCore
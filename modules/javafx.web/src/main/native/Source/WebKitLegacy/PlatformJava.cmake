@@ -127,10 +127,14 @@ list(APPEND WebKitLegacy_SOURCES
     java/WebCoreSupport/VisitedLinkStoreJava.cpp
     java/WebCoreSupport/InspectorClientJava.cpp
     java/WebCoreSupport/WebPage.cpp
+    java/WebCoreSupport/WebPageCompositor.cpp
     java/WebCoreSupport/PlatformStrategiesJava.cpp
     java/WebCoreSupport/ChromeClientJava.cpp
     java/WebCoreSupport/BackForwardList.cpp
     java/WebCoreSupport/PageCacheJava.cpp
+    java/WebCoreSupport/MemoryCacheJava.cpp
+    java/WebCoreSupport/MemoryPressureJava.cpp
+    java/WebCoreSupport/MemoryStatisticsJava.cpp
 
     java/storage/WebDatabaseProviderJava.cpp
 )
@@ -41,6 +41,10 @@ public:
 
     void deleteAllDatabases();
 
+#if PLATFORM(JAVA)
+    static void setIndexedDatabaseDirectoryPath(const String&);
+#endif
+
 private:
     explicit WebDatabaseProvider();
 
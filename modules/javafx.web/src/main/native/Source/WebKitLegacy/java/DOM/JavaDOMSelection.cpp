@@ -207,9 +207,9 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_dom_DOMSelectionImpl_modifyImpl(JNIEn
     , jstring granularity)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->modify(AtomString {String(env, alter)}
-            , AtomString {String(env, direction)}
-            , AtomString {String(env, granularity)});
+    IMPL->modify(toAtomString(env, alter)
+            , toAtomString(env, direction)
+            , toAtomString(env, granularity));
 }
 
 
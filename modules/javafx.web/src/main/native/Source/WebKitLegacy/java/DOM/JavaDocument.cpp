@@ -123,7 +123,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_DocumentImpl_getXmlVersionImpl
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_DocumentImpl_setXmlVersionImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setXMLVersion(AtomString{String(env, value)});
+    IMPL->setXMLVersion(toAtomString(env, value));
 }
 
 JNIEXPORT jboolean JNICALL Java_com_sun_webkit_dom_DocumentImpl_getXmlStandaloneImpl(JNIEnv*, jclass, jlong peer)
@@ -147,7 +147,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_DocumentImpl_getDocumentURIImp
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_DocumentImpl_setDocumentURIImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setDocumentURI(AtomString{String(env, value)});
+    IMPL->setDocumentURI(toAtomString(env, value));
 }
 
 JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_getDefaultViewImpl(JNIEnv* env, jclass, jlong peer)
@@ -207,7 +207,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_DocumentImpl_getCookieImpl(JNI
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_DocumentImpl_setCookieImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setCookie(AtomString{String(env, value)});
+    IMPL->setCookie(toAtomString(env, value));
 }
 
 JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_getBodyImpl(JNIEnv* env, jclass, jlong peer)
@@ -1210,7 +1210,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_createElementImpl(J
     , jstring tagName)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<Element>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->createElementForBindings(AtomString {String(env, tagName)}))));
+    return JavaReturn<Element>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->createElementForBindings(toAtomString(env, tagName)))));
 }
 
 
@@ -1259,7 +1259,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_createAttributeImpl
     , jstring name)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<Attr>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->createAttribute(AtomString {String(env, name)}))));
+    return JavaReturn<Attr>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->createAttribute(toAtomString(env, name)))));
 }
 
 
@@ -1274,7 +1274,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_getElementsByTagNam
     , jstring tagname)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<NodeList>(env, WTF::getPtr(IMPL->getElementsByTagName(AtomString {String(env, tagname)})));
+    return JavaReturn<NodeList>(env, WTF::getPtr(IMPL->getElementsByTagName(toAtomString(env, tagname))));
 }
 
 
@@ -1298,8 +1298,8 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_createElementNSImpl
     , jstring qualifiedName)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<Element>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->createElementNS(AtomString {String(env, namespaceURI)}
-            , AtomString {String(env, qualifiedName)}))));
+    return JavaReturn<Element>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->createElementNS(toAtomString(env, namespaceURI)
+            , toAtomString(env, qualifiedName)))));
 }
 
 
@@ -1308,8 +1308,8 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_createAttributeNSIm
     , jstring qualifiedName)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<Attr>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->createAttributeNS(AtomString {String(env, namespaceURI)}
-            , AtomString {String(env, qualifiedName)}))));
+    return JavaReturn<Attr>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->createAttributeNS(toAtomString(env, namespaceURI)
+            , toAtomString(env, qualifiedName)))));
 }
 
 
@@ -1318,8 +1318,8 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_getElementsByTagNam
     , jstring localName)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<NodeList>(env, WTF::getPtr(IMPL->getElementsByTagNameNS(AtomString {String(env, namespaceURI)}
-            , AtomString {String(env, localName)})));
+    return JavaReturn<NodeList>(env, WTF::getPtr(IMPL->getElementsByTagNameNS(toAtomString(env, namespaceURI)
+            , toAtomString(env, localName))));
 }
 
 
@@ -1340,7 +1340,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_createEventImpl(JNI
     , jstring eventType)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<Event>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->createEvent(AtomString {String(env, eventType)}))));
+    return JavaReturn<Event>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->createEvent(toAtomString(env, eventType)))));
 }
 
 
@@ -1400,7 +1400,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_getOverrideStyleImp
 #if 0
     WebCore::JSMainThreadNullState state;
     return JavaReturn<CSSStyleDeclaration>(env, WTF::getPtr(IMPL->getOverrideStyle(static_cast<Element*>(jlong_to_ptr(element))
-            , AtomString {String(env, pseudoElement)})));
+            , toAtomString(env, pseudoElement))));
 #endif
     return 0L;
 }
@@ -1411,7 +1411,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_createExpressionImp
     , jlong resolver)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<XPathExpression>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->createExpression(AtomString {String(env, expression)}
+    return JavaReturn<XPathExpression>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->createExpression(toAtomString(env, expression)
             , static_cast<XPathNSResolver*>(jlong_to_ptr(resolver))))));
 }
 
@@ -1440,7 +1440,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_evaluateImpl(JNIEnv
     , jlong inResult)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<XPathResult>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->evaluate(AtomString {String(env, expression)}
+    return JavaReturn<XPathResult>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->evaluate(toAtomString(env, expression)
             , *static_cast<Node*>(jlong_to_ptr(contextNode))
             , static_cast<XPathNSResolver*>(jlong_to_ptr(resolver))
             , type
@@ -1454,9 +1454,9 @@ JNIEXPORT jboolean JNICALL Java_com_sun_webkit_dom_DocumentImpl_execCommandImpl(
     , jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    return IMPL->execCommand(AtomString {String(env, command)}
+    return IMPL->execCommand(toAtomString(env, command)
             , userInterface
-            , AtomString {String(env, value)}).returnValue();
+            , toAtomString(env, value)).returnValue();
 }
 
 
@@ -1464,7 +1464,7 @@ JNIEXPORT jboolean JNICALL Java_com_sun_webkit_dom_DocumentImpl_queryCommandEnab
     , jstring command)
 {
     WebCore::JSMainThreadNullState state;
-    return IMPL->queryCommandEnabled(AtomString {String(env, command)}).returnValue();
+    return IMPL->queryCommandEnabled(toAtomString(env, command)).returnValue();
 }
 
 
@@ -1472,7 +1472,7 @@ JNIEXPORT jboolean JNICALL Java_com_sun_webkit_dom_DocumentImpl_queryCommandInde
     , jstring command)
 {
     WebCore::JSMainThreadNullState state;
-    return IMPL->queryCommandIndeterm(AtomString {String(env, command)}).returnValue();
+    return IMPL->queryCommandIndeterm(toAtomString(env, command)).returnValue();
 }
 
 
@@ -1480,7 +1480,7 @@ JNIEXPORT jboolean JNICALL Java_com_sun_webkit_dom_DocumentImpl_queryCommandStat
     , jstring command)
 {
     WebCore::JSMainThreadNullState state;
-    return IMPL->queryCommandState(AtomString {String(env, command)}).returnValue();
+    return IMPL->queryCommandState(toAtomString(env, command)).returnValue();
 }
 
 
@@ -1488,7 +1488,7 @@ JNIEXPORT jboolean JNICALL Java_com_sun_webkit_dom_DocumentImpl_queryCommandSupp
     , jstring command)
 {
     WebCore::JSMainThreadNullState state;
-    return IMPL->queryCommandSupported(AtomString {String(env, command)}).returnValue();
+    return IMPL->queryCommandSupported(toAtomString(env, command)).returnValue();
 }
 
 
@@ -1496,7 +1496,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_DocumentImpl_queryCommandValue
     , jstring command)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<String>(env, IMPL->queryCommandValue(AtomString {String(env, command)}).returnValue());
+    return JavaReturn<String>(env, IMPL->queryCommandValue(toAtomString(env, command)).returnValue());
 }
 
 
@@ -1504,7 +1504,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_getElementsByNameIm
     , jstring elementName)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<NodeList>(env, WTF::getPtr(IMPL->getElementsByName(AtomString {String(env, elementName)})));
+    return JavaReturn<NodeList>(env, WTF::getPtr(IMPL->getElementsByName(toAtomString(env, elementName))));
 }
 
 
@@ -1539,7 +1539,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_getElementsByClassN
     , jstring classNames)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<HTMLCollection>(env, WTF::getPtr(IMPL->getElementsByClassName(AtomString {String(env, classNames)})));
+    return JavaReturn<HTMLCollection>(env, WTF::getPtr(IMPL->getElementsByClassName(toAtomString(env, classNames))));
 }
 
 
@@ -1568,7 +1568,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_getElementByIdImpl(
     , jstring elementId)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<Element>(env, WTF::getPtr(IMPL->getElementById(AtomString {String(env, elementId)})));
+    return JavaReturn<Element>(env, WTF::getPtr(IMPL->getElementById(toAtomString(env, elementId))));
 }
 
 
@@ -1576,7 +1576,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_querySelectorImpl(J
     , jstring selectors)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<Element>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->querySelector(AtomString {String(env, selectors)}))));
+    return JavaReturn<Element>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->querySelector(toAtomString(env, selectors)))));
 }
 
 
@@ -1584,7 +1584,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_DocumentImpl_querySelectorAllImp
     , jstring selectors)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<NodeList>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->querySelectorAll(AtomString {String(env, selectors)}))));
+    return JavaReturn<NodeList>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->querySelectorAll(toAtomString(env, selectors)))));
 }
 
 
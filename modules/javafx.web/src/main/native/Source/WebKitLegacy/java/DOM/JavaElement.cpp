@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -87,7 +87,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_ElementImpl_getIdImpl(JNIEnv*
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_ElementImpl_setIdImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::idAttr, AtomString {String(env, value)});
+    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::idAttr, toAtomString(env, value));
 }
 
 JNIEXPORT jdouble JNICALL Java_com_sun_webkit_dom_ElementImpl_getOffsetLeftImpl(JNIEnv*, jclass, jlong peer)
@@ -189,7 +189,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_ElementImpl_getInnerHTMLImpl(J
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_ElementImpl_setInnerHTMLImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setInnerHTML(AtomString {String(env, value)});
+    IMPL->setInnerHTML(toAtomString(env, value));
 }
 
 JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_ElementImpl_getOuterHTMLImpl(JNIEnv* env, jclass, jlong peer)
@@ -201,7 +201,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_ElementImpl_getOuterHTMLImpl(J
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_ElementImpl_setOuterHTMLImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setOuterHTML(AtomString {String(env, value)});
+    IMPL->setOuterHTML(toAtomString(env, value));
 }
 
 JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_ElementImpl_getClassNameImpl(JNIEnv* env, jclass, jlong peer)
@@ -213,7 +213,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_ElementImpl_getClassNameImpl(J
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_ElementImpl_setClassNameImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::classAttr, AtomString {String(env, value)});
+    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::classAttr, toAtomString(env, value));
 }
 
 JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_ElementImpl_getOnbeforecopyImpl(JNIEnv* env, jclass, jlong peer)
@@ -1146,7 +1146,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_ElementImpl_getAttributeImpl(J
     , jstring name)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<String>(env, IMPL->getAttribute(AtomString {String(env, name)}));
+    return JavaReturn<String>(env, IMPL->getAttribute(toAtomString(env, name)));
 }
 
 
@@ -1155,8 +1155,8 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_dom_ElementImpl_setAttributeImpl(JNIE
     , jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    raiseOnDOMError(env, IMPL->setAttribute(AtomString {String(env, name)}
-            , AtomString {String(env, value)}));
+    raiseOnDOMError(env, IMPL->setAttribute(toAtomString(env, name)
+            , toAtomString(env, value)));
 }
 
 
@@ -1164,7 +1164,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_dom_ElementImpl_removeAttributeImpl(J
     , jstring name)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->removeAttribute(AtomString {String(env, name)});
+    IMPL->removeAttribute(toAtomString(env, name));
 }
 
 
@@ -1172,7 +1172,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_ElementImpl_getAttributeNodeImpl
     , jstring name)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<Attr>(env, WTF::getPtr(IMPL->getAttributeNode(AtomString {String(env, name)})));
+    return JavaReturn<Attr>(env, WTF::getPtr(IMPL->getAttributeNode(toAtomString(env, name))));
 }
 
 
@@ -1208,7 +1208,21 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_ElementImpl_getElementsByTagName
     if (!name)
         return 0;
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<NodeList>(env, WTF::getPtr(IMPL->getElementsByTagName(AtomString {String(env, name)})));
+    return JavaReturn<NodeList>(env, WTF::getPtr(IMPL->getElementsByTagName(toAtomString(env, name))));
+}
+
+
+JNIEXPORT jobjectArray JNICALL Java_com_sun_webkit_dom_ElementImpl_getAttributeNamesAndValuesImpl(JNIEnv* env, jclass, jlong peer)
+{
+    WebCore::JSMainThreadNullState state;
+    Vector<String> namesAndValues;
+    if (IMPL->hasAttributes()) {
+        for (const Attribute& attribute : IMPL->attributesIterator()) {
+            namesAndValues.append(attribute.name().toString());
+            namesAndValues.append(attribute.value());
+        }
+    }
+    return toJavaStringArray(env, namesAndValues);
 }
 
 
@@ -1224,8 +1238,8 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_ElementImpl_getAttributeNSImpl
     , jstring localName)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<String>(env, IMPL->getAttributeNS(AtomString {String(env, namespaceURI)}
-            , AtomString {String(env, localName)}));
+    return JavaReturn<String>(env, IMPL->getAttributeNS(toAtomString(env, namespaceURI)
+            , toAtomString(env, localName)));
 }
 
 
@@ -1235,9 +1249,9 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_dom_ElementImpl_setAttributeNSImpl(JN
     , jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    raiseOnDOMError(env, IMPL->setAttributeNS(AtomString {String(env, namespaceURI)}
-            , AtomString {String(env, qualifiedName)}
-            , AtomString {String(env, value)}));
+    raiseOnDOMError(env, IMPL->setAttributeNS(toAtomString(env, namespaceURI)
+            , toAtomString(env, qualifiedName)
+            , toAtomString(env, value)));
 }
 
 
@@ -1246,8 +1260,8 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_dom_ElementImpl_removeAttributeNSImpl
     , jstring localName)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->removeAttributeNS(AtomString {String(env, namespaceURI)}
-            , AtomString {String(env, localName)});
+    IMPL->removeAttributeNS(toAtomString(env, namespaceURI)
+            , toAtomString(env, localName));
 }
 
 
@@ -1258,8 +1272,8 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_ElementImpl_getElementsByTagName
     if (!localName)
         return 0;
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<NodeList>(env, WTF::getPtr(IMPL->getElementsByTagNameNS(AtomString {String(env, namespaceURI)}
-            , AtomString {String(env, localName)})));
+    return JavaReturn<NodeList>(env, WTF::getPtr(IMPL->getElementsByTagNameNS(toAtomString(env, namespaceURI)
+            , toAtomString(env, localName))));
 }
 
 
@@ -1268,8 +1282,8 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_ElementImpl_getAttributeNodeNSIm
     , jstring localName)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<Attr>(env, WTF::getPtr(IMPL->getAttributeNodeNS(AtomString {String(env, namespaceURI)}
-            , AtomString {String(env, localName)})));
+    return JavaReturn<Attr>(env, WTF::getPtr(IMPL->getAttributeNodeNS(toAtomString(env, namespaceURI)
+            , toAtomString(env, localName))));
 }
 
 
@@ -1289,7 +1303,7 @@ JNIEXPORT jboolean JNICALL Java_com_sun_webkit_dom_ElementImpl_hasAttributeImpl(
     , jstring name)
 {
     WebCore::JSMainThreadNullState state;
-    return IMPL->hasAttribute(AtomString {String(env, name)});
+    return IMPL->hasAttribute(toAtomString(env, name));
 }
 
 
@@ -1298,8 +1312,8 @@ JNIEXPORT jboolean JNICALL Java_com_sun_webkit_dom_ElementImpl_hasAttributeNSImp
     , jstring localName)
 {
     WebCore::JSMainThreadNullState state;
-    return IMPL->hasAttributeNS(AtomString {String(env, namespaceURI)}
-            , AtomString {String(env, localName)});
+    return IMPL->hasAttributeNS(toAtomString(env, namespaceURI)
+            , toAtomString(env, localName));
 }
 
 
@@ -1353,7 +1367,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_ElementImpl_getElementsByClassNa
     , jstring name)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<HTMLCollection>(env, WTF::getPtr(IMPL->getElementsByClassName(AtomString {String(env, name)})));
+    return JavaReturn<HTMLCollection>(env, WTF::getPtr(IMPL->getElementsByClassName(toAtomString(env, name))));
 }
 
 
@@ -1361,7 +1375,7 @@ JNIEXPORT jboolean JNICALL Java_com_sun_webkit_dom_ElementImpl_matchesImpl(JNIEn
     , jstring selectors)
 {
     WebCore::JSMainThreadNullState state;
-    return raiseOnDOMError(env, IMPL->matches(AtomString {String(env, selectors)}));
+    return raiseOnDOMError(env, IMPL->matches(toAtomString(env, selectors)));
 }
 
 
@@ -1369,7 +1383,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_ElementImpl_closestImpl(JNIEnv*
     , jstring selectors)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<Element>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->closest(AtomString {String(env, selectors)}))));
+    return JavaReturn<Element>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->closest(toAtomString(env, selectors)))));
 }
 
 
@@ -1377,7 +1391,7 @@ JNIEXPORT jboolean JNICALL Java_com_sun_webkit_dom_ElementImpl_webkitMatchesSele
     , jstring selectors)
 {
     WebCore::JSMainThreadNullState state;
-    return raiseOnDOMError(env, IMPL->matches(AtomString {String(env, selectors)}));
+    return raiseOnDOMError(env, IMPL->matches(toAtomString(env, selectors)));
 }
 
 
@@ -1407,7 +1421,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_ElementImpl_querySelectorImpl(JN
     , jstring selectors)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<Element>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->querySelector(AtomString {String(env, selectors)}))));
+    return JavaReturn<Element>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->querySelector(toAtomString(env, selectors)))));
 }
 
 
@@ -1415,7 +1429,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_ElementImpl_querySelectorAllImpl
     , jstring selectors)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<NodeList>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->querySelectorAll(AtomString {String(env, selectors)}))));
+    return JavaReturn<NodeList>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->querySelectorAll(toAtomString(env, selectors)))));
 }
 
 
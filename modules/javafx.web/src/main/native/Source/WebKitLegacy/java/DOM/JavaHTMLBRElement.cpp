@@ -53,7 +53,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_HTMLBRElementImpl_getClearImpl
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_HTMLBRElementImpl_setClearImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::clearAttr, AtomString{String(env, value)});
+    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::clearAttr, toAtomString(env, value));
 }
 
 }
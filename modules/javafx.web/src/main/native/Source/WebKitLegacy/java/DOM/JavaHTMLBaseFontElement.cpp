@@ -52,7 +52,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_HTMLBaseFontElementImpl_getCol
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_HTMLBaseFontElementImpl_setColorImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::colorAttr, AtomString {String(env, value)});
+    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::colorAttr, toAtomString(env, value));
 }
 
 JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_HTMLBaseFontElementImpl_getFaceImpl(JNIEnv* env, jclass, jlong peer)
@@ -64,7 +64,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_HTMLBaseFontElementImpl_getFac
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_HTMLBaseFontElementImpl_setFaceImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::faceAttr, AtomString {String(env, value)});
+    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::faceAttr, toAtomString(env, value));
 }
 
 JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_HTMLBaseFontElementImpl_getSizeImpl(JNIEnv* env, jclass, jlong peer)
@@ -76,7 +76,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_HTMLBaseFontElementImpl_getSiz
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_HTMLBaseFontElementImpl_setSizeImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::sizeAttr, AtomString {String(env, value)});
+    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::sizeAttr, toAtomString(env, value));
 }
 
 }
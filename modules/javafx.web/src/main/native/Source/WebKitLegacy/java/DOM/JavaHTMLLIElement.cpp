@@ -53,7 +53,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_HTMLLIElementImpl_getTypeImpl(
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_HTMLLIElementImpl_setTypeImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::typeAttr, AtomString{String(env, value)});
+    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::typeAttr, toAtomString(env, value));
 }
 
 JNIEXPORT jint JNICALL Java_com_sun_webkit_dom_HTMLLIElementImpl_getValueImpl(JNIEnv*, jclass, jlong peer)
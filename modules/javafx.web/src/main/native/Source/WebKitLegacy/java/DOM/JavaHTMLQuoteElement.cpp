@@ -53,7 +53,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_HTMLQuoteElementImpl_getCiteIm
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_HTMLQuoteElementImpl_setCiteImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::citeAttr, AtomString{String(env, value)});
+    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::citeAttr, toAtomString(env, value));
 }
 
 }
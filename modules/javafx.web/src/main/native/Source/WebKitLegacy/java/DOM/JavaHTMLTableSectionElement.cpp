@@ -57,7 +57,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_HTMLTableSectionElementImpl_ge
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_HTMLTableSectionElementImpl_setAlignImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::alignAttr, AtomString {String(env, value)});
+    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::alignAttr, toAtomString(env, value));
 }
 
 JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_HTMLTableSectionElementImpl_getChImpl(JNIEnv* env, jclass, jlong peer)
@@ -69,7 +69,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_HTMLTableSectionElementImpl_ge
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_HTMLTableSectionElementImpl_setChImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::charAttr, AtomString {String(env, value)});
+    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::charAttr, toAtomString(env, value));
 }
 
 JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_HTMLTableSectionElementImpl_getChOffImpl(JNIEnv* env, jclass, jlong peer)
@@ -81,7 +81,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_HTMLTableSectionElementImpl_ge
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_HTMLTableSectionElementImpl_setChOffImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::charoffAttr, AtomString {String(env, value)});
+    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::charoffAttr, toAtomString(env, value));
 }
 
 JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_HTMLTableSectionElementImpl_getVAlignImpl(JNIEnv* env, jclass, jlong peer)
@@ -93,7 +93,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_HTMLTableSectionElementImpl_ge
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_HTMLTableSectionElementImpl_setVAlignImpl(JNIEnv* env, jclass, jlong peer, jstring value)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::valignAttr, AtomString {String(env, value)});
+    IMPL->setAttributeWithoutSynchronization(WebCore::HTMLNames::valignAttr, toAtomString(env, value));
 }
 
 JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_HTMLTableSectionElementImpl_getRowsImpl(JNIEnv* env, jclass, jlong peer)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -69,7 +69,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_NodeImpl_getNodeValueImpl(JNIE
 }
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_NodeImpl_setNodeValueImpl(JNIEnv* env, jclass, jlong peer, jstring value) {
     WebCore::JSMainThreadNullState state;
-    IMPL->setNodeValue(AtomString{String(env, value)});
+    IMPL->setNodeValue(toAtomString(env, value));
 }
 
 JNIEXPORT jshort JNICALL Java_com_sun_webkit_dom_NodeImpl_getNodeTypeImpl(JNIEnv*, jclass, jlong peer) {
@@ -87,6 +87,14 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_NodeImpl_getChildNodesImpl(JNIEn
     return JavaReturn<NodeList>(env, WTF::getPtr(IMPL->childNodes()));
 }
 
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_dom_NodeImpl_getChildNodePeersImpl(JNIEnv* env, jclass, jlong peer) {
+    WebCore::JSMainThreadNullState state;
+    Vector<Ref<Node>> children;
+    for (auto* child = IMPL->firstChild(); child; child = child->nextSibling())
+        children.append(*child);
+    return toJavaPeerArray(env, children);
+}
+
 JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_NodeImpl_getFirstChildImpl(JNIEnv* env, jclass, jlong peer) {
     WebCore::JSMainThreadNullState state;
     return JavaReturn<Node>(env, WTF::getPtr(IMPL->firstChild()));
@@ -123,7 +131,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_NodeImpl_getPrefixImpl(JNIEnv*
 }
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_NodeImpl_setPrefixImpl(JNIEnv* env, jclass, jlong peer, jstring value) {
     WebCore::JSMainThreadNullState state;
-    IMPL->setPrefix(AtomString {String(env, value)});
+    IMPL->setPrefix(toAtomString(env, value));
 }
 
 JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_NodeImpl_getLocalNameImpl(JNIEnv* env, jclass, jlong peer) {
@@ -248,7 +256,7 @@ JNIEXPORT jboolean JNICALL Java_com_sun_webkit_dom_NodeImpl_isSupportedImpl(JNIE
     , jstring version)
 {
     WebCore::JSMainThreadNullState state;
-    return SVGTests::hasFeatureForLegacyBindings(AtomString {String(env, feature)}, AtomString {String(env, version)});
+    return SVGTests::hasFeatureForLegacyBindings(toAtomString(env, feature), toAtomString(env, version));
 }
 
 
@@ -279,7 +287,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_NodeImpl_lookupPrefixImpl(JNIE
     , jstring namespaceURI)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<String>(env, IMPL->lookupPrefix(AtomString {String(env, namespaceURI)}));
+    return JavaReturn<String>(env, IMPL->lookupPrefix(toAtomString(env, namespaceURI)));
 }
 
 
@@ -287,7 +295,7 @@ JNIEXPORT jboolean JNICALL Java_com_sun_webkit_dom_NodeImpl_isDefaultNamespaceIm
     , jstring namespaceURI)
 {
     WebCore::JSMainThreadNullState state;
-    return IMPL->isDefaultNamespace(AtomString {String(env, namespaceURI)});
+    return IMPL->isDefaultNamespace(toAtomString(env, namespaceURI));
 }
 
 
@@ -295,7 +303,7 @@ JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_NodeImpl_lookupNamespaceURIImp
     , jstring prefix)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<String>(env, IMPL->lookupNamespaceURI(AtomString {String(env, prefix)}));
+    return JavaReturn<String>(env, IMPL->lookupNamespaceURI(toAtomString(env, prefix)));
 }
 
 
@@ -323,7 +331,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_dom_NodeImpl_addEventListenerImpl(JNI
     , jboolean useCapture)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->addEventListenerForBindings(AtomString {String(env, type)}
+    IMPL->addEventListenerForBindings(toAtomString(env, type)
             , static_cast<EventListener*>(jlong_to_ptr(listener))
             , static_cast<bool>(useCapture));
 }
@@ -335,7 +343,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_dom_NodeImpl_removeEventListenerImpl(
     , jboolean useCapture)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->removeEventListenerForBindings(AtomString {String(env, type)}
+    IMPL->removeEventListenerForBindings(toAtomString(env, type)
             , static_cast<EventListener*>(jlong_to_ptr(listener))
             , static_cast<bool>(useCapture));
 }
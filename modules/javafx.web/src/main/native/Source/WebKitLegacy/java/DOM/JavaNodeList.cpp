@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 #undef IMPL
 
 
+#include <WebCore/Element.h>
 #include <WebCore/Node.h>
 #include <WebCore/NodeList.h>
 #include <WebCore/JSExecState.h>
@@ -42,6 +43,18 @@ extern "C" {
 
 #define IMPL (static_cast<NodeList*>(jlong_to_ptr(peer)))
 
+static Vector<Ref<Node>> collectItems(NodeList& list)
+{
+    Vector<Ref<Node>> items;
+    unsigned length = list.length();
+    items.reserveInitialCapacity(length);
+    for (unsigned i = 0; i < length; ++i) {
+        if (auto* node = list.item(i))
+            items.uncheckedAppend(*node);
+    }
+    return items;
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_dom_NodeListImpl_dispose(JNIEnv*, jclass, jlong peer)
 {
     IMPL->deref();
@@ -64,5 +77,33 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_NodeListImpl_itemImpl(JNIEnv* en
     return JavaReturn<Node>(env, WTF::getPtr(IMPL->item(index)));
 }
 
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_dom_NodeListImpl_getItemPeersImpl(JNIEnv* env, jclass, jlong peer)
+{
+    WebCore::JSMainThreadNullState state;
+    return toJavaPeerArray(env, collectItems(*IMPL));
+}
+
+JNIEXPORT jobjectArray JNICALL Java_com_sun_webkit_dom_NodeListImpl_getAttributeValuesImpl(JNIEnv* env, jclass, jlong peer
+    , jstring name)
+{
+    WebCore::JSMainThreadNullState state;
+    AtomString attributeName = toAtomString(env, name);
+    Vector<String> values;
+    for (auto& node : collectItems(*IMPL)) {
+        auto* element = dynamicDowncast<Element>(node.get());
+        values.append(element ? element->getAttribute(attributeName).string() : String());
+    }
+    return toJavaStringArray(env, values);
+}
+
+JNIEXPORT jobjectArray JNICALL Java_com_sun_webkit_dom_NodeListImpl_getTextContentsImpl(JNIEnv* env, jclass, jlong peer)
+{
+    WebCore::JSMainThreadNullState state;
+    Vector<String> values;
+    for (auto& node : collectItems(*IMPL))
+        values.append(node->textContent());
+    return toJavaStringArray(env, values);
+}
+
 
 }
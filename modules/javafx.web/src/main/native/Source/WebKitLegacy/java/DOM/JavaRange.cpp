@@ -291,7 +291,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_RangeImpl_createContextualFragme
     , jstring html)
 {
     WebCore::JSMainThreadNullState state;
-    return JavaReturn<DocumentFragment>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->createContextualFragment(AtomString {String(env, html)}))));
+    return JavaReturn<DocumentFragment>(env, WTF::getPtr(raiseOnDOMError(env, IMPL->createContextualFragment(toAtomString(env, html)))));
 }
 
 
@@ -351,7 +351,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_dom_RangeImpl_expandImpl(JNIEnv* env,
     , jstring unit)
 {
     WebCore::JSMainThreadNullState state;
-    raiseOnDOMError(env, IMPL->expand(AtomString{String(env, unit)}));
+    raiseOnDOMError(env, IMPL->expand(toAtomString(env, unit)));
 }
 
 
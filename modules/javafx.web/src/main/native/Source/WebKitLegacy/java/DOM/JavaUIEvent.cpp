@@ -115,7 +115,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_dom_UIEventImpl_initUIEventImpl(JNIEn
     , jint detail)
 {
     WebCore::JSMainThreadNullState state;
-    IMPL->initUIEvent(AtomString{String(env, type)}
+    IMPL->initUIEvent(toAtomString(env, type)
             , canBubble
             , cancelable
             , toWindowProxy(static_cast<DOMWindow*>(jlong_to_ptr(view)))
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -52,6 +52,17 @@ public:
         return &NetworkStorageSessionMap::defaultStorageSession();
     }
 
+    HTTPDiskCacheJava* diskCache() const override
+    {
+        ASSERT(isMainThread());
+
+        if (!frame() || !frame()->page())
+            return nullptr;
+
+        WebPage* webPage = WebPage::webPageFromJObject(WebPage::jobjectFromPage(frame()->page()));
+        return webPage ? webPage->diskCache() : nullptr;
+    }
+
 private:
     FrameNetworkingContextJava(LocalFrame* frame)
         : FrameNetworkingContext(frame)
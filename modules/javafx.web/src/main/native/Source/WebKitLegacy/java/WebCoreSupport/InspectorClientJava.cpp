@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,8 +35,9 @@
 namespace InspectorClientJavaInternal {
 
 static JGClass webPageClass;
+static JGClass stringClass;
 static jmethodID repaintAllMethod;
-static jmethodID sendInspectorMessageToFrontendMethod;
+static jmethodID sendInspectorMessagesToFrontendMethod;
 
 static void initRefs(JNIEnv* env)
 {
@@ -51,11 +52,14 @@ static void initRefs(JNIEnv* env)
                 "()V");
         ASSERT(repaintAllMethod);
 
-        sendInspectorMessageToFrontendMethod = env->GetMethodID(
+        sendInspectorMessagesToFrontendMethod = env->GetMethodID(
                 webPageClass,
-                "fwkSendInspectorMessageToFrontend",
-                "(Ljava/lang/String;)Z");
-        ASSERT(sendInspectorMessageToFrontendMethod);
+                "fwkSendInspectorMessagesToFrontend",
+                "([Ljava/lang/String;)V");
+        ASSERT(sendInspectorMessagesToFrontendMethod);
+
+        stringClass = JLClass(env->FindClass("java/lang/String"));
+        ASSERT(stringClass);
     }
 }
 }
@@ -64,6 +68,7 @@ namespace WebCore {
 
 InspectorClientJava::InspectorClientJava(const JLObject &webPage)
     : m_webPage(webPage)
+    , m_flushTimer(*this, &InspectorClientJava::flushPendingMessages)
 {
 }
 
@@ -103,14 +108,35 @@ void InspectorClientJava::hideHighlight()
 }
 
 void InspectorClientJava::sendMessageToFrontend(const String& message)
+{
+    m_pendingMessages.append(message);
+    if (!m_flushTimer.isActive()) {
+        m_flushTimer.startOneShot(0_s);
+    }
+}
+
+void InspectorClientJava::flushPendingMessages()
 {
     using namespace InspectorClientJavaInternal;
+    m_flushTimer.stop();
+    if (m_pendingMessages.isEmpty()) {
+        return;
+    }
+
+    auto messages = std::exchange(m_pendingMessages, { });
     JNIEnv* env = WTF::GetJavaEnv();
     initRefs(env);
 
-    env->CallBooleanMethod(m_webPage,
-                           sendInspectorMessageToFrontendMethod,
-                           (jstring)message.toJavaString(env));
+    JLObjectArray jmessages(env->NewObjectArray(messages.size(), stringClass, nullptr));
+    if (WTF::CheckAndClearException(env)) { // OOME
+        return;
+    }
+    for (size_t i = 0; i < messages.size(); i++) {
+        JLString jmessage(messages[i].toJavaString(env));
+        env->SetObjectArrayElement(jmessages, i, (jstring)jmessage);
+    }
+
+    env->CallVoidMethod(m_webPage, sendInspectorMessagesToFrontendMethod, (jobjectArray)jmessages);
     WTF::CheckAndClearException(env);
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,8 @@
 #include <JavaScriptCore/InspectorFrontendChannel.h>
 #include <WebCore/InspectorClient.h>
 #include <WebCore/PlatformJavaClasses.h>
+#include <WebCore/Timer.h>
+#include <wtf/Vector.h>
 
 namespace WebCore {
 
@@ -49,9 +51,14 @@ public:
 
     ConnectionType connectionType() const override { return Inspector::FrontendChannel::ConnectionType::Local; }
     void sendMessageToFrontend(const String& message) override;
+    void flushPendingMessages();
 
 private:
     JGObject m_webPage;
+    // Messages to the frontend are sent to Java together, once control
+    // returns to the event loop
+    Vector<String> m_pendingMessages;
+    Timer m_flushTimer;
 };
 
 } // namespace WebCore
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <WebCore/MemoryCache.h>
+#include <WebCore/PlatformJavaClasses.h>
+#include "com_sun_webkit_MemoryCache.h"
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_MemoryCache_twkSetCapacity
+  (JNIEnv *, jclass, jlong capacity)
+{
+    ASSERT(capacity >= 0);
+    // Dead resources get the same share of the total as in WebKit's
+    // document browser cache model
+    unsigned totalBytes = static_cast<unsigned>(std::min<jlong>(capacity, std::numeric_limits<unsigned>::max()));
+    WebCore::MemoryCache::singleton().setCapacities(totalBytes / 8, totalBytes / 4, totalBytes);
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_MemoryCache_twkSetDecodedDataDeletionInterval
+  (JNIEnv *, jclass, jdouble seconds)
+{
+    ASSERT(seconds >= 0);
+    WebCore::MemoryCache::singleton().setDeadDecodedDataDeletionInterval(Seconds(seconds));
+}
+
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <WebCore/MemoryRelease.h>
+#include <WebCore/PlatformJavaClasses.h>
+#include <wtf/MemoryPressureHandler.h>
+#include "com_sun_webkit_MemoryPressure.h"
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_MemoryPressure_twkInstall
+  (JNIEnv *, jclass)
+{
+    // Watches the footprint of the process and releases memory
+    // once it gets close to the limits derived from the RAM size
+    auto& handler = MemoryPressureHandler::singleton();
+    handler.setLowMemoryHandler([] (Critical critical, Synchronous synchronous) {
+        WebCore::releaseMemory(critical, synchronous);
+    });
+    handler.setShouldUsePeriodicMemoryMonitor(true);
+    handler.install();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_MemoryPressure_twkReleaseMemory
+  (JNIEnv *, jclass, jboolean critical)
+{
+    WebCore::releaseMemory(jbool_to_bool(critical) ? Critical::Yes : Critical::No, Synchronous::No);
+}
+
+}
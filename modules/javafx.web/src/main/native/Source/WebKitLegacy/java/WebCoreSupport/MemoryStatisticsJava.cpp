@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include <JavaScriptCore/HeapObserver.h>
+#include <JavaScriptCore/JSLock.h>
+#include <JavaScriptCore/VM.h>
+#include <WebCore/BackForwardCache.h>
+#include <WebCore/CommonVM.h>
+#include <WebCore/FontCache.h>
+#include <WebCore/MemoryCache.h>
+#include <WebCore/PlatformJavaClasses.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/NeverDestroyed.h>
+#include "com_sun_webkit_MemoryStatistics.h"
+
+namespace {
+
+// Times the collections of the common VM. The observer is called by the
+// thread conducting the collection, which is not always the main thread.
+class GarbageCollectionObserver final : public JSC::HeapObserver {
+public:
+    void willGarbageCollect() override
+    {
+        m_start = MonotonicTime::now();
+    }
+
+    void didGarbageCollect(JSC::CollectionScope scope) override
+    {
+        jlong time = static_cast<jlong>((MonotonicTime::now() - m_start).microseconds());
+        ++m_count;
+        if (scope == JSC::CollectionScope::Full)
+            ++m_fullCount;
+        m_time += time;
+        if (time > m_maxTime)
+            m_maxTime = time;
+    }
+
+    std::atomic<jlong> m_count { 0 };
+    std::atomic<jlong> m_fullCount { 0 };
+    std::atomic<jlong> m_time { 0 };
+    std::atomic<jlong> m_maxTime { 0 };
+
+private:
+    MonotonicTime m_start;
+};
+
+GarbageCollectionObserver& gcObserver()
+{
+    static NeverDestroyed<GarbageCollectionObserver> observer;
+    return observer;
+}
+
+}
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_MemoryStatistics_twkInstall
+  (JNIEnv*, jclass)
+{
+    WebCore::commonVM().heap.addObserver(&gcObserver());
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_MemoryStatistics_twkGetProcessValues
+  (JNIEnv* env, jclass, jlongArray jvalues)
+{
+    using namespace WebCore;
+
+    auto cache = MemoryCache::singleton().getStatistics();
+    jlong resourceCount = 0, resourceSize = 0, liveSize = 0, decodedSize = 0;
+    for (auto& type : { cache.images, cache.cssStyleSheets, cache.scripts, cache.xslStyleSheets, cache.fonts }) {
+        resourceCount += type.count;
+        resourceSize += type.size;
+        liveSize += type.liveSize;
+        decodedSize += type.decodedSize;
+    }
+
+    auto& vm = commonVM();
+    JSC::JSLockHolder lock(vm);
+
+    // Same layout as the value indices in MemoryStatistics
+    jlong values[] = {
+        resourceCount,
+        resourceSize,
+        liveSize,
+        decodedSize,
+        cache.images.count,
+        cache.images.size,
+        static_cast<jlong>(FontCache::forCurrentThread().fontCount()),
+        static_cast<jlong>(FontCache::forCurrentThread().inactiveFontCount()),
+        static_cast<jlong>(vm.heap.size()),
+        static_cast<jlong>(vm.heap.capacity()),
+        BackForwardCache::singleton().pageCount(),
+        gcObserver().m_count,
+        gcObserver().m_fullCount,
+        gcObserver().m_time,
+        gcObserver().m_maxTime,
+    };
+    env->SetLongArrayRegion(jvalues, 0, std::size(values), values);
+}
+
+}
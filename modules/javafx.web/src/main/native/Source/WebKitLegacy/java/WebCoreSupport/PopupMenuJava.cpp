@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,7 @@
 #include <WebCore/PlatformJavaClasses.h>
 #include <WebCore/PopupMenuClient.h>
 
+#include <wtf/Vector.h>
 #include <wtf/text/WTFString.h>
 
 #include "com_sun_webkit_PopupMenu.h"
@@ -100,26 +101,50 @@ void PopupMenuJava::populate()
 {
     JNIEnv* env = WTF::GetJavaEnv();
 
+    // Only the item count is passed here; Java fetches the items
+    // themselves in ranges through twkGetItems when it needs them.
     static jmethodID mid = env->GetMethodID(getJPopupMenuClass(),
-        "fwkAppendItem", "(Ljava/lang/String;ZZZIILcom/sun/webkit/graphics/WCFont;)V");
+        "fwkSetItemCount", "(I)V");
     ASSERT(mid);
 
-    for (int i = 0; i < client()->listSize(); i++) {
-        String itemText = client()->itemText(i);
-        JLString itemTextJ(itemText.toJavaString(env));
+    env->CallVoidMethod(m_popup, mid, (jint)client()->listSize());
+    WTF::CheckAndClearException(env);
+}
+
+int PopupMenuJava::getItems(JNIEnv* env, int from, jobjectArray texts, jintArray flags,
+                            jintArray bgColors, jintArray fgColors, jobjectArray fonts)
+{
+    if (!client())
+        return 0;
+
+    int count = std::min<int>(env->GetArrayLength(texts), client()->listSize() - from);
+    if (from < 0 || count <= 0)
+        return 0;
+
+    Vector<jint> itemFlags(count);
+    Vector<jint> itemBgColors(count);
+    Vector<jint> itemFgColors(count);
+    for (int i = 0; i < count; i++) {
+        int index = from + i;
+        JLString itemTextJ(client()->itemText(index).toJavaString(env));
         ASSERT(itemTextJ);
-        PopupMenuStyle style = client()->itemStyle(i);
+        env->SetObjectArrayElement(texts, i, (jstring)itemTextJ);
+
+        PopupMenuStyle style = client()->itemStyle(index);
         auto [r1, g1, b1, a1] = style.backgroundColor().toColorTypeLossy<SRGBA<uint8_t>>().resolved();
         auto [r2, g2, b2, a2] = style.foregroundColor().toColorTypeLossy<SRGBA<uint8_t>>().resolved();
-        env->CallVoidMethod(m_popup, mid, (jstring)itemTextJ,
-                            bool_to_jbool(client()->itemIsLabel(i)),
-                            bool_to_jbool(client()->itemIsSeparator(i)),
-                            bool_to_jbool(client()->itemIsEnabled(i)),
-                            (jint)(a1 << 24 | r1 << 16 | g1 << 8 | b1),
-                            (jint)(a2 << 24 | r2 << 16 | g2 << 8 | b2),
-                            (jobject)*style.font().primaryFont().platformData().nativeFontData());
-        WTF::CheckAndClearException(env);
+        itemBgColors[i] = a1 << 24 | r1 << 16 | g1 << 8 | b1;
+        itemFgColors[i] = a2 << 24 | r2 << 16 | g2 << 8 | b2;
+        itemFlags[i] = (client()->itemIsLabel(index) ? ItemLabel : 0)
+            | (client()->itemIsSeparator(index) ? ItemSeparator : 0)
+            | (client()->itemIsEnabled(index) ? ItemEnabled : 0);
+        env->SetObjectArrayElement(fonts, i,
+            (jobject)*style.font().primaryFont().platformData().nativeFontData());
     }
+    env->SetIntArrayRegion(flags, 0, count, itemFlags.data());
+    env->SetIntArrayRegion(bgColors, 0, count, itemBgColors.data());
+    env->SetIntArrayRegion(fgColors, 0, count, itemFgColors.data());
+    return count;
 }
 
 void PopupMenuJava::show(const IntRect& r, LocalFrameView* frameView, int index)
@@ -178,6 +203,21 @@ void PopupMenuJava::disconnectClient()
 
 } // namespace WebCore
 
+JNIEXPORT jint JNICALL Java_com_sun_webkit_PopupMenu_twkGetItems
+    (JNIEnv* env, jobject, jlong pdata, jint from, jobjectArray texts, jintArray flags,
+     jintArray bgColors, jintArray fgColors, jobjectArray fonts)
+{
+    using namespace WebCore;
+    if (!pdata) {
+        return 0;
+    }
+
+    PopupMenuJava* pPopupMenu = static_cast<PopupMenuJava*>(jlong_to_ptr(pdata));
+    ASSERT(pPopupMenu);
+
+    return pPopupMenu->getItems(env, from, texts, flags, bgColors, fgColors, fonts);
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_PopupMenu_twkSelectionCommited
     (JNIEnv*, jobject, jlong pdata, jint index)
 {
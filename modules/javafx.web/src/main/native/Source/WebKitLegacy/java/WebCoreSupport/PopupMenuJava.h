@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,9 +48,18 @@ public:
 
     void createPopupMenuJava(Page* page);
     void populate();
+    int getItems(JNIEnv*, int from, jobjectArray texts, jintArray flags,
+                 jintArray bgColors, jintArray fgColors, jobjectArray fonts);
     PopupMenuClient* client() const { return m_popupClient; }
 
 private:
+    // Must match the ITEM_* flags in com.sun.webkit.PopupMenu
+    enum ItemFlag {
+        ItemLabel = 1,
+        ItemSeparator = 2,
+        ItemEnabled = 4
+    };
+
     PopupMenuClient* m_popupClient;
     JGObject m_popup;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -62,15 +62,23 @@ ProgressTrackerClientJava::ProgressTrackerClientJava(const JLObject& webPage)
 
 void ProgressTrackerClientJava::progressStarted(LocalFrame&)
 {
+    m_notifiedProgress = 0;
 }
 
 void ProgressTrackerClientJava::progressEstimateChanged(LocalFrame& originatingProgressFrame)
 {
     using namespace ProgressTrackerClientJavaInternal;
+    double progress = originatingProgressFrame.page()->progress().estimatedProgress();
+    // ProgressTracker rate limits the notifications, but keeps sending the
+    // same value while it is clamped, e.g. at 0.5 until the first layout.
+    if (progress == m_notifiedProgress) {
+        return;
+    }
+    m_notifiedProgress = progress;
+
     JNIEnv* env = WTF::GetJavaEnv();
     initRefs(env);
 
-    double progress = originatingProgressFrame.page()->progress().estimatedProgress();
     // We have a redundant notification from webkit (with progress == 1)
     // after PAGE_FINISHED has already been posted.
     DocumentLoader* documentLoader = originatingProgressFrame.loader().activeDocumentLoader();
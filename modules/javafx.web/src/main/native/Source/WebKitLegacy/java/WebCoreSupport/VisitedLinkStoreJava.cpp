@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -78,6 +78,27 @@ void VisitedLinkStoreJava::addVisitedLink(const String& urlString)
     addVisitedLinkHash(computeSharedStringHash(urlString));
 }
 
+Vector<SharedStringHash> VisitedLinkStoreJava::visitedLinkHashes() const
+{
+    return copyToVector(m_visitedLinkHashes);
+}
+
+void VisitedLinkStoreJava::addVisitedLinkHashes(const Vector<SharedStringHash>& linkHashes)
+{
+    if (!s_shouldTrackVisitedLinks)
+        return;
+
+    bool added = false;
+    for (auto linkHash : linkHashes) {
+        if (decltype(m_visitedLinkHashes)::isValidValue(linkHash))
+            added |= m_visitedLinkHashes.add(linkHash).isNewEntry;
+    }
+
+    // One style invalidation for the whole batch rather than one per link
+    if (added)
+        invalidateStylesForAllLinks();
+}
+
 bool VisitedLinkStoreJava::isLinkVisited(Page& page, SharedStringHash linkHash, const URL&, const AtomString&)
 {
     populateVisitedLinksIfNeeded(page);
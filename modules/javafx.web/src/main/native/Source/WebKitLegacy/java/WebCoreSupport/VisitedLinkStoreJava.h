@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@
 
 #include <WebCore/SharedStringHash.h>
 #include <WebCore/VisitedLinkStore.h>
+#include <wtf/Vector.h>
 
 class VisitedLinkStoreJava final : public WebCore::VisitedLinkStore {
 public:
@@ -38,6 +39,11 @@ public:
 
     void addVisitedLink(const String& urlString);
 
+    // Bulk import and export of the visited link hashes, so that an
+    // application can persist history without a call per link
+    Vector<WebCore::SharedStringHash> visitedLinkHashes() const;
+    void addVisitedLinkHashes(const Vector<WebCore::SharedStringHash>&);
+
 private:
     VisitedLinkStoreJava();
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,7 @@
 #include "WebKitLegacy/Storage/StorageNamespaceImpl.h"
 #include "WebKitLegacy/Storage/WebDatabaseProvider.h"
 #include "WebKitVersion.h" //generated
+#include "WebPageCompositor.h"
 #include "WebPageConfig.h"
 #include <WebCore/WebCoreTestSupport.h>
 #include <JavaScriptCore/APICast.h>
@@ -64,6 +65,7 @@
 #include <WebCore/CookieJar.h>
 #include <WebCore/DeprecatedGlobalSettings.h>
 #include <WebCore/Document.h>
+#include <WebCore/JSDOMGlobalObject.h>
 #include <WebCore/DocumentInlines.h>
 #include <WebCore/DragController.h>
 #include <WebCore/DragData.h>
@@ -81,6 +83,7 @@
 #include <WebCore/GeolocationClientMock.h>
 #include <WebCore/GraphicsContext.h>
 #include <WebCore/GraphicsLayerTextureMapper.h>
+#include <WebCore/HTTPDiskCacheJava.h>
 #include <WebCore/InspectorController.h>
 #include <WebCore/KeyboardEvent.h>
 #include <WebCore/LogInitialization.h>
@@ -92,11 +95,13 @@
 #include <WebCore/PlatformJavaClasses.h>
 #include <WebCore/PlatformKeyboardEvent.h>
 #include <WebCore/PlatformMouseEvent.h>
+#include <WebCore/PlatformScreen.h>
 #include <WebCore/PlatformTouchEvent.h>
 #include <WebCore/PlatformWheelEvent.h>
 #include <WebCore/RenderTreeAsText.h>
 #include <WebCore/RenderView.h>
 #include <WebCore/ResourceRequest.h>
+#include <WebCore/ScriptBytecodeCacheJava.h>
 #include <WebCore/ScriptController.h>
 #include <WebCore/SecurityPolicy.h>
 #include <WebCore/Settings.h>
@@ -134,6 +139,9 @@
 
 namespace WebCore {
 
+// Set from the com.sun.webkit.useCompositorThread property
+static bool s_useCompositorThread;
+
 WebPage::WebPage(std::unique_ptr<Page> page)
     : m_page(WTFMove(page))
 {
@@ -146,7 +154,18 @@ WebPage::WebPage(std::unique_ptr<Page> page)
 
 WebPage::~WebPage()
 {
+    stopCompositor();
     debugEnded();
+    // Loads that are still around may keep the cache alive, but it must not
+    // write to the user data directory once the page has released it.
+    setDiskCache(nullptr);
+}
+
+void WebPage::setDiskCache(RefPtr<HTTPDiskCacheJava>&& diskCache)
+{
+    if (m_diskCache)
+        m_diskCache->close();
+    m_diskCache = WTFMove(diskCache);
 }
 
 WebPage* WebPage::webPageFromJObject(const JLObject& oWebPage)
@@ -251,6 +270,8 @@ RefPtr<RQRef> WebPage::jRenderTheme()
 void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
 {
     if (m_rootLayer) {
+        // Whatever Java wants repainted has to be composited again
+        m_externalDamage.unite(IntRect(x, y, w, h));
         return;
     }
 
@@ -297,13 +318,24 @@ void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
             m_syncLayers = false;
             syncLayers();
         }
-        renderCompositedLayers(gc, IntRect(x, y, w, h));
-        if (m_page->settings().showDebugBorders()) {
-            drawDebugLed(gc, IntRect(x, y, w, h), SRGBA<uint8_t> { 0, 192, 0, 128 });
+        // The highlight has to be drawn on top of the layers, so they are
+        // composited here for as long as it is shown
+        bool composeOnMainThread = !m_compositor || m_page->inspectorController().highlightedNode();
+        if (m_compositor) {
+            m_compositor->setSuspended(composeOnMainThread);
         }
-        if (downcast<GraphicsLayerTextureMapper>(m_rootLayer.get())->layer().descendantsOrSelfHaveRunningAnimations()) {
-            requestJavaRepaint(pageRect());
+        if (composeOnMainThread) {
+            renderCompositedLayers(gc, IntRect(x, y, w, h));
+            if (m_page->settings().showDebugBorders()) {
+                drawDebugLed(gc, IntRect(x, y, w, h), SRGBA<uint8_t> { 0, 192, 0, 128 });
+            }
+            if (downcast<GraphicsLayerTextureMapper>(m_rootLayer.get())->layer().descendantsOrSelfHaveRunningAnimations()) {
+                scheduleCompositing();
+            }
+        } else {
+            m_compositor->addDamage(m_externalDamage);
         }
+        m_externalDamage = { };
     }
 
     if (m_page->inspectorController().highlightedNode()) {
@@ -350,6 +382,20 @@ void WebPage::repaint(const IntRect& rect)
     requestJavaRepaint(rect);
 }
 
+void WebPage::scheduleCompositing()
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(
+            PG_GetWebPageClass(env),
+            "fwkScheduleCompositing",
+            "()V");
+    ASSERT(mid);
+
+    env->CallVoidMethod(jobjectFromPage(m_page.get()), mid);
+    WTF::CheckAndClearException(env);
+}
+
 void WebPage::requestJavaRepaint(const IntRect& rect)
 {
     JNIEnv* env = WTF::GetJavaEnv();
@@ -372,6 +418,8 @@ void WebPage::requestJavaRepaint(const IntRect& rect)
 
 void WebPage::setRootChildLayer(GraphicsLayer* layer)
 {
+    stopCompositor();
+
     if (layer) {
         m_rootLayer = GraphicsLayer::create(nullptr, *this);
         m_rootLayer->setDrawsContent(true);
@@ -381,12 +429,28 @@ void WebPage::setRootChildLayer(GraphicsLayer* layer)
         m_rootLayer->addChild(*layer);
 
         m_textureMapper = TextureMapper::create();
+
+        if (s_useCompositorThread) {
+            m_compositor = WebPageCompositor::create(jobjectFromPage(m_page.get()),
+                downcast<GraphicsLayerTextureMapper>(*m_rootLayer).layer(),
+                static_cast<TextureMapperJava&>(*m_textureMapper),
+                [this] { markForSync(); });
+            m_compositor->start();
+        }
     } else {
         m_rootLayer = nullptr;
         m_textureMapper.reset();
     }
 }
 
+void WebPage::stopCompositor()
+{
+    if (m_compositor) {
+        m_compositor->stop();
+        m_compositor = nullptr;
+    }
+}
+
 void WebPage::setNeedsOneShotDrawingSynchronization()
 {
 }
@@ -403,7 +467,8 @@ void WebPage::markForSync()
         return;
     }
     m_syncLayers = true;
-    requestJavaRepaint(pageRect());
+    // The commit tells which parts of the page change
+    scheduleCompositing();
 }
 
 void WebPage::syncLayers()
@@ -419,13 +484,21 @@ void WebPage::syncLayers()
         return;
 
     frameView->updateLayoutAndStyleIfNeededRecursive();
+
+    // The compositor thread, if any, doesn't paint while the tree is committed
+    Locker locker { TextureMapperJava::layerTreeLock() };
     // Updating layout might have taken us out of compositing mode
     if (m_rootLayer) {
         m_rootLayer->flushCompositingStateForThisLayerOnly();
     }
 
-    if (!frameView->flushCompositingStateIncludingSubframes())
-        return;
+    frameView->flushCompositingStateIncludingSubframes();
+
+    if (m_compositor && m_rootLayer) {
+        // Layer contents are painted here, the compositor thread only draws them
+        downcast<GraphicsLayerTextureMapper>(*m_rootLayer).updateBackingStoreIncludingSubLayers(*m_textureMapper);
+        m_compositor->didCommitLayerTree(pageRect());
+    }
 }
 
 IntRect WebPage::pageRect()
@@ -441,12 +514,21 @@ void WebPage::renderCompositedLayers(GraphicsContext& context, const IntRect& cl
 
     TextureMapperLayer& rootTextureMapperLayer = downcast<GraphicsLayerTextureMapper>(*m_rootLayer).layer();
 
+    Locker locker { TextureMapperJava::layerTreeLock() };
+    rootTextureMapperLayer.applyAnimationsRecursively(MonotonicTime::now());
+    downcast<GraphicsLayerTextureMapper>(*m_rootLayer).updateBackingStoreIncludingSubLayers(*m_textureMapper);
+
+    // The rest of the page is still in the Java back buffer
+    IntRect dirtyRect = enclosingIntRect(rootTextureMapperLayer.computeDamage());
+    dirtyRect.unite(m_externalDamage);
+    dirtyRect.intersect(clip);
+    if (dirtyRect.isEmpty())
+        return;
+
     static_cast<TextureMapperJava&>(*m_textureMapper).setGraphicsContext(&context);
     TransformationMatrix matrix;
     m_textureMapper->beginPainting();
-    m_textureMapper->beginClip(matrix, FloatRoundedRect(clip));
-    rootTextureMapperLayer.applyAnimationsRecursively(MonotonicTime::now());
-    downcast<GraphicsLayerTextureMapper>(*m_rootLayer).updateBackingStoreIncludingSubLayers(*m_textureMapper);
+    m_textureMapper->beginClip(matrix, FloatRoundedRect(dirtyRect));
     rootTextureMapperLayer.paint(*m_textureMapper);
     m_textureMapper->endClip();
     m_textureMapper->endPainting();
@@ -783,10 +865,40 @@ void WebPage::debugEnded() {
         enableWatchdog();
     }
 }
+// CPU time, in seconds, a script on the main thread may run before the
+// watchdog asks Java whether to terminate it. 0, the default, disables the
+// watchdog; the limit is only set from com.sun.webkit.scriptTimeLimit.
+static double s_scriptTimeLimit = 0;
+
+static bool shouldTerminateScript(JSContextRef context, void*)
+{
+    auto* globalObject = jsDynamicCast<JSDOMGlobalObject*>(toJS(context));
+    auto* document = globalObject ? dynamicDowncast<Document>(globalObject->scriptExecutionContext()) : nullptr;
+    Page* page = document ? document->page() : nullptr;
+    if (!page)
+        return true;
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(
+            PG_GetWebPageClass(env),
+            "fwkShouldTerminateScript",
+            "()Z");
+    ASSERT(mid);
+
+    jboolean terminate = env->CallBooleanMethod(WebPage::jobjectFromPage(page), mid);
+    if (WTF::CheckAndClearException(env))
+        return true;
+    return jbool_to_bool(terminate);
+}
+
 void WebPage::enableWatchdog() {
     if (globalDebugSessionCounter == 0) {
         JSContextGroupRef contextGroup = toRef(&mainThreadNormalWorld().vm());
-        JSContextGroupSetExecutionTimeLimit(contextGroup, 10, 0, 0);
+        if (s_scriptTimeLimit > 0)
+            JSContextGroupSetExecutionTimeLimit(contextGroup, s_scriptTimeLimit, shouldTerminateScript, nullptr);
+        else
+            JSContextGroupClearExecutionTimeLimit(contextGroup);
     }
 }
 
@@ -860,17 +972,53 @@ namespace {
 
 bool s_useJIT;
 bool s_useDFGJIT;
+bool s_useFTLJIT;
+bool s_useWebAssembly;
 bool s_useCSS3D;
 
+// Garbage collector settings, zero keeps the JavaScriptCore default
+unsigned s_gcMaxHeapSize;
+unsigned s_gcNurserySize;
+bool s_useConcurrentGC = true;
+bool s_useSmallHeap;
+
 }  // namespace
 
 extern "C" {
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInitWebCore
-    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useCSS3D) {
+    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useFTLJIT, jboolean useWebAssembly, jboolean useCSS3D, jboolean useCompositorThread) {
     s_useJIT = useJIT;
     s_useDFGJIT = useDFGJIT;
+    s_useFTLJIT = useFTLJIT;
+    s_useWebAssembly = useWebAssembly;
     s_useCSS3D = useCSS3D;
+    WebCore::s_useCompositorThread = useCompositorThread;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInitGarbageCollector
+    (JNIEnv*, jclass, jlong maxHeapSize, jlong nurserySize, jboolean useConcurrentGC, jboolean useSmallHeap)
+{
+    auto toOption = [] (jlong size) {
+        return static_cast<unsigned>(std::clamp<jlong>(size, 0, std::numeric_limits<unsigned>::max()));
+    };
+    s_gcMaxHeapSize = toOption(maxHeapSize);
+    s_gcNurserySize = toOption(nurserySize);
+    s_useConcurrentGC = useConcurrentGC;
+    s_useSmallHeap = useSmallHeap;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetScriptTimeLimit
+    (JNIEnv*, jclass, jdouble seconds)
+{
+    s_scriptTimeLimit = seconds;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetMaximumWorkerThreadCount
+    (JNIEnv*, jclass, jint count)
+{
+    ASSERT(count >= 0);
+    WorkerOrWorkletThread::setMaximumThreadCount(count);
 }
 
 JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
@@ -899,6 +1047,36 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
         JSC::Options::useJIT() = s_useJIT;
         // Enable DFG only if JIT is enabled.
         JSC::Options::useDFGJIT() = s_useJIT && s_useDFGJIT;
+#if ENABLE(FTL_JIT)
+        // FTL tiers up from DFG code.
+        JSC::Options::useFTLJIT() = JSC::Options::useDFGJIT() && s_useFTLJIT;
+#endif
+#if ENABLE(WEBASSEMBLY)
+        JSC::Options::useWebAssembly() = s_useJIT && s_useWebAssembly;
+        // The JVM owns SIGSEGV and SIGBUS, so bounds check wasm memory
+        // explicitly instead of relying on a fault handler and guard pages.
+        JSC::Options::useWebAssemblyFastMemory() = false;
+        JSC::Options::useWasmFaultSignalHandler() = false;
+#endif
+
+        // The options are read when the heap of the common VM is created,
+        // which happens after this.
+        JSC::Options::useConcurrentGC() = s_useConcurrentGC;
+        if (s_gcMaxHeapSize) {
+            // Collects whenever this much was allocated since the last
+            // collection, however large the heap has grown.
+            JSC::Options::gcMaxHeapSize() = s_gcMaxHeapSize;
+        }
+        if (s_useSmallHeap) {
+            // Size the heap like a small one and let it grow slowly.
+            JSC::Options::largeHeapSize() = JSC::Options::smallHeapSize();
+            JSC::Options::mediumHeapGrowthFactor() = JSC::Options::miniVMHeapGrowthFactor();
+            JSC::Options::largeHeapGrowthFactor() = JSC::Options::miniVMHeapGrowthFactor();
+        }
+        if (s_gcNurserySize) {
+            // Minimum allocation between eden collections.
+            JSC::Options::largeHeapSize() = s_gcNurserySize;
+        }
     });
 
     JLObject jlself(self, true);
@@ -963,6 +1141,12 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInit
     page->setDeviceScaleFactor(devicePixelScale);
 
     settings.setLinkPrefetchEnabled(true);
+    settings.setDNSPrefetchingEnabled(true);
+    // ImageDecoderJava can decode large images at a reduced size
+    settings.setImageSubsamplingEnabled(true);
+    // Throttle timers and suspend animations while the WebView is hidden
+    settings.setHiddenPageDOMTimerThrottlingEnabled(true);
+    settings.setHiddenPageCSSAnimationSuspensionEnabled(true);
 
         Frame* mainFrame = (Frame*)&page->mainFrame();
     auto* frame = dynamicDowncast<LocalFrame>(mainFrame);
@@ -973,9 +1157,6 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInit
 
     frame->init();
 
-    JSContextGroupRef contextGroup = toRef(&(mainThreadNormalWorld().vm()));
-    JSContextGroupSetExecutionTimeLimit(contextGroup, 10, 0, 0);
-
     WebPage::webPageFromJLong(pPage)->enableWatchdog();
 }
 
@@ -2373,6 +2554,26 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetEditable
     page->setEditable(jbool_to_bool(editable));
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetVisible
+    (JNIEnv*, jobject, jlong pPage, jboolean visible)
+{
+    Page* page = WebPage::pageFromJLong(pPage);
+    ASSERT(page);
+    if (!page) {
+        return;
+    }
+
+    // Focus and activation are driven through the FocusController directly,
+    // carry them over so that the new state does not reset them.
+    FocusController& focusController = page->focusController();
+    auto state = page->activityState();
+    state.set(ActivityState::WindowIsActive, focusController.isActive());
+    state.set(ActivityState::IsFocused, focusController.isFocused());
+    state.set({ ActivityState::IsVisible, ActivityState::IsVisibleOrOccluded }, jbool_to_bool(visible));
+    state.set(ActivityState::IsVisuallyIdle, !jbool_to_bool(visible));
+    page->setActivityState(state);
+}
+
 JNIEXPORT jstring JNICALL Java_com_sun_webkit_WebPage_twkGetHtml
     (JNIEnv* env, jobject self, jlong pFrame)
 {
@@ -2414,6 +2615,32 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetUsePageCache
     page->settings().setUsesBackForwardCache(jbool_to_bool(usePageCache));
 }
 
+JNIEXPORT jintArray JNICALL Java_com_sun_webkit_WebPage_twkGetVisitedLinkHashes
+    (JNIEnv* env, jobject, jlong pPage)
+{
+    ASSERT(pPage);
+    Page* page = WebPage::pageFromJLong(pPage);
+    ASSERT(page);
+    auto hashes = static_cast<VisitedLinkStoreJava&>(page->visitedLinkStore()).visitedLinkHashes();
+    jintArray result = env->NewIntArray(hashes.size());
+    if (!result || WTF::CheckAndClearException(env)) {
+        return nullptr;
+    }
+    env->SetIntArrayRegion(result, 0, hashes.size(), reinterpret_cast<const jint*>(hashes.data()));
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkAddVisitedLinkHashes
+    (JNIEnv* env, jobject, jlong pPage, jintArray jhashes)
+{
+    ASSERT(pPage);
+    Page* page = WebPage::pageFromJLong(pPage);
+    ASSERT(page);
+    Vector<SharedStringHash> hashes(env->GetArrayLength(jhashes));
+    env->GetIntArrayRegion(jhashes, 0, hashes.size(), reinterpret_cast<jint*>(hashes.data()));
+    static_cast<VisitedLinkStoreJava&>(page->visitedLinkStore()).addVisitedLinkHashes(hashes);
+}
+
 JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkIsJavaScriptEnabled
     (JNIEnv*, jobject, jlong pPage)
 {
@@ -2492,6 +2719,26 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetLocalStorageDatabasePat
         ->setLocalStorageDatabasePath(settings.localStorageDatabasePath());
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetIndexedDatabasePath
+  (JNIEnv* env, jobject, jstring path)
+{
+    WebDatabaseProvider::setIndexedDatabaseDirectoryPath(String(env, path));
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetBytecodeCachePath
+  (JNIEnv* env, jobject, jstring path)
+{
+    ScriptBytecodeCacheJava::setDirectory(String(env, path));
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetDiskCachePath
+  (JNIEnv* env, jobject, jlong pPage, jstring path, jlong capacity)
+{
+    WebPage* webPage = WebPage::webPageFromJLong(pPage);
+    ASSERT(webPage);
+    webPage->setDiskCache(HTTPDiskCacheJava::open(String(env, path), static_cast<uint64_t>(capacity)));
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetLocalStorageEnabled
   (JNIEnv*, jobject, jlong pPage, jboolean enabled)
 {
@@ -2558,6 +2805,7 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkDisconnectInspectorFronten
     InspectorController& ic = page->inspectorController();
     InspectorClientJava* icj = static_cast<InspectorClientJava*>(ic.inspectorClient());
     if (icj) {
+        icj->flushPendingMessages();
         ic.disconnectFrontend(*icj);
     }
 
@@ -2583,10 +2831,32 @@ JNIEXPORT jint JNICALL Java_com_sun_webkit_WebPage_twkWorkerThreadCount
     return WorkerThread::workerThreadCount();
 }
 
+JNIEXPORT jint JNICALL Java_com_sun_webkit_WebPage_twkGetDocumentCount
+    (JNIEnv*, jobject, jlong pPage)
+{
+    Page* page = WebPage::pageFromJLong(pPage);
+    ASSERT(page);
+    if (!page) {
+        return 0;
+    }
+
+    jint count = 0;
+    page->forEachDocument([&count] (Document&) {
+        ++count;
+    });
+    return count;
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkDoJSCGarbageCollection
   (JNIEnv*, jclass)
 {
     GCController::singleton().garbageCollectNow();
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkScreenChanged
+  (JNIEnv*, jclass)
+{
+    screenPropertiesChanged();
+}
+
 }
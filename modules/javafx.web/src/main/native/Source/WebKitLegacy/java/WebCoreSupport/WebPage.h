@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,12 +41,14 @@ namespace WebCore {
 class Frame;
 class GraphicsContext;
 class GraphicsLayer;
+class HTTPDiskCacheJava;
 class IntRect;
 class IntSize;
 class Node;
 class Page;
 class PlatformKeyboardEvent;
 class TextureMapper;
+class WebPageCompositor;
 
 class WebPage
     : GraphicsLayerClient
@@ -103,12 +105,17 @@ public:
 
     RefPtr<RQRef> jRenderTheme();
 
+    HTTPDiskCacheJava* diskCache() const { return m_diskCache.get(); }
+    void setDiskCache(RefPtr<HTTPDiskCacheJava>&&);
+
 private:
     void requestJavaRepaint(const IntRect&);
+    void scheduleCompositing();
     void markForSync();
     void syncLayers();
     IntRect pageRect();
     void renderCompositedLayers(GraphicsContext&, const IntRect&);
+    void stopCompositor();
 
     // GraphicsLayerClient
     void notifyAnimationStarted(const GraphicsLayer*, const String& /*animationKey*/, MonotonicTime /*time*/) override;
@@ -133,6 +140,10 @@ private:
 
     RefPtr<GraphicsLayer> m_rootLayer;
     std::unique_ptr<TextureMapper> m_textureMapper;
+    RefPtr<WebPageCompositor> m_compositor;
+    RefPtr<HTTPDiskCacheJava> m_diskCache;
+    // Repaints Java asked for since the layers were last composited
+    IntRect m_externalDamage;
     bool m_syncLayers { false };
 
     // Webkit expects keyPress events to be suppressed if the associated keyDown
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+
+#include "WebPageCompositor.h"
+
+#include <WebCore/PlatformContextJava.h>
+#include <WebCore/PlatformJavaClasses.h>
+#include <WebCore/TextureMapperJava.h>
+#include <WebCore/TextureMapperLayer.h>
+#include <WebCore/platform/graphics/java/GraphicsContextJava.h>
+#include <wtf/MainThread.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/java/JavaEnv.h>
+
+namespace WebCore {
+
+// Animations are ticked at the display rate. The Java side drops queued
+// frames that a newer one covers.
+static const Seconds s_frameInterval { 1_s / 60 };
+
+WebPageCompositor::WebPageCompositor(const JLObject& webPage, TextureMapperLayer& rootLayer,
+    TextureMapperJava& textureMapper, Function<void()>&& requestCommit)
+    : m_webPage(webPage)
+    , m_requestCommit(WTFMove(requestCommit))
+    , m_rootLayer(&rootLayer)
+    , m_textureMapper(&textureMapper)
+    , m_committedGeneration(TextureMapperJava::layerTreeGeneration())
+{
+    // Resolved here, the class loader can't be reached from the compositor thread
+    JNIEnv* env = WTF::GetJavaEnv();
+    m_createFrameMID = env->GetMethodID(PG_GetWebPageClass(env),
+        "fwkCreateCompositedFrame", "(IIII)Lcom/sun/webkit/graphics/WCRenderQueue;");
+    ASSERT(m_createFrameMID);
+    m_addFrameMID = env->GetMethodID(PG_GetWebPageClass(env),
+        "fwkAddCompositedFrame", "(Lcom/sun/webkit/graphics/WCRenderQueue;)V");
+    ASSERT(m_addFrameMID);
+}
+
+void WebPageCompositor::start()
+{
+    ASSERT(isMainThread());
+    ASSERT(!m_thread);
+
+    // The thread keeps the compositor alive until it has seen the stop
+    m_thread = Thread::create("WebCompositor", [protectedThis = Ref { *this }] {
+        protectedThis->run();
+    });
+    m_thread->detach();
+}
+
+void WebPageCompositor::stop()
+{
+    ASSERT(isMainThread());
+
+    // Not joined: the thread may be waiting for the page lock held by the caller.
+    // Once the pointers are cleared it won't touch the layer tree again.
+    {
+        Locker treeLocker { TextureMapperJava::layerTreeLock() };
+        m_rootLayer = nullptr;
+        m_textureMapper = nullptr;
+    }
+
+    Locker locker { m_lock };
+    m_stopped = true;
+    m_condition.notifyOne();
+}
+
+void WebPageCompositor::setSuspended(bool suspended)
+{
+    Locker locker { m_lock };
+    if (m_suspended == suspended)
+        return;
+
+    m_suspended = suspended;
+    m_frameRequested = true;
+    m_condition.notifyOne();
+}
+
+void WebPageCompositor::addDamage(const IntRect& rect)
+{
+    if (rect.isEmpty())
+        return;
+
+    Locker locker { m_lock };
+    m_externalDamage.unite(rect);
+    m_frameRequested = true;
+    m_condition.notifyOne();
+}
+
+void WebPageCompositor::didCommitLayerTree(const IntRect& pageRect)
+{
+    ASSERT(isMainThread());
+
+    m_committedGeneration = TextureMapperJava::layerTreeGeneration();
+    m_commitRequested = false;
+
+    Locker locker { m_lock };
+    m_pageRect = pageRect;
+    m_frameRequested = true;
+    m_condition.notifyOne();
+}
+
+void WebPageCompositor::run()
+{
+    WTF::AttachThreadAsDaemonToJavaEnv autoAttach;
+    JNIEnv* env = autoAttach.env();
+    if (!env) {
+        // The global reference can only be deleted by an attached thread
+        callOnMainThread([protectedThis = Ref { *this }] {
+            protectedThis->m_webPage.clear();
+        });
+        return;
+    }
+
+    renderFrames(env);
+
+    // The last reference to the compositor may be released once this thread
+    // has been detached, too late to delete the global reference then
+    m_webPage.clear();
+}
+
+void WebPageCompositor::renderFrames(JNIEnv* env)
+{
+    Locker locker { m_lock };
+    MonotonicTime nextFrameTime;
+    while (!m_stopped) {
+        if (m_suspended || (!m_frameRequested && !m_animating)) {
+            m_condition.wait(m_lock);
+            continue;
+        }
+        if (!m_frameRequested && MonotonicTime::now() < nextFrameTime) {
+            m_condition.waitUntil(m_lock, nextFrameTime);
+            continue;
+        }
+
+        m_frameRequested = false;
+        nextFrameTime = MonotonicTime::now() + s_frameInterval;
+        IntRect pageRect = m_pageRect;
+        IntRect externalDamage = std::exchange(m_externalDamage, { });
+
+        bool animating;
+        {
+            // The main thread must be able to request frames while this one is painted
+            DropLockForScope unlocker { locker };
+            animating = renderFrame(env, pageRect, externalDamage);
+        }
+        m_animating = animating;
+    }
+}
+
+bool WebPageCompositor::renderFrame(JNIEnv* env, const IntRect& pageRect, const IntRect& externalDamage)
+{
+    if (pageRect.isEmpty())
+        return false;
+
+    JLObject rq;
+    bool animating;
+    {
+        Locker treeLocker { TextureMapperJava::layerTreeLock() };
+        if (!m_rootLayer)
+            return false;
+
+        if (m_committedGeneration != TextureMapperJava::layerTreeGeneration()) {
+            // A layer went away since the last commit, wait for the next one
+            Locker locker { m_lock };
+            m_externalDamage.unite(externalDamage);
+            requestCommit();
+            return false;
+        }
+
+        TextureMapperLayer& rootLayer = *m_rootLayer;
+        rootLayer.applyAnimationsRecursively(MonotonicTime::now());
+        animating = rootLayer.descendantsOrSelfHaveRunningAnimations();
+
+        // Frames only cover what changed, the rest is kept in the Java back buffer
+        IntRect dirtyRect = enclosingIntRect(rootLayer.computeDamage());
+        dirtyRect.unite(externalDamage);
+        dirtyRect.intersect(pageRect);
+        if (dirtyRect.isEmpty())
+            return animating;
+
+        rq = JLObject(env->CallObjectMethod(m_webPage, m_createFrameMID,
+            dirtyRect.x(), dirtyRect.y(), dirtyRect.width(), dirtyRect.height()));
+        if (WTF::CheckAndClearException(env) || !rq)
+            return false;
+
+        // Will be deleted by GraphicsContext destructor
+        PlatformContextJava* ppgc = new PlatformContextJava(rq);
+        GraphicsContextJava gc(ppgc);
+
+        m_textureMapper->setGraphicsContext(&gc);
+        TransformationMatrix matrix;
+        m_textureMapper->beginPainting();
+        m_textureMapper->beginClip(matrix, FloatRoundedRect(dirtyRect));
+        rootLayer.paint(*m_textureMapper);
+        m_textureMapper->endClip();
+        m_textureMapper->endPainting();
+        m_textureMapper->setGraphicsContext(nullptr);
+
+        gc.platformContext()->rq().flushBuffer();
+    }
+
+    // Outside of the tree lock, the page lock is taken on the Java side
+    env->CallVoidMethod(m_webPage, m_addFrameMID, (jobject)rq);
+    WTF::CheckAndClearException(env);
+    return animating;
+}
+
+void WebPageCompositor::requestCommit()
+{
+    // Layers of another page may have bumped the generation, in which
+    // case nothing would ever commit this tree again by itself
+    if (m_commitRequested)
+        return;
+    m_commitRequested = true;
+
+    callOnMainThread([protectedThis = Ref { *this }] {
+        {
+            Locker locker { protectedThis->m_lock };
+            if (protectedThis->m_stopped)
+                return;
+        }
+        protectedThis->m_requestCommit();
+    });
+}
+
+} // namespace WebCore
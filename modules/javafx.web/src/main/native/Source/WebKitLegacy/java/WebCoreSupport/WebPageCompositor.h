@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <WebCore/IntRect.h>
+#include <wtf/Condition.h>
+#include <wtf/Function.h>
+#include <wtf/Lock.h>
+#include <wtf/Threading.h>
+#include <wtf/ThreadSafeRefCounted.h>
+#include <wtf/java/JavaRef.h>
+
+namespace WebCore {
+
+class TextureMapperJava;
+class TextureMapperLayer;
+
+// Composites the accelerated layers of a page on a thread of its own.
+// The main thread commits the layer tree and updates the backing stores
+// under TextureMapperJava::layerTreeLock(); in between, the compositor
+// thread applies the running animations and paints the tree into a render
+// queue it hands over to the Java WebPage as a complete frame.
+class WebPageCompositor final : public ThreadSafeRefCounted<WebPageCompositor> {
+public:
+    static Ref<WebPageCompositor> create(const JLObject& webPage, TextureMapperLayer& rootLayer,
+        TextureMapperJava& textureMapper, Function<void()>&& requestCommit)
+    {
+        return adoptRef(*new WebPageCompositor(webPage, rootLayer, textureMapper, WTFMove(requestCommit)));
+    }
+
+    // Main thread only.
+    void start();
+    void stop();
+    void setSuspended(bool);
+    // Repaints requested from the Java side, on top of what the layers changed
+    void addDamage(const IntRect&);
+
+    // Called on the main thread with the layer tree lock held, right after
+    // the tree and its backing stores were brought up to date.
+    void didCommitLayerTree(const IntRect& pageRect);
+
+private:
+    WebPageCompositor(const JLObject& webPage, TextureMapperLayer& rootLayer,
+        TextureMapperJava& textureMapper, Function<void()>&& requestCommit);
+
+    void run();
+    void renderFrames(JNIEnv*);
+    bool renderFrame(JNIEnv*, const IntRect& pageRect, const IntRect& externalDamage);
+    void requestCommit();
+
+    JGObject m_webPage;
+    jmethodID m_createFrameMID { nullptr };
+    jmethodID m_addFrameMID { nullptr };
+    Function<void()> m_requestCommit;
+
+    // Guarded by the layer tree lock.
+    TextureMapperLayer* m_rootLayer { nullptr };
+    TextureMapperJava* m_textureMapper { nullptr };
+    unsigned m_committedGeneration { 0 };
+    bool m_commitRequested { false };
+
+    Lock m_lock;
+    Condition m_condition;
+    RefPtr<Thread> m_thread;
+    IntRect m_pageRect WTF_GUARDED_BY_LOCK(m_lock);
+    IntRect m_externalDamage WTF_GUARDED_BY_LOCK(m_lock);
+    bool m_frameRequested WTF_GUARDED_BY_LOCK(m_lock) { false };
+    bool m_animating WTF_GUARDED_BY_LOCK(m_lock) { false };
+    bool m_suspended WTF_GUARDED_BY_LOCK(m_lock) { false };
+    bool m_stopped WTF_GUARDED_BY_LOCK(m_lock) { false };
+};
+
+} // namespace WebCore
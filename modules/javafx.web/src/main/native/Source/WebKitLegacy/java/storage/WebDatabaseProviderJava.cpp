@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,7 +25,24 @@
 
 #include "WebDatabaseProvider.h"
 
+#include <wtf/NeverDestroyed.h>
+
+static String& databaseDirectoryPath()
+{
+    static NeverDestroyed<String> path;
+    return path;
+}
+
+// An empty path keeps IndexedDB in memory. Otherwise the IDB server stores
+// each origin's databases in SQLite files below the path, on its own work
+// queue. The server is created on first use, so the path set at that time
+// is kept for the rest of the process.
+void WebDatabaseProvider::setIndexedDatabaseDirectoryPath(const String& path)
+{
+    databaseDirectoryPath() = path.isolatedCopy();
+}
+
 String WebDatabaseProvider::indexedDatabaseDirectoryPath()
 {
-    return ""_s;
+    return databaseDirectoryPath();
 }
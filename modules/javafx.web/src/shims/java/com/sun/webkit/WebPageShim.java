@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -46,6 +46,21 @@ public class WebPageShim {
         return WCBufferedContextShim.createBufferedContext(w, h);
     }
 
+    public static void update(WebPage page, int x, int y, int w, int h) {
+        page.setBounds(x, y, w, h);
+        page.updateContent(new WCRectangle(x, y, w, h));
+    }
+
+    // Same as the request WebPage.paint() makes when the back buffer is lost
+    public static void redrawAll(WebPage page) {
+        WebPage.lockPage();
+        try {
+            page.redrawAll();
+        } finally {
+            WebPage.unlockPage();
+        }
+    }
+
     public static BufferedImage paint(WebPage page, int x, int y, int w, int h) {
         final WCGraphicsContext gc = setupPageWithGraphics(page, x, y, w, h);
         PrismInvokerShim.runOnRenderThread(() -> {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -23,44 +23,17 @@
  * questions.
  */
 
-#include "config.h"
-#include "RunLoop.h"
+package com.sun.webkit.network;
 
-namespace WTF {
+import java.util.function.Consumer;
 
-// JDK-8146878
-//XXX: implement these stubs?
+public class NetworkContextShim {
 
-RunLoop::RunLoop() {}
-RunLoop::~RunLoop() {}
+    public static boolean prefetchDNS(String hostname, Runnable done) {
+        return NetworkContext.prefetchDNS(hostname, done);
+    }
 
-void RunLoop::TimerBase::fired() {}
-
-void RunLoop::run() {}
-void RunLoop::stop() {}
-void RunLoop::wakeUp() {}
-
-RunLoop::TimerBase::TimerBase(RunLoop& runLoop)
-    : m_runLoop(runLoop)
-{
-}
-
-RunLoop::TimerBase::~TimerBase()
-{
-    stop();
-}
-
-void RunLoop::TimerBase::start(double fireInterval, bool repeat)
-{
+    public static void resolveDNS(String hostname, Consumer<String[]> callback) {
+        NetworkContext.resolveDNS(hostname, callback);
+    }
 }
-
-void RunLoop::TimerBase::stop()
-{
-}
-
-bool RunLoop::TimerBase::isActive() const
-{
-  return true;
-}
-
-} // namespace WTF
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.webkit.network;
+
+import com.sun.webkit.network.NetworkContextShim;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicReference;
+import org.junit.Test;
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertNull;
+import static org.junit.Assert.assertTrue;
+
+public class DNSResolveTest {
+
+    private static final long TIMEOUT = 30;
+
+    private static String[] resolve(String hostname) throws Exception {
+        CompletableFuture<String[]> result = new CompletableFuture<>();
+        AtomicReference<String> threadName = new AtomicReference<>();
+        NetworkContextShim.resolveDNS(hostname, addresses -> {
+            threadName.set(Thread.currentThread().getName());
+            result.complete(addresses);
+        });
+        String[] addresses = result.get(TIMEOUT, TimeUnit.SECONDS);
+        assertTrue("Resolved on a resolver thread",
+                threadName.get().startsWith("DNS-Resolver-"));
+        return addresses;
+    }
+
+    @Test
+    public void testResolveAddressLiteral() throws Exception {
+        assertArrayEquals(new String[] {"127.0.0.1"}, resolve("127.0.0.1"));
+    }
+
+    @Test
+    public void testResolveUnknownHost() throws Exception {
+        // The .invalid top level domain never resolves, see RFC 2606
+        assertNull(resolve("host.invalid"));
+    }
+
+    @Test
+    public void testPrefetch() throws Exception {
+        CompletableFuture<Void> done = new CompletableFuture<>();
+        assertTrue("Prefetch queued",
+                NetworkContextShim.prefetchDNS("127.0.0.1", () -> done.complete(null)));
+        done.get(TIMEOUT, TimeUnit.SECONDS);
+    }
+}
@@ -33,6 +33,7 @@ import java.io.PrintStream;
 import java.util.Base64;
 import javax.imageio.ImageIO;
 
+import com.sun.webkit.graphics.WCRenderQueue;
 import netscape.javascript.JSObject;
 import org.junit.After;
 import org.junit.Test;
@@ -245,6 +246,64 @@ public class CanvasTest extends TestBase {
         assertTrue("Color should be transparent black:" + pixelAt75x25, isColorsSimilar(Color.BLACK, pixelAt75x25, 1));
     }
 
+    // Draws enough commands to span several native render queue buffers,
+    // so recycled (pooled) buffers are decoded as well.
+    @Test
+    public void testCanvasManyBuffers() {
+        final String htmlCanvasContent =
+                "<canvas id='canvas' width='100' height='100'></canvas> <script>" +
+                "var ctx = document.getElementById('canvas').getContext('2d');" +
+                "for (var j = 0; j < 4; j++) {" +
+                "    for (var i = 0; i < 10000; i++) {" +
+                "        ctx.fillStyle = (i % 2) ? 'blue' : 'green';" +
+                "        ctx.fillRect(i % 100, 0, 1, 100);" +
+                "    }" +
+                "    ctx.getImageData(0, 0, 1, 1);" +
+                "}" +
+                "ctx.fillStyle = 'red';" +
+                "ctx.fillRect(0, 0, 100, 100);" +
+                "</script>";
+
+        loadContent(htmlCanvasContent);
+        submit(() -> {
+            assertEquals("Canvas must be red", 255,
+                    (int) getEngine().executeScript("document.getElementById('canvas').getContext('2d').getImageData(50,50,1,1).data[0]"));
+            final long[] counters = WCRenderQueue.getBufferPoolCounters();
+            assertTrue("Render queue buffers must have been allocated", counters[WCRenderQueue.POOL_ALLOCATED] > 0);
+        });
+    }
+
+    // Repaints of the same canvas take their buffers from the pool of its
+    // render queue instead of allocating new ones.
+    @Test
+    public void testCanvasBufferPooling() {
+        final int ROUNDS = 20;
+        final String paint =
+                "var ctx = document.getElementById('canvas').getContext('2d');" +
+                "ctx.fillStyle = (ctx.fillStyle == '#0000ff') ? 'green' : 'blue';" +
+                "ctx.fillRect(0, 0, 100, 100);" +
+                "ctx.getImageData(0, 0, 1, 1);";
+
+        loadContent("<canvas id='canvas' width='100' height='100'></canvas>");
+        // The first paint fills the pool
+        executeScript(paint);
+
+        final long[] before = WCRenderQueue.getBufferPoolCounters();
+        for (int i = 0; i < ROUNDS; i++) {
+            // Each round runs separately on the FX thread, after the buffers
+            // of the previous one have been released
+            executeScript(paint);
+        }
+        final long[] after = WCRenderQueue.getBufferPoolCounters();
+
+        final long reused = after[WCRenderQueue.POOL_REUSED] - before[WCRenderQueue.POOL_REUSED];
+        final long allocated = after[WCRenderQueue.POOL_ALLOCATED] - before[WCRenderQueue.POOL_ALLOCATED];
+        assertTrue("Repaints must reuse pooled buffers, reused: " + reused,
+                reused >= ROUNDS / 2);
+        assertTrue("Repaints must not keep allocating buffers, allocated: " + allocated,
+                allocated <= ROUNDS / 4);
+    }
+
     @After
     public void resetSystemErr() {
         System.setErr(ERR);
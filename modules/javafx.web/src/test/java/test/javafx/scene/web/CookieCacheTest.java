@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.net.httpserver.HttpServer;
+import com.sun.webkit.network.CookieJarShim;
+import com.sun.webkit.network.CookieManager;
+import java.io.IOException;
+import java.io.OutputStream;
+import java.net.CookieHandler;
+import java.net.InetAddress;
+import java.net.InetSocketAddress;
+import java.nio.charset.StandardCharsets;
+import org.junit.After;
+import org.junit.AfterClass;
+import static org.junit.Assert.assertEquals;
+import org.junit.Before;
+import org.junit.BeforeClass;
+import org.junit.Test;
+
+public class CookieCacheTest extends TestBase {
+
+    private static HttpServer server;
+
+    private CookieHandler savedHandler;
+
+    @BeforeClass
+    public static void beforeClass() throws IOException {
+        server = HttpServer.create(
+                new InetSocketAddress(InetAddress.getLoopbackAddress(), 0), 0);
+        server.createContext("/", exchange -> {
+            byte[] body = "<html><body>cookies</body></html>"
+                    .getBytes(StandardCharsets.UTF_8);
+            exchange.getResponseHeaders().set("Content-Type", "text/html; charset=utf-8");
+            exchange.sendResponseHeaders(200, body.length);
+            try (OutputStream out = exchange.getResponseBody()) {
+                out.write(body);
+            }
+        });
+        server.start();
+    }
+
+    @AfterClass
+    public static void afterClass() {
+        server.stop(0);
+    }
+
+    @Before
+    public void before() {
+        savedHandler = CookieHandler.getDefault();
+        CookieHandler.setDefault(new CookieManager());
+        load("http://" + server.getAddress().getHostString() + ":"
+                + server.getAddress().getPort() + "/");
+    }
+
+    @After
+    public void after() {
+        CookieHandler.setDefault(savedHandler);
+    }
+
+    @Test
+    public void testCachedReads() {
+        setCookie("a=1");
+        assertEquals("a=1", getCookies());
+        int lookups = CookieJarShim.test_getLookupCount();
+        for (int i = 0; i < 10; i++) {
+            assertEquals("a=1", getCookies());
+        }
+        assertEquals("Lookups of unchanged cookies",
+                lookups, CookieJarShim.test_getLookupCount());
+    }
+
+    @Test
+    public void testInvalidationOnPut() {
+        setCookie("a=1");
+        assertEquals("a=1", getCookies());
+        setCookie("b=2");
+        assertEquals("a=1; b=2", getCookies());
+    }
+
+    @Test
+    public void testInvalidationOnExpiry() throws InterruptedException {
+        setCookie("a=1");
+        setCookie("b=2; max-age=1");
+        assertEquals("a=1; b=2", getCookies());
+        Thread.sleep(1500);
+        assertEquals("a=1", getCookies());
+    }
+
+    @Test
+    public void testHandlerSwitch() {
+        setCookie("a=1");
+        assertEquals("a=1", getCookies());
+
+        CookieManager other = new CookieManager();
+        CookieHandler.setDefault(other);
+        assertEquals("Cookies from the new handler", "", getCookies());
+        setCookie("b=2");
+        assertEquals("b=2", getCookies());
+
+        // Handlers other than the WebKit cookie manager are never cached
+        java.net.CookieManager external = new java.net.CookieManager();
+        CookieHandler.setDefault(external);
+        assertEquals("", getCookies());
+        int lookups = CookieJarShim.test_getLookupCount();
+        assertEquals("", getCookies());
+        assertEquals("Lookups through another handler",
+                lookups + 1, CookieJarShim.test_getLookupCount());
+
+        CookieHandler.setDefault(other);
+        assertEquals("b=2", getCookies());
+    }
+
+    private void setCookie(String cookie) {
+        executeScript("document.cookie = '" + cookie + "'");
+    }
+
+    private String getCookies() {
+        return (String) executeScript("document.cookie");
+    }
+}
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.net.httpserver.HttpExchange;
+import com.sun.net.httpserver.HttpServer;
+import com.sun.webkit.MemoryCache;
+import java.io.File;
+import java.io.IOException;
+import java.io.OutputStream;
+import java.net.InetAddress;
+import java.net.InetSocketAddress;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.atomic.AtomicInteger;
+import javafx.beans.value.ChangeListener;
+import javafx.beans.value.ObservableValue;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebEngineShim;
+import org.junit.After;
+import org.junit.AfterClass;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import org.junit.Before;
+import org.junit.BeforeClass;
+import org.junit.Test;
+
+public class DiskCacheTest extends TestBase {
+
+    static {
+        // Read once, when the first page is created
+        System.setProperty("com.sun.webkit.diskCache", "true");
+    }
+
+    private static final File FOO = new File("build/diskcache/foo");
+    private static final File BAR = new File("build/diskcache/bar");
+
+    private static final String ETAG = "\"v1\"";
+
+    private static HttpServer server;
+    private static final Map<String, AtomicInteger> requests = new ConcurrentHashMap<>();
+    private static final Map<String, AtomicInteger> notModified = new ConcurrentHashMap<>();
+
+    private final ArrayList<WebEngine> createdWebEngines = new ArrayList<>();
+
+    @BeforeClass
+    public static void beforeClass() throws IOException {
+        server = HttpServer.create(
+                new InetSocketAddress(InetAddress.getLoopbackAddress(), 0), 0);
+        // Fresh for an hour
+        for (String path : new String[] {"/fresh", "/isolated"}) {
+            server.createContext(path, exchange -> {
+                exchange.getResponseHeaders().set("Cache-Control", "max-age=3600");
+                respond(exchange);
+            });
+        }
+        // Stored, but revalidated on every use
+        server.createContext("/validated", exchange -> {
+            exchange.getResponseHeaders().set("Cache-Control", "no-cache");
+            exchange.getResponseHeaders().set("ETag", ETAG);
+            if (ETAG.equals(exchange.getRequestHeaders().getFirst("If-None-Match"))) {
+                count(notModified, exchange);
+                count(requests, exchange);
+                exchange.sendResponseHeaders(304, -1);
+                exchange.close();
+                return;
+            }
+            respond(exchange);
+        });
+        server.start();
+    }
+
+    private static void count(Map<String, AtomicInteger> counts, HttpExchange exchange) {
+        counts.computeIfAbsent(exchange.getRequestURI().getPath(),
+                path -> new AtomicInteger()).incrementAndGet();
+    }
+
+    private static int count(Map<String, AtomicInteger> counts, String path) {
+        AtomicInteger count = counts.get(path);
+        return count != null ? count.get() : 0;
+    }
+
+    private static void respond(HttpExchange exchange) throws IOException {
+        count(requests, exchange);
+        byte[] body = ("<html><body>" + exchange.getRequestURI().getPath()
+                + "</body></html>").getBytes(StandardCharsets.UTF_8);
+        exchange.getResponseHeaders().set("Content-Type", "text/html; charset=utf-8");
+        exchange.sendResponseHeaders(200, body.length);
+        try (OutputStream out = exchange.getResponseBody()) {
+            out.write(body);
+        }
+    }
+
+    @AfterClass
+    public static void afterClass() throws IOException {
+        server.stop(0);
+        deleteRecursively(FOO.getParentFile());
+    }
+
+    @Before
+    public void before() {
+        // Resources must come from the disk cache, not from the memory cache
+        submit(() -> MemoryCache.setCapacity(0));
+    }
+
+    @After
+    public void after() {
+        for (WebEngine webEngine : createdWebEngines) {
+            dispose(webEngine);
+        }
+    }
+
+    @Test
+    public void testCacheHit() {
+        String url = url("/fresh");
+        // Disposing the engine writes the cache to the disk
+        WebEngine first = createWebEngine(FOO);
+        load(first, url);
+        assertEquals("/fresh", text(first));
+        dispose(first);
+
+        WebEngine second = createWebEngine(FOO);
+        load(second, url);
+        assertEquals("/fresh", text(second));
+        assertEquals("Requests for a fresh response", 1, count(requests, "/fresh"));
+    }
+
+    @Test
+    public void testRevalidation() {
+        String url = url("/validated");
+        WebEngine first = createWebEngine(FOO);
+        load(first, url);
+        dispose(first);
+
+        WebEngine second = createWebEngine(FOO);
+        load(second, url);
+        assertEquals("/validated", text(second));
+        assertEquals("Requests for a stored response", 2, count(requests, "/validated"));
+        assertEquals("Not modified responses", 1, count(notModified, "/validated"));
+    }
+
+    @Test
+    public void testEnginesDoNotShareCache() {
+        String url = url("/isolated");
+        WebEngine foo = createWebEngine(FOO);
+        load(foo, url);
+        dispose(foo);
+
+        WebEngine bar = createWebEngine(BAR);
+        load(bar, url);
+        assertEquals("/isolated", text(bar));
+        assertEquals("Requests from engines with different directories",
+                2, count(requests, "/isolated"));
+        File[] barEntries = new File(BAR, "httpcache").listFiles();
+        assertTrue("Response stored in the directory of the engine",
+                barEntries != null && barEntries.length > 0);
+    }
+
+    private static String url(String path) {
+        return "http://" + server.getAddress().getHostString() + ":"
+                + server.getAddress().getPort() + path;
+    }
+
+    private WebEngine createWebEngine(File userDataDirectory) {
+        WebEngine result = submit(() -> {
+            WebEngine webEngine = new WebEngine();
+            webEngine.setUserDataDirectory(userDataDirectory);
+            return webEngine;
+        });
+        createdWebEngines.add(result);
+        return result;
+    }
+
+    private String text(WebEngine webEngine) {
+        return submit(() -> (String) webEngine.executeScript("document.body.textContent"));
+    }
+
+    private void load(final WebEngine webEngine, final String url) {
+        final CountDownLatch latch = new CountDownLatch(1);
+        submit(() -> {
+            webEngine.getLoadWorker().runningProperty().addListener(
+                    new ChangeListener<Boolean>() {
+                        @Override public void changed(
+                                ObservableValue<? extends Boolean> ov,
+                                Boolean oldValue, Boolean newValue)
+                        {
+                            if (!newValue) {
+                                latch.countDown();
+                            }
+                        }
+                    });
+            webEngine.load(url);
+        });
+        try {
+            latch.await();
+        } catch (InterruptedException ex) {
+            throw new AssertionError(ex);
+        }
+    }
+
+    private void dispose(final WebEngine webEngine) {
+        submit(() -> {
+            WebEngineShim.dispose(webEngine);
+        });
+    }
+
+    private static void deleteRecursively(File file) throws IOException {
+        if (file.isDirectory()) {
+            for (File f : file.listFiles()) {
+                deleteRecursively(f);
+            }
+        }
+        if (!file.delete()) {
+            file.deleteOnExit();
+        }
+    }
+}
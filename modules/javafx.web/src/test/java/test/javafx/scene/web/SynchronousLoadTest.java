@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.SynchronousLoad;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.CompletableFuture;
+import javafx.application.Platform;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+import org.junit.Test;
+
+public class SynchronousLoadTest extends TestBase {
+
+    @Test
+    public void testTasksAreDeferredInOrder() {
+        final List<String> log = new ArrayList<>();
+        submit(() -> {
+            CompletableFuture<Void> load = new CompletableFuture<>();
+            // Runs in the nested event loop, as the callbacks of other loads do
+            Platform.runLater(() -> {
+                assertTrue(SynchronousLoad.isInProgress());
+                SynchronousLoad.runOrDefer(() -> log.add("first"));
+                SynchronousLoad.runOrDefer(() -> log.add("second"));
+                log.add("load");
+                load.complete(null);
+            });
+            SynchronousLoad.waitFor(load);
+
+            assertFalse(SynchronousLoad.isInProgress());
+            // The caller of the load returns before the deferred tasks run,
+            // and tasks given meanwhile run after them
+            SynchronousLoad.runOrDefer(() -> log.add("third"));
+            assertEquals(List.of("load"), log);
+        });
+        // The deferred tasks were posted before this job
+        submit(() -> {
+            assertEquals(List.of("load", "first", "second", "third"), log);
+            SynchronousLoad.runOrDefer(() -> log.add("now"));
+            assertEquals("Tasks run in place with no load in progress",
+                    List.of("load", "first", "second", "third", "now"), log);
+        });
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,7 +30,9 @@ import com.sun.webkit.WebPageShim;
 import javafx.scene.web.WebEngineShim;
 
 import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
 import static org.junit.Assert.assertNull;
+import static org.junit.Assert.assertTrue;
 import org.junit.Test;
 
 public class WebPageTest extends TestBase {
@@ -83,6 +85,28 @@ public class WebPageTest extends TestBase {
         });
     }
 
+    @Test public void testRedrawAfterBackBufferLoss() {
+        final WebPage page = WebEngineShim.getPage(getEngine());
+        loadContent("<body style='background-color: red'>" + HTML + "</body>");
+        submit(() -> {
+            // The second update flushes what the layout of the first one
+            // invalidated
+            WebPageShim.update(page, 0, 0, 800, 600);
+            WebPageShim.update(page, 0, 0, 800, 600);
+            assertFalse("Page is dirty after update", page.isDirty());
+
+            long replayed = page.getStatistics().getReplayedFrames();
+            WebPageShim.redrawAll(page);
+            assertTrue("Page is dirty after the back buffer was lost",
+                    page.isDirty());
+
+            WebPageShim.update(page, 0, 0, 800, 600);
+            assertFalse("Page is dirty after redraw", page.isDirty());
+            assertEquals("Retained queues replayed", replayed + 1,
+                    page.getStatistics().getReplayedFrames());
+        });
+    }
+
     // JDK-8196011
     @Test public void testICUTagParse() {
         load(WebPageTest.class.getClassLoader().getResource(
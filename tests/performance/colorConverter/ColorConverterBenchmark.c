@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * Standalone benchmark of the jfxmedia YCbCr to RGB conversions. It times
+ * each conversion on a frame of random data and, on x86, runs it once with
+ * and once without the AVX2 functions and checks both give the same pixels.
+ * It exits with status 2 if they do not. Rows are padded to ALIGNMENT bytes,
+ * as the SSE2 functions store to aligned addresses.
+ *
+ * Build and run from the top of the repository, for example on Linux:
+ *
+ *   gcc -O2 -DLINUX -Imodules/javafx.media/src/main/native/jfxmedia \
+ *       tests/performance/colorConverter/ColorConverterBenchmark.c -o ccbench
+ *   ./ccbench [width height frames]
+ */
+
+#include <Utils/ColorConverter.c>
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define ALIGNMENT 32
+
+typedef struct {
+    int32_t width;
+    int32_t height;
+    int32_t frames;
+    int32_t yStride;
+    int32_t uvStride;
+    int32_t uyvyStride;
+    int32_t dstStride;
+    uint8_t *y;
+    uint8_t *u;
+    uint8_t *v;
+    uint8_t *a;
+    uint8_t *uyvy;
+    uint8_t *dst;
+    uint8_t *ref;
+} Frame;
+
+typedef int (*Convert)(Frame *frame, uint8_t *dst);
+
+static int argb420(Frame *f, uint8_t *dst)
+{
+    return ColorConvert_YCbCr420p_to_ARGB32(dst, f->dstStride, f->width, f->height,
+                                            f->y, f->v, f->u, f->a,
+                                            f->yStride, f->uvStride, f->uvStride, f->yStride);
+}
+
+static int argb420NoAlpha(Frame *f, uint8_t *dst)
+{
+    return ColorConvert_YCbCr420p_to_ARGB32_no_alpha(dst, f->dstStride, f->width, f->height,
+                                                     f->y, f->v, f->u,
+                                                     f->yStride, f->uvStride, f->uvStride);
+}
+
+static int bgra420(Frame *f, uint8_t *dst)
+{
+    return ColorConvert_YCbCr420p_to_BGRA32(dst, f->dstStride, f->width, f->height,
+                                            f->y, f->v, f->u, f->a,
+                                            f->yStride, f->uvStride, f->uvStride, f->yStride);
+}
+
+static int bgra420NoAlpha(Frame *f, uint8_t *dst)
+{
+    return ColorConvert_YCbCr420p_to_BGRA32_no_alpha(dst, f->dstStride, f->width, f->height,
+                                                     f->y, f->v, f->u,
+                                                     f->yStride, f->uvStride, f->uvStride);
+}
+
+static int argb422NoAlpha(Frame *f, uint8_t *dst)
+{
+    return ColorConvert_YCbCr422p_to_ARGB32_no_alpha(dst, f->dstStride, f->width, f->height,
+                                                     f->uyvy + 1, f->uyvy + 2, f->uyvy,
+                                                     f->uyvyStride, f->uyvyStride);
+}
+
+static int bgra422NoAlpha(Frame *f, uint8_t *dst)
+{
+    return ColorConvert_YCbCr422p_to_BGRA32_no_alpha(dst, f->dstStride, f->width, f->height,
+                                                     f->uyvy + 1, f->uyvy + 2, f->uyvy,
+                                                     f->uyvyStride, f->uyvyStride);
+}
+
+static const struct {
+    const char *name;
+    Convert convert;
+} conversions[] = {
+    { "YCbCr420p_to_ARGB32", argb420 },
+    { "YCbCr420p_to_ARGB32_no_alpha", argb420NoAlpha },
+    { "YCbCr420p_to_BGRA32", bgra420 },
+    { "YCbCr420p_to_BGRA32_no_alpha", bgra420NoAlpha },
+    { "YCbCr422p_to_ARGB32_no_alpha", argb422NoAlpha },
+    { "YCbCr422p_to_BGRA32_no_alpha", bgra422NoAlpha },
+};
+
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static int32_t alignStride(int32_t stride)
+{
+    return (stride + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+}
+
+static uint8_t *allocRandom(size_t size)
+{
+    uint8_t *p = aligned_alloc(ALIGNMENT, (size + ALIGNMENT - 1) & ~(size_t)(ALIGNMENT - 1));
+    size_t i;
+
+    if (p == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (i = 0; i < size; i++) {
+        p[i] = (uint8_t)rand();
+    }
+    return p;
+}
+
+/*
+ * Returns the average time of one conversion in milliseconds, or a negative
+ * value if the conversion failed.
+ */
+static double run(Frame *f, Convert convert, uint8_t *dst)
+{
+    double start;
+    int32_t i;
+
+    // warm up, and make sure the conversion is supported
+    if (convert(f, dst) != 0) {
+        return -1.0;
+    }
+
+    start = now();
+    for (i = 0; i < f->frames; i++) {
+        convert(f, dst);
+    }
+    return (now() - start) / f->frames;
+}
+
+#if ENABLE_SIMD_AVX2
+static int sameRows(Frame *f)
+{
+    int32_t j;
+
+    for (j = 0; j < f->height; j++) {
+        if (memcmp(f->ref + (size_t)j * f->dstStride,
+                   f->dst + (size_t)j * f->dstStride, (size_t)f->width * 4) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+#endif
+
+int main(int argc, char **argv)
+{
+    Frame f;
+    size_t dstSize;
+    size_t i;
+    int status = 0;
+
+    f.width = argc > 2 ? atoi(argv[1]) : 1920;
+    f.height = argc > 2 ? atoi(argv[2]) : 1080;
+    f.frames = argc > 3 ? atoi(argv[3]) : 200;
+    if (f.width <= 0 || f.height <= 0 || f.frames <= 0 || ((f.width | f.height) & 1)) {
+        fprintf(stderr, "Usage: %s [width height [frames]], width and height even\n", argv[0]);
+        return 1;
+    }
+
+    f.yStride = alignStride(f.width);
+    f.uvStride = alignStride(f.width / 2);
+    f.uyvyStride = alignStride(f.width * 2);
+    f.dstStride = alignStride(f.width * 4);
+
+    dstSize = (size_t)f.dstStride * f.height;
+    f.y = allocRandom((size_t)f.yStride * f.height);
+    f.u = allocRandom((size_t)f.uvStride * f.height / 2);
+    f.v = allocRandom((size_t)f.uvStride * f.height / 2);
+    f.a = allocRandom((size_t)f.yStride * f.height);
+    f.uyvy = allocRandom((size_t)f.uyvyStride * f.height);
+    f.dst = allocRandom(dstSize);
+    f.ref = allocRandom(dstSize);
+
+    printf("%dx%d, %d frames\n", f.width, f.height, f.frames);
+    for (i = 0; i < sizeof(conversions) / sizeof(conversions[0]); i++) {
+        double ms;
+#if ENABLE_SIMD_AVX2
+        int avx2 = ColorConvert_HasAVX2();
+        double msBaseline;
+
+        color_hasAVX2 = 0;
+        msBaseline = run(&f, conversions[i].convert, f.ref);
+        color_hasAVX2 = avx2;
+        ms = run(&f, conversions[i].convert, f.dst);
+        if (msBaseline < 0.0) {
+            printf("%-30s not supported\n", conversions[i].name);
+        } else if (!avx2) {
+            printf("%-30s %8.3f ms/frame (no AVX2)\n", conversions[i].name, msBaseline);
+        } else {
+            int same = sameRows(&f);
+
+            printf("%-30s %8.3f ms/frame, AVX2 %8.3f ms/frame, %.2fx%s\n",
+                   conversions[i].name, msBaseline, ms, msBaseline / ms,
+                   same ? "" : " (output differs)");
+            if (!same) {
+                status = 2;
+            }
+        }
+#else
+        ms = run(&f, conversions[i].convert, f.dst);
+        if (ms < 0.0) {
+            printf("%-30s not supported\n", conversions[i].name);
+        } else {
+            printf("%-30s %8.3f ms/frame\n", conversions[i].name, ms);
+        }
+#endif
+    }
+
+    return status;
+}
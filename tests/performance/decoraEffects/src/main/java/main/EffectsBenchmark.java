@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package main;
+
+import java.util.List;
+import java.util.function.Supplier;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.Group;
+import javafx.scene.Node;
+import javafx.scene.Scene;
+import javafx.scene.SnapshotParameters;
+import javafx.scene.effect.BlurType;
+import javafx.scene.effect.BoxBlur;
+import javafx.scene.effect.DropShadow;
+import javafx.scene.effect.Effect;
+import javafx.scene.effect.GaussianBlur;
+import javafx.scene.effect.InnerShadow;
+import javafx.scene.image.WritableImage;
+import javafx.scene.paint.Color;
+import javafx.scene.shape.Circle;
+import javafx.scene.shape.Rectangle;
+import javafx.stage.Stage;
+
+/**
+ * Measures the software Decora filters by repeatedly taking a snapshot
+ * of a large node with an effect applied.
+ * <p>
+ * Run with {@code -Dprism.order=sw} so that the effects are rendered by the
+ * SSE peers, and {@code -Ddecora.simd.kernels=scalar|sse4.1|avx2|neon} to
+ * compare the native kernel sets against each other.
+ */
+public class EffectsBenchmark extends Application {
+
+    private static final int SIZE = 1024;
+    private static final int WARMUP = 10;
+    private static final int ITERATIONS = 50;
+
+    private record Case(String name, Supplier<Effect> effect) {}
+
+    private static final List<Case> CASES = List.of(
+        new Case("GaussianBlur(10)", () -> new GaussianBlur(10)),
+        new Case("GaussianBlur(40)", () -> new GaussianBlur(40)),
+        new Case("BoxBlur(11x11x3)", () -> new BoxBlur(11, 11, 3)),
+        new Case("DropShadow(gaussian 20)", () -> new DropShadow(20, 8, 8, Color.BLACK)),
+        new Case("DropShadow(three-pass box 20)", () -> {
+            DropShadow ds = new DropShadow(20, 8, 8, Color.DARKBLUE);
+            ds.setBlurType(BlurType.THREE_PASS_BOX);
+            return ds;
+        }),
+        new Case("InnerShadow(gaussian 20)", () -> new InnerShadow(20, Color.BLACK))
+    );
+
+    @Override
+    public void start(Stage stage) {
+        Node content = createContent();
+        Group root = new Group(content);
+        stage.setScene(new Scene(root, 400, 400));
+        stage.show();
+
+        String kernels = System.getProperty("decora.simd.kernels", "auto");
+        System.out.println("prism.order=" + System.getProperty("prism.order", "default")
+                + " decora.simd.kernels=" + kernels);
+
+        SnapshotParameters params = new SnapshotParameters();
+        params.setFill(Color.TRANSPARENT);
+        WritableImage image = null;
+        for (Case c : CASES) {
+            content.setEffect(c.effect().get());
+            for (int i = 0; i < WARMUP; i++) {
+                image = content.snapshot(params, image);
+            }
+            long start = System.nanoTime();
+            for (int i = 0; i < ITERATIONS; i++) {
+                image = content.snapshot(params, image);
+            }
+            double ms = (System.nanoTime() - start) / 1e6 / ITERATIONS;
+            System.out.printf("%-32s %8.2f ms/iteration%n", c.name(), ms);
+        }
+        Platform.exit();
+    }
+
+    private static Node createContent() {
+        Group g = new Group();
+        g.getChildren().add(new Rectangle(SIZE, SIZE, Color.WHITESMOKE));
+        for (int y = 0; y < 8; y++) {
+            for (int x = 0; x < 8; x++) {
+                Circle c = new Circle(SIZE / 16.0, Color.hsb((x * 8 + y) * 5.6, 0.8, 0.9, 0.8));
+                c.setCenterX((x + 0.5) * SIZE / 8);
+                c.setCenterY((y + 0.5) * SIZE / 8);
+                g.getChildren().add(c);
+            }
+        }
+        return g;
+    }
+
+    public static void main(String[] args) {
+        Application.launch(args);
+    }
+}
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * Standalone benchmark of the Decora SSE peer kernels. It times each pass
+ * of the box blur, box shadow and linear convolve kernels of every
+ * instruction set the processor supports, on images of a few sizes, and
+ * checks the SIMD kernels give the same pixels as the scalar ones.
+ *
+ * Build and run from the top of the repository, for example on Linux:
+ *
+ *   g++ -O2 -I$JAVA_HOME/include -I$JAVA_HOME/include/linux \
+ *       -Imodules/javafx.graphics/src/main/native-decora \
+ *       tests/performance/decoraKernels/DecoraKernelsBenchmark.cc -o dkbench
+ *   ./dkbench [-csv] [size...]
+ *
+ * With -csv the results are printed as comma separated values, one line
+ * per kernel, instruction set and size.
+ */
+
+#include <SSEKernels.cc>
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+// Box size of the box passes and kernel size of the convolve passes
+#define BOX_SIZE 11
+#define KERNEL_SIZE 21
+
+typedef struct {
+    jint size;
+    jint *src;
+    jint *dst;
+    jint *ref;
+    jfloat kvals[KERNEL_SIZE * 2];
+    jint shadowRGBs[256];
+    jfloat shadowColor[4];
+} Images;
+
+typedef void (*Pass)(const DecoraKernels *k, Images *im);
+
+/*
+ * The horizontal passes widen the image by the kernel size minus one,
+ * the vertical ones make it that much higher.
+ */
+
+static void boxBlurHorizontal(const DecoraKernels *k, Images *im)
+{
+    jint s = im->size;
+    k->boxBlurHorizontal(im->dst, s + BOX_SIZE - 1, s, s + BOX_SIZE - 1, im->src, s, s, s);
+}
+
+static void boxBlurVertical(const DecoraKernels *k, Images *im)
+{
+    jint s = im->size;
+    k->boxBlurVertical(im->dst, s, s + BOX_SIZE - 1, s, im->src, s, s, s);
+}
+
+static void boxShadowHorizontalBlack(const DecoraKernels *k, Images *im)
+{
+    jint s = im->size;
+    k->boxShadowHorizontalBlack(im->dst, s + BOX_SIZE - 1, s, s + BOX_SIZE - 1,
+                                im->src, s, s, s, 0.3f);
+}
+
+static void boxShadowVerticalBlack(const DecoraKernels *k, Images *im)
+{
+    jint s = im->size;
+    k->boxShadowVerticalBlack(im->dst, s, s + BOX_SIZE - 1, s, im->src, s, s, s, 0.3f);
+}
+
+static void boxShadowVertical(const DecoraKernels *k, Images *im)
+{
+    jint s = im->size;
+    k->boxShadowVertical(im->dst, s, s + BOX_SIZE - 1, s, im->src, s, s, s,
+                         0.3f, im->shadowColor);
+}
+
+static void convolveHorizontal(const DecoraKernels *k, Images *im)
+{
+    jint s = im->size;
+    k->convolveHV(im->dst, s + KERNEL_SIZE - 1, s, 1, s + KERNEL_SIZE - 1,
+                  im->src, s, s, 1, s, im->kvals, KERNEL_SIZE);
+}
+
+static void convolveVertical(const DecoraKernels *k, Images *im)
+{
+    jint s = im->size;
+    k->convolveHV(im->dst, s + KERNEL_SIZE - 1, s, s, 1,
+                  im->src, s, s, s, 1, im->kvals, KERNEL_SIZE);
+}
+
+static void convolveShadowHorizontal(const DecoraKernels *k, Images *im)
+{
+    jint s = im->size;
+    k->convolveShadowHV(im->dst, s + KERNEL_SIZE - 1, s, 1, s + KERNEL_SIZE - 1,
+                        im->src, s, s, 1, s, im->kvals, KERNEL_SIZE, im->shadowRGBs);
+}
+
+static const struct {
+    const char *name;
+    Pass pass;
+} passes[] = {
+    { "boxBlurHorizontal", boxBlurHorizontal },
+    { "boxBlurVertical", boxBlurVertical },
+    { "boxShadowHorizontalBlack", boxShadowHorizontalBlack },
+    { "boxShadowVerticalBlack", boxShadowVerticalBlack },
+    { "boxShadowVertical", boxShadowVertical },
+    { "convolveHorizontal", convolveHorizontal },
+    { "convolveVertical", convolveVertical },
+    { "convolveShadowHorizontal", convolveShadowHorizontal },
+};
+
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static jint *allocImage(jint size)
+{
+    // room for the widened or heightened destination
+    size_t count = (size_t)(size + KERNEL_SIZE) * (size + KERNEL_SIZE);
+    jint *p = (jint *)calloc(count, sizeof(jint));
+
+    if (p == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+static void initImages(Images *im, jint size)
+{
+    jint i;
+    jfloat sum = 0.0f;
+
+    im->size = size;
+    im->src = allocImage(size);
+    im->dst = allocImage(size);
+    im->ref = allocImage(size);
+    for (i = 0; i < size * size; i++) {
+        // pre-multiplied pixels, with runs of transparent ones
+        jint a = (i / 37) % 5 == 0 ? 0 : rand() & 0xff;
+        im->src[i] = (a << 24) | ((rand() % (a + 1)) << 16) |
+                     ((rand() % (a + 1)) << 8) | (rand() % (a + 1));
+    }
+    for (i = 0; i < KERNEL_SIZE; i++) {
+        jfloat d = (i - KERNEL_SIZE / 2) / (KERNEL_SIZE / 6.0f);
+        im->kvals[i] = expf(-d * d / 2);
+        sum += im->kvals[i];
+    }
+    for (i = 0; i < KERNEL_SIZE; i++) {
+        im->kvals[i] /= sum;
+        im->kvals[i + KERNEL_SIZE] = im->kvals[i];
+    }
+    for (i = 0; i < 256; i++) {
+        im->shadowRGBs[i] = (i << 24) | ((i / 4) << 16) | ((i / 3) << 8) | (i / 2);
+    }
+    im->shadowColor[0] = 0.25f;
+    im->shadowColor[1] = 0.33f;
+    im->shadowColor[2] = 0.5f;
+    im->shadowColor[3] = 0.8f;
+}
+
+static void freeImages(Images *im)
+{
+    free(im->src);
+    free(im->dst);
+    free(im->ref);
+}
+
+/*
+ * Returns the average time of one pass in milliseconds.
+ */
+static double run(const DecoraKernels *k, Pass pass, Images *im)
+{
+    // about 100M pixels per measurement, at least 3 runs
+    jint runs = 100000000 / (im->size * im->size);
+    double start;
+    jint i;
+
+    if (runs < 3) {
+        runs = 3;
+    }
+    pass(k, im); // warm up
+    start = now();
+    for (i = 0; i < runs; i++) {
+        pass(k, im);
+    }
+    return (now() - start) / runs;
+}
+
+int main(int argc, char **argv)
+{
+    static const jint defaultSizes[] = { 128, 512, 2048 };
+    jint sizes[16];
+    jint sizeCount = 0;
+    int csv = 0;
+    int argi;
+    size_t imageBytes;
+
+    for (argi = 1; argi < argc; argi++) {
+        if (strcmp(argv[argi], "-csv") == 0) {
+            csv = 1;
+        } else if (sizeCount < 16 && atoi(argv[argi]) > 0) {
+            sizes[sizeCount++] = atoi(argv[argi]);
+        } else {
+            fprintf(stderr, "Usage: %s [-csv] [size...]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (sizeCount == 0) {
+        for (; sizeCount < 3; sizeCount++) {
+            sizes[sizeCount] = defaultSizes[sizeCount];
+        }
+    }
+
+    if (csv) {
+        printf("kernel,isa,width,height,ms,mpixels_per_s,matches_scalar\n");
+    }
+    for (jint s = 0; s < sizeCount; s++) {
+        Images im;
+
+        initImages(&im, sizes[s]);
+        imageBytes = (size_t)(sizes[s] + KERNEL_SIZE) * (sizes[s] + KERNEL_SIZE) * sizeof(jint);
+        if (!csv) {
+            printf("%dx%d\n", sizes[s], sizes[s]);
+        }
+        for (size_t p = 0; p < sizeof(passes) / sizeof(passes[0]); p++) {
+            double scalarMs = 0.0;
+
+            for (jint level = DECORA_KERNELS_SCALAR; level <= DECORA_KERNELS_NEON; level++) {
+                const DecoraKernels *k = getDecoraKernels(level);
+                double ms;
+                int same;
+
+                if (k == NULL) {
+                    continue;
+                }
+                memset(im.dst, 0, imageBytes);
+                ms = run(k, passes[p].pass, &im);
+                if (level == DECORA_KERNELS_SCALAR) {
+                    memcpy(im.ref, im.dst, imageBytes);
+                    scalarMs = ms;
+                }
+                same = memcmp(im.ref, im.dst, imageBytes) == 0;
+                if (csv) {
+                    printf("%s,%s,%d,%d,%.4f,%.1f,%d\n", passes[p].name, k->name,
+                           sizes[s], sizes[s], ms,
+                           (double)sizes[s] * sizes[s] / ms / 1000.0, same);
+                } else {
+                    printf("  %-26s %-7s %9.3f ms  %6.2fx%s\n", passes[p].name, k->name,
+                           ms, scalarMs / ms, same ? "" : "  (output differs)");
+                }
+            }
+        }
+        freeImages(&im);
+    }
+
+    return 0;
+}
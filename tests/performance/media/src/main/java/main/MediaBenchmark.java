@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package main;
+
+import com.sun.media.jfxmedia.MediaManager;
+import com.sun.media.jfxmedia.MediaPlayer;
+import com.sun.media.jfxmedia.MediaPlayerStatistics;
+import com.sun.media.jfxmedia.control.VideoDataBuffer;
+import com.sun.media.jfxmedia.control.VideoFormat;
+import com.sun.media.jfxmedia.control.VideoRenderControl;
+import com.sun.media.jfxmedia.events.NewFrameEvent;
+import com.sun.media.jfxmedia.events.PlayerStateEvent;
+import com.sun.media.jfxmedia.events.PlayerStateListener;
+import com.sun.media.jfxmedia.events.VideoRendererListener;
+import com.sun.media.jfxmedia.locator.Locator;
+import java.io.IOException;
+import java.lang.management.ManagementFactory;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.stream.Stream;
+
+/**
+ * Measures decoding and frame delivery of the media pipelines.
+ * <p>
+ * Each file given on the command line, and each file in a given directory,
+ * is played {@value #ITERATIONS} times through the jfxmedia player the
+ * platform picks for it: GStreamer with its av or mfwrapper plugins, or
+ * AVFoundation on macOS. No window is shown. The frames are taken straight
+ * from the renderer listener and converted to BGRA like the software
+ * pipelines do, and playback runs at the maximum rate of {@value #RATE}
+ * with the volume at zero.
+ * <p>
+ * The averages over the runs are reported: the decoded and the delivered
+ * frames per second, the native and the Java color conversion time per
+ * frame, the average and longest wait of a frame between decoding and its
+ * delivery to Java, the dropped and late frames, the audio and video queue
+ * underruns and the CPU use of the process. The native counters come from
+ * {@link MediaPlayer#getStatistics()}. The AVFoundation players do not
+ * provide them, so they are printed as n/a. GPU use is not reported, there
+ * is no portable way to read it. The conversion kernels alone are measured
+ * by the colorConverter benchmark.
+ * <p>
+ * The player is internal, run with
+ * {@code --add-exports javafx.media/com.sun.media.jfxmedia=ALL-UNNAMED
+ * --add-exports javafx.media/com.sun.media.jfxmedia.control=ALL-UNNAMED
+ * --add-exports javafx.media/com.sun.media.jfxmedia.events=ALL-UNNAMED
+ * --add-exports javafx.media/com.sun.media.jfxmedia.locator=ALL-UNNAMED}.
+ */
+public class MediaBenchmark {
+
+    private static final float RATE = 8.0f;
+    private static final int ITERATIONS = 3;
+    private static final long READY_TIMEOUT_MS = 30000;
+    private static final long PLAY_TIMEOUT_MS = 600000;
+
+    private static final com.sun.management.OperatingSystemMXBean OS =
+            (com.sun.management.OperatingSystemMXBean) ManagementFactory.getOperatingSystemMXBean();
+
+    /**
+     * The measurements of one or more runs of a file.
+     */
+    private static class Totals {
+        String pipeline = "";
+        long wallNanos;
+        long cpuNanos;
+        long delivered;
+        long javaConversionNanos;
+        boolean hasStatistics = true;
+        long decoded;
+        long dropped;
+        long late;
+        long converted;
+        long conversionMicros;
+        long handoffMicros;
+        long maxHandoffMicros;
+        long underruns;
+
+        void add(MediaPlayerStatistics s) {
+            if (s == null) {
+                hasStatistics = false;
+                return;
+            }
+            decoded += s.getDecodedFrames();
+            dropped += s.getDroppedFrames();
+            late += s.getLateFrames();
+            converted += s.getConvertedFrames();
+            conversionMicros += s.getConversionTime();
+            handoffMicros += s.getHandoffTime();
+            maxHandoffMicros = Math.max(maxHandoffMicros, s.getMaxHandoffTime());
+            underruns += s.getQueueUnderruns();
+        }
+    }
+
+    public static void main(String[] args) throws IOException {
+        if (args.length == 0) {
+            System.err.println("Usage: MediaBenchmark <file or directory>...");
+            System.exit(1);
+        }
+        List<Path> files = new ArrayList<>();
+        for (String arg : args) {
+            Path path = Path.of(arg);
+            if (Files.isDirectory(path)) {
+                try (Stream<Path> s = Files.walk(path)) {
+                    s.filter(Files::isRegularFile).sorted().forEach(files::add);
+                }
+            } else {
+                files.add(path);
+            }
+        }
+
+        System.out.printf("%-32s %-18s %8s %8s %8s %8s %12s %8s %8s %9s %6s%n",
+                "file", "pipeline", "dec fps", "fps", "conv us", "java us",
+                "handoff us", "dropped", "late", "underruns", "cpu %");
+        int failures = 0;
+        for (Path file : files) {
+            Totals totals = new Totals();
+            try {
+                // one unmeasured run to load the plugins and warm up
+                play(file, new Totals());
+                for (int i = 0; i < ITERATIONS; i++) {
+                    play(file, totals);
+                }
+            } catch (Exception e) {
+                System.out.printf("%-32s %s%n", name(file), e.getMessage());
+                failures++;
+                continue;
+            }
+            report(file, totals);
+        }
+        System.exit(failures == 0 ? 0 : 1);
+    }
+
+    private static void play(Path file, Totals totals) throws Exception {
+        Locator locator = new Locator(file.toUri());
+        locator.init();
+        MediaPlayer player = MediaManager.getPlayer(locator);
+
+        CountDownLatch ready = new CountDownLatch(1);
+        CountDownLatch finished = new CountDownLatch(1);
+        String[] error = new String[1];
+        player.addMediaErrorListener((source, code, message) -> {
+            error[0] = message;
+            ready.countDown();
+            finished.countDown();
+        });
+        player.addMediaPlayerListener(new PlayerStateListener() {
+            @Override public void onReady(PlayerStateEvent evt) {
+                ready.countDown();
+            }
+            @Override public void onPlaying(PlayerStateEvent evt) {}
+            @Override public void onPause(PlayerStateEvent evt) {}
+            @Override public void onStop(PlayerStateEvent evt) {}
+            @Override public void onStall(PlayerStateEvent evt) {}
+            @Override public void onFinish(PlayerStateEvent evt) {
+                finished.countDown();
+            }
+            @Override public void onHalt(PlayerStateEvent evt) {
+                error[0] = evt.getMessage() != null ? evt.getMessage() : "playback halted";
+                ready.countDown();
+                finished.countDown();
+            }
+        });
+
+        AtomicLong delivered = new AtomicLong();
+        AtomicLong conversion = new AtomicLong();
+        VideoRenderControl video = player.getVideoRenderControl();
+        if (video != null) {
+            video.addVideoRendererListener(new VideoRendererListener() {
+                @Override
+                public void videoFrameUpdated(NewFrameEvent event) {
+                    VideoDataBuffer frame = event.getFrameData();
+                    if (frame == null) {
+                        return;
+                    }
+                    delivered.incrementAndGet();
+                    long start = System.nanoTime();
+                    VideoDataBuffer bgra = frame.convertToFormat(VideoFormat.BGRA_PRE);
+                    conversion.addAndGet(System.nanoTime() - start);
+                    if (bgra != null) {
+                        bgra.releaseFrame();
+                    }
+                }
+
+                @Override
+                public void releaseVideoFrames() {
+                }
+            });
+        }
+
+        try {
+            if (!ready.await(READY_TIMEOUT_MS, TimeUnit.MILLISECONDS)) {
+                throw new IOException("player did not get ready");
+            }
+            if (error[0] != null) {
+                throw new IOException(error[0]);
+            }
+            player.setVolume(0f);
+            player.setRate(RATE);
+            long cpuStart = OS.getProcessCpuTime();
+            long start = System.nanoTime();
+            player.play();
+            if (!finished.await(PLAY_TIMEOUT_MS, TimeUnit.MILLISECONDS)) {
+                throw new IOException("playback did not finish");
+            }
+            long end = System.nanoTime();
+            long cpuEnd = OS.getProcessCpuTime();
+            if (error[0] != null) {
+                throw new IOException(error[0]);
+            }
+
+            totals.pipeline = player.getClass().getSimpleName();
+            totals.wallNanos += end - start;
+            totals.cpuNanos += cpuEnd - cpuStart;
+            totals.delivered += delivered.get();
+            totals.javaConversionNanos += conversion.get();
+            totals.add(player.getStatistics());
+        } finally {
+            player.dispose();
+        }
+    }
+
+    private static void report(Path file, Totals t) {
+        double seconds = t.wallNanos / 1e9;
+        double fps = seconds > 0 ? t.delivered / seconds : 0;
+        double javaMicros = t.delivered > 0 ? t.javaConversionNanos / 1e3 / t.delivered : 0;
+        double cpu = t.wallNanos > 0 ? 100.0 * t.cpuNanos / t.wallNanos : 0;
+        if (t.hasStatistics) {
+            double decodedFps = seconds > 0 ? t.decoded / seconds : 0;
+            double convMicros = t.converted > 0 ? (double) t.conversionMicros / t.converted : 0;
+            long handoffMicros = t.decoded > 0 ? t.handoffMicros / t.decoded : 0;
+            System.out.printf("%-32s %-18s %8.1f %8.1f %8.1f %8.1f %12s %8d %8d %9d %6.0f%n",
+                    name(file), t.pipeline, decodedFps, fps, convMicros, javaMicros,
+                    handoffMicros + "/" + t.maxHandoffMicros,
+                    t.dropped / ITERATIONS, t.late / ITERATIONS, t.underruns / ITERATIONS, cpu);
+        } else {
+            System.out.printf("%-32s %-18s %8s %8.1f %8s %8.1f %12s %8s %8s %9s %6.0f%n",
+                    name(file), t.pipeline, "n/a", fps, "n/a", javaMicros,
+                    "n/a", "n/a", "n/a", "n/a", cpu);
+        }
+    }
+
+    private static String name(Path file) {
+        String name = file.getFileName().toString();
+        return name.length() > 32 ? name.substring(0, 29) + "..." : name;
+    }
+}
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * Standalone benchmark of the span routines of the Pisces SIMD blitters.
+ * It times the SrcOver, Src and paint SrcOver spans of every instruction
+ * set the processor supports on rows of random coverage, and checks them
+ * against the scalar blend functions the blitters fall back to.
+ *
+ * Build and run from the top of the repository once the native headers
+ * have been generated, for example on Linux:
+ *
+ *   gcc -O2 -I$JAVA_HOME/include -I$JAVA_HOME/include/linux \
+ *       -Imodules/javafx.graphics/build/gensrc/headers/javafx.graphics \
+ *       -Imodules/javafx.graphics/src/main/native-prism-sw \
+ *       tests/performance/piscesBlitters/PiscesBlittersBenchmark.c -lm -o pbbench
+ *   ./pbbench [-csv] [width height]
+ *
+ * With -csv the results are printed as comma separated values, one line
+ * per span routine and instruction set.
+ */
+
+#include <PiscesBlit.c>
+#include <PiscesBlitSIMD.c>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+typedef struct {
+    jint width;
+    jint height;
+    jint *dst;
+    jint *ref;
+    jint *init;
+    jint *paint;
+    jint *coverage;
+    jint *fracs;
+} Rows;
+
+/*
+ * Scalar spans, doing per pixel what the scalar blitters of PiscesBlit.c
+ * do for the same coverage.
+ */
+
+static void srcOverScalar(jint *dst, const jint *avals, jint n, jint src) {
+    jint k;
+    for (k = 0; k < n; k++) {
+        if (avals[k] == MAX_ALPHA) {
+            dst[k] = src;
+        } else if (avals[k] > 0) {
+            blendSrcOver8888_pre(&dst[k], avals[k], R(src), G(src), B(src));
+        }
+    }
+}
+
+static void srcScalar(jint *dst, const jint *covs, jint n, jint calpha, jint src) {
+    jint k;
+    for (k = 0; k < n; k++) {
+        jint acoverage = covs[k];
+        if (acoverage == MAX_ALPHA) {
+            dst[k] = (calpha << 24) | src;
+        } else if (acoverage > 0) {
+            blendSrc8888_pre(&dst[k], ((acoverage + 1) * calpha) >> 8, 255 - acoverage,
+                             R(src), G(src), B(src));
+        }
+    }
+}
+
+static void ptSrcOverScalar(jint *dst, const jint *paint, const jint *fracs, jint n,
+                            jboolean keepTransparent) {
+    jint k;
+    for (k = 0; k < n; k++) {
+        jint cval = paint[k];
+        jint palpha = A(cval);
+        jint aval;
+        if (fracs[k] == 0) {
+            continue;
+        }
+        aval = (fracs[k] * palpha) >> 8;
+        if (aval == MAX_ALPHA) {
+            dst[k] = cval;
+        } else if (aval > 0) {
+            blendSrcOver8888_pre_pre(&dst[k], fracs[k], palpha, R(cval), G(cval), B(cval));
+        }
+    }
+}
+
+static const SpanBlitters scalarBlitters = {
+    PISCES_BLIT_SCALAR, "scalar",
+    srcOverScalar,
+    srcScalar,
+    ptSrcOverScalar,
+};
+
+typedef void (*Span)(const SpanBlitters *spans, Rows *rows, jint offset, jint n);
+
+static void srcOverSpan(const SpanBlitters *spans, Rows *rows, jint offset, jint n) {
+    spans->srcOver(rows->dst + offset, rows->coverage + offset, n, 0xff3080c0);
+}
+
+static void srcSpan(const SpanBlitters *spans, Rows *rows, jint offset, jint n) {
+    spans->src(rows->dst + offset, rows->coverage + offset, n, 0xc0, 0x3080c0);
+}
+
+static void ptSrcOverSpan(const SpanBlitters *spans, Rows *rows, jint offset, jint n) {
+    spans->ptSrcOver(rows->dst + offset, rows->paint + offset, rows->fracs + offset, n, XNI_TRUE);
+}
+
+static const struct {
+    const char *name;
+    Span span;
+} spanRoutines[] = {
+    { "srcOver", srcOverSpan },
+    { "src", srcSpan },
+    { "ptSrcOver", ptSrcOverSpan },
+};
+
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static jint *allocPixels(size_t count)
+{
+    jint *p = (jint *)malloc(count * sizeof(jint));
+
+    if (p == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+static jint randomPremultiplied(void)
+{
+    jint a = rand() & 0xff;
+    return (a << 24) | ((rand() % (a + 1)) << 16) | ((rand() % (a + 1)) << 8) | (rand() % (a + 1));
+}
+
+static void initRows(Rows *rows, jint width, jint height)
+{
+    size_t count = (size_t)width * height;
+    size_t i;
+
+    rows->width = width;
+    rows->height = height;
+    rows->dst = allocPixels(count);
+    rows->ref = allocPixels(count);
+    rows->init = allocPixels(count);
+    rows->paint = allocPixels(count);
+    rows->coverage = allocPixels(count);
+    rows->fracs = allocPixels(count);
+    for (i = 0; i < count; i++) {
+        // shapes have runs of full and of no coverage, with edges between
+        jint run = (jint)(i / 23) % 4;
+        jint cov = run == 0 ? 0 : run == 1 ? MAX_ALPHA : rand() & 0xff;
+        rows->init[i] = randomPremultiplied();
+        rows->paint[i] = randomPremultiplied();
+        rows->coverage[i] = cov;
+        rows->fracs[i] = cov ? cov + 1 : 0;
+    }
+}
+
+/*
+ * Blends all rows in chunks of SPAN_CHUNK pixels like the blitters do,
+ * starting from the same destination each time. Returns the average time
+ * of one pass over the rows in milliseconds.
+ */
+static double run(const SpanBlitters *spans, Span span, Rows *rows)
+{
+    size_t count = (size_t)rows->width * rows->height;
+    // about 100M pixels per measurement, at least 3 runs
+    jint runs = (jint)(100000000 / count);
+    double total = 0.0;
+    jint r;
+
+    if (runs < 3) {
+        runs = 3;
+    }
+    for (r = 0; r <= runs; r++) {
+        double start;
+        jint y, x;
+
+        memcpy(rows->dst, rows->init, count * sizeof(jint));
+        start = now();
+        for (y = 0; y < rows->height; y++) {
+            jint offset = y * rows->width;
+            for (x = 0; x < rows->width; x += SPAN_CHUNK) {
+                jint n = rows->width - x < SPAN_CHUNK ? rows->width - x : SPAN_CHUNK;
+                span(spans, rows, offset + x, n);
+            }
+        }
+        // the first pass is a warm up
+        if (r > 0) {
+            total += now() - start;
+        }
+    }
+    return total / runs;
+}
+
+int main(int argc, char **argv)
+{
+    Rows rows;
+    jint width = 1920;
+    jint height = 1080;
+    int csv = 0;
+    int argi = 1;
+    size_t i;
+
+    if (argi < argc && strcmp(argv[argi], "-csv") == 0) {
+        csv = 1;
+        argi++;
+    }
+    if (argc - argi == 2) {
+        width = atoi(argv[argi]);
+        height = atoi(argv[argi + 1]);
+    } else if (argc != argi) {
+        width = 0;
+    }
+    if (width <= 0 || height <= 0) {
+        fprintf(stderr, "Usage: %s [-csv] [width height]\n", argv[0]);
+        return 1;
+    }
+
+    initRows(&rows, width, height);
+    if (csv) {
+        printf("kernel,isa,width,height,ms,mpixels_per_s,matches_scalar\n");
+    } else {
+        printf("%dx%d\n", width, height);
+    }
+    for (i = 0; i < sizeof(spanRoutines) / sizeof(spanRoutines[0]); i++) {
+        double scalarMs = 0.0;
+        jint level;
+
+        for (level = PISCES_BLIT_SCALAR; level <= PISCES_BLIT_NEON; level++) {
+            const SpanBlitters *spans = level == PISCES_BLIT_SCALAR
+                    ? &scalarBlitters : getBlitters(level);
+            size_t bytes = (size_t)width * height * sizeof(jint);
+            double ms;
+            int same;
+
+            if (spans == NULL) {
+                continue;
+            }
+            ms = run(spans, spanRoutines[i].span, &rows);
+            if (level == PISCES_BLIT_SCALAR) {
+                memcpy(rows.ref, rows.dst, bytes);
+                scalarMs = ms;
+            }
+            same = memcmp(rows.ref, rows.dst, bytes) == 0;
+            if (csv) {
+                printf("%s,%s,%d,%d,%.4f,%.1f,%d\n", spanRoutines[i].name, spans->name,
+                       width, height, ms, (double)width * height / ms / 1000.0, same);
+            } else {
+                printf("  %-10s %-7s %9.3f ms  %6.2fx%s\n", spanRoutines[i].name, spans->name,
+                       ms, scalarMs / ms, same ? "" : "  (output differs)");
+            }
+        }
+    }
+
+    return 0;
+}
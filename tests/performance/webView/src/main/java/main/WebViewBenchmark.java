@@ -0,0 +1,429 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package main;
+
+import com.sun.javafx.webkit.Accessor;
+import com.sun.webkit.MemoryStatistics;
+import com.sun.webkit.WebPage;
+import com.sun.webkit.WebPageStatistics;
+import java.io.ByteArrayInputStream;
+import java.io.FileNotFoundException;
+import java.io.IOException;
+import java.io.InputStream;
+import java.net.URL;
+import java.net.URLConnection;
+import java.net.URLStreamHandler;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Queue;
+import java.util.stream.Stream;
+import javafx.animation.AnimationTimer;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.beans.value.ChangeListener;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Measures loading and rendering of pages in a WebView.
+ * <p>
+ * Pages are served from memory through the {@code bench:} protocol, so the
+ * results do not depend on the network. A directory of saved pages can be
+ * passed as the argument: each {@code .html} file in it is loaded, and the
+ * other files are served as subresources relative to the directory.
+ * <p>
+ * Each page is loaded {@value #ITERATIONS} times after {@value #WARMUP}
+ * warm-up loads and the averages are reported: the time to the first
+ * frame and to the end of the load, the layout and paint time, and the
+ * render queue bytes per frame. Then scrolling, canvas drawing and CSS
+ * animations are run for {@value #DURATION_MS} ms each. The memory used
+ * by WebKit and the Java heap are reported at the end.
+ * <p>
+ * The rendering counters are internal, run with
+ * {@code --add-exports javafx.web/com.sun.webkit=ALL-UNNAMED
+ * --add-exports javafx.web/com.sun.javafx.webkit=ALL-UNNAMED}.
+ */
+public class WebViewBenchmark extends Application {
+
+    private static final int WIDTH = 1024;
+    private static final int HEIGHT = 768;
+    private static final int WARMUP = 2;
+    private static final int ITERATIONS = 5;
+    private static final int DURATION_MS = 5000;
+
+    private static final String BASE_URL = "bench://pages/";
+
+    private static final Map<String, byte[]> BUILT_IN_PAGES = new HashMap<>();
+    private static Path corpus;
+
+    private record Counters(long frames, long rqBytes, long layout, long paint,
+                            long composite, long decode) {
+        static Counters of(WebPage page) {
+            WebPageStatistics s = page.getStatistics();
+            return new Counters(s.getFrames(), s.getRenderQueueBytes(), s.getLayoutTime(),
+                    s.getPaintTime(), s.getCompositeTime(), s.getDecodeTime());
+        }
+
+        Counters minus(Counters c) {
+            return new Counters(frames - c.frames, rqBytes - c.rqBytes, layout - c.layout,
+                    paint - c.paint, composite - c.composite, decode - c.decode);
+        }
+    }
+
+    private WebEngine engine;
+    private WebPage page;
+    private final Queue<Runnable> steps = new ArrayDeque<>();
+    private ChangeListener<Worker.State> loadListener;
+
+    @Override
+    public void start(Stage stage) throws IOException {
+        WebView view = new WebView();
+        stage.setScene(new Scene(view, WIDTH, HEIGHT));
+        stage.show();
+        engine = view.getEngine();
+        page = Accessor.getPageFor(engine);
+
+        List<String> pages = new ArrayList<>(List.of("article.html"));
+        if (corpus != null) {
+            try (Stream<Path> files = Files.walk(corpus)) {
+                files.filter(f -> f.toString().endsWith(".html"))
+                        .map(f -> corpus.relativize(f).toString().replace('\\', '/'))
+                        .sorted()
+                        .forEach(pages::add);
+            }
+        }
+
+        System.out.printf("%-40s %10s %10s %10s %10s %12s%n",
+                "page", "first ms", "load ms", "layout ms", "paint ms", "rq bytes/f");
+        for (String name : pages) {
+            List<Counters> loads = new ArrayList<>();
+            long[] times = new long[2];
+            for (int i = 0; i < WARMUP + ITERATIONS; i++) {
+                boolean measured = i >= WARMUP;
+                steps.add(() -> measureLoad(name, (firstFrame, loaded, counters) -> {
+                    if (measured) {
+                        times[0] += firstFrame;
+                        times[1] += loaded;
+                        loads.add(counters);
+                    }
+                }));
+            }
+            steps.add(() -> {
+                Counters sum = loads.stream().reduce(new Counters(0, 0, 0, 0, 0, 0),
+                        (a, b) -> new Counters(a.frames + b.frames, a.rqBytes + b.rqBytes,
+                                a.layout + b.layout, a.paint + b.paint,
+                                a.composite + b.composite, a.decode + b.decode));
+                int n = Math.max(loads.size(), 1);
+                System.out.printf("%-40s %10.1f %10.1f %10.2f %10.2f %12d%n", name,
+                        times[0] / 1e6 / n, times[1] / 1e6 / n,
+                        sum.layout / 1e3 / n, sum.paint / 1e3 / n,
+                        sum.rqBytes / Math.max(sum.frames, 1));
+                next();
+            });
+        }
+
+        steps.add(() -> {
+            System.out.printf("%n%-40s %10s %10s %10s %10s %10s %12s%n", "scenario",
+                    "fps", "script ms", "layout ms", "paint ms", "decode ms", "rq bytes/f");
+            next();
+        });
+        steps.add(() -> measureAnimation("scroll", "article.html",
+                "window.scrollBy(0, 40);"
+                + "if (window.scrollY + window.innerHeight >= document.body.scrollHeight)"
+                + " window.scrollTo(0, 0);"));
+        steps.add(() -> measureAnimation("canvas", "canvas.html", null));
+        steps.add(() -> measureAnimation("css animation", "css-animation.html", null));
+        steps.add(() -> {
+            Runtime rt = Runtime.getRuntime();
+            System.out.printf("%n%s%nJava heap used: %d KB%n", page.getMemoryStatistics(),
+                    (rt.totalMemory() - rt.freeMemory()) / 1024);
+            Platform.exit();
+        });
+        next();
+    }
+
+    private void next() {
+        Runnable step = steps.poll();
+        if (step != null) {
+            // Let the previous page settle before measuring the next step
+            Platform.runLater(step);
+        }
+    }
+
+    private interface LoadResult {
+        void accept(long firstFrame, long loaded, Counters counters);
+    }
+
+    /**
+     * Loads the page and reports the time to the first frame queued for
+     * rendering and to the end of the load, both in nanoseconds.
+     */
+    private void measureLoad(String name, LoadResult result) {
+        Counters before = Counters.of(page);
+        long start = System.nanoTime();
+        long[] firstFrame = { -1 };
+        long[] loaded = { -1 };
+        AnimationTimer timer = new AnimationTimer() {
+            @Override public void handle(long now) {
+                if (firstFrame[0] < 0 && page.getStatistics().getFrames() > before.frames) {
+                    firstFrame[0] = System.nanoTime() - start;
+                }
+                if (firstFrame[0] >= 0 && loaded[0] >= 0) {
+                    stop();
+                    result.accept(firstFrame[0], loaded[0], Counters.of(page).minus(before));
+                    next();
+                }
+            }
+        };
+        load(name, succeeded -> {
+            if (!succeeded) {
+                timer.stop();
+                System.out.println(name + ": load failed");
+                next();
+                return;
+            }
+            loaded[0] = System.nanoTime() - start;
+        });
+        timer.start();
+    }
+
+    /**
+     * Loads the page and lets it run for {@link #DURATION_MS}, evaluating
+     * the script on every pulse if there is one. Pages report the time
+     * their own scripts take in {@code window.benchScriptTime}.
+     */
+    private void measureAnimation(String name, String url, String script) {
+        load(url, succeeded -> {
+            if (!succeeded) {
+                System.out.println(name + ": load failed");
+                next();
+                return;
+            }
+            engine.executeScript("window.benchScriptTime = 0");
+            Counters before = Counters.of(page);
+            long start = System.nanoTime();
+            long[] scriptTime = { 0 };
+            new AnimationTimer() {
+                @Override public void handle(long now) {
+                    long elapsed = System.nanoTime() - start;
+                    if (elapsed < DURATION_MS * 1_000_000L) {
+                        if (script != null) {
+                            long t = System.nanoTime();
+                            engine.executeScript(script);
+                            scriptTime[0] += System.nanoTime() - t;
+                        }
+                        return;
+                    }
+                    stop();
+                    Counters c = Counters.of(page).minus(before);
+                    double pageScriptMs = ((Number) engine.executeScript(
+                            "window.benchScriptTime || 0")).doubleValue();
+                    long frames = Math.max(c.frames, 1);
+                    System.out.printf("%-40s %10.1f %10.2f %10.2f %10.2f %10.2f %12d%n", name,
+                            c.frames * 1e9 / elapsed,
+                            (scriptTime[0] / 1e6 + pageScriptMs) / frames,
+                            c.layout / 1e3 / frames, c.paint / 1e3 / frames,
+                            c.decode / 1e3 / frames, c.rqBytes / frames);
+                    next();
+                }
+            }.start();
+        });
+    }
+
+    private interface LoadCallback {
+        void done(boolean succeeded);
+    }
+
+    private void load(String name, LoadCallback callback) {
+        if (loadListener != null) {
+            engine.getLoadWorker().stateProperty().removeListener(loadListener);
+        }
+        loadListener = (ov, oldState, state) -> {
+            if (state == Worker.State.SUCCEEDED || state == Worker.State.FAILED
+                    || state == Worker.State.CANCELLED) {
+                engine.getLoadWorker().stateProperty().removeListener(loadListener);
+                loadListener = null;
+                callback.done(state == Worker.State.SUCCEEDED);
+            }
+        };
+        engine.getLoadWorker().stateProperty().addListener(loadListener);
+        engine.load(BASE_URL + name);
+    }
+
+    private static final class Handler extends URLStreamHandler {
+        @Override protected URLConnection openConnection(URL url) {
+            return new URLConnection(url) {
+                private byte[] content;
+
+                @Override public void connect() throws IOException {
+                    if (content == null) {
+                        content = read(url.getPath());
+                    }
+                    connected = true;
+                }
+
+                @Override public InputStream getInputStream() throws IOException {
+                    connect();
+                    return new ByteArrayInputStream(content);
+                }
+
+                @Override public String getContentType() {
+                    String path = url.getPath();
+                    String type = path.endsWith(".css") ? "text/css"
+                            : path.endsWith(".js") ? "text/javascript"
+                            : URLConnection.guessContentTypeFromName(path);
+                    return type != null ? type : "application/octet-stream";
+                }
+
+                @Override public long getContentLengthLong() {
+                    try {
+                        connect();
+                    } catch (IOException e) {
+                        return -1;
+                    }
+                    return content.length;
+                }
+            };
+        }
+
+        private static byte[] read(String path) throws IOException {
+            String name = path.startsWith("/") ? path.substring(1) : path;
+            byte[] content = BUILT_IN_PAGES.get(name);
+            if (content != null) {
+                return content;
+            }
+            if (corpus != null) {
+                Path file = corpus.resolve(name).normalize();
+                if (file.startsWith(corpus) && Files.isRegularFile(file)) {
+                    return Files.readAllBytes(file);
+                }
+            }
+            throw new FileNotFoundException(path);
+        }
+    }
+
+    private static void addPage(String name, String html) {
+        BUILT_IN_PAGES.put(name, html.getBytes(StandardCharsets.UTF_8));
+    }
+
+    private static void createBuiltInPages() {
+        StringBuilder article = new StringBuilder("""
+            <!DOCTYPE html><html><head><style>
+            body { font: 15px/1.5 sans-serif; margin: 2em auto; max-width: 60em; }
+            h2 { border-bottom: 1px solid #ccc; }
+            table { border-collapse: collapse; width: 100%; }
+            td { border: 1px solid #ddd; padding: 2px 6px; }
+            tr:nth-child(odd) { background: #f4f6fa; }
+            .note { border-radius: 6px; box-shadow: 0 2px 6px rgba(0,0,0,.3); padding: 1em; }
+            </style></head><body>
+            """);
+        for (int i = 0; i < 200; i++) {
+            article.append("<h2>Section ").append(i).append("</h2>");
+            for (int p = 0; p < 3; p++) {
+                article.append("<p>Lorem ipsum dolor sit amet, <b>consectetur</b> adipiscing elit, ")
+                        .append("sed do eiusmod tempor <a href='#'>incididunt</a> ut labore et dolore ")
+                        .append("magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ")
+                        .append("ullamco <i>laboris</i> nisi ut aliquip ex ea commodo consequat.</p>");
+            }
+            if (i % 10 == 0) {
+                article.append("<div class='note'>Note ").append(i).append("</div><table>");
+                for (int r = 0; r < 20; r++) {
+                    article.append("<tr><td>").append(r).append("</td><td>")
+                            .append(r * 31 % 97).append("</td><td>row ").append(r).append("</td></tr>");
+                }
+                article.append("</table>");
+            }
+        }
+        article.append("</body></html>");
+        addPage("article.html", article.toString());
+
+        addPage("canvas.html", """
+            <!DOCTYPE html><html><body style="margin:0">
+            <canvas id="c" width="1024" height="768"></canvas>
+            <script>
+            window.benchScriptTime = 0;
+            const ctx = document.getElementById('c').getContext('2d');
+            let t = 0;
+            function frame() {
+                const start = performance.now();
+                ctx.fillStyle = '#fff';
+                ctx.fillRect(0, 0, 1024, 768);
+                for (let i = 0; i < 1000; i++) {
+                    const a = i * 0.37 + t * 0.02;
+                    ctx.fillStyle = 'hsla(' + (i * 7 % 360) + ',70%,50%,0.6)';
+                    ctx.beginPath();
+                    ctx.arc(512 + Math.cos(a) * (i % 360), 384 + Math.sin(a) * (i % 360),
+                            6 + i % 10, 0, 2 * Math.PI);
+                    ctx.fill();
+                }
+                ctx.fillStyle = '#000';
+                ctx.font = '20px sans-serif';
+                ctx.fillText('frame ' + t++, 10, 30);
+                window.benchScriptTime += performance.now() - start;
+                requestAnimationFrame(frame);
+            }
+            requestAnimationFrame(frame);
+            </script></body></html>
+            """);
+
+        StringBuilder animation = new StringBuilder("""
+            <!DOCTYPE html><html><head><style>
+            body { margin: 0; }
+            div { position: absolute; width: 40px; height: 40px; border-radius: 8px;
+                  animation: move 2s ease-in-out infinite alternate; }
+            @keyframes move {
+                from { transform: translate(0, 0) rotate(0deg); opacity: 1; }
+                to { transform: translate(200px, 100px) rotate(180deg); opacity: .4; }
+            }
+            </style></head><body>
+            """);
+        for (int i = 0; i < 300; i++) {
+            animation.append("<div style='left:").append(i % 20 * 40).append("px;top:")
+                    .append(i / 20 * 40).append("px;background:hsl(").append(i * 13 % 360)
+                    .append(",70%,50%);animation-delay:-").append(i % 10 * 0.2).append("s'></div>");
+        }
+        animation.append("</body></html>");
+        addPage("css-animation.html", animation.toString());
+    }
+
+    public static void main(String[] args) {
+        if (args.length > 0) {
+            corpus = Path.of(args[0]).toAbsolutePath().normalize();
+        }
+        createBuiltInPages();
+        URL.setURLStreamHandlerFactory(protocol -> "bench".equals(protocol) ? new Handler() : null);
+        Application.launch(args);
+    }
+}